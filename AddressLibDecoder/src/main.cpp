@@ -2,58 +2,179 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include <fmt/compile.h>
 #include <fmt/format.h>
 #include <mmio/mmio.hpp>
 #pragma warning(pop)
 
+#include "REL/AddressLibrary.h"
+
 using namespace std::literals;
 
-struct Pair
+using Pair = REL::AddressLibrary::mapping_t;
+
+class Library
 {
-	std::uint64_t id;
-	std::uint64_t offset;
+public:
+	explicit Library(const std::filesystem::path& a_path)
+	{
+		if (!_file.open(a_path.string())) {
+			throw std::runtime_error("failed to open: "s + a_path.string());
+		}
+
+		if (!REL::AddressLibrary::parse({ _file.data(), _file.size() }, _decoded, _data)) {
+			throw std::runtime_error("malformed address library: "s + a_path.string());
+		}
+	}
+
+	[[nodiscard]] std::span<const Pair> data() const noexcept { return _data; }
+
+private:
+	mmio::mapped_file_source _file;
+	std::vector<Pair> _decoded;
+	std::span<const Pair> _data;
 };
 
-int main(int a_argc, char* a_argv[])
+// formats into one reusable buffer, and only touches the file in large chunks
+class Output
 {
-	try {
-		mmio::mapped_file_source input;
-		std::ofstream output;
+public:
+	explicit Output(const std::filesystem::path& a_path) :
+		_file(a_path, std::ios::out | std::ios::trunc)
+	{
+		if (!_file.is_open()) {
+			throw std::runtime_error("failed to open: "s + a_path.string());
+		}
+	}
 
-		for (int i = 1; i < a_argc; ++i) {
-			std::filesystem::path filename = a_argv[static_cast<std::size_t>(i)];
-			if (!input.open(filename.string())) {
-				throw std::runtime_error("failed to open: "s + filename.string());
-			}
+	Output(const Output&) = delete;
+	Output(Output&&) = delete;
 
-			filename.replace_extension(".txt");
-			output.open(filename.c_str(), std::ios::out | std::ios::trunc);
-			if (!output.is_open()) {
-				throw std::runtime_error("failed to open: "s + filename.string());
-			}
+	~Output() { flush(); }
+
+	Output& operator=(const Output&) = delete;
+	Output& operator=(Output&&) = delete;
 
-			std::span data(
-				reinterpret_cast<const Pair*>(input.data() + sizeof(std::uint64_t)),
-				*reinterpret_cast<const std::uint64_t*>(input.data()));
-			if (!data.empty()) {
-				const auto width = fmt::format(FMT_STRING("{}"), data.back().id);
-				const auto format = fmt::format(FMT_STRING("{{: >{}}}\t{{:0>7X}}\n"), width.length());
-				for (const auto& elem : data) {
-					output << fmt::format(fmt::runtime(format), elem.id, elem.offset);
-				}
+	[[nodiscard]] fmt::memory_buffer& buffer() noexcept { return _buffer; }
+
+	void commit()
+	{
+		if (_buffer.size() >= FLUSH_SIZE) {
+			flush();
+		}
+	}
+
+	void flush()
+	{
+		_file.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+		_buffer.clear();
+	}
+
+private:
+	static constexpr std::size_t FLUSH_SIZE = 1u << 20;
+
+	std::ofstream _file;
+	fmt::memory_buffer _buffer;
+};
+
+void append_padded(fmt::memory_buffer& a_buffer, std::uint64_t a_id, std::size_t a_width)
+{
+	const fmt::format_int id(a_id);
+	for (auto i = id.size(); i < a_width; ++i) {
+		a_buffer.push_back(' ');
+	}
+	a_buffer.append(id.data(), id.data() + id.size());
+}
+
+void dump(const std::filesystem::path& a_path)
+{
+	const Library input(a_path);
+	const auto data = input.data();
+	Output output(std::filesystem::path(a_path).replace_extension(".txt"));
+	if (data.empty()) {
+		return;
+	}
+
+	const auto width = fmt::format_int(data.back().id).size();
+	auto& buffer = output.buffer();
+	for (const auto& elem : data) {
+		append_padded(buffer, elem.id, width);
+		fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("\t{:0>7X}\n"), elem.offset);
+		output.commit();
+	}
+}
+
+// both libraries are sorted by id, so one merge pass finds every change
+void diff(const std::filesystem::path& a_lhs, const std::filesystem::path& a_rhs)
+{
+	const Library lhs(a_lhs);
+	const Library rhs(a_rhs);
+	auto filename = a_lhs.stem();
+	filename += "_"sv;
+	filename += a_rhs.stem();
+	filename += ".diff.txt"sv;
+	Output output(a_rhs.parent_path() / filename);
+
+	auto& buffer = output.buffer();
+	std::size_t added = 0;
+	std::size_t removed = 0;
+	std::size_t moved = 0;
+	auto l = lhs.data().begin();
+	auto r = rhs.data().begin();
+	const auto lend = lhs.data().end();
+	const auto rend = rhs.data().end();
+	while (l != lend || r != rend) {
+		if (r == rend || (l != lend && l->id < r->id)) {
+			fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("-\t{}\t{:0>7X}\n"), l->id, l->offset);
+			++removed;
+			++l;
+		} else if (l == lend || r->id < l->id) {
+			fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("+\t{}\t{:0>7X}\n"), r->id, r->offset);
+			++added;
+			++r;
+		} else {
+			if (l->offset != r->offset) {
+				fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("~\t{}\t{:0>7X}\t{:0>7X}\n"), l->id, l->offset, r->offset);
+				++moved;
 			}
+			++l;
+			++r;
+		}
+		output.commit();
+	}
+
+	fmt::print(FMT_STRING("{}: {} added, {} removed, {} moved\n"), filename.string(), added, removed, moved);
+}
 
-			input.close();
-			output.close();
+int main(int a_argc, char* a_argv[])
+{
+	try {
+		// argv may be empty, without even the program name
+		const auto args = a_argc > 1 ?
+		                      std::span(a_argv + 1, static_cast<std::size_t>(a_argc - 1)) :
+		                      std::span<char*>();
+		if (!args.empty() && args[0] == "--diff"sv) {
+			if (args.size() != 3) {
+				throw std::runtime_error("usage: AddressLibDecoder --diff <old.bin> <new.bin>"s);
+			}
+			diff(args[1], args[2]);
+		} else {
+			for (const auto arg : args) {
+				dump(arg);
+			}
 		}
 	} catch (const std::exception& e) {
 		std::cerr << e.what() << std::endl;
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "REL/AddressLibrary.h"
+
+class Version
+{
+public:
+	using value_type = std::uint16_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+
+	constexpr Version() noexcept = default;
+
+	constexpr Version(std::array<value_type, 4> a_version) noexcept :
+		_impl(a_version)
+	{}
+
+	[[nodiscard]] constexpr reference operator[](std::size_t a_idx) noexcept { return _impl[a_idx]; }
+	[[nodiscard]] constexpr const_reference operator[](std::size_t a_idx) const noexcept { return _impl[a_idx]; }
+
+	[[nodiscard]] int constexpr compare(const Version& a_rhs) const noexcept
+	{
+		for (std::size_t i = 0; i < _impl.size(); ++i) {
+			if ((*this)[i] != a_rhs[i]) {
+				return (*this)[i] < a_rhs[i] ? -1 : 1;
+			}
+		}
+		return 0;
+	}
+
+	[[nodiscard]] std::string string() const
+	{
+		std::string result;
+		for (std::size_t i = 0; i < _impl.size(); ++i) {
+			result += std::to_string(_impl[i]);
+			result += '-';
+		}
+		result.pop_back();
+		return result;
+	}
+
+	[[nodiscard]] std::wstring wstring() const
+	{
+		std::wstring result;
+		for (std::size_t i = 0; i < _impl.size(); ++i) {
+			result += std::to_wstring(_impl[i]);
+			result += L'-';
+		}
+		result.pop_back();
+		return result;
+	}
+
+private:
+	std::array<value_type, 4> _impl{ 0, 0, 0, 0 };
+};
+
+[[nodiscard]] constexpr bool operator==(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) == 0; }
+[[nodiscard]] constexpr bool operator!=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) != 0; }
+[[nodiscard]] constexpr bool operator<(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) < 0; }
+[[nodiscard]] constexpr bool operator<=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) <= 0; }
+[[nodiscard]] constexpr bool operator>(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) > 0; }
+[[nodiscard]] constexpr bool operator>=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) >= 0; }
+
+// equivalent addresses across versions form one set, which shares an id
+class DisjointSet
+{
+public:
+	explicit DisjointSet(std::size_t a_size) :
+		_parent(a_size),
+		_rank(a_size, 0)
+	{
+		std::iota(_parent.begin(), _parent.end(), std::uint32_t{ 0 });
+	}
+
+	[[nodiscard]] std::uint32_t find(std::uint32_t a_node) noexcept
+	{
+		auto root = a_node;
+		while (_parent[root] != root) {
+			root = _parent[root];
+		}
+
+		while (_parent[a_node] != root) {
+			a_node = std::exchange(_parent[a_node], root);
+		}
+
+		return root;
+	}
+
+	[[nodiscard]] std::size_t size() const noexcept { return _parent.size(); }
+
+	void merge(std::uint32_t a_lhs, std::uint32_t a_rhs) noexcept
+	{
+		a_lhs = find(a_lhs);
+		a_rhs = find(a_rhs);
+		if (a_lhs == a_rhs) {
+			return;
+		}
+
+		if (_rank[a_lhs] < _rank[a_rhs]) {
+			std::swap(a_lhs, a_rhs);
+		}
+		_parent[a_rhs] = a_lhs;
+		if (_rank[a_lhs] == _rank[a_rhs]) {
+			++_rank[a_lhs];
+		}
+	}
+
+private:
+	std::vector<std::uint32_t> _parent;
+	std::vector<std::uint8_t> _rank;
+};
+
+struct Mapping
+{
+	std::uint64_t offset;
+	std::uint64_t id;
+};
+
+using offset_map = std::vector<Mapping>;  // sorted by offset
+using version_map = std::map<Version, offset_map>;
+
+struct Link
+{
+	Version lversion;
+	Version rversion;
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> offsets;
+};
+
+using links_t = std::vector<Link>;
+
+[[nodiscard]] inline std::pair<version_map, DisjointSet> link_mappings(const links_t& a_links)
+{
+	version_map map;
+	for (const auto& [lver, rver, offsets] : a_links) {
+		auto& lmap = map[lver];
+		auto& rmap = map[rver];
+		for (const auto& [loffset, roffset] : offsets) {
+			lmap.push_back({ loffset, 0 });
+			rmap.push_back({ roffset, 0 });
+		}
+	}
+
+	std::map<Version, std::uint32_t> bases;
+	std::size_t count = 0;
+	for (auto& [ver, offsetMap] : map) {
+		std::sort(std::execution::par_unseq, offsetMap.begin(), offsetMap.end(), [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.offset < a_rhs.offset;
+		});
+		offsetMap.erase(
+			std::unique(offsetMap.begin(), offsetMap.end(), [](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.offset == a_rhs.offset;
+			}),
+			offsetMap.end());
+		offsetMap.shrink_to_fit();
+
+		bases.emplace(ver, static_cast<std::uint32_t>(count));
+		count += offsetMap.size();
+	}
+	if (count > std::numeric_limits<std::uint32_t>::max()) {
+		throw std::runtime_error("too many addresses");
+	}
+
+	DisjointSet sets(count);
+	for (const auto& [lver, rver, offsets] : a_links) {
+		const auto& lmap = map.find(lver)->second;
+		const auto& rmap = map.find(rver)->second;
+		const auto lbase = bases.find(lver)->second;
+		const auto rbase = bases.find(rver)->second;
+		const auto node = [](const offset_map& a_map, std::uint32_t a_base, std::uint64_t a_offset) {
+			const auto it = std::lower_bound(
+				a_map.begin(),
+				a_map.end(),
+				a_offset,
+				[](const Mapping& a_lhs, std::uint64_t a_rhs) {
+					return a_lhs.offset < a_rhs;
+				});
+			return a_base + static_cast<std::uint32_t>(it - a_map.begin());
+		};
+
+		for (const auto& [loffset, roffset] : offsets) {
+			sets.merge(node(lmap, lbase, loffset), node(rmap, rbase, roffset));
+		}
+	}
+
+	return { std::move(map), std::move(sets) };
+}
+
+// the libraries of an earlier run, by version
+using seed_map = std::map<Version, std::vector<REL::AddressLibrary::mapping_t>>;
+
+struct Assignment
+{
+	std::size_t seeded{ 0 };     // sets that kept an id from the seed
+	std::size_t fresh{ 0 };      // sets that were handed a new one
+	std::size_t conflicts{ 0 };  // seeded addresses whose id went to another set
+};
+
+// an id, once published, is baked into every plugin built against it, so any set holding an address the
+// seed already numbered keeps that number. the rest are handed out past the seed's highest id, in version
+// order, then offset order, so the first version an address appears in decides its id
+inline Assignment assign_ids(version_map& a_map, DisjointSet& a_sets, const seed_map& a_seeds = {})
+{
+	constexpr auto UNASSIGNED = std::numeric_limits<std::uint64_t>::max();
+	std::vector<std::uint64_t> ids(a_sets.size(), UNASSIGNED);
+	std::vector<bool> claimed;
+	Assignment result;
+
+	// ids the seed retired are not handed out again either
+	std::uint64_t next = 0;
+	for (const auto& [ver, library] : a_seeds) {
+		for (const auto& elem : library) {
+			next = std::max(next, elem.id + 1);
+		}
+	}
+
+	std::uint32_t idx = 0;
+	std::vector<REL::AddressLibrary::mapping_t> seed;
+	for (const auto& [ver, offsetMap] : a_map) {
+		const auto it = a_seeds.find(ver);
+		if (it == a_seeds.end()) {
+			idx += static_cast<std::uint32_t>(offsetMap.size());
+			continue;
+		}
+
+		// both sides sorted by offset, so one merge pass pairs them up
+		seed = it->second;
+		std::sort(seed.begin(), seed.end(), [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.offset < a_rhs.offset;
+		});
+
+		auto elem = seed.begin();
+		for (const auto& mapping : offsetMap) {
+			const auto node = idx++;
+			while (elem != seed.end() && elem->offset < mapping.offset) {
+				++elem;
+			}
+			if (elem == seed.end() || elem->offset != mapping.offset) {
+				continue;
+			}
+
+			auto& root = ids[a_sets.find(node)];
+			if (root == elem->id) {
+				continue;
+			}
+
+			if (claimed.size() <= elem->id) {
+				claimed.resize(static_cast<std::size_t>(elem->id) + 1, false);
+			}
+			if (root == UNASSIGNED && !claimed[static_cast<std::size_t>(elem->id)]) {
+				root = elem->id;
+				claimed[static_cast<std::size_t>(elem->id)] = true;
+				++result.seeded;
+			} else {
+				++result.conflicts;
+			}
+		}
+	}
+
+	auto id = next;
+	idx = 0;
+	for (auto& [ver, offsetMap] : a_map) {
+		for (auto& mapping : offsetMap) {
+			auto& root = ids[a_sets.find(idx++)];
+			if (root == UNASSIGNED) {
+				root = id++;
+				++result.fresh;
+			}
+			mapping.id = root;
+		}
+	}
+
+	return result;
+}
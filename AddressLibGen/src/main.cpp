@@ -2,115 +2,34 @@
 #pragma warning(disable: 4702)  // unreachable code
 #include <algorithm>
 #include <array>
-#include <cassert>
+#include <charconv>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <execution>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
-#include <optional>
-#include <set>
-#include <sstream>
+#include <numeric>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
-#include <robin_hood.h>
+#include <mmio/mmio.hpp>
 #include <srell.hpp>
 #pragma warning(pop)
 
-using namespace std::literals;
-
-class Version
-{
-public:
-	using value_type = std::uint16_t;
-	using reference = value_type&;
-	using const_reference = const value_type&;
-
-	constexpr Version() noexcept = default;
-
-	constexpr Version(std::array<value_type, 4> a_version) noexcept :
-		_impl(a_version)
-	{}
-
-	[[nodiscard]] constexpr reference operator[](std::size_t a_idx) noexcept { return _impl[a_idx]; }
-	[[nodiscard]] constexpr const_reference operator[](std::size_t a_idx) const noexcept { return _impl[a_idx]; }
-
-	[[nodiscard]] int constexpr compare(const Version& a_rhs) const noexcept
-	{
-		for (std::size_t i = 0; i < _impl.size(); ++i) {
-			if ((*this)[i] != a_rhs[i]) {
-				return (*this)[i] < a_rhs[i] ? -1 : 1;
-			}
-		}
-		return 0;
-	}
-
-	[[nodiscard]] std::string string() const
-	{
-		std::string result;
-		for (std::size_t i = 0; i < _impl.size(); ++i) {
-			result += std::to_string(_impl[i]);
-			result += '-';
-		}
-		result.pop_back();
-		return result;
-	}
-
-	[[nodiscard]] std::wstring wstring() const
-	{
-		std::wstring result;
-		for (std::size_t i = 0; i < _impl.size(); ++i) {
-			result += std::to_wstring(_impl[i]);
-			result += L'-';
-		}
-		result.pop_back();
-		return result;
-	}
-
-private:
-	std::array<value_type, 4> _impl{ 0, 0, 0, 0 };
-};
+#include "Mappings.h"
 
-[[nodiscard]] constexpr bool operator==(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) == 0; }
-[[nodiscard]] constexpr bool operator!=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) != 0; }
-[[nodiscard]] constexpr bool operator<(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) < 0; }
-[[nodiscard]] constexpr bool operator<=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) <= 0; }
-[[nodiscard]] constexpr bool operator>(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) > 0; }
-[[nodiscard]] constexpr bool operator>=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) >= 0; }
-
-class Mapping
-{
-public:
-	[[nodiscard]] constexpr bool assigned() const noexcept { return static_cast<bool>(_id); }
-
-	void assign(std::uint64_t a_id) noexcept
-	{
-		_id = a_id;
-		for (auto& link : _links) {
-			if (!link->assigned()) {
-				link->assign(a_id);
-			}
-		}
-	}
-
-	[[nodiscard]] constexpr std::uint64_t id() const noexcept
-	{
-		assert(assigned());
-		return *_id;
-	}
-
-	void link(Mapping* a_mapping) { _links.insert(a_mapping); }
-
-private:
-	std::set<Mapping*> _links;
-	std::optional<std::uint64_t> _id;
-};
+using namespace std::literals;
 
 using files_t = std::vector<std::tuple<Version, Version, std::filesystem::path>>;
 
@@ -145,81 +64,143 @@ using files_t = std::vector<std::tuple<Version, Version, std::filesystem::path>>
 	return results;
 }
 
-using offset_map = robin_hood::unordered_node_map<std::uint64_t, Mapping>;
-//using offset_map = std::unordered_map<std::uint64_t, Mapping>;
-using version_map = std::map<Version, offset_map>;
+[[nodiscard]] std::uint64_t parse_address(std::string_view a_address)
+{
+	while (!a_address.empty() && (a_address.front() == ' ' || a_address.front() == '\r')) {
+		a_address.remove_prefix(1);
+	}
+	if (a_address.starts_with("0x"sv) || a_address.starts_with("0X"sv)) {
+		a_address.remove_prefix(2);
+	}
 
-[[nodiscard]] version_map load_mappings(const files_t& a_files)
+	std::uint64_t address = 0;
+	const auto [ptr, ec] = std::from_chars(a_address.data(), a_address.data() + a_address.size(), address, 16);
+	if (ec != std::errc()) {
+		throw std::runtime_error("malformed address: "s + std::string(a_address));
+	}
+
+	return address - 0x140000000;
+}
+
+void parse_mapping(const std::filesystem::path& a_path, Link& a_link)
 {
-	version_map map;
-	std::ifstream file;
-	std::stringstream ss;
-	std::string line;
-	std::string lbuf;
-	std::string rbuf;
-
-	const auto find_or_emplace_version = [&map](const Version& a_version) -> offset_map& {
-		auto it = map.find(a_version);
-		if (it == map.end()) {
-			it = map.emplace(a_version, offset_map()).first;
-		}
-		return it->second;
-	};
+	mmio::mapped_file_source file;
+	if (!file.open(a_path)) {
+		throw std::runtime_error("failed to open file for read"s);
+	}
 
-	const auto find_or_emplace_address = [](offset_map& a_map, std::string a_address) -> Mapping& {
-		auto address = static_cast<std::uint64_t>(std::stoull(a_address, 0, 16));
-		address -= 0x140000000;
-		auto it = a_map.find(address);
-		if (it == a_map.end()) {
-			it = a_map.emplace(address, Mapping()).first;
-		}
-		return it->second;
+	std::string_view text{ reinterpret_cast<const char*>(file.data()), file.size() };
+	const auto next_line = [&]() {
+		// string_view::find lowers to memchr, which is vectorized
+		const auto pos = text.find('\n');
+		const auto line = text.substr(0, pos);
+		text.remove_prefix(pos == std::string_view::npos ? text.size() : pos + 1);
+		return line;
 	};
 
-	for (const auto& [lver, rver, path] : a_files) {
-		file.open(path);
-		if (!file.is_open()) {
-			throw std::runtime_error("failed to open file for read"s);
+	for (std::size_t i = 0; i < 18; ++i) {
+		(void)next_line();  // skip header
+	}
+
+	// the columns are roughly a fixed width, so the size is a good guess for the line count
+	a_link.offsets.reserve(text.size() / 20);
+	while (!text.empty()) {
+		auto line = next_line();
+		const auto tab = line.find('\t');
+		if (tab == std::string_view::npos) {
+			continue;
 		}
-		for (std::size_t i = 0; i < 18; ++i) {
-			std::getline(file, line);  // skip header
+
+		const auto lbuf = line.substr(0, tab);
+		const auto rbuf = line.substr(tab + 1, line.find('\t', tab + 1) - (tab + 1));
+		if (!lbuf.empty() && !rbuf.empty() && rbuf != "\r"sv) {
+			a_link.offsets.emplace_back(parse_address(lbuf), parse_address(rbuf));
 		}
+	}
+}
 
-		auto& laddr = find_or_emplace_version(lver);
-		auto& raddr = find_or_emplace_version(rver);
-
-		while (std::getline(file, line)) {
-			ss.str(line);
-			ss.clear();
-			std::getline(ss, lbuf, '\t');
-			std::getline(ss, rbuf, '\t');
-			if (ss && !lbuf.empty() && !rbuf.empty()) {
-				auto& lmap = find_or_emplace_address(laddr, lbuf);
-				auto& rmap = find_or_emplace_address(raddr, rbuf);
-				lmap.link(std::addressof(rmap));
-				rmap.link(std::addressof(lmap));
+// every file is independent, so they're parsed in parallel
+[[nodiscard]] links_t load_mappings(const files_t& a_files)
+{
+	links_t links(a_files.size());
+	std::vector<std::string> errors(a_files.size());
+	std::vector<std::size_t> indices(a_files.size());
+	std::iota(indices.begin(), indices.end(), std::size_t{ 0 });
+	std::for_each(
+		std::execution::par,
+		indices.begin(),
+		indices.end(),
+		[&](std::size_t a_idx) {
+			const auto& [lver, rver, path] = a_files[a_idx];
+			auto& link = links[a_idx];
+			link.lversion = lver;
+			link.rversion = rver;
+			try {
+				parse_mapping(path, link);
+			} catch (const std::exception& e) {
+				errors[a_idx] = path.string() + ": "s + e.what();
 			}
-		}
+		});
 
-		file.close();
+	for (const auto& error : errors) {
+		if (!error.empty()) {
+			throw std::runtime_error(error);
+		}
 	}
 
-	return map;
+	return links;
 }
 
-void assign_ids(version_map& a_versionMap)
+// see README.md for the layout
+namespace compact
 {
-	std::uint64_t id = 0;
-	for (auto& [ver, offsetMap] : a_versionMap) {
-		for (auto& [offset, mapping] : offsetMap) {
-			if (!mapping.assigned()) {
-				mapping.assign(id++);
+	inline constexpr std::uint32_t BLOCK_SIZE = 256;
+
+	void write_varint(std::vector<std::uint8_t>& a_dst, std::uint64_t a_value)
+	{
+		while (a_value >= 0x80) {
+			a_dst.push_back(static_cast<std::uint8_t>(a_value | 0x80));
+			a_value >>= 7;
+		}
+		a_dst.push_back(static_cast<std::uint8_t>(a_value));
+	}
+
+	template <class Write>
+	void write(const std::vector<Mapping>& a_mappings, Write&& a_write)
+	{
+		const auto blockCount = static_cast<std::uint32_t>((a_mappings.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+		std::vector<std::uint64_t> index;
+		std::vector<std::uint8_t> payload;
+		index.reserve(static_cast<std::size_t>(blockCount) * 3);
+
+		for (std::size_t i = 0; i < a_mappings.size(); ++i) {
+			const auto& [offset, id] = a_mappings[i];
+			if (i % BLOCK_SIZE == 0) {
+				index.push_back(id);
+				index.push_back(offset);
+				index.push_back(payload.size());
+			} else {
+				const auto& [prevOffset, prevID] = a_mappings[i - 1];
+				const auto delta = static_cast<std::int64_t>(offset - prevOffset);
+				write_varint(payload, id - prevID);
+				write_varint(payload, (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63));  // zigzag
 			}
 		}
+
+		a_write(REL::AddressLibrary::Compact::MAGIC);
+		a_write(static_cast<std::uint64_t>(a_mappings.size()));
+		a_write(BLOCK_SIZE);
+		a_write(blockCount);
+		for (const auto elem : index) {
+			a_write(elem);
+		}
+		for (const auto elem : payload) {
+			a_write(elem);
+		}
 	}
 }
 
-void write_binaries(version_map& a_versionMap)
+void write_binaries(const version_map& a_versionMap, bool a_compact)
 {
 	std::ofstream file;
 	const auto binary_write = [&file](auto&& a_data) {
@@ -229,7 +210,8 @@ void write_binaries(version_map& a_versionMap)
 	};
 
 	std::string filename;
-	std::vector<std::pair<std::uint64_t, Mapping>> mappings;
+	std::vector<Mapping> mappings;
+	std::vector<REL::AddressLibrary::mapping_t> library;
 	for (const auto& [ver, offsetMap] : a_versionMap) {
 		filename = "version-"sv;
 		filename += ver.string();
@@ -239,21 +221,44 @@ void write_binaries(version_map& a_versionMap)
 			throw std::runtime_error("failed to open file for write"s);
 		}
 
-		mappings.clear();
-		mappings.reserve(offsetMap.size());
-		for (const auto& [first, second] : offsetMap) {
-			mappings.emplace_back(first, second);
-		}
+		mappings = offsetMap;
 		std::sort(
 			mappings.begin(),
 			mappings.end(),
 			[](auto&& a_lhs, auto&& a_rhs) {
-				return a_lhs.second.id() < a_rhs.second.id();
+				return a_lhs.id < a_rhs.id;
 			});
 
-		binary_write(static_cast<std::uint64_t>(mappings.size()));
-		for (const auto& [offset, mapped] : mappings) {
-			binary_write(mapped.id());
+		library.clear();
+		for (const auto& [offset, id] : mappings) {
+			library.push_back({ id, offset });
+		}
+
+		if (a_compact) {
+			compact::write(mappings, binary_write);
+		} else {
+			binary_write(static_cast<std::uint64_t>(library.size()));
+			for (const auto& elem : library) {
+				binary_write(elem);
+			}
+		}
+
+		file.close();
+
+		// offset sorted, so REL::IDDatabase::Offset2ID can map it instead of sorting at runtime
+		filename = "version-"sv;
+		filename += ver.string();
+		filename += ".offsets.bin"sv;
+		file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			throw std::runtime_error("failed to open file for write"s);
+		}
+
+		binary_write(REL::AddressLibrary::OffsetIndex::MAGIC);
+		binary_write(static_cast<std::uint64_t>(offsetMap.size()));
+		binary_write(REL::AddressLibrary::OffsetIndex::checksum(library));
+		for (const auto& [offset, id] : offsetMap) {
+			binary_write(id);
 			binary_write(offset);
 		}
 
@@ -261,12 +266,86 @@ void write_binaries(version_map& a_versionMap)
 	}
 }
 
-int main()
+// the libraries a_root holds for the versions being generated, in either format
+[[nodiscard]] seed_map load_seeds(const std::filesystem::path& a_root, const version_map& a_versionMap)
+{
+	seed_map seeds;
+	mmio::mapped_file_source file;
+	std::vector<REL::AddressLibrary::mapping_t> storage;
+	std::span<const REL::AddressLibrary::mapping_t> library;
+	for (const auto& [ver, offsetMap] : a_versionMap) {
+		const auto path = a_root / ("version-"s + ver.string() + ".bin"s);
+		if (!std::filesystem::exists(path)) {
+			continue;
+		}
+
+		if (!file.open(path)) {
+			throw std::runtime_error("failed to open file for read: "s + path.string());
+		} else if (!REL::AddressLibrary::parse({ file.data(), file.size() }, storage, library)) {
+			throw std::runtime_error("malformed address library: "s + path.string());
+		}
+		seeds.emplace(ver, std::vector(library.begin(), library.end()));
+		file.close();
+	}
+	return seeds;
+}
+
+class PhaseTimer
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	void lap(std::string_view a_phase)
+	{
+		const auto now = clock::now();
+		_laps.emplace_back(a_phase, now - _last);
+		_last = now;
+	}
+
+	void report() const
+	{
+		clock::duration total{};
+		for (const auto& [phase, elapsed] : _laps) {
+			std::cout << phase << ": "sv << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << " ms\n"sv;
+			total += elapsed;
+		}
+		std::cout << "total: "sv << std::chrono::duration_cast<std::chrono::milliseconds>(total).count() << " ms"sv << std::endl;
+	}
+
+private:
+	std::vector<std::pair<std::string_view, clock::duration>> _laps;
+	clock::time_point _last{ clock::now() };
+};
+
+int main(int a_argc, char* a_argv[])
 {
 	try {
-		auto mappings = load_mappings(get_files("mappings"sv));
-		assign_ids(mappings);
-		write_binaries(mappings);
+		bool compact = false;
+		std::filesystem::path seed;
+		for (int i = 1; i < a_argc; ++i) {
+			if (a_argv[static_cast<std::size_t>(i)] == "--compact"sv) {
+				compact = true;
+			} else if (a_argv[static_cast<std::size_t>(i)] == "--seed"sv && i + 1 < a_argc) {
+				seed = a_argv[static_cast<std::size_t>(++i)];
+			} else {
+				throw std::runtime_error("unknown argument: "s + a_argv[static_cast<std::size_t>(i)]);
+			}
+		}
+
+		PhaseTimer timer;
+		const auto links = load_mappings(get_files("mappings"sv));
+		timer.lap("parse"sv);
+		auto [mappings, sets] = link_mappings(links);
+		timer.lap("link"sv);
+		const auto seeds = seed.empty() ? seed_map() : load_seeds(seed, mappings);
+		const auto assignment = assign_ids(mappings, sets, seeds);
+		timer.lap("assign"sv);
+		if (!seed.empty()) {
+			std::cout << assignment.seeded << " ids kept, "sv << assignment.fresh << " new, "sv << assignment.conflicts << " conflicts\n"sv;
+		}
+		write_binaries(mappings, compact);
+		timer.lap("write"sv);
+		timer.report();
 	} catch (const std::exception& e) {
 		std::cerr << e.what() << std::endl;
 		return EXIT_FAILURE;
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// see README.md for the layout, which RE::AllocationProfiler writes
+namespace profile
+{
+	inline constexpr std::uint64_t MAGIC = 0x32434F4C4C413446;  // "F4ALLOC2"
+
+	struct FileHeader
+	{
+		std::uint64_t magic;
+		std::uint64_t ticksPerSecond;
+		std::uint64_t imageBase;
+		std::uint64_t textBegin;
+		std::uint64_t textEnd;
+		std::uint32_t sampleRate;
+		std::uint32_t moduleCount;
+	};
+	static_assert(sizeof(FileHeader) == 0x30);
+
+	struct ModuleHeader
+	{
+		std::uint64_t base;
+		std::uint64_t size;
+		std::uint32_t nameLength;
+		std::uint32_t pad14;
+	};
+	static_assert(sizeof(ModuleHeader) == 0x18);
+
+	struct BatchHeader
+	{
+		std::uint32_t threadID;
+		std::uint32_t count;
+		std::uint32_t dropped;
+		std::uint32_t pad0C;
+	};
+	static_assert(sizeof(BatchHeader) == 0x10);
+
+	struct Sample
+	{
+		std::uint64_t timestamp;
+		std::uint64_t returnAddress;
+		std::uint32_t size;
+		std::uint16_t alignment;
+		std::uint8_t kind;
+		std::uint8_t pad17;
+	};
+	static_assert(sizeof(Sample) == 0x18);
+
+	inline constexpr std::array<std::string_view, 7> KINDS{
+		"malloc",
+		"calloc",
+		"realloc",
+		"aligned_alloc",
+		"aligned_realloc",
+		"free",
+		"aligned_free",
+	};
+
+	[[nodiscard]] constexpr bool is_free(std::size_t a_kind) noexcept { return a_kind >= 5; }
+}
+
+struct Module
+{
+	std::uint64_t base{ 0 };
+	std::uint64_t size{ 0 };
+	std::string name;
+};
+
+struct Site
+{
+	std::uint64_t address{ 0 };
+	std::array<std::uint64_t, profile::KINDS.size()> samples{};
+	std::uint64_t bytes{ 0 };
+	std::uint32_t minSize{ std::numeric_limits<std::uint32_t>::max() };
+	std::uint32_t maxSize{ 0 };
+	std::uint16_t maxAlignment{ 0 };
+
+	[[nodiscard]] std::uint64_t total() const noexcept
+	{
+		std::uint64_t result = 0;
+		for (const auto count : samples) {
+			result += count;
+		}
+		return result;
+	}
+};
+
+struct Profile
+{
+	profile::FileHeader header;
+	std::vector<Module> modules;  // sorted by base
+	std::vector<Site> sites;
+	std::uint64_t samples{ 0 };
+	std::uint64_t dropped{ 0 };
+	std::uint64_t firstTick{ std::numeric_limits<std::uint64_t>::max() };
+	std::uint64_t lastTick{ 0 };
+	std::size_t threads{ 0 };
+
+	[[nodiscard]] const Module* module_at(std::uint64_t a_address) const noexcept
+	{
+		const auto it = std::ranges::upper_bound(modules, a_address, {}, &Module::base);
+		if (it == modules.begin()) {
+			return nullptr;
+		}
+		const auto& module = *std::prev(it);
+		return a_address - module.base < module.size ? std::addressof(module) : nullptr;
+	}
+};
+
+// the module table and batches are read straight out of a_data, and samples are folded into one entry per
+// call site in the order they're first seen
+[[nodiscard]] inline Profile aggregate(std::span<const std::byte> a_data)
+{
+	Profile result;
+	if (a_data.size() < sizeof(result.header)) {
+		throw std::runtime_error("truncated header");
+	}
+	std::memcpy(std::addressof(result.header), a_data.data(), sizeof(result.header));
+	if (result.header.magic != profile::MAGIC) {
+		throw std::runtime_error("not an allocation profile");
+	}
+
+	auto pos = sizeof(result.header);
+	result.modules.reserve(std::min<std::size_t>(result.header.moduleCount, a_data.size() / sizeof(profile::ModuleHeader)));
+	for (std::uint32_t i = 0; i < result.header.moduleCount; ++i) {
+		profile::ModuleHeader module;
+		if (a_data.size() - pos < sizeof(module)) {
+			throw std::runtime_error("truncated module table");
+		}
+		std::memcpy(std::addressof(module), a_data.data() + pos, sizeof(module));
+		pos += sizeof(module);
+
+		if (a_data.size() - pos < module.nameLength) {
+			throw std::runtime_error("truncated module table");
+		}
+		const auto name = reinterpret_cast<const char*>(a_data.data() + pos);
+		result.modules.push_back({ module.base, module.size, std::string(name, module.nameLength) });
+		pos += module.nameLength;
+	}
+	std::ranges::sort(result.modules, {}, &Module::base);
+
+	std::unordered_map<std::uint64_t, std::size_t> indices;
+	std::unordered_map<std::uint32_t, std::size_t> threads;
+	while (pos < a_data.size()) {
+		profile::BatchHeader batch;
+		if (a_data.size() - pos < sizeof(batch)) {
+			throw std::runtime_error("truncated batch");
+		}
+		std::memcpy(std::addressof(batch), a_data.data() + pos, sizeof(batch));
+		pos += sizeof(batch);
+
+		if ((a_data.size() - pos) / sizeof(profile::Sample) < batch.count) {
+			throw std::runtime_error("truncated batch");
+		}
+
+		result.dropped += batch.dropped;
+		++threads[batch.threadID];
+		for (std::uint32_t i = 0; i < batch.count; ++i) {
+			profile::Sample sample;
+			std::memcpy(std::addressof(sample), a_data.data() + pos, sizeof(sample));
+			pos += sizeof(sample);
+
+			if (sample.kind >= profile::KINDS.size()) {
+				throw std::runtime_error("unknown allocation kind");
+			}
+
+			const auto [it, inserted] = indices.try_emplace(sample.returnAddress, result.sites.size());
+			if (inserted) {
+				result.sites.emplace_back().address = sample.returnAddress;
+			}
+
+			auto& site = result.sites[it->second];
+			++site.samples[sample.kind];
+			if (!profile::is_free(sample.kind)) {
+				site.bytes += sample.size;
+				site.minSize = std::min(site.minSize, sample.size);
+				site.maxSize = std::max(site.maxSize, sample.size);
+				site.maxAlignment = std::max(site.maxAlignment, sample.alignment);
+			}
+
+			result.firstTick = std::min(result.firstTick, sample.timestamp);
+			result.lastTick = std::max(result.lastTick, sample.timestamp);
+			++result.samples;
+		}
+	}
+
+	result.threads = threads.size();
+	return result;
+}
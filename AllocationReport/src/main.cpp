@@ -0,0 +1,195 @@
+#pragma warning(push)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <mmio/mmio.hpp>
+#pragma warning(pop)
+
+#include "Profile.h"
+#include "REL/AddressLibrary.h"
+
+using namespace std::literals;
+
+using Pair = REL::AddressLibrary::mapping_t;
+
+// the library's entries sorted by offset, so a call site resolves to the id at or before it. like
+// REL::IDDatabase::Offset2ID, this maps the index AddressLibGen writes next to the library when it was
+// written for that library, and sorts a copy otherwise
+class Symbols
+{
+public:
+	explicit Symbols(const std::filesystem::path& a_path)
+	{
+		mmio::mapped_file_source library;
+		if (!library.open(a_path.string())) {
+			throw std::runtime_error("failed to open: "s + a_path.string());
+		}
+
+		std::vector<Pair> decoded;
+		std::span<const Pair> id2offset;
+		if (!REL::AddressLibrary::parse({ library.data(), library.size() }, decoded, id2offset)) {
+			throw std::runtime_error("malformed address library: "s + a_path.string());
+		}
+
+		// an index written for some other library is ignored rather than trusted
+		const auto index = std::filesystem::path(a_path).replace_extension(".offsets.bin"sv);
+		if (_index.open(index.string())) {
+			if (REL::AddressLibrary::OffsetIndex::parse({ _index.data(), _index.size() }, id2offset, _byOffset)) {
+				return;
+			}
+			_index.close();
+		}
+
+		_sorted.assign(id2offset.begin(), id2offset.end());
+		std::ranges::sort(_sorted, {}, &Pair::offset);
+		_byOffset = _sorted;
+	}
+
+	[[nodiscard]] const Pair* nearest(std::uint64_t a_offset) const noexcept
+	{
+		const auto it = std::ranges::upper_bound(_byOffset, a_offset, {}, &Pair::offset);
+		return it != _byOffset.begin() ? std::addressof(*std::prev(it)) : nullptr;
+	}
+
+private:
+	mmio::mapped_file_source _index;
+	std::vector<Pair> _sorted;
+	std::span<const Pair> _byOffset;
+};
+
+[[nodiscard]] Profile aggregate(const std::filesystem::path& a_path)
+{
+	mmio::mapped_file_source file;
+	if (!file.open(a_path.string())) {
+		throw std::runtime_error("failed to open: "s + a_path.string());
+	}
+
+	try {
+		return aggregate(std::span{ file.data(), file.size() });
+	} catch (const std::exception& e) {
+		throw std::runtime_error(a_path.string() + ": "s + e.what());
+	}
+}
+
+[[nodiscard]] std::string describe(const Profile& a_profile, const std::optional<Symbols>& a_symbols, std::uint64_t a_address)
+{
+	const auto& header = a_profile.header;
+	if (a_address >= header.textBegin && a_address < header.textEnd) {
+		const auto offset = a_address - header.imageBase;
+		if (a_symbols) {
+			if (const auto pair = a_symbols->nearest(offset); pair) {
+				return fmt::format(FMT_STRING("ID {}+0x{:X}"), pair->id, offset - pair->offset);
+			}
+		}
+		return fmt::format(FMT_STRING("Fallout4+0x{:X}"), offset);
+	}
+
+	// an rva is stable across runs, and is what the module's pdb is keyed by
+	if (const auto module = a_profile.module_at(a_address); module) {
+		return fmt::format(FMT_STRING("{}+0x{:X}"), module->name, a_address - module->base);
+	}
+	return fmt::format(FMT_STRING("external 0x{:X}"), a_address);
+}
+
+void report(const Profile& a_profile, const std::optional<Symbols>& a_symbols, std::size_t a_top)
+{
+	const auto& header = a_profile.header;
+	const auto rate = std::uint64_t{ header.sampleRate };
+	const auto seconds =
+		header.ticksPerSecond != 0 && a_profile.lastTick > a_profile.firstTick ?
+			static_cast<double>(a_profile.lastTick - a_profile.firstTick) / static_cast<double>(header.ticksPerSecond) :
+			0.0;
+
+	fmt::print(
+		FMT_STRING("{} samples over {:.2f}s from {} threads, 1 in {} calls, {} dropped\n"),
+		a_profile.samples,
+		seconds,
+		a_profile.threads,
+		rate,
+		a_profile.dropped);
+
+	std::vector<const Site*> sites;
+	sites.reserve(a_profile.sites.size());
+	for (const auto& site : a_profile.sites) {
+		sites.push_back(std::addressof(site));
+	}
+
+	const auto top = std::min(a_top, sites.size());
+	std::ranges::partial_sort(sites, sites.begin() + static_cast<std::ptrdiff_t>(top), [](const Site* a_lhs, const Site* a_rhs) {
+		return a_lhs->total() != a_rhs->total() ?
+		           a_lhs->total() > a_rhs->total() :
+		           a_lhs->address < a_rhs->address;
+	});
+
+	for (const auto site : std::span{ sites.data(), top }) {
+		fmt::print(
+			FMT_STRING("\n{}\n\t~{} calls, ~{} bytes"),
+			describe(a_profile, a_symbols, site->address),
+			site->total() * rate,
+			site->bytes * rate);
+		if (site->maxSize != 0) {
+			fmt::print(FMT_STRING(", sizes {}..{}"), site->minSize, site->maxSize);
+		}
+		if (site->maxAlignment != 0) {
+			fmt::print(FMT_STRING(", aligned to {}"), site->maxAlignment);
+		}
+		fmt::print(FMT_STRING("\n"));
+
+		for (std::size_t i = 0; i < site->samples.size(); ++i) {
+			if (site->samples[i] != 0) {
+				fmt::print(FMT_STRING("\t\t{}: ~{}\n"), profile::KINDS[i], site->samples[i] * rate);
+			}
+		}
+	}
+}
+
+int main(int a_argc, char* a_argv[])
+{
+	try {
+		constexpr auto usage = "usage: AllocationReport <profile.bin> [version-*.bin] [--top N]"sv;
+
+		const std::span args(a_argv + 1, static_cast<std::size_t>(a_argc - 1));
+		std::vector<std::string_view> paths;
+		std::size_t top = 25;
+		for (std::size_t i = 0; i < args.size(); ++i) {
+			if (args[i] == "--top"sv) {
+				if (++i == args.size()) {
+					throw std::runtime_error(std::string(usage));
+				}
+				top = std::stoull(args[i]);
+			} else {
+				paths.emplace_back(args[i]);
+			}
+		}
+
+		if (paths.empty() || paths.size() > 2) {
+			throw std::runtime_error(std::string(usage));
+		}
+
+		const auto profile = aggregate(paths[0]);
+		std::optional<Symbols> symbols;
+		if (paths.size() > 1) {
+			symbols.emplace(paths[1]);
+		}
+		report(profile, symbols, top);
+	} catch (const std::exception& e) {
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
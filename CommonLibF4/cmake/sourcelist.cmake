@@ -10,6 +10,7 @@ set(SOURCES
 	include/RE/Bethesda/AITimeStamp.h
 	include/RE/Bethesda/Actor.h
 	include/RE/Bethesda/ActorValueInfo.h
+	include/RE/Bethesda/AllocationProfiler.h
 	include/RE/Bethesda/Archive2.h
 	include/RE/Bethesda/Atomic.h
 	include/RE/Bethesda/BGSBaseAliases.h
@@ -56,6 +57,7 @@ set(SOURCES
 	include/RE/Bethesda/BSTArray.h
 	include/RE/Bethesda/BSTBTree.h
 	include/RE/Bethesda/BSTEvent.h
+	include/RE/Bethesda/BSTFlatHashMap.h
 	include/RE/Bethesda/BSTFreeList.h
 	include/RE/Bethesda/BSTHashMap.h
 	include/RE/Bethesda/BSTInterpolator.h
@@ -81,6 +83,7 @@ set(SOURCES
 	include/RE/Bethesda/FormComponents.h
 	include/RE/Bethesda/FormFactory.h
 	include/RE/Bethesda/FormUtil.h
+	include/RE/Bethesda/FrameArena.h
 	include/RE/Bethesda/GameScript.h
 	include/RE/Bethesda/IMenu.h
 	include/RE/Bethesda/IMovementInterface.h
@@ -153,6 +156,57 @@ set(SOURCES
 	include/RE/Havok/hknpMaterialId.h
 	include/RE/Havok/hknpShape.h
 	include/RE/Havok/hknpUniqueBodyIdHitCollector.h
+	include/RE/IDs/RTTI/A.h
+	include/RE/IDs/RTTI/B.h
+	include/RE/IDs/RTTI/C.h
+	include/RE/IDs/RTTI/D.h
+	include/RE/IDs/RTTI/E.h
+	include/RE/IDs/RTTI/F.h
+	include/RE/IDs/RTTI/G.h
+	include/RE/IDs/RTTI/H.h
+	include/RE/IDs/RTTI/I.h
+	include/RE/IDs/RTTI/J.h
+	include/RE/IDs/RTTI/K.h
+	include/RE/IDs/RTTI/L.h
+	include/RE/IDs/RTTI/M.h
+	include/RE/IDs/RTTI/N.h
+	include/RE/IDs/RTTI/O.h
+	include/RE/IDs/RTTI/P.h
+	include/RE/IDs/RTTI/Q.h
+	include/RE/IDs/RTTI/R.h
+	include/RE/IDs/RTTI/S.h
+	include/RE/IDs/RTTI/T.h
+	include/RE/IDs/RTTI/U.h
+	include/RE/IDs/RTTI/V.h
+	include/RE/IDs/RTTI/W.h
+	include/RE/IDs/RTTI/Z.h
+	include/RE/IDs/RTTI/_.h
+	include/RE/IDs/TypeTable.h
+	include/RE/IDs/VTABLE/A.h
+	include/RE/IDs/VTABLE/B.h
+	include/RE/IDs/VTABLE/C.h
+	include/RE/IDs/VTABLE/D.h
+	include/RE/IDs/VTABLE/E.h
+	include/RE/IDs/VTABLE/F.h
+	include/RE/IDs/VTABLE/G.h
+	include/RE/IDs/VTABLE/H.h
+	include/RE/IDs/VTABLE/I.h
+	include/RE/IDs/VTABLE/J.h
+	include/RE/IDs/VTABLE/K.h
+	include/RE/IDs/VTABLE/L.h
+	include/RE/IDs/VTABLE/M.h
+	include/RE/IDs/VTABLE/N.h
+	include/RE/IDs/VTABLE/O.h
+	include/RE/IDs/VTABLE/P.h
+	include/RE/IDs/VTABLE/Q.h
+	include/RE/IDs/VTABLE/R.h
+	include/RE/IDs/VTABLE/S.h
+	include/RE/IDs/VTABLE/T.h
+	include/RE/IDs/VTABLE/U.h
+	include/RE/IDs/VTABLE/V.h
+	include/RE/IDs/VTABLE/W.h
+	include/RE/IDs/VTABLE/Z.h
+	include/RE/IDs/VTABLE/_.h
 	include/RE/NetImmerse/NiAVObject.h
 	include/RE/NetImmerse/NiAlphaProperty.h
 	include/RE/NetImmerse/NiBinaryStream.h
@@ -224,10 +278,13 @@ set(SOURCES
 	include/RE/Scaleform/Render/Render_TreeNode.h
 	include/RE/Scaleform/Render/Render_Types2D.h
 	include/RE/Scaleform/Render/Render_Viewport.h
+	include/RE/TypeIDs.h
 	include/RE/VTABLE_IDs.h
 	include/RE/msvc/functional.h
 	include/RE/msvc/memory.h
 	include/RE/msvc/typeinfo.h
+	include/REL/AddressLibrary.h
+	include/REL/Pattern.h
 	include/REL/Relocation.h
 	src/F4SE/API.cpp
 	src/F4SE/Impl/PCH.cpp
@@ -236,6 +293,7 @@ set(SOURCES
 	src/F4SE/Logger.cpp
 	src/F4SE/Trampoline.cpp
 	src/RE/Bethesda/Actor.cpp
+	src/RE/Bethesda/AllocationProfiler.cpp
 	src/RE/Bethesda/BGSInventoryItem.cpp
 	src/RE/Bethesda/BSExtraData.cpp
 	src/RE/Bethesda/BSScaleformManager.cpp
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
+#include <bitset>
 #include <cassert>
 #include <cmath>
 #include <compare>
@@ -21,6 +23,7 @@
 #include <map>
 #include <memory>
 #include <new>
+#include <numeric>
 #include <optional>
 #include <source_location>
 #include <span>
@@ -34,6 +37,8 @@
 #include <variant>
 #include <vector>
 
+#include <xmmintrin.h>
+
 static_assert(
 	std::is_integral_v<std::time_t> && sizeof(std::time_t) == sizeof(std::size_t),
 	"wrap std::time_t instead");
@@ -682,10 +687,9 @@ namespace REL
 }
 
 #include "REL/Relocation.h"
+#include "REL/Pattern.h"
 
 #include "RE/NiRTTI_IDs.h"
-#include "RE/RTTI_IDs.h"
-#include "RE/VTABLE_IDs.h"
 
 #include "RE/msvc/functional.h"
 #include "RE/msvc/memory.h"
@@ -18,6 +18,22 @@ namespace F4SE::WinAPI
 	};
 	static_assert(sizeof(CRITICAL_SECTION) == 0x28);
 
+	struct MODULEINFO
+	{
+	public:
+		// members
+		void* lpBaseOfDll;          // 00
+		std::uint32_t SizeOfImage;  // 08
+		void* EntryPoint;           // 10
+	};
+	static_assert(sizeof(MODULEINFO) == 0x18);
+
+	[[nodiscard]] bool(EnumProcessModules)(
+		void* a_process,
+		void** a_modules,
+		std::uint32_t a_size,
+		std::uint32_t* a_needed) noexcept;
+
 	[[nodiscard]] void*(GetCurrentModule)() noexcept;
 
 	[[nodiscard]] void*(GetCurrentProcess)() noexcept;
@@ -70,6 +86,12 @@ namespace F4SE::WinAPI
 
 	[[nodiscard]] void*(GetModuleHandle)(const wchar_t* a_moduleName) noexcept;
 
+	[[nodiscard]] bool(GetModuleInformation)(
+		void* a_process,
+		void* a_module,
+		MODULEINFO* a_info,
+		std::uint32_t a_size) noexcept;
+
 	[[nodiscard]] void*(GetProcAddress)(void* a_module,
 		const char* a_procName) noexcept;
 
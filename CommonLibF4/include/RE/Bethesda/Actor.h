@@ -12,6 +12,14 @@
 #include "RE/Bethesda/BSTTuple.h"
 #include "RE/Bethesda/IMovementInterface.h"
 #include "RE/Bethesda/TESObjectREFRs.h"
+#include "RE/IDs/RTTI/A.h"
+#include "RE/IDs/RTTI/E.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/M.h"
+#include "RE/IDs/VTABLE/A.h"
+#include "RE/IDs/VTABLE/E.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/M.h"
 #include "RE/NetImmerse/NiFlags.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
@@ -6,6 +6,8 @@
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/A.h"
+#include "RE/IDs/VTABLE/A.h"
 
 namespace RE
 {
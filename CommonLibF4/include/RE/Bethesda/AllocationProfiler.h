@@ -0,0 +1,183 @@
+#pragma once
+
+namespace RE
+{
+	// samples calls to RE::malloc and friends when F4SE_ALLOCATION_PROFILER is defined, which must then
+	// hold for every translation unit. each thread counts its own calls and pushes every Nth into a
+	// ring of its own, which a background thread drains to a file for AllocationReport to aggregate by
+	// call site. this is plugin-side machinery with no engine counterpart
+	class AllocationProfiler
+	{
+	public:
+		enum class Kind : std::uint8_t
+		{
+			kMalloc,
+			kCalloc,
+			kRealloc,
+			kAlignedAlloc,
+			kAlignedRealloc,
+			kFree,
+			kAlignedFree
+		};
+
+		// the file is a FileHeader, then a ModuleHeader and its name for every module loaded at Start, then a
+		// BatchHeader and its samples for every drained ring. the allocator wrappers are compiled into each
+		// plugin, so most call sites lie in a plugin, and are reported against the module that holds them
+		static constexpr std::uint64_t MAGIC = 0x32434F4C4C413446;  // F4ALLOC2
+
+		struct FileHeader
+		{
+		public:
+			// members
+			std::uint64_t magic{ MAGIC };    // 00
+			std::uint64_t ticksPerSecond;    // 08
+			std::uint64_t imageBase;         // 10
+			std::uint64_t textBegin;         // 18
+			std::uint64_t textEnd;           // 20
+			std::uint32_t sampleRate;        // 28
+			std::uint32_t moduleCount{ 0 };  // 2C
+		};
+		static_assert(sizeof(FileHeader) == 0x30);
+
+		struct ModuleHeader
+		{
+		public:
+			// members
+			std::uint64_t base;        // 00
+			std::uint64_t size;        // 08
+			std::uint32_t nameLength;  // 10 - utf-8 bytes of the file name that follows, without a terminator
+			std::uint32_t pad14;       // 14
+		};
+		static_assert(sizeof(ModuleHeader) == 0x18);
+
+		struct BatchHeader
+		{
+		public:
+			// members
+			std::uint32_t threadID;  // 00
+			std::uint32_t count;     // 04
+			std::uint32_t dropped;   // 08 - samples lost to a full ring since the last batch
+			std::uint32_t pad0C;     // 0C
+		};
+		static_assert(sizeof(BatchHeader) == 0x10);
+
+		struct Sample
+		{
+		public:
+			// members
+			std::uint64_t timestamp;      // 00 - steady_clock ticks
+			std::uint64_t returnAddress;  // 08
+			std::uint32_t size;           // 10 - saturates, zero for frees
+			std::uint16_t alignment;      // 14
+			Kind kind;                    // 16
+			std::uint8_t pad17;           // 17
+		};
+		static_assert(sizeof(Sample) == 0x18);
+
+		// starts streaming samples of every a_sampleRate-th call on each thread to a_path
+		static bool Start(const std::filesystem::path& a_path, std::uint32_t a_sampleRate = 64);
+
+		// drains what is left and closes the file
+		static void Stop();
+
+		[[nodiscard]] static bool IsRunning() noexcept { return _running.load(std::memory_order_relaxed); }
+
+		static void Record(Kind a_kind, std::size_t a_size, std::size_t a_alignment, const void* a_returnAddress) noexcept
+		{
+			if (IsRunning() && --_countdown == 0) {
+				_countdown = _sampleRate.load(std::memory_order_relaxed);
+				Push(a_kind, a_size, a_alignment, a_returnAddress);
+			}
+		}
+
+	private:
+		static void Push(Kind a_kind, std::size_t a_size, std::size_t a_alignment, const void* a_returnAddress) noexcept;
+
+		static inline std::atomic_bool _running{ false };
+		static inline std::atomic_uint32_t _sampleRate{ 64 };
+		static inline thread_local std::uint32_t _countdown{ 1 };
+	};
+
+	namespace detail
+	{
+		// written only by its thread and read only by the flusher, so the two indices are all the
+		// synchronization it needs
+		class SampleRing
+		{
+		public:
+			using Sample = AllocationProfiler::Sample;
+
+			static constexpr std::uint32_t CAPACITY = 1u << 12;
+
+			explicit SampleRing(std::uint32_t a_threadID) noexcept :
+				threadID(a_threadID)
+			{}
+
+			void push(const Sample& a_sample) noexcept
+			{
+				const auto head = _head.load(std::memory_order_relaxed);
+				if (head - _tail.load(std::memory_order_acquire) == CAPACITY) {
+					_dropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				_samples[head % CAPACITY] = a_sample;
+				_head.store(head + 1, std::memory_order_release);
+			}
+
+			// hands everything pushed so far to a_sink, as at most two spans
+			template <class F>
+			void drain(F&& a_sink)
+			{
+				const auto tail = _tail.load(std::memory_order_relaxed);
+				const auto head = _head.load(std::memory_order_acquire);
+				const auto dropped = _dropped.exchange(0, std::memory_order_relaxed);
+				if (head == tail && dropped == 0) {
+					return;
+				}
+
+				const auto first = tail % CAPACITY;
+				const auto count = head - tail;
+				const auto split = std::min(count, CAPACITY - first);
+				a_sink(
+					std::span{ _samples.data() + first, split },
+					std::span{ _samples.data(), count - split },
+					dropped);
+				_tail.store(head, std::memory_order_release);
+			}
+
+			// members
+			const std::uint32_t threadID;
+			std::atomic_bool retired{ false };
+
+		private:
+			std::atomic_uint32_t _head{ 0 };
+			std::atomic_uint32_t _tail{ 0 };
+			std::atomic_uint32_t _dropped{ 0 };
+			std::array<Sample, CAPACITY> _samples;
+		};
+
+		// writes a batch for every ring with something to report, and forgets the rings whose threads are gone
+		inline void drain_rings(std::vector<std::unique_ptr<SampleRing>>& a_rings, std::ostream& a_out)
+		{
+			for (auto it = a_rings.begin(); it != a_rings.end();) {
+				auto& ring = **it;
+				const auto retired = ring.retired.load(std::memory_order_acquire);
+				ring.drain([&](auto a_first, auto a_second, std::uint32_t a_dropped) {
+					const AllocationProfiler::BatchHeader header{
+						ring.threadID,
+						static_cast<std::uint32_t>(a_first.size() + a_second.size()),
+						a_dropped,
+						0
+					};
+					a_out.write(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+					a_out.write(reinterpret_cast<const char*>(a_first.data()), a_first.size_bytes());
+					a_out.write(reinterpret_cast<const char*>(a_second.data()), a_second.size_bytes());
+				});
+
+				// nothing can be pushed once the thread has gone
+				it = retired ? a_rings.erase(it) : it + 1;
+			}
+		}
+	}
+}
@@ -8,6 +8,8 @@
 #include "RE/Bethesda/BSTSmallIndexScatterTable.h"
 #include "RE/Bethesda/BSTSmartPointer.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 
 namespace RE::BSResource::Archive2
 {
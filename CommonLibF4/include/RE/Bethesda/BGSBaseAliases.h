@@ -1,6 +1,10 @@
 #pragma once
 
 #include "RE/Bethesda/BSFixedString.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/E.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/E.h"
 
 namespace RE
 {
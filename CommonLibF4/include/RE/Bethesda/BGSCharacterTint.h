@@ -3,6 +3,8 @@
 #include "RE/Bethesda/BSFixedString.h"
 #include "RE/Bethesda/BSTArray.h"
 #include "RE/Bethesda/TESCondition.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 
 namespace RE
 {
@@ -3,6 +3,8 @@
 #include "RE/Bethesda/BSFixedString.h"
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 
 namespace RE
 {
@@ -5,6 +5,8 @@
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESCondition.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 
 namespace RE
 {
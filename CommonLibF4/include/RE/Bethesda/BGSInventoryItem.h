@@ -2,6 +2,8 @@
 
 #include "RE/Bethesda/BSExtraData.h"
 #include "RE/Bethesda/BSTSmartPointer.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 
 namespace RE
 {
@@ -10,6 +10,10 @@
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESCondition.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 
 namespace RE
@@ -8,6 +8,8 @@
 #include "RE/Bethesda/MemoryManager.h"
 #include "RE/Bethesda/TESBoundObjects.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/NetImmerse/NiAlphaProperty.h"
 #include "RE/NetImmerse/NiColor.h"
 #include "RE/NetImmerse/NiPoint2.h"
@@ -7,6 +7,10 @@
 #include "RE/Bethesda/BSTSmartPointer.h"
 #include "RE/Bethesda/BSTTuple.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/E.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/E.h"
 
 namespace RE
 {
@@ -220,6 +220,8 @@ namespace RE
 		};
 	}
 
+	// hashes the interned pool entry, which a string view doesn't have until it's interned, so this
+	// can't be transparent. look these up by a BSFixedString instead
 	template <class CharT, bool CS>
 	struct BSCRC32<detail::BSFixedString<CharT, CS>>
 	{
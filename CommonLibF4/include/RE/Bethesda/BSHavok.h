@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/NetImmerse/NiObject.h"
 
 namespace RE
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
+
 namespace RE
 {
 	class InputEvent;
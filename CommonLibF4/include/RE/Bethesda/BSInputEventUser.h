@@ -2,6 +2,10 @@
 
 #include "RE/Bethesda/InputEvent.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/D.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/D.h"
 
 namespace RE
 {
@@ -3,6 +3,8 @@
 #include "RE/Bethesda/Atomic.h"
 #include "RE/Bethesda/BSTArray.h"
 #include "RE/Bethesda/BSTSmallIndexScatterTable.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 
 namespace RE
 {
@@ -6,6 +6,8 @@
 #include "RE/Bethesda/BSTArray.h"
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/BSTSmartPointer.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/NetImmerse/NiBinaryStream.h"
 
 namespace RE
@@ -3,6 +3,8 @@
 #include "RE/Bethesda/BSStringT.h"
 #include "RE/Bethesda/BSTEvent.h"
 #include "RE/Bethesda/BSTSingleton.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/Scaleform/GFx/GFx_Player.h"
 #include "RE/Scaleform/Kernel/SF_RefCount.h"
 
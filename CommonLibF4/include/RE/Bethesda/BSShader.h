@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/BSGraphics.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/NetImmerse/NiRefObject.h"
 
 namespace RE
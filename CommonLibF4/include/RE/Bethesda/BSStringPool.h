@@ -18,7 +18,7 @@ namespace RE
 			static void release(Entry*& a_entry)
 			{
 				using func_t = decltype(&Entry::release);
-				REL::Relocation<func_t> func{ REL::ID(1204430) };
+				static REL::Relocation<func_t> func{ REL::ID(1204430) };
 				return func(a_entry);
 			}
 
@@ -121,7 +121,7 @@ namespace RE
 		static BucketTable& GetSingleton()
 		{
 			using func_t = decltype(&BucketTable::GetSingleton);
-			REL::Relocation<func_t> func{ REL::ID(1390486) };
+			static REL::Relocation<func_t> func{ REL::ID(1390486) };
 			return func();
 		}
 
@@ -139,7 +139,7 @@ namespace RE
 	inline void GetEntry<char>(BSStringPool::Entry*& a_result, const char* a_string, bool a_caseSensitive)
 	{
 		using func_t = decltype(&GetEntry<char>);
-		REL::Relocation<func_t> func{ REL::ID(507142) };
+		static REL::Relocation<func_t> func{ REL::ID(507142) };
 		return func(a_result, a_string, a_caseSensitive);
 	}
 
@@ -147,7 +147,7 @@ namespace RE
 	inline void GetEntry<wchar_t>(BSStringPool::Entry*& a_result, const wchar_t* a_string, bool a_caseSensitive)
 	{
 		using func_t = decltype(&GetEntry<wchar_t>);
-		REL::Relocation<func_t> func{ REL::ID(345043) };
+		static REL::Relocation<func_t> func{ REL::ID(345043) };
 		return func(a_result, a_string, a_caseSensitive);
 	}
 }
@@ -1,11 +1,33 @@
 #pragma once
 
-#include "RE/Bethesda/MemoryManager.h"
+#ifndef F4SE_TEST_SUITE
+#	include "RE/Bethesda/MemoryManager.h"
+#endif
 
 namespace RE
 {
 	class ScrapHeap;
 
+	namespace detail
+	{
+		// elements of these types can be moved to a new block by copying their bytes, with no constructor
+		// or destructor run on either end. specialize it for handles that are safe to move the same way
+		template <class T>
+		struct is_trivially_relocatable :
+			std::is_trivially_copyable<T>
+		{};
+
+		template <class T>
+		inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+		// array allocators that can resize a block through the heap, which may extend it where it lies
+		template <class Allocator>
+		concept reallocatable_array_allocator =
+			requires(Allocator& a_allocator, void* a_ptr, std::uint32_t a_bytes) {
+				{ a_allocator.reallocate(a_ptr, a_bytes) } -> std::same_as<void*>;
+			};
+	}
+
 	class BSTArrayHeapAllocator
 	{
 	public:
@@ -35,6 +57,7 @@ namespace RE
 		}
 
 		[[nodiscard]] void* allocate(uint32_t a_bytes) { return malloc(a_bytes); }
+		[[nodiscard]] void* reallocate(void* a_ptr, uint32_t a_bytes) { return realloc(a_ptr, a_bytes); }
 		void deallocate(void* a_ptr) { free(a_ptr); }
 
 		[[nodiscard]] void* data() noexcept { return _data; }
@@ -83,6 +106,7 @@ namespace RE
 			}
 
 			[[nodiscard]] void* allocate(uint32_t a_bytes) { return aligned_alloc(N, a_bytes); }
+			[[nodiscard]] void* reallocate(void* a_ptr, uint32_t a_bytes) { return aligned_realloc(a_ptr, N, a_bytes); }
 			void deallocate(void* a_ptr) { aligned_free(a_ptr); }
 
 			[[nodiscard]] void* data() noexcept { return _data; }
@@ -378,17 +402,64 @@ namespace RE
 		iterator insert(const_iterator a_pos, ForwardIt a_first, ForwardIt a_last)  //
 			requires(std::derived_from<typename std::iterator_traits<ForwardIt>::iterator_category, std::forward_iterator_tag>)
 		{
-			const auto distance = static_cast<size_type>(std::distance(a_first, a_last));
-			if (distance == 0) {
-				return decay_iterator(a_pos);
-			}
+			return insert_range(a_pos, std::ranges::subrange(a_first, a_last));
+		}
 
+		// a_range must not overlap the array
+		template <std::ranges::input_range R>
+		iterator insert_range(const_iterator a_pos, R&& a_range)  //
+			requires(std::constructible_from<value_type, std::ranges::range_reference_t<R>>)
+		{
 			const auto pos = static_cast<size_type>(std::distance(cbegin(), a_pos));
-			resize(size() + distance);
-			const auto iter = begin() + pos;
-			std::move_backward(iter, iter + distance, end());
-			std::copy(a_first, a_last, iter);
-			return iter;
+			if constexpr (detail::is_trivially_relocatable_v<value_type> &&
+						  std::ranges::sized_range<R> &&
+						  std::is_nothrow_constructible_v<value_type, std::ranges::range_reference_t<R>>) {
+				// shift the tail once and build the range in the gap it leaves
+				const auto count = static_cast<size_type>(std::ranges::size(a_range));
+				if (count > 0) {
+					reserve_auto(size() + count);
+					auto iter = data() + pos;
+					std::memmove(static_cast<void*>(iter + count), iter, (size() - pos) * sizeof(value_type));
+					for (auto&& elem : a_range) {
+						std::construct_at(iter++, std::forward<decltype(elem)>(elem));
+					}
+					_size += count;
+				}
+			} else {
+				const auto osize = size();
+				append_range(std::forward<R>(a_range));
+				std::rotate(begin() + pos, begin() + osize, end());
+			}
+			return begin() + pos;
+		}
+
+		// a_range must not overlap the array. the storage grows at most once when the range's length is
+		// known up front, and each element is constructed in place at the back
+		template <std::ranges::input_range R>
+		void append_range(R&& a_range)  //
+			requires(std::constructible_from<value_type, std::ranges::range_reference_t<R>>)
+		{
+			if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>) {
+				const auto count = static_cast<size_type>(std::ranges::distance(a_range));
+				reserve_auto(size() + count);
+				if constexpr (std::is_trivially_copyable_v<value_type> &&
+							  std::ranges::contiguous_range<R> &&
+							  std::same_as<std::ranges::range_value_t<R>, value_type>) {
+					if (count > 0) {
+						std::memcpy(data() + _size, std::ranges::data(a_range), count * sizeof(value_type));
+						_size += count;
+					}
+				} else {
+					for (auto&& elem : a_range) {
+						std::construct_at(data() + _size, std::forward<decltype(elem)>(elem));
+						_size += 1;
+					}
+				}
+			} else {
+				for (auto&& elem : a_range) {
+					emplace_back(std::forward<decltype(elem)>(elem));
+				}
+			}
 		}
 
 		template <class... Args>
@@ -396,15 +467,23 @@ namespace RE
 			requires(std::constructible_from<value_type, Args&&...>)
 		{
 			const auto pos = static_cast<size_type>(std::distance(cbegin(), a_pos));
-			if (pos < size()) {
-				emplace_back(std::move(back()));
-				std::move_backward(begin() + pos, end() - 2, end() - 1);
+			if (pos < size() || size() == capacity()) {
+				// the arguments may refer into the array, so they're read before anything moves
+				value_type value(std::forward<Args>(a_args)...);
+				if (pos < size()) {
+					emplace_back(std::move(back()));
+					std::move_backward(begin() + pos, end() - 2, end() - 1);
+					data()[pos] = std::move(value);
+				} else {
+					reserve_auto(size() + 1);
+					std::construct_at(data() + pos, std::move(value));
+					_size += 1;
+				}
 			} else {
-				reserve_auto(size() + 1);
+				std::construct_at(data() + pos, std::forward<Args>(a_args)...);
 				_size += 1;
 			}
 
-			std::construct_at(data() + pos, std::forward<Args>(a_args)...);
 			return begin() + pos;
 		}
 
@@ -433,8 +512,28 @@ namespace RE
 
 		void pop_back() { erase(std::prev(end())); }
 
-		void resize(size_type a_count) { resize_impl(a_count, nullptr); }
-		void resize(size_type a_count, const value_type& a_value) { resize_impl(a_count, std::addressof(a_value)); }
+		void resize(size_type a_count)
+		{
+			resize_impl(a_count, [](pointer a_first, pointer a_last) {
+				std::uninitialized_value_construct(a_first, a_last);
+			});
+		}
+
+		void resize(size_type a_count, const value_type& a_value)
+		{
+			resize_impl(a_count, [&](pointer a_first, pointer a_last) {
+				std::uninitialized_fill(a_first, a_last, a_value);
+			});
+		}
+
+		// new elements are default-initialized, so trivial types are left as they are for the caller to
+		// write over
+		void resize_for_overwrite(size_type a_count)
+		{
+			resize_impl(a_count, [](pointer a_first, pointer a_last) {
+				std::uninitialized_default_construct(a_first, a_last);
+			});
+		}
 
 		void swap(BSTArray& a_rhs)
 		{
@@ -464,38 +563,46 @@ namespace RE
 				return;
 			}
 
-			const auto ndata =
-				static_cast<pointer>(
-					_allocator.allocate(a_capacity * sizeof(value_type)));
+			const auto bytes = a_capacity * static_cast<size_type>(sizeof(value_type));
 			const auto odata = data();
+			if constexpr (detail::is_trivially_relocatable_v<value_type> &&
+						  detail::reallocatable_array_allocator<allocator_type>) {
+				// the heap can often extend the block where it lies, and copies it itself when it can't
+				if (odata && a_capacity > 0) {
+					const auto ndata = _allocator.reallocate(odata, bytes);
+					if (!ndata) {
+						stl::report_and_fail("failed to handle allocation request"sv);
+					}
+					_allocator.set_data(ndata);
+					_allocator.set_capacity(a_capacity, bytes);
+					return;
+				}
+			}
+
+			const auto ndata = static_cast<pointer>(_allocator.allocate(bytes));
 			if (ndata != odata) {
-				std::uninitialized_move_n(odata, size(), ndata);
-				std::destroy_n(odata, size());
+				if constexpr (detail::is_trivially_relocatable_v<value_type>) {
+					if (size() > 0) {
+						std::memcpy(static_cast<void*>(ndata), odata, size() * sizeof(value_type));
+					}
+				} else {
+					std::uninitialized_move_n(odata, size(), ndata);
+					std::destroy_n(odata, size());
+				}
 				_allocator.deallocate(odata);
 				_allocator.set_data(ndata);
-				_allocator.set_capacity(a_capacity, a_capacity * sizeof(value_type));
 			}
+			_allocator.set_capacity(a_capacity, bytes);
 		}
 
-		void resize_impl(size_type a_count, const value_type* a_value)
+		template <class F>
+		void resize_impl(size_type a_count, F a_construct)
 		{
 			if (a_count < size()) {
 				erase(begin() + a_count, end());
 			} else if (a_count > size()) {
 				reserve_auto(a_count);
-				std::span<value_type> range{ data() + _size, a_count - _size };
-				if (a_value) {
-					std::for_each(
-						range.begin(),
-						range.end(),
-						[=](auto& a_elem) {
-							std::construct_at(std::addressof(a_elem), *a_value);
-						});
-				} else {
-					std::uninitialized_default_construct(
-						range.begin(),
-						range.end());
-				}
+				a_construct(data() + _size, data() + a_count);
 				_size = a_count;
 			}
 		}
@@ -1,9 +1,15 @@
 #pragma once
 
-#include "RE/Bethesda/BSTTuple.h"
+#ifndef F4SE_TEST_SUITE
+#	include "RE/Bethesda/BSTTuple.h"
+#endif
 
 namespace RE
 {
+	// lookup and iteration are safe on any tree, including the engine's. insert, erase, clear, assign_sorted,
+	// copying and destruction are only for trees the plugin owns: they pool freed nodes through nodes[0] and
+	// count them in _allocatedSize, which is this library's bookkeeping, and the engine's own use of those
+	// members is unverified
 	template <
 		class Key,
 		class T,
@@ -37,13 +43,31 @@ namespace RE
 			[[nodiscard]] const_iterator end() const noexcept { return entries + usedEntries; }
 			[[nodiscard]] const_iterator cend() const noexcept { return entries + usedEntries; }
 
+			// entries are constructed only as they're used, so they sit in a union
+			node_type() noexcept {}
+			node_type(const node_type&) = delete;
+			~node_type() noexcept {}
+			node_type& operator=(const node_type&) = delete;
+
 			// members
-			value_type entries[4];           // 00
+			union
+			{
+				value_type entries[4];
+			};                               // 00
 			node_type* nodes[5]{ nullptr };  // ??
 			size_type usedEntries{ 0 };      // ??
 		};
 
 	private:
+		static constexpr size_type NODE_SIZE = static_cast<size_type>(std::extent_v<decltype(node_type::entries)>);
+		static constexpr size_type MIN_ENTRIES = NODE_SIZE / 2;
+
+		// every node below the root holds at least 2 entries, so even 2^32 entries sit within 21 levels
+		static constexpr std::size_t MAX_DEPTH = 21;
+
+		// walks entries in key order. the path from the root down to the current entry is kept inline,
+		// so iterators never allocate: each frame records a node, and the index of the entry it visits
+		// next, which for every frame but the top is also the child that was descended into
 		template <class U>
 		class iterator_base :
 			public boost::stl_interfaces::iterator_interface<
@@ -68,124 +92,230 @@ namespace RE
 			iterator_base() noexcept = default;
 
 			template <class V>
-			iterator_base(const iterator_base<V>& a_rhs)  //
-				requires(std::convertible_to<typename iterator_base<V>::reference, reference>) :
-				_queued(a_rhs._queued),
-				_cur(a_rhs._cur),
-				_pos(a_rhs._pos)
-			{}
-
-			template <class V>
-			iterator_base(iterator_base<V>&& a_rhs) noexcept  //
+			iterator_base(const iterator_base<V>& a_rhs) noexcept  //
 				requires(std::convertible_to<typename iterator_base<V>::reference, reference>) :
-				_queued(std::move(a_rhs._queued)),
-				_cur(std::exchange(a_rhs._cur, nullptr)),
-				_pos(std::exchange(a_rhs._pos, 0))
+				_path(a_rhs._path),
+				_index(a_rhs._index),
+				_depth(a_rhs._depth)
 			{}
 
 			~iterator_base() noexcept = default;
 
 			template <class V>
-			iterator_base& operator=(const iterator_base<V>& a_rhs)  //
-				requires(std::convertible_to<typename iterator_base<V>::reference, reference>)
-			{
-				if (this != std::addressof(a_rhs)) {
-					_queued = a_rhs._queued;
-					_cur = a_rhs._cur;
-					_pos = a_rhs._pos;
-				}
-				return *this;
-			}
-
-			template <class V>
-			iterator_base& operator=(iterator_base<V>&& a_rhs) noexcept  //
+			iterator_base& operator=(const iterator_base<V>& a_rhs) noexcept  //
 				requires(std::convertible_to<typename iterator_base<V>::reference, reference>)
 			{
-				if (this != std::addressof(a_rhs)) {
-					_queued = std::move(a_rhs._queued);
-					_cur = std::exchange(a_rhs._cur, nullptr);
-					_pos = std::exchange(a_rhs._pos, 0);
-				}
+				_path = a_rhs._path;
+				_index = a_rhs._index;
+				_depth = a_rhs._depth;
 				return *this;
 			}
 
 			[[nodiscard]] reference operator*() const noexcept
 			{
-				assert(_cur != nullptr);
-				assert(_pos < _cur->usedEntries);
-				return _cur->entries[_pos];
+				assert(_depth > 0);
+				assert(_index[_depth - 1] < _path[_depth - 1]->usedEntries);
+				return _path[_depth - 1]->entries[_index[_depth - 1]];
 			}
 
 			template <class V>
 			[[nodiscard]] bool operator==(const iterator_base<V>& a_rhs) const noexcept
 			{
-				return _cur == nullptr && a_rhs._cur == nullptr;
+				if (_depth != a_rhs._depth) {
+					return false;
+				} else if (_depth == 0) {
+					return true;
+				} else {
+					return _path[_depth - 1] == a_rhs._path[_depth - 1] &&
+					       _index[_depth - 1] == a_rhs._index[_depth - 1];
+				}
 			}
 
 			using super::operator++;
 
-			void operator++() noexcept
+			iterator_base& operator++() noexcept
 			{
-				assert(_cur != nullptr);
-				if (++_pos >= _cur->usedEntries) {
-					_cur = nullptr;
-					_pos = 0;
-					if (!_queued.empty()) {
-						_cur = _queued.top();
-						_queued.pop();
-						push_level();
-					}
-				}
+				assert(_depth > 0);
+				const auto node = _path[_depth - 1];
+				const auto next = ++_index[_depth - 1];
+				seek_first(occupied(node->nodes[next]));
+				settle();
+				return *this;
 			}
 
 		protected:
 			template <class, class, class>
 			friend class BSTBTree;
 
-			explicit iterator_base(node_type* a_node) noexcept :
-				iterator_base(a_node, 0)
-			{}
+			void push(node_type* a_node, size_type a_index) noexcept
+			{
+				assert(_depth < MAX_DEPTH);
+				_path[_depth] = a_node;
+				_index[_depth] = static_cast<std::uint8_t>(a_index);
+				++_depth;
+			}
 
-			iterator_base(node_type* a_node, size_type a_pos) noexcept :
-				_pos(a_pos)
+			// descends to the least entry under a_node
+			void seek_first(node_type* a_node) noexcept
 			{
-				if (a_node && a_node->usedEntries > 0) {
-					_cur = a_node;
-					push_level();
+				for (; a_node; a_node = occupied(a_node->nodes[0])) {
+					push(a_node, 0);
 				}
 			}
 
-		private:
-			template <class>
-			friend class iterator_base;
-
-			void push_level()
+			// climbs out of frames that have no entries left to visit
+			void settle() noexcept
 			{
-				for (size_type i = 0; i <= _cur->usedEntries; ++i) {
-					if (const auto node = _cur->nodes[i];
-						node && node->usedEntries > 0) {
-						_queued.push(node);
-					}
+				while (_depth > 0 && _index[_depth - 1] >= _path[_depth - 1]->usedEntries) {
+					--_depth;
 				}
 			}
 
-			std::stack<node_type*> _queued;
-			node_type* _cur{ nullptr };
-			size_type _pos{ 0 };
+		private:
+			template <class>
+			friend class iterator_base;
+
+			std::array<node_type*, MAX_DEPTH> _path{};
+			std::array<std::uint8_t, MAX_DEPTH> _index{};
+			std::uint8_t _depth{ 0 };
 		};
 
 	public:
 		using iterator = iterator_base<value_type>;
 		using const_iterator = iterator_base<const value_type>;
 
-		[[nodiscard]] iterator begin() noexcept { return iterator{ _root }; }
-		[[nodiscard]] const_iterator begin() const noexcept { return const_iterator{ _root }; }
-		[[nodiscard]] const_iterator cbegin() const noexcept { return const_iterator{ _root }; }
+		BSTBTree() noexcept = default;
+
+		BSTBTree(const BSTBTree& a_rhs) { _root = clone(occupied(a_rhs._root)); }
+
+		BSTBTree(BSTBTree&& a_rhs) noexcept :
+			_allocatedSize(std::exchange(a_rhs._allocatedSize, 0)),
+			_root(std::exchange(a_rhs._root, nullptr)),
+			_availNodes(std::exchange(a_rhs._availNodes, nullptr))
+		{}
+
+		~BSTBTree()
+		{
+			clear();
+			shrink_to_fit();
+		}
+
+		BSTBTree& operator=(const BSTBTree& a_rhs)
+		{
+			if (this != std::addressof(a_rhs)) {
+				BSTBTree tmp(a_rhs);
+				swap(tmp);
+			}
+			return *this;
+		}
+
+		BSTBTree& operator=(BSTBTree&& a_rhs) noexcept
+		{
+			if (this != std::addressof(a_rhs)) {
+				BSTBTree tmp(std::move(a_rhs));
+				swap(tmp);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] iterator begin() noexcept { return do_begin<iterator>(); }
+		[[nodiscard]] const_iterator begin() const noexcept { return do_begin<const_iterator>(); }
+		[[nodiscard]] const_iterator cbegin() const noexcept { return do_begin<const_iterator>(); }
 
 		[[nodiscard]] iterator end() noexcept { return {}; }
 		[[nodiscard]] const_iterator end() const noexcept { return {}; }
 		[[nodiscard]] const_iterator cend() const noexcept { return {}; }
 
+		[[nodiscard]] bool empty() const noexcept { return occupied(_root) == nullptr; }
+
+		// every entry is destroyed, and their nodes are kept in the pool for reuse
+		void clear() noexcept
+		{
+			if (_root) {
+				recycle_tree(_root);
+				_root = nullptr;
+			}
+		}
+
+		// returns the pooled nodes to the heap
+		void shrink_to_fit() noexcept
+		{
+			while (_availNodes) {
+				const auto node = std::exchange(_availNodes, _availNodes->nodes[0]);
+				std::destroy_at(node);
+				free(node);
+				--_allocatedSize;
+			}
+		}
+
+		std::pair<iterator, bool> insert(const value_type& a_value) { return do_insert(a_value); }
+		std::pair<iterator, bool> insert(value_type&& a_value) { return do_insert(std::move(a_value)); }
+
+		template <class... Args>
+		std::pair<iterator, bool> emplace(Args&&... a_args)  //
+			requires(std::constructible_from<value_type, Args&&...>)
+		{
+			return do_insert(value_type(std::forward<Args>(a_args)...));
+		}
+
+		// replaces the contents with a_range, which must be sorted and free of duplicate keys. the nodes
+		// are laid out directly, with the entries spread evenly over the fewest levels that can hold them,
+		// which is much cheaper than inserting the entries one at a time
+		template <std::ranges::forward_range R>
+		void assign_sorted(R&& a_range)  //
+			requires(std::constructible_from<value_type, std::ranges::range_reference_t<R>>)
+		{
+			assert(std::ranges::adjacent_find(
+					   a_range,
+					   [&](const auto& a_lhs, const auto& a_rhs) {
+						   return !key_comp()(a_lhs.first, a_rhs.first);
+					   }) == std::ranges::end(a_range));
+
+			clear();
+			const auto count = static_cast<std::size_t>(std::ranges::distance(a_range));
+			if (count > 0) {
+				std::size_t height = 1;
+				while (full_size(height) < count) {
+					++height;
+				}
+				auto it = std::ranges::begin(a_range);
+				_root = build(it, count, height);
+			}
+		}
+
+		iterator erase(const_iterator a_pos)  //
+			requires(std::copy_constructible<key_type>)
+		{
+			assert(a_pos != end());
+			const key_type key = (*a_pos).first;
+			do_erase(a_pos);
+			return upper_bound(key);
+		}
+
+		iterator erase(iterator a_pos)  //
+			requires(std::copy_constructible<key_type>)
+		{
+			return erase(const_iterator(a_pos));
+		}
+
+		size_type erase(const key_type& a_key)
+		{
+			const_iterator path;
+			if (descend<false>(path, a_key)) {
+				do_erase(path);
+				return 1;
+			} else {
+				return 0;
+			}
+		}
+
+		void swap(BSTBTree& a_rhs) noexcept
+		{
+			std::swap(_allocatedSize, a_rhs._allocatedSize);
+			std::swap(_root, a_rhs._root);
+			std::swap(_availNodes, a_rhs._availNodes);
+		}
+
 		[[nodiscard]] iterator find(const key_type& a_key) { return do_find<iterator>(a_key); }
 		[[nodiscard]] const_iterator find(const key_type& a_key) const { return do_find<const_iterator>(a_key); }
 
@@ -203,40 +333,475 @@ namespace RE
 			return do_find<const_iterator>(a_key);
 		}
 
+		[[nodiscard]] iterator lower_bound(const key_type& a_key) { return do_bound<iterator, false>(a_key); }
+		[[nodiscard]] const_iterator lower_bound(const key_type& a_key) const { return do_bound<const_iterator, false>(a_key); }
+
+		template <class K>
+		[[nodiscard]] iterator lower_bound(const K& a_key)  //
+			requires(stl::transparent_comparator<BSTBTree, K>)
+		{
+			return do_bound<iterator, false>(a_key);
+		}
+
+		template <class K>
+		[[nodiscard]] const_iterator lower_bound(const K& a_key) const  //
+			requires(stl::transparent_comparator<BSTBTree, K>)
+		{
+			return do_bound<const_iterator, false>(a_key);
+		}
+
+		[[nodiscard]] iterator upper_bound(const key_type& a_key) { return do_bound<iterator, true>(a_key); }
+		[[nodiscard]] const_iterator upper_bound(const key_type& a_key) const { return do_bound<const_iterator, true>(a_key); }
+
+		template <class K>
+		[[nodiscard]] iterator upper_bound(const K& a_key)  //
+			requires(stl::transparent_comparator<BSTBTree, K>)
+		{
+			return do_bound<iterator, true>(a_key);
+		}
+
+		template <class K>
+		[[nodiscard]] const_iterator upper_bound(const K& a_key) const  //
+			requires(stl::transparent_comparator<BSTBTree, K>)
+		{
+			return do_bound<const_iterator, true>(a_key);
+		}
+
+		[[nodiscard]] std::pair<iterator, iterator> equal_range(const key_type& a_key) { return do_equal_range<iterator>(a_key); }
+		[[nodiscard]] std::pair<const_iterator, const_iterator> equal_range(const key_type& a_key) const { return do_equal_range<const_iterator>(a_key); }
+
+		template <class K>
+		[[nodiscard]] std::pair<iterator, iterator> equal_range(const K& a_key)  //
+			requires(stl::transparent_comparator<BSTBTree, K>)
+		{
+			return do_equal_range<iterator>(a_key);
+		}
+
+		template <class K>
+		[[nodiscard]] std::pair<const_iterator, const_iterator> equal_range(const K& a_key) const  //
+			requires(stl::transparent_comparator<BSTBTree, K>)
+		{
+			return do_equal_range<const_iterator>(a_key);
+		}
+
 		[[nodiscard]] key_compare key_comp() const { return key_compare{}; }
 
 	private:
-		template <class Iter, class K>
-		[[nodiscard]] Iter do_find(const K& a_key) const
+		// empty nodes are left linked in place, so they count as missing
+		[[nodiscard]] static node_type* occupied(node_type* a_node) noexcept
 		{
-			auto node = _root;
-			while (node) {
+			return a_node && a_node->usedEntries > 0 ? a_node : nullptr;
+		}
+
+		// counts the entries of a_node ordered before a_key, or with Upper, those not ordered after it.
+		// scalar keys are cheap to compare, so every slot is tested and the unused ones are masked off,
+		// which trades the branchy binary search for a fixed run of compares
+		template <bool Upper, class K>
+		[[nodiscard]] static size_type search(const node_type& a_node, const K& a_key)
+		{
+			const auto comp = key_compare{};
+			if constexpr (std::is_scalar_v<key_type> && std::is_scalar_v<K>) {
+				size_type pos = 0;
+				for (size_type i = 0; i < std::size(a_node.entries); ++i) {
+					const auto& key = a_node.entries[i].first;
+					const bool before = Upper ? !comp(a_key, key) : comp(key, a_key);
+					pos += static_cast<size_type>((i < a_node.usedEntries) & before);
+				}
+				return pos;
+			} else if constexpr (Upper) {
+				const auto it = std::upper_bound(
+					a_node.begin(),
+					a_node.end(),
+					a_key,
+					[&](const K& a_lhs, const value_type& a_rhs) {
+						return comp(a_lhs, a_rhs.first);
+					});
+				return static_cast<size_type>(it - a_node.begin());
+			} else {
 				const auto it = std::lower_bound(
-					node->begin(),
-					node->end(),
+					a_node.begin(),
+					a_node.end(),
 					a_key,
-					[&](const value_type& a_lhs, const key_type& a_rhs) {
-						return key_comp()(a_lhs.first, a_rhs);
+					[&](const value_type& a_lhs, const K& a_rhs) {
+						return comp(a_lhs.first, a_rhs);
 					});
-				if (it != node->end()) {
-					const auto pos = static_cast<size_type>(it - node->begin());
-					if (!key_comp()(a_key, it->first)) {
-						return Iter(node, pos);
+				return static_cast<size_type>(it - a_node.begin());
+			}
+		}
+
+		// the most entries a tree of a_height levels can hold, 5^h - 1
+		[[nodiscard]] static constexpr std::size_t full_size(std::size_t a_height) noexcept
+		{
+			std::size_t size = 1;
+			for (std::size_t i = 0; i < a_height; ++i) {
+				size *= NODE_SIZE + 1;
+			}
+			return size - 1;
+		}
+
+		static void relocate(value_type& a_to, value_type& a_from)
+		{
+			std::construct_at(std::addressof(a_to), std::move(a_from));
+			std::destroy_at(std::addressof(a_from));
+		}
+
+		// closes the gap left by a relocated entry at a_pos, along with the child to its right
+		static void close_gap(node_type& a_node, size_type a_pos)
+		{
+			for (auto i = a_pos + 1; i < a_node.usedEntries; ++i) {
+				relocate(a_node.entries[i - 1], a_node.entries[i]);
+				a_node.nodes[i] = a_node.nodes[i + 1];
+			}
+			a_node.nodes[a_node.usedEntries] = nullptr;
+			--a_node.usedEntries;
+		}
+
+		[[nodiscard]] node_type* allocate_node()
+		{
+			node_type* node = nullptr;
+			if (_availNodes) {
+				node = std::exchange(_availNodes, _availNodes->nodes[0]);
+			} else {
+				node = static_cast<node_type*>(malloc(sizeof(node_type)));
+				if (!node) {
+					stl::report_and_fail("failed to handle allocation request"sv);
+				}
+				++_allocatedSize;
+			}
+			return std::construct_at(node);
+		}
+
+		// nodes are pooled through their first child link
+		void recycle_node(node_type* a_node) noexcept
+		{
+			a_node->nodes[0] = std::exchange(_availNodes, a_node);
+			a_node->usedEntries = 0;
+		}
+
+		void recycle_tree(node_type* a_node) noexcept
+		{
+			for (size_type i = 0; i <= a_node->usedEntries; ++i) {
+				if (a_node->nodes[i]) {
+					recycle_tree(a_node->nodes[i]);
+				}
+			}
+			std::destroy_n(a_node->entries, a_node->usedEntries);
+			recycle_node(a_node);
+		}
+
+		[[nodiscard]] node_type* clone(const node_type* a_node)
+		{
+			if (!a_node) {
+				return nullptr;
+			}
+
+			const auto node = allocate_node();
+			for (size_type i = 0; i < a_node->usedEntries; ++i) {
+				node->nodes[i] = clone(occupied(a_node->nodes[i]));
+				std::construct_at(node->entries + i, a_node->entries[i]);
+				node->usedEntries = i + 1;
+			}
+			node->nodes[a_node->usedEntries] = clone(occupied(a_node->nodes[a_node->usedEntries]));
+			return node;
+		}
+
+		// a_count entries are spread across a_height levels so that no node below the root holds fewer
+		// than 2, consuming a_it in order
+		template <class It>
+		[[nodiscard]] node_type* build(It& a_it, std::size_t a_count, std::size_t a_height)
+		{
+			const auto node = allocate_node();
+			if (a_height == 1) {
+				for (size_type i = 0; i < a_count; ++i, ++a_it) {
+					std::construct_at(node->entries + i, *a_it);
+					node->usedEntries = i + 1;
+				}
+			} else {
+				const auto below = full_size(a_height - 1) + 1;
+				const auto children = std::max<std::size_t>(2, (a_count + below) / below);
+				const auto share = a_count - (children - 1);
+				for (size_type i = 0; i < children; ++i) {
+					const auto take = share / children + (i < share % children ? 1 : 0);
+					node->nodes[i] = build(a_it, take, a_height - 1);
+					if (i + 1 < children) {
+						std::construct_at(node->entries + i, *a_it);
+						node->usedEntries = i + 1;
+						++a_it;
+					}
+				}
+			}
+			return node;
+		}
+
+		// the new entry is placed in its leaf, and a full node splits around its middle entry, which then
+		// moves up into the parent, same as the engine's layout of at most 4 entries to a node
+		template <class V>
+		std::pair<iterator, bool> do_insert(V&& a_value)
+		{
+			iterator path;
+			if (descend<false>(path, a_value.first)) {
+				return { path, false };
+			}
+
+			union carry_type
+			{
+				carry_type() noexcept {}
+				~carry_type() noexcept {}
+
+				value_type value;
+			} carry;
+			std::construct_at(std::addressof(carry.value), std::forward<V>(a_value));
+
+			// carry holds the new value until it lands, then the middle entries of any splits above it
+			bool landed = false;
+			const value_type* placed = nullptr;
+			node_type* right = nullptr;
+			auto depth = path._depth;
+			for (; depth > 0; --depth) {
+				const auto node = path._path[depth - 1];
+				const auto pos = static_cast<size_type>(path._index[depth - 1]);
+				if (node->usedEntries < NODE_SIZE) {
+					for (auto i = node->usedEntries; i > pos; --i) {
+						relocate(node->entries[i], node->entries[i - 1]);
+						node->nodes[i + 1] = node->nodes[i];
+					}
+					relocate(node->entries[pos], carry.value);
+					node->nodes[pos + 1] = right;
+					++node->usedEntries;
+					if (!landed) {
+						placed = node->entries + pos;
+					}
+					break;
+				}
+
+				const auto [entry, split] = split_insert(*node, pos, carry.value, right);
+				right = split;
+				if (!landed && entry) {
+					placed = entry;
+					landed = true;
+				}
+			}
+
+			if (depth == 0) {
+				// the root split, or the tree was empty
+				const auto root = allocate_node();
+				relocate(root->entries[0], carry.value);
+				root->nodes[0] = occupied(_root);
+				root->nodes[1] = right;
+				root->usedEntries = 1;
+				_root = root;
+				if (!landed) {
+					placed = root->entries;
+				}
+			}
+
+			return { do_bound<iterator, false>(placed->first), true };
+		}
+
+		// inserts a_value and its right child into a full node, leaving the middle of the five entries in
+		// a_value to be passed up. returns where the inserted value landed, unless it's the middle one,
+		// and the new right half
+		std::pair<value_type*, node_type*> split_insert(node_type& a_node, size_type a_pos, value_type& a_value, node_type* a_right)
+		{
+			const auto split = allocate_node();
+			value_type* placed = nullptr;
+			if (a_pos == MIN_ENTRIES) {
+				// the new value is the middle one, so it stays behind to move up
+				for (size_type i = MIN_ENTRIES; i < a_node.usedEntries; ++i) {
+					relocate(split->entries[i - MIN_ENTRIES], a_node.entries[i]);
+					split->nodes[i - MIN_ENTRIES + 1] = a_node.nodes[i + 1];
+					a_node.nodes[i + 1] = nullptr;
+				}
+				split->nodes[0] = a_right;
+			} else {
+				// gather the five entries, then deal them out on either side of the middle
+				union spill_type
+				{
+					spill_type() noexcept {}
+					~spill_type() noexcept {}
+
+					value_type entries[NODE_SIZE + 1];
+				} spill;
+				node_type* children[NODE_SIZE + 2];
+
+				children[0] = a_node.nodes[0];
+				for (size_type i = 0, j = 0; i <= NODE_SIZE; ++i) {
+					if (i == a_pos) {
+						relocate(spill.entries[i], a_value);
+						children[i + 1] = a_right;
 					} else {
-						node = node->nodes[pos];
+						relocate(spill.entries[i], a_node.entries[j]);
+						children[i + 1] = a_node.nodes[++j];
+					}
+				}
+
+				for (size_type i = 0; i < MIN_ENTRIES; ++i) {
+					relocate(a_node.entries[i], spill.entries[i]);
+					relocate(split->entries[i], spill.entries[MIN_ENTRIES + 1 + i]);
+				}
+				relocate(a_value, spill.entries[MIN_ENTRIES]);
+				for (size_type i = 0; i <= MIN_ENTRIES; ++i) {
+					a_node.nodes[i] = children[i];
+					split->nodes[i] = children[MIN_ENTRIES + 1 + i];
+				}
+				for (size_type i = MIN_ENTRIES + 1; i < std::size(a_node.nodes); ++i) {
+					a_node.nodes[i] = nullptr;
+				}
+				placed = a_pos < MIN_ENTRIES ? a_node.entries + a_pos : split->entries + (a_pos - MIN_ENTRIES - 1);
+			}
+
+			a_node.usedEntries = MIN_ENTRIES;
+			split->usedEntries = MIN_ENTRIES;
+			return { placed, split };
+		}
+
+		// removes the entry a_path points at. an entry in an inner node trades places with its
+		// predecessor first, so the removal always happens in a leaf. a node left with a single entry
+		// borrows one from a sibling that can spare it, or else merges with a sibling and the entry
+		// between them, which may leave the parent short in turn
+		void do_erase(const_iterator a_path)
+		{
+			auto& path = a_path._path;
+			auto& index = a_path._index;
+			auto depth = a_path._depth;
+			assert(depth > 0);
+
+			const auto target = path[depth - 1];
+			const auto pos = static_cast<size_type>(index[depth - 1]);
+			if (auto child = occupied(target->nodes[pos]); child) {
+				for (; child; child = occupied(child->nodes[child->usedEntries])) {
+					assert(depth < MAX_DEPTH);
+					path[depth] = child;
+					index[depth] = static_cast<std::uint8_t>(child->usedEntries);
+					++depth;
+				}
+				const auto leaf = path[depth - 1];
+				std::destroy_at(target->entries + pos);
+				relocate(target->entries[pos], leaf->entries[leaf->usedEntries - 1]);
+				--leaf->usedEntries;
+			} else {
+				std::destroy_at(target->entries + pos);
+				close_gap(*target, pos);
+			}
+
+			for (; depth > 1 && path[depth - 1]->usedEntries < MIN_ENTRIES; --depth) {
+				const auto node = path[depth - 1];
+				const auto parent = path[depth - 2];
+				const auto at = static_cast<size_type>(index[depth - 2]);
+				const auto left = at > 0 ? parent->nodes[at - 1] : nullptr;
+				const auto right = at < parent->usedEntries ? parent->nodes[at + 1] : nullptr;
+
+				if (left && left->usedEntries > MIN_ENTRIES) {
+					for (auto i = node->usedEntries; i > 0; --i) {
+						relocate(node->entries[i], node->entries[i - 1]);
+						node->nodes[i + 1] = node->nodes[i];
 					}
+					node->nodes[1] = node->nodes[0];
+					relocate(node->entries[0], parent->entries[at - 1]);
+					node->nodes[0] = std::exchange(left->nodes[left->usedEntries], nullptr);
+					++node->usedEntries;
+					relocate(parent->entries[at - 1], left->entries[left->usedEntries - 1]);
+					--left->usedEntries;
+					break;
+				} else if (right && right->usedEntries > MIN_ENTRIES) {
+					relocate(node->entries[node->usedEntries], parent->entries[at]);
+					node->nodes[node->usedEntries + 1] = right->nodes[0];
+					++node->usedEntries;
+					relocate(parent->entries[at], right->entries[0]);
+					right->nodes[0] = right->nodes[1];
+					close_gap(*right, 0);
+					break;
+				} else if (left) {
+					merge(*parent, at - 1);
 				} else {
-					node = node->nodes[node->usedEntries];
+					merge(*parent, at);
 				}
 			}
 
-			return Iter();
+			if (const auto root = _root; root && root->usedEntries == 0) {
+				_root = root->nodes[0];
+				recycle_node(root);
+			}
+		}
+
+		// folds the child right of a_pos, and the entry between them, into the child left of it
+		void merge(node_type& a_parent, size_type a_pos)
+		{
+			const auto left = a_parent.nodes[a_pos];
+			const auto right = a_parent.nodes[a_pos + 1];
+
+			relocate(left->entries[left->usedEntries], a_parent.entries[a_pos]);
+			left->nodes[left->usedEntries + 1] = right->nodes[0];
+			++left->usedEntries;
+			for (size_type i = 0; i < right->usedEntries; ++i) {
+				relocate(left->entries[left->usedEntries], right->entries[i]);
+				left->nodes[left->usedEntries + 1] = right->nodes[i + 1];
+				++left->usedEntries;
+			}
+
+			close_gap(a_parent, a_pos);
+			recycle_node(right);
+		}
+
+		template <class Iter>
+		[[nodiscard]] Iter do_begin() const noexcept
+		{
+			Iter result;
+			result.seek_first(occupied(_root));
+			return result;
+		}
+
+		// records the path down to a_key, or to the leaf where it would go, and whether it was found
+		template <bool Upper, class Iter, class K>
+		bool descend(Iter& a_path, const K& a_key) const
+		{
+			for (auto node = occupied(_root); node;) {
+				const auto pos = search<Upper>(*node, a_key);
+				a_path.push(node, pos);
+				if constexpr (!Upper) {
+					if (pos < node->usedEntries && !key_comp()(a_key, node->entries[pos].first)) {
+						return true;
+					}
+				}
+				node = occupied(node->nodes[pos]);
+			}
+			return false;
+		}
+
+		template <class Iter, bool Upper, class K>
+		[[nodiscard]] Iter do_bound(const K& a_key) const
+		{
+			Iter result;
+			if (!descend<Upper>(result, a_key)) {
+				result.settle();
+			}
+			return result;
+		}
+
+		template <class Iter, class K>
+		[[nodiscard]] Iter do_find(const K& a_key) const
+		{
+			const auto it = do_bound<Iter, false>(a_key);
+			return it != Iter() && !key_comp()(a_key, (*it).first) ? it : Iter();
+		}
+
+		// keys are unique, so the range holds one entry at most
+		template <class Iter, class K>
+		[[nodiscard]] std::pair<Iter, Iter> do_equal_range(const K& a_key) const
+		{
+			auto first = do_bound<Iter, false>(a_key);
+			auto last = first;
+			if (last != Iter() && !key_comp()(a_key, (*last).first)) {
+				++last;
+			}
+			return { first, last };
 		}
 
+		// members
 		std::uint64_t pad{ 0 };             // 00
 		size_type _activeEntry{ 0 };        // 08
-		size_type _allocatedSize{ 0 };      // 0C
+		size_type _allocatedSize{ 0 };      // 0C - by this library's convention, nodes drawn from the heap, pooled ones included
 		node_type* _root{ nullptr };        // 10
-		node_type* _availNodes{ nullptr };  // 18
+		node_type* _availNodes{ nullptr };  // 18 - by this library's convention, a free list linked through nodes[0]
 	};
 }
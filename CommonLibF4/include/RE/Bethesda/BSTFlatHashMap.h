@@ -0,0 +1,622 @@
+#pragma once
+
+#include "RE/Bethesda/BSTHashMap.h"
+
+#include <emmintrin.h>
+
+namespace RE
+{
+	// open addressing with one metadata byte per slot, probed sixteen at a time (a "swiss table").
+	// it takes the same hashers, traits and allocators as BSTScatterTable, but its layout is ours
+	// and not the engine's, so it must never be handed to game code
+	template <
+		class Hash,
+		class KeyEqual,
+		class Traits,
+		template <std::size_t, std::size_t> class Allocator>
+	class BSTFlatScatterTable
+	{
+	public:
+		using traits_type = Traits;
+		using key_type = typename Traits::key_type;
+		using mapped_type = typename Traits::mapped_type;
+		using value_type = typename Traits::value_type;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = Hash;
+		using key_equal = KeyEqual;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+
+		static_assert(std::is_invocable_r_v<std::uint32_t, const hasher&, const key_type&>);
+		static_assert(std::is_invocable_r_v<bool, const key_equal&, const key_type&, const key_type&>);
+
+	private:
+		// a full slot's control byte holds 7 bits of its hash, the rest have their sign bit set
+		using ctrl_type = std::int8_t;
+
+		static constexpr ctrl_type EMPTY = -128;
+		static constexpr ctrl_type DELETED = -2;
+		static constexpr size_type GROUP = 16;
+
+		union slot_type
+		{
+			slot_type() noexcept {}
+			slot_type(const slot_type&) = delete;
+			~slot_type() noexcept {}
+			slot_type& operator=(const slot_type&) = delete;
+
+			value_type value;
+		};
+
+		// one bit per slot in a group, set where the control bytes matched
+		class group_type
+		{
+		public:
+			explicit group_type(const ctrl_type* a_ctrl) noexcept :
+				_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_ctrl)))
+			{}
+
+			[[nodiscard]] std::uint32_t match(ctrl_type a_h2) const noexcept { return mask(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(a_h2))); }
+			[[nodiscard]] std::uint32_t match_empty() const noexcept { return mask(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(EMPTY))); }
+			[[nodiscard]] std::uint32_t match_empty_or_deleted() const noexcept { return mask(_ctrl); }
+
+		private:
+			[[nodiscard]] static std::uint32_t mask(__m128i a_bytes) noexcept { return static_cast<std::uint32_t>(_mm_movemask_epi8(a_bytes)); }
+
+			__m128i _ctrl;
+		};
+
+		template <class U>
+		class iterator_base :
+			public boost::stl_interfaces::iterator_interface<
+				iterator_base<U>,
+				std::forward_iterator_tag,
+				U>
+		{
+		private:
+			using super =
+				boost::stl_interfaces::iterator_interface<
+					iterator_base<U>,
+					std::forward_iterator_tag,
+					U>;
+
+		public:
+			using difference_type = typename super::difference_type;
+			using value_type = typename super::value_type;
+			using pointer = typename super::pointer;
+			using reference = typename super::reference;
+			using iterator_category = typename super::iterator_category;
+
+			iterator_base() = default;
+
+			template <class V>
+			iterator_base(const iterator_base<V>& a_rhs) noexcept  //
+				requires(std::convertible_to<typename iterator_base<V>::reference, reference>) :
+				_ctrl(a_rhs._ctrl),
+				_last(a_rhs._last),
+				_slot(a_rhs._slot)
+			{}
+
+			~iterator_base() = default;
+
+			template <class V>
+			iterator_base& operator=(const iterator_base<V>& a_rhs) noexcept  //
+				requires(std::convertible_to<typename iterator_base<V>::reference, reference>)
+			{
+				assert(_last == a_rhs._last);
+				_ctrl = a_rhs._ctrl;
+				_last = a_rhs._last;
+				_slot = a_rhs._slot;
+				return *this;
+			}
+
+			[[nodiscard]] reference operator*() const noexcept
+			{
+				assert(_ctrl != _last);
+				assert(*_ctrl >= 0);
+				return _slot->value;
+			}
+
+			template <class V>
+			[[nodiscard]] bool operator==(const iterator_base<V>& a_rhs) const noexcept
+			{
+				assert(_last == a_rhs._last);
+				return _ctrl == a_rhs._ctrl;
+			}
+
+			iterator_base& operator++() noexcept
+			{
+				assert(_ctrl != _last);
+				++_ctrl;
+				++_slot;
+				seek();
+				return *this;
+			}
+
+			using super::operator++;
+
+		protected:
+			friend class BSTFlatScatterTable;
+
+			iterator_base(const ctrl_type* a_ctrl, const ctrl_type* a_last, slot_type* a_slot) noexcept :
+				_ctrl(a_ctrl),
+				_last(a_last),
+				_slot(a_slot)
+			{
+				seek();
+			}
+
+			[[nodiscard]] slot_type* get_slot() const noexcept { return _slot; }
+
+		private:
+			template <class>
+			friend class iterator_base;
+
+			void seek() noexcept
+			{
+				for (; _ctrl != _last && *_ctrl < 0; ++_ctrl, ++_slot) {}
+			}
+
+			const ctrl_type* _ctrl{ nullptr };
+			const ctrl_type* _last{ nullptr };
+			slot_type* _slot{ nullptr };
+		};
+
+	public:
+		using allocator_type = Allocator<sizeof(slot_type), alignof(slot_type)>;
+		using iterator = iterator_base<value_type>;
+		using const_iterator = iterator_base<const value_type>;
+
+		BSTFlatScatterTable() = default;
+
+		BSTFlatScatterTable(const BSTFlatScatterTable& a_rhs) { insert(a_rhs.begin(), a_rhs.end()); }
+
+		BSTFlatScatterTable(BSTFlatScatterTable&& a_rhs) noexcept  //
+			requires(std::same_as<typename allocator_type::propagate_on_container_move_assignment, std::true_type>) :
+			_capacity(std::exchange(a_rhs._capacity, 0)),
+			_size(std::exchange(a_rhs._size, 0)),
+			_growthLeft(std::exchange(a_rhs._growthLeft, 0)),
+			_allocator(std::move(a_rhs._allocator))
+		{
+			assert(a_rhs.empty());
+		}
+
+		~BSTFlatScatterTable() { free_resources(); }
+
+		BSTFlatScatterTable& operator=(const BSTFlatScatterTable& a_rhs)
+		{
+			if (this != std::addressof(a_rhs)) {
+				clear();
+				insert(a_rhs.begin(), a_rhs.end());
+			}
+			return *this;
+		}
+
+		BSTFlatScatterTable& operator=(BSTFlatScatterTable&& a_rhs)  //
+			requires(std::same_as<typename allocator_type::propagate_on_container_move_assignment, std::true_type>)
+		{
+			if (this != std::addressof(a_rhs)) {
+				free_resources();
+
+				_capacity = std::exchange(a_rhs._capacity, 0);
+				_size = std::exchange(a_rhs._size, 0);
+				_growthLeft = std::exchange(a_rhs._growthLeft, 0);
+				_allocator = std::move(a_rhs._allocator);
+
+				assert(a_rhs.empty());
+			}
+			return *this;
+		}
+
+		[[nodiscard]] iterator begin() noexcept { return make_iterator<iterator>(0); }
+		[[nodiscard]] const_iterator begin() const noexcept { return make_iterator<const_iterator>(0); }
+		[[nodiscard]] const_iterator cbegin() const noexcept { return make_iterator<const_iterator>(0); }
+
+		[[nodiscard]] iterator end() noexcept { return make_iterator<iterator>(_capacity); }
+		[[nodiscard]] const_iterator end() const noexcept { return make_iterator<const_iterator>(_capacity); }
+		[[nodiscard]] const_iterator cend() const noexcept { return make_iterator<const_iterator>(_capacity); }
+
+		[[nodiscard]] bool empty() const noexcept { return size() == 0; }
+		[[nodiscard]] size_type size() const noexcept { return _size; }
+
+		void clear()
+		{
+			if (_capacity > 0) {
+				const auto ctrl = get_ctrl();
+				const auto slots = get_slots();
+				for (size_type i = 0; i < _capacity; ++i) {
+					if (ctrl[i] >= 0) {
+						std::destroy_at(std::addressof(slots[i].value));
+					}
+				}
+				std::fill_n(ctrl, _capacity, EMPTY);
+				_size = 0;
+				_growthLeft = max_load(_capacity);
+			}
+
+			assert(empty());
+		}
+
+		std::pair<iterator, bool> insert(const value_type& a_value) { return do_insert(a_value); }
+		std::pair<iterator, bool> insert(value_type&& a_value) { return do_insert(std::move(a_value)); }
+
+		template <std::input_iterator InputIt>
+		void insert(InputIt a_first, InputIt a_last)  //
+			requires(std::convertible_to<std::iter_reference_t<InputIt>, const_reference>)
+		{
+			reserve(size() + static_cast<size_type>(std::distance(a_first, a_last)));
+			for (; a_first != a_last; ++a_first) {
+				insert(*std::move(a_first));
+			}
+		}
+
+		template <class... Args>
+		std::pair<iterator, bool> emplace(Args&&... a_args)  //
+			requires(std::constructible_from<value_type, Args...>)
+		{
+			return insert(value_type(std::forward<Args>(a_args)...));
+		}
+
+		iterator erase(const_iterator a_pos) { return do_erase(a_pos); }
+		iterator erase(iterator a_pos) { return do_erase(a_pos); }
+
+		size_type erase(const key_type& a_key)
+		{
+			const auto pos = find(a_key);
+			if (pos != end()) {
+				erase(pos);
+				return 1;
+			} else {
+				return 0;
+			}
+		}
+
+		[[nodiscard]] iterator find(const key_type& a_key) { return do_find<iterator>(a_key); }
+		[[nodiscard]] const_iterator find(const key_type& a_key) const { return do_find<const_iterator>(a_key); }
+
+		template <class K>
+		[[nodiscard]] iterator find(const K& a_key)  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return do_find<iterator>(a_key);
+		}
+
+		template <class K>
+		[[nodiscard]] const_iterator find(const K& a_key) const  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return do_find<const_iterator>(a_key);
+		}
+
+		[[nodiscard]] bool contains(const key_type& a_key) const { return find(a_key) != end(); }
+
+		template <class K>
+		[[nodiscard]] bool contains(const K& a_key) const  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return find(a_key) != end();
+		}
+
+		[[nodiscard]] size_type count(const key_type& a_key) const { return contains(a_key) ? 1 : 0; }
+
+		template <class K>
+		[[nodiscard]] size_type count(const K& a_key) const  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return contains(a_key) ? 1 : 0;
+		}
+
+		void reserve(size_type a_count)
+		{
+			if (a_count > size() + _growthLeft) {
+				rehash(capacity_for(a_count));
+			}
+		}
+
+	private:
+		// a hash split in two: where to start probing, and the 7 bits kept in the control byte. the
+		// low bits of a product only depend on the low bits of the hash, so the high half of the product
+		// is folded back into the low half, which h1 draws from. h2 takes the top bits, which the fold
+		// leaves alone and which already depend on every bit of the hash
+		struct hash_type
+		{
+		public:
+			explicit hash_type(std::uint32_t a_hash) noexcept :
+				_hash(mix(a_hash))
+			{}
+
+			[[nodiscard]] size_type h1() const noexcept { return static_cast<size_type>(_hash >> 7); }
+			[[nodiscard]] ctrl_type h2() const noexcept { return static_cast<ctrl_type>(_hash >> 57); }
+
+		private:
+			[[nodiscard]] static std::uint64_t mix(std::uint32_t a_hash) noexcept
+			{
+				const auto product = static_cast<std::uint64_t>(a_hash) * 0x9E3779B97F4A7C15ull;
+				return product ^ (product >> 32);
+			}
+
+			std::uint64_t _hash;
+		};
+
+		// visits every group once, since the groups are a power of 2 and the steps are triangular
+		class probe_type
+		{
+		public:
+			probe_type(hash_type a_hash, size_type a_capacity) noexcept :
+				_mask(a_capacity / GROUP - 1),
+				_group(a_hash.h1() & _mask)
+			{}
+
+			[[nodiscard]] size_type offset() const noexcept { return _group * GROUP; }
+
+			void next() noexcept
+			{
+				++_step;
+				_group = (_group + _step) & _mask;
+			}
+
+		private:
+			size_type _mask;
+			size_type _group;
+			size_type _step{ 0 };
+		};
+
+		[[nodiscard]] static const key_type& unwrap_key(const value_type& a_value) noexcept
+		{
+			return traits_type::unwrap_key(a_value);
+		}
+
+		// at most 7/8 full, so every probe is guaranteed to reach an empty slot
+		[[nodiscard]] static constexpr size_type max_load(size_type a_capacity) noexcept { return a_capacity - a_capacity / 8; }
+
+		[[nodiscard]] static size_type capacity_for(size_type a_count) noexcept
+		{
+			const auto min = std::max<size_type>(GROUP, allocator_type::min_size());
+			return std::max(std::bit_ceil(a_count + (a_count + 6) / 7), std::bit_ceil(min));
+		}
+
+		// the control bytes trail the slots in the same block, rounded up to a whole slot
+		[[nodiscard]] static size_type block_slots(size_type a_capacity) noexcept
+		{
+			return a_capacity + (a_capacity + sizeof(slot_type) - 1) / sizeof(slot_type);
+		}
+
+		[[nodiscard]] slot_type* get_slots() const noexcept { return static_cast<slot_type*>(_allocator.get_entries()); }
+		[[nodiscard]] ctrl_type* get_ctrl() const noexcept { return reinterpret_cast<ctrl_type*>(get_slots() + _capacity); }
+
+		template <class Iter>
+		[[nodiscard]] Iter make_iterator(size_type a_idx) const noexcept
+		{
+			if (_capacity == 0) {
+				return Iter();
+			}
+
+			const auto ctrl = get_ctrl();
+			return Iter(ctrl + a_idx, ctrl + _capacity, get_slots() + a_idx);
+		}
+
+		template <class K>
+		[[nodiscard]] std::uint32_t hash_function(const K& a_key) const  //
+			noexcept(std::is_nothrow_constructible_v<hasher>&&
+					std::is_nothrow_invocable_v<const hasher&, const K&>)
+		{
+			return static_cast<std::uint32_t>(hasher()(a_key));
+		}
+
+		template <class K>
+		[[nodiscard]] bool key_eq(const key_type& a_lhs, const K& a_rhs) const  //
+			noexcept(std::is_nothrow_constructible_v<key_equal>&&
+					std::is_nothrow_invocable_v<const key_equal&, const key_type&, const K&>)
+		{
+			return static_cast<bool>(key_equal()(a_lhs, a_rhs));
+		}
+
+		template <class K>
+		[[nodiscard]] size_type find_index(const K& a_key, hash_type a_hash) const
+		{
+			if (_capacity == 0) {
+				return _capacity;
+			}
+
+			const auto ctrl = get_ctrl();
+			const auto slots = get_slots();
+			for (probe_type probe(a_hash, _capacity);; probe.next()) {
+				const group_type group(ctrl + probe.offset());
+				for (auto match = group.match(a_hash.h2()); match != 0; match &= match - 1) {
+					const auto idx = probe.offset() + std::countr_zero(match);
+					if (key_eq(unwrap_key(slots[idx].value), a_key)) {
+						return idx;
+					}
+				}
+
+				if (group.match_empty() != 0) {
+					return _capacity;
+				}
+			}
+		}
+
+		[[nodiscard]] size_type find_free_index(hash_type a_hash) const noexcept
+		{
+			assert(_capacity > 0);
+			const auto ctrl = get_ctrl();
+			for (probe_type probe(a_hash, _capacity);; probe.next()) {
+				const group_type group(ctrl + probe.offset());
+				if (const auto match = group.match_empty_or_deleted(); match != 0) {
+					return probe.offset() + std::countr_zero(match);
+				}
+			}
+		}
+
+		template <class Iter, class K>
+		[[nodiscard]] Iter do_find(const K& a_key) const
+		{
+			return make_iterator<Iter>(find_index(a_key, hash_type(hash_function(a_key))));
+		}
+
+		template <class P>
+		[[nodiscard]] std::pair<iterator, bool> do_insert(P&& a_value)  //
+			requires(std::same_as<std::decay_t<P>, value_type>)
+		{
+			const hash_type hash(hash_function(unwrap_key(a_value)));
+			if (const auto idx = find_index(unwrap_key(a_value), hash); idx != _capacity) {  // already exists
+				return std::make_pair(make_iterator<iterator>(idx), false);
+			}
+
+			auto idx = _capacity > 0 ? find_free_index(hash) : _capacity;
+			if (idx == _capacity || (_growthLeft == 0 && get_ctrl()[idx] == EMPTY)) {
+				// rehashing at the same capacity is enough to clear out a table full of tombstones
+				rehash(capacity_for(size() + 1));
+				idx = find_free_index(hash);
+			}
+
+			place(idx, hash, std::forward<P>(a_value));
+			return std::make_pair(make_iterator<iterator>(idx), true);
+		}
+
+		template <class P>
+		void place(size_type a_idx, hash_type a_hash, P&& a_value)
+		{
+			const auto ctrl = get_ctrl();
+			std::construct_at(std::addressof(get_slots()[a_idx].value), std::forward<P>(a_value));
+			if (ctrl[a_idx] == EMPTY) {
+				assert(_growthLeft > 0);
+				--_growthLeft;
+			}
+			ctrl[a_idx] = a_hash.h2();
+			++_size;
+		}
+
+		[[nodiscard]] iterator do_erase(const_iterator a_pos)
+		{
+			assert(a_pos != end());
+			const auto idx = static_cast<size_type>(a_pos.get_slot() - get_slots());
+			const auto ctrl = get_ctrl();
+			assert(ctrl[idx] >= 0);
+
+			std::destroy_at(std::addressof(get_slots()[idx].value));
+			--_size;
+
+			// a probe only moves past a group that has no empty slots, so a slot in a group that still
+			// has one can go straight back to empty instead of leaving a tombstone
+			if (group_type(ctrl + idx / GROUP * GROUP).match_empty() != 0) {
+				ctrl[idx] = EMPTY;
+				++_growthLeft;
+			} else {
+				ctrl[idx] = DELETED;
+			}
+
+			return make_iterator<iterator>(idx);
+		}
+
+		void rehash(size_type a_capacity)
+		{
+			assert(std::has_single_bit(a_capacity));
+			assert(size() <= max_load(a_capacity));
+
+			const auto oldCap = _capacity;
+			const auto oldSlots = get_slots();
+			const auto oldCtrl = oldCap > 0 ? get_ctrl() : nullptr;
+
+			const auto newSlots = static_cast<slot_type*>(_allocator.allocate_bytes(sizeof(slot_type) * block_slots(a_capacity)));
+			if (!newSlots) {
+				stl::report_and_fail("failed to handle an allocation"sv);
+			}
+
+			// an allocator that hands back the same block leaves nowhere to move from, so set everything aside first
+			std::vector<value_type> todo;
+			if (newSlots == oldSlots) {
+				todo.reserve(size());
+				for (size_type i = 0; i < oldCap; ++i) {
+					if (oldCtrl[i] >= 0) {
+						todo.push_back(std::move(oldSlots[i].value));
+						std::destroy_at(std::addressof(oldSlots[i].value));
+					}
+				}
+			}
+
+			_allocator.set_entries(newSlots);
+			_capacity = a_capacity;
+			_size = 0;
+			_growthLeft = max_load(a_capacity);
+			std::fill_n(get_ctrl(), _capacity, EMPTY);
+
+			const auto move = [&](value_type&& a_value) {
+				const hash_type hash(hash_function(unwrap_key(a_value)));
+				place(find_free_index(hash), hash, std::move(a_value));
+			};
+
+			if (newSlots == oldSlots) {
+				for (auto& value : todo) {
+					move(std::move(value));
+				}
+			} else if (oldSlots) {
+				for (size_type i = 0; i < oldCap; ++i) {
+					if (oldCtrl[i] >= 0) {
+						move(std::move(oldSlots[i].value));
+						std::destroy_at(std::addressof(oldSlots[i].value));
+					}
+				}
+				_allocator.deallocate_bytes(oldSlots);
+			}
+		}
+
+		void free_resources()
+		{
+			if (_capacity > 0) {
+				clear();
+				_allocator.deallocate_bytes(get_slots());
+				_allocator.set_entries(nullptr);
+				_capacity = 0;
+				_growthLeft = 0;
+			}
+
+			assert(get_slots() == nullptr);
+			assert(_capacity == 0);
+			assert(_size == 0);
+		}
+
+		// members
+		size_type _capacity{ 0 };    // total # of slots, always a power of 2 and a multiple of GROUP
+		size_type _size{ 0 };        // # of full slots
+		size_type _growthLeft{ 0 };  // # of empty slots that can be filled before a rehash
+		allocator_type _allocator;
+	};
+
+	template <
+		class Key,
+		class T,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<>>
+	using BSTFlatHashMap =
+		BSTFlatScatterTable<
+			Hash,
+			KeyEq,
+			BSTScatterTableTraits<Key, T>,
+			BSTScatterTableHeapAllocator>;
+
+	template <
+		class Key,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<>>
+	using BSTFlatSet =
+		BSTFlatScatterTable<
+			Hash,
+			KeyEq,
+			BSTSetTraits<Key>,
+			BSTScatterTableHeapAllocator>;
+
+	template <
+		class Key,
+		class T,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<>>
+	using BSTFlatScrapHashMap =
+		BSTFlatScatterTable<
+			Hash,
+			KeyEq,
+			BSTScatterTableTraits<Key, T>,
+			BSTScatterTableScrapAllocator>;
+}
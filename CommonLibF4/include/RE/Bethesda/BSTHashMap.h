@@ -6,13 +6,62 @@
 #	include "RE/Bethesda/MemoryManager.h"
 #endif
 
+#include <xmmintrin.h>
+
 namespace RE
 {
 	namespace detail
 	{
 		static constexpr std::uint8_t BSTScatterTableSentinel[] = { 0xDEu, 0xADu, 0xBEu, 0xEFu };
+
+		// heterogeneous lookup is opt-in, both the hasher and the comparator must agree to it
+		template <class Hash, class KeyEqual, class Key, class K>
+		concept transparent_lookup =
+			requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; } &&
+			std::is_invocable_r_v<std::uint32_t, const Hash&, const K&> &&
+			std::is_invocable_r_v<bool, const KeyEqual&, const Key&, const K&>;
+
+		inline void prefetch(const void* a_address) noexcept
+		{
+			_mm_prefetch(static_cast<const char*>(a_address), _MM_HINT_T0);
+		}
 	}
 
+	// a snapshot of how a table's keys are laid out, see BSTScatterTable::stats
+	struct BSTScatterTableStats
+	{
+	public:
+		std::uint32_t capacity{ 0 };
+		std::uint32_t size{ 0 };
+		float loadFactor{ 0.0F };
+		std::vector<std::uint32_t> chainLengths;  // chainLengths[n] is the number of chains holding n entries
+		double averageProbe{ 0.0 };               // entries compared by a successful lookup, on average
+		std::uint32_t maxProbe{ 0 };              // entries compared by the worst successful lookup
+		std::uint32_t freeScan{ 0 };              // slots the next insert will step over looking for a free one
+	};
+
+	// running totals, shared by every table of the same type. they only move when
+	// F4SE_BSTSCATTERTABLE_STATS is defined, otherwise they cost nothing
+	struct BSTScatterTableCounters
+	{
+	public:
+		void reset() noexcept
+		{
+			for (auto counter : { &finds, &probes, &placements, &collisions, &evictions, &freeScans, &erases, &rehashes }) {
+				counter->store(0, std::memory_order_relaxed);
+			}
+		}
+
+		std::atomic<std::uint64_t> finds{ 0 };       // lookups, including those made to reject duplicate inserts
+		std::atomic<std::uint64_t> probes{ 0 };      // entries compared by those lookups
+		std::atomic<std::uint64_t> placements{ 0 };  // values placed, including those moved by a rehash
+		std::atomic<std::uint64_t> collisions{ 0 };  // placements chained behind an entry with the same home
+		std::atomic<std::uint64_t> evictions{ 0 };   // placements that moved a foreign entry out of their home
+		std::atomic<std::uint64_t> freeScans{ 0 };   // occupied slots stepped over looking for a free one
+		std::atomic<std::uint64_t> erases{ 0 };
+		std::atomic<std::uint64_t> rehashes{ 0 };
+	};
+
 	// scatter table with chaining
 	template <
 		class Hash,
@@ -299,6 +348,41 @@ namespace RE
 			}
 		}
 
+		// builds from a whole range at once: the table is sized once, every key is hashed in a pass of
+		// its own, and each value is then placed straight into its home slot, which is prefetched a few
+		// values ahead. duplicates keep the first occurrence, same as insert
+		template <std::ranges::forward_range R>
+		void insert_bulk(R&& a_range)  //
+			requires(std::same_as<std::ranges::range_value_t<R>, value_type> &&
+					 std::constructible_from<value_type, std::ranges::range_reference_t<R>>)
+		{
+			constexpr std::size_t lookahead = 8;
+
+			std::vector<size_type> hashes;
+			hashes.reserve(static_cast<std::size_t>(std::ranges::distance(a_range)));
+			for (const auto& value : a_range) {
+				hashes.push_back(hash_function(unwrap_key(value)));
+			}
+			if (hashes.empty()) {
+				return;
+			}
+
+			reserve(size() + static_cast<size_type>(hashes.size()));
+			const auto entries = get_entries();
+			const auto mask = _capacity - 1;
+			auto it = std::ranges::begin(a_range);
+			for (std::size_t i = 0; i < hashes.size(); ++i, ++it) {
+				if (i + lookahead < hashes.size()) {
+					detail::prefetch(entries + (hashes[i + lookahead] & mask));
+				}
+
+				auto& home = entries[hashes[i] & mask];
+				if (!find_in_chain(home, unwrap_key(*it))) {
+					insert_unique(value_type(*it), home);
+				}
+			}
+		}
+
 		template <class... Args>
 		std::pair<iterator, bool> emplace(Args&&... a_args)  //
 			requires(std::constructible_from<value_type, Args...>)
@@ -316,17 +400,153 @@ namespace RE
 			return result != end() ? 1 : 0;
 		}
 
+		// erases every value matching a_pred in a single pass. each chain is walked once from its head,
+		// unlinking as it goes, where erasing one at a time would re-walk the chain for every value
+		template <class Pred>
+		size_type erase_if(Pred a_pred)  //
+			requires(std::predicate<Pred&, value_type&>)
+		{
+			if (empty()) {
+				return 0;
+			}
+
+			const auto oldSize = size();
+			const auto entries = get_entries();
+			for (size_type i = 0; i < _capacity; ++i) {
+				const auto head = entries + i;
+				if (!head->has_value() || &get_entry_for(unwrap_key(head->value)) != head) {
+					continue;  // empty, or part of a chain that starts elsewhere
+				}
+
+				entry_type* prev = nullptr;
+				auto entry = head;
+				while (entry != _sentinel) {
+					const auto next = entry->next;
+					if (!a_pred(entry->value)) {
+						prev = entry;
+						entry = next;
+					} else if (prev) {  // unlink from the middle or tail
+						prev->next = next;
+						entry->destroy();
+						++_free;
+						entry = next;
+					} else if (next != _sentinel) {  // pull the next value into the head, then test it
+						*entry = std::move(*next);
+						++_free;
+					} else {  // the head was all that was left
+						entry->destroy();
+						++_free;
+						entry = const_cast<entry_type*>(_sentinel);
+					}
+				}
+			}
+
+			return oldSize - size();
+		}
+
 		[[nodiscard]] iterator find(const key_type& a_key) { return do_find<iterator>(a_key); }
 		[[nodiscard]] const_iterator find(const key_type& a_key) const { return do_find<const_iterator>(a_key); }
 
+		// lookup by anything the hasher and comparator accept, without materializing a key_type
+		template <class K>
+		[[nodiscard]] iterator find(const K& a_key)  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return do_find<iterator>(a_key);
+		}
+
+		template <class K>
+		[[nodiscard]] const_iterator find(const K& a_key) const  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return do_find<const_iterator>(a_key);
+		}
+
+		// resolves a batch of lookups at once, writing end() for misses. each group of keys is hashed and
+		// has its home slots prefetched before any chain is walked, so the cache misses overlap instead
+		// of being paid one after another
+		void find_batch(std::span<const key_type> a_keys, std::span<iterator> a_results) { do_find_batch(a_keys, a_results); }
+		void find_batch(std::span<const key_type> a_keys, std::span<const_iterator> a_results) const { do_find_batch(a_keys, a_results); }
+
 		[[nodiscard]] bool contains(const key_type& a_key) const { return find(a_key) != end(); }
 
+		// splits the table into a_count contiguous runs of slots, which can be walked independently
+		// (by std::execution::par, or a worker pool) without any two runs sharing a value
+		[[nodiscard]] std::vector<std::ranges::subrange<iterator>> partition(size_type a_count) { return do_partition<iterator>(a_count); }
+		[[nodiscard]] std::vector<std::ranges::subrange<const_iterator>> partition(size_type a_count) const { return do_partition<const_iterator>(a_count); }
+
+		template <class K>
+		[[nodiscard]] bool contains(const K& a_key) const  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return find(a_key) != end();
+		}
+
+		[[nodiscard]] size_type count(const key_type& a_key) const { return contains(a_key) ? 1 : 0; }
+
+		template <class K>
+		[[nodiscard]] size_type count(const K& a_key) const  //
+			requires(detail::transparent_lookup<hasher, key_equal, key_type, K>)
+		{
+			return contains(a_key) ? 1 : 0;
+		}
+
+		// walks the whole table, so it's meant for diagnostics rather than anything hot
+		[[nodiscard]] BSTScatterTableStats stats() const
+		{
+			BSTScatterTableStats result;
+			result.capacity = _capacity;
+			result.size = size();
+			result.loadFactor = _capacity > 0 ? static_cast<float>(size()) / static_cast<float>(_capacity) : 0.0F;
+			if (empty()) {
+				return result;
+			}
+
+			// every chain starts in its home slot, so walking from each head visits every entry once
+			std::uint64_t probes = 0;
+			const auto entries = get_entries();
+			for (size_type i = 0; i < _capacity; ++i) {
+				const auto& head = entries[i];
+				if (!head.has_value() || &get_entry_for(unwrap_key(head.value)) != &head) {
+					continue;
+				}
+
+				std::uint32_t length = 0;
+				for (auto entry = &head; entry != _sentinel; entry = entry->next) {
+					probes += ++length;
+				}
+
+				if (result.chainLengths.size() <= length) {
+					result.chainLengths.resize(length + 1);
+				}
+				++result.chainLengths[length];
+				result.maxProbe = std::max(result.maxProbe, length);
+			}
+			result.averageProbe = static_cast<double>(probes) / static_cast<double>(size());
+
+			if (_free > 0) {
+				for (auto i = _good; entries[i].has_value(); i = (i + 1) & (_capacity - 1)) {
+					++result.freeScan;
+				}
+			}
+
+			return result;
+		}
+
+		[[nodiscard]] static BSTScatterTableCounters& counters() noexcept
+		{
+			static BSTScatterTableCounters counters;
+			return counters;
+		}
+
 		void reserve(size_type a_count)
 		{
 			if (a_count <= _capacity) {
 				return;
 			}
 
+			record(&BSTScatterTableCounters::rehashes);
+
 			const auto oldCap = _capacity;
 			const auto oldEntries = get_entries();
 
@@ -355,18 +575,7 @@ namespace RE
 
 			if (newEntries == oldEntries) {
 				std::uninitialized_default_construct_n(oldEntries + oldCap, newCap - oldCap);
-				std::vector<value_type> todo;
-				todo.reserve(size());
-				for (size_type i = 0; i < oldCap; ++i) {
-					auto& entry = oldEntries[i];
-					if (entry.has_value()) {
-						todo.emplace_back(std::move(entry).steal());
-					}
-				}
-				setCap(newCap);
-				insert(
-					std::make_move_iterator(todo.begin()),
-					std::make_move_iterator(todo.end()));
+				rehash_in_place(oldCap, newCap);
 			} else {
 				// in with the new
 				std::uninitialized_default_construct_n(newEntries, newCap);
@@ -377,7 +586,7 @@ namespace RE
 					for (size_type i = 0; i < oldCap; ++i) {
 						auto& entry = oldEntries[i];
 						if (entry.has_value()) {
-							insert(std::move(entry).steal());
+							insert_unique(std::move(entry).steal());
 						}
 					}
 					std::destroy_n(oldEntries, oldCap);
@@ -402,6 +611,7 @@ namespace RE
 		[[nodiscard]] iterator do_erase(const_iterator a_pos)
 		{
 			assert(a_pos != end());
+			record(&BSTScatterTableCounters::erases);
 			const auto entry = a_pos.get_entry();
 			assert(entry != nullptr);
 			assert(entry->has_value());
@@ -423,26 +633,84 @@ namespace RE
 			return make_iterator<iterator>(entry + 1);
 		}
 
-		template <class Iter>
-		[[nodiscard]] Iter do_find(const key_type& a_key) const  //
-			noexcept(noexcept(hash_function(a_key)) && noexcept(key_eq(a_key, a_key)))
+		template <class Iter, class K>
+		[[nodiscard]] Iter do_find(const K& a_key) const  //
+			noexcept(noexcept(hash_function(a_key)) && noexcept(key_eq(std::declval<const key_type&>(), a_key)))
 		{
 			if (empty()) {
+				record(&BSTScatterTableCounters::finds);
 				return make_iterator<Iter>();
 			}
 
-			auto entry = &get_entry_for(a_key);
+			const auto entry = find_in_chain(get_entry_for(a_key), a_key);
+			return entry ? make_iterator<Iter>(entry) : make_iterator<Iter>();
+		}
+
+		template <class Iter>
+		[[nodiscard]] std::vector<std::ranges::subrange<Iter>> do_partition(size_type a_count) const
+		{
+			assert(a_count > 0);
+			const auto count = std::min(a_count, std::max<size_type>(_capacity, 1));
+			std::vector<std::ranges::subrange<Iter>> result;
+			result.reserve(count);
+			for (size_type i = 0; i < count; ++i) {
+				const auto first = static_cast<std::uint64_t>(_capacity) * i / count;
+				const auto last = static_cast<std::uint64_t>(_capacity) * (i + 1) / count;
+				result.emplace_back(
+					make_iterator<Iter>(get_entries() + first),
+					make_iterator<Iter>(get_entries() + last));
+			}
+			return result;
+		}
+
+		template <class Iter>
+		void do_find_batch(std::span<const key_type> a_keys, std::span<Iter> a_results) const
+		{
+			assert(a_keys.size() == a_results.size());
+			if (empty()) {
+				std::ranges::fill(a_results, make_iterator<Iter>());
+				return;
+			}
+
+			constexpr std::size_t group = 16;
+			std::array<entry_type*, group> homes;
+			for (std::size_t first = 0; first < a_keys.size(); first += group) {
+				const auto count = std::min(group, a_keys.size() - first);
+				for (std::size_t i = 0; i < count; ++i) {
+					homes[i] = &get_entry_for(a_keys[first + i]);
+					detail::prefetch(homes[i]);
+				}
+
+				for (std::size_t i = 0; i < count; ++i) {
+					const auto entry = find_in_chain(*homes[i], a_keys[first + i]);
+					a_results[first + i] = entry ? make_iterator<Iter>(entry) : make_iterator<Iter>();
+				}
+			}
+		}
+
+		template <class K>
+		[[nodiscard]] entry_type* find_in_chain(entry_type& a_home, const K& a_key) const  //
+			noexcept(noexcept(key_eq(std::declval<const key_type&>(), a_key)))
+		{
+			std::uint64_t probes = 0;
+			const stl::scope_exit tally{ [&]() noexcept {
+				record(&BSTScatterTableCounters::finds);
+				record(&BSTScatterTableCounters::probes, probes);
+			} };
+
+			auto entry = &a_home;
 			if (entry->has_value()) {
 				do {  // follow chain
+					++probes;
 					if (key_eq(unwrap_key(entry->value), a_key)) {
-						return make_iterator<Iter>(entry);
+						return entry;
 					} else {
 						entry = entry->next;
 					}
 				} while (entry != _sentinel);
 			}
 
-			return make_iterator<Iter>();
+			return nullptr;
 		}
 
 		template <class P>
@@ -458,15 +726,36 @@ namespace RE
 				assert(_free > 0);
 			}
 
+			return std::make_pair(insert_unique(std::forward<P>(a_value)), true);
+		}
+
+		// places a value whose key is known to be absent, skipping the duplicate check
+		template <class P>
+		iterator insert_unique(P&& a_value)  //
+			requires(std::same_as<std::decay_t<P>, value_type>)
+		{
+			auto& home = get_entry_for(unwrap_key(a_value));
+			return insert_unique(std::forward<P>(a_value), home);
+		}
+
+		template <class P>
+		iterator insert_unique(P&& a_value, entry_type& a_home)  //
+			requires(std::same_as<std::decay_t<P>, value_type>)
+		{
+			assert(_free > 0);
+			assert(&a_home == &get_entry_for(unwrap_key(a_value)));
 			const stl::scope_exit decrement{ [&]() noexcept { --_free; } };
-			const auto entry = &get_entry_for(unwrap_key(a_value));
+			record(&BSTScatterTableCounters::placements);
+			const auto entry = &a_home;
 			if (entry->has_value()) {  // slot is taken, resolve conflict
 				const auto free = &get_free_entry();
 				const auto wouldve = &get_entry_for(unwrap_key(entry->value));
 				if (wouldve == entry) {  // hash collision
+					record(&BSTScatterTableCounters::collisions);
 					free->emplace(std::forward<P>(a_value), std::exchange(entry->next, free));
-					return std::make_pair(make_iterator<iterator>(free), true);
+					return make_iterator<iterator>(free);
 				} else {  // how did we get here?
+					record(&BSTScatterTableCounters::evictions);
 					auto prev = wouldve;
 					while (prev->next != entry) {
 						prev = prev->next;
@@ -477,14 +766,57 @@ namespace RE
 					prev->next = free;
 					entry->emplace(std::forward<P>(a_value), _sentinel);
 
-					return std::make_pair(make_iterator<iterator>(entry), true);
+					return make_iterator<iterator>(entry);
 				}
 			} else {  // its free realestate
 				entry->emplace(std::forward<P>(a_value), _sentinel);
-				return std::make_pair(make_iterator<iterator>(entry), true);
+				return make_iterator<iterator>(entry);
 			}
 		}
 
+		// rebuilds the chains when the allocator grew the block it already had. every live entry is
+		// first marked as unplaced, then each one is carried to its new home, displacing any unplaced
+		// entry there into the carry in turn, so no scratch storage is needed
+		void rehash_in_place(size_type a_oldCap, size_type a_newCap)
+		{
+			const auto entries = get_entries();
+			const auto unplaced = entries + a_newCap;  // never a real entry or the sentinel
+			const auto count = size();
+			for (size_type i = 0; i < a_oldCap; ++i) {
+				if (entries[i].has_value()) {
+					entries[i].next = unplaced;
+				}
+			}
+
+			_capacity = a_newCap;
+			_free = a_newCap - count;
+			_good = 0;
+
+			entry_type carry;
+			for (size_type i = 0; i < a_oldCap; ++i) {
+				if (entries[i].next != unplaced) {
+					continue;
+				}
+
+				carry = std::move(entries[i]);
+				++_free;
+				for (;;) {
+					auto& home = get_entry_for(unwrap_key(carry.value));
+					if (home.next == unplaced) {
+						record(&BSTScatterTableCounters::placements);
+						entry_type displaced = std::move(home);
+						home.emplace(std::move(carry).steal(), _sentinel);
+						carry = std::move(displaced);
+					} else {
+						insert_unique(std::move(carry).steal());
+						break;
+					}
+				}
+			}
+
+			assert(size() == count);
+		}
+
 		void free_resources()
 		{
 			if (_capacity > 0) {
@@ -502,7 +834,8 @@ namespace RE
 			assert(_free == 0);
 		}
 
-		[[nodiscard]] entry_type& get_entry_for(const key_type& a_key) const  //
+		template <class K>
+		[[nodiscard]] entry_type& get_entry_for(const K& a_key) const  //
 			noexcept(noexcept(hash_function(a_key)))
 		{
 			assert(get_entries() != nullptr);
@@ -533,25 +866,37 @@ namespace RE
 
 			const auto entries = get_entries();
 			while (entries[_good].has_value()) {
+				record(&BSTScatterTableCounters::freeScans);
 				_good = (_good + 1) & (_capacity - 1);  // wrap around w/ quick modulo
 			}
 			return entries[_good];
 		}
 
-		[[nodiscard]] size_type hash_function(const key_type& a_key) const  //
+		template <class K>
+		[[nodiscard]] size_type hash_function(const K& a_key) const  //
 			noexcept(std::is_nothrow_constructible_v<hasher>&&
-					std::is_nothrow_invocable_v<const hasher&, const key_type&>)
+					std::is_nothrow_invocable_v<const hasher&, const K&>)
 		{
 			return static_cast<size_type>(hasher()(a_key));
 		}
 
-		[[nodiscard]] bool key_eq(const key_type& a_lhs, const key_type& a_rhs) const  //
+		template <class K>
+		[[nodiscard]] bool key_eq(const key_type& a_lhs, const K& a_rhs) const  //
 			noexcept(std::is_nothrow_constructible_v<key_equal>&&
-					std::is_nothrow_invocable_v<const key_equal&, const key_type&, const key_type&>)
+					std::is_nothrow_invocable_v<const key_equal&, const key_type&, const K&>)
 		{
 			return static_cast<bool>(key_equal()(a_lhs, a_rhs));
 		}
 
+		static void record(
+			[[maybe_unused]] std::atomic<std::uint64_t> BSTScatterTableCounters::*a_counter,
+			[[maybe_unused]] std::uint64_t a_count = 1) noexcept
+		{
+#ifdef F4SE_BSTSCATTERTABLE_STATS
+			(counters().*a_counter).fetch_add(a_count, std::memory_order_relaxed);
+#endif
+		}
+
 		template <class Iter>
 		[[nodiscard]] Iter make_iterator() const noexcept
 		{
@@ -729,7 +1074,7 @@ namespace RE
 		class Key,
 		class T,
 		class Hash = BSCRC32<Key>,
-		class KeyEq = std::equal_to<Key>>
+		class KeyEq = std::equal_to<>>
 	using BSTHashMap =
 		BSTScatterTable<
 			Hash,
@@ -740,7 +1085,7 @@ namespace RE
 	template <
 		class Key,
 		class Hash = BSCRC32<Key>,
-		class KeyEq = std::equal_to<Key>>
+		class KeyEq = std::equal_to<>>
 	using BSTSet =
 		BSTScatterTable<
 			Hash,
@@ -753,7 +1098,7 @@ namespace RE
 		class T,
 		std::uint32_t N,
 		class Hash = BSCRC32<Key>,
-		class KeyEq = std::equal_to<Key>>
+		class KeyEq = std::equal_to<>>
 	using BSTStaticHashMap =
 		BSTScatterTable<
 			Hash,
@@ -765,7 +1110,7 @@ namespace RE
 		class Key,
 		class T,
 		class Hash = BSCRC32<Key>,
-		class KeyEq = std::equal_to<Key>>
+		class KeyEq = std::equal_to<>>
 	using BSTScrapHashMap =
 		BSTScatterTable<
 			Hash,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/IDs/RTTI/B.h"
+
 namespace RE
 {
 	struct BSIntrusiveRefCounted
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/BSLock.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/NetImmerse/NiObject.h"
 #include "RE/NetImmerse/NiShadeProperty.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
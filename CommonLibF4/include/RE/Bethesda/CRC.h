@@ -1,12 +1,27 @@
 #pragma once
 
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+#else
+#	include <cpuid.h>
+#endif
+
+// msvc exposes every intrinsic unconditionally, gcc and clang only within functions targeting it
+#if defined(__GNUC__) || defined(__clang__)
+#	define RE_CRC32_PCLMUL __attribute__((target("pclmul")))
+#else
+#	define RE_CRC32_PCLMUL
+#endif
+
 namespace RE
 {
 	namespace detail
 	{
-		[[nodiscard]] constexpr std::uint32_t GenerateCRC32(std::span<const std::uint8_t> a_data) noexcept
-		{
-			constexpr std::array<std::uint32_t, 256> table{
+		// the reflected IEEE polynomial, with a zero seed and no final xor
+		inline constexpr auto CRC32_TABLES = []() {
+			std::array<std::array<std::uint32_t, 256>, 8> tables{ { {
 				0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
 				0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
 				0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
@@ -39,13 +54,156 @@ namespace RE
 				0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
 				0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
 				0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-			};
+			} } };
+
+			// tables[k][i] is the crc of byte i followed by k zero bytes, which is what slicing needs
+			for (std::size_t k = 1; k < tables.size(); ++k) {
+				for (std::size_t i = 0; i < 256; ++i) {
+					const auto prev = tables[k - 1][i];
+					tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xFF];
+				}
+			}
 
-			std::uint32_t hash = 0;
+			return tables;
+		}();
+
+		// the byte at a time reference, and the only one usable in a constant expression
+		[[nodiscard]] constexpr std::uint32_t UpdateCRC32Table(std::uint32_t a_crc, std::span<const std::uint8_t> a_data) noexcept
+		{
 			for (const auto byte : a_data) {
-				hash = (hash >> 8) ^ table[(hash ^ byte) & 0xFF];
+				a_crc = (a_crc >> 8) ^ CRC32_TABLES[0][(a_crc ^ byte) & 0xFF];
+			}
+			return a_crc;
+		}
+
+		[[nodiscard]] constexpr std::uint32_t UpdateCRC32(std::uint32_t a_crc, std::uint32_t a_data) noexcept
+		{
+			const auto x = a_crc ^ a_data;
+			return CRC32_TABLES[3][x & 0xFF] ^
+			       CRC32_TABLES[2][(x >> 8) & 0xFF] ^
+			       CRC32_TABLES[1][(x >> 16) & 0xFF] ^
+			       CRC32_TABLES[0][x >> 24];
+		}
+
+		[[nodiscard]] constexpr std::uint32_t UpdateCRC32(std::uint32_t a_crc, std::uint64_t a_data) noexcept
+		{
+			const auto lo = a_crc ^ static_cast<std::uint32_t>(a_data);
+			const auto hi = static_cast<std::uint32_t>(a_data >> 32);
+			return CRC32_TABLES[7][lo & 0xFF] ^
+			       CRC32_TABLES[6][(lo >> 8) & 0xFF] ^
+			       CRC32_TABLES[5][(lo >> 16) & 0xFF] ^
+			       CRC32_TABLES[4][lo >> 24] ^
+			       CRC32_TABLES[3][hi & 0xFF] ^
+			       CRC32_TABLES[2][(hi >> 8) & 0xFF] ^
+			       CRC32_TABLES[1][(hi >> 16) & 0xFF] ^
+			       CRC32_TABLES[0][hi >> 24];
+		}
+
+		// eight bytes per step, through eight independent table lookups
+		[[nodiscard]] inline std::uint32_t UpdateCRC32Slice8(std::uint32_t a_crc, std::span<const std::uint8_t> a_data) noexcept
+		{
+			auto data = a_data.data();
+			auto size = a_data.size();
+			for (; size >= 8; data += 8, size -= 8) {
+				std::uint64_t word;
+				std::memcpy(std::addressof(word), data, sizeof(word));
+				a_crc = UpdateCRC32(a_crc, word);
+			}
+			return UpdateCRC32Table(a_crc, { data, size });
+		}
+
+		[[nodiscard]] inline bool HasPCLMUL() noexcept
+		{
+			static const bool result = []() {
+#if defined(_MSC_VER) && !defined(__clang__)
+				int regs[4];
+				__cpuid(regs, 1);
+				return (regs[2] & (1 << 1)) != 0;
+#else
+				unsigned int eax, ebx, ecx, edx;
+				return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 1)) != 0;
+#endif
+			}();
+			return result;
+		}
+
+		RE_CRC32_PCLMUL [[nodiscard]] inline __m128i FoldCRC32(__m128i a_acc, __m128i a_k, __m128i a_next) noexcept
+		{
+			const auto lo = _mm_clmulepi64_si128(a_acc, a_k, 0x00);
+			const auto hi = _mm_clmulepi64_si128(a_acc, a_k, 0x11);
+			return _mm_xor_si128(_mm_xor_si128(hi, lo), a_next);
+		}
+
+		// folds 64 bytes per step with carry-less multiplies, then reduces the 128 bit remainder down to
+		// 32 bits. the constants are the bit-reflected ones from Intel's "Fast CRC Computation for
+		// Generic Polynomials Using PCLMULQDQ Instruction", so a_data must be at least 64 bytes long
+		RE_CRC32_PCLMUL [[nodiscard]] inline std::uint32_t UpdateCRC32PCLMUL(std::uint32_t a_crc, std::span<const std::uint8_t> a_data) noexcept
+		{
+			assert(a_data.size() >= 64);
+
+			const auto k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+			const auto k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+			const auto k5k0 = _mm_set_epi64x(0x0000000000, 0x0163CD6124);
+			const auto poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+			const auto mask = _mm_setr_epi32(-1, 0, -1, 0);
+
+			const auto load = [](const std::uint8_t* a_ptr) noexcept {
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_ptr));
+			};
+
+			auto data = a_data.data();
+			auto size = a_data.size();
+
+			auto x1 = _mm_xor_si128(load(data + 0x00), _mm_cvtsi32_si128(static_cast<int>(a_crc)));
+			auto x2 = load(data + 0x10);
+			auto x3 = load(data + 0x20);
+			auto x4 = load(data + 0x30);
+			data += 64;
+			size -= 64;
+
+			for (; size >= 64; data += 64, size -= 64) {
+				x1 = FoldCRC32(x1, k1k2, load(data + 0x00));
+				x2 = FoldCRC32(x2, k1k2, load(data + 0x10));
+				x3 = FoldCRC32(x3, k1k2, load(data + 0x20));
+				x4 = FoldCRC32(x4, k1k2, load(data + 0x30));
+			}
+
+			x1 = FoldCRC32(x1, k3k4, x2);
+			x1 = FoldCRC32(x1, k3k4, x3);
+			x1 = FoldCRC32(x1, k3k4, x4);
+			for (; size >= 16; data += 16, size -= 16) {
+				x1 = FoldCRC32(x1, k3k4, load(data));
+			}
+
+			// 128 -> 64 bits
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k3k4, 0x10));
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 4), _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5k0, 0x00));
+
+			// barrett reduction, 64 -> 32 bits
+			x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+			x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+			x1 = _mm_xor_si128(x1, x2);
+
+			const auto crc = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+			return UpdateCRC32Slice8(crc, { data, size });
+		}
+
+		[[nodiscard]] inline std::uint32_t UpdateCRC32Runtime(std::uint32_t a_crc, std::span<const std::uint8_t> a_data) noexcept
+		{
+			if (a_data.size() >= 64 && HasPCLMUL()) {
+				return UpdateCRC32PCLMUL(a_crc, a_data);
+			} else {
+				return UpdateCRC32Slice8(a_crc, a_data);
+			}
+		}
+
+		[[nodiscard]] constexpr std::uint32_t GenerateCRC32(std::span<const std::uint8_t> a_data) noexcept
+		{
+			if (std::is_constant_evaluated()) {
+				return UpdateCRC32Table(0, a_data);
+			} else {
+				return UpdateCRC32Runtime(0, a_data);
 			}
-			return hash;
 		}
 
 		template <class, bool>
@@ -72,7 +230,13 @@ namespace RE
 	public:
 		[[nodiscard]] std::uint32_t operator()(Key a_data) const noexcept
 		{
-			return detail::GenerateCRC32({ reinterpret_cast<const std::uint8_t*>(std::addressof(a_data)), sizeof(Key) });
+			if constexpr (sizeof(Key) == sizeof(std::uint32_t)) {
+				return detail::UpdateCRC32(0, stl::unrestricted_cast<std::uint32_t>(a_data));
+			} else if constexpr (sizeof(Key) == sizeof(std::uint64_t)) {
+				return detail::UpdateCRC32(0, stl::unrestricted_cast<std::uint64_t>(a_data));
+			} else {
+				return detail::GenerateCRC32({ reinterpret_cast<const std::uint8_t*>(std::addressof(a_data)), sizeof(Key) });
+			}
 		}
 	};
 
@@ -86,16 +250,24 @@ namespace RE
 		}
 	};
 
+	// strings hash by their contents, so any of the string types can probe a table of another
 	template <class CharT>
 	struct BSCRC32<std::basic_string_view<CharT>>
 	{
 	public:
+		using is_transparent = void;
+
 		[[nodiscard]] std::uint32_t operator()(std::basic_string_view<CharT> a_data) const noexcept
 		{
-			return detail::GenerateCRC32({ a_data.data(), a_data.length() });
+			return detail::GenerateCRC32({ reinterpret_cast<const std::uint8_t*>(a_data.data()), a_data.length() * sizeof(CharT) });
 		}
 	};
 
+	template <class CharT, class Allocator>
+	struct BSCRC32<std::basic_string<CharT, std::char_traits<CharT>, Allocator>> :
+		public BSCRC32<std::basic_string_view<CharT>>
+	{};
+
 	extern template struct BSCRC32<std::int8_t>;
 	extern template struct BSCRC32<std::uint8_t>;
 	extern template struct BSCRC32<std::int16_t>;
@@ -105,3 +277,5 @@ namespace RE
 	extern template struct BSCRC32<std::int64_t>;
 	extern template struct BSCRC32<std::uint64_t>;
 }
+
+#undef RE_CRC32_PCLMUL
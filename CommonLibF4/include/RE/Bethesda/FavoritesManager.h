@@ -5,6 +5,8 @@
 #include "RE/Bethesda/BSTEvent.h"
 #include "RE/Bethesda/BSTHashMap.h"
 #include "RE/Bethesda/BSTSingleton.h"
+#include "RE/IDs/RTTI/F.h"
+#include "RE/IDs/VTABLE/F.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 
 namespace RE
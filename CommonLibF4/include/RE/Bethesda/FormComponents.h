@@ -8,6 +8,14 @@
 #include "RE/Bethesda/BSTSmartPointer.h"
 #include "RE/Bethesda/BSTTuple.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/A.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/A.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiRefObject.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/VTABLE/I.h"
 
 namespace RE
 {
@@ -0,0 +1,344 @@
+#pragma once
+
+#ifndef F4SE_TEST_SUITE
+#	include "RE/Bethesda/BSTArray.h"
+#	include "RE/Bethesda/BSTHashMap.h"
+#	include "RE/Bethesda/MemoryManager.h"
+#endif
+
+namespace RE
+{
+	// a bump allocator for data that lives no longer than a frame. each thread draws from an arena of
+	// its own, which carves allocations out of chunks taken from the game heap. nothing is freed one
+	// by one: NextFrame rewinds every arena at once, and the chunks are reused from then on. this is
+	// plugin-side machinery with no engine counterpart
+	class FrameArena
+	{
+	public:
+		static constexpr std::size_t CHUNK_SIZE = 1u << 16;
+
+		FrameArena() noexcept = default;
+		FrameArena(const FrameArena&) = delete;
+		FrameArena(FrameArena&&) = delete;
+
+		~FrameArena() noexcept { release(); }
+
+		FrameArena& operator=(const FrameArena&) = delete;
+		FrameArena& operator=(FrameArena&&) = delete;
+
+		[[nodiscard]] static FrameArena& GetThreadArena() noexcept
+		{
+			thread_local FrameArena arena;
+			return arena;
+		}
+
+		// every arena starts over the next time its thread touches it. call this at a frame boundary,
+		// once nothing drawn from an arena during the frame is still in use
+		static void NextFrame() noexcept { _frame.fetch_add(1, std::memory_order_release); }
+
+		[[nodiscard]] static std::uint32_t CurrentFrame() noexcept { return _frame.load(std::memory_order_acquire); }
+
+		[[nodiscard]] void* allocate(std::size_t a_bytes, std::size_t a_alignment)
+		{
+			assert(std::has_single_bit(a_alignment));
+			sync();
+
+			auto mem = align(_cursor, a_alignment);
+			if (!mem || mem + a_bytes > _limit) {
+				next_chunk(a_bytes + a_alignment - 1);
+				mem = align(_cursor, a_alignment);
+			}
+
+			_last = mem;
+			_cursor = mem + a_bytes;
+			return mem;
+		}
+
+		// the most recent allocation grows or shrinks where it lies while its chunk has room, anything
+		// else is copied into a new allocation
+		[[nodiscard]] void* reallocate(void* a_ptr, std::size_t a_oldBytes, std::size_t a_newBytes, std::size_t a_alignment)
+		{
+			sync();
+			if (!a_ptr) {
+				return allocate(a_newBytes, a_alignment);
+			}
+
+			const auto mem = static_cast<std::byte*>(a_ptr);
+			if (mem == _last && mem + a_newBytes <= _limit) {
+				_cursor = mem + a_newBytes;
+				return mem;
+			}
+
+			const auto result = allocate(a_newBytes, a_alignment);
+			std::memcpy(result, a_ptr, std::min(a_oldBytes, a_newBytes));
+			return result;
+		}
+
+		// only the most recent allocation hands its bytes back, the rest wait for the next frame
+		void deallocate(void* a_ptr) noexcept
+		{
+			sync();
+			if (a_ptr && a_ptr == _last) {
+				_cursor = _last;
+				_last = nullptr;
+			}
+		}
+
+		// rewinds this arena alone, keeping its chunks
+		void reset() noexcept
+		{
+			_current = _head;
+			_cursor = _head ? _head->begin() : nullptr;
+			_limit = _head ? _head->end() : nullptr;
+			_last = nullptr;
+		}
+
+		// returns every chunk to the heap
+		void release() noexcept
+		{
+			while (_head) {
+				free(std::exchange(_head, _head->next));
+			}
+			_current = nullptr;
+			_cursor = nullptr;
+			_limit = nullptr;
+			_last = nullptr;
+			_reserved = 0;
+		}
+
+		// bytes held by this arena's chunks
+		[[nodiscard]] std::size_t reserved() const noexcept { return _reserved; }
+
+	private:
+		struct Chunk
+		{
+		public:
+			[[nodiscard]] std::byte* begin() noexcept { return reinterpret_cast<std::byte*>(this + 1); }
+			[[nodiscard]] std::byte* end() noexcept { return begin() + size; }
+
+			// members
+			Chunk* next{ nullptr };  // 00
+			std::size_t size{ 0 };   // 08
+		};
+		static_assert(sizeof(Chunk) % 0x10 == 0);
+
+		[[nodiscard]] static std::byte* align(std::byte* a_ptr, std::size_t a_alignment) noexcept
+		{
+			const auto address = reinterpret_cast<std::uintptr_t>(a_ptr);
+			return reinterpret_cast<std::byte*>((address + a_alignment - 1) & ~(a_alignment - 1));
+		}
+
+		void sync() noexcept
+		{
+			if (const auto frame = CurrentFrame(); frame != _seen) {
+				_seen = frame;
+				reset();
+			}
+		}
+
+		// moves on to the next chunk that fits a_bytes, reusing ones from earlier frames before taking
+		// a new one, which is linked in after the current chunk
+		void next_chunk(std::size_t a_bytes)
+		{
+			const auto next = _current ? _current->next : _head;
+			auto chunk = next;
+			if (!chunk || chunk->size < a_bytes) {
+				const auto size = std::max(a_bytes, CHUNK_SIZE);
+				const auto mem = malloc(sizeof(Chunk) + size);
+				if (!mem) {
+					stl::report_and_fail("failed to handle allocation request"sv);
+				}
+
+				chunk = std::construct_at(static_cast<Chunk*>(mem));
+				chunk->next = next;
+				chunk->size = size;
+				_reserved += size;
+				if (_current) {
+					_current->next = chunk;
+				} else {
+					_head = chunk;
+				}
+			}
+
+			_current = chunk;
+			_cursor = chunk->begin();
+			_limit = chunk->end();
+		}
+
+		// members
+		Chunk* _head{ nullptr };
+		Chunk* _current{ nullptr };
+		std::byte* _cursor{ nullptr };
+		std::byte* _limit{ nullptr };
+		std::byte* _last{ nullptr };
+		std::size_t _reserved{ 0 };
+		std::uint32_t _seen{ CurrentFrame() };
+
+		static inline std::atomic<std::uint32_t> _frame{ 0 };
+	};
+
+	// lets BSTArray draw from the thread's frame arena. the array must be gone by the next frame, and
+	// must stay on the thread that first grew it
+	class FrameArenaAllocator
+	{
+	public:
+		using size_type = std::uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+
+		FrameArenaAllocator() noexcept = default;
+		FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+
+		FrameArenaAllocator(FrameArenaAllocator&& a_rhs) noexcept :
+			_arena{ std::exchange(a_rhs._arena, nullptr) },
+			_data{ std::exchange(a_rhs._data, nullptr) },
+			_capacity{ std::exchange(a_rhs._capacity, 0) },
+			_bytes{ std::exchange(a_rhs._bytes, 0) }
+		{}
+
+		~FrameArenaAllocator() noexcept = default;
+
+		FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+
+		FrameArenaAllocator& operator=(FrameArenaAllocator&& a_rhs) noexcept
+		{
+			if (this != std::addressof(a_rhs)) {
+				_arena = std::exchange(a_rhs._arena, nullptr);
+				_data = std::exchange(a_rhs._data, nullptr);
+				_capacity = std::exchange(a_rhs._capacity, 0);
+				_bytes = std::exchange(a_rhs._bytes, 0);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] void* allocate(std::uint32_t a_bytes) { return arena().allocate(a_bytes, ALIGNMENT); }
+
+		[[nodiscard]] void* reallocate(void* a_ptr, std::uint32_t a_bytes)
+		{
+			return arena().reallocate(a_ptr, _bytes, a_bytes, ALIGNMENT);
+		}
+
+		void deallocate(void* a_ptr)
+		{
+			if (a_ptr) {
+				arena().deallocate(a_ptr);
+			}
+		}
+
+		[[nodiscard]] void* data() noexcept { return _data; }
+		[[nodiscard]] const void* data() const noexcept { return _data; }
+		void set_data(void* a_data) noexcept { _data = a_data; }
+
+		[[nodiscard]] size_type capacity() const noexcept { return _capacity; }
+
+		void set_capacity(size_type a_capacity, size_type a_bytes) noexcept
+		{
+			_capacity = a_capacity;
+			_bytes = a_bytes;
+		}
+
+	private:
+		static constexpr std::size_t ALIGNMENT = 0x10;
+
+		[[nodiscard]] FrameArena& arena() noexcept
+		{
+			if (!_arena) {
+				_arena = std::addressof(FrameArena::GetThreadArena());
+			}
+			return *_arena;
+		}
+
+		// members
+		FrameArena* _arena{ nullptr };  // 00
+		void* _data{ nullptr };         // 08
+		size_type _capacity{ 0 };       // 10
+		size_type _bytes{ 0 };          // 14
+	};
+
+	// the same, for BSTScatterTable, so hash maps built during a frame share the arena with its arrays
+	template <std::size_t S, std::size_t A>
+	class FrameArenaScatterTableAllocator
+	{
+	public:
+		using size_type = std::uint32_t;
+		using propagate_on_container_move_assignment = std::true_type;
+
+		FrameArenaScatterTableAllocator() = default;
+		FrameArenaScatterTableAllocator(const FrameArenaScatterTableAllocator&) = delete;
+
+		FrameArenaScatterTableAllocator(FrameArenaScatterTableAllocator&& a_rhs) noexcept :
+			_arena(std::exchange(a_rhs._arena, nullptr)),
+			_entries(std::exchange(a_rhs._entries, nullptr))
+		{}
+
+		~FrameArenaScatterTableAllocator() = default;
+		FrameArenaScatterTableAllocator& operator=(const FrameArenaScatterTableAllocator&) = delete;
+
+		FrameArenaScatterTableAllocator& operator=(FrameArenaScatterTableAllocator&& a_rhs) noexcept
+		{
+			if (this != std::addressof(a_rhs)) {
+				assert(_entries == nullptr);
+				_arena = std::exchange(a_rhs._arena, nullptr);
+				_entries = std::exchange(a_rhs._entries, nullptr);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] static constexpr size_type min_size() noexcept { return 1u << 3; }
+
+		[[nodiscard]] void* allocate_bytes(std::size_t a_bytes)
+		{
+			assert(a_bytes % S == 0);
+			return arena().allocate(a_bytes, std::max<std::size_t>(A, 0x10));
+		}
+
+		void deallocate_bytes(void* a_ptr)
+		{
+			if (a_ptr) {
+				arena().deallocate(a_ptr);
+			}
+		}
+
+		[[nodiscard]] void* get_entries() const noexcept { return _entries; }
+		void set_entries(void* a_entries) noexcept { _entries = static_cast<std::byte*>(a_entries); }
+
+	private:
+		[[nodiscard]] FrameArena& arena() noexcept
+		{
+			if (!_arena) {
+				_arena = std::addressof(FrameArena::GetThreadArena());
+			}
+			return *_arena;
+		}
+
+		// members
+		FrameArena* _arena{ nullptr };   // 00
+		std::byte* _entries{ nullptr };  // 08
+	};
+
+	template <class T>
+	using FrameArenaArray = BSTArray<T, FrameArenaAllocator>;
+
+	template <
+		class Key,
+		class T,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<>>
+	using FrameArenaHashMap =
+		BSTScatterTable<
+			Hash,
+			KeyEq,
+			BSTScatterTableTraits<Key, T>,
+			FrameArenaScatterTableAllocator>;
+
+	template <
+		class Key,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<>>
+	using FrameArenaSet =
+		BSTScatterTable<
+			Hash,
+			KeyEq,
+			BSTSetTraits<Key>,
+			FrameArenaScatterTableAllocator>;
+}
@@ -13,6 +13,8 @@
 #include "RE/Bethesda/BSTTuple.h"
 #include "RE/Bethesda/BSTimer.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/G.h"
+#include "RE/IDs/VTABLE/G.h"
 
 namespace RE
 {
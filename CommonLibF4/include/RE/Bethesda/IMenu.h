@@ -20,6 +20,18 @@
 #include "RE/Bethesda/UIMessage.h"
 #include "RE/Bethesda/UIShaderFXInfo.h"
 #include "RE/Bethesda/UserEvents.h"
+#include "RE/IDs/RTTI/C.h"
+#include "RE/IDs/RTTI/F.h"
+#include "RE/IDs/RTTI/G.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/P.h"
+#include "RE/IDs/RTTI/W.h"
+#include "RE/IDs/VTABLE/C.h"
+#include "RE/IDs/VTABLE/F.h"
+#include "RE/IDs/VTABLE/G.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/P.h"
+#include "RE/IDs/VTABLE/W.h"
 #include "RE/NetImmerse/NiMatrix3.h"
 #include "RE/NetImmerse/NiPoint2.h"
 #include "RE/NetImmerse/NiPoint3.h"
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/BSTSmartPointer.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/VTABLE/I.h"
 #include "RE/NetImmerse/NiPoint3.h"
 
 namespace RE
@@ -2,6 +2,20 @@
 
 #include "RE/Bethesda/BSFixedString.h"
 #include "RE/Bethesda/InputDevice.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/C.h"
+#include "RE/IDs/RTTI/D.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/K.h"
+#include "RE/IDs/RTTI/M.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/C.h"
+#include "RE/IDs/VTABLE/D.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/K.h"
+#include "RE/IDs/VTABLE/M.h"
+#include "RE/IDs/VTABLE/T.h"
 
 namespace RE
 {
@@ -6,6 +6,8 @@
 #include "RE/Bethesda/BSTArray.h"
 #include "RE/Bethesda/BSTHashMap.h"
 #include "RE/Bethesda/BSTSmartPointer.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/VTABLE/I.h"
 #include "RE/NetImmerse/NiMatrix3.h"
 #include "RE/NetImmerse/NiPoint2.h"
 #include "RE/NetImmerse/NiPoint3.h"
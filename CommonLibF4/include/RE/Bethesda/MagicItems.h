@@ -6,6 +6,16 @@
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESBoundObjects.h"
 #include "RE/Bethesda/TESCondition.h"
+#include "RE/IDs/RTTI/A.h"
+#include "RE/IDs/RTTI/E.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/M.h"
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/A.h"
+#include "RE/IDs/VTABLE/E.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/M.h"
+#include "RE/IDs/VTABLE/S.h"
 
 namespace RE
 {
@@ -1,5 +1,26 @@
 #pragma once
 
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/S.h"
+
+#ifdef F4SE_ALLOCATION_PROFILER
+#	include "RE/Bethesda/AllocationProfiler.h"
+
+#	include <intrin.h>
+
+// attributes each sample to the code that called into the allocator. _ReturnAddress() only names that
+// call site while the wrapper it expands in is a frame of its own: inlined, it would name the caller's
+// caller. so the wrappers are kept out of line while profiling
+#	define F4SE_RECORD_ALLOCATION(a_kind, a_size, a_alignment) \
+		RE::AllocationProfiler::Record(RE::AllocationProfiler::Kind::a_kind, a_size, a_alignment, _ReturnAddress())
+#	define F4SE_ALLOCATOR_INLINE __declspec(noinline) inline
+#else
+#	define F4SE_RECORD_ALLOCATION(a_kind, a_size, a_alignment) static_cast<void>(0)
+#	define F4SE_ALLOCATOR_INLINE inline
+#endif
+
 namespace RE
 {
 	namespace CompactingStore
@@ -124,14 +145,14 @@ namespace RE
 		void* Allocate(std::size_t a_size, std::size_t a_alignment)
 		{
 			using func_t = decltype(&ScrapHeap::Allocate);
-			REL::Relocation<func_t> func{ REL::ID(1085394) };
+			static REL::Relocation<func_t> func{ REL::ID(1085394) };
 			return func(this, a_size, a_alignment);
 		}
 
 		void Deallocate(void* a_mem)
 		{
 			using func_t = decltype(&ScrapHeap::Deallocate);
-			REL::Relocation<func_t> func{ REL::ID(923307) };
+			static REL::Relocation<func_t> func{ REL::ID(923307) };
 			return func(this, a_mem);
 		}
 
@@ -171,14 +192,14 @@ namespace RE
 			AutoScrapBuffer* Ctor()
 			{
 				using func_t = decltype(&AutoScrapBuffer::Ctor);
-				REL::Relocation<func_t> func{ REL::ID(1571567) };
+				static REL::Relocation<func_t> func{ REL::ID(1571567) };
 				return func(this);
 			}
 
 			void Dtor()
 			{
 				using func_t = decltype(&AutoScrapBuffer::Dtor);
-				REL::Relocation<func_t> func{ REL::ID(68625) };
+				static REL::Relocation<func_t> func{ REL::ID(68625) };
 				return func(this);
 			}
 		};
@@ -197,42 +218,42 @@ namespace RE
 		[[nodiscard]] static MemoryManager& GetSingleton()
 		{
 			using func_t = decltype(&MemoryManager::GetSingleton);
-			const REL::Relocation<func_t> func{ REL::ID(343176) };
+			static REL::Relocation<func_t> func{ REL::ID(343176) };
 			return func();
 		}
 
 		[[nodiscard]] void* Allocate(std::size_t a_size, std::uint32_t a_alignment, bool a_alignmentRequired)
 		{
 			using func_t = decltype(&MemoryManager::Allocate);
-			const REL::Relocation<func_t> func{ REL::ID(652767) };
+			static REL::Relocation<func_t> func{ REL::ID(652767) };
 			return func(this, a_size, a_alignment, a_alignmentRequired);
 		}
 
 		void Deallocate(void* a_mem, bool a_alignmentRequired)
 		{
 			using func_t = decltype(&MemoryManager::Deallocate);
-			const REL::Relocation<func_t> func{ REL::ID(1582181) };
+			static REL::Relocation<func_t> func{ REL::ID(1582181) };
 			return func(this, a_mem, a_alignmentRequired);
 		}
 
 		[[nodiscard]] ScrapHeap* GetThreadScrapHeap()
 		{
 			using func_t = decltype(&MemoryManager::GetThreadScrapHeap);
-			const REL::Relocation<func_t> func{ REL::ID(1495205) };
+			static REL::Relocation<func_t> func{ REL::ID(1495205) };
 			return func(this);
 		}
 
 		[[nodiscard]] void* Reallocate(void* a_oldMem, std::size_t a_newSize, std::uint32_t a_alignment, bool a_alignmentRequired)
 		{
 			using func_t = decltype(&MemoryManager::Reallocate);
-			const REL::Relocation<func_t> func{ REL::ID(1502917) };
+			static REL::Relocation<func_t> func{ REL::ID(1502917) };
 			return func(this, a_oldMem, a_newSize, a_alignment, a_alignmentRequired);
 		}
 
 		void RegisterMemoryManager()
 		{
 			using func_t = decltype(&MemoryManager::RegisterMemoryManager);
-			const REL::Relocation<func_t> func{ REL::ID(453212) };
+			static REL::Relocation<func_t> func{ REL::ID(453212) };
 			return func(this);
 		}
 
@@ -263,8 +284,9 @@ namespace RE
 	};
 	static_assert(sizeof(MemoryManager) == 0x480);
 
-	[[nodiscard]] inline void* malloc(std::size_t a_size)
+	[[nodiscard]] F4SE_ALLOCATOR_INLINE void* malloc(std::size_t a_size)
 	{
+		F4SE_RECORD_ALLOCATION(kMalloc, a_size, 0);
 		auto& mem = MemoryManager::GetSingleton();
 		return mem.Allocate(a_size, 0, false);
 	}
@@ -275,8 +297,9 @@ namespace RE
 		return static_cast<T*>(malloc(sizeof(T)));
 	}
 
-	[[nodiscard]] inline void* aligned_alloc(std::size_t a_alignment, std::size_t a_size)
+	[[nodiscard]] F4SE_ALLOCATOR_INLINE void* aligned_alloc(std::size_t a_alignment, std::size_t a_size)
 	{
+		F4SE_RECORD_ALLOCATION(kAlignedAlloc, a_size, a_alignment);
 		auto& mem = MemoryManager::GetSingleton();
 		return mem.Allocate(a_size, static_cast<std::uint32_t>(a_alignment), true);
 	}
@@ -287,9 +310,11 @@ namespace RE
 		return static_cast<T*>(aligned_alloc(alignof(T), sizeof(T)));
 	}
 
-	[[nodiscard]] inline void* calloc(std::size_t a_num, std::size_t a_size)
+	[[nodiscard]] F4SE_ALLOCATOR_INLINE void* calloc(std::size_t a_num, std::size_t a_size)
 	{
-		const auto ret = malloc(a_num * a_size);
+		F4SE_RECORD_ALLOCATION(kCalloc, a_num * a_size, 0);
+		auto& mem = MemoryManager::GetSingleton();
+		const auto ret = mem.Allocate(a_num * a_size, 0, false);
 		if (ret) {
 			std::memset(ret, 0, a_num * a_size);
 		}
@@ -302,26 +327,30 @@ namespace RE
 		return static_cast<T*>(calloc(a_num, sizeof(T)));
 	}
 
-	[[nodiscard]] inline void* realloc(void* a_ptr, std::size_t a_newSize)
+	[[nodiscard]] F4SE_ALLOCATOR_INLINE void* realloc(void* a_ptr, std::size_t a_newSize)
 	{
+		F4SE_RECORD_ALLOCATION(kRealloc, a_newSize, 0);
 		auto& mem = MemoryManager::GetSingleton();
 		return mem.Reallocate(a_ptr, a_newSize, 0, false);
 	}
 
-	[[nodiscard]] inline void* aligned_realloc(void* a_ptr, std::size_t a_alignment, std::size_t a_newSize)
+	[[nodiscard]] F4SE_ALLOCATOR_INLINE void* aligned_realloc(void* a_ptr, std::size_t a_alignment, std::size_t a_newSize)
 	{
+		F4SE_RECORD_ALLOCATION(kAlignedRealloc, a_newSize, a_alignment);
 		auto& mem = MemoryManager::GetSingleton();
 		return mem.Reallocate(a_ptr, a_newSize, static_cast<std::uint32_t>(a_alignment), true);
 	}
 
-	inline void free(void* a_ptr)
+	F4SE_ALLOCATOR_INLINE void free(void* a_ptr)
 	{
+		F4SE_RECORD_ALLOCATION(kFree, 0, 0);
 		auto& mem = MemoryManager::GetSingleton();
 		return mem.Deallocate(a_ptr, false);
 	}
 
-	inline void aligned_free(void* a_ptr)
+	F4SE_ALLOCATOR_INLINE void aligned_free(void* a_ptr)
 	{
+		F4SE_RECORD_ALLOCATION(kAlignedFree, 0, 0);
 		auto& mem = MemoryManager::GetSingleton();
 		return mem.Deallocate(a_ptr, true);
 	}
@@ -2,6 +2,8 @@
 
 #include "RE/Bethesda/BSInputEventSingleUser.h"
 #include "RE/Bethesda/BSTSingleton.h"
+#include "RE/IDs/RTTI/M.h"
+#include "RE/IDs/VTABLE/M.h"
 
 namespace RE
 {
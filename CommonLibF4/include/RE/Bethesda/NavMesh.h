@@ -5,6 +5,10 @@
 #include "RE/Bethesda/BSTSmartPointer.h"
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/N.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 
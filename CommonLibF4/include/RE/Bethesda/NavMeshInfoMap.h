@@ -5,6 +5,11 @@
 #include "RE/Bethesda/BSTHashMap.h"
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/RTTI/P.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/N.h"
 
 namespace RE
 {
@@ -9,6 +9,8 @@
 #include "RE/Bethesda/BSTPoint.h"
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/Inventory3DManager.h"
+#include "RE/IDs/RTTI/P.h"
+#include "RE/IDs/VTABLE/P.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 
 namespace RE
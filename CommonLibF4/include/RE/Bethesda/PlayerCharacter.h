@@ -14,6 +14,8 @@
 #include "RE/Bethesda/BSTTuple.h"
 #include "RE/Bethesda/IMovementInterface.h"
 #include "RE/Havok/hkRefPtr.h"
+#include "RE/IDs/RTTI/P.h"
+#include "RE/IDs/VTABLE/P.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 #include "RE/NetImmerse/NiTMap.h"
@@ -8,6 +8,10 @@
 #include "RE/Bethesda/BSTEvent.h"
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/IMovementInterface.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/RTTI/P.h"
+#include "RE/IDs/VTABLE/H.h"
+#include "RE/IDs/VTABLE/P.h"
 #include "RE/NetImmerse/NiPoint2.h"
 #include "RE/NetImmerse/NiPoint3.h"
 
@@ -6,6 +6,20 @@
 #include "RE/Bethesda/BSTEvent.h"
 #include "RE/Bethesda/CELLJobs.h"
 #include "RE/Bethesda/TESObjectREFRs.h"
+#include "RE/IDs/RTTI/A.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/C.h"
+#include "RE/IDs/RTTI/F.h"
+#include "RE/IDs/RTTI/G.h"
+#include "RE/IDs/RTTI/M.h"
+#include "RE/IDs/RTTI/P.h"
+#include "RE/IDs/VTABLE/A.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/C.h"
+#include "RE/IDs/VTABLE/F.h"
+#include "RE/IDs/VTABLE/G.h"
+#include "RE/IDs/VTABLE/M.h"
+#include "RE/IDs/VTABLE/P.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 #include "RE/NetImmerse/NiTransform.h"
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/S.h"
 #include "RE/Scaleform/GFx/GFx_Player.h"
 
 namespace RE
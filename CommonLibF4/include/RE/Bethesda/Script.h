@@ -4,6 +4,8 @@
 #include "RE/Bethesda/BSTList.h"
 #include "RE/Bethesda/MemoryManager.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/T.h"
 
 namespace RE
 {
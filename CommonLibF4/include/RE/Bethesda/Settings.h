@@ -4,6 +4,12 @@
 #include "RE/Bethesda/BSTBTree.h"
 #include "RE/Bethesda/BSTList.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/G.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/G.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/S.h"
 
 namespace RE
 {
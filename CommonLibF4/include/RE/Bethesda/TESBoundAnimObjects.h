@@ -8,6 +8,10 @@
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESBoundObjects.h"
 #include "RE/Bethesda/TESCondition.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiColor.h"
 #include "RE/NetImmerse/NiPoint3.h"
 
@@ -9,6 +9,8 @@
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/BSTSmartPointer.h"
 #include "RE/Havok/hkRefPtr.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiPoint2.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiQuaternion.h"
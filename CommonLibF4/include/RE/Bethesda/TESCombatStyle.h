@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/T.h"
 
 namespace RE
 {
@@ -5,6 +5,8 @@
 #include "RE/Bethesda/BSTHashMap.h"
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/T.h"
 
 namespace RE
 {
@@ -16,6 +16,12 @@
 #include "RE/Bethesda/Movement.h"
 #include "RE/Bethesda/Settings.h"
 #include "RE/Bethesda/TESCondition.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/E.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/E.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiColor.h"
 #include "RE/NetImmerse/NiFlags.h"
 #include "RE/NetImmerse/NiPoint2.h"
@@ -11,6 +11,16 @@
 #include "RE/Bethesda/TESForms.h"
 #include "RE/Havok/hknpBodyId.h"
 #include "RE/Havok/hknpClosestUniqueBodyIdHitCollector.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/E.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/E.h"
+#include "RE/IDs/VTABLE/H.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiRefObject.h"
 
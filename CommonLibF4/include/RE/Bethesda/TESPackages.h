@@ -5,6 +5,16 @@
 #include "RE/Bethesda/BSTList.h"
 #include "RE/Bethesda/TESCondition.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/A.h"
+#include "RE/IDs/RTTI/D.h"
+#include "RE/IDs/RTTI/F.h"
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/A.h"
+#include "RE/IDs/VTABLE/D.h"
+#include "RE/IDs/VTABLE/F.h"
+#include "RE/IDs/VTABLE/S.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 
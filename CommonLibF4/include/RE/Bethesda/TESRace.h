@@ -9,6 +9,8 @@
 #include "RE/Bethesda/Movement.h"
 #include "RE/Bethesda/TESCondition.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiPoint3.h"
 
 namespace RE
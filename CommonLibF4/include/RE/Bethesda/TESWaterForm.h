@@ -2,6 +2,8 @@
 
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/TESForms.h"
+#include "RE/IDs/RTTI/T.h"
+#include "RE/IDs/VTABLE/T.h"
 #include "RE/NetImmerse/NiColor.h"
 #include "RE/NetImmerse/NiPoint3.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
@@ -10,6 +10,8 @@
 #include "RE/Bethesda/BSTSingleton.h"
 #include "RE/Bethesda/BSTimer.h"
 #include "RE/Bethesda/IMenu.h"
+#include "RE/IDs/RTTI/U.h"
+#include "RE/IDs/VTABLE/U.h"
 #include "RE/Scaleform/GFx/GFx_Player.h"
 
 namespace RE
@@ -3,6 +3,12 @@
 #include "RE/Bethesda/BSFixedString.h"
 #include "RE/Bethesda/BSStringT.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/RTTI/I.h"
+#include "RE/IDs/RTTI/U.h"
+#include "RE/IDs/VTABLE/B.h"
+#include "RE/IDs/VTABLE/I.h"
+#include "RE/IDs/VTABLE/U.h"
 
 namespace RE
 {
@@ -3,6 +3,8 @@
 #include "RE/Bethesda/BSExtraData.h"
 #include "RE/Bethesda/BSTArray.h"
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/W.h"
+#include "RE/IDs/VTABLE/W.h"
 #include "RE/NetImmerse/NiPoint3.h"
 
 namespace RE
@@ -11,6 +11,8 @@
 #include "RE/Havok/hknpCharacterContext.h"
 #include "RE/Havok/hknpCharacterState.h"
 #include "RE/Havok/hknpCharacterSurfaceInfo.h"
+#include "RE/IDs/RTTI/B.h"
+#include "RE/IDs/VTABLE/B.h"
 #include "RE/NetImmerse/NiCollisionObject.h"
 #include "RE/NetImmerse/NiFlags.h"
 #include "RE/NetImmerse/NiPoint3.h"
@@ -5,6 +5,7 @@
 #include "RE/Bethesda/AITimeStamp.h"
 #include "RE/Bethesda/Actor.h"
 #include "RE/Bethesda/ActorValueInfo.h"
+#include "RE/Bethesda/AllocationProfiler.h"
 #include "RE/Bethesda/Archive2.h"
 #include "RE/Bethesda/Atomic.h"
 #include "RE/Bethesda/BGSBaseAliases.h"
@@ -51,6 +52,7 @@
 #include "RE/Bethesda/BSTArray.h"
 #include "RE/Bethesda/BSTBTree.h"
 #include "RE/Bethesda/BSTEvent.h"
+#include "RE/Bethesda/BSTFlatHashMap.h"
 #include "RE/Bethesda/BSTFreeList.h"
 #include "RE/Bethesda/BSTHashMap.h"
 #include "RE/Bethesda/BSTInterpolator.h"
@@ -76,6 +78,7 @@
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/FormFactory.h"
 #include "RE/Bethesda/FormUtil.h"
+#include "RE/Bethesda/FrameArena.h"
 #include "RE/Bethesda/GameScript.h"
 #include "RE/Bethesda/IMenu.h"
 #include "RE/Bethesda/IMovementInterface.h"
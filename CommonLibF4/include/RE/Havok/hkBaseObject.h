@@ -1,5 +1,8 @@
 #pragma once
 
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
+
 namespace RE
 {
 	class __declspec(novtable) hkBaseObject
@@ -2,6 +2,8 @@
 
 #include "RE/Havok/hkBaseTypes.h"
 #include "RE/Havok/hkMemoryRouter.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Havok/hkBaseObject.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
@@ -3,6 +3,8 @@
 #include "RE/Havok/hkArray.h"
 #include "RE/Havok/hknpCollisionQueryCollector.h"
 #include "RE/Havok/hknpCollisionResult.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
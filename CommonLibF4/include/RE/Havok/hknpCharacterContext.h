@@ -4,6 +4,8 @@
 #include "RE/Havok/hkReferencedObject.h"
 #include "RE/Havok/hkVector4.h"
 #include "RE/Havok/hknpCharacterState.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
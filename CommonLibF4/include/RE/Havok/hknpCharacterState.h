@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Havok/hkReferencedObject.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
@@ -2,6 +2,8 @@
 
 #include "RE/Havok/hkVector4.h"
 #include "RE/Havok/hknpUniqueBodyIdHitCollector.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
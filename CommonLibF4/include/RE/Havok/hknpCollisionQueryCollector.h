@@ -2,6 +2,8 @@
 
 #include "RE/Havok/hkBaseObject.h"
 #include "RE/Havok/hkSimdFloat.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
@@ -3,6 +3,8 @@
 #include "RE/Havok/hkBaseTypes.h"
 #include "RE/Havok/hkBlockStream.h"
 #include "RE/Havok/hkReferencedObject.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
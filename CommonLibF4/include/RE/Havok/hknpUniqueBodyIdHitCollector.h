@@ -2,6 +2,8 @@
 
 #include "RE/Havok/hkRefPtr.h"
 #include "RE/Havok/hknpAllHitsCollector.h"
+#include "RE/IDs/RTTI/H.h"
+#include "RE/IDs/VTABLE/H.h"
 
 namespace RE
 {
@@ -0,0 +1,1861 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID AIProcess__PendingActorHeadData{ 892595 };
+		inline constexpr REL::ID AStarSearchBase{ 640682 };
+		inline constexpr REL::ID AStarSearch_BSFastNavmeshTriLocation_BSFastNavmeshEdgeHandle_3_{ 453666 };
+		inline constexpr REL::ID AStarSearch_BSFastNavmeshTriLocation_void_3_{ 1144856 };
+		inline constexpr REL::ID AStarSearch_BSNavmeshInfoconst_BSTSmartPointer_BSPathingDoor_BSTSmartPointerIntrusiveRefCount__22_{ 1015973 };
+		inline constexpr REL::ID AStarSearch_BSPathSmootherPOVNode_BSPathSmootherPOVLink_12_{ 175383 };
+		inline constexpr REL::ID AStarSearch_CombatNavmeshSearchNode_BSFastNavmeshEdgeHandle_3_{ 955901 };
+		inline constexpr REL::ID AStarSearch_ParentSpaceNode_TeleportLink_1_{ 28551 };
+		inline constexpr REL::ID AbsorbEffect{ 1274695 };
+		inline constexpr REL::ID AbstractHeap{ 264038 };
+		inline constexpr REL::ID AccumulatingValueModifierEffect{ 1573712 };
+		inline constexpr REL::ID ActionActivateDoneHandler{ 559037 };
+		inline constexpr REL::ID ActionInput{ 301917 };
+		inline constexpr REL::ID ActionOutput{ 1398677 };
+		inline constexpr REL::ID ActivateChoiceListener{ 565150 };
+		inline constexpr REL::ID ActivateHandler{ 1053322 };
+		inline constexpr REL::ID ActiveEffect{ 523314 };
+		inline constexpr REL::ID ActiveEffectReferenceEffectController{ 509497 };
+		inline constexpr REL::ID ActiveEffect__ForEachHitEffectVisitor{ 682671 };
+		inline constexpr REL::ID ActiveTriggers____hknpBSSpecificBodiesCollector{ 851937 };
+		inline constexpr REL::ID Actor{ 1162828 };
+		inline constexpr REL::ID ActorCCNormDotUpChannel_Actor_float_{ 1340120 };
+		inline constexpr REL::ID ActorCCOnStairsChannel_Actor_bool_{ 980879 };
+		inline constexpr REL::ID ActorCCSuportChannel_Actor_bool_{ 336718 };
+		inline constexpr REL::ID ActorCopyGraphVariableChannel_Actor_float_{ 1459817 };
+		inline constexpr REL::ID ActorCopyGraphVariableChannel_Actor_int_{ 236793 };
+		inline constexpr REL::ID ActorDirectionChannel_Actor_float_{ 671758 };
+		inline constexpr REL::ID ActorDirectionDegreesChannel_Actor_float_{ 514808 };
+		inline constexpr REL::ID ActorKnowledge{ 1269709 };
+		inline constexpr REL::ID ActorLeftWeaponSpeedChannel_Actor_float_{ 929043 };
+		inline constexpr REL::ID ActorMagicCaster{ 89909 };
+		inline constexpr REL::ID ActorMediator{ 1399843 };
+		inline constexpr REL::ID ActorMovementDeltaSmoothedChannel_Actor_float_{ 794807 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___IMessageHandlerWrapper{ 674144 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_CombatPathMovementMessage_{ 1109557 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageActivateDoor_{ 646527 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageActorCollision_{ 366476 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageApproachingDoor_{ 1295910 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageBlocked_{ 553266 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageFreezeDirection_{ 1576004 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageJump_{ 1389067 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageNewPath_{ 273365 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessagePathComplete_{ 180267 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessagePathFailed_{ 86820 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessagePlayIdle_{ 459493 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageSetStaticPath_{ 1482886 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageUpdateRequestImmediate_{ 1016200 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageWarpToLocation_{ 739873 };
+		inline constexpr REL::ID ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageWarpToMultiple_{ 1202921 };
+		inline constexpr REL::ID ActorMover{ 1304565 };
+		inline constexpr REL::ID ActorPackageData{ 1179228 };
+		inline constexpr REL::ID ActorPitchChannel_Actor_float_{ 658017 };
+		inline constexpr REL::ID ActorPitchDeltaChannel_Actor_float_{ 1428029 };
+		inline constexpr REL::ID ActorRollChannel_Actor_float_{ 1441921 };
+		inline constexpr REL::ID ActorSpeedChannel_Actor_float_{ 1455844 };
+		inline constexpr REL::ID ActorSpeedSmoothedChannel_Actor_float_{ 873952 };
+		inline constexpr REL::ID ActorState{ 208449 };
+		inline constexpr REL::ID ActorTargetCheck{ 218389 };
+		inline constexpr REL::ID ActorTimeDeltaChannel_Actor_float_{ 1134616 };
+		inline constexpr REL::ID ActorTurnDeltaChannel_Actor_float_{ 644190 };
+		inline constexpr REL::ID ActorTurnDeltaSmoothedChannel_Actor_float_{ 621919 };
+		inline constexpr REL::ID ActorUtils__ArmorRatingVisitor{ 1263952 };
+		inline constexpr REL::ID ActorUtils__ArmorRatingVisitorBase{ 1423636 };
+		inline constexpr REL::ID ActorValueInfo{ 1048267 };
+		inline constexpr REL::ID ActorValueOwner{ 1426356 };
+		inline constexpr REL::ID ActorWantBlockChannel_Actor_int_{ 350311 };
+		inline constexpr REL::ID ActorWardHealthChannel_Actor_float_{ 341994 };
+		inline constexpr REL::ID ActorWeaponSpeedChannel_Actor_float_{ 1288322 };
+		inline constexpr REL::ID Actor__ForEachSpellVisitor{ 848853 };
+		inline constexpr REL::ID AddCellGrassTask{ 628393 };
+		inline constexpr REL::ID AddRagdollHandler{ 1422376 };
+		inline constexpr REL::ID AimModelPlayerComponent{ 1356106 };
+		inline constexpr REL::ID AimModel__Component{ 1323324 };
+		inline constexpr REL::ID AlarmPackage{ 966549 };
+		inline constexpr REL::ID AlchemyItem{ 709359 };
+		inline constexpr REL::ID AlertStateChangeHandler{ 1499475 };
+		inline constexpr REL::ID AllowRotationHandler{ 405107 };
+		inline constexpr REL::ID AnimatedCameraDeltaStartHandler{ 1274394 };
+		inline constexpr REL::ID AnimatedCameraEndHandler{ 1227855 };
+		inline constexpr REL::ID AnimatedCameraStartHandler{ 1320824 };
+		inline constexpr REL::ID AnimationClipDataSingleton{ 1495799 };
+		inline constexpr REL::ID AnimationDrivenHandler{ 671504 };
+		inline constexpr REL::ID AnimationFileManagerSingleton{ 1503530 };
+		inline constexpr REL::ID AnimationObject{ 1412783 };
+		inline constexpr REL::ID AnimationObjectDrawHandler{ 676928 };
+		inline constexpr REL::ID AnimationObjectLoadHandler{ 723610 };
+		inline constexpr REL::ID AnimationSpeedContour{ 1370704 };
+		inline constexpr REL::ID AnimationSpeedInformation{ 400740 };
+		inline constexpr REL::ID AnimationSpeedInformationDBData{ 447257 };
+		inline constexpr REL::ID AnimationStanceDataSingletonDBData{ 771071 };
+		inline constexpr REL::ID AnimationStanceData_AnimationBoneTransform_{ 916060 };
+		inline constexpr REL::ID AnimationStanceData_NiPoint3_{ 962642 };
+		inline constexpr REL::ID AnimationStreamLoadGame{ 1470369 };
+		inline constexpr REL::ID AnimationStreamSaveGame{ 1204380 };
+		inline constexpr REL::ID AnimationSystemUtils__QueuedReferenceAnimationTask{ 96504 };
+		inline constexpr REL::ID AnimationSystemUtils__TESModelAndAnimationHandles{ 195540 };
+		inline constexpr REL::ID AnticipateAttackHandler{ 1220275 };
+		inline constexpr REL::ID AppResourceCaching____CacheESMOp{ 336963 };
+		inline constexpr REL::ID AppResourceCaching____Manager{ 729435 };
+		inline constexpr REL::ID Archive{ 1359877 };
+		inline constexpr REL::ID ArchiveFile{ 1047546 };
+		inline constexpr REL::ID ArrayArrayImplementation{ 109953 };
+		inline constexpr REL::ID ArrayOfTuplesImplementation{ 795831 };
+		inline constexpr REL::ID ArrayOfTuplesImplementation__View{ 749219 };
+		inline constexpr REL::ID ArrowAttachHandler{ 1370372 };
+		inline constexpr REL::ID ArrowDetachHandler{ 1104592 };
+		inline constexpr REL::ID ArrowProjectile{ 931550 };
+		inline constexpr REL::ID Atmosphere{ 1416696 };
+		inline constexpr REL::ID AttachDistant3DTask{ 499601 };
+		inline constexpr REL::ID AttachReferenceHandler{ 1158978 };
+		inline constexpr REL::ID AttackBlockHandler{ 82639 };
+		inline constexpr REL::ID AttackStateChangeHandler{ 196811 };
+		inline constexpr REL::ID AttackStateChangeHandler0{ 1513107 };
+		inline constexpr REL::ID AttackStateChangeHandler1{ 1247028 };
+		inline constexpr REL::ID AttackStateChangeHandler2{ 980626 };
+		inline constexpr REL::ID AttackStateChangeHandler3{ 715270 };
+		inline constexpr REL::ID AttackStateChangeHandler4{ 448572 };
+		inline constexpr REL::ID AttackStopHandler{ 1121301 };
+		inline constexpr REL::ID AttackWinEndHandler{ 1387208 };
+		inline constexpr REL::ID AttackWinStartHandler{ 71263 };
+		inline constexpr REL::ID AttractionObjectLOSUtils__CacheEntry{ 144762 };
+		inline constexpr REL::ID AudioLoadForPlaybackTask{ 702979 };
+		inline constexpr REL::ID AudioLoadToCacheTask{ 389798 };
+		inline constexpr REL::ID AutoMoveHandler{ 441597 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAcquireSearchDebugData_{ 1268692 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAimController_{ 706621 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAnimatedPath_{ 325718 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatApproachTargetPathController_{ 776351 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAreaHoldPosition_{ 258313 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAreaReference_{ 831588 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAreaShape_{ 1204791 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatAreaStandard_{ 1335819 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatChangePositionPathController_{ 1174150 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatChargingSearchData_{ 144067 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatCluster_{ 1418577 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatCoverLocation_{ 694391 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatCoverSearchDebugData_{ 1198687 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatCoverSearchResult_{ 189829 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatCoverSearch_{ 1267343 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatCoveredPathDebugData_{ 224204 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatDisableActionController_{ 712312 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatDisableAimController_{ 1314534 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatEnterCoverPathController_{ 559651 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatFindCoverPathSpeedController_{ 1013322 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatFlankingSearchData_{ 515340 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatFollowTargetPathController_{ 1453495 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemGrenade_{ 231125 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__{ 486878 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__{ 852190 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__{ 340023 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__{ 824598 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__{ 1189887 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__{ 1409930 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__{ 458927 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__{ 24250 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__{ 1884 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__{ 367737 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__{ 704040 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__{ 1219700 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__{ 1555372 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__{ 338179 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__{ 1437808 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__{ 1241803 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__{ 1295571 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__{ 78808 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__{ 1148725 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__{ 50930 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__{ 416118 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__{ 636812 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__{ 1268017 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__{ 833433 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__{ 811398 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__{ 1176581 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__{ 1512538 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__{ 445632 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__{ 781889 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__{ 1146887 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__{ 664590 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__{ 295151 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__{ 908979 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__{ 1274301 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__{ 762275 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__{ 1246680 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__{ 29184 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__{ 249930 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__{ 881078 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__{ 446350 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__{ 424337 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__{ 790014 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__{ 1125435 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__{ 59061 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__{ 394803 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__{ 760423 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__{ 277630 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__{ 1491182 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__{ 100217 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__{ 465234 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__{ 1535724 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__{ 437527 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__{ 803293 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__{ 1023244 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__{ 72510 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__{ 1220422 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__{ 1198161 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__{ 1563602 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__{ 316772 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__{ 832672 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__{ 1168441 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__{ 1533898 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__{ 1051101 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__{ 1559805 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemMelee_{ 804467 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemOneHandedBlock_{ 601142 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemRanged_{ 1308646 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemShield_{ 96454 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemThrown_{ 1174289 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatInventoryItemTorch_{ 1278255 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterArmor_{ 1564995 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterBoundItem_{ 1491627 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterChameleon_{ 978988 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterCloak_{ 319979 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterDisarm_{ 685710 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterInvisibility_{ 27770 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterLight_{ 1537132 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterOffensive_{ 663922 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterParalyze_{ 1080217 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterReanimate_{ 1006702 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterRestore_{ 199269 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterScript_{ 715380 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterStagger_{ 1050676 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterSummon_{ 1415786 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterTargetEffect_{ 55809 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMagicCasterWard_{ 737462 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMantlePathController_{ 359078 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMatchTargetAimController_{ 675950 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMeleeAimController_{ 1010214 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMeleeDebugData_{ 6284 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatMovementRequestFollowActor_{ 519008 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__{ 965366 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__{ 898104 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__{ 146 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ 222820 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 71790 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ 1056695 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ 767996 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 579599 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1538079 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 516664 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ 1539179 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 320334 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 1457272 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ 205224 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 870203 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ 14475 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 1574609 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 729126 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 1462446 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 947513 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1478228 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ 115123 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__{ 494582 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__{ 421143 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ 816820 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ 92175 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__{ 1225553 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__{ 824678 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__{ 383943 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__{ 50534 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__{ 124137 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__{ 751439 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ 1136228 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ 678137 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__{ 610943 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__{ 1351943 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__{ 1284829 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__{ 387464 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ 609549 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 472040 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ 752831 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ 1168375 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 102507 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 356060 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 39520 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ 1062037 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1425494 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 980011 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ 1483432 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 566314 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ 1120095 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 658978 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1568311 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 985106 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1347852 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1173693 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ 515672 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__{ 881393 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__{ 808249 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ 1203635 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ 478810 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__{ 29498 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__{ 1211636 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__{ 770973 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__{ 437163 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__{ 510864 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__{ 699705 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ 1350138 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ 187289 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__{ 364549 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__{ 469779 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__{ 982016 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ 1376645 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1198623 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ 428329 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ 312249 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 469181 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1082360 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 61099 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ 1256336 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 742643 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 296726 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ 1159062 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 242144 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ 1141629 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 1464524 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 273313 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 1352011 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 491835 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1022201 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ 1242063 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__{ 1476492 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__{ 1575725 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ 561575 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ 368796 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__{ 1502476 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__{ 569493 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__{ 661034 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__{ 1205094 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__{ 1105530 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__{ 495797 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ 880928 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ 422359 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__{ 578768 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__{ 1388582 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__{ 1196315 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ 713863 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 548947 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ 656563 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ 1244958 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 1229324 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 432377 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 993421 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ 1311196 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1236301 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 790902 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ 1386581 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 469630 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ 491774 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 642116 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1205948 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ 529876 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 1424302 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ 372602 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ 592394 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__{ 108016 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__{ 912077 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ 602787 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ 144092 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__{ 1277369 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__{ 610742 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__{ 435755 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__{ 541607 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__{ 1319430 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__{ 537336 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ 922214 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ 463411 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathingDebugData_{ 1211200 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathingSearchArea_{ 706911 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPathingTweener_{ 548585 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatPositionTracker_{ 100272 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatProjectileAimController_{ 1515169 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatProjectileDebugData_{ 475264 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatSuppressiveFireBehavior_{ 1548093 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetLocationSearchResult_{ 14390 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetLocationSearch_{ 654185 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetLocation_{ 149447 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetSelectorFixed_{ 1395219 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetSelectorPreferred_{ 13008 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetSelectorRandom_{ 317702 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTargetSelectorStandard_{ 213895 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatThreatExplosion_{ 542664 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatThreatLOF_{ 1551546 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatThreatMelee_{ 1178421 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatThreatProjectile_{ 1046927 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTrackTargetAimController_{ 1210883 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatTunnelPathController_{ 1067850 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatViewControllerGlance_{ 1358214 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatViewControllerPath_{ 719886 };
+		inline constexpr REL::ID AutoRegisterCombatObject_CombatViewControllerStandard_{ 1558894 };
+		inline constexpr REL::ID AutoRegisterCombatObject_DiveBombPathController_{ 630769 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 392678 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_CombatPathDestinationActor_{ 673365 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_CombatPathDestinationActor_{ 1088768 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 1166539 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 276731 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1542550 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationActor_{ 544088 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1345993 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 900742 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_CombatPathDestinationActor_{ 1403428 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 486595 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_CombatPathDestinationFollowActor_{ 1040649 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 140400 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1488873 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 466830 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1268620 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1094165 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_CombatPathDestinationLocation_{ 435947 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 979595 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_CombatPathDestinationActor_{ 821405 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_CombatPathDestinationActor_{ 970986 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 875902 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1302357 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 108554 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationActor_{ 692416 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1494817 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 1049006 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_CombatPathDestinationActor_{ 1019745 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 807867 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_CombatPathDestinationFollowActor_{ 922871 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 993219 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1370586 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ 176817 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 1416620 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ 976290 };
+		inline constexpr REL::ID AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_CombatPathDestinationLocation_{ 318518 };
+		inline constexpr REL::ID AutoRegisterCreator_ActionActivateDoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 167418 };
+		inline constexpr REL::ID AutoRegisterCreator_AddRagdollHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 704337 };
+		inline constexpr REL::ID AutoRegisterCreator_AlertStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1081683 };
+		inline constexpr REL::ID AutoRegisterCreator_AllowRotationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 465059 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimatedCameraDeltaStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 340096 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimatedCameraEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1456247 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimatedCameraStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1245327 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationDrivenHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1370125 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationObjectDrawHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 785203 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationObjectLoadHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 107789 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationSpeedInformationDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 134896 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationStanceDataSingletonDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 943602 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationStanceData_AnimationBoneTransform__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ 622704 };
+		inline constexpr REL::ID AutoRegisterCreator_AnimationStanceData_NiPoint3__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ 1527776 };
+		inline constexpr REL::ID AutoRegisterCreator_AnticipateAttackHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 290589 };
+		inline constexpr REL::ID AutoRegisterCreator_ArrowAttachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1423575 };
+		inline constexpr REL::ID AutoRegisterCreator_ArrowDetachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 80068 };
+		inline constexpr REL::ID AutoRegisterCreator_AttachReferenceHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 402948 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStateChangeHandler0_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 182989 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStateChangeHandler1_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 859955 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStateChangeHandler2_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1537413 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStateChangeHandler3_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 632471 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStateChangeHandler4_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1309422 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1087754 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1553547 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackWinEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1314813 };
+		inline constexpr REL::ID AutoRegisterCreator_AttackWinStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1076377 };
+		inline constexpr REL::ID AutoRegisterCreator_AwakeSoundFadeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1568296 };
+		inline constexpr REL::ID AutoRegisterCreator_AwakeSoundPauseHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 462404 };
+		inline constexpr REL::ID AutoRegisterCreator_AwakeSoundResumeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1139938 };
+		inline constexpr REL::ID AutoRegisterCreator_AwakeSoundStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 224456 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSAIWorldLocationInteriorCell_BGSAIWorldLocationFactory_{ 997173 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSAIWorldLocationPointRadius_BGSAIWorldLocationFactory_{ 399541 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSAIWorldLocationPrimitive_BGSAIWorldLocationFactory_{ 12451 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSAIWorldLocationRefRadius_BGSAIWorldLocationFactory_{ 1383973 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSAutoWeaponSoundDef_BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ 766591 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSCompoundSoundDef_BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ 1163945 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSConveyorBelt__ConveyorBelt_BSTCreateFactoryManager_unsignedint_InitActionI_16__{ 180079 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSMotorAction__FanMotor_BSTCreateFactoryManager_unsignedint_InitActionI_16__{ 497783 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSMusicPaletteTrack_BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ 1360074 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSMusicSilenceTrack_BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ 282542 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSMusicSingleTrack_BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ 959809 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataBool_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 142732 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataFloat_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 356617 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataInt_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 249831 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataLocationWrapper_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 35470 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataLocation_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 771237 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataObjectList_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 713444 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataRefOLD_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 24592 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataRef_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 1563282 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataTargetSelector_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 836855 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSPackageDataTopic_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 1189989 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureAcquireExecState_BGSProcedureTreeExecStateFactory_{ 72639 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureAcquire_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 928800 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureActivateExecState_BGSProcedureTreeExecStateFactory_{ 1109100 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureActivate_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1233169 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureDialogueActivateExecState_BGSProcedureTreeExecStateFactory_{ 1001919 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureDialogueActivate_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 352434 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureDialogueExecState_BGSProcedureTreeExecStateFactory_{ 1333609 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureDialogue_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 753364 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureDoneExecState_BGSProcedureTreeExecStateFactory_{ 1227004 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureDone_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1236273 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureEatExecState_BGSProcedureTreeExecStateFactory_{ 681504 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureEat_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 231891 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureEscortExecState_BGSProcedureTreeExecStateFactory_{ 1278827 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureEscort_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1493351 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFindExecState_BGSProcedureTreeExecStateFactory_{ 733407 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFind_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 308221 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFleeExecState_BGSProcedureTreeExecStateFactory_{ 187550 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFlee_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 346359 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFlightGrabExecState_BGSProcedureTreeExecStateFactory_{ 1224007 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFlightGrab_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1448830 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFollowExecState_BGSProcedureTreeExecStateFactory_{ 1555694 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFollowTo_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1259298 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureFollow_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1459557 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureForceGreet_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 433388 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureGuardArea_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 883110 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureGuardExecState_BGSProcedureTreeExecStateFactory_{ 1009602 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureGuard_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 989890 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureHeadtrackExecState_BGSProcedureTreeExecStateFactory_{ 463687 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureHeadtrack_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 968475 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureHoldPositionExecState_BGSProcedureTreeExecStateFactory_{ 796015 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureHoldPosition_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 57570 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureHoverExecState_BGSProcedureTreeExecStateFactory_{ 1127349 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureHover_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 721559 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureKeepAnEyeOnExecState_BGSProcedureTreeExecStateFactory_{ 581906 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureKeepAnEyeOn_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1478199 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureLockUnlockExecState_BGSProcedureTreeExecStateFactory_{ 913465 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureLock_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 372565 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureOrbitExecState_BGSProcedureTreeExecStateFactory_{ 1245368 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureOrbit_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 663316 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedurePatrolExecState_BGSProcedureTreeExecStateFactory_{ 699958 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedurePatrol_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 262554 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedurePlayIdleExecState_BGSProcedureTreeExecStateFactory_{ 153895 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedurePlayIdle_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 381443 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedurePursue_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1458137 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureRangeExecState_BGSProcedureTreeExecStateFactory_{ 386065 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureRange_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 164587 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSandboxExecState_BGSProcedureTreeExecStateFactory_{ 46544 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSandbox_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1482874 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSayExecState_BGSProcedureTreeExecStateFactory_{ 1083169 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSay_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1534690 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSitSleepExecState_BGSProcedureTreeExecStateFactory_{ 98655 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSit_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1399825 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureSleep_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 854242 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureStayAwayExecState_BGSProcedureTreeExecStateFactory_{ 1574149 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureStayAway_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 202854 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTravelExecState_BGSProcedureTreeExecStateFactory_{ 1467058 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTravel_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1158514 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeProcedure_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 610782 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeRandomExecState_BGSProcedureTreeExecStateFactory_{ 1322909 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeRandom_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 1139544 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeSequenceExecState_BGSProcedureTreeExecStateFactory_{ 327833 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeSequence_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 1554055 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeSimultaneousExecState_BGSProcedureTreeExecStateFactory_{ 991060 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeSimultaneous_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 1512895 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeStackedExecState_BGSProcedureTreeExecStateFactory_{ 659883 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureTreeStacked_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 742410 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUnlock_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1408852 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUseIdleMarkerExecState_BGSProcedureTreeExecStateFactory_{ 921078 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUseIdleMarker_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 53120 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUseMagicExecState_BGSProcedureTreeExecStateFactory_{ 1253018 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUseMagic_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 77770 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUseWeaponExecState_BGSProcedureTreeExecStateFactory_{ 1145817 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureUseWeapon_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 261139 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureWaitExecState_BGSProcedureTreeExecStateFactory_{ 1477979 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureWait_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1283885 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureWanderExecState_BGSProcedureTreeExecStateFactory_{ 931849 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSProcedureWander_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 976475 };
+		inline constexpr REL::ID AutoRegisterCreator_BGSStandardSoundDef_BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ 583994 };
+		inline constexpr REL::ID AutoRegisterCreator_BGShkMatFadeController_BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ 320723 };
+		inline constexpr REL::ID AutoRegisterCreator_BGShkPhonemeController_BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ 906998 };
+		inline constexpr REL::ID AutoRegisterCreator_BSAudioEffects__BSDelayEffectParams_BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ 55037 };
+		inline constexpr REL::ID AutoRegisterCreator_BSAudioEffects__BSOverdriveParams_BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ 894448 };
+		inline constexpr REL::ID AutoRegisterCreator_BSAudioEffects__BSStateVariableFilterParams_BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ 694498 };
+		inline constexpr REL::ID AutoRegisterCreator_BSPathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 295705 };
+		inline constexpr REL::ID AutoRegisterCreator_BSPathingSolution_BSTSmartPointerPathingFactoryManager_BSPathingSolution_64__{ 882869 };
+		inline constexpr REL::ID AutoRegisterCreator_BSXAudio2Audio_BSTCreateFactoryManager_BSFixedString_BSAudio_4__{ 38108 };
+		inline constexpr REL::ID AutoRegisterCreator_BShkVisibilityController_BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ 365832 };
+		inline constexpr REL::ID AutoRegisterCreator_BShkbHkxDB__ProjectDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 1008961 };
+		inline constexpr REL::ID AutoRegisterCreator_BShkbHkxDB__hkxDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 65926 };
+		inline constexpr REL::ID AutoRegisterCreator_BedEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1444973 };
+		inline constexpr REL::ID AutoRegisterCreator_BedFurnitureExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 339642 };
+		inline constexpr REL::ID AutoRegisterCreator_BowDrawnHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1385313 };
+		inline constexpr REL::ID AutoRegisterCreator_BowReleaseHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1185346 };
+		inline constexpr REL::ID AutoRegisterCreator_BowZoomStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 318536 };
+		inline constexpr REL::ID AutoRegisterCreator_BowZoomStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 557159 };
+		inline constexpr REL::ID AutoRegisterCreator_CameraOverrideStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 719200 };
+		inline constexpr REL::ID AutoRegisterCreator_CameraOverrideStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1395843 };
+		inline constexpr REL::ID AutoRegisterCreator_CameraShakeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 655204 };
+		inline constexpr REL::ID AutoRegisterCreator_ChairEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1206681 };
+		inline constexpr REL::ID AutoRegisterCreator_ChairFurnitureExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1244872 };
+		inline constexpr REL::ID AutoRegisterCreator_CollectionAnimationSpeedContour_BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ 298391 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAcquireSearchDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 736970 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1317520 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAnimatedPath_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 937178 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatApproachTargetPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 244123 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAreaHoldPosition_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 869593 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAreaReference_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1443027 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAreaShape_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 233948 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatAreaStandard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 365211 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatChangePositionPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 642337 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatChargingSearchData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 755871 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatCluster_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 447805 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatCoverLocation_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1305435 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatCoverSearchDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 227893 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatCoverSearchResult_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 801179 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatCoverSearch_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 296367 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatCoveredPathDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 835574 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatDisableActionController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 180055 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatDisableAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 343750 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatEnterCoverPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 27083 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatFindCoverPathSpeedController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 481423 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatFlankingSearchData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1126753 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatFollowTargetPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 921264 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemGrenade_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 842569 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1271242 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 54162 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1124212 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 26087 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 391770 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 612275 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1243639 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 809100 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 786986 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1152004 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1488090 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 421273 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 757438 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1122347 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 640114 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 443358 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 497593 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 862881 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 350663 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 835294 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1200722 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1420619 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 469697 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 35135 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 12774 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 378521 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 714740 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1230253 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1566206 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 348800 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1448708 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1079562 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 110906 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 476135 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1546433 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 448253 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 813954 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1034056 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 83248 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1231012 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1208912 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1574252 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 327471 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 843436 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1179152 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1544581 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1061813 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 693168 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 884400 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1249955 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 737895 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1222306 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 4494 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 225516 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 856711 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 422032 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 399856 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 765531 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1101130 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 34389 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 370318 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 736053 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 253176 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 761803 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemMelee_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1415569 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemOneHandedBlock_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 69073 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemRanged_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 337970 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemShield_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 708475 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemThrown_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 203667 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatInventoryItemTorch_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 307443 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterArmor_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 594189 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterBoundItem_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 520579 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterChameleon_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 7806 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterCloak_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 931519 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterDisarm_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1296777 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterInvisibility_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1078375 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterLight_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 566382 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterOffensive_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1275235 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterParalyze_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 109555 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterReanimate_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 35813 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterRestore_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 810753 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterScript_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1326273 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterStagger_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 79988 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterSummon_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 444965 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterTargetEffect_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1106114 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMagicCasterWard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1348436 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMantlePathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 970615 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMatchTargetAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 143566 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMeleeAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 39441 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMeleeDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 618476 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatMovementRequestFollowActor_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1569434 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathMovementMessageEvent_CombatPathTeleportEvent__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1132262 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 167648 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 539029 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 785218 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1445665 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1467615 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 870103 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 581489 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 831728 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1351205 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 330191 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 209237 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 133878 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1270743 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 18140 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 684237 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1410462 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 244437 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 542538 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 132248 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 761234 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1291389 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1511193 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1279013 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 62009 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 457164 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 876248 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 427188 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 465080 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1168306 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1273714 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 908383 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 391850 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 777340 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 318553 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1394828 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 554391 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 486739 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1171748 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1393446 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 285644 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 127311 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 981648 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1498598 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 169945 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1435277 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 875445 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1239335 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 793940 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 857801 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1523380 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 933658 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 471955 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 942723 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 799032 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1161596 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 548645 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 329184 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 83576 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 9513 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 405374 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1263230 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 814254 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 413185 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1555233 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1221940 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1294987 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1483805 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 990812 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1409787 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 443882 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 549757 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1061666 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1456496 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 307129 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 681214 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 564680 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1160493 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1334437 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 752404 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 364911 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1433142 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 987677 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1411030 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 494214 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 250462 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 573247 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 525538 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 460665 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1183056 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1274678 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 350499 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1555867 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 72834 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 641166 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 448107 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1581736 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 649029 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 740555 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1284370 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1185129 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 575498 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1399091 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 501929 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 219481 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1468461 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 837034 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 793151 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 801104 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 908580 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1497417 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 337888 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 685250 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1246096 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 419897 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1488687 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1042868 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 56722 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 722513 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 744396 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1332691 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1458100 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1221043 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 94494 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 625052 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 844430 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1330815 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 991244 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 682624 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1366837 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 918044 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 690424 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 76813 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 621037 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 960311 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 616789 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1001659 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 543492 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 240202 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestAdapter_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1293426 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestCovered_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1090757 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 433735 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 980133 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1569108 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 769187 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 317982 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1144883 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 146360 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 948657 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 503200 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1178850 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 966603 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1520959 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 886449 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 386250 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 69699 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 870888 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1574407 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 916167 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestMultiGoal_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 827270 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingRequestStandard_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 177677 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingSearchArea_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1317852 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPathingTweener_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1159911 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatPositionTracker_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 712221 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatProjectileAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 982672 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatProjectileDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1086822 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatSearchLockData_BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ 646542 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatSuppressiveFireBehavior_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1015906 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetLocationSearchResult_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1065017 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetLocationSearch_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1265449 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetLocation_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 761070 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetSelectorFixed_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 424546 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetSelectorPreferred_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1063628 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetSelectorRandom_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 929129 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTargetSelectorStandard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1264038 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatThreatExplosion_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1153850 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatThreatLOF_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 580815 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatThreatMelee_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 207783 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatThreatProjectile_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 76220 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTrackTargetAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 679075 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatTunnelPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 97194 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatViewControllerGlance_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 387647 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatViewControllerPath_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1330791 };
+		inline constexpr REL::ID AutoRegisterCreator_CombatViewControllerStandard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1026517 };
+		inline constexpr REL::ID AutoRegisterCreator_CullFurnitureBoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 170941 };
+		inline constexpr REL::ID AutoRegisterCreator_CullWeaponsHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1525352 };
+		inline constexpr REL::ID AutoRegisterCreator_DeathEmoteHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 893455 };
+		inline constexpr REL::ID AutoRegisterCreator_DeathStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 367358 };
+		inline constexpr REL::ID AutoRegisterCreator_DesyncInteractionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 544152 };
+		inline constexpr REL::ID AutoRegisterCreator_DisableCharacterBumperHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 324706 };
+		inline constexpr REL::ID AutoRegisterCreator_DisableCharacterPitchHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 557383 };
+		inline constexpr REL::ID AutoRegisterCreator_DisableCollisionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 535939 };
+		inline constexpr REL::ID AutoRegisterCreator_DiveBombPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1242173 };
+		inline constexpr REL::ID AutoRegisterCreator_DoNotInterruptAnimationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 332929 };
+		inline constexpr REL::ID AutoRegisterCreator_EjectShellCasingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 45309 };
+		inline constexpr REL::ID AutoRegisterCreator_EnableCharacterBumperHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1229889 };
+		inline constexpr REL::ID AutoRegisterCreator_EnableCharacterPitchHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1462356 };
+		inline constexpr REL::ID AutoRegisterCreator_EnableCollisionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1440670 };
+		inline constexpr REL::ID AutoRegisterCreator_EndSummonAnimationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1033903 };
+		inline constexpr REL::ID AutoRegisterCreator_FaceEmotionalIdleHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 413605 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightActionEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 925226 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightActionEntryEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 248108 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightActionGrabHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 19891 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightActionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 9051 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightActionReleaseHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 698016 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightCrashLandStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1374584 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightCruisingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 161071 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightHoveringHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 399276 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightLandEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1353192 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightLandHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1114785 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightLandingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 638048 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightPerchingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 876234 };
+		inline constexpr REL::ID AutoRegisterCreator_FlightTakeOffHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1505029 };
+		inline constexpr REL::ID AutoRegisterCreator_GetUpEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 75645 };
+		inline constexpr REL::ID AutoRegisterCreator_GetUpStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1419119 };
+		inline constexpr REL::ID AutoRegisterCreator_GunDownStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 853955 };
+		inline constexpr REL::ID AutoRegisterCreator_HeadTrackingOffHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 708793 };
+		inline constexpr REL::ID AutoRegisterCreator_HeadTrackingOnHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 469549 };
+		inline constexpr REL::ID AutoRegisterCreator_HeadTrackingRotationOffHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1536035 };
+		inline constexpr REL::ID AutoRegisterCreator_HeadTrackingRotationOnHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 419733 };
+		inline constexpr REL::ID AutoRegisterCreator_HitFrameHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 490872 };
+		inline constexpr REL::ID AutoRegisterCreator_HolotapeLoadedHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 175566 };
+		inline constexpr REL::ID AutoRegisterCreator_IdleDialogueEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1473184 };
+		inline constexpr REL::ID AutoRegisterCreator_IdleDialogueExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 568084 };
+		inline constexpr REL::ID AutoRegisterCreator_IdleFlavorHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1069533 };
+		inline constexpr REL::ID AutoRegisterCreator_IndividualClipAnimationSpeedContour_BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ 699561 };
+		inline constexpr REL::ID AutoRegisterCreator_InterruptCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 795726 };
+		inline constexpr REL::ID AutoRegisterCreator_JumpAnimEventHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1234563 };
+		inline constexpr REL::ID AutoRegisterCreator_KillActorHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 122686 };
+		inline constexpr REL::ID AutoRegisterCreator_KillMoveEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 178107 };
+		inline constexpr REL::ID AutoRegisterCreator_KillMoveStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1521925 };
+		inline constexpr REL::ID AutoRegisterCreator_KnockdownHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 961149 };
+		inline constexpr REL::ID AutoRegisterCreator_KnockdownTargetHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 761145 };
+		inline constexpr REL::ID AutoRegisterCreator_LeftHandSpellCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 458538 };
+		inline constexpr REL::ID AutoRegisterCreator_LeftHandSpellFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 447875 };
+		inline constexpr REL::ID AutoRegisterCreator_LoopingActivateHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 160090 };
+		inline constexpr REL::ID AutoRegisterCreator_MotionDrivenHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1131766 };
+		inline constexpr REL::ID AutoRegisterCreator_MountDismountEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 552769 };
+		inline constexpr REL::ID AutoRegisterCreator_MountInteraction_BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ 875586 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementAgentActorAvoider_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 771923 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementAgentActorState_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1106237 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementAgentPathFollowerFlight_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 322185 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementAgentPathFollowerStandard_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 692314 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementAgentPathFollowerVirtual_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 906269 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentAngleGain_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 651172 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentAnglePassThrough_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1553093 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentAnimationDriven_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 806216 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentDirectControl_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 28568 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentDirectionPassThrough_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1431913 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentGraphDrivenAnimationDriven_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1296665 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentPlayerControlsActionTrigger_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 346807 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentPlayerControls_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1508021 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentSpeedPassThrough_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 91468 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentSprintActionTrigger_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1449304 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentStairsHelper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1328253 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentStandard_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 970441 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentStorePlannerOutput_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 746067 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerAgentStrafing_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1138617 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementHandlerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 1450217 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageActivateDoor_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 707825 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageActorCollision_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1380179 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageBlocked_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 704826 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageFreezeDirection_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1513122 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageJump_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 608157 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageNewPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 756812 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessagePathComplete_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 290105 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessagePathFailed_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 262778 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessagePlayIdle_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 583768 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageSetStaticPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 289880 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageWarpToLocation_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 852567 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementMessageWarpToMultiple_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 997619 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementParametersFixed_BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ 432228 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementParameters_BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ 726393 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPathManagerAgentAvoidBox_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1508934 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPathManagerAgentLoadedAreaMonitor_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1068132 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPathManagerAgentStaticAvoider_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 8138 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPathManagerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 788538 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPlannerAgentDirectControl_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 728023 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPlannerAgentNavmeshBounds_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1017756 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPlannerAgentWarp_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 247654 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPlannerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 1043702 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementPostUpdateArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 925965 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementStateFollowPath_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 735437 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementStateTweener_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1467506 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementTweenerAgentFixedDelta_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 618657 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementTweenerAgentNodeFollower_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1443098 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementTweenerAgentTargetPosAndVel_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 866405 };
+		inline constexpr REL::ID AutoRegisterCreator_MovementTweenerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 1471826 };
+		inline constexpr REL::ID AutoRegisterCreator_NPCAttachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 551411 };
+		inline constexpr REL::ID AutoRegisterCreator_NPCDetachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 350736 };
+		inline constexpr REL::ID AutoRegisterCreator_PairedAttackDialogueHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 235134 };
+		inline constexpr REL::ID AutoRegisterCreator_PairedStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 416201 };
+		inline constexpr REL::ID AutoRegisterCreator_PassengerInteraction_BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ 250211 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingCell_BSTSmartPointerPathingFactoryManager_BSPathingCell_64__{ 1109751 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingDoor_BSTSmartPointerPathingFactoryManager_BSPathingDoor_64__{ 1082191 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingLockData_BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ 1493793 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestClosePoint_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 132890 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestClosestGoal_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1155648 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestCover_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 502864 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFlee_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 475315 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFlyAction_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 420217 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFlyHover_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1270423 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFlyLand_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 99341 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFlyOrbit_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 949333 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFlyTakeOff_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 217171 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestFly_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 8590 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestHide_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 628561 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestLOS_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 162210 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestOptimalLocation_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 573452 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestRotate_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 984312 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestSafeStraightLine_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 79592 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequestStopMoving_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 929473 };
+		inline constexpr REL::ID AutoRegisterCreator_PathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1372478 };
+		inline constexpr REL::ID AutoRegisterCreator_PerformActivationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1307995 };
+		inline constexpr REL::ID AutoRegisterCreator_PickNewIdleHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 128942 };
+		inline constexpr REL::ID AutoRegisterCreator_PipboyBootSequenceHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1080276 };
+		inline constexpr REL::ID AutoRegisterCreator_PitchOverrideEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 827928 };
+		inline constexpr REL::ID AutoRegisterCreator_PitchOverrideStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 150750 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerBedEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 789433 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerChairEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1016842 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerFastEquipSoundHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1448994 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerFurnitureExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1027535 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerSightedStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1554231 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerSneakStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 626386 };
+		inline constexpr REL::ID AutoRegisterCreator_PlayerTerminalEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 111937 };
+		inline constexpr REL::ID AutoRegisterCreator_QuestPathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1452833 };
+		inline constexpr REL::ID AutoRegisterCreator_RagdollAndGetUpHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1457639 };
+		inline constexpr REL::ID AutoRegisterCreator_RagdollStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1180859 };
+		inline constexpr REL::ID AutoRegisterCreator_ReadyStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 176943 };
+		inline constexpr REL::ID AutoRegisterCreator_RecoilStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 209787 };
+		inline constexpr REL::ID AutoRegisterCreator_ReevaluateGraphStateHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 837236 };
+		inline constexpr REL::ID AutoRegisterCreator_RelaxedStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 404380 };
+		inline constexpr REL::ID AutoRegisterCreator_ReloadCompleteHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 638517 };
+		inline constexpr REL::ID AutoRegisterCreator_ReloadStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1543424 };
+		inline constexpr REL::ID AutoRegisterCreator_RemoveRagdollHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 942283 };
+		inline constexpr REL::ID AutoRegisterCreator_RightHandSpellCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1135996 };
+		inline constexpr REL::ID AutoRegisterCreator_RightHandSpellFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1125288 };
+		inline constexpr REL::ID AutoRegisterCreator_SandManKillHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 723094 };
+		inline constexpr REL::ID AutoRegisterCreator_SightedStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 876675 };
+		inline constexpr REL::ID AutoRegisterCreator_SneakStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1531384 };
+		inline constexpr REL::ID AutoRegisterCreator_SpeedSampledAnimationSpeedContour_BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ 1376054 };
+		inline constexpr REL::ID AutoRegisterCreator_StaggeredStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 967915 };
+		inline constexpr REL::ID AutoRegisterCreator_StartFloatingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1213281 };
+		inline constexpr REL::ID AutoRegisterCreator_StartPCapVoiceHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1389005 };
+		inline constexpr REL::ID AutoRegisterCreator_StopFloatingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1451605 };
+		inline constexpr REL::ID AutoRegisterCreator_StopMountCameraHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 844446 };
+		inline constexpr REL::ID AutoRegisterCreator_SubgraphAndOffsetDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 1468086 };
+		inline constexpr REL::ID AutoRegisterCreator_SyncDeferDeathHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1438104 };
+		inline constexpr REL::ID AutoRegisterCreator_SyncEarlyExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 94417 };
+		inline constexpr REL::ID AutoRegisterCreator_UncullBoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1514730 };
+		inline constexpr REL::ID AutoRegisterCreator_UncullFurnitureBoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 847857 };
+		inline constexpr REL::ID AutoRegisterCreator_UncullWeaponsHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 181589 };
+		inline constexpr REL::ID AutoRegisterCreator_UpdateSightedHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1221415 };
+		inline constexpr REL::ID AutoRegisterCreator_UseStealthBoyHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1329379 };
+		inline constexpr REL::ID AutoRegisterCreator_UseStimpakHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1090994 };
+		inline constexpr REL::ID AutoRegisterCreator_VoiceSpellCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 231190 };
+		inline constexpr REL::ID AutoRegisterCreator_VoiceSpellFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 220436 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponAttachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 912265 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponBeginDrawHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 469321 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponBeginSheatheHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1146732 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponDetachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1150612 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponDrawHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 241833 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1304742 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponSheatheHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 480224 };
+		inline constexpr REL::ID AutoRegisterCreator_WeaponSwingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1369677 };
+		inline constexpr REL::ID AutoRegisterCreator_ZeroPitchHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1505468 };
+		inline constexpr REL::ID AutoRegisterCreator___MovementHandlerAgentAngleControllerLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1549759 };
+		inline constexpr REL::ID AutoRegisterCreator___MovementHandlerAgentLargeDeltaLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 551670 };
+		inline constexpr REL::ID AutoRegisterCreator___MovementHandlerAgentTranslationControllerLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 697051 };
+		inline constexpr REL::ID AutoRegisterCreator___MovementPlannerAgentHorseControlsLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 146175 };
+		inline constexpr REL::ID AutoRegisterCreator___MovementPlannerAgentKeepOffsetLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 730513 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ActionActivateDoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 246729 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AddRagdollHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 783574 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AlertStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1161273 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AllowRotationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 545102 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimatedCameraDeltaStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 419506 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimatedCameraEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1535800 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimatedCameraStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1324454 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationDrivenHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1449949 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationObjectDrawHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 864320 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationObjectLoadHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 187501 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationSpeedInformationDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 1357640 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationStanceDataSingletonDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 584594 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationStanceData_AnimationBoneTransform__IAnimationStanceData__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ 702561 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnimationStanceData_NiPoint3__IAnimationStanceData__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ 1168390 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AnticipateAttackHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 370163 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ArrowAttachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1503645 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ArrowDetachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 159652 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttachReferenceHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 482537 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler0_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 262268 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler1_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 939492 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler2_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 34236 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler3_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 712232 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler4_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1388790 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1167305 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 50520 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackWinEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1394146 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AttackWinStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1155891 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AwakeSoundFadeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 65297 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AwakeSoundPauseHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 542520 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AwakeSoundResumeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1219775 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_AwakeSoundStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 303686 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationInteriorCell_IAIWorldLocation__BGSAIWorldLocationFactory_{ 904189 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationPointRadius_IAIWorldLocation__BGSAIWorldLocationFactory_{ 306321 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationPrimitive_IAIWorldLocation__BGSAIWorldLocationFactory_{ 1502289 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationRefRadius_IAIWorldLocation__BGSAIWorldLocationFactory_{ 1290941 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSAutoWeaponSoundDef_BGSSoundDescriptor__BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ 1111868 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSCompoundSoundDef_BGSSoundDescriptor__BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ 1509675 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSConveyorBelt__ConveyorBelt_InitActionI__BSTCreateFactoryManager_unsignedint_InitActionI_16__{ 525391 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSMotorAction__FanMotor_InitActionI__BSTCreateFactoryManager_unsignedint_InitActionI_16__{ 843392 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSMusicPaletteTrack_BSIMusicTrack__BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ 123627 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSMusicSilenceTrack_BSIMusicTrack__BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ 628330 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSMusicSingleTrack_BSIMusicTrack__BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ 1305232 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataBool_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 926926 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataFloat_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 1141006 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataInt_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 1033952 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataLocationWrapper_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 820060 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataLocation_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 1555485 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataObjectList_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 1497614 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataRefOLD_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 809447 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataRef_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 765200 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataTargetSelector_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 38581 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataTopic_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ 391887 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureAcquireExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1561841 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureAcquire_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 130834 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureActivateExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1015739 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureActivate_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 434800 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogueActivateExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1347385 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogueActivate_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1136714 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogueExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1240733 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogue_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1537471 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDoneExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1133484 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDone_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1581781 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEatExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 588025 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEat_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 577379 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEscortExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1185617 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEscort_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 695409 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFindExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 640006 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFind_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 654085 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFleeExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 94007 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFlee_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 692322 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFlightGrabExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1569503 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFlightGrab_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 650946 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFollowExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1462410 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFollowTo_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 460858 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFollow_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 661700 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureForceGreet_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1218228 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureGuardArea_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 85226 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureGuardExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 916447 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureGuard_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 192513 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHeadtrackExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 809670 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHeadtrack_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 170818 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHoldPositionExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1141208 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHoldPosition_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 841972 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHoverExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1034176 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHover_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1505758 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureKeepAnEyeOnExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 927157 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureKeepAnEyeOn_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 680326 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureLockUnlockExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1259069 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureLock_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 718500 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureOrbitExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1151897 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureOrbit_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1447378 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePatrolExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 606329 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePatrol_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1046825 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePlayIdleExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 60373 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePlayIdle_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1165820 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePursue_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 660336 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureRangeExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 292665 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureRange_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 948677 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSandboxExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1535858 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSandbox_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 684856 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSayExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 989659 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSay_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 297601 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSitSleepExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 4826 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSit_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 163373 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSleep_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 56165 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureStayAwayExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1481028 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureStayAway_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 986737 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTravelExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1373433 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTravel_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 360354 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeProcedure_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 1394660 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeRandomExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 86365 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeRandom_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 341532 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSequenceExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 673655 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSequence_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 756173 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSimultaneousExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1336610 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSimultaneous_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 1153301 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeStackedExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1004934 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeStacked_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ 1526575 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUnlock_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 611222 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseIdleMarkerExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1266728 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseIdleMarker_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 837498 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseMagicExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1159718 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseMagic_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 861846 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseWeaponExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1491755 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseWeapon_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 1045376 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWaitExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 1384201 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWait_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 46996 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWanderExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ 838680 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWander_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ 178828 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGSStandardSoundDef_BGSSoundDescriptor__BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ 929244 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGShkMatFadeController_BShkNonTransformController__BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ 1543899 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BGShkPhonemeController_BShkNonTransformController__BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ 547972 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BSAudioEffects__BSDelayEffectParams_BSIAudioEffectParameters__BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ 839382 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BSAudioEffects__BSOverdriveParams_BSIAudioEffectParameters__BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ 96348 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BSAudioEffects__BSStateVariableFilterParams_BSIAudioEffectParameters__BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ 334880 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BSPathingRequest_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1080103 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BSPathingSolution_BSPathingSolution__BSTSmartPointerPathingFactoryManager_BSPathingSolution_64__{ 84997 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BSXAudio2Audio_BSAudio__BSTCreateFactoryManager_BSFixedString_BSAudio_4__{ 383722 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BShkVisibilityController_BShkNonTransformController__BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ 6063 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BShkbHkxDB__ProjectDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 211262 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BShkbHkxDB__hkxDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 850138 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BedEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1085692 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BedFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 419050 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BowDrawnHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1026101 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BowReleaseHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1264850 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BowZoomStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 397902 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_BowZoomStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 636661 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CameraOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 798494 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CameraOverrideStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1475833 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CameraShakeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 734739 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ChairEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1286037 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ChairFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1324023 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CollectionAnimationSpeedContour_AnimationSpeedContour__BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ 1521775 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAcquireSearchDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1521091 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 80934 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAnimatedPath_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1282704 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatApproachTargetPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1028221 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAreaHoldPosition_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1215566 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAreaReference_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 206462 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAreaShape_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 579453 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatAreaStandard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 711295 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatChangePositionPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1426145 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatChargingSearchData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1101180 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatCluster_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 793800 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatCoverLocation_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 68854 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatCoverSearchDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1011828 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatCoverSearchResult_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1146456 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatCoverSearch_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 642249 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatCoveredPathDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 37319 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatDisableActionController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 964021 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatDisableAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1127984 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatEnterCoverPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 811910 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatFindCoverPathSpeedController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1265822 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatFlankingSearchData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1472593 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatFollowTargetPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 123364 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemGrenade_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 44345 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 207352 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 572667 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 60257 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 545029 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 910172 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1130282 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 179672 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1327023 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1304895 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 88120 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 423643 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 939641 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1275455 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 58392 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1158166 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 961779 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1015840 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1381024 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 868840 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1353352 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 136560 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 356716 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 987973 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 553887 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 531645 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 896859 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1232648 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 166323 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 501846 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 867004 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 384515 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 15122 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 629399 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 994264 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 482226 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 966662 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1331903 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1552504 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 601569 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 167104 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 144675 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 510035 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 845771 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1361392 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 115065 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 480377 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1580221 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1211332 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1402554 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 186008 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1255870 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 158173 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 523396 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 743877 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1374719 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 940368 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 918172 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1283530 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 36782 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 553130 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 888649 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1254036 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 771564 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1279886 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMelee_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 179211 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemOneHandedBlock_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 853197 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemRanged_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 683889 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemShield_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1053465 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemThrown_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 549216 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemTorch_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 653243 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterArmor_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 939423 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterBoundItem_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1304688 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterChameleon_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 792828 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterCloak_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1277064 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterDisarm_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 60037 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterInvisibility_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 280390 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterLight_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 911780 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterOffensive_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 477115 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterParalyze_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 454726 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterReanimate_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 820385 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterRestore_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1156052 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterScript_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 89721 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterStagger_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 425261 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterSummon_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 790960 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterTargetEffect_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 308090 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterWard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 111865 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMantlePathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 172988 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMatchTargetAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 927786 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMeleeAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 385041 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMeleeDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 963804 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatMovementRequestFollowActor_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 771393 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathMovementMessageEvent_CombatPathTeleportEvent__MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1212087 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 686010 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1496133 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1303125 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 820466 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1014880 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 417608 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 128801 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 818037 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 898949 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1460049 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 195589 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 120121 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1256997 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1148217 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 231492 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 958173 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 230767 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 89802 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 118467 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 308482 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 838931 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1058317 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 215136 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1018915 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1414244 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 251202 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1384164 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1422146 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 543255 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 648551 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1426365 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1348733 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 151956 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1275533 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 331046 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1072375 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1004897 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 107804 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 329678 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1415274 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 818398 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 529438 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1045709 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1299394 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 982759 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 422906 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 786911 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 341166 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1548936 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 632092 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 481154 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 458130 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 490176 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 346149 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 709556 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1239587 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1459041 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 601879 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 528398 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 923597 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 199353 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1332187 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 931591 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 490888 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 157792 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 231208 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 858161 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 365747 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 784998 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 257672 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 362870 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 875090 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1269914 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 732525 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 667229 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 989246 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 2534 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 177607 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1177191 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 790226 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 276136 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1412673 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1397311 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 480541 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 675735 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 997884 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 511719 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 886008 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 25290 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1260947 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 775885 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1368944 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1468709 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 454140 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 261849 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1394860 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 461979 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 553966 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1097955 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 998326 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 388804 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 69388 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 754517 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1176444 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1281763 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 211857 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 606518 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 787442 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 894864 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1483659 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 763159 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 671445 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1232278 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 845039 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 331152 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1468069 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 42866 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 708869 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 730775 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 175860 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1444217 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 63496 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 80800 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 611255 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 830690 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 706170 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 805248 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 495541 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1180643 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 731970 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 503602 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1472760 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 434096 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 335078 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 429926 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 815437 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 356578 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 585927 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestAdapter_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 495320 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestCovered_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 292596 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 247528 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 794060 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1382158 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 582675 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 131424 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 958477 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1542175 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 762423 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 316701 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 553819 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 780412 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1334001 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1138655 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 200026 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1465479 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 684883 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1387475 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 730046 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestMultiGoal_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 28800 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestStandard_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 961642 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingSearchArea_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 81224 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPathingTweener_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1505721 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatPositionTracker_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1057142 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatProjectileAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 185124 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatProjectileDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1432102 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatSearchLockData_BSPathingLockData__BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ 1430370 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatSuppressiveFireBehavior_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 218051 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetLocationSearchResult_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 267175 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetLocationSearch_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 467156 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetLocation_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1106349 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorFixed_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 770359 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorPreferred_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 265757 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorRandom_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 131140 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorStandard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 465686 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatThreatExplosion_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1499818 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatThreatLOF_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 926066 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatThreatMelee_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 553362 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatThreatProjectile_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 421502 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTrackTargetAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1463028 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatTunnelPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 881369 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatViewControllerGlance_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 1171948 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatViewControllerPath_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 94164 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CombatViewControllerStandard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 228800 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 250228 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_CullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 21952 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DeathEmoteHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 972711 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DeathStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 7654 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DesyncInteractionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 623532 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DisableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 404156 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DisableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 636890 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DisableCollisionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 615393 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DiveBombPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ 4661 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_DoNotInterruptAnimationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 412237 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_EjectShellCasingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 124994 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_EnableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1309184 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_EnableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1541816 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_EnableCollisionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1520505 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_EndSummonAnimationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1113447 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FaceEmotionalIdleHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 493164 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightActionEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1004651 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightActionEntryEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 327548 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightActionGrabHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 99838 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightActionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 89151 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightActionReleaseHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 777322 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightCrashLandStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1454430 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightCruisingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 240404 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightHoveringHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 478795 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightLandEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1432627 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightLandHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1194454 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightLandingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 717799 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightPerchingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 955918 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_FlightTakeOffHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1309 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_GetUpEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1298502 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_GetUpStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1499208 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_GunDownStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 933413 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_HeadTrackingOffHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 788055 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_HeadTrackingOnHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 549521 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_HeadTrackingRotationOffHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 32776 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_HeadTrackingRotationOnHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 499295 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_HitFrameHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 131707 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_HolotapeLoadedHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 254897 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_IdleDialogueEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1552583 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_IdleDialogueExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 647598 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_IdleFlavorHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1149010 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_IndividualClipAnimationSpeedContour_AnimationSpeedContour__BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ 339733 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_InterruptCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 874857 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_JumpAnimEventHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1313853 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_KillActorHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1345465 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_KillMoveEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 257463 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_KillMoveStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 18492 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_KnockdownHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 602078 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_KnockdownTargetHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 840477 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_LeftHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 538566 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_LeftHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 527713 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_LoopingActivateHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 239460 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MotionDrivenHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1211619 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MountDismountEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 632245 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MountInteraction_RefrInteraction__BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ 77785 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementAgentActorAvoider_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1556120 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementAgentActorState_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 308214 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementAgentPathFollowerFlight_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1545387 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementAgentPathFollowerStandard_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 332745 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementAgentPathFollowerVirtual_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 547253 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentAngleGain_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1435006 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentAnglePassThrough_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1193777 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentAnimationDriven_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 446453 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentDirectControl_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1252146 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentDirectionPassThrough_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1072848 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentGraphDrivenAnimationDriven_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 937420 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentPlayerControlsActionTrigger_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 426306 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentPlayerControls_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1148381 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentSpeedPassThrough_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1314361 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentSprintActionTrigger_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1089876 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStairsHelper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 969084 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStandard_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 172806 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStorePlannerOutput_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 386514 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStrafing_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 340600 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementHandlerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 652305 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageActivateDoor_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1491963 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageActorCollision_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 582597 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageBlocked_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1488908 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageFreezeDirection_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 715278 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageJump_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1392054 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageNewPath_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1540905 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessagePathComplete_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1074485 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessagePathFailed_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1047028 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessagePlayIdle_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1367538 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageSetStaticPath_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1074296 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageWarpToLocation_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 54523 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementMessageWarpToMultiple_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 200053 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementParametersFixed_IMovementParameters__BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ 1217031 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementParameters_IMovementParameters__BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ 1510550 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerAgentAvoidBox_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1149256 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerAgentLoadedAreaMonitor_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 709515 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerAgentStaticAvoider_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1231808 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 1572786 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPlannerAgentDirectControl_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 368344 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPlannerAgentNavmeshBounds_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 658943 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPlannerAgentWarp_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1031753 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPlannerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 245839 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementPostUpdateArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 128002 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementStateFollowPath_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1519602 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementStateTweener_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 669601 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementTweenerAgentFixedDelta_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1402664 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementTweenerAgentNodeFollower_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1083855 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementTweenerAgentTargetPosAndVel_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 507306 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_MovementTweenerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ 673895 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_NPCAttachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 192237 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_NPCDetachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1574096 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PairedAttackDialogueHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 314529 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PairedStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 495780 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PassengerInteraction_RefrInteraction__BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ 1034306 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingCell_BSPathingCell__BSTSmartPointerPathingFactoryManager_BSPathingCell_64__{ 1455347 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingDoor_BSPathingDoor__BSTSmartPointerPathingFactoryManager_BSPathingDoor_64__{ 1427494 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingLockData_BSPathingLockData__BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ 695852 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestClosePoint_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 917113 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestClosestGoal_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 357506 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestCover_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1287162 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlee_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1259751 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyAction_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1204848 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyHover_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 472178 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyLand_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 883531 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyOrbit_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 151478 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyTakeOff_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1001163 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestFly_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 793629 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestHide_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1412364 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestLOS_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 946255 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestOptimalLocation_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1357296 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestRotate_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 186789 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestSafeStraightLine_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 863638 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequestStopMoving_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 131473 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PathingRequest_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 135938 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PerformActivationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1387396 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PickNewIdleHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 208646 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PipboyBootSequenceHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1159895 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PitchOverrideEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 907403 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PitchOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 230233 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerBedEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 868455 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerChairEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1096507 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerFastEquipSoundHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1528573 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1107161 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerSightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 51218 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerSneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 706158 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_PlayerTerminalEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 191782 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_QuestPathingRequest_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 655011 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RagdollAndGetUpHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1537205 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RagdollStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1260430 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ReadyStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 256267 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RecoilStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 288936 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ReevaluateGraphStateHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 916617 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RelaxedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 483947 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ReloadCompleteHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 718228 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ReloadStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 40377 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RemoveRagdollHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1021708 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RightHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1215859 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_RightHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1205076 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SandManKillHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 802399 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 956352 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 28061 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SpeedSampledAnimationSpeedContour_AnimationSpeedContour__BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ 1016942 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_StaggeredStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1047511 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_StartFloatingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1292492 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_StartPCapVoiceHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1468910 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_StopFloatingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1531174 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_StopMountCameraHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 923801 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SubgraphAndOffsetDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ 670185 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SyncDeferDeathHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1517899 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_SyncEarlyExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 174158 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_UncullBoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 11174 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_UncullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 927338 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_UncullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 260850 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_UpdateSightedHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1300558 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_UseStealthBoyHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1408803 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_UseStimpakHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1170544 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_VoiceSpellCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 310590 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_VoiceSpellFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 299721 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponAttachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 991453 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponBeginDrawHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 549289 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponBeginSheatheHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1226501 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponDetachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1230316 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponDrawHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 321225 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1384148 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponSheatheHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 559944 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_WeaponSwingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1449511 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator_ZeroPitchHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ 1145763 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator___MovementHandlerAgentAngleControllerLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 46756 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator___MovementHandlerAgentLargeDeltaLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 631168 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator___MovementHandlerAgentTranslationControllerLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 1215166 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator___MovementPlannerAgentHorseControlsLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 225820 };
+		inline constexpr REL::ID AutoRegisterFactory_BSTDerivedCreator___MovementPlannerAgentKeepOffsetLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ 809826 };
+		inline constexpr REL::ID AutoRegisterFactory___BShkbAnimationGraphLoadScrapper_BSTFactoryManager_BSFixedString_BSAnimationGraphLoadScrapper_2_BSTSingletonImplicit__{ 853362 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementAgentActorAvoider_{ 1303610 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementAgentActorState_{ 55940 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementAgentPathFollowerFlight_{ 854234 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementAgentPathFollowerStandard_{ 1224230 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementAgentPathFollowerVirtual_{ 1438153 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentAngleGain_{ 1183019 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentAnglePassThrough_{ 63877 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentAnimationDriven_{ 1337780 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentDirectControl_{ 561131 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentDirectionPassThrough_{ 1525632 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentGraphDrivenAnimationDriven_{ 1389748 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentPlayerControlsActionTrigger_{ 439998 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentPlayerControls_{ 457190 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentSpeedPassThrough_{ 184942 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentSprintActionTrigger_{ 1542529 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentStairsHelper_{ 278215 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentStandard_{ 1502961 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentStorePlannerOutput_{ 839103 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementHandlerAgentStrafing_{ 88458 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementPathManagerAgentAvoidBox_{ 458094 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementPathManagerAgentLoadedAreaMonitor_{ 1161558 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementPathManagerAgentStaticAvoider_{ 101953 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementPlannerAgentDirectControl_{ 1259763 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementPlannerAgentNavmeshBounds_{ 1549989 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementPlannerAgentWarp_{ 779875 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementStateFollowPath_{ 1267171 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementStateTweener_{ 416904 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementTweenerAgentFixedDelta_{ 1150437 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementTweenerAgentNodeFollower_{ 392783 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator_MovementTweenerAgentTargetPosAndVel_{ 1398356 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator___MovementHandlerAgentAngleControllerLoadScrapper_{ 1204386 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator___MovementHandlerAgentLargeDeltaLoadScrapper_{ 206030 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator___MovementHandlerAgentTranslationControllerLoadScrapper_{ 351016 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator___MovementPlannerAgentHorseControlsLoadScrapper_{ 1382729 };
+		inline constexpr REL::ID AutoRegisterMovementAgentCreator___MovementPlannerAgentKeepOffsetLoadScrapper_{ 384568 };
+		inline constexpr REL::ID AutoRegisterMovementArbiterCreator_MovementHandlerArbiter_{ 399752 };
+		inline constexpr REL::ID AutoRegisterMovementArbiterCreator_MovementPathManagerArbiter_{ 1320146 };
+		inline constexpr REL::ID AutoRegisterMovementArbiterCreator_MovementPlannerArbiter_{ 1575984 };
+		inline constexpr REL::ID AutoRegisterMovementArbiterCreator_MovementPostUpdateArbiter_{ 1458128 };
+		inline constexpr REL::ID AutoRegisterMovementArbiterCreator_MovementTweenerArbiter_{ 421175 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_BSPathingRequest___PathBuilderBSPathingRequest_{ 1459551 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestCovered_CombatPathingRequestBuilder_{ 279039 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 1456841 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathingRequestBuilder_{ 1564623 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathingRequestBuilder_{ 570772 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 209644 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 1340511 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 585692 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 1169111 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 389108 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 1526173 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathingRequestBuilder_{ 885327 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 1550791 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 522489 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 765911 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 970183 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 1092304 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 311510 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ 576009 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathingRequestBuilder_{ 1500639 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestMultiGoal_CombatPathingRequestBuilder_{ 360811 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_CombatPathingRequestStandard_CombatPathingRequestBuilder_{ 14973 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestClosePoint___PathBuilderClosePointPath_{ 290352 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestClosestGoal_PathingRequestClosestGoal__PathBuilder_{ 343799 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFlee_PathBuilderFlee__PathBuilderFleePath_{ 1126626 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFlyAction_PathBuilderFlight__PathBuilderFlyActionPath_{ 487638 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFlyHover_PathBuilderFlight__PathBuilderFlyHoverPath_{ 1444724 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFlyLand_PathBuilderFlight__PathBuilderFlyLandPath_{ 899013 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFlyOrbit_PathBuilderFlight__PathBuilderFlyOrbitPath_{ 380672 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFlyTakeOff_PathBuilderFlight__PathBuilderFlyTakeOffPath_{ 1417033 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestFly_PathBuilderFlight__PathBuilderFlyPath_{ 1551862 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestHide_PathBuilderHide__PathBuilderHidePath_{ 1403339 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestLOS_PathBuilderLOS__PathBuilderLOSPath_{ 512210 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestOptimalLocation_PathBuilderOptimalLocation__PathBuilderOptimalLocationPath_{ 764706 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestRotate___PathBuilderRotatePath_{ 435468 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestSafeStraightLine_PathBuilderSafeStraightLine__PathBuilderSafeStraightLinePath_{ 1189502 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequestStopMoving___PathBuilderStopMovingPath_{ 1500172 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_PathingRequest___PathBuilderPathingRequest_{ 981308 };
+		inline constexpr REL::ID AutoRegisterPathBuilderFactory_QuestPathingRequest_QuestPathingRequestBuilder_{ 1518669 };
+		inline constexpr REL::ID AutoRegisterPathing_BSPathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ 1093908 };
+		inline constexpr REL::ID AutoRegisterPathing_BSPathingSolution_BSTSmartPointerPathingFactoryManager_BSPathingSolution_64__{ 98648 };
+		inline constexpr REL::ID AutoRegisterPathing_CombatPathMovementMessageEvent_CombatPathTeleportEvent__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1052832 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageActivateDoor_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1505749 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageActorCollision_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 596390 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageBlocked_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1502734 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageFreezeDirection_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 728932 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageJump_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1405880 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageNewPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1554740 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessagePathComplete_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1088229 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessagePathFailed_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1060699 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessagePlayIdle_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1381378 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageSetStaticPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 1088020 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageWarpToLocation_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 68440 };
+		inline constexpr REL::ID AutoRegisterPathing_MovementMessageWarpToMultiple_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ 213777 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestAdapter_BSPathingRequest_64_{ 947937 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestCovered_BSPathingRequest_64_{ 745567 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1059185 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSPathingRequest_64_{ 461726 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSPathingRequest_64_{ 1050600 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1394023 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1381795 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 188262 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 771782 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1574179 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1128347 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSPathingRequest_64_{ 660862 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 448180 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1002322 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1511947 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1450395 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 695205 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1496666 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ 1055881 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSPathingRequest_64_{ 397885 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestMultiGoal_BSPathingRequest_64_{ 481642 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestStandard_BSPathingRequest_64_{ 1414001 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_MovementParametersFixed_IMovementParameters_64_{ 87064 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_MovementParameters_IMovementParameters_64_{ 819347 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestClosePoint_BSPathingRequest_64_{ 1369425 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestClosestGoal_BSPathingRequest_64_{ 810348 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestCover_BSPathingRequest_64_{ 596373 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlee_BSPathingRequest_64_{ 568813 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyAction_BSPathingRequest_64_{ 74944 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyHover_BSPathingRequest_64_{ 924763 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyLand_BSPathingRequest_64_{ 192953 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyOrbit_BSPathingRequest_64_{ 603951 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyTakeOff_BSPathingRequest_64_{ 1453966 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestFly_BSPathingRequest_64_{ 102411 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestHide_BSPathingRequest_64_{ 722008 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestLOS_BSPathingRequest_64_{ 255367 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestOptimalLocation_BSPathingRequest_64_{ 227942 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestRotate_BSPathingRequest_64_{ 1077740 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestSafeStraightLine_BSPathingRequest_64_{ 1316197 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequestStopMoving_BSPathingRequest_64_{ 584233 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_PathingRequest_BSPathingRequest_64_{ 1466099 };
+		inline constexpr REL::ID AutoRegisterSmartPtrDerivedPathingType_QuestPathingRequest_BSPathingRequest_64_{ 1546101 };
+		inline constexpr REL::ID AutoVanityState{ 21474 };
+		inline constexpr REL::ID AwakeSoundFadeHandler{ 925718 };
+		inline constexpr REL::ID AwakeSoundPauseHandler{ 393693 };
+		inline constexpr REL::ID AwakeSoundResumeHandler{ 127775 };
+		inline constexpr REL::ID AwakeSoundStopHandler{ 660077 };
+	}
+}
@@ -0,0 +1,5075 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID BGSAIWorldLocation{ 154657 };
+		inline constexpr REL::ID BGSAIWorldLocationInteriorCell{ 1470933 };
+		inline constexpr REL::ID BGSAIWorldLocationPointRadius{ 406589 };
+		inline constexpr REL::ID BGSAIWorldLocationPrimitive{ 248 };
+		inline constexpr REL::ID BGSAIWorldLocationRefRadius{ 1569567 };
+		inline constexpr REL::ID BGSAbilityPerkEntry{ 1195052 };
+		inline constexpr REL::ID BGSAcousticSpace{ 1025256 };
+		inline constexpr REL::ID BGSAction{ 1423952 };
+		inline constexpr REL::ID BGSActionData{ 787647 };
+		inline constexpr REL::ID BGSAddonNode{ 148175 };
+		inline constexpr REL::ID BGSAddonNodeSoundHandleExtra{ 50074 };
+		inline constexpr REL::ID BGSAimModel{ 1445939 };
+		inline constexpr REL::ID BGSArtObject{ 275460 };
+		inline constexpr REL::ID BGSArtObjectCloneTask{ 601458 };
+		inline constexpr REL::ID BGSAssociationType{ 579637 };
+		inline constexpr REL::ID BGSAttachParentArray{ 1219658 };
+		inline constexpr REL::ID BGSAttachTechniquesUtil__AttachTechniquesFunctor{ 475368 };
+		inline constexpr REL::ID BGSAttachTechniquesUtil__DetachTechniquesFunctor{ 1086939 };
+		inline constexpr REL::ID BGSAttachTechniquesUtil__ProcessTechniquesFunctor{ 1446205 };
+		inline constexpr REL::ID BGSAttackData{ 209378 };
+		inline constexpr REL::ID BGSAttackDataForm{ 836140 };
+		inline constexpr REL::ID BGSAttackDataMap{ 1306001 };
+		inline constexpr REL::ID BGSAttractionRule{ 684871 };
+		inline constexpr REL::ID BGSAudioEffectChain{ 919917 };
+		inline constexpr REL::ID BGSAutoWeaponSoundDef{ 1032248 };
+		inline constexpr REL::ID BGSBaseAlias{ 503393 };
+		inline constexpr REL::ID BGSBehaviorGraphModel{ 875449 };
+		inline constexpr REL::ID BGSBendableSpline{ 1324967 };
+		inline constexpr REL::ID BGSBipedObjectForm{ 304010 };
+		inline constexpr REL::ID BGSBlockBashData{ 37894 };
+		inline constexpr REL::ID BGSBodyPartData{ 1476422 };
+		inline constexpr REL::ID BGSBtoDB__DBTraits{ 1255251 };
+		inline constexpr REL::ID BGSBtrDB__DBTraits{ 467736 };
+		inline constexpr REL::ID BGSBttDB__DBTraits{ 509195 };
+		inline constexpr REL::ID BGSCameraPath{ 1346165 };
+		inline constexpr REL::ID BGSCameraShot{ 860925 };
+		inline constexpr REL::ID BGSCharacterTint__Entry{ 876276 };
+		inline constexpr REL::ID BGSCharacterTint__MaskEntry{ 610542 };
+		inline constexpr REL::ID BGSCharacterTint__PaletteEntry{ 563923 };
+		inline constexpr REL::ID BGSCharacterTint__Template__Entry{ 517161 };
+		inline constexpr REL::ID BGSCharacterTint__Template__Mask{ 470316 };
+		inline constexpr REL::ID BGSCharacterTint__Template__Palette{ 423752 };
+		inline constexpr REL::ID BGSCharacterTint__Template__TextureSet{ 330646 };
+		inline constexpr REL::ID BGSCharacterTint__TextureSetEntry{ 377271 };
+		inline constexpr REL::ID BGSCollisionLayer{ 1505994 };
+		inline constexpr REL::ID BGSColorForm{ 1361539 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__CDX{ 775443 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__CDX__PsgBatchIter{ 966994 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__DBTraits{ 503837 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__LoadTask{ 978357 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__ModelDB__DBTraits{ 731988 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__ModelDB__QueuedHandles{ 1370375 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__PreloadTask{ 1358944 };
+		inline constexpr REL::ID BGSCombinedCellGeometryDB__Unpacker__Thread{ 1112314 };
+		inline constexpr REL::ID BGSComponent{ 1004689 };
+		inline constexpr REL::ID BGSCompoundSoundDef{ 1210731 };
+		inline constexpr REL::ID BGSConstructibleObject{ 74751 };
+		inline constexpr REL::ID BGSConveyorBelt__ConveyorBelt{ 226641 };
+		inline constexpr REL::ID BGSCraftingUseSound{ 906800 };
+		inline constexpr REL::ID BGSDamageType{ 1276258 };
+		inline constexpr REL::ID BGSDebris{ 1527284 };
+		inline constexpr REL::ID BGSDecalNode{ 1462432 };
+		inline constexpr REL::ID BGSDefaultObject{ 431302 };
+		inline constexpr REL::ID BGSDefaultObjectManager{ 60844 };
+		inline constexpr REL::ID BGSDestructibleObjectForm{ 1526156 };
+		inline constexpr REL::ID BGSDialogueBranch{ 526357 };
+		inline constexpr REL::ID BGSDualCastData{ 886948 };
+		inline constexpr REL::ID BGSEncounterZone{ 1151494 };
+		inline constexpr REL::ID BGSEntryPointFunctionData{ 1398051 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataAVAndValue{ 1038893 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataActivateChoice{ 540051 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataBooleanGraphVariable{ 194676 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataLeveledList{ 1212014 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataOneValue{ 1132171 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataSpellItem{ 1384326 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataText{ 586715 };
+		inline constexpr REL::ID BGSEntryPointFunctionDataTwoValue{ 1085583 };
+		inline constexpr REL::ID BGSEntryPointPerkEntry{ 928907 };
+		inline constexpr REL::ID BGSEquipSlot{ 1151311 };
+		inline constexpr REL::ID BGSEquipType{ 428906 };
+		inline constexpr REL::ID BGSExplosion{ 1246379 };
+		inline constexpr REL::ID BGSFeaturedItemMessage{ 641007 };
+		inline constexpr REL::ID BGSFootIkRaycastInterfaceDB{ 554607 };
+		inline constexpr REL::ID BGSFootstep{ 1283872 };
+		inline constexpr REL::ID BGSFootstepManager{ 179554 };
+		inline constexpr REL::ID BGSFootstepSet{ 658934 };
+		inline constexpr REL::ID BGSForcedLocRefType{ 1205816 };
+		inline constexpr REL::ID BGSGameWarningsHandler__GameWarningsSink{ 1064495 };
+		inline constexpr REL::ID BGSGamebryoSequenceGenerator{ 1341840 };
+		inline constexpr REL::ID BGSGamebryoSequenceGeneratorHolderSingleton{ 653300 };
+		inline constexpr REL::ID BGSGodRays{ 951325 };
+		inline constexpr REL::ID BGSHavokGeometryAttach{ 807376 };
+		inline constexpr REL::ID BGSHavokGeometryAttach__ActionPolicy{ 541401 };
+		inline constexpr REL::ID BGSHavokGeometryAttach__AttachPolicy{ 714402 };
+		inline constexpr REL::ID BGSHavokGeometryAttach__DetachPolicy{ 886675 };
+		inline constexpr REL::ID BGSHazard{ 1097490 };
+		inline constexpr REL::ID BGSHeadPart{ 699336 };
+		inline constexpr REL::ID BGSIdleCollection{ 934681 };
+		inline constexpr REL::ID BGSIdleMarker{ 418949 };
+		inline constexpr REL::ID BGSImpactData{ 1349392 };
+		inline constexpr REL::ID BGSImpactDataSet{ 1372094 };
+		inline constexpr REL::ID BGSImpactManager{ 607945 };
+		inline constexpr REL::ID BGSInstanceNamingRules{ 72393 };
+		inline constexpr REL::ID BGSInstanceNamingRulesForm{ 939601 };
+		inline constexpr REL::ID BGSInventoryItem__CheckExtraDataFunctor{ 123924 };
+		inline constexpr REL::ID BGSInventoryItem__CheckStackIDFunctor{ 1533545 };
+		inline constexpr REL::ID BGSInventoryItem__ClearEquipFlagsFunctor{ 190101 };
+		inline constexpr REL::ID BGSInventoryItem__FindEquippedStackFunctor{ 16395 };
+		inline constexpr REL::ID BGSInventoryItem__HasExtraDataFunctor{ 694506 };
+		inline constexpr REL::ID BGSInventoryItem__IsUIEquivalentStackFunctor{ 189927 };
+		inline constexpr REL::ID BGSInventoryItem__ModCountFunctor{ 469138 };
+		inline constexpr REL::ID BGSInventoryItem__ModifyModDataFunctor{ 460797 };
+		inline constexpr REL::ID BGSInventoryItem__SetFlagFunctor{ 581927 };
+		inline constexpr REL::ID BGSInventoryItem__SetHealthFunctor{ 507713 };
+		inline constexpr REL::ID BGSInventoryItem__Stack{ 282834 };
+		inline constexpr REL::ID BGSInventoryItem__StackDataCompareFunctor{ 1360348 };
+		inline constexpr REL::ID BGSInventoryItem__StackDataWriteFunctor{ 296471 };
+		inline constexpr REL::ID BGSInventoryItem__WriteTextExtra{ 1557141 };
+		inline constexpr REL::ID BGSInventoryList__InventoryWeightFunctor{ 362429 };
+		inline constexpr REL::ID BGSKeyword{ 122536 };
+		inline constexpr REL::ID BGSKeywordForm{ 1493398 };
+		inline constexpr REL::ID BGSLOSData{ 675518 };
+		inline constexpr REL::ID BGSLensFlare{ 252826 };
+		inline constexpr REL::ID BGSLensFlareSprite{ 678161 };
+		inline constexpr REL::ID BGSLightingTemplate{ 379970 };
+		inline constexpr REL::ID BGSListForm{ 1473512 };
+		inline constexpr REL::ID BGSLoadFormBuffer{ 1011716 };
+		inline constexpr REL::ID BGSLoadFormData{ 40947 };
+		inline constexpr REL::ID BGSLoadGameBuffer{ 526603 };
+		inline constexpr REL::ID BGSLocAlias{ 751106 };
+		inline constexpr REL::ID BGSLocation{ 1104898 };
+		inline constexpr REL::ID BGSLocationRefType{ 1471892 };
+		inline constexpr REL::ID BGSMaterialObject{ 836801 };
+		inline constexpr REL::ID BGSMaterialSwap{ 646346 };
+		inline constexpr REL::ID BGSMaterialType{ 378623 };
+		inline constexpr REL::ID BGSMenuDisplayObject{ 563029 };
+		inline constexpr REL::ID BGSMenuIcon{ 902483 };
+		inline constexpr REL::ID BGSMessage{ 374731 };
+		inline constexpr REL::ID BGSMessageIcon{ 1399653 };
+		inline constexpr REL::ID BGSMod__Attachment__Mod{ 1551293 };
+		inline constexpr REL::ID BGSMod__Container{ 347080 };
+		inline constexpr REL::ID BGSMod__Property__BridgeI{ 482114 };
+		inline constexpr REL::ID BGSMod__Property__Bridge_TESFurniture__InstanceData_{ 216301 };
+		inline constexpr REL::ID BGSMod__Property__Bridge_TESNPC__InstanceData_{ 752732 };
+		inline constexpr REL::ID BGSMod__Property__Bridge_TESObjectARMO__InstanceData_{ 1499240 };
+		inline constexpr REL::ID BGSMod__Property__Bridge_TESObjectWEAP__InstanceData_{ 1332214 };
+		inline constexpr REL::ID BGSMod__Template__Item{ 613379 };
+		inline constexpr REL::ID BGSMod__Template__Items{ 1364300 };
+		inline constexpr REL::ID BGSModelMaterialSwap{ 912157 };
+		inline constexpr REL::ID BGSMotorAction__Action{ 810668 };
+		inline constexpr REL::ID BGSMotorAction__FanMotor{ 544738 };
+		inline constexpr REL::ID BGSMovableStatic{ 883338 };
+		inline constexpr REL::ID BGSMovementType{ 125646 };
+		inline constexpr REL::ID BGSMoviePlayer{ 62533 };
+		inline constexpr REL::ID BGSMultiTechniqueAttach{ 653877 };
+		inline constexpr REL::ID BGSMultiTechniqueAttach__ActionPolicy{ 387522 };
+		inline constexpr REL::ID BGSMultiTechniqueAttach__AttachPolicy{ 560468 };
+		inline constexpr REL::ID BGSMultiTechniqueAttach__DetachPolicy{ 733421 };
+		inline constexpr REL::ID BGSMusicPaletteTrack{ 529586 };
+		inline constexpr REL::ID BGSMusicSilenceTrack{ 548832 };
+		inline constexpr REL::ID BGSMusicSingleTrack{ 1006292 };
+		inline constexpr REL::ID BGSMusicTrack{ 263525 };
+		inline constexpr REL::ID BGSMusicTrackFormWrapper{ 587047 };
+		inline constexpr REL::ID BGSMusicType{ 54584 };
+		inline constexpr REL::ID BGSNamedNodeAttach{ 1059363 };
+		inline constexpr REL::ID BGSNamedNodeAttach__ActionPolicy{ 793680 };
+		inline constexpr REL::ID BGSNamedNodeAttach__AttachPolicy{ 747079 };
+		inline constexpr REL::ID BGSNamedNodeAttach__DetachPolicy{ 700649 };
+		inline constexpr REL::ID BGSNamedPackageData_IAITarget_{ 653629 };
+		inline constexpr REL::ID BGSNamedPackageData_IPackageDataAIWorldLocationHandle_{ 466570 };
+		inline constexpr REL::ID BGSNamedPackageData_IPackageData_{ 461103 };
+		inline constexpr REL::ID BGSNativeTerminalForm{ 1257717 };
+		inline constexpr REL::ID BGSNavmeshableObject{ 397936 };
+		inline constexpr REL::ID BGSNote{ 293143 };
+		inline constexpr REL::ID BGSObjectInstanceExtra{ 1233229 };
+		inline constexpr REL::ID BGSObjectVisibilityManager{ 480041 };
+		inline constexpr REL::ID BGSOpenCloseForm{ 274273 };
+		inline constexpr REL::ID BGSOutfit{ 1094391 };
+		inline constexpr REL::ID BGSOverridePackCollection{ 169816 };
+		inline constexpr REL::ID BGSPackIn{ 249813 };
+		inline constexpr REL::ID BGSPackageDataBasicTemplate_IAITarget_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___kPackageDataRefTypeName_0_{ 135078 };
+		inline constexpr REL::ID BGSPackageDataBasicTemplate_IPackageData_float_kPackageDataFloatTypeName_fPackageDataFloatDefault_{ 853540 };
+		inline constexpr REL::ID BGSPackageDataBasicTemplate_IPackageData_int_kPackageDataIntTypeName_iPackageDataIntDefault_{ 494182 };
+		inline constexpr REL::ID BGSPackageDataBool{ 727851 };
+		inline constexpr REL::ID BGSPackageDataFloat{ 1283921 };
+		inline constexpr REL::ID BGSPackageDataInt{ 658982 };
+		inline constexpr REL::ID BGSPackageDataLocation{ 911000 };
+		inline constexpr REL::ID BGSPackageDataLocationWrapper{ 645139 };
+		inline constexpr REL::ID BGSPackageDataObjectList{ 1245158 };
+		inline constexpr REL::ID BGSPackageDataPointerTemplate_IAITarget_PackageTarget_kPackageDataRef2TypeName_{ 1483843 };
+		inline constexpr REL::ID BGSPackageDataPointerTemplate_IPackageDataAIWorldLocationHandle_PackageLocation_kPackageDataLocationTypeName_{ 826127 };
+		inline constexpr REL::ID BGSPackageDataPointerTemplate_IPackageData_PackageTarget_kPackageDataTargetSelectorTypeName_{ 1517294 };
+		inline constexpr REL::ID BGSPackageDataRef{ 465838 };
+		inline constexpr REL::ID BGSPackageDataRefOLD{ 1176960 };
+		inline constexpr REL::ID BGSPackageDataSaveableTemplate_IPackageData_float_kPackageDataFloatTypeName_fPackageDataFloatDefault_{ 1237435 };
+		inline constexpr REL::ID BGSPackageDataSaveableTemplate_IPackageData_int_kPackageDataIntTypeName_iPackageDataIntDefault_{ 173547 };
+		inline constexpr REL::ID BGSPackageDataTargetSelector{ 598492 };
+		inline constexpr REL::ID BGSPackageDataTopic{ 1456090 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_BGSPackageDataBool_BGSPackageDataBool_{ 1327639 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_BGSPackageDataFloat_BGSPackageDataFloat_{ 356890 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_BGSPackageDataInt_BGSPackageDataInt_{ 1135149 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_BGSPackageDataObjectList_BGSPackageDataObjectList_{ 1279051 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_BGSPackageDataTargetSelector_BGSPackageDataTargetSelector_{ 913520 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_BGSPackageDataTopic_BGSPackageDataTopic_{ 141538 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_IAITarget_BGSPackageDataObjectList_{ 735057 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_IAITarget_BGSPackageDataRef_{ 277586 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_IPackageDataAIWorldLocationHandle_BGSPackageDataLocation_{ 445520 };
+		inline constexpr REL::ID BGSPackageDataTypeCheck_IPackageDataAIWorldLocationHandle_BGSPackageDataRef_{ 1352235 };
+		inline constexpr REL::ID BGSParticleArrayAttach{ 1479428 };
+		inline constexpr REL::ID BGSParticleArrayAttach__ClearEmitterPolicy{ 634655 };
+		inline constexpr REL::ID BGSParticleArrayAttach__CollectEmitterPolicy{ 22506 };
+		inline constexpr REL::ID BGSParticleArrayAttach__EmitterPolicy{ 1213341 };
+		inline constexpr REL::ID BGSParticleObjectCloneTask{ 910252 };
+		inline constexpr REL::ID BGSPerk{ 171043 };
+		inline constexpr REL::ID BGSPerkEntry{ 583661 };
+		inline constexpr REL::ID BGSPerkRankArray{ 1486170 };
+		inline constexpr REL::ID BGSPerk__AddPerkVisitor{ 661634 };
+		inline constexpr REL::ID BGSPerk__ApplyPerksVisitor{ 395287 };
+		inline constexpr REL::ID BGSPerk__FindPerkInRanksVisitor{ 708495 };
+		inline constexpr REL::ID BGSPickupPutdownSounds{ 1260051 };
+		inline constexpr REL::ID BGSPlayerMusicChanger{ 63929 };
+		inline constexpr REL::ID BGSPreloadable{ 546563 };
+		inline constexpr REL::ID BGSPreviewTransform{ 20431 };
+		inline constexpr REL::ID BGSPrimitive{ 858438 };
+		inline constexpr REL::ID BGSPrimitiveBox{ 1343666 };
+		inline constexpr REL::ID BGSPrimitiveEllipsoid{ 1204181 };
+		inline constexpr REL::ID BGSPrimitiveLine{ 247013 };
+		inline constexpr REL::ID BGSPrimitivePlane{ 373074 };
+		inline constexpr REL::ID BGSPrimitiveSphere{ 1470175 };
+		inline constexpr REL::ID BGSProcedureAcquire{ 988971 };
+		inline constexpr REL::ID BGSProcedureAcquireExecState{ 1288090 };
+		inline constexpr REL::ID BGSProcedureActivate{ 1120619 };
+		inline constexpr REL::ID BGSProcedureActivateExecState{ 1419373 };
+		inline constexpr REL::ID BGSProcedureBase{ 604046 };
+		inline constexpr REL::ID BGSProcedureDialogue{ 1424731 };
+		inline constexpr REL::ID BGSProcedureDialogueActivate{ 1211204 };
+		inline constexpr REL::ID BGSProcedureDialogueActivateExecState{ 146992 };
+		inline constexpr REL::ID BGSProcedureDialogueExecState{ 468253 };
+		inline constexpr REL::ID BGSProcedureDone{ 1156641 };
+		inline constexpr REL::ID BGSProcedureDoneExecState{ 1334983 };
+		inline constexpr REL::ID BGSProcedureEat{ 152455 };
+		inline constexpr REL::ID BGSProcedureEatExecState{ 109259 };
+		inline constexpr REL::ID BGSProcedureEscort{ 190833 };
+		inline constexpr REL::ID BGSProcedureEscortExecState{ 270154 };
+		inline constexpr REL::ID BGSProcedureFind{ 1418681 };
+		inline constexpr REL::ID BGSProcedureFindExecState{ 893505 };
+		inline constexpr REL::ID BGSProcedureFlee{ 1064925 };
+		inline constexpr REL::ID BGSProcedureFleeExecState{ 925021 };
+		inline constexpr REL::ID BGSProcedureFlightGrab{ 1289724 };
+		inline constexpr REL::ID BGSProcedureFlightGrabExecState{ 1368987 };
+		inline constexpr REL::ID BGSProcedureFollow{ 77531 };
+		inline constexpr REL::ID BGSProcedureFollowExecState{ 236572 };
+		inline constexpr REL::ID BGSProcedureFollowTo{ 157135 };
+		inline constexpr REL::ID BGSProcedureForceGreet{ 134800 };
+		inline constexpr REL::ID BGSProcedureGuard{ 1409541 };
+		inline constexpr REL::ID BGSProcedureGuardArea{ 1050539 };
+		inline constexpr REL::ID BGSProcedureGuardExecState{ 1349189 };
+		inline constexpr REL::ID BGSProcedureHeadtrack{ 118496 };
+		inline constexpr REL::ID BGSProcedureHeadtrackExecState{ 198261 };
+		inline constexpr REL::ID BGSProcedureHoldPosition{ 1340815 };
+		inline constexpr REL::ID BGSProcedureHoldPositionExecState{ 95420 };
+		inline constexpr REL::ID BGSProcedureHover{ 76817 };
+		inline constexpr REL::ID BGSProcedureHoverExecState{ 1299714 };
+		inline constexpr REL::ID BGSProcedureKeepAnEyeOn{ 1179004 };
+		inline constexpr REL::ID BGSProcedureKeepAnEyeOnExecState{ 1537945 };
+		inline constexpr REL::ID BGSProcedureLock{ 353386 };
+		inline constexpr REL::ID BGSProcedureLockUnlockExecState{ 292896 };
+		inline constexpr REL::ID BGSProcedureOrbit{ 18303 };
+		inline constexpr REL::ID BGSProcedureOrbitExecState{ 1241870 };
+		inline constexpr REL::ID BGSProcedurePatrol{ 183269 };
+		inline constexpr REL::ID BGSProcedurePatrolExecState{ 542569 };
+		inline constexpr REL::ID BGSProcedurePlayIdle{ 1379553 };
+		inline constexpr REL::ID BGSProcedurePlayIdleExecState{ 1459383 };
+		inline constexpr REL::ID BGSProcedurePursue{ 1378316 };
+		inline constexpr REL::ID BGSProcedureRange{ 1242409 };
+		inline constexpr REL::ID BGSProcedureRangeExecState{ 1102421 };
+		inline constexpr REL::ID BGSProcedureSandbox{ 1402920 };
+		inline constexpr REL::ID BGSProcedureSandboxExecState{ 180250 };
+		inline constexpr REL::ID BGSProcedureSay{ 92177 };
+		inline constexpr REL::ID BGSProcedureSayExecState{ 1178572 };
+		inline constexpr REL::ID BGSProcedureSit{ 895543 };
+		inline constexpr REL::ID BGSProcedureSitSleepExecState{ 396284 };
+		inline constexpr REL::ID BGSProcedureSleep{ 755906 };
+		inline constexpr REL::ID BGSProcedureStayAway{ 1014359 };
+		inline constexpr REL::ID BGSProcedureStayAwayExecState{ 1093967 };
+		inline constexpr REL::ID BGSProcedureTravel{ 1438163 };
+		inline constexpr REL::ID BGSProcedureTravelExecState{ 1517961 };
+		inline constexpr REL::ID BGSProcedureTreeBranch{ 490473 };
+		inline constexpr REL::ID BGSProcedureTreeConditionalItem{ 537386 };
+		inline constexpr REL::ID BGSProcedureTreeOneChildExecState{ 224744 };
+		inline constexpr REL::ID BGSProcedureTreeProcedure{ 1004669 };
+		inline constexpr REL::ID BGSProcedureTreeRandom{ 1406129 };
+		inline constexpr REL::ID BGSProcedureTreeRandomExecState{ 608421 };
+		inline constexpr REL::ID BGSProcedureTreeSequence{ 178154 };
+		inline constexpr REL::ID BGSProcedureTreeSequenceExecState{ 962126 };
+		inline constexpr REL::ID BGSProcedureTreeSimultaneous{ 323115 };
+		inline constexpr REL::ID BGSProcedureTreeSimultaneousExecState{ 1546337 };
+		inline constexpr REL::ID BGSProcedureTreeStacked{ 1041656 };
+		inline constexpr REL::ID BGSProcedureTreeStackedExecState{ 243721 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureAcquireParamTypes_{ 942534 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureActivateParamTypes_{ 1074081 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureDialogueActivateParamTypes_{ 1164374 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureDialogueParamTypes_{ 1378096 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureDoneParamTypes_{ 890668 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureEatParamTypes_{ 1468742 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureEscortParamTypes_{ 1507125 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureFindParamTypes_{ 933463 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureFleeParamTypes_{ 799224 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureFlightGrabParamTypes_{ 1023589 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureFollowParamTypes_{ 1393477 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureFollowToParamTypes_{ 1473466 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureForceGreetParamTypes_{ 88248 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureGuardAreaParamTypes_{ 1003728 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureGuardParamTypes_{ 924310 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureHeadtrackParamTypes_{ 1434622 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureHoldPositionParamTypes_{ 1294321 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureHoverParamTypes_{ 1173667 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureKeepAnEyeOnParamTypes_{ 1132297 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureLockParamTypes_{ 1450449 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureOrbitParamTypes_{ 1115516 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedurePatrolParamTypes_{ 1499716 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedurePlayIdleParamTypes_{ 1113766 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedurePursueParamTypes_{ 1112535 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureRangeParamTypes_{ 976093 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureSandboxParamTypes_{ 1136947 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureSayParamTypes_{ 1189048 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureSitParamTypes_{ 629731 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureSleepParamTypes_{ 270368 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureStayAwayParamTypes_{ 748751 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureTravelParamTypes_{ 1172232 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureUnlockParamTypes_{ 1530043 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureUseIdleMarkerParamTypes_{ 1210710 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureUseMagicParamTypes_{ 1501356 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureUseWeaponParamTypes_{ 1418190 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureWaitParamTypes_{ 938350 };
+		inline constexpr REL::ID BGSProcedureTyped_BGSProcedureBase_kProcedureWanderParamTypes_{ 990094 };
+		inline constexpr REL::ID BGSProcedureUnlock{ 1576654 };
+		inline constexpr REL::ID BGSProcedureUseIdleMarker{ 1476769 };
+		inline constexpr REL::ID BGSProcedureUseIdleMarkerExecState{ 1556125 };
+		inline constexpr REL::ID BGSProcedureUseMagic{ 1547676 };
+		inline constexpr REL::ID BGSProcedureUseMagicExecState{ 264240 };
+		inline constexpr REL::ID BGSProcedureUseWeapon{ 102183 };
+		inline constexpr REL::ID BGSProcedureUseWeaponExecState{ 181868 };
+		inline constexpr REL::ID BGSProcedureWait{ 1423592 };
+		inline constexpr REL::ID BGSProcedureWaitExecState{ 600070 };
+		inline constexpr REL::ID BGSProcedureWander{ 1036887 };
+		inline constexpr REL::ID BGSProcedureWanderExecState{ 1335651 };
+		inline constexpr REL::ID BGSProjectile{ 149401 };
+		inline constexpr REL::ID BGSPropertySheet{ 1336869 };
+		inline constexpr REL::ID BGSQuestPerkEntry{ 98058 };
+		inline constexpr REL::ID BGSQueuedGrassModelHandles{ 1514565 };
+		inline constexpr REL::ID BGSQueuedObjectDowngrade{ 1150406 };
+		inline constexpr REL::ID BGSQueuedObjectInitialLoad{ 884490 };
+		inline constexpr REL::ID BGSQueuedObjectUpgrade{ 1416325 };
+		inline constexpr REL::ID BGSQueuedTerrainDowngrade{ 146964 };
+		inline constexpr REL::ID BGSQueuedTerrainInitialLoad{ 1463298 };
+		inline constexpr REL::ID BGSQueuedTerrainUpdate{ 679357 };
+		inline constexpr REL::ID BGSQueuedTerrainUpgrade{ 412725 };
+		inline constexpr REL::ID BGSRefAlias{ 1334062 };
+		inline constexpr REL::ID BGSRefCollectionAlias{ 17596 };
+		inline constexpr REL::ID BGSReferenceEffect{ 436527 };
+		inline constexpr REL::ID BGSReferenceGroup{ 982961 };
+		inline constexpr REL::ID BGSRelationship{ 594428 };
+		inline constexpr REL::ID BGSRetargetOnDeleteExtraData{ 523100 };
+		inline constexpr REL::ID BGSReverbParameters{ 435742 };
+		inline constexpr REL::ID BGSSaveFormBuffer{ 192083 };
+		inline constexpr REL::ID BGSSaveGameBuffer{ 1288570 };
+		inline constexpr REL::ID BGSSaveLoadManager{ 685834 };
+		inline constexpr REL::ID BGSSaveLoadStatsMap{ 518157 };
+		inline constexpr REL::ID BGSSaveLoadThread{ 419336 };
+		inline constexpr REL::ID BGSScene{ 778732 };
+		inline constexpr REL::ID BGSSceneAction{ 867792 };
+		inline constexpr REL::ID BGSSceneActionConversationBase{ 382557 };
+		inline constexpr REL::ID BGSSceneActionDialogue{ 599702 };
+		inline constexpr REL::ID BGSSceneActionNPCResponseDialogue{ 67616 };
+		inline constexpr REL::ID BGSSceneActionPackage{ 333571 };
+		inline constexpr REL::ID BGSSceneActionPlayerDialogue{ 635103 };
+		inline constexpr REL::ID BGSSceneActionRadio{ 20471 };
+		inline constexpr REL::ID BGSSceneActionStartScene{ 448133 };
+		inline constexpr REL::ID BGSSceneActionTimer{ 791626 };
+		inline constexpr REL::ID BGSShaderParticleGeometryData{ 610280 };
+		inline constexpr REL::ID BGSSkinForm{ 688108 };
+		inline constexpr REL::ID BGSSoundCategory{ 1137721 };
+		inline constexpr REL::ID BGSSoundCategorySnapshot{ 1281560 };
+		inline constexpr REL::ID BGSSoundDescriptor{ 1298311 };
+		inline constexpr REL::ID BGSSoundDescriptorForm{ 761216 };
+		inline constexpr REL::ID BGSSoundKeywordMapping{ 829092 };
+		inline constexpr REL::ID BGSSoundOutput{ 40725 };
+		inline constexpr REL::ID BGSSoundOutput__DynamicAttenuationCharacteristics{ 784295 };
+		inline constexpr REL::ID BGSSoundTagComponent{ 319694 };
+		inline constexpr REL::ID BGSSoundTagSet{ 805338 };
+		inline constexpr REL::ID BGSStandardSoundDef{ 18493 };
+		inline constexpr REL::ID BGSStandardSoundDef__SoundPlaybackCharacteristics{ 1554729 };
+		inline constexpr REL::ID BGSStaticCollection{ 348224 };
+		inline constexpr REL::ID BGSStaticCollection__RootFacade{ 82412 };
+		inline constexpr REL::ID BGSStoryManager{ 1368951 };
+		inline constexpr REL::ID BGSStoryManagerBranchNode{ 26964 };
+		inline constexpr REL::ID BGSStoryManagerEventNode{ 1561342 };
+		inline constexpr REL::ID BGSStoryManagerNodeBase{ 1343435 };
+		inline constexpr REL::ID BGSStoryManagerQuestFinder{ 1415622 };
+		inline constexpr REL::ID BGSStoryManagerQuestNode{ 403705 };
+		inline constexpr REL::ID BGSStoryManagerTreeForm{ 1077570 };
+		inline constexpr REL::ID BGSStoryManagerTreeVisitor{ 1462602 };
+		inline constexpr REL::ID BGSStoryTeller{ 1580310 };
+		inline constexpr REL::ID BGSSynchronizedAnimationInstance{ 299011 };
+		inline constexpr REL::ID BGSSynchronizedAnimationManager{ 425099 };
+		inline constexpr REL::ID BGSTalkingActivator{ 1370873 };
+		inline constexpr REL::ID BGSTerminal{ 991342 };
+		inline constexpr REL::ID BGSTerrainVisibilityDataDB__DBTraits{ 1043466 };
+		inline constexpr REL::ID BGSTextureModel{ 1360667 };
+		inline constexpr REL::ID BGSTextureSet{ 228417 };
+		inline constexpr REL::ID BGSTransform{ 506242 };
+		inline constexpr REL::ID BGSTypedItem_BGSAIWorldLocationInteriorCell_BGSAIWorldLocation_{ 1423889 };
+		inline constexpr REL::ID BGSTypedItem_BGSAIWorldLocationPointRadius_BGSAIWorldLocation_{ 359948 };
+		inline constexpr REL::ID BGSTypedItem_BGSAIWorldLocationPrimitive_BGSAIWorldLocation_{ 173834 };
+		inline constexpr REL::ID BGSTypedItem_BGSAIWorldLocationRefRadius_BGSAIWorldLocation_{ 159970 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureAcquireExecState_IProcedureTreeExecState_{ 1461012 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureActivateExecState_IProcedureTreeExecState_{ 9550 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureDialogueActivateExecState_IProcedureTreeExecState_{ 539277 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureDialogueExecState_IProcedureTreeExecState_{ 641419 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureDoneExecState_IProcedureTreeExecState_{ 1069134 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureEatExecState_IProcedureTreeExecState_{ 1425220 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureEscortExecState_IProcedureTreeExecState_{ 442550 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureFindExecState_IProcedureTreeExecState_{ 627680 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureFleeExecState_IProcedureTreeExecState_{ 878428 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureFlightGrabExecState_IProcedureTreeExecState_{ 1542072 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureFollowExecState_IProcedureTreeExecState_{ 409041 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureGuardExecState_IProcedureTreeExecState_{ 1522425 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureHeadtrackExecState_IProcedureTreeExecState_{ 370718 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureHoldPositionExecState_IProcedureTreeExecState_{ 268290 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureHoverExecState_IProcedureTreeExecState_{ 1253239 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureKeepAnEyeOnExecState_IProcedureTreeExecState_{ 1491528 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureLockUnlockExecState_IProcedureTreeExecState_{ 465584 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureOrbitExecState_IProcedureTreeExecState_{ 1195168 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedurePatrolExecState_IProcedureTreeExecState_{ 715493 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedurePlayIdleExecState_IProcedureTreeExecState_{ 49662 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureRangeExecState_IProcedureTreeExecState_{ 1055682 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureSandboxExecState_IProcedureTreeExecState_{ 352665 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureSayExecState_IProcedureTreeExecState_{ 1131814 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureSitSleepExecState_IProcedureTreeExecState_{ 349607 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureStayAwayExecState_IProcedureTreeExecState_{ 1266783 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTravelExecState_IProcedureTreeExecState_{ 108285 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeProcedure_BGSProcedureTreeConditionalItem_{ 958212 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeRandomExecState_BGSProcedureTreeOneChildExecState_{ 561864 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeRandom_BGSProcedureTreeBranch_{ 1359437 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeSequenceExecState_BGSProcedureTreeOneChildExecState_{ 1134875 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeSequence_BGSProcedureTreeBranch_{ 1494561 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeSimultaneousExecState_IProcedureTreeExecState_{ 136669 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeSimultaneous_BGSProcedureTreeBranch_{ 495836 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeStackedExecState_BGSProcedureTreeOneChildExecState_{ 416253 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureTreeStacked_BGSProcedureTreeBranch_{ 775961 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureUseIdleMarkerExecState_IProcedureTreeExecState_{ 146482 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureUseMagicExecState_IProcedureTreeExecState_{ 436691 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureUseWeaponExecState_IProcedureTreeExecState_{ 354298 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureWaitExecState_IProcedureTreeExecState_{ 333947 };
+		inline constexpr REL::ID BGSTypedItem_BGSProcedureWanderExecState_IProcedureTreeExecState_{ 1508941 };
+		inline constexpr REL::ID BGSTypedKeywordValueArray_2_{ 953442 };
+		inline constexpr REL::ID BGSVisitProceduresCheckGuardWarnTarget{ 995530 };
+		inline constexpr REL::ID BGSVisitProceduresInitActorAnimPose{ 215424 };
+		inline constexpr REL::ID BGSVisitProceduresInitActorLocation{ 823055 };
+		inline constexpr REL::ID BGSVisitProceduresProcess{ 481208 };
+		inline constexpr REL::ID BGSVoiceType{ 289230 };
+		inline constexpr REL::ID BGSWaterCollisionManager__AutoWater{ 960956 };
+		inline constexpr REL::ID BGSWaterCollisionManager__BGSWaterUpdateI{ 3367 };
+		inline constexpr REL::ID BGSWaterCollisionManager__bhkPlaceableWater{ 396061 };
+		inline constexpr REL::ID BGSWaterCollisionManager__bhkWaterfall{ 788508 };
+		inline constexpr REL::ID BGSZoneTargetListener{ 65460 };
+		inline constexpr REL::ID BGSZoomData{ 326167 };
+		inline constexpr REL::ID BGShkMatFadeController{ 587003 };
+		inline constexpr REL::ID BGShkPhonemeController{ 953641 };
+		inline constexpr REL::ID BSAlignBoneModifier{ 1344048 };
+		inline constexpr REL::ID BSAlignBoneModifierInterface{ 1044378 };
+		inline constexpr REL::ID BSAnimGraphVisit__BShkbVisitor{ 1517011 };
+		inline constexpr REL::ID BSAnimNote{ 825404 };
+		inline constexpr REL::ID BSAnimNotes{ 1310616 };
+		inline constexpr REL::ID BSAnimationDBData{ 27250 };
+		inline constexpr REL::ID BSAnimationGraphChannel{ 621953 };
+		inline constexpr REL::ID BSAnimationGraphLoadScrapper{ 960394 };
+		inline constexpr REL::ID BSAnimationGraphManager{ 930533 };
+		inline constexpr REL::ID BSArchive{ 655707 };
+		inline constexpr REL::ID BSArchiveHeader{ 1533036 };
+		inline constexpr REL::ID BSArrowConstructor{ 1481710 };
+		inline constexpr REL::ID BSAssignVariablesModifier{ 107543 };
+		inline constexpr REL::ID BSAttachRefController{ 1316248 };
+		inline constexpr REL::ID BSAttachTechniques__AttachTechniqueInput{ 1186791 };
+		inline constexpr REL::ID BSAttachTechniques__BSAttachTechnique{ 1054050 };
+		inline constexpr REL::ID BSAudio{ 954790 };
+		inline constexpr REL::ID BSAudioDataSrcBase{ 748699 };
+		inline constexpr REL::ID BSAudioDataSrc_BSXAudio2DataSrc_{ 1047313 };
+		inline constexpr REL::ID BSAudioEffects__BSDelayEffectParams{ 502212 };
+		inline constexpr REL::ID BSAudioEffects__BSOverdriveParams{ 156915 };
+		inline constexpr REL::ID BSAudioEffects__BSStateVariableFilterParams{ 110140 };
+		inline constexpr REL::ID BSAudioListener{ 150826 };
+		inline constexpr REL::ID BSAudioManagerThread{ 123916 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_AnimationSystemUtils__TESModelAndAnimationHandles_{ 540956 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_BSFaceGenDB__TRI__QueuedHandles_{ 1564689 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_BSMaterialDB__QueuedHandles_{ 1461503 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_BSTextureDB__QueuedHandlesWithCallback_{ 1311370 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_BSTextureDB__QueuedHandles_{ 261194 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_BShkbHkxDB__QueuedHandles_{ 779684 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection_TESModelDB__TESQueuedHandles_{ 362009 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection___QueuedBGSStaticCollection_{ 21527 };
+		inline constexpr REL::ID BSAutoQueuedResourceCollection___QueuedSubBehaviorHandles_{ 596942 };
+		inline constexpr REL::ID BSAwardsSystemUtility{ 1259146 };
+		inline constexpr REL::ID BSBatchRenderer{ 192887 };
+		inline constexpr REL::ID BSBehaviorGraphExtraData{ 985051 };
+		inline constexpr REL::ID BSBehaviorGraphSwapGenerator{ 772960 };
+		inline constexpr REL::ID BSBehaviorGraphSwapSingleton{ 4432 };
+		inline constexpr REL::ID BSBlastNode{ 69642 };
+		inline constexpr REL::ID BSBlendTreadTransfInterpolator{ 678151 };
+		inline constexpr REL::ID BSBloodSplatterShader{ 377392 };
+		inline constexpr REL::ID BSBloodSplatterShaderProperty{ 204818 };
+		inline constexpr REL::ID BSBoneLODExtraData{ 1538847 };
+		inline constexpr REL::ID BSBoneMap{ 1097708 };
+		inline constexpr REL::ID BSBoneSwitchGenerator{ 579236 };
+		inline constexpr REL::ID BSBoneSwitchGeneratorBoneData{ 46942 };
+		inline constexpr REL::ID BSBound{ 532908 };
+		inline constexpr REL::ID BSBoxConstructor{ 1448583 };
+		inline constexpr REL::ID BSByteBuffer{ 607942 };
+		inline constexpr REL::ID BSCXAPOWrapper{ 1087813 };
+		inline constexpr REL::ID BSCacheDriveSystemUtility{ 1516043 };
+		inline constexpr REL::ID BSCapsuleConstructor{ 165249 };
+		inline constexpr REL::ID BSCircleConstructor{ 1215638 };
+		inline constexpr REL::ID BSClearZNode{ 214162 };
+		inline constexpr REL::ID BSCloneReserver{ 1050313 };
+		inline constexpr REL::ID BSClothExtraData{ 527027 };
+		inline constexpr REL::ID BSClothUtils__BSInstantiationUtil{ 686261 };
+		inline constexpr REL::ID BSClothUtils__BSTransformSet{ 639478 };
+		inline constexpr REL::ID BSClothUtils__BSTriShapeBuffer{ 592877 };
+		inline constexpr REL::ID BSCombinedNode{ 1343522 };
+		inline constexpr REL::ID BSCombinedTriShape{ 633908 };
+		inline constexpr REL::ID BSCompanionAutodiscover{ 1513144 };
+		inline constexpr REL::ID BSCompanionConnection{ 734327 };
+		inline constexpr REL::ID BSCompanionDirectConnection{ 1364249 };
+		inline constexpr REL::ID BSCompanionDirectListener{ 48185 };
+		inline constexpr REL::ID BSCompanionIListener{ 682414 };
+		inline constexpr REL::ID BSCompanionService_PipboyCompanionService_{ 331286 };
+		inline constexpr REL::ID BSCompanionSocket{ 1317867 };
+		inline constexpr REL::ID BSCompanionThread{ 415761 };
+		inline constexpr REL::ID BSComputeAddBoneAnimModifier{ 1097407 };
+		inline constexpr REL::ID BSComputeShader{ 680006 };
+		inline constexpr REL::ID BSConnectPoint__ChildOrigin{ 760093 };
+		inline constexpr REL::ID BSConnectPoint__Children{ 577356 };
+		inline constexpr REL::ID BSConnectPoint__Parents{ 311239 };
+		inline constexpr REL::ID BSCounterStorage{ 414736 };
+		inline constexpr REL::ID BSCubeMapCamera{ 1009479 };
+		inline constexpr REL::ID BSCullingProcess{ 234013 };
+		inline constexpr REL::ID BSCyclicBlendTransitionGenerator{ 784941 };
+		inline constexpr REL::ID BSCylinderConstructor{ 430846 };
+		inline constexpr REL::ID BSD3DResourceCreator{ 712261 };
+		inline constexpr REL::ID BSDFCompositeShader{ 1270348 };
+		inline constexpr REL::ID BSDFLightShader{ 93240 };
+		inline constexpr REL::ID BSDFPrePassShader{ 1287092 };
+		inline constexpr REL::ID BSDamageStage{ 681469 };
+		inline constexpr REL::ID BSDebrisNode{ 1166448 };
+		inline constexpr REL::ID BSDecomposeVectorModifier{ 738403 };
+		inline constexpr REL::ID BSDeferredDecal__BSDFDecal{ 95315 };
+		inline constexpr REL::ID BSDirectAtCapturePoseModifier{ 471874 };
+		inline constexpr REL::ID BSDirectAtModifier{ 425290 };
+		inline constexpr REL::ID BSDirectAtModifierInterface{ 559424 };
+		inline constexpr REL::ID BSDirectoryMonitorThread{ 100918 };
+		inline constexpr REL::ID BSDiscBootSystemUtility{ 718165 };
+		inline constexpr REL::ID BSDiskConstructor{ 198179 };
+		inline constexpr REL::ID BSDismember__BSShaderDismembermentExtraData{ 717269 };
+		inline constexpr REL::ID BSDismembermentExtraData{ 788793 };
+		inline constexpr REL::ID BSDismembermentLimbExtraData{ 835198 };
+		inline constexpr REL::ID BSDistTriggerModifier{ 159616 };
+		inline constexpr REL::ID BSDistantObjectInstanceDataBlock{ 367615 };
+		inline constexpr REL::ID BSDistantTreeShader{ 1541755 };
+		inline constexpr REL::ID BSDistantTreeShaderProperty{ 5412 };
+		inline constexpr REL::ID BSDoorHavokController{ 1468259 };
+		inline constexpr REL::ID BSDynPosData{ 1054474 };
+		inline constexpr REL::ID BSDynamicLines{ 887474 };
+		inline constexpr REL::ID BSDynamicTriShape{ 911659 };
+		inline constexpr REL::ID BSEffectShader{ 491262 };
+		inline constexpr REL::ID BSEffectShaderMaterial{ 1023261 };
+		inline constexpr REL::ID BSEffectShaderProperty{ 1358328 };
+		inline constexpr REL::ID BSEffectShaderPropertyColorController{ 756981 };
+		inline constexpr REL::ID BSEffectShaderPropertyFloatController{ 1554900 };
+		inline constexpr REL::ID BSEventEveryNEventsModifier{ 1476010 };
+		inline constexpr REL::ID BSEventOnDeactivateModifier{ 1428908 };
+		inline constexpr REL::ID BSEventOnFalseToTrueModifier{ 1382265 };
+		inline constexpr REL::ID BSExternalAudioIO__ExternalIOInterface{ 123206 };
+		inline constexpr REL::ID BSExtraData{ 967062 };
+		inline constexpr REL::ID BSEyeCenterExtraData{ 858314 };
+		inline constexpr REL::ID BSFaceCustomizationShader{ 1289406 };
+		inline constexpr REL::ID BSFaceGenAnimationData{ 731553 };
+		inline constexpr REL::ID BSFaceGenBaseMorphExtraData{ 799460 };
+		inline constexpr REL::ID BSFaceGenDB__FG__DBTraits{ 316893 };
+		inline constexpr REL::ID BSFaceGenDB__TRI__DBTraits{ 624340 };
+		inline constexpr REL::ID BSFaceGenDB__TRI__QueuedHandles{ 122033 };
+		inline constexpr REL::ID BSFaceGenModel{ 813155 };
+		inline constexpr REL::ID BSFaceGenModelExtraData{ 327603 };
+		inline constexpr REL::ID BSFaceGenModelMap__Entry{ 280984 };
+		inline constexpr REL::ID BSFaceGenMorphData{ 14541 };
+		inline constexpr REL::ID BSFaceGenMorphDataHair{ 1065189 };
+		inline constexpr REL::ID BSFaceGenMorphDataHead{ 1331109 };
+		inline constexpr REL::ID BSFaceGenNiNode{ 706470 };
+		inline constexpr REL::ID BSFaceGenPendingHeadData{ 765931 };
+		inline constexpr REL::ID BSFadeNode{ 35452 };
+		inline constexpr REL::ID BSFadeNodeCuller{ 1070541 };
+		inline constexpr REL::ID BSFile{ 104321 };
+		inline constexpr REL::ID BSFile__PageCache__PhysReadType{ 981583 };
+		inline constexpr REL::ID BSFlatQuadConstructor{ 463658 };
+		inline constexpr REL::ID BSFlattenedBoneTree{ 1062867 };
+		inline constexpr REL::ID BSFogProperty{ 1310749 };
+		inline constexpr REL::ID BSFrustumFOVController{ 1296885 };
+		inline constexpr REL::ID BSFurnitureMarkerNode{ 686720 };
+		inline constexpr REL::ID BSGFxDisplayObject{ 687788 };
+		inline constexpr REL::ID BSGFxFunctionBase{ 939691 };
+		inline constexpr REL::ID BSGFxFunctionHandler{ 509626 };
+		inline constexpr REL::ID BSGFxObject{ 421332 };
+		inline constexpr REL::ID BSGFxShaderFXTarget{ 953540 };
+		inline constexpr REL::ID BSGameDataSystemUtility{ 166821 };
+		inline constexpr REL::ID BSGameSound{ 998117 };
+		inline constexpr REL::ID BSGameStreamUtility{ 1562689 };
+		inline constexpr REL::ID BSGamepadDevice{ 452554 };
+		inline constexpr REL::ID BSGeometry{ 97498 };
+		inline constexpr REL::ID BSGeometryListCullingProcess{ 1393855 };
+		inline constexpr REL::ID BSGeometrySegmentData{ 717829 };
+		inline constexpr REL::ID BSGetTimeStepModifier{ 1335593 };
+		inline constexpr REL::ID BSGrabIKNote{ 339886 };
+		inline constexpr REL::ID BSGraphics__ResourceCacheAllocator{ 405823 };
+		inline constexpr REL::ID BSGrassShaderProperty{ 898723 };
+		inline constexpr REL::ID BSHandleRefObject{ 782432 };
+		inline constexpr REL::ID BSIAlignBoneModifierSingleton{ 997593 };
+		inline constexpr REL::ID BSIAudioEffectChain{ 1186088 };
+		inline constexpr REL::ID BSIAudioEffectParameters{ 422619 };
+		inline constexpr REL::ID BSIAudioEffectVisitorBase{ 595027 };
+		inline constexpr REL::ID BSIAudioEffectVisitor_std__reference_wrapper__lambda_f37815d38aa05819f55cde481fa665d1_const__{ 328778 };
+		inline constexpr REL::ID BSIDirectAtModifierSingleton{ 512625 };
+		inline constexpr REL::ID BSIFootIkRaycastInterfaceDB{ 1086400 };
+		inline constexpr REL::ID BSILimbIKModifierSingleton{ 575946 };
+		inline constexpr REL::ID BSILookAtModifierSingleton{ 219006 };
+		inline constexpr REL::ID BSIMusicTrack{ 1014765 };
+		inline constexpr REL::ID BSIMusicType{ 839099 };
+		inline constexpr REL::ID BSIOStreamTraits{ 1484780 };
+		inline constexpr REL::ID BSIPassByTargetTriggerModifierSingleton{ 172757 };
+		inline constexpr REL::ID BSIRagdollContactListenerModifierSingleton{ 1019380 };
+		inline constexpr REL::ID BSIRagdollDriver{ 847991 };
+		inline constexpr REL::ID BSIRagdollDriverSingleton{ 880181 };
+		inline constexpr REL::ID BSIReverbType{ 167422 };
+		inline constexpr REL::ID BSISoundCategory{ 1563238 };
+		inline constexpr REL::ID BSISoundDescriptor{ 1564677 };
+		inline constexpr REL::ID BSISoundDescriptor__BSIPlaybackCharacteristics{ 1209255 };
+		inline constexpr REL::ID BSISoundOutputModel{ 438295 };
+		inline constexpr REL::ID BSISoundOutputModel__BSIAttenuationCharacteristics{ 172796 };
+		inline constexpr REL::ID BSIStateManagerModifier{ 1069756 };
+		inline constexpr REL::ID BSIStateManagerModifier__BSIStateManagerStateListener{ 380647 };
+		inline constexpr REL::ID BSIStream{ 214941 };
+		inline constexpr REL::ID BSIdleInputWatcher{ 1266886 };
+		inline constexpr REL::ID BSImagespaceComputeShader{ 102103 };
+		inline constexpr REL::ID BSImagespaceShader{ 1048361 };
+		inline constexpr REL::ID BSImagespaceShaderAlphaBlend{ 250411 };
+		inline constexpr REL::ID BSImagespaceShaderAmbientOcclusion{ 1381546 };
+		inline constexpr REL::ID BSImagespaceShaderAmbientOcclusionBlur{ 1554675 };
+		inline constexpr REL::ID BSImagespaceShaderBlur11{ 722370 };
+		inline constexpr REL::ID BSImagespaceShaderBlur13{ 455721 };
+		inline constexpr REL::ID BSImagespaceShaderBlur15{ 190259 };
+		inline constexpr REL::ID BSImagespaceShaderBlur3{ 203888 };
+		inline constexpr REL::ID BSImagespaceShaderBlur5{ 1520222 };
+		inline constexpr REL::ID BSImagespaceShaderBlur7{ 1254046 };
+		inline constexpr REL::ID BSImagespaceShaderBlur9{ 987760 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX11_480CS{ 88396 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX13_480CS{ 134954 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX15_480CS{ 181787 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX3_480CS{ 1484453 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX5_480CS{ 1530899 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX7_480CS{ 1577498 };
+		inline constexpr REL::ID BSImagespaceShaderBlurX9_480CS{ 41527 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY11_270CS{ 1344025 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY13_270CS{ 1390595 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY15_270CS{ 1437349 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY3_270CS{ 1157740 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY5_270CS{ 1204552 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY7_270CS{ 1251147 };
+		inline constexpr REL::ID BSImagespaceShaderBlurY9_270CS{ 1297501 };
+		inline constexpr REL::ID BSImagespaceShaderBokehDepthOfFieldPass1{ 1452967 };
+		inline constexpr REL::ID BSImagespaceShaderBokehDepthOfFieldPass2{ 43178 };
+		inline constexpr REL::ID BSImagespaceShaderBokehDepthOfFieldPass3{ 216219 };
+		inline constexpr REL::ID BSImagespaceShaderBokehDepthOfFieldPass4{ 388745 };
+		inline constexpr REL::ID BSImagespaceShaderBokehDepthOfFieldPass4Fogged{ 781174 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur11{ 993115 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur13{ 1166143 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur15{ 1338640 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur3{ 1179853 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur5{ 1133149 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur7{ 1086565 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlur9{ 1039857 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY11_270CS{ 126592 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY13_270CS{ 1536240 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY15_270CS{ 1363003 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY3_270CS{ 817632 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY5_270CS{ 645039 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY7_270CS{ 471854 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassBlurY9_270CS{ 299179 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassHDRBlurY15_1024CS{ 752076 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassHDRBlurY15_180CS{ 1111088 };
+		inline constexpr REL::ID BSImagespaceShaderBrightPassHDRBlurY15_270CS{ 140285 };
+		inline constexpr REL::ID BSImagespaceShaderCopy{ 990021 };
+		inline constexpr REL::ID BSImagespaceShaderCopyParam{ 1347275 };
+		inline constexpr REL::ID BSImagespaceShaderCopyScaleBias{ 724669 };
+		inline constexpr REL::ID BSImagespaceShaderCopyShadowMapToArray{ 397831 };
+		inline constexpr REL::ID BSImagespaceShaderCopyStencil{ 491043 };
+		inline constexpr REL::ID BSImagespaceShaderCopyVisAlpha{ 678070 };
+		inline constexpr REL::ID BSImagespaceShaderCopyWaterMask{ 444286 };
+		inline constexpr REL::ID BSImagespaceShaderDepthOfField{ 570850 };
+		inline constexpr REL::ID BSImagespaceShaderDepthOfFieldFogged{ 524092 };
+		inline constexpr REL::ID BSImagespaceShaderDepthOfFieldSplitScreen{ 697223 };
+		inline constexpr REL::ID BSImagespaceShaderDistantBlur{ 869326 };
+		inline constexpr REL::ID BSImagespaceShaderDistantBlurFogged{ 822981 };
+		inline constexpr REL::ID BSImagespaceShaderDoubleVision{ 995452 };
+		inline constexpr REL::ID BSImagespaceShaderDownsampleDepth{ 538010 };
+		inline constexpr REL::ID BSImagespaceShaderFXAA{ 902428 };
+		inline constexpr REL::ID BSImagespaceShaderFullScreenColor{ 949007 };
+		inline constexpr REL::ID BSImagespaceShaderGammaCorrect{ 1154633 };
+		inline constexpr REL::ID BSImagespaceShaderGammaCorrectLUT{ 1234282 };
+		inline constexpr REL::ID BSImagespaceShaderGammaCorrectResize{ 1108030 };
+		inline constexpr REL::ID BSImagespaceShaderGammaLinearize{ 1280803 };
+		inline constexpr REL::ID BSImagespaceShaderGreyScale{ 584663 };
+		inline constexpr REL::ID BSImagespaceShaderHDRBlurX15_1024CS{ 8303 };
+		inline constexpr REL::ID BSImagespaceShaderHDRBlurX15_320CS{ 1511835 };
+		inline constexpr REL::ID BSImagespaceShaderHDRBlurX15_480CS{ 1418122 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample16{ 1486727 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample16LightAdapt{ 814658 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample16Lum{ 1140905 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample16LumCS{ 1192952 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample16LumClamp{ 29924 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample2LightAdaptCS{ 614427 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample4{ 1187584 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample4CS{ 847338 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample4LightAdapt{ 203185 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample4LumCS{ 1020058 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample4LumClamp{ 1439679 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample4RGB2Lum{ 1313580 };
+		inline constexpr REL::ID BSImagespaceShaderHDRDownSample64RGB2LumCS{ 2153 };
+		inline constexpr REL::ID BSImagespaceShaderHDRTonemapBlendCinematic{ 1425834 };
+		inline constexpr REL::ID BSImagespaceShaderHDRTonemapBlendCinematicFade{ 455005 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlass{ 1343316 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlassBlurX{ 1422753 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlassBlurY{ 1469819 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlassClear{ 1329580 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlassCopy{ 1283101 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlassDropShadow{ 1296791 };
+		inline constexpr REL::ID BSImagespaceShaderHUDGlassMarkers{ 1376124 };
+		inline constexpr REL::ID BSImagespaceShaderLensFlare{ 207843 };
+		inline constexpr REL::ID BSImagespaceShaderLensFlareVisibility{ 161232 };
+		inline constexpr REL::ID BSImagespaceShaderLocalMap{ 1006228 };
+		inline constexpr REL::ID BSImagespaceShaderLocalMapCompanion{ 959759 };
+		inline constexpr REL::ID BSImagespaceShaderMap{ 1132454 };
+		inline constexpr REL::ID BSImagespaceShaderModMenuEffect{ 1255669 };
+		inline constexpr REL::ID BSImagespaceShaderModMenuGlowComposite{ 1209195 };
+		inline constexpr REL::ID BSImagespaceShaderMotionBlur{ 144940 };
+		inline constexpr REL::ID BSImagespaceShaderNoiseNormalmap{ 1039157 };
+		inline constexpr REL::ID BSImagespaceShaderNoiseScrollAndBlend{ 866334 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur11{ 1319583 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur13{ 1273157 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur15{ 1226658 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur3{ 1506569 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur5{ 1459723 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur7{ 1412759 };
+		inline constexpr REL::ID BSImagespaceShaderNonHDRBlur9{ 1366042 };
+		inline constexpr REL::ID BSImagespaceShaderPipboyScreen{ 1389877 };
+		inline constexpr REL::ID BSImagespaceShaderRadialBlur{ 992380 };
+		inline constexpr REL::ID BSImagespaceShaderRadialBlurHigh{ 1118678 };
+		inline constexpr REL::ID BSImagespaceShaderRadialBlurMedium{ 945968 };
+		inline constexpr REL::ID BSImagespaceShaderRainSplash{ 1173113 };
+		inline constexpr REL::ID BSImagespaceShaderRainSplashDraw{ 1299155 };
+		inline constexpr REL::ID BSImagespaceShaderRainSplashUpdate{ 1126330 };
+		inline constexpr REL::ID BSImagespaceShaderRefraction{ 1072077 };
+		inline constexpr REL::ID BSImagespaceShaderSAOBlurH{ 1540824 };
+		inline constexpr REL::ID BSImagespaceShaderSAOBlurHCS{ 1433505 };
+		inline constexpr REL::ID BSImagespaceShaderSAOBlurV{ 1494430 };
+		inline constexpr REL::ID BSImagespaceShaderSAOBlurVCS{ 1386889 };
+		inline constexpr REL::ID BSImagespaceShaderSAOCameraAndMipsZCS{ 1400718 };
+		inline constexpr REL::ID BSImagespaceShaderSAOCameraZ{ 98336 };
+		inline constexpr REL::ID BSImagespaceShaderSAOCameraZCS{ 1447519 };
+		inline constexpr REL::ID BSImagespaceShaderSAOMinify{ 51615 };
+		inline constexpr REL::ID BSImagespaceShaderSAOMinifyCS{ 1527159 };
+		inline constexpr REL::ID BSImagespaceShaderSAOMipsZCS{ 1573813 };
+		inline constexpr REL::ID BSImagespaceShaderSAORawAO{ 4506 };
+		inline constexpr REL::ID BSImagespaceShaderSAORawAOCS{ 1480709 };
+		inline constexpr REL::ID BSImagespaceShaderSAORawAOEditor{ 1340258 };
+		inline constexpr REL::ID BSImagespaceShaderSSLRBlurH{ 1293808 };
+		inline constexpr REL::ID BSImagespaceShaderSSLRBlurV{ 1247438 };
+		inline constexpr REL::ID BSImagespaceShaderSSLRPrepass{ 1153895 };
+		inline constexpr REL::ID BSImagespaceShaderSSLRRaytracing{ 1200733 };
+		inline constexpr REL::ID BSImagespaceShaderSunbeams{ 1107321 };
+		inline constexpr REL::ID BSImagespaceShaderTemporalAA{ 636599 };
+		inline constexpr REL::ID BSImagespaceShaderTemporalAAPipboy{ 590030 };
+		inline constexpr REL::ID BSImagespaceShaderTemporalAAPowerArmorPipboy{ 762780 };
+		inline constexpr REL::ID BSImagespaceShaderTextureMask{ 631316 };
+		inline constexpr REL::ID BSImagespaceShaderUpsampleDynamicResolution{ 1060637 };
+		inline constexpr REL::ID BSImagespaceShaderVLSApplication{ 1348668 };
+		inline constexpr REL::ID BSImagespaceShaderVLSComposite{ 1302109 };
+		inline constexpr REL::ID BSImagespaceShaderVLSScatterAccum{ 1442084 };
+		inline constexpr REL::ID BSImagespaceShaderVLSSliceCoord{ 1236640 };
+		inline constexpr REL::ID BSImagespaceShaderVLSSliceInterp{ 1189897 };
+		inline constexpr REL::ID BSImagespaceShaderVLSSliceScatterInterp{ 1269394 };
+		inline constexpr REL::ID BSImagespaceShaderVLSSliceScatterRay{ 1096679 };
+		inline constexpr REL::ID BSImagespaceShaderVLSSliceStencil{ 1143175 };
+		inline constexpr REL::ID BSImagespaceShaderVLSSpotLight{ 1395264 };
+		inline constexpr REL::ID BSImagespaceShaderVatsTarget{ 296809 };
+		inline constexpr REL::ID BSImagespaceShaderVatsTargetDebug{ 1094995 };
+		inline constexpr REL::ID BSImagespaceShaderWaterBlendHeightmaps{ 432838 };
+		inline constexpr REL::ID BSImagespaceShaderWaterDisplacementClearSimulation{ 1025358 };
+		inline constexpr REL::ID BSImagespaceShaderWaterDisplacementNormals{ 997769 };
+		inline constexpr REL::ID BSImagespaceShaderWaterDisplacementRainRipple{ 1277783 };
+		inline constexpr REL::ID BSImagespaceShaderWaterDisplacementTexOffset{ 54672 };
+		inline constexpr REL::ID BSImagespaceShaderWaterDisplacementWadingRipple{ 666504 };
+		inline constexpr REL::ID BSImagespaceShaderWaterRainHeightmap{ 260352 };
+		inline constexpr REL::ID BSImagespaceShaderWaterSmoothHeightmap{ 605980 };
+		inline constexpr REL::ID BSImagespaceShaderWaterWadingHeightmap{ 87677 };
+		inline constexpr REL::ID BSInputDevice{ 938127 };
+		inline constexpr REL::ID BSInputEnableManager__DebugNameFunctor__lambda_0183a1083b444b9fd1a5d528e2445cea__{ 1171584 };
+		inline constexpr REL::ID BSInputEnableManager__DebugNameFunctor__lambda_2633b694cf8b2a29ef2701e4269a0982__{ 758799 };
+		inline constexpr REL::ID BSInputEnableManager__DebugNameFunctor__lambda_3f64572034d41d0f53dacb1f094581f4__{ 513083 };
+		inline constexpr REL::ID BSInputEnableManager__DebugNameFunctor__lambda_51898d9d154d5883d1389df7da840cbf__{ 587549 };
+		inline constexpr REL::ID BSInputEnableManager__DebugNameFunctor__lambda_9011be17262ef553c8f6835cfb8451c9__{ 606539 };
+		inline constexpr REL::ID BSInputEnableManager__IDebugNameFunctor{ 661689 };
+		inline constexpr REL::ID BSInputEventReceiver{ 1532947 };
+		inline constexpr REL::ID BSInputEventSingleUser{ 647131 };
+		inline constexpr REL::ID BSInputEventUser{ 1384221 };
+		inline constexpr REL::ID BSInstanceGroup{ 246888 };
+		inline constexpr REL::ID BSInstanceTriShape{ 527487 };
+		inline constexpr REL::ID BSInterpValueModifier{ 804017 };
+		inline constexpr REL::ID BSIntrusiveRefCounted{ 457726 };
+		inline constexpr REL::ID BSInvMarker{ 35668 };
+		inline constexpr REL::ID BSIsActiveModifier{ 538034 };
+		inline constexpr REL::ID BSJobs__JobThread{ 370199 };
+		inline constexpr REL::ID BSKeyboardDevice{ 798519 };
+		inline constexpr REL::ID BSLODMultiIndexTriShape{ 194469 };
+		inline constexpr REL::ID BSLODTriShape{ 264253 };
+		inline constexpr REL::ID BSLagBoneController{ 946270 };
+		inline constexpr REL::ID BSLeafAnimNode{ 165653 };
+		inline constexpr REL::ID BSLensFlareRenderData{ 1349426 };
+		inline constexpr REL::ID BSLensFlareSpriteRenderData{ 724779 };
+		inline constexpr REL::ID BSLight{ 815586 };
+		inline constexpr REL::ID BSLightingShader{ 779074 };
+		inline constexpr REL::ID BSLightingShaderMaterial{ 1144562 };
+		inline constexpr REL::ID BSLightingShaderMaterialBase{ 878562 };
+		inline constexpr REL::ID BSLightingShaderMaterialDismemberment{ 1137088 };
+		inline constexpr REL::ID BSLightingShaderMaterialEnvmap{ 1150827 };
+		inline constexpr REL::ID BSLightingShaderMaterialEye{ 1104289 };
+		inline constexpr REL::ID BSLightingShaderMaterialFace{ 1309834 };
+		inline constexpr REL::ID BSLightingShaderMaterialGlowmap{ 1057573 };
+		inline constexpr REL::ID BSLightingShaderMaterialHairTint{ 1216941 };
+		inline constexpr REL::ID BSLightingShaderMaterialLODLandscape{ 1123269 };
+		inline constexpr REL::ID BSLightingShaderMaterialLandscape{ 1170050 };
+		inline constexpr REL::ID BSLightingShaderMaterialMultiLayerParallax{ 1469117 };
+		inline constexpr REL::ID BSLightingShaderMaterialParallax{ 1010897 };
+		inline constexpr REL::ID BSLightingShaderMaterialParallaxOcc{ 964376 };
+		inline constexpr REL::ID BSLightingShaderMaterialSkinTint{ 1263383 };
+		inline constexpr REL::ID BSLightingShaderMaterialSnow{ 1296066 };
+		inline constexpr REL::ID BSLightingShaderProperty{ 1070415 };
+		inline constexpr REL::ID BSLightingShaderPropertyColorController{ 770637 };
+		inline constexpr REL::ID BSLightingShaderPropertyFloatController{ 784442 };
+		inline constexpr REL::ID BSLightingShaderPropertyUShortController{ 1568709 };
+		inline constexpr REL::ID BSLimbCycleModifier{ 271928 };
+		inline constexpr REL::ID BSLimbIKModifier{ 5207 };
+		inline constexpr REL::ID BSLimbIKModifierCastInfo{ 1107821 };
+		inline constexpr REL::ID BSLimbIKModifierUtility{ 841940 };
+		inline constexpr REL::ID BSLimbIKModifierUtilityCastInfo{ 1154420 };
+		inline constexpr REL::ID BSLines{ 1372625 };
+		inline constexpr REL::ID BSListBase_BSTempEffectDebris_{ 1362392 };
+		inline constexpr REL::ID BSList_BSTempEffectDebris_{ 1017090 };
+		inline constexpr REL::ID BSListenSocket{ 1299720 };
+		inline constexpr REL::ID BSLookAtCapturePoseModifier{ 1102733 };
+		inline constexpr REL::ID BSLookAtModifier{ 1056018 };
+		inline constexpr REL::ID BSLookAtModifierInterface{ 484921 };
+		inline constexpr REL::ID BSLookIKNote{ 1436686 };
+		inline constexpr REL::ID BSMasterParticleSystem{ 129190 };
+		inline constexpr REL::ID BSMaterialDB__DBTraits{ 1197076 };
+		inline constexpr REL::ID BSMaterialDB__QueuedHandles{ 637596 };
+		inline constexpr REL::ID BSMaterialObject{ 1321956 };
+		inline constexpr REL::ID BSMemStorage{ 1070791 };
+		inline constexpr REL::ID BSMemStorageAllocated_BSMemStorageHeapAllocator_{ 1385487 };
+		inline constexpr REL::ID BSMemStorageAllocated_BSMemStorageScrapAllocator_{ 873259 };
+		inline constexpr REL::ID BSMergeInstancedTriShape{ 1410029 };
+		inline constexpr REL::ID BSMeshLODTriShape{ 545965 };
+		inline constexpr REL::ID BSModelDB__BSModelProcessor{ 677458 };
+		inline constexpr REL::ID BSModelDB__DBTraits{ 980386 };
+		inline constexpr REL::ID BSModelDB__QueuedHandles{ 335138 };
+		inline constexpr REL::ID BSModifyOnceModifier{ 570874 };
+		inline constexpr REL::ID BSMouseDevice{ 1409553 };
+		inline constexpr REL::ID BSMsgDialogSystemUtility{ 983552 };
+		inline constexpr REL::ID BSMultiBound{ 829298 };
+		inline constexpr REL::ID BSMultiBoundAABB{ 911253 };
+		inline constexpr REL::ID BSMultiBoundCapsule{ 427896 };
+		inline constexpr REL::ID BSMultiBoundNode{ 1440702 };
+		inline constexpr REL::ID BSMultiBoundOBB{ 1522901 };
+		inline constexpr REL::ID BSMultiBoundRoom{ 343816 };
+		inline constexpr REL::ID BSMultiBoundShape{ 425626 };
+		inline constexpr REL::ID BSMultiBoundSphere{ 937900 };
+		inline constexpr REL::ID BSMultiIndexTriShape{ 1376350 };
+		inline constexpr REL::ID BSMultiStreamInstanceTriShape{ 261372 };
+		inline constexpr REL::ID BSMultiTargetTreadTransfController{ 433629 };
+		inline constexpr REL::ID BSNavmesh{ 509687 };
+		inline constexpr REL::ID BSNavmeshInfoMap{ 183486 };
+		inline constexpr REL::ID BSNavmeshInfoMap__IRecursiveVisitor{ 225871 };
+		inline constexpr REL::ID BSNavmeshInfoMap__IVisitor{ 934630 };
+		inline constexpr REL::ID BSNavmeshInfoSearch{ 1062636 };
+		inline constexpr REL::ID BSNavmeshObstacleCoverData{ 105744 };
+		inline constexpr REL::ID BSNavmeshObstacleData{ 58958 };
+		inline constexpr REL::ID BSNavmeshObstacleUndoData{ 1383930 };
+		inline constexpr REL::ID BSNavmeshReferenceObstacleArray{ 1472282 };
+		inline constexpr REL::ID BSNavmeshSearch{ 646033 };
+		inline constexpr REL::ID BSNavmeshSearchFilters{ 1477008 };
+		inline constexpr REL::ID BSNavmeshSearchHideFilter{ 160620 };
+		inline constexpr REL::ID BSNavmeshSearchMaxCostFilters{ 1070729 };
+		inline constexpr REL::ID BSNiAllocator{ 378646 };
+		inline constexpr REL::ID BSNiAlphaPropertyTestRefController{ 929400 };
+		inline constexpr REL::ID BSNiNode{ 954286 };
+		inline constexpr REL::ID BSNodeReferences{ 398138 };
+		inline constexpr REL::ID BSNonUniformScaleExtraData{ 680789 };
+		inline constexpr REL::ID BSNullImplAudio{ 1440021 };
+		inline constexpr REL::ID BSNullImplAudioListener{ 1247788 };
+		inline constexpr REL::ID BSNullImplGameSound{ 981353 };
+		inline constexpr REL::ID BSOStream{ 998797 };
+		inline constexpr REL::ID BSOcclusionBox{ 420230 };
+		inline constexpr REL::ID BSOcclusionPlane{ 1218029 };
+		inline constexpr REL::ID BSOcclusionShape{ 732725 };
+		inline constexpr REL::ID BSOffsetAnimationGenerator{ 304636 };
+		inline constexpr REL::ID BSOrderedNode{ 1110604 };
+		inline constexpr REL::ID BSOrientedBoxConstructor{ 963036 };
+		inline constexpr REL::ID BSPCGamepadDevice{ 1442670 };
+		inline constexpr REL::ID BSPCGamepadDeviceDelegate{ 392362 };
+		inline constexpr REL::ID BSPCGamepadDeviceHandler{ 126459 };
+		inline constexpr REL::ID BSPCKeyboardDevice{ 1064223 };
+		inline constexpr REL::ID BSPCMouseDevice{ 312902 };
+		inline constexpr REL::ID BSPCOrbisGamepadDevice{ 957306 };
+		inline constexpr REL::ID BSPCVirtualKeyboardDevice{ 924322 };
+		inline constexpr REL::ID BSPSysArrayEmitter{ 1026346 };
+		inline constexpr REL::ID BSPSysHavokUpdateModifier{ 849810 };
+		inline constexpr REL::ID BSPSysHavokUpdateModifier__ICollisionObjectHandler{ 131260 };
+		inline constexpr REL::ID BSPSysInheritVelocityModifier{ 597790 };
+		inline constexpr REL::ID BSPSysLODModifier{ 836233 };
+		inline constexpr REL::ID BSPSysMultiTargetEmitterCtlr{ 763072 };
+		inline constexpr REL::ID BSPSysRecycleBoundModifier{ 731755 };
+		inline constexpr REL::ID BSPSysScaleModifier{ 1212602 };
+		inline constexpr REL::ID BSPSysSimpleColorModifier{ 1102247 };
+		inline constexpr REL::ID BSPSysStripUpdateModifier{ 162227 };
+		inline constexpr REL::ID BSPSysSubTexModifier{ 1478648 };
+		inline constexpr REL::ID BSPackedCombinedGeomDataExtra{ 404093 };
+		inline constexpr REL::ID BSPackedCombinedSharedGeomDataExtra{ 310939 };
+		inline constexpr REL::ID BSPackedSharedGeometryBuilder{ 357437 };
+		inline constexpr REL::ID BSParabolicCullingProcess{ 401935 };
+		inline constexpr REL::ID BSParentVelocityModifier{ 82633 };
+		inline constexpr REL::ID BSParticleShader{ 625395 };
+		inline constexpr REL::ID BSParticleShaderCubeEmitter{ 750310 };
+		inline constexpr REL::ID BSParticleShaderEmitter{ 1015964 };
+		inline constexpr REL::ID BSParticleShaderRainEmitter{ 657063 };
+		inline constexpr REL::ID BSParticleShaderSnowEmitter{ 703871 };
+		inline constexpr REL::ID BSParticleSystemManager{ 798981 };
+		inline constexpr REL::ID BSPassByTargetTriggerModifier{ 258093 };
+		inline constexpr REL::ID BSPassByTargetTriggerModifierInterface{ 1582176 };
+		inline constexpr REL::ID BSPathBuilder{ 362438 };
+		inline constexpr REL::ID BSPathEventManager{ 402989 };
+		inline constexpr REL::ID BSPathSmootherPOVSearch{ 221873 };
+		inline constexpr REL::ID BSPathfindingTemporary_BSPathingSolution_{ 1123346 };
+		inline constexpr REL::ID BSPathfindingTemporary_PathingDoor_{ 155250 };
+		inline constexpr REL::ID BSPathfindingTemporary_PathingRequestClosePoint_{ 1030116 };
+		inline constexpr REL::ID BSPathfindingTemporary_PathingRequestCover_{ 80778 };
+		inline constexpr REL::ID BSPathfindingTemporary_PathingRequestSafeStraightLine_{ 259731 };
+		inline constexpr REL::ID BSPathfindingTemporary_PathingRequest_{ 511979 };
+		inline constexpr REL::ID BSPathing{ 931595 };
+		inline constexpr REL::ID BSPathingCell{ 278849 };
+		inline constexpr REL::ID BSPathingCellManager{ 34743 };
+		inline constexpr REL::ID BSPathingDoor{ 251450 };
+		inline constexpr REL::ID BSPathingLOSGrid{ 376334 };
+		inline constexpr REL::ID BSPathingLOSGridCell{ 642555 };
+		inline constexpr REL::ID BSPathingLOSGridMap{ 1473458 };
+		inline constexpr REL::ID BSPathingLocation{ 520446 };
+		inline constexpr REL::ID BSPathingLockData{ 881907 };
+		inline constexpr REL::ID BSPathingNumericIDVisitor{ 196583 };
+		inline constexpr REL::ID BSPathingRequest{ 715509 };
+		inline constexpr REL::ID BSPathingSearchRayCast{ 501204 };
+		inline constexpr REL::ID BSPathingSolution{ 1515903 };
+		inline constexpr REL::ID BSPathingSpace{ 827023 };
+		inline constexpr REL::ID BSPathingStreamRead{ 1120859 };
+		inline constexpr REL::ID BSPathingStreamSimpleBufferRead{ 1082440 };
+		inline constexpr REL::ID BSPathingStreamSimpleBufferWrite{ 701307 };
+		inline constexpr REL::ID BSPathingStreamWrite{ 966756 };
+		inline constexpr REL::ID BSPathing__CheckLineOfSightFilter{ 1391433 };
+		inline constexpr REL::ID BSPathing__EdgeFoundVisitor{ 1489391 };
+		inline constexpr REL::ID BSPistonController{ 295223 };
+		inline constexpr REL::ID BSPlatform__BSAsyncRequestBase{ 1134129 };
+		inline constexpr REL::ID BSPlatform__BSAsyncRequest_std__function_void__{ 212780 };
+		inline constexpr REL::ID BSPlatform__BSBethesdaPlatform{ 251444 };
+		inline constexpr REL::ID BSPlatform__BSDownloadRequest{ 1419128 };
+		inline constexpr REL::ID BSPlatform__BSTerminatedCallback{ 297819 };
+		inline constexpr REL::ID BSPlatform__BSUploadRequest{ 1466090 };
+		inline constexpr REL::ID BSPlayerDistanceCheckController{ 1155433 };
+		inline constexpr REL::ID BSPointerListBase_BSTempEffectDebris_{ 970449 };
+		inline constexpr REL::ID BSPortal{ 340177 };
+		inline constexpr REL::ID BSPortalGraph{ 1306181 };
+		inline constexpr REL::ID BSPortalGraphEntry{ 820954 };
+		inline constexpr REL::ID BSPortalSharedNode{ 1251434 };
+		inline constexpr REL::ID BSPositionData{ 1380665 };
+		inline constexpr REL::ID BSPrecomputedNavmeshInfoPathMap{ 262785 };
+		inline constexpr REL::ID BSPrecomputedNavmeshInfoPathMap__INavmeshInfoVisitor{ 305178 };
+		inline constexpr REL::ID BSPrecomputedNavmeshInfoSearch{ 1581021 };
+		inline constexpr REL::ID BSPrecomputedVisibility__BSVisDB__DBTraits{ 974770 };
+		inline constexpr REL::ID BSPrecomputedVisibility__MultiCellVisibilityData__TomeCollectionBuildTask{ 1081887 };
+		inline constexpr REL::ID BSProceduralLightningController{ 77281 };
+		inline constexpr REL::ID BSProceduralLightningTasklet{ 123874 };
+		inline constexpr REL::ID BSQueuedResourceCollectionBase{ 209178 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits__2_{ 399745 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits__2_{ 75483 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSMaterialDB__DBTraits__1_{ 168322 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSMaterialDB__DBTraits__2_{ 591050 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSModelDB__DBTraits__1_{ 335317 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSModelDB__DBTraits__2_{ 288334 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits__2_{ 372106 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSTextureDB__DBTraits__1_{ 1125000 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BSTextureDB__DBTraits__2_{ 1338758 };
+		inline constexpr REL::ID BSQueuedResourceCollection_BSResource__EntryDB_BShkbHkxDB__DBTraits__2_{ 360563 };
+		inline constexpr REL::ID BSRagdollContactListenerModifier{ 211588 };
+		inline constexpr REL::ID BSRagdollContactListenerModifierInterface{ 846650 };
+		inline constexpr REL::ID BSRandomAlarmModifier{ 164938 };
+		inline constexpr REL::ID BSRangeNode{ 555090 };
+		inline constexpr REL::ID BSReference{ 1243068 };
+		inline constexpr REL::ID BSReloadShaderI{ 1281478 };
+		inline constexpr REL::ID BSResourceFaceGenBinaryFile{ 1562330 };
+		inline constexpr REL::ID BSResourceNiBinaryStream{ 213053 };
+		inline constexpr REL::ID BSResourceStreamParser{ 698921 };
+		inline constexpr REL::ID BSResource__Archive2__AsyncReaderStream{ 1165312 };
+		inline constexpr REL::ID BSResource__Archive2__Index{ 866209 };
+		inline constexpr REL::ID BSResource__Archive2__Manager__MemoryCacheLocation{ 819826 };
+		inline constexpr REL::ID BSResource__Archive2__ReaderStream{ 301361 };
+		inline constexpr REL::ID BSResource__ArchiveFoundStreamCB{ 914049 };
+		inline constexpr REL::ID BSResource__AsyncStream{ 567661 };
+		inline constexpr REL::ID BSResource__CacheDrive{ 100570 };
+		inline constexpr REL::ID BSResource__CacheDrive__Impl{ 1416599 };
+		inline constexpr REL::ID BSResource__CacheDrive__Op{ 868755 };
+		inline constexpr REL::ID BSResource__CacheDrive__Task{ 1369923 };
+		inline constexpr REL::ID BSResource__EntryDBBaseUtil{ 170064 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BGSBtoDB__DBTraits_BSResource__EntryDB_BGSBtoDB__DBTraits___{ 470729 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BGSBtrDB__DBTraits_BSResource__EntryDB_BGSBtrDB__DBTraits___{ 1266009 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BGSBttDB__DBTraits_BSResource__EntryDB_BGSBttDB__DBTraits___{ 1307098 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BGSCombinedCellGeometryDB__DBTraits_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits___{ 424221 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BGSCombinedCellGeometryDB__ModelDB__DBTraits_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits___{ 213543 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BGSTerrainVisibilityDataDB__DBTraits_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits___{ 744884 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSFaceGenDB__FG__DBTraits_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits___{ 676493 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSFaceGenDB__TRI__DBTraits_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits___{ 983226 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSMaterialDB__DBTraits_BSResource__EntryDB_BSMaterialDB__DBTraits___{ 193623 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSModelDB__DBTraits_BSResource__EntryDB_BSModelDB__DBTraits___{ 196595 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSPrecomputedVisibility__BSVisDB__DBTraits_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits___{ 456398 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSStaticTriShapeDB__DBTraits_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits___{ 890429 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BSTextureDB__DBTraits_BSResource__EntryDB_BSTextureDB__DBTraits___{ 327804 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_BShkbHkxDB__DBTraits_BSResource__EntryDB_BShkbHkxDB__DBTraits___{ 1423209 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_LipSynchAnimDB__DBTraits_BSResource__EntryDB_LipSynchAnimDB__DBTraits___{ 1126692 };
+		inline constexpr REL::ID BSResource__EntryDBBase_BSResource__EntryDBTraits_ScaleformFile__DBTraits_BSResource__EntryDB_ScaleformFile__DBTraits___{ 1353383 };
+		inline constexpr REL::ID BSResource__EntryDB_BGSBtoDB__DBTraits_{ 298054 };
+		inline constexpr REL::ID BSResource__EntryDB_BGSBtrDB__DBTraits_{ 1093174 };
+		inline constexpr REL::ID BSResource__EntryDB_BGSBttDB__DBTraits_{ 1134354 };
+		inline constexpr REL::ID BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits_{ 956388 };
+		inline constexpr REL::ID BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits_{ 745617 };
+		inline constexpr REL::ID BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits_{ 1276675 };
+		inline constexpr REL::ID BSResource__EntryDB_BSFaceGenDB__FG__DBTraits_{ 64640 };
+		inline constexpr REL::ID BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits_{ 371898 };
+		inline constexpr REL::ID BSResource__EntryDB_BSMaterialDB__DBTraits_{ 1164139 };
+		inline constexpr REL::ID BSResource__EntryDB_BSModelDB__DBTraits_{ 1167127 };
+		inline constexpr REL::ID BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits_{ 988417 };
+		inline constexpr REL::ID BSResource__EntryDB_BSStaticTriShapeDB__DBTraits_{ 278858 };
+		inline constexpr REL::ID BSResource__EntryDB_BSTextureDB__DBTraits_{ 1298535 };
+		inline constexpr REL::ID BSResource__EntryDB_BShkbHkxDB__DBTraits_{ 812076 };
+		inline constexpr REL::ID BSResource__EntryDB_LipSynchAnimDB__DBTraits_{ 515286 };
+		inline constexpr REL::ID BSResource__EntryDB_ScaleformFile__DBTraits_{ 742318 };
+		inline constexpr REL::ID BSResource__ICacheDriveOp{ 603060 };
+		inline constexpr REL::ID BSResource__IEntryDB{ 435526 };
+		inline constexpr REL::ID BSResource__IEntryDB__PostFlushNotify{ 162515 };
+		inline constexpr REL::ID BSResource__Location{ 776908 };
+		inline constexpr REL::ID BSResource__LocationTraverser{ 825176 };
+		inline constexpr REL::ID BSResource__LooseFileLocation{ 510662 };
+		inline constexpr REL::ID BSResource__MemoryFileLocation{ 1212142 };
+		inline constexpr REL::ID BSResource__MemoryFileStream{ 180258 };
+		inline constexpr REL::ID BSResource__RegisterPrefix__2__Traverser{ 906976 };
+		inline constexpr REL::ID BSResource__ReplicateAt__9__ReplicateFoundFunctor{ 122712 };
+		inline constexpr REL::ID BSResource__SDirectory2__ThreadCursor{ 1337768 };
+		inline constexpr REL::ID BSResource__Stream{ 1318779 };
+		inline constexpr REL::ID BSResource__StreamBase{ 833539 };
+		inline constexpr REL::ID BSResource____DefaultLocationData{ 440449 };
+		inline constexpr REL::ID BSResource____DevNull{ 1414258 };
+		inline constexpr REL::ID BSResource____DevNull__NullStream{ 243459 };
+		inline constexpr REL::ID BSResource____EventSources{ 635785 };
+		inline constexpr REL::ID BSResource____GlobalLocations{ 1389743 };
+		inline constexpr REL::ID BSResource____GlobalPaths{ 345014 };
+		inline constexpr REL::ID BSResource____LocationTree{ 172605 };
+		inline constexpr REL::ID BSResource____LooseFileAsyncBase{ 627420 };
+		inline constexpr REL::ID BSResource____LooseFileAsyncBase__FunctorType{ 374913 };
+		inline constexpr REL::ID BSResource____LooseFileAsyncChild{ 1238851 };
+		inline constexpr REL::ID BSResource____LooseFileAsyncStream{ 986231 };
+		inline constexpr REL::ID BSResource____LooseFileStream{ 48410 };
+		inline constexpr REL::ID BSResource____LooseFileStreamBase{ 15225 };
+		inline constexpr REL::ID BSResource____RegisterFoundStreamTraverser{ 778694 };
+		inline constexpr REL::ID BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy_{ 929489 };
+		inline constexpr REL::ID BSRetargetBodyBlend{ 1481420 };
+		inline constexpr REL::ID BSReverseSpineTwistModifier{ 1215351 };
+		inline constexpr REL::ID BSRingConstructor{ 949344 };
+		inline constexpr REL::ID BSRootTwistModifier{ 1168469 };
+		inline constexpr REL::ID BSRotAccumTransfInterpolator{ 1170827 };
+		inline constexpr REL::ID BSSaveDataSystemUtility{ 558934 };
+		inline constexpr REL::ID BSScaleformFileOpener{ 1007895 };
+		inline constexpr REL::ID BSScaleformImageLoader{ 689407 };
+		inline constexpr REL::ID BSScaleformManager{ 1211580 };
+		inline constexpr REL::ID BSScaleformTranslator{ 1477657 };
+		inline constexpr REL::ID BSSceneGraph{ 297393 };
+		inline constexpr REL::ID BSScript__ByteCode__PackedInstructionStream__InstructionFunctor{ 1384371 };
+		inline constexpr REL::ID BSScript__CompiledScriptLoader{ 1294041 };
+		inline constexpr REL::ID BSScript__ErrorLogger{ 1225734 };
+		inline constexpr REL::ID BSScript__ICachedErrorMessage{ 1466270 };
+		inline constexpr REL::ID BSScript__IClientVM{ 546686 };
+		inline constexpr REL::ID BSScript__IComplexType{ 488304 };
+		inline constexpr REL::ID BSScript__IFindBoundObjectFunctor{ 1481662 };
+		inline constexpr REL::ID BSScript__IFunction{ 150008 };
+		inline constexpr REL::ID BSScript__IHandleReaderWriter{ 346958 };
+		inline constexpr REL::ID BSScript__ILoader{ 173673 };
+		inline constexpr REL::ID BSScript__IMemoryPagePolicy{ 509860 };
+		inline constexpr REL::ID BSScript__IObjectHandlePolicy{ 261296 };
+		inline constexpr REL::ID BSScript__IObjectProcessor{ 265366 };
+		inline constexpr REL::ID BSScript__IProfilePolicy{ 832029 };
+		inline constexpr REL::ID BSScript__ISavePatcherInterface{ 212276 };
+		inline constexpr REL::ID BSScript__IStackCallbackFunctor{ 220107 };
+		inline constexpr REL::ID BSScript__IStackCallbackSaveInterface{ 280403 };
+		inline constexpr REL::ID BSScript__IStore{ 428293 };
+		inline constexpr REL::ID BSScript__ITypeLinkedCallback{ 1492365 };
+		inline constexpr REL::ID BSScript__IVMDebugInterface{ 1445407 };
+		inline constexpr REL::ID BSScript__IVMObjectBindInterface{ 1434485 };
+		inline constexpr REL::ID BSScript__IVMSaveLoadInterface{ 222545 };
+		inline constexpr REL::ID BSScript__IVirtualMachine{ 176004 };
+		inline constexpr REL::ID BSScript__Internal__AutoPropGetFunction{ 503058 };
+		inline constexpr REL::ID BSScript__Internal__AutoPropSetFunction{ 676175 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_0036e789dfc29f04e3b76a58fd3ed225__{ 1092420 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_033381a3e53eabbac9a4c55b3f82524d__{ 1244820 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_0333d0192dcba271222b8a769ecf64ba__{ 448521 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_03937cd3aeb16f62e8fdf01fb07b776b__{ 1468667 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_03f40d5b7a83646873d4cffcf0f8af1e__{ 160067 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_03f6be1707c4dadc1e6a4f21830461d0__{ 937816 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_05e45791d9c9dae046656640fdcc5915__{ 1182722 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_06310060173b6edb3d4ab2762098609d__{ 343038 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_06ae58094c6c7679c62733e817acbeee__{ 1352884 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_072ca50fef522dae621eda4732773008__{ 1515606 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_09405778e6c90dfad4217962044524a7__{ 635489 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_0bf7f2a013840c8c83f46a5799c25cac__{ 1278979 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_0d75bd85c27993a12547983c5f26276a__{ 716822 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_0ea3f8189c538f92a2fb24da35641954__{ 1280369 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_101df2fa8f221612756e26cbcc27a354__{ 26599 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_12ff1bd31f77080f55398b412c956589__{ 1446328 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_135c095b11613df466acaa235bb1737e__{ 1272932 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_148b56cf9e51025f0478c68d2ed2b907__{ 119509 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_15e19293b3f1ccacb5cd574f8a5892f6__{ 658421 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_172af002300d2a96541d1e913078d1a7__{ 1337688 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_17f62e19215467b2ae3e574ef40bb035__{ 1557236 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_196222729b99521a093bbc916f34a3bb__{ 912035 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_199e09d3489a851ba35b83a2b5a4c78a__{ 1101594 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1a42f860b383b72827675c5211efbf43__{ 966158 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1ab215191a5b2d792f6892cc57f2e7a6__{ 166371 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1af8c5e23b50e17795263c6a83509e48__{ 378358 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1b434c7e9dc9658fa97fc97f1aa10ffe__{ 169447 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1bea699fc0d60f626a403b1b5966905d__{ 355379 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1f3d803f88c5774e6695dfbb76152abf__{ 1465599 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_1f6960099da300d413a1b96512f644fb__{ 439443 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_20df7b2a95b034a263939c11825c18b0__{ 1456460 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_216c63ee93f90c18ae2eb9b0ceb0da1e__{ 1565278 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2282147843dd6ff975050bb419e25637__{ 355599 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_231741e1bf1630cc3289131b16070523__{ 296523 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_231cc2d7ae491f358fb3115e4f4ab8d7__{ 1365828 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_23f831893d8eb6d1de2c3f97c98ebf21__{ 721260 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_256019cf0fbe9a3e77970966aad7a9c6__{ 1152699 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2581fa4f947018961d67bc610901ce7f__{ 1090747 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2694ca287ec6da7f9b47c8132d87907b__{ 1549697 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2941130b797500212f7c3f53a9c0c1a2__{ 1516299 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2a1f1212fcf0357e9924e7804aa85ce9__{ 250832 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2a657124b2613bc4f82ab44d0b334ddc__{ 992875 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2c63495431a436b4fc7769122a2c5648__{ 1426009 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2d49c3f20eef6392e512606a35c2020a__{ 822049 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2f1b5f214f0a62905ff748180067474c__{ 1373351 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_2f99d02b5d6324ec9ca1dc646cc3ad62__{ 530656 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_305d2cc57e463c54eb8f5e94ed3475d0__{ 1562000 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_30da130d6d128b27909b9e97e0c6bf55__{ 212969 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_312354d41c9d53b3e3cca87bbffefe1f__{ 1127272 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_313bb6085fdf73625826a32c5e4089ed__{ 72794 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3176f3e95b60e72406f3519039d44854__{ 1565046 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_31d423451e709a3813235b0bc31fab03__{ 1176631 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3215cdc43d63422065bc965ccdcf40a9__{ 1049745 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_32cb6b89aa9ee3c6d829a981f5948e21__{ 681625 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_336031ded9834cecd57097a98ff4cd86__{ 232994 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_35d81f7772422dcac989e86f49f04739__{ 471387 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_37c06a682adcf3342fb282ac6afd5db7__{ 253229 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_37f85511682b6eea3f9aa523eb769f40__{ 1034098 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_37f8c67697c25dce77618cdd8cacf708__{ 1471760 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_38168a794b3d0ecc11bad366c78afa17__{ 902915 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_381c7b3e9bb0f3141cc09bca24bc8404__{ 995671 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3961a85e44cb6cac9ccd75dcc6db6833__{ 154050 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3a56500349bdb6ec53fce93c8a277463__{ 728870 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3a5d9d4ffdb182da59eac70a88bd4d9a__{ 1035890 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3b3fc679c4d2a656a7ca5513e3e141a0__{ 995941 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3d8bdbfe73c95692b6441d9c8a4d2ed1__{ 998970 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3dbd811ff149bd5578ab6a4d127170a7__{ 202047 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3e02586ccc052d8695ffe8150ef6ce94__{ 1236417 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3ec8a23c50d51adfa49836b5c1935944__{ 1083320 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3f05b2284942471abef61df84649a149__{ 326084 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_3f09d96fbe7085a8947d5854f0bcc050__{ 1329349 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_403c2f175212f070fc3099ef2bb7d37f__{ 1070145 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_42ad8da096f4da23888a88ab6daca7dd__{ 169226 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4483c9eba9e8e929c6fbe34db5737047__{ 809561 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_452e38260b64d797ca29636ec9f36734__{ 902658 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_45e5f2e4702e33dfe0df9c61190b85ba__{ 542502 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_466dd68b59cc45b5f012ccb0f0ebfd69__{ 1539707 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4713f5071ef5fa03b9016e3009a1cda2__{ 399222 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_47fb9cba502debe7eadb015ef20a4823__{ 1163549 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_48fabceb832c00704fba06b82487f8cc__{ 997323 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_48fecc7c9fa931e834800d15848059e6__{ 1098576 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_495adafd421f29bc0da99c01b7e1121e__{ 1184123 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4a19ab8e56ecd2ccca3ec0ff1b1b5039__{ 1197179 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4ae70dc3a428bd036fc4ecec3e5e86c9__{ 46221 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4b1b555910ca3777fc5821bc75fb556c__{ 529745 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4c8747d988f348c15af1c28c3695be48__{ 819039 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4cddb4c3d1e852dee754f0f6a6c0e6fc__{ 36802 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4d2c9b90743db4803968eafacce2b71e__{ 440841 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4d412be8a66137c852932ad039c81099__{ 1378242 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4db643e393934408a68d5c4f18914d62__{ 1220938 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4e0beadb02b6780b9eeeff8011270e3c__{ 1400484 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_4edbfa5e38e10c85855b60595af721ee__{ 922143 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_523ce1a6935cc369bb2a3e6e41db82ae__{ 539211 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_53122849be2cf3bfa715ea670b851a44__{ 68153 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5442fb5b4d9b249244bebb10cb7a4409__{ 63610 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_55b0c554b1350278029c169d86615681__{ 244088 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_56f6ce5baae90c7f4167387cdf1e73fb__{ 62874 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5752f5e0f9a89a1dfe55027ce6980f68__{ 719879 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5894798851f4b1104f739189ff021882__{ 1166615 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_59e0bd90bb20df61bf2b5b7ab8c0aa26__{ 150971 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5ae089e4d31f02bcafef0c614602203a__{ 25874 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5ae28fa059d9cdc200eef8150ccfbbd7__{ 1366480 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5b5da570a496ebbb819cf0ff8b472897__{ 821816 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5d7495b661268e9e52116a4be2a615f4__{ 381506 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5eb4f15bb48aab1d07b8b05690c59e55__{ 4267 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5f801f6d325daef8830fe3a0b0f34d4f__{ 1259910 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_5fc1c9001ae0709cbafcd7e84095aa10__{ 915218 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_60beb8b81486c23f3295230a7cd21fc8__{ 1008135 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_616ebea3a9b57e86466dea270db48a56__{ 1378028 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_642ffadad618b8545202d33d495fd0b1__{ 120229 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_659ba9f00f15e9e5bf969b0686b6d7f5__{ 940859 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_65ce5eb2fd29efd6f24701dd6e9e314a__{ 259207 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_65e3ac93f1189026038230fd1f852714__{ 1462566 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_6706071d475a9d1117345e8a9240351a__{ 976822 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_67b458e389b68dc567e66dccde93180f__{ 347679 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_681e88a3bb9be38d24e78de7a09841a4__{ 729088 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_68a6c31974e8de6f68b7fe5f6e129375__{ 774668 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_68ae5d28c34207d14300f222945ceb13__{ 1552058 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_6c614d2155dc079018c9aef55ce7213b__{ 1005078 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_6c92b5e991bc8ffd1f1805ce6c951ac4__{ 565015 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_6cc2429acefb064b213f994ad5fddc0f__{ 809820 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_6d057e0372eabecd40e1213b939db226__{ 534499 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_6d40ed7ee267343454ab84bc01d2f95a__{ 1277335 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_70e12aa87cdb5e4e1e3e37e250caedc3__{ 716558 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_713d9943db73cdb801da7341722ad9a2__{ 247149 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_71627b815f4f38b6c6be3e97252d45c2__{ 250204 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_71bc88c464db362fd265ad074d8f8f68__{ 254653 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_71dece7077f4cb78d95bfd5d70b34a6d__{ 76046 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_727d175a0b87166e976c6a169bb24f55__{ 914994 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7294799d61c1e3e682e815fe615680f4__{ 1348670 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_732bf4c600b98afda8ae4eec4b5d487b__{ 1185765 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_73eb13eee84cacb82b9f3e1f98e3b7ad__{ 814221 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_75b591447b162a3fe7151ea50e1b3f23__{ 539409 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7aa398cdaccc55373dffd32cf1008a9e__{ 818836 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7ae6587ca2f2ac6677b89b6271cd5955__{ 352359 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7aeb830e2d5a2876b47cd3b64d2d2a89__{ 346266 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7b19da4d437f57776c7d00a2899d07d0__{ 1371952 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7b9ecf76b461d4bb6c9f88a0bb07c2e6__{ 623938 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7bc3597ff58c6b9197f232777dc06e11__{ 1256807 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7d3df9f885eea772d0b9a7fa8e04bd8a__{ 725855 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7e5af3061aa52fb97c445fc26b0193f4__{ 343920 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7e875a23bccc241edab49fff33e92007__{ 837614 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7ebb8ff6d1f3641795600d5299d81842__{ 627834 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_7ee7fcb491e4741902b16b8f32a92ecc__{ 899900 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_82258dc9b4d751c75d44bcf0d3678d6d__{ 542274 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_82350808aee40d100b72cd39ca845d3f__{ 617184 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_8381241688a84f917e957d5c9204a167__{ 964887 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_845510b31e7011c8184d72d6539c2786__{ 108705 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_86ddea8a4e72be7b8eb04c3a7a1c175d__{ 1002062 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_86f5c4639a23a24428b5166ae9993007__{ 1471978 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_87334e7a78cdc01ad5d8bb47ea8caf90__{ 1526260 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_87513c01f69c2f40f8b29d01e0176b42__{ 227390 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_87f131a239ae71be3ebd263eba470384__{ 710844 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_8862c08c46909a23cce8d7a33c40ca38__{ 812827 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_896355432e47a86f66d44793c898b2fe__{ 306004 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_897dc3f8fa35add8003d4ec74ce26701__{ 632452 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_8e0f4ac913fe95ab0895d1bc17cabb82__{ 1187135 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_8e322d145299d90c86338d331f1312cf__{ 262242 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_8f75d0740b5c1921ac319b8ae7fec9d8__{ 713825 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_8faa52d4c5f0e81430a0b2e043af530b__{ 1089353 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_911f8ecd3382cb7f1385e89dbf10f842__{ 1339332 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_914ba33a265437568f0efb69f8922606__{ 1553427 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_92d8ddaf25214a20908aab7e314e4c1e__{ 157653 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_93e4c1ed6052968f3e710a5d4f1266f5__{ 1307274 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9455d53f6ddf9bb6036f7e3b2c460dbe__{ 1188760 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_94a0b9b0a6c8e0f0208ab2081abcf924__{ 1288022 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9581e4b0df97dbd72c739a7e7e0d1607__{ 320429 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9605dbb6caac1408269ee3684da356a9__{ 1194863 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9685fa74d0b4cd35e0a012cb13d9f54f__{ 433309 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_96ccd3487d363b9ff44245908443dff5__{ 779115 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_99f4dfdd75424bf5d4cf3af2f896c126__{ 1555832 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9b68ddbacc45b82256c95729b8f53ba7__{ 557991 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9bb0063a395270cebfdcc140d6668582__{ 810462 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9c72b51fbcbdda30778ba9cbbd1dab26__{ 1374976 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9ca7a24b94e4be92605d4508870cb0b4__{ 871506 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9dc072ec63fcd954e6603f6196975a53__{ 844648 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_9fbbb53dc6d5854a1653d642e704e0b8__{ 1422542 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_a066242f84b30c708d1a072e17408fc6__{ 1460131 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_a13136b083e1b826292356e960a4a3b3__{ 1368907 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_a2400baec1235fdf245727167c1e5776__{ 1098813 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_a2cee0234ecbf2d8c13b486af0d9b806__{ 956549 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_a57a479d66a0a79461bdfe3100fb0f41__{ 435684 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_a7eab2658a19a22342af0331061b8163__{ 912243 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_aa90b4a2ed4bb178d0cb7ef422babf77__{ 1362802 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ab282576f91eb23b1eb0a56da0565e22__{ 1552794 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_abf18b61e9a88b34f8d4407b67f904e0__{ 364503 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ad1e7e20c912169c90e4c6fa3cb88592__{ 623002 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ad594db728bdf1959169d84e8940b2d9__{ 64227 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ad73c806e9b712d198cfb9e11b13a9dc__{ 1000406 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_af63e1f76755fad3d19db80fe8ff61a5__{ 1192005 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_aff48f6caec89405f450186898b26347__{ 448713 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b13012d695ae3e201531fd05017c7718__{ 457578 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b223b0b06990ca72d0f0d072b1d5d19a__{ 806822 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b27aa35e62aed7fdf548ae3121233188__{ 896908 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b3124df4a3043de82c08effc2d80eb75__{ 139558 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b32fc1eceb5384f98388d8230715e120__{ 343292 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b33dd30fb9b734980f23b782f3bebe6a__{ 66729 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b541d1962f76df86bb0685999b0fbab4__{ 161477 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b98602201d38392d9a69c8e6fd471ec2__{ 1211127 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_b9d7b298c6aca4ae4b8b5eb206b97e8c__{ 1030967 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ba104fb8977a947bd5e22f90ef7accb2__{ 156341 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ba40e40a40d2895650e1b615719542b0__{ 1430932 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_bd382ebe2d29447078b65b1df3fa26c1__{ 1179627 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_be00e65bd0d4d0520ac6b10f3ee9f384__{ 437036 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_be3baeb0cd288915edf499e42c95298d__{ 75838 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_be5583c8170254d249223e895b42877f__{ 803772 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c03fb01d6395ccf54f9de160c0e1f59a__{ 751624 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c27e0645b30443d4ea5952b73f0bf516__{ 157068 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c44894a3c61c9f7bda60497d55fd495f__{ 249948 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c45d90f3f35e188aaed57e7a51a3a7da__{ 1117528 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c5582e3d579d368083e3ddddf8321e64__{ 1093843 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c78f3e46052c1effbaed723d3a0a4245__{ 989816 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c7936a9edc0a96155ddae87bfa8968cb__{ 685972 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c7ee88db88fb475ee0275185b477b40d__{ 1463980 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c87d990ee709e3868efa4bc47e3f910c__{ 1191781 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_c940b58bab0630feeb6feb9d3751fdff__{ 1459476 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ca150dd403904a82a6dbf37155ce2367__{ 259432 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ca49331d2cc52b9f965b03489a2f0e95__{ 635710 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_cb6ba69900f6b169d1ff78cedb6e3c0b__{ 1269871 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_cd1bdde020ea07c36fdc2ff171544eb5__{ 1005292 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_cf21a7415e2878270ec9d59d793ad883__{ 1058056 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_cf9010abb7164ecb03472e086f8f8daa__{ 1432575 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_cfe919020b023f99e9e99fd68034caf3__{ 1059422 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d238acb2724ab71cef75ebbdb4dd058e__{ 342606 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d261d8e3cad3a65f4d97016a06523df4__{ 1151361 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d269bb3ca57dbb686bb88e6fad76d718__{ 166149 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d3213256c0da41944ac2c7abd30007e5__{ 445450 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d33580e7b03fb1257999455455c3c503__{ 632657 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d523c09a64bc0d7353666e113bb249f4__{ 1535522 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d81cd7ed5ded28e18c4da6f6974c8c46__{ 626370 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d889a3e54755f9eedd94b866b3714090__{ 1442088 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_d95749bda0293c08d3cc0b7b0e246d73__{ 262475 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_db105bbcf6b344a998e2a712c4aaf918__{ 430329 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_dbe18e55a6256ed6c7cd3a93774ec955__{ 445679 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_dc3cd416a2837e453f35a6b8fbc48ea4__{ 523896 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_de09c78a4229023cf45e56cac56fa01c__{ 620251 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_de202769c8cb78fbd5d5b701638899ab__{ 1466973 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ded7290a27f6f5ce1eadeb656461dcb9__{ 1494187 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_df72233bb555817fc5d61a5aef375967__{ 337295 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e0106635372c160d3c8ac07fe697b203__{ 726089 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e0c11438ffc28765d30a3c3302c1bbf2__{ 1313823 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e13128af6f1cec873d5fc795c32ab6f7__{ 1275944 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e24d17b2ce5946d6143a7c8179e534a9__{ 436390 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e2db30165d12b17a4cbee3e6a53da720__{ 249506 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e6f311dd80387ab27f02d6370d74f0fe__{ 623266 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e70861b18baf45189c3e68218d25319f__{ 60522 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_e8d4e30e0e52d536051cc32bac3eeaca__{ 73026 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ea75c84e5d2afaa7a431055deccf81d1__{ 533065 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_eaaf9a1e013254da6429b6dc662caae0__{ 1086360 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_eb086da3861952ef5b629e6a82e8ce8f__{ 1370311 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_eca8036104a77a1532b8fd022f0d0ee3__{ 904328 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ece9c0d99a1a8c11fc117563cae02c17__{ 1281944 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ed07b502b210e8c707dedb26a94ba3a4__{ 778609 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_edce4f9930ddee0aee4120368aa010f0__{ 352591 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_ef55d7a0aba434f7f25bdb3b01ce777b__{ 133968 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f096702f25223fa3b599c8bf13f939fd__{ 526972 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f264e7f2505fd732903c515b362a8149__{ 529999 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f2b91fcc51bda1a5cc954202e5edc4a8__{ 1142965 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f2db2796f70b19f4c30c278bc3281ece__{ 905960 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f393b1d39ec21987fc943edc572c1d9b__{ 907376 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f4e053b2a5fdfe57e54fdfe6a9861709__{ 436138 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f5d7b5b7b64384a8f89a3ceaff2862d3__{ 1285229 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f81463f1c50d4e119d7d72eac2011a9f__{ 717458 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_f8b52b4df4e95fdb8a0b9e38874d6165__{ 1285003 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_fb99de7700baf0f89fdf3217d5d971e0__{ 1095492 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl__lambda_fffb0ebd51131490b2c1433b88f00147__{ 340317 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl_char_{ 999683 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl_charconst_{ 56587 };
+		inline constexpr REL::ID BSScript__Internal__CachedErrorMessageImpl_std__function_void__{ 847594 };
+		inline constexpr REL::ID BSScript__Internal__CodeTasklet{ 867472 };
+		inline constexpr REL::ID BSScript__Internal__IFuncCallQuery{ 139122 };
+		inline constexpr REL::ID BSScript__Internal__NativeFunctionStub{ 633362 };
+		inline constexpr REL::ID BSScript__Internal__RawFuncCallQuery{ 92579 };
+		inline constexpr REL::ID BSScript__Internal__ScriptFunction{ 829701 };
+		inline constexpr REL::ID BSScript__Internal__VirtualMachine{ 12594 };
+		inline constexpr REL::ID BSScript__LinkerProcessor{ 130969 };
+		inline constexpr REL::ID BSScript__NF_util__NativeFunctionBase{ 1499420 };
+		inline constexpr REL::ID BSScript__NativeFunction0_ActiveEffect_Actor_{ 35579 };
+		inline constexpr REL::ID BSScript__NativeFunction0_ActiveEffect_EffectSetting_{ 568022 };
+		inline constexpr REL::ID BSScript__NativeFunction0_ActiveEffect_void_{ 1538754 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_Actor_{ 1428390 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_BSScript__ArrayWrapper_Actor__{ 1176376 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_TESFaction_{ 817182 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_TESNPC_{ 1480930 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_TESObjectARMO_{ 271470 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_TESObjectREFR_{ 868859 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_TESPackage_{ 18653 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_TESRace_{ 682980 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_bool_{ 200419 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_float_{ 290264 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_int_{ 476858 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_unsignedint_{ 644555 };
+		inline constexpr REL::ID BSScript__NativeFunction0_Actor_void_{ 27064 };
+		inline constexpr REL::ID BSScript__NativeFunction0_AlchemyItem_bool_{ 797503 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSBaseAlias_TESQuest_{ 1408513 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSBaseAlias_void_{ 437765 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSEncounterZone_void_{ 1035639 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSListForm_unsignedint_{ 672337 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSListForm_void_{ 312789 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSLocAlias_BGSLocation_{ 835533 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSLocAlias_void_{ 224176 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSLocation_bool_{ 1153416 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSLocation_void_{ 262208 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSMessage_void_{ 1284971 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSMusicType_void_{ 393612 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSRefAlias_TESObjectREFR_{ 1084657 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSRefAlias_void_{ 473070 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSRefCollectionAlias_unsignedint_{ 539181 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSRefCollectionAlias_void_{ 1150330 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSScene_TESQuest_{ 1043395 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSScene_bool_{ 245513 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSScene_void_{ 870511 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSSoundCategorySnapshot_void_{ 920301 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSSoundCategory_void_{ 58853 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BGSTerminal_void_{ 577268 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSInputEnableLayer_bool_{ 1484202 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSInputEnableLayer_void_{ 793082 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__Object_bool_{ 416589 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__Object_void_{ 29673 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_ActorValueInfoconst_{ 474773 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_Actor_{ 1196494 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_BSFixedString_{ 97158 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_BSInputEnableLayer_{ 886086 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_BSScript__ArrayWrapper_Actor__{ 664609 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_TESObjectREFR_{ 571304 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_TESWeather_{ 897309 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_bool_{ 370774 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_float_{ 477794 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_int_{ 1490211 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_unsignedint_{ 365155 };
+		inline constexpr REL::ID BSScript__NativeFunction0_BSScript__StaticFunctionTag_void_{ 1457803 };
+		inline constexpr REL::ID BSScript__NativeFunction0_EffectSetting_bool_{ 55827 };
+		inline constexpr REL::ID BSScript__NativeFunction0_EnchantmentItem_bool_{ 667625 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_Actor_{ 1439651 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESFaction_{ 1557650 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESForm_{ 268856 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESNPC_{ 389414 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESObjectREFR_{ 493344 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_bool_{ 238252 };
+		inline constexpr REL::ID BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_void_{ 988607 };
+		inline constexpr REL::ID BSScript__NativeFunction0_IngredientItem_bool_{ 288170 };
+		inline constexpr REL::ID BSScript__NativeFunction0_IngredientItem_unsignedint_{ 1511585 };
+		inline constexpr REL::ID BSScript__NativeFunction0_IngredientItem_void_{ 540788 };
+		inline constexpr REL::ID BSScript__NativeFunction0_SpellItem_bool_{ 1461122 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESFaction_bool_{ 117151 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESFaction_unsignedint_{ 729058 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESFaction_void_{ 183150 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESForm_bool_{ 235082 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESForm_int_{ 421293 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESForm_unsignedint_{ 248765 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESForm_void_{ 407571 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESFurniture_TESForm_{ 1019089 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESGlobal_float_{ 48293 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESImageSpaceModifier_void_{ 473303 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESLevCharacter_void_{ 553148 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESLevItem_void_{ 193997 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESLevSpell_void_{ 977792 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_Actor_{ 338833 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_BGSListForm_{ 525462 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_TESClass_{ 1323249 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_TESRace_{ 1136834 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_bool_{ 731411 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_int_{ 352558 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESNPC_unsignedint_{ 1529211 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectACTI_bool_{ 764154 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectCELL_TESFaction_{ 1016088 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectCELL_TESNPC_{ 404549 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectCELL_bool_{ 484111 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectCELL_void_{ 1095693 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_BGSEncounterZone_{ 507214 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_BGSLocation_{ 1398263 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_BGSScene_{ 866309 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_BGSVoiceType_{ 1302081 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_BSScript__ArrayWrapper_BGSLocationRefType__{ 26793 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_TESKey_{ 400064 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_TESObjectCELL_{ 451944 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_TESWorldSpace_{ 770376 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_bool_{ 313015 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_float_{ 1253364 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_int_{ 787241 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_unsignedint_{ 1422731 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectREFR_void_{ 19105 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESObjectWEAP_TESAmmo_{ 1525763 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESPackage_TESPackageconst_{ 22364 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESPackage_TESQuest_{ 993296 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESQuest_bool_{ 1498407 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESQuest_unsignedint_{ 1152470 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESQuest_void_{ 368219 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESTopicInfo_TESQuest_{ 1004059 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESTopicInfo_bool_{ 33170 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESTopic_void_{ 612250 };
+		inline constexpr REL::ID BSScript__NativeFunction0_TESWeather_int_{ 724876 };
+		inline constexpr REL::ID BSScript__NativeFunction10_TESObjectREFR_bool_BGSKeyword_BGSMessage_BGSLocation_BGSListForm_BGSListForm_bool_bool_bool_bool_bool_{ 1019324 };
+		inline constexpr REL::ID BSScript__NativeFunction10_TESObjectREFR_unsignedint_BGSKeyword_BGSMessage_BGSLocation_BGSListForm_BGSListForm_bool_bool_bool_bool_bool_{ 660458 };
+		inline constexpr REL::ID BSScript__NativeFunction11_BSInputEnableLayer_void_bool_bool_bool_bool_bool_bool_bool_bool_bool_bool_bool_{ 1404200 };
+		inline constexpr REL::ID BSScript__NativeFunction11_TESObjectREFR_void_TESObjectREFR_float_float_float_float_float_float_float_float_int_float_{ 152811 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_SpellItem_unsignedint_{ 630854 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_TESObjectWEAP_unsignedint_{ 1242244 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_Actor_{ 402671 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_BGSKeyword_{ 592575 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_BGSPerk_{ 43421 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_BSFixedStringconst_{ 1266626 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_EffectSetting_{ 1014190 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_SpellItem_{ 1283317 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_TESFaction_{ 295613 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_TESForm_{ 655372 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_TESIdleForm_{ 268409 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_TESObjectREFR_{ 1373319 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_bool_bool_{ 1562694 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_int_Actor_{ 1294006 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_int_TESFaction_{ 1055522 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_int_unsignedint_{ 882775 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_unsignedint_Actor_{ 84898 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_unsignedint_TESObjectREFR_{ 186025 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_Actor_{ 907345 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_BGSKeyword_{ 54176 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_BGSPerk_{ 1038685 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_BGSTextureSet_{ 666015 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_BGSVoiceType_{ 1529696 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_BSFixedStringconst_{ 1397841 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_TESCombatStyle_{ 852212 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_TESFaction_{ 427123 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_TESForm_{ 1217906 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_TESObjectREFR_{ 1277305 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_TESRace_{ 558938 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_bool_{ 1044782 };
+		inline constexpr REL::ID BSScript__NativeFunction1_Actor_void_unsignedint_{ 1463948 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSInstanceNamingRules_void_BGSInstanceNamingRulesconst_{ 668355 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSListForm_TESForm_unsignedint_{ 60489 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSListForm_bool_TESForm_{ 1283548 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSListForm_int_TESForm_{ 1031164 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSListForm_void_TESForm_{ 419678 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocAlias_void_BGSLocation_{ 303403 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocation_BSScript__ArrayWrapper_BGSLocation__BGSKeyword_{ 821785 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocation_bool_BGSLocationRefType_{ 182934 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocation_bool_BGSLocation_{ 1233065 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocation_float_BGSKeyword_{ 1167263 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocation_unsignedint_BGSLocationRefType_{ 635467 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSLocation_void_bool_{ 873623 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSRefAlias_void_TESObjectREFR_{ 1005046 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSRefCollectionAlias_TESObjectREFR_unsignedint_{ 1070903 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSRefCollectionAlias_int_TESObjectREFR_{ 20270 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSRefCollectionAlias_void_TESObjectREFR_{ 552938 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSReferenceEffect_void_TESObjectREFR_{ 1402570 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSScene_bool_unsignedint_{ 72765 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSScene_void_bool_{ 418050 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSShaderParticleGeometryData_void_float_{ 591189 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSSoundCategorySnapshot_void_float_{ 308864 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSSoundCategory_void_float_{ 670732 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSSoundDescriptorForm_bool_TESObjectREFR_{ 313236 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BGSSoundDescriptorForm_unsignedint_TESObjectREFR_{ 938465 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSInputEnableLayer_void_bool_{ 872198 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__Object_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount__BSFixedStringconst_{ 962464 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__Object_bool_BSFixedStringconst_{ 948745 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__Object_void_BSFixedStringconst_{ 548517 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__Object_void_BSScript__Object_{ 15781 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__Object_void_TESForm_{ 989783 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__Object_void_unsignedint_{ 350920 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_BSFixedString_BSFixedStringconst_{ 1289632 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_BSFixedString_float_{ 855975 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_BSFixedString_unsignedint_{ 375992 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_TESForm_int_{ 519187 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_TESWeather_unsignedint_{ 645229 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_bool_BSFixedStringconst_{ 204338 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_bool_float_{ 1420868 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_bool_unsignedint_{ 562634 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_float_BSFixedStringconst_{ 1476437 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_float_float_{ 924208 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_int_BSFixedStringconst_{ 1382690 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_int_float_{ 392238 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_unsignedint_unsignedint_{ 1089318 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_Actor_{ 77429 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_BSFixedStringconst_{ 486896 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_BSScript__Object_{ 1161212 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_TESObjectREFR_{ 1147359 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_TESQuest_{ 110921 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_bool_{ 629418 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_float_{ 1473349 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_int_{ 1437832 };
+		inline constexpr REL::ID BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_unsignedint_{ 889139 };
+		inline constexpr REL::ID BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_bool_BGSKeyword_{ 663421 };
+		inline constexpr REL::ID BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_bool_BGSListForm_{ 570088 };
+		inline constexpr REL::ID BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_bool_bool_{ 1028389 };
+		inline constexpr REL::ID BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_void_BGSKeywordconst_{ 872423 };
+		inline constexpr REL::ID BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_void_BGSMod__Attachment__Mod_{ 1068258 };
+		inline constexpr REL::ID BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_void_bool_{ 267406 };
+		inline constexpr REL::ID BSScript__NativeFunction1_IngredientItem_void_unsignedint_{ 899871 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESEffectShader_void_TESObjectREFR_{ 1101807 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESFaction_bool_TESFaction_{ 1513267 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESFaction_unsignedint_Actor_{ 901488 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESFaction_void_bool_{ 1219720 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESFaction_void_unsignedint_{ 608051 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESForm_bool_BGSKeyword_{ 594440 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESForm_bool_BGSListForm_{ 1205886 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESGlobal_void_float_{ 221290 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESImageSpaceModifier_void_float_{ 393829 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESNPC_void_bool_{ 903824 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectCELL_void_TESFaction_{ 736748 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectCELL_void_TESNPC_{ 124943 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectCELL_void_bool_{ 1375168 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectCELL_void_float_{ 1427155 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectMISC_unsignedint_BGSComponent_{ 456370 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__Actor_{ 172714 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__BGSKeyword_{ 1264055 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_TESObjectREFR_BGSKeyword_{ 1011559 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_Actor_{ 556370 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_BGSKeyword_{ 1195292 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_BGSLocationRefType_{ 476589 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_BSFixedStringconst_{ 282445 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_TESObjectREFR_{ 447296 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_bool_{ 1481363 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_bool_float_{ 790249 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_float_ActorValueInfoconst_{ 1318887 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_float_BSFixedStringconst_{ 800911 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_float_TESObjectREFR_{ 1478313 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_int_BSFixedStringconst_{ 1332552 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_unsignedint_TESForm_{ 1464384 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_unsignedint_unsignedint_{ 378747 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_Actor_{ 1306779 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_BGSLocation_{ 799519 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_BGSMessage_{ 336128 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_TESForm_{ 456602 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_TESObjectREFR_{ 738352 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_bool_{ 1124690 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_float_{ 1317464 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESObjectREFR_void_unsignedint_{ 1252021 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESQuest_BGSBaseAlias_unsignedint_{ 541236 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESQuest_bool_TESGlobal_{ 1297706 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESQuest_bool_int_{ 872671 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESQuest_bool_unsignedint_{ 1325057 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESQuest_void_bool_{ 88595 };
+		inline constexpr REL::ID BSScript__NativeFunction1_TESWeather_void_bool_{ 112989 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_bool_BGSAction_TESObjectREFR_{ 879684 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_bool_BGSAssociationType_Actor_{ 323236 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_bool_SpellItem_bool_{ 433066 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_bool_TESIdleForm_TESObjectREFR_{ 347646 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_bool_TESObjectREFR_float_{ 1239191 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_Actor_bool_{ 983559 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_Actor_int_{ 1170278 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_BGSOutfit_bool_{ 917974 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_BGSPerk_bool_{ 1403980 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_BSFixedStringconst_float_{ 372257 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_SpellItem_TESObjectREFR_{ 312542 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_SpellItem_unsignedint_{ 564986 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_TESFaction_int_{ 548309 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_TESForm_int_{ 1519039 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_TESObjectREFR_bool_{ 306445 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_bool_bool_{ 1362544 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_float_bool_{ 459821 };
+		inline constexpr REL::ID BSScript__NativeFunction2_Actor_void_float_float_{ 1375655 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BGSEncounterZone_BSScript__ArrayWrapper_Actor__BGSKeyword_BGSKeyword_{ 251604 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BGSEncounterZone_int_BGSKeyword_BGSKeyword_{ 783751 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BGSLocation_bool_BGSLocation_BGSKeyword_{ 103270 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BGSLocation_void_BGSKeyword_float_{ 1485616 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BGSLocation_void_BGSLocation_BGSKeyword_{ 1353575 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_bool_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ 1242477 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_bool_BSFixedStringconst_BSScript__Variable_{ 1052760 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_bool_BSScript__Object_BSFixedStringconst_{ 628019 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_bool_TESObjectREFR_BSFixedStringconst_{ 1028141 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_Actor_TESObjectREFR_{ 402902 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ 4945 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_BSFixedStringconst_BSScript__Variable_{ 959514 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_BSFixedStringconst_int_{ 95740 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_BSScript__Object_BSFixedStringconst_{ 935008 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_BSScript__Object_BSScript__Object_{ 1384338 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_TESObjectREFR_BSFixedStringconst_{ 1478093 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_TESObjectREFR_TESObjectREFR_{ 852459 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__Object_void_float_unsignedint_{ 866097 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_TESForm_unsignedint_BSFixedStringconst_{ 1569633 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_float_float_float_{ 1442547 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_int_int_int_{ 323890 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_ActorValueInfo_unsignedint_{ 557558 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BGSCameraShot_TESObjectREFR_{ 661599 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_BGSSoundDescriptorForm_{ 1127464 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSFixedStringconst_{ 1280994 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSScript__Object_{ 1054142 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_bool_{ 1374012 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_float_{ 905925 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_int_{ 463804 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_unsignedint_{ 960896 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_bool_bool_{ 1006720 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_unsignedint_bool_{ 609474 };
+		inline constexpr REL::ID BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_unsignedint_float_{ 1363188 };
+		inline constexpr REL::ID BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_bool_BGSMod__Attachment__Mod_unsignedint_{ 924438 };
+		inline constexpr REL::ID BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_Actor_bool_{ 1293079 };
+		inline constexpr REL::ID BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_Actor_float_{ 1203038 };
+		inline constexpr REL::ID BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_BSFixedStringconst_TESForm_{ 779531 };
+		inline constexpr REL::ID BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_TESFaction_bool_{ 294675 };
+		inline constexpr REL::ID BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_TESNPC_bool_{ 1386164 };
+		inline constexpr REL::ID BSScript__NativeFunction2_ScrollItem_bool_TESObjectREFR_TESObjectREFR_{ 1408744 };
+		inline constexpr REL::ID BSScript__NativeFunction2_SpellItem_bool_TESObjectREFR_TESObjectREFR_{ 597457 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESEffectShader_void_TESObjectREFR_float_{ 51391 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESFaction_bool_bool_bool_{ 967134 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESFaction_void_bool_bool_{ 1153635 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESFaction_void_int_bool_{ 542476 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESImageSpaceModifier_void_TESImageSpaceModifier_float_{ 1005261 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESLevCharacter_void_TESForm_unsignedint_{ 1084879 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESLevSpell_void_TESForm_unsignedint_{ 366355 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESNPC_void_BGSOutfit_bool_{ 1295803 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectCELL_void_float_float_{ 816027 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_Actor__BGSKeyword_BGSKeyword_{ 907806 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__ActorValueInfoconst_unsignedint_{ 517990 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__BGSKeyword_BGSKeyword_{ 1502859 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__BGSKeyword_unsignedint_{ 479673 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__TESForm_float_{ 43869 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_float__float_float_{ 704952 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_TESObjectREFR_unsignedint_BGSKeyword_{ 372678 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_{ 1244317 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_bool_TESForm_BGSMod__Attachment__Mod_{ 831320 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_bool_TESForm_unsignedint_{ 576106 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_bool_TESObjectREFR_bool_{ 1418093 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_bool_unsignedint_bool_{ 1527131 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_int_BGSKeyword_BGSKeyword_{ 631286 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_unsignedint_BGSKeyword_unsignedint_{ 98990 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_ActorValueInfoconst_float_{ 1401380 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_Actor_unsignedint_{ 1149164 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_BGSKeyword_bool_{ 510289 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_BGSLocation_BGSLocationRefType_{ 281062 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_BSFixedStringconst_{ 684969 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_bool_{ 1279389 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_float_{ 747631 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_int_{ 215523 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_TESForm_BGSMod__Attachment__Mod_{ 974960 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_TESFormconst_unsignedint_{ 426182 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_TESObjectREFR_BGSKeyword_{ 201766 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_TESObjectREFR_bool_{ 671147 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_bool_bool_{ 1349308 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectREFR_void_float_float_{ 1167704 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESObjectWEAP_void_TESObjectREFR_TESAmmo_{ 36283 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESQuest_void_unsignedint_bool_{ 1045492 };
+		inline constexpr REL::ID BSScript__NativeFunction2_TESWeather_void_bool_bool_{ 976616 };
+		inline constexpr REL::ID BSScript__NativeFunction3_Actor_void_BGSHeadPart_bool_bool_{ 1204046 };
+		inline constexpr REL::ID BSScript__NativeFunction3_Actor_void_TESForm_bool_bool_{ 1535738 };
+		inline constexpr REL::ID BSScript__NativeFunction3_Actor_void_bool_bool_bool_{ 68122 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BGSReferenceEffect_void_TESObjectREFR_float_TESObjectREFR_{ 1496291 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__Object_void_BSScript__Object_BSScript__Object_float_{ 655588 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__StaticFunctionTag_bool_BSFixedStringconst_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ 430729 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__StaticFunctionTag_bool_BSFixedStringconst_BSFixedStringconst_unsignedint_{ 867436 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ 71805 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_TESObjectREFR_float_float_{ 941073 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_bool_bool_bool_{ 439409 };
+		inline constexpr REL::ID BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_float_float_float_{ 847794 };
+		inline constexpr REL::ID BSScript__NativeFunction3_GameScript__RefrOrInventoryObj_Actor_TESNPC_unsignedint_BGSEncounterZone_{ 646626 };
+		inline constexpr REL::ID BSScript__NativeFunction3_GameScript__RefrOrInventoryObj_bool_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ 1486033 };
+		inline constexpr REL::ID BSScript__NativeFunction3_GameScript__RefrOrInventoryObj_bool_float_float_float_{ 229202 };
+		inline constexpr REL::ID BSScript__NativeFunction3_SpellItem_bool_TESObjectREFR_Actor_TESObjectREFR_{ 1554416 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESFaction_void_TESFaction_bool_bool_{ 1578829 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESLevItem_void_TESForm_unsignedint_unsignedint_{ 1164507 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_bool_BGSComponent_unsignedint_bool_{ 750674 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_bool_BGSKeyword_BGSMessage_BGSLocation_{ 594674 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_bool_BSFixedStringconst_TESObjectREFR_BSFixedStringconst_{ 525699 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_bool_BSFixedStringconst_bool_float_{ 712608 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_bool_GameScript__FormOrInventoryObj_unsignedint_bool_{ 965747 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_bool_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ 1288417 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESObjectREFR_void_float_float_float_{ 1265689 };
+		inline constexpr REL::ID BSScript__NativeFunction3_TESQuest_void_unsignedint_bool_bool_{ 74841 };
+		inline constexpr REL::ID BSScript__NativeFunction4_Actor_void_BSFixedStringconst_bool_bool_bool_{ 233206 };
+		inline constexpr REL::ID BSScript__NativeFunction4_BSScript__Object_void_BSScript__Object_BSScript__Object_TESForm_bool_{ 641783 };
+		inline constexpr REL::ID BSScript__NativeFunction4_BSScript__Object_void_TESObjectREFR_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ 309786 };
+		inline constexpr REL::ID BSScript__NativeFunction4_BSScript__StaticFunctionTag_Actor_float_float_float_float_{ 971519 };
+		inline constexpr REL::ID BSScript__NativeFunction4_TESObjectREFR_bool_GameScript__FormOrInventoryObj_int_bool_TESObjectREFR_{ 564035 };
+		inline constexpr REL::ID BSScript__NativeFunction4_TESObjectREFR_bool_TESForm_unsignedint_bool_TESObjectREFR_{ 1521110 };
+		inline constexpr REL::ID BSScript__NativeFunction4_TESObjectREFR_bool_float_float_float_float_{ 233679 };
+		inline constexpr REL::ID BSScript__NativeFunction4_TESObjectREFR_void_BGSKeyword_Actor_bool_TESObjectREFR_{ 1399957 };
+		inline constexpr REL::ID BSScript__NativeFunction4_TESObjectREFR_void_TESObjectREFR_float_float_bool_{ 1247400 };
+		inline constexpr REL::ID BSScript__NativeFunction4_TESObjectREFR_void_TESTopic_Actor_bool_TESObjectREFR_{ 1493688 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BGSKeyword_bool_BGSLocation_TESObjectREFR_TESObjectREFR_unsignedint_unsignedint_{ 317248 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BGSKeyword_void_BGSLocation_TESObjectREFR_TESObjectREFR_unsignedint_unsignedint_{ 65028 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BSScript__StaticFunctionTag_TESObjectREFR_BGSListForm_float_float_float_float_{ 626335 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BSScript__StaticFunctionTag_TESObjectREFR_TESForm_float_float_float_float_{ 280615 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSFixedStringconst_BSFixedStringconst_BSFixedStringconst_BSFixedStringconst_{ 30104 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BSScript__StaticFunctionTag_void_TESObjectREFR_unsignedint_TESObjectREFR_TESObjectREFR_TESObjectREFR_{ 315831 };
+		inline constexpr REL::ID BSScript__NativeFunction5_BSScript__StaticFunctionTag_void_bool_bool_float_float_bool_{ 812794 };
+		inline constexpr REL::ID BSScript__NativeFunction5_GameScript__RefrOrInventoryObj_TESObjectREFR_TESForm_unsignedint_bool_bool_bool_{ 300785 };
+		inline constexpr REL::ID BSScript__NativeFunction5_GameScript__RefrOrInventoryObj_bool_GameScript__RefrOrInventoryObj_float_float_float_bool_{ 183380 };
+		inline constexpr REL::ID BSScript__NativeFunction5_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ 778148 };
+		inline constexpr REL::ID BSScript__NativeFunction5_TESObjectREFR_void_TESObjectREFR_BSFixedStringconst_float_float_float_{ 958332 };
+		inline constexpr REL::ID BSScript__NativeFunction5_TESObjectREFR_void_float_float_BGSSoundOutput_bool_bool_{ 197162 };
+		inline constexpr REL::ID BSScript__NativeFunction6_BGSMessage_void_BSFixedStringconst_float_float_int_BSFixedStringconst_int_{ 234864 };
+		inline constexpr REL::ID BSScript__NativeFunction6_BSScript__StaticFunctionTag_bool_BSFixedStringconst_bool_bool_bool_bool_bool_{ 703092 };
+		inline constexpr REL::ID BSScript__NativeFunction6_TESObjectCELL_void_unsignedint_unsignedint_unsignedint_unsignedint_unsignedint_unsignedint_{ 204569 };
+		inline constexpr REL::ID BSScript__NativeFunction6_TESObjectREFR_void_BSFixedStringconst_float_float_float_bool_bool_{ 154251 };
+		inline constexpr REL::ID BSScript__NativeFunction6_TESObjectREFR_void_BSFixedStringconst_float_float_float_float_bool_{ 845056 };
+		inline constexpr REL::ID BSScript__NativeFunction7_TESObjectREFR_TESObjectREFR_BSFixedStringconst_TESForm_unsignedint_bool_bool_bool_bool_{ 991628 };
+		inline constexpr REL::ID BSScript__NativeFunction8_TESObjectREFR_bool_BGSImpactDataSet_BSFixedStringconst_float_float_float_float_bool_bool_{ 180368 };
+		inline constexpr REL::ID BSScript__NativeFunction8_TESObjectREFR_void_float_float_float_float_float_float_float_float_{ 1476903 };
+		inline constexpr REL::ID BSScript__NativeFunction9_BGSMessage_bool_float_float_float_float_float_float_float_float_float_{ 1205656 };
+		inline constexpr REL::ID BSScript__NativeFunction9_BSScript__Object_void_BSScript__Object_BSScript__Object_TESForm_TESForm_int_int_int_int_bool_{ 123302 };
+		inline constexpr REL::ID BSScript__NativeFunction9_TESObjectREFR_void_float_float_float_float_float_float_float_float_float_{ 346695 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction0_Actor_void_{ 1159606 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction0_EffectSetting_BSFixedStringconst_{ 588139 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction0_GameScript__RefrOrInventoryObj_bool_{ 505828 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction0_GameScript__RefrOrInventoryObj_void_{ 1233509 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction0_TESObjectREFR_void_{ 989999 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction0_TESQuest_bool_{ 686604 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction10_TESObjectREFR_BGSLocation_BGSKeyword_BGSMessage_BGSLocation_BGSListForm_BGSListForm_bool_bool_bool_bool_bool_{ 939869 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_BGSSoundDescriptorForm_bool_TESObjectREFR_{ 406408 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_BSScript__Object_BSScript__Variable_BSFixedStringconst_{ 1041978 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_BSScript__StaticFunctionTag_BSFixedStringconst_unsignedint_{ 656051 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_BSScript__StaticFunctionTag_float_BSFixedStringconst_{ 297257 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_BSScript__StaticFunctionTag_void_float_{ 1187791 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_GameScript__RefrOrInventoryObj_void_bool_{ 1560758 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_TESObjectREFR_TESObjectREFR_bool_{ 496418 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_TESObjectREFR_bool_BSFixedStringconst_{ 1556251 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_TESObjectREFR_void_TESObjectREFR_{ 881797 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_TESObjectREFR_void_bool_{ 869297 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_TESObjectREFR_void_float_{ 178715 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction1_TESQuest_bool_int_{ 261263 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_Actor_bool_TESObjectREFR_float_{ 189100 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_BSScript__Object_BSScript__Variable_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ 457786 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_BSScript__Object_void_BSFixedStringconst_BSScript__Variable_{ 1145930 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_ScrollItem_void_TESObjectREFR_TESObjectREFR_{ 358576 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_SpellItem_void_TESObjectREFR_TESObjectREFR_{ 1129116 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_TESFaction_void_bool_bool_{ 355575 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_TESObjectREFR_TESObjectREFR_TESForm_unsignedint_{ 1107990 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_{ 1337158 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction2_TESObjectREFR_void_unsignedint_bool_{ 188103 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_BSScript__StaticFunctionTag_BSScript__Variable_BSFixedStringconst_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ 351367 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_GameScript__RefrOrInventoryObj_void_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ 701885 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_GameScript__RefrOrInventoryObj_void_float_float_float_{ 761317 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_SpellItem_void_TESObjectREFR_Actor_TESObjectREFR_{ 65240 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_TESObjectREFR_BGSLocation_BGSKeyword_BGSMessage_BGSLocation_{ 248991 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_TESObjectREFR_void_BGSComponent_unsignedint_bool_{ 1282340 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction3_TESObjectREFR_void_GameScript__FormOrInventoryObj_unsignedint_bool_{ 1058985 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction4_TESObjectREFR_void_GameScript__FormOrInventoryObj_int_bool_TESObjectREFR_{ 218460 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction4_TESObjectREFR_void_TESForm_unsignedint_bool_TESObjectREFR_{ 470420 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction4_TESObjectREFR_void_float_float_float_float_{ 1204521 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction5_BGSKeyword_bool_BGSLocation_TESObjectREFR_TESObjectREFR_unsignedint_unsignedint_{ 1554187 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction5_GameScript__RefrOrInventoryObj_void_GameScript__RefrOrInventoryObj_float_float_float_bool_{ 276439 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction5_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ 432094 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction6_BSScript__StaticFunctionTag_void_BSFixedStringconst_bool_bool_bool_bool_bool_{ 356957 };
+		inline constexpr REL::ID BSScript__NativeLatentFunction9_BGSMessage_int_float_float_float_float_float_float_float_float_float_{ 594202 };
+		inline constexpr REL::ID BSScript__ObjectBindPolicy{ 486032 };
+		inline constexpr REL::ID BSScript__ObjectTypeInfo{ 754695 };
+		inline constexpr REL::ID BSScript__SimpleAllocMemoryPagePolicy{ 462882 };
+		inline constexpr REL::ID BSScript__StructTypeInfo{ 789838 };
+		inline constexpr REL::ID BSScript__UnlinkedTypes__InstructionStream__InstructionFunctor{ 1025130 };
+		inline constexpr REL::ID BSScript__UnlinkedTypes____BuildInstructionOffsetMapFunctor{ 572923 };
+		inline constexpr REL::ID BSScript__UnlinkedTypes____CollectStringsFunctor{ 1090969 };
+		inline constexpr REL::ID BSScript__UnlinkedTypes____CountInstructionInfo{ 493134 };
+		inline constexpr REL::ID BSScript__UnlinkedTypes____UnpackInstructionsFunctor{ 40589 };
+		inline constexpr REL::ID BSScript__UnlinkedTypes____WriteInstructionsFunctor{ 1104767 };
+		inline constexpr REL::ID BSSearchPath{ 1126908 };
+		inline constexpr REL::ID BSSegmentDataStorage{ 1064672 };
+		inline constexpr REL::ID BSSegmentedTriShape{ 599159 };
+		inline constexpr REL::ID BSShader{ 403878 };
+		inline constexpr REL::ID BSShaderAccumulator{ 1441346 };
+		inline constexpr REL::ID BSShaderMaterial{ 832024 };
+		inline constexpr REL::ID BSShaderMaterialExtraData{ 270390 };
+		inline constexpr REL::ID BSShaderProperty{ 261669 };
+		inline constexpr REL::ID BSShaderProperty__ForEachVisitor{ 46775 };
+		inline constexpr REL::ID BSShaderResourceManager{ 54169 };
+		inline constexpr REL::ID BSShaderTextureSet{ 1573877 };
+		inline constexpr REL::ID BSShaderUtil__SetTexturesCanDegrade__2__functor{ 1430483 };
+		inline constexpr REL::ID BSShadowDirectionalLight{ 1088391 };
+		inline constexpr REL::ID BSShadowFrustumLight{ 600186 };
+		inline constexpr REL::ID BSShadowLight{ 570356 };
+		inline constexpr REL::ID BSShadowParabolicLight{ 1211793 };
+		inline constexpr REL::ID BSShapeConstructor{ 132198 };
+		inline constexpr REL::ID BSSimpleList_TESRegionGrassObject_{ 161109 };
+		inline constexpr REL::ID BSSimpleList_TESRegionObject_{ 319880 };
+		inline constexpr REL::ID BSSimpleList_TESRegion_{ 1430356 };
+		inline constexpr REL::ID BSSimpleScaleController{ 1108835 };
+		inline constexpr REL::ID BSSkin__BoneData{ 270381 };
+		inline constexpr REL::ID BSSkin__Instance{ 1366852 };
+		inline constexpr REL::ID BSSkyShader{ 33206 };
+		inline constexpr REL::ID BSSkyShaderProperty{ 1130302 };
+		inline constexpr REL::ID BSSmallBlockAllocator{ 801505 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__ExternalAllocHelper_BSGraphics__ResourceCacheAllocator_{ 499092 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__ExternalAllocHelper___BSPointerAllocatorPageAllocator_{ 1526338 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_24___BSPointerAllocatorPageAllocator_BSNonReentrantSpinLock_{ 303032 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_32_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 1456285 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_40_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 658476 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_48_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 1442410 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_56_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 1297111 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_64_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 445501 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_80_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 1230131 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__TLockingUserPool_88_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ 431742 };
+		inline constexpr REL::ID BSSmallBlockAllocatorUtil__UserPoolBase{ 535503 };
+		inline constexpr REL::ID BSSocket{ 832583 };
+		inline constexpr REL::ID BSSocketServer{ 980534 };
+		inline constexpr REL::ID BSSpeedSamplerModifier{ 902444 };
+		inline constexpr REL::ID BSSphereConstructor{ 697549 };
+		inline constexpr REL::ID BSSplatterExtraData{ 1323831 };
+		inline constexpr REL::ID BSStateMachineCallbackSingleton{ 1422020 };
+		inline constexpr REL::ID BSStaticTriShapeDB__Builder{ 849073 };
+		inline constexpr REL::ID BSStaticTriShapeDB__CsgStream{ 336243 };
+		inline constexpr REL::ID BSStaticTriShapeDB__DBTraits{ 750784 };
+		inline constexpr REL::ID BSStaticTriShapeDB__IBatchRequestIter{ 805962 };
+		inline constexpr REL::ID BSStaticTriShapeDB__Manager{ 802686 };
+		inline constexpr REL::ID BSStaticTriShapeDB__QueuedHandles{ 418595 };
+		inline constexpr REL::ID BSSteamAwardsSystemUtility{ 1305590 };
+		inline constexpr REL::ID BSSteamSystemUtility{ 474733 };
+		inline constexpr REL::ID BSStorage{ 193666 };
+		inline constexpr REL::ID BSStream{ 1156355 };
+		inline constexpr REL::ID BSStreamParserData{ 964392 };
+		inline constexpr REL::ID BSStringPool__IterationCallback{ 1335452 };
+		inline constexpr REL::ID BSStripPSysData{ 997151 };
+		inline constexpr REL::ID BSStripParticleSystem{ 397230 };
+		inline constexpr REL::ID BSSubBehaviorGraphSingletonData{ 470377 };
+		inline constexpr REL::ID BSSubBehaviorGraphSingletonDataAddToDeferredDeleterTask{ 1578327 };
+		inline constexpr REL::ID BSSubIndexTriShape{ 1330612 };
+		inline constexpr REL::ID BSSupportedShapeConstructor_BSRoundedConeSupportFunctor_{ 1514527 };
+		inline constexpr REL::ID BSSysInfoSystemUtility{ 246221 };
+		inline constexpr REL::ID BSSystemFileAsyncFunctor{ 1289028 };
+		inline constexpr REL::ID BSSystemFileStorage{ 1392763 };
+		inline constexpr REL::ID BSSystemFileStreamer__Streamer{ 1242595 };
+		inline constexpr REL::ID BSSystemFileStreamer__Streamer__ControlThread{ 836597 };
+		inline constexpr REL::ID BSSystemFileStreamer__Streamer__PhysicalReadThread{ 1448091 };
+		inline constexpr REL::ID BSSystemFileStreamer__Streamer__StreamerThread{ 225190 };
+		inline constexpr REL::ID BSSystemMonitor__MemOpsThread{ 1497009 };
+		inline constexpr REL::ID BSSystemMonitor__SocketThread{ 1543364 };
+		inline constexpr REL::ID BSSystemUtilitiesStrings{ 1249963 };
+		inline constexpr REL::ID BSSystemUtility{ 208998 };
+		inline constexpr REL::ID BSTAlignedHeapArrayAllocator_16___AllocatorFunctor{ 223808 };
+		inline constexpr REL::ID BSTAlignedScrapArrayAllocator_16___AllocatorFunctor{ 551459 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_bool_ActorCCOnStairsChannel_{ 1513394 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_bool_ActorCCSuportChannel_{ 1088044 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorCCNormDotUpChannel_{ 289905 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorCopyGraphVariableChannel_{ 409261 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorDirectionChannel_{ 1422626 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorDirectionDegreesChannel_{ 1046839 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorLeftWeaponSpeedChannel_{ 1461235 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorPitchChannel_{ 1408861 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorPitchDeltaChannel_{ 597566 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorRollChannel_{ 611233 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorSpeedChannel_{ 625033 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorSpeedSmoothedChannel_{ 1405896 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorTimeDeltaChannel_{ 303761 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorTurnDeltaChannel_{ 1395129 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorTurnDeltaSmoothedChannel_{ 1153765 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorWardHealthChannel_{ 1093485 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_ActorWeaponSpeedChannel_{ 238144 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerControllerXRawChannel_{ 2247 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerControllerXSmoothedChannel_{ 1066757 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerControllerXSumChannel_{ 1267196 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerControllerYRawChannel_{ 1226042 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerControllerYSmoothedChannel_{ 548858 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerControllerYSumChannel_{ 907934 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerDirectionSmoothedChannel_{ 669626 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerFirstSpeedSmoothedChannel_{ 749148 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_float_PlayerPitchDeltaSmoothedChannel_{ 151280 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_int_ActorCopyGraphVariableChannel_{ 768863 };
+		inline constexpr REL::ID BSTAnimationGraphDataChannel_Actor_int_ActorWantBlockChannel_{ 1101912 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSScrapArrayAllocator_{ 1009654 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTArrayHeapAllocator_{ 578870 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_1024__{ 553560 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_104__{ 496 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_108__{ 769320 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_112__{ 236824 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_120__{ 178453 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_128__{ 1289813 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_12__{ 347044 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_160__{ 37589 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_168__{ 1394209 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_16__{ 715549 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_1760__{ 898748 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_176__{ 251704 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_2048__{ 1377295 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_24__{ 379544 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_256__{ 135951 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_26__{ 876092 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_280__{ 823422 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_2944__{ 862364 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_320__{ 147631 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_32__{ 1183503 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_36__{ 702254 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_384__{ 334102 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_40__{ 661976 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_48__{ 683782 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_4__{ 790937 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_512__{ 834230 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_576__{ 235399 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_64__{ 1504564 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_672__{ 712706 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_80__{ 488634 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_896__{ 344104 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_8__{ 440963 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_96__{ 1090292 };
+		inline constexpr REL::ID BSTArrayAllocatorFunctor_NVFlex__PinnedArrayAllocator_{ 1099608 };
+		inline constexpr REL::ID BSTArrayBase__IAllocatorFunctor{ 5586 };
+		inline constexpr REL::ID BSTCaseInsensitiveStringMap_IDLE_ANIM_ROOT_{ 143983 };
+		inline constexpr REL::ID BSTCommonLLMessageQueue_BSScript__Internal__FunctionMessage_{ 78852 };
+		inline constexpr REL::ID BSTCommonLLMessageQueue_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ 1037015 };
+		inline constexpr REL::ID BSTCommonMessageQueue_BSPackedTask_{ 267791 };
+		inline constexpr REL::ID BSTCommonMessageQueue_BSScript__Internal__FunctionMessage_{ 1128914 };
+		inline constexpr REL::ID BSTCommonMessageQueue_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ 239176 };
+		inline constexpr REL::ID BSTCommonScrapHeapMessageQueue_BSPackedTask_{ 1457928 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_BGSCombinedCellGeometryDB__ModelDB__DBTraits__StorageType_8192_{ 859997 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_BGSCombinedCellGeometryDB__PreloadTask__PreloadRequest_1024_{ 1046590 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_BGSDecalManager__PendingSkinnedDecal_128_{ 831685 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_BGSSaveLoadThread__AsyncRequest_8_{ 153680 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_BSFaceGenManager__PendingCustomizationData_128_{ 966571 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_BSScript__Internal__SuspendedStack_128_{ 1208746 };
+		inline constexpr REL::ID BSTCommonStaticMessageQueue_NiPointer_NiAVObject__256_{ 1467051 };
+		inline constexpr REL::ID BSTDataBuffer_2_BSDataBufferHeapAllocator_{ 1444073 };
+		inline constexpr REL::ID BSTDerivedCreator_ActionActivateDoneHandler_IHandlerFunctor_Actor_BSFixedString__{ 498844 };
+		inline constexpr REL::ID BSTDerivedCreator_AddRagdollHandler_IHandlerFunctor_Actor_BSFixedString__{ 1035456 };
+		inline constexpr REL::ID BSTDerivedCreator_AlertStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 1413262 };
+		inline constexpr REL::ID BSTDerivedCreator_AllowRotationHandler_IHandlerFunctor_Actor_BSFixedString__{ 797345 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimatedCameraDeltaStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 1110655 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimatedCameraEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 205758 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimatedCameraStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 1577070 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationDrivenHandler_IHandlerFunctor_Actor_BSFixedString__{ 119816 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationObjectDrawHandler_IHandlerFunctor_Actor_BSFixedString__{ 1116648 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationObjectLoadHandler_IHandlerFunctor_Actor_BSFixedString__{ 439252 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationSpeedInformationDBData_BSAnimationDBData_{ 293674 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationStanceDataSingletonDBData_BSAnimationDBData_{ 1541469 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationStanceData_AnimationBoneTransform__IAnimationStanceData_{ 515567 };
+		inline constexpr REL::ID BSTDerivedCreator_AnimationStanceData_NiPoint3__IAnimationStanceData_{ 543336 };
+		inline constexpr REL::ID BSTDerivedCreator_AnticipateAttackHandler_IHandlerFunctor_Actor_BSFixedString__{ 622595 };
+		inline constexpr REL::ID BSTDerivedCreator_ArrowAttachHandler_IHandlerFunctor_Actor_BSFixedString__{ 173497 };
+		inline constexpr REL::ID BSTDerivedCreator_ArrowDetachHandler_IHandlerFunctor_Actor_BSFixedString__{ 411568 };
+		inline constexpr REL::ID BSTDerivedCreator_AttachReferenceHandler_IHandlerFunctor_Actor_BSFixedString__{ 735157 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStateChangeHandler0_IHandlerFunctor_Actor_BSFixedString__{ 514541 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStateChangeHandler1_IHandlerFunctor_Actor_BSFixedString__{ 1191804 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStateChangeHandler2_IHandlerFunctor_Actor_BSFixedString__{ 286633 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStateChangeHandler3_IHandlerFunctor_Actor_BSFixedString__{ 963937 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStateChangeHandler4_IHandlerFunctor_Actor_BSFixedString__{ 58907 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 1419324 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 302772 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackWinEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 64339 };
+		inline constexpr REL::ID BSTDerivedCreator_AttackWinStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 1407918 };
+		inline constexpr REL::ID BSTDerivedCreator_AwakeSoundFadeHandler_IHandlerFunctor_Actor_BSFixedString__{ 317543 };
+		inline constexpr REL::ID BSTDerivedCreator_AwakeSoundPauseHandler_IHandlerFunctor_Actor_BSFixedString__{ 794744 };
+		inline constexpr REL::ID BSTDerivedCreator_AwakeSoundResumeHandler_IHandlerFunctor_Actor_BSFixedString__{ 1472002 };
+		inline constexpr REL::ID BSTDerivedCreator_AwakeSoundStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 556200 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSAIWorldLocationInteriorCell_IAIWorldLocation_{ 545151 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSAIWorldLocationPointRadius_IAIWorldLocation_{ 1529580 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSAIWorldLocationPrimitive_IAIWorldLocation_{ 1142579 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSAIWorldLocationRefRadius_IAIWorldLocation_{ 931628 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSAutoWeaponSoundDef_BGSSoundDescriptor_{ 1191402 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSCompoundSoundDef_BGSSoundDescriptor_{ 5999 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSConveyorBelt__ConveyorBelt_InitActionI_{ 604946 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSMotorAction__FanMotor_InitActionI_{ 484052 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSMusicPaletteTrack_BSIMusicTrack_{ 1346397 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSMusicSilenceTrack_BSIMusicTrack_{ 268951 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSMusicSingleTrack_BSIMusicTrack_{ 946026 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataBool_IPackageData_{ 1006344 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataFloat_IPackageData_{ 1220774 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataInt_IPackageData_{ 1113492 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataLocationWrapper_IPackageData_{ 1338038 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataLocation_IPackageData_{ 52423 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataObjectList_IPackageData_{ 1576906 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataRefOLD_IPackageData_{ 888783 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataRef_IPackageData_{ 844496 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataTargetSelector_IPackageData_{ 557210 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSPackageDataTopic_IPackageData_{ 471242 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureAcquireExecState_IProcedureTreeExecState_{ 1202492 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureAcquire_IProcedure_{ 210492 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureActivateExecState_IProcedureTreeExecState_{ 1095336 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureActivate_IProcedure_{ 514582 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureDialogueActivateExecState_IProcedureTreeExecState_{ 1426832 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureDialogueActivate_IProcedure_{ 1216563 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureDialogueExecState_IProcedureTreeExecState_{ 1319911 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureDialogue_IProcedure_{ 34290 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureDoneExecState_IProcedureTreeExecState_{ 774558 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureDone_IProcedure_{ 78942 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureEatExecState_IProcedureTreeExecState_{ 228660 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureEat_IProcedure_{ 657076 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureEscortExecState_IProcedureTreeExecState_{ 826341 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureEscort_IProcedure_{ 774767 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFindExecState_IProcedureTreeExecState_{ 280509 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFind_IProcedure_{ 733644 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFleeExecState_IProcedureTreeExecState_{ 1316911 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFlee_IProcedure_{ 771690 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFlightGrabExecState_IProcedureTreeExecState_{ 66570 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFlightGrab_IProcedure_{ 730585 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFollowExecState_IProcedureTreeExecState_{ 1103030 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFollowTo_IProcedure_{ 540898 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureFollow_IProcedure_{ 741261 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureForceGreet_IProcedure_{ 1297344 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureGuardArea_IProcedure_{ 164763 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureGuardExecState_IProcedureTreeExecState_{ 557436 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureGuard_IProcedure_{ 271769 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureHeadtrackExecState_IProcedureTreeExecState_{ 889018 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureHeadtrack_IProcedure_{ 250105 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureHoldPositionExecState_IProcedureTreeExecState_{ 1221011 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureHoldPosition_IProcedure_{ 921309 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureHoverExecState_IProcedureTreeExecState_{ 675327 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureHover_IProcedure_{ 1998 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureKeepAnEyeOnExecState_IProcedureTreeExecState_{ 1006583 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureKeepAnEyeOn_IProcedure_{ 759592 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureLockUnlockExecState_IProcedureTreeExecState_{ 1338266 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureLock_IProcedure_{ 797836 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureOrbitExecState_IProcedureTreeExecState_{ 792945 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureOrbit_IProcedure_{ 1527015 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedurePatrolExecState_IProcedureTreeExecState_{ 246999 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedurePatrol_IProcedure_{ 1126190 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedurePlayIdleExecState_IProcedureTreeExecState_{ 139904 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedurePlayIdle_IProcedure_{ 1245427 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedurePursue_IProcedure_{ 739856 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureRangeExecState_IProcedureTreeExecState_{ 1516144 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureRange_IProcedure_{ 1028063 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSandboxExecState_IProcedureTreeExecState_{ 1176485 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSandbox_IProcedure_{ 764272 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSayExecState_IProcedureTreeExecState_{ 630962 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSay_IProcedure_{ 377254 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSitSleepExecState_IProcedureTreeExecState_{ 85004 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSit_IProcedure_{ 242748 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureSleep_IProcedure_{ 135714 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureStayAwayExecState_IProcedureTreeExecState_{ 1560395 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureStayAway_IProcedure_{ 1066350 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTravelExecState_IProcedureTreeExecState_{ 1014301 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTravel_IProcedure_{ 439725 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeProcedure_IProcedureTreeItem_{ 330886 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeRandomExecState_IProcedureTreeExecState_{ 165985 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeRandom_IProcedureTreeItem_{ 859801 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeSequenceExecState_IProcedureTreeExecState_{ 753122 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeSequence_IProcedureTreeItem_{ 1274204 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeSimultaneousExecState_IProcedureTreeExecState_{ 1416139 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeSimultaneous_IProcedureTreeItem_{ 89397 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeStackedExecState_IProcedureTreeExecState_{ 1084545 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureTreeStacked_IProcedureTreeItem_{ 462023 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUnlock_IProcedure_{ 690902 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUseIdleMarkerExecState_IProcedureTreeExecState_{ 1345970 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUseIdleMarker_IProcedure_{ 916889 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUseMagicExecState_IProcedureTreeExecState_{ 1239308 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUseMagic_IProcedure_{ 941396 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUseWeaponExecState_IProcedureTreeExecState_{ 1571195 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureUseWeapon_IProcedure_{ 1124805 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureWaitExecState_IProcedureTreeExecState_{ 1024988 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureWait_IProcedure_{ 126664 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureWanderExecState_IProcedureTreeExecState_{ 479306 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSProcedureWander_IProcedure_{ 258146 };
+		inline constexpr REL::ID BSTDerivedCreator_BGSStandardSoundDef_BGSSoundDescriptor_{ 1008611 };
+		inline constexpr REL::ID BSTDerivedCreator_BGShkMatFadeController_BShkNonTransformController_{ 918453 };
+		inline constexpr REL::ID BSTDerivedCreator_BGShkPhonemeController_BShkNonTransformController_{ 1505083 };
+		inline constexpr REL::ID BSTDerivedCreator_BSAudioEffects__BSDelayEffectParams_BSIAudioEffectParameters_{ 1357346 };
+		inline constexpr REL::ID BSTDerivedCreator_BSAudioEffects__BSOverdriveParams_BSIAudioEffectParameters_{ 614765 };
+		inline constexpr REL::ID BSTDerivedCreator_BSAudioEffects__BSStateVariableFilterParams_BSIAudioEffectParameters_{ 1291839 };
+		inline constexpr REL::ID BSTDerivedCreator_BSPathingRequest_BSPathingRequest_{ 721322 };
+		inline constexpr REL::ID BSTDerivedCreator_BSPathingSolution_BSPathingSolution_{ 1307828 };
+		inline constexpr REL::ID BSTDerivedCreator_BSXAudio2Audio_BSAudio_{ 24131 };
+		inline constexpr REL::ID BSTDerivedCreator_BShkVisibilityController_BShkNonTransformController_{ 963600 };
+		inline constexpr REL::ID BSTDerivedCreator_BShkbHkxDB__ProjectDBData_BSAnimationDBData_{ 729714 };
+		inline constexpr REL::ID BSTDerivedCreator_BShkbHkxDB__hkxDBData_BSAnimationDBData_{ 1368121 };
+		inline constexpr REL::ID BSTDerivedCreator_BedEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ 1337738 };
+		inline constexpr REL::ID BSTDerivedCreator_BedFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString__{ 671729 };
+		inline constexpr REL::ID BSTDerivedCreator_BowDrawnHandler_IHandlerFunctor_Actor_BSFixedString__{ 1278567 };
+		inline constexpr REL::ID BSTDerivedCreator_BowReleaseHandler_IHandlerFunctor_Actor_BSFixedString__{ 1517247 };
+		inline constexpr REL::ID BSTDerivedCreator_BowZoomStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 650423 };
+		inline constexpr REL::ID BSTDerivedCreator_BowZoomStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 888731 };
+		inline constexpr REL::ID BSTDerivedCreator_CameraOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 1050521 };
+		inline constexpr REL::ID BSTDerivedCreator_CameraOverrideStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 145504 };
+		inline constexpr REL::ID BSTDerivedCreator_CameraShakeHandler_IHandlerFunctor_Actor_BSFixedString__{ 986408 };
+		inline constexpr REL::ID BSTDerivedCreator_ChairEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ 1538364 };
+		inline constexpr REL::ID BSTDerivedCreator_ChairFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString__{ 1576634 };
+		inline constexpr REL::ID BSTDerivedCreator_CollectionAnimationSpeedContour_AnimationSpeedContour_{ 896349 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAcquireSearchDebugData_CombatObjectBase_{ 17675 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAimController_CombatObjectBase_{ 160566 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAnimatedPath_CombatObjectBase_{ 1361973 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatApproachTargetPathController_CombatObjectBase_{ 1546724 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAreaHoldPosition_CombatObjectBase_{ 1294693 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAreaReference_CombatObjectBase_{ 285705 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAreaShape_CombatObjectBase_{ 220127 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatAreaStandard_CombatObjectBase_{ 790528 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatChangePositionPathController_CombatObjectBase_{ 362230 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatChargingSearchData_CombatObjectBase_{ 1180607 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatCluster_CombatObjectBase_{ 434017 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatCoverLocation_CombatObjectBase_{ 148294 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatCoverSearchDebugData_CombatObjectBase_{ 1091463 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatCoverSearchResult_CombatObjectBase_{ 1226209 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatCoverSearch_CombatObjectBase_{ 721948 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatCoveredPathDebugData_CombatObjectBase_{ 116970 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatDisableActionController_CombatObjectBase_{ 1043525 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatDisableAimController_CombatObjectBase_{ 1207821 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatEnterCoverPathController_CombatObjectBase_{ 891293 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatFindCoverPathSpeedController_CombatObjectBase_{ 201897 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatFlankingSearchData_CombatObjectBase_{ 1551966 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatFollowTargetPathController_CombatObjectBase_{ 641848 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemGrenade_CombatObjectBase_{ 124045 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__CombatObjectBase_{ 459152 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__CombatObjectBase_{ 824806 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__CombatObjectBase_{ 312526 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__CombatObjectBase_{ 797284 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__CombatObjectBase_{ 1162402 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__CombatObjectBase_{ 1382455 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__CombatObjectBase_{ 431413 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__CombatObjectBase_{ 1579546 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__CombatObjectBase_{ 1557420 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__CombatObjectBase_{ 340262 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__CombatObjectBase_{ 676382 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__CombatObjectBase_{ 1191955 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__CombatObjectBase_{ 1527835 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__CombatObjectBase_{ 310724 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__CombatObjectBase_{ 1410154 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__CombatObjectBase_{ 775603 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__CombatObjectBase_{ 1268230 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__CombatObjectBase_{ 51157 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__CombatObjectBase_{ 1121197 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__CombatObjectBase_{ 23051 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__CombatObjectBase_{ 388734 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__CombatObjectBase_{ 609216 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__CombatObjectBase_{ 1240618 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__CombatObjectBase_{ 806116 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__CombatObjectBase_{ 783953 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__CombatObjectBase_{ 1148932 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__CombatObjectBase_{ 1485158 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__CombatObjectBase_{ 418248 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__CombatObjectBase_{ 754429 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__CombatObjectBase_{ 1119378 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__CombatObjectBase_{ 637042 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__CombatObjectBase_{ 267925 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__CombatObjectBase_{ 881308 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__CombatObjectBase_{ 1246912 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__CombatObjectBase_{ 734889 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__CombatObjectBase_{ 1219280 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__CombatObjectBase_{ 1452 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__CombatObjectBase_{ 222505 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__CombatObjectBase_{ 853636 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__CombatObjectBase_{ 418979 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__CombatObjectBase_{ 396876 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__CombatObjectBase_{ 762495 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__CombatObjectBase_{ 1098100 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__CombatObjectBase_{ 31241 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__CombatObjectBase_{ 367287 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__CombatObjectBase_{ 733071 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__CombatObjectBase_{ 250152 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__CombatObjectBase_{ 1463475 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__CombatObjectBase_{ 72746 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__CombatObjectBase_{ 437750 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__CombatObjectBase_{ 1508362 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__CombatObjectBase_{ 410084 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__CombatObjectBase_{ 775835 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__CombatObjectBase_{ 995655 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__CombatObjectBase_{ 44792 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__CombatObjectBase_{ 1192720 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__CombatObjectBase_{ 1170468 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__CombatObjectBase_{ 1535964 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__CombatObjectBase_{ 289093 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__CombatObjectBase_{ 805396 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__CombatObjectBase_{ 1140896 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__CombatObjectBase_{ 1506559 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__CombatObjectBase_{ 1023460 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__CombatObjectBase_{ 1093355 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemMelee_CombatObjectBase_{ 258524 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemOneHandedBlock_CombatObjectBase_{ 1371228 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemRanged_CombatObjectBase_{ 763232 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemShield_CombatObjectBase_{ 1132919 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemThrown_CombatObjectBase_{ 628734 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatInventoryItemTorch_CombatObjectBase_{ 732852 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterArmor_CombatObjectBase_{ 1018835 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterBoundItem_CombatObjectBase_{ 1384075 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterChameleon_CombatObjectBase_{ 871943 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterCloak_CombatObjectBase_{ 1356277 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterDisarm_CombatObjectBase_{ 139542 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterInvisibility_CombatObjectBase_{ 359791 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterLight_CombatObjectBase_{ 990935 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterOffensive_CombatObjectBase_{ 556882 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterParalyze_CombatObjectBase_{ 534675 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterReanimate_CombatObjectBase_{ 899846 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterRestore_CombatObjectBase_{ 1235697 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterScript_CombatObjectBase_{ 169403 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterStagger_CombatObjectBase_{ 504934 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterSummon_CombatObjectBase_{ 870044 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterTargetEffect_CombatObjectBase_{ 387597 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMagicCasterWard_CombatObjectBase_{ 191703 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMantlePathController_CombatObjectBase_{ 252307 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMatchTargetAimController_CombatObjectBase_{ 1007239 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMeleeAimController_CombatObjectBase_{ 464288 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMeleeDebugData_CombatObjectBase_{ 1043304 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatMovementRequestFollowActor_CombatObjectBase_{ 1289449 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathMovementMessageEvent_CombatPathTeleportEvent__MovementMessage_{ 1025174 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ 937849 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ 165949 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ 1555655 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ 1072612 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 296299 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ 842835 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ 992294 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 538427 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 180638 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 741713 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ 1058964 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 983692 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 538655 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ 1573503 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 656640 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ 239700 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1533276 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 953566 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1420776 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1172259 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 120347 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ 339845 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ 466993 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ 1271330 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 523260 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 503358 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ 54255 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ 531279 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ 795528 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ 900673 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ 96532 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ 457392 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 842875 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 384169 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__CombatObjectBase_{ 583493 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ 1324466 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ 1257382 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ 359869 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ 582097 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 258240 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ 1243486 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ 954340 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 327166 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 142158 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 264509 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ 1286821 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 68250 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1205159 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ 391478 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1056793 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ 1344763 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1322006 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 915252 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1210280 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1133941 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 82194 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ 301542 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ 853963 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ 780775 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 1176014 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 451109 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ 1743 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ 1183934 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ 743533 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ 409723 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ 483326 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ 1110439 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 1056725 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 1036882 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ 1387190 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ 1493091 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ 1566493 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ 817456 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 452156 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ 387220 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ 710274 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 162314 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1480260 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 897434 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ 948971 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 434825 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1572151 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ 1117659 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 201028 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ 395570 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1157155 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 232054 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1044930 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1328048 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 980896 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ 495759 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ 477864 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ 1015940 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 1320 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 1391380 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ 942505 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ 9300 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ 101247 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ 645575 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ 546311 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ 1518878 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 1199220 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 301572 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ 285073 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ 390427 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ 902730 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ 1297308 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 507411 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ 176504 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ 1203714 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 921842 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 391314 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 952437 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ 565448 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 51290 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 1188219 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ 906813 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1572381 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ 450374 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 334637 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1164574 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ 222666 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 1383025 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ 331378 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ 551175 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ 1396518 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ 1496365 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 43031 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 289171 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ 1422356 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ 51022 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ 581420 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ 1125304 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ 1025904 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ 1560123 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ 362665 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ 1486797 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingDebugData_CombatObjectBase_{ 665408 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestAdapter_BSPathingRequest_{ 1013549 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestCovered_BSPathingRequest_{ 811235 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 1377007 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSPathingRequest_{ 1485213 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSPathingRequest_{ 490950 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 129980 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 1261328 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 505974 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 1089524 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 309686 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 1446484 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSPathingRequest_{ 1244739 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 1471408 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 442735 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 686514 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 890856 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 1012661 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 232129 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSPathingRequest_{ 496318 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSPathingRequest_{ 1420469 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestMultiGoal_BSPathingRequest_{ 547724 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingRequestStandard_BSPathingRequest_{ 1480357 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingSearchArea_CombatObjectBase_{ 160847 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPathingTweener_CombatObjectBase_{ 1966 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatPositionTracker_CombatObjectBase_{ 1136644 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatProjectileAimController_CombatObjectBase_{ 264421 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatProjectileDebugData_CombatObjectBase_{ 1512089 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatSearchLockData_BSPathingLockData_{ 366491 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatSuppressiveFireBehavior_CombatObjectBase_{ 297300 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetLocationSearchResult_CombatObjectBase_{ 785599 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetLocationSearch_CombatObjectBase_{ 547136 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetLocation_CombatObjectBase_{ 1185955 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetSelectorFixed_CombatObjectBase_{ 849669 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetSelectorPreferred_CombatObjectBase_{ 345094 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetSelectorRandom_CombatObjectBase_{ 210819 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTargetSelectorStandard_CombatObjectBase_{ 545705 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatThreatExplosion_CombatObjectBase_{ 1579040 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatThreatLOF_CombatObjectBase_{ 567030 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatThreatMelee_CombatObjectBase_{ 632850 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatThreatProjectile_CombatObjectBase_{ 501090 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTrackTargetAimController_CombatObjectBase_{ 1542465 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatTunnelPathController_CombatObjectBase_{ 960926 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatViewControllerGlance_CombatObjectBase_{ 1251621 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatViewControllerPath_CombatObjectBase_{ 173933 };
+		inline constexpr REL::ID BSTDerivedCreator_CombatViewControllerStandard_CombatObjectBase_{ 308148 };
+		inline constexpr REL::ID BSTDerivedCreator_CullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString__{ 502375 };
+		inline constexpr REL::ID BSTDerivedCreator_CullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString__{ 274671 };
+		inline constexpr REL::ID BSTDerivedCreator_DeathEmoteHandler_IHandlerFunctor_Actor_BSFixedString__{ 1225324 };
+		inline constexpr REL::ID BSTDerivedCreator_DeathStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 260415 };
+		inline constexpr REL::ID BSTDerivedCreator_DesyncInteractionHandler_IHandlerFunctor_Actor_BSFixedString__{ 875520 };
+		inline constexpr REL::ID BSTDerivedCreator_DisableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString__{ 1095290 };
+		inline constexpr REL::ID BSTDerivedCreator_DisableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString__{ 888966 };
+		inline constexpr REL::ID BSTDerivedCreator_DisableCollisionHandler_IHandlerFunctor_Actor_BSFixedString__{ 867283 };
+		inline constexpr REL::ID BSTDerivedCreator_DiveBombPathController_CombatObjectBase_{ 84804 };
+		inline constexpr REL::ID BSTDerivedCreator_DoNotInterruptAnimationHandler_IHandlerFunctor_Actor_BSFixedString__{ 1103395 };
+		inline constexpr REL::ID BSTDerivedCreator_EjectShellCasingHandler_IHandlerFunctor_Actor_BSFixedString__{ 377191 };
+		inline constexpr REL::ID BSTDerivedCreator_EnableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString__{ 1561796 };
+		inline constexpr REL::ID BSTDerivedCreator_EnableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString__{ 211845 };
+		inline constexpr REL::ID BSTDerivedCreator_EnableCollisionHandler_IHandlerFunctor_Actor_BSFixedString__{ 190548 };
+		inline constexpr REL::ID BSTDerivedCreator_EndSummonAnimationHandler_IHandlerFunctor_Actor_BSFixedString__{ 1365399 };
+		inline constexpr REL::ID BSTDerivedCreator_FaceEmotionalIdleHandler_IHandlerFunctor_Actor_BSFixedString__{ 745788 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightActionEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 1257123 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightActionEntryEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 579959 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightActionGrabHandler_IHandlerFunctor_Actor_BSFixedString__{ 351926 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightActionHandler_IHandlerFunctor_Actor_BSFixedString__{ 341274 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightActionReleaseHandler_IHandlerFunctor_Actor_BSFixedString__{ 1029189 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightCrashLandStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 124334 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightCruisingHandler_IHandlerFunctor_Actor_BSFixedString__{ 492487 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightHoveringHandler_IHandlerFunctor_Actor_BSFixedString__{ 731506 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightLandEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 102886 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightLandHandler_IHandlerFunctor_Actor_BSFixedString__{ 1446620 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightLandingHandler_IHandlerFunctor_Actor_BSFixedString__{ 969505 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightPerchingHandler_IHandlerFunctor_Actor_BSFixedString__{ 1208330 };
+		inline constexpr REL::ID BSTDerivedCreator_FlightTakeOffHandler_IHandlerFunctor_Actor_BSFixedString__{ 254248 };
+		inline constexpr REL::ID BSTDerivedCreator_GetUpEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 1550937 };
+		inline constexpr REL::ID BSTDerivedCreator_GetUpStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 169026 };
+		inline constexpr REL::ID BSTDerivedCreator_GunDownStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 1185790 };
+		inline constexpr REL::ID BSTDerivedCreator_HeadTrackingOffHandler_IHandlerFunctor_Actor_BSFixedString__{ 1039919 };
+		inline constexpr REL::ID BSTDerivedCreator_HeadTrackingOnHandler_IHandlerFunctor_Actor_BSFixedString__{ 801713 };
+		inline constexpr REL::ID BSTDerivedCreator_HeadTrackingRotationOffHandler_IHandlerFunctor_Actor_BSFixedString__{ 724478 };
+		inline constexpr REL::ID BSTDerivedCreator_HeadTrackingRotationOnHandler_IHandlerFunctor_Actor_BSFixedString__{ 1190407 };
+		inline constexpr REL::ID BSTDerivedCreator_HitFrameHandler_IHandlerFunctor_Actor_BSFixedString__{ 383931 };
+		inline constexpr REL::ID BSTDerivedCreator_HolotapeLoadedHandler_IHandlerFunctor_Actor_BSFixedString__{ 507062 };
+		inline constexpr REL::ID BSTDerivedCreator_IdleDialogueEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ 222570 };
+		inline constexpr REL::ID BSTDerivedCreator_IdleDialogueExitHandler_IHandlerFunctor_Actor_BSFixedString__{ 899698 };
+		inline constexpr REL::ID BSTDerivedCreator_IdleFlavorHandler_IHandlerFunctor_Actor_BSFixedString__{ 1401207 };
+		inline constexpr REL::ID BSTDerivedCreator_IndividualClipAnimationSpeedContour_AnimationSpeedContour_{ 1296726 };
+		inline constexpr REL::ID BSTDerivedCreator_InterruptCastHandler_IHandlerFunctor_Actor_BSFixedString__{ 1127079 };
+		inline constexpr REL::ID BSTDerivedCreator_JumpAnimEventHandler_IHandlerFunctor_Actor_BSFixedString__{ 1566481 };
+		inline constexpr REL::ID BSTDerivedCreator_KillActorHandler_IHandlerFunctor_Actor_BSFixedString__{ 15196 };
+		inline constexpr REL::ID BSTDerivedCreator_KillMoveEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 509666 };
+		inline constexpr REL::ID BSTDerivedCreator_KillMoveStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 271292 };
+		inline constexpr REL::ID BSTDerivedCreator_KnockdownHandler_IHandlerFunctor_Actor_BSFixedString__{ 854193 };
+		inline constexpr REL::ID BSTDerivedCreator_KnockdownTargetHandler_IHandlerFunctor_Actor_BSFixedString__{ 1092663 };
+		inline constexpr REL::ID BSTDerivedCreator_LeftHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString__{ 790827 };
+		inline constexpr REL::ID BSTDerivedCreator_LeftHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString__{ 780101 };
+		inline constexpr REL::ID BSTDerivedCreator_LoopingActivateHandler_IHandlerFunctor_Actor_BSFixedString__{ 491553 };
+		inline constexpr REL::ID BSTDerivedCreator_MotionDrivenHandler_IHandlerFunctor_Actor_BSFixedString__{ 1463776 };
+		inline constexpr REL::ID BSTDerivedCreator_MountDismountEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 884232 };
+		inline constexpr REL::ID BSTDerivedCreator_MountInteraction_RefrInteraction_{ 157357 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementAgentActorAvoider_MovementAgent_{ 491802 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementAgentActorState_MovementAgent_{ 387712 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementAgentPathFollowerFlight_MovementAgent_{ 481187 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementAgentPathFollowerStandard_MovementAgent_{ 850940 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementAgentPathFollowerVirtual_MovementAgent_{ 1065141 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentAngleGain_MovementAgent_{ 371113 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentAnglePassThrough_MovementAgent_{ 129654 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentAnimationDriven_MovementAgent_{ 964973 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentDirectControl_MovementAgent_{ 188241 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentDirectionPassThrough_MovementAgent_{ 447402 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentGraphDrivenAnimationDriven_MovementAgent_{ 312200 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentPlayerControlsActionTrigger_MovementAgent_{ 1383239 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentPlayerControls_MovementAgent_{ 84529 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentSpeedPassThrough_MovementAgent_{ 250491 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentSprintActionTrigger_MovementAgent_{ 25498 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentStairsHelper_MovementAgent_{ 1487726 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentStandard_MovementAgent_{ 691141 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentStorePlannerOutput_MovementAgent_{ 904825 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerAgentStrafing_MovementAgent_{ 858877 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementHandlerArbiter_MovementArbiter_{ 1170359 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageActivateDoor_MovementMessage_{ 427451 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageActorCollision_MovementMessage_{ 1100763 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageBlocked_MovementMessage_{ 1568340 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageFreezeDirection_MovementMessage_{ 1233159 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageJump_MovementMessage_{ 1472049 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageNewPath_MovementMessage_{ 37821 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessagePathComplete_MovementMessage_{ 9970 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessagePathFailed_MovementMessage_{ 1565546 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessagePlayIdle_MovementMessage_{ 303734 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageSetStaticPath_MovementMessage_{ 9754 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageWarpToLocation_MovementMessage_{ 572999 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementMessageWarpToMultiple_MovementMessage_{ 718494 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementParametersFixed_IMovementParameters_{ 152951 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementParameters_IMovementParameters_{ 445982 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPathManagerAgentAvoidBox_MovementAgent_{ 85443 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPathManagerAgentLoadedAreaMonitor_MovementAgent_{ 83829 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPathManagerAgentStaticAvoider_MovementAgent_{ 167908 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPathManagerArbiter_MovementArbiter_{ 508499 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPlannerAgentDirectControl_MovementAgent_{ 886638 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPlannerAgentNavmeshBounds_MovementAgent_{ 1176916 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPlannerAgentWarp_MovementAgent_{ 1550248 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPlannerArbiter_MovementArbiter_{ 764262 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementPostUpdateArbiter_MovementArbiter_{ 646507 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementStateFollowPath_MovementAgent_{ 16113 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementStateTweener_MovementAgent_{ 749123 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementTweenerAgentFixedDelta_MovementAgent_{ 338724 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementTweenerAgentNodeFollower_MovementAgent_{ 19445 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementTweenerAgentTargetPosAndVel_MovementAgent_{ 1025415 };
+		inline constexpr REL::ID BSTDerivedCreator_MovementTweenerArbiter_MovementArbiter_{ 1191849 };
+		inline constexpr REL::ID BSTDerivedCreator_NPCAttachHandler_IHandlerFunctor_Actor_BSFixedString__{ 443867 };
+		inline constexpr REL::ID BSTDerivedCreator_NPCDetachHandler_IHandlerFunctor_Actor_BSFixedString__{ 243888 };
+		inline constexpr REL::ID BSTDerivedCreator_PairedAttackDialogueHandler_IHandlerFunctor_Actor_BSFixedString__{ 566878 };
+		inline constexpr REL::ID BSTDerivedCreator_PairedStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 748426 };
+		inline constexpr REL::ID BSTDerivedCreator_PassengerInteraction_RefrInteraction_{ 1552802 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingCell_BSPathingCell_{ 1534908 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingDoor_BSPathingDoor_{ 1507543 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingLockData_BSPathingLockData_{ 775205 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestClosePoint_BSPathingRequest_{ 1435251 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestClosestGoal_BSPathingRequest_{ 875796 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestCover_BSPathingRequest_{ 1366362 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFlee_BSPathingRequest_{ 1338926 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFlyAction_BSPathingRequest_{ 140602 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFlyHover_BSPathingRequest_{ 990322 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFlyLand_BSPathingRequest_{ 1401698 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFlyOrbit_BSPathingRequest_{ 669843 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFlyTakeOff_BSPathingRequest_{ 1519851 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestFly_BSPathingRequest_{ 872772 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestHide_BSPathingRequest_{ 1492399 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestLOS_BSPathingRequest_{ 1025645 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestOptimalLocation_BSPathingRequest_{ 293338 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestRotate_BSPathingRequest_{ 266119 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestSafeStraightLine_BSPathingRequest_{ 1381836 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequestStopMoving_BSPathingRequest_{ 649965 };
+		inline constexpr REL::ID BSTDerivedCreator_PathingRequest_BSPathingRequest_{ 215624 };
+		inline constexpr REL::ID BSTDerivedCreator_PerformActivationHandler_IHandlerFunctor_Actor_BSFixedString__{ 57523 };
+		inline constexpr REL::ID BSTDerivedCreator_PickNewIdleHandler_IHandlerFunctor_Actor_BSFixedString__{ 460342 };
+		inline constexpr REL::ID BSTDerivedCreator_PipboyBootSequenceHandler_IHandlerFunctor_Actor_BSFixedString__{ 1411836 };
+		inline constexpr REL::ID BSTDerivedCreator_PitchOverrideEndHandler_IHandlerFunctor_Actor_BSFixedString__{ 1159668 };
+		inline constexpr REL::ID BSTDerivedCreator_PitchOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 482300 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerBedEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ 1120822 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerChairEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ 1348501 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerFastEquipSoundHandler_IHandlerFunctor_Actor_BSFixedString__{ 198598 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString__{ 1359162 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerSightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 742562 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerSneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 1396503 };
+		inline constexpr REL::ID BSTDerivedCreator_PlayerTerminalEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ 443434 };
+		inline constexpr REL::ID BSTDerivedCreator_QuestPathingRequest_BSPathingRequest_{ 734552 };
+		inline constexpr REL::ID BSTDerivedCreator_RagdollAndGetUpHandler_IHandlerFunctor_Actor_BSFixedString__{ 207200 };
+		inline constexpr REL::ID BSTDerivedCreator_RagdollStartHandler_IHandlerFunctor_Actor_BSFixedString__{ 1512847 };
+		inline constexpr REL::ID BSTDerivedCreator_ReadyStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 508447 };
+		inline constexpr REL::ID BSTDerivedCreator_RecoilStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 541589 };
+		inline constexpr REL::ID BSTDerivedCreator_ReevaluateGraphStateHandler_IHandlerFunctor_Actor_BSFixedString__{ 1168957 };
+		inline constexpr REL::ID BSTDerivedCreator_RelaxedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 736586 };
+		inline constexpr REL::ID BSTDerivedCreator_ReloadCompleteHandler_IHandlerFunctor_Actor_BSFixedString__{ 969952 };
+		inline constexpr REL::ID BSTDerivedCreator_ReloadStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 292610 };
+		inline constexpr REL::ID BSTDerivedCreator_RemoveRagdollHandler_IHandlerFunctor_Actor_BSFixedString__{ 1274152 };
+		inline constexpr REL::ID BSTDerivedCreator_RightHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString__{ 1467982 };
+		inline constexpr REL::ID BSTDerivedCreator_RightHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString__{ 1457194 };
+		inline constexpr REL::ID BSTDerivedCreator_SandManKillHandler_IHandlerFunctor_Actor_BSFixedString__{ 1054401 };
+		inline constexpr REL::ID BSTDerivedCreator_SightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 1208768 };
+		inline constexpr REL::ID BSTDerivedCreator_SneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ 280675 };
+		inline constexpr REL::ID BSTDerivedCreator_SpeedSampledAnimationSpeedContour_AnimationSpeedContour_{ 391717 };
+		inline constexpr REL::ID BSTDerivedCreator_StaggeredStopHandler_IHandlerFunctor_Actor_BSFixedString__{ 1299696 };
+		inline constexpr REL::ID BSTDerivedCreator_StartFloatingHandler_IHandlerFunctor_Actor_BSFixedString__{ 1544877 };
+		inline constexpr REL::ID BSTDerivedCreator_StartPCapVoiceHandler_IHandlerFunctor_Actor_BSFixedString__{ 138677 };
+		inline constexpr REL::ID BSTDerivedCreator_StopFloatingHandler_IHandlerFunctor_Actor_BSFixedString__{ 201177 };
+		inline constexpr REL::ID BSTDerivedCreator_StopMountCameraHandler_IHandlerFunctor_Actor_BSFixedString__{ 1176207 };
+		inline constexpr REL::ID BSTDerivedCreator_SubgraphAndOffsetDBData_BSAnimationDBData_{ 1188235 };
+		inline constexpr REL::ID BSTDerivedCreator_SyncDeferDeathHandler_IHandlerFunctor_Actor_BSFixedString__{ 187934 };
+		inline constexpr REL::ID BSTDerivedCreator_SyncEarlyExitHandler_IHandlerFunctor_Actor_BSFixedString__{ 426009 };
+		inline constexpr REL::ID BSTDerivedCreator_UncullBoneHandler_IHandlerFunctor_Actor_BSFixedString__{ 263964 };
+		inline constexpr REL::ID BSTDerivedCreator_UncullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString__{ 1179653 };
+		inline constexpr REL::ID BSTDerivedCreator_UncullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString__{ 513139 };
+		inline constexpr REL::ID BSTDerivedCreator_UpdateSightedHandler_IHandlerFunctor_Actor_BSFixedString__{ 1553050 };
+		inline constexpr REL::ID BSTDerivedCreator_UseStealthBoyHandler_IHandlerFunctor_Actor_BSFixedString__{ 79093 };
+		inline constexpr REL::ID BSTDerivedCreator_UseStimpakHandler_IHandlerFunctor_Actor_BSFixedString__{ 1422568 };
+		inline constexpr REL::ID BSTDerivedCreator_VoiceSpellCastHandler_IHandlerFunctor_Actor_BSFixedString__{ 562960 };
+		inline constexpr REL::ID BSTDerivedCreator_VoiceSpellFireHandler_IHandlerFunctor_Actor_BSFixedString__{ 552373 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponAttachHandler_IHandlerFunctor_Actor_BSFixedString__{ 1244153 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponBeginDrawHandler_IHandlerFunctor_Actor_BSFixedString__{ 801469 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponBeginSheatheHandler_IHandlerFunctor_Actor_BSFixedString__{ 1478884 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponDetachHandler_IHandlerFunctor_Actor_BSFixedString__{ 1482806 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponDrawHandler_IHandlerFunctor_Actor_BSFixedString__{ 573677 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponFireHandler_IHandlerFunctor_Actor_BSFixedString__{ 54240 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponSheatheHandler_IHandlerFunctor_Actor_BSFixedString__{ 812187 };
+		inline constexpr REL::ID BSTDerivedCreator_WeaponSwingHandler_IHandlerFunctor_Actor_BSFixedString__{ 119360 };
+		inline constexpr REL::ID BSTDerivedCreator_ZeroPitchHandler_IHandlerFunctor_Actor_BSFixedString__{ 1397892 };
+		inline constexpr REL::ID BSTDerivedCreator___MovementHandlerAgentAngleControllerLoadScrapper_MovementAgent_{ 1442645 };
+		inline constexpr REL::ID BSTDerivedCreator___MovementHandlerAgentLargeDeltaLoadScrapper_MovementAgent_{ 5037 };
+		inline constexpr REL::ID BSTDerivedCreator___MovementHandlerAgentTranslationControllerLoadScrapper_MovementAgent_{ 1028259 };
+		inline constexpr REL::ID BSTDerivedCreator___MovementPlannerAgentHorseControlsLoadScrapper_MovementAgent_{ 38975 };
+		inline constexpr REL::ID BSTDerivedCreator___MovementPlannerAgentKeepOffsetLoadScrapper_MovementAgent_{ 184650 };
+		inline constexpr REL::ID BSTEventSink_ActorCPMEvent_{ 536986 };
+		inline constexpr REL::ID BSTEventSink_ActorEquipManagerEvent__Event_{ 883842 };
+		inline constexpr REL::ID BSTEventSink_ActorInventoryEvent_{ 693547 };
+		inline constexpr REL::ID BSTEventSink_ActorItemEquipped__Event_{ 1070321 };
+		inline constexpr REL::ID BSTEventSink_ActorKill__Event_{ 415083 };
+		inline constexpr REL::ID BSTEventSink_ActorValueEvents__ActorValueChangedEvent_{ 458621 };
+		inline constexpr REL::ID BSTEventSink_AnimationDataCleanupEvent_{ 745683 };
+		inline constexpr REL::ID BSTEventSink_AnimationDataSetupEvent_{ 572840 };
+		inline constexpr REL::ID BSTEventSink_ApplyColorUpdateEvent_{ 1266193 };
+		inline constexpr REL::ID BSTEventSink_AssaultCrime__Event_{ 368584 };
+		inline constexpr REL::ID BSTEventSink_AttachReference__Event_{ 947944 };
+		inline constexpr REL::ID BSTEventSink_AutoLoadDoorRolloverEvent_{ 959696 };
+		inline constexpr REL::ID BSTEventSink_BGSActorCellEvent_{ 1341576 };
+		inline constexpr REL::ID BSTEventSink_BGSActorDeathEvent_{ 1379985 };
+		inline constexpr REL::ID BSTEventSink_BGSAppPausedEvent_{ 781454 };
+		inline constexpr REL::ID BSTEventSink_BGSCollisionSoundEvent_{ 295033 };
+		inline constexpr REL::ID BSTEventSink_BGSCombatImpactEvent_{ 122494 };
+		inline constexpr REL::ID BSTEventSink_BGSEventProcessedEvent_{ 1457444 };
+		inline constexpr REL::ID BSTEventSink_BGSFootstepEvent_{ 97971 };
+		inline constexpr REL::ID BSTEventSink_BGSHotloadCompletedEvent_{ 801793 };
+		inline constexpr REL::ID BSTEventSink_BGSInventoryItemEvent__Event_{ 1429456 };
+		inline constexpr REL::ID BSTEventSink_BGSInventoryListEvent__Event_{ 1034355 };
+		inline constexpr REL::ID BSTEventSink_BGSLocationLoadedEvent_{ 192149 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerCompanionDismiss_{ 1047157 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerCreateRobotEvent_{ 1299345 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerEnterVertibirdEvent_{ 581049 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerFallLongDistances_{ 76442 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerFireWeaponEvent_{ 940071 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerHealTeammateEvent_{ 435368 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerModArmorWeaponEvent_{ 688174 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerModRobotEvent_{ 328628 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerSwimmingEvent_{ 1551766 };
+		inline constexpr REL::ID BSTEventSink_BGSOnPlayerUseWorkBenchEvent_{ 1192444 };
+		inline constexpr REL::ID BSTEventSink_BGSOnSpeechChallengeAvailable_{ 221727 };
+		inline constexpr REL::ID BSTEventSink_BGSRadiationDamageEvent_{ 558268 };
+		inline constexpr REL::ID BSTEventSink_BGSSoundCategoryUtils__MenuCategoryVolumeChangedEvent_{ 1412884 };
+		inline constexpr REL::ID BSTEventSink_BSActiveGraphIfInactiveEvent_{ 250261 };
+		inline constexpr REL::ID BSTEventSink_BSAnimationGraphEvent_{ 642550 };
+		inline constexpr REL::ID BSTEventSink_BSAudioUtil__MasterVolumeChangedEvent_{ 167679 };
+		inline constexpr REL::ID BSTEventSink_BSCoreMessage__Event_{ 891897 };
+		inline constexpr REL::ID BSTEventSink_BSMovementDataChangedEvent_{ 1039022 };
+		inline constexpr REL::ID BSTEventSink_BSMusicEvent_{ 639247 };
+		inline constexpr REL::ID BSTEventSink_BSPathEvent_{ 878565 };
+		inline constexpr REL::ID BSTEventSink_BSProceduralGeomEvent_{ 652005 };
+		inline constexpr REL::ID BSTEventSink_BSResource__Archive2__ClearRegistryEvent_{ 386590 };
+		inline constexpr REL::ID BSTEventSink_BSResource__Archive2__RegisteredEvent_{ 1357122 };
+		inline constexpr REL::ID BSTEventSink_BSResource__Archive2__StreamOpenedEvent_{ 548900 };
+		inline constexpr REL::ID BSTEventSink_BSResource__ArchiveRegisteredEvent_{ 1228332 };
+		inline constexpr REL::ID BSTEventSink_BSResource__CacheEvent_{ 1242598 };
+		inline constexpr REL::ID BSTEventSink_BSResource__NameFoundEvent_{ 35191 };
+		inline constexpr REL::ID BSTEventSink_BSScript__StatsEvent_{ 452919 };
+		inline constexpr REL::ID BSTEventSink_BSStaticTriShapeDB__PSGRegisteredEvent_{ 997907 };
+		inline constexpr REL::ID BSTEventSink_BSSubGraphActivationUpdate_{ 68463 };
+		inline constexpr REL::ID BSTEventSink_BSTGlobalEvent__KillSDMEvent_{ 1491811 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_BlockPipboyOpeningEvent__{ 402865 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_CanDisplayNextHUDMessage__{ 1480240 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_CanDisplayNextHUDObjective__{ 601778 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_CompanionMenuEnabled__{ 1316277 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ConditionBoyEvent__{ 1320946 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_CurrentRadiationSourceCount__{ 239606 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_CurrentRadsDisplayMagnitude__{ 80625 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_CurrentRadsPercentOfLethal__{ 160224 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent__{ 769009 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ExperienceMeterDisplayEvent__{ 572432 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ExplosiveIndicatorResultEvent__{ 1367940 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_FaderMenuDisplayState__{ 1323525 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDCommmandModeEvent__{ 213877 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent__{ 7334 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDMessageDisplayDataEvent__{ 677815 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDNotificationDisplayEvent__{ 772776 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDObjectiveDisplayEvent__{ 613660 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent__{ 613883 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDQuestVaultBoySwfName__{ 693399 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDRolloverIsCrime__{ 451910 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDRolloverStateEvent__{ 292981 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDSubtitleDisplayEvent__{ 196841 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HUDTutorialTextEvent__{ 534214 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_HasHUDMessagesEvent__{ 1400226 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_IsPipboyActiveEvent__{ 1209811 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_MultiActivateUseRolloverEvent__{ 625572 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ObjectivesInWayOfXP__{ 681593 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_PlayerActivatePickRefEvent__{ 531859 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_PlayerActiveEffectIconsEvent__{ 1338646 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_PlayerAmmoCountEvent__{ 87427 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_PlayerAutoAimActorEvent__{ 1481488 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_PlayerCommandTypeEvent__{ 1401498 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_PlayerCrosshairModeEvent__{ 372650 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_QuickContainerStateEvent__{ 244021 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_RolloverSuppressedEvent__{ 323420 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_SaveLoadMessageStringEvent__{ 830396 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim__{ 1337228 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingExperienceEvent__{ 851949 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent__{ 885098 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingLongSubtitleEvent__{ 883404 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingPerkVaultBoyState__{ 208783 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingVATSCritAnim__{ 941919 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ShowingWideSubtitleEvent__{ 962872 };
+		inline constexpr REL::ID BSTEventSink_BSTValueRequestEvent_ViewCasterUpdateEvent__{ 844865 };
+		inline constexpr REL::ID BSTEventSink_BSThreadEvent__ThreadEvent_{ 474191 };
+		inline constexpr REL::ID BSTEventSink_BSTransformDeltaEvent_{ 252555 };
+		inline constexpr REL::ID BSTEventSink_BSXAudio2StreamEvent_{ 954067 };
+		inline constexpr REL::ID BSTEventSink_BeamProjectileImpactEvent_{ 1145623 };
+		inline constexpr REL::ID BSTEventSink_BinkMovieStoppedPlayingEvent_{ 699279 };
+		inline constexpr REL::ID BSTEventSink_Bleedout__Event_{ 971642 };
+		inline constexpr REL::ID BSTEventSink_BlockPipboyOpeningEvent_{ 145195 };
+		inline constexpr REL::ID BSTEventSink_BlurEvent_{ 1142736 };
+		inline constexpr REL::ID BSTEventSink_BobbleheadCollected__Event_{ 1279066 };
+		inline constexpr REL::ID BSTEventSink_BooksRead__Event_{ 1070290 };
+		inline constexpr REL::ID BSTEventSink_ButtonBarMenuUpdateEvent_{ 410967 };
+		inline constexpr REL::ID BSTEventSink_CanDisplayNextHUDMessage_{ 757222 };
+		inline constexpr REL::ID BSTEventSink_CanDisplayNextHUDObjective_{ 931494 };
+		inline constexpr REL::ID BSTEventSink_CellAttachDetachEvent_{ 87047 };
+		inline constexpr REL::ID BSTEventSink_ChargenCharacterUpdateEvent_{ 1186364 };
+		inline constexpr REL::ID BSTEventSink_ChestLooted__Event_{ 88957 };
+		inline constexpr REL::ID BSTEventSink_ClearHUDMessagesEvent_{ 396655 };
+		inline constexpr REL::ID BSTEventSink_ClearQuickContainerEvent_{ 603346 };
+		inline constexpr REL::ID BSTEventSink_ColorUpdateEvent_{ 545499 };
+		inline constexpr REL::ID BSTEventSink_CompanionMenuEnabled_{ 1165379 };
+		inline constexpr REL::ID BSTEventSink_ConditionBoyEvent_{ 956243 };
+		inline constexpr REL::ID BSTEventSink_ControlsRemappedEvent_{ 324130 };
+		inline constexpr REL::ID BSTEventSink_CorpseEaten__Event_{ 261641 };
+		inline constexpr REL::ID BSTEventSink_CriticalHitEvent__Event_{ 714617 };
+		inline constexpr REL::ID BSTEventSink_CurrentRadiationSourceCount_{ 401758 };
+		inline constexpr REL::ID BSTEventSink_CurrentRadsDisplayMagnitude_{ 111112 };
+		inline constexpr REL::ID BSTEventSink_CurrentRadsPercentOfLethal_{ 618526 };
+		inline constexpr REL::ID BSTEventSink_CustomMarkerUpdate__Event_{ 935861 };
+		inline constexpr REL::ID BSTEventSink_DaysPassed__Event_{ 1213563 };
+		inline constexpr REL::ID BSTEventSink_DefaultObjectsReadyEvent__Event_{ 750947 };
+		inline constexpr REL::ID BSTEventSink_DirectionalHitIndicatorResultEvent_{ 1252091 };
+		inline constexpr REL::ID BSTEventSink_DisarmedEvent__Event_{ 886904 };
+		inline constexpr REL::ID BSTEventSink_DisplayFatigueWarningEvent_{ 1524379 };
+		inline constexpr REL::ID BSTEventSink_DoBeforeNewOrLoadCompletedEvent_{ 1548985 };
+		inline constexpr REL::ID BSTEventSink_EndLoadGameEvent_{ 601381 };
+		inline constexpr REL::ID BSTEventSink_ExitPowerArmor__Event_{ 70305 };
+		inline constexpr REL::ID BSTEventSink_ExperienceMeterDisplayEvent_{ 600909 };
+		inline constexpr REL::ID BSTEventSink_ExplosiveIndicatorResultEvent_{ 294749 };
+		inline constexpr REL::ID BSTEventSink_FaderMenuDisplayState_{ 690800 };
+		inline constexpr REL::ID BSTEventSink_FatmanDeaths__Event_{ 434115 };
+		inline constexpr REL::ID BSTEventSink_FavoriteMgr_Events__ComponentFavoriteEvent_{ 524683 };
+		inline constexpr REL::ID BSTEventSink_FirstThirdPersonSwitch__Event_{ 1065164 };
+		inline constexpr REL::ID BSTEventSink_FusionCoreConsumed__Event_{ 826585 };
+		inline constexpr REL::ID BSTEventSink_FusionCoreEjected__Event_{ 1437956 };
+		inline constexpr REL::ID BSTEventSink_HUDEnemyHealthDisplayEvent_{ 1149407 };
+		inline constexpr REL::ID BSTEventSink_HUDExperienceUpdateEvent_{ 720986 };
+		inline constexpr REL::ID BSTEventSink_HUDExplosiveAmmoCounterData_{ 551834 };
+		inline constexpr REL::ID BSTEventSink_HUDInventoryChangeMessageEvent_{ 863804 };
+		inline constexpr REL::ID BSTEventSink_HUDMessageDisplayDataEvent_{ 761562 };
+		inline constexpr REL::ID BSTEventSink_HUDModeEvent_{ 1347282 };
+		inline constexpr REL::ID BSTEventSink_HUDNotificationDisplayEvent_{ 480818 };
+		inline constexpr REL::ID BSTEventSink_HUDNotificationEvent_{ 1112665 };
+		inline constexpr REL::ID BSTEventSink_HUDObjectiveDisplayEvent_{ 760841 };
+		inline constexpr REL::ID BSTEventSink_HUDPerkVaultBoyData_{ 1411514 };
+		inline constexpr REL::ID BSTEventSink_HUDPerkVaultBoySwfDisplayEvent_{ 287903 };
+		inline constexpr REL::ID BSTEventSink_HUDQuestVaultBoySwfName_{ 1559568 };
+		inline constexpr REL::ID BSTEventSink_HUDReinitializedEvent_{ 1538463 };
+		inline constexpr REL::ID BSTEventSink_HUDRolloverIsCrime_{ 1224612 };
+		inline constexpr REL::ID BSTEventSink_HUDRolloverStateEvent_{ 1053652 };
+		inline constexpr REL::ID BSTEventSink_HUDSubtitleDisplayEvent_{ 99184 };
+		inline constexpr REL::ID BSTEventSink_HUDTutorialTextEvent_{ 1338087 };
+		inline constexpr REL::ID BSTEventSink_HasHUDMessagesEvent_{ 178488 };
+		inline constexpr REL::ID BSTEventSink_HolotapeChatterEvent_{ 830425 };
+		inline constexpr REL::ID BSTEventSink_HolotapePlayEvent_{ 1002962 };
+		inline constexpr REL::ID BSTEventSink_HolotapeStateChanged__Event_{ 1495771 };
+		inline constexpr REL::ID BSTEventSink_HourPassed__Event_{ 124188 };
+		inline constexpr REL::ID BSTEventSink_HoursPassed__Event_{ 1476557 };
+		inline constexpr REL::ID BSTEventSink_IdleInputEvent_{ 707669 };
+		inline constexpr REL::ID BSTEventSink_InputEnableLayerDestroyedEvent_{ 148999 };
+		inline constexpr REL::ID BSTEventSink_InvInterfaceStateChangeEvent_{ 1329743 };
+		inline constexpr REL::ID BSTEventSink_InventoryInterface__CountChangedEvent_{ 1385825 };
+		inline constexpr REL::ID BSTEventSink_InventoryInterface__FavoriteChangedEvent_{ 818262 };
+		inline constexpr REL::ID BSTEventSink_InventoryKill__Event_{ 1177425 };
+		inline constexpr REL::ID BSTEventSink_InventoryUpdateEvent_{ 367230 };
+		inline constexpr REL::ID BSTEventSink_InvestmentMade__Event_{ 28145 };
+		inline constexpr REL::ID BSTEventSink_IsPipboyActiveEvent_{ 1047383 };
+		inline constexpr REL::ID BSTEventSink_ItemCrafted__Event_{ 201445 };
+		inline constexpr REL::ID BSTEventSink_ItemPickpocketed__Event_{ 373994 };
+		inline constexpr REL::ID BSTEventSink_ItemSteal__Event_{ 547050 };
+		inline constexpr REL::ID BSTEventSink_JunkItemFound__Event_{ 500042 };
+		inline constexpr REL::ID BSTEventSink_LevelIncrease__Event_{ 1360605 };
+		inline constexpr REL::ID BSTEventSink_LoadingStatusChanged__Event_{ 628863 };
+		inline constexpr REL::ID BSTEventSink_LocalMapCameraUpdate__Event_{ 576743 };
+		inline constexpr REL::ID BSTEventSink_LocalMapPostRendered__Event_{ 37540 };
+		inline constexpr REL::ID BSTEventSink_LocalMapRendered__Event_{ 1447300 };
+		inline constexpr REL::ID BSTEventSink_LocationCleared__Event_{ 1369005 };
+		inline constexpr REL::ID BSTEventSink_LocationLinked__Event_{ 1205115 };
+		inline constexpr REL::ID BSTEventSink_LocationMarkerArrayUpdate__Event_{ 1547507 };
+		inline constexpr REL::ID BSTEventSink_LocksPicked__Event_{ 1303406 };
+		inline constexpr REL::ID BSTEventSink_LooksMenuEvent_{ 83756 };
+		inline constexpr REL::ID BSTEventSink_MainStatus__StageEvent_{ 165554 };
+		inline constexpr REL::ID BSTEventSink_MeleeAttackJustReleasedEvent_{ 643410 };
+		inline constexpr REL::ID BSTEventSink_MenuModeChangeEvent_{ 4915 };
+		inline constexpr REL::ID BSTEventSink_MenuModeCounterChangedEvent_{ 880988 };
+		inline constexpr REL::ID BSTEventSink_MenuOpenCloseEvent_{ 1330964 };
+		inline constexpr REL::ID BSTEventSink_MineDisarmed__Event_{ 673195 };
+		inline constexpr REL::ID BSTEventSink_MovementMessageUpdateRequestImmediate_{ 523803 };
+		inline constexpr REL::ID BSTEventSink_MultiActivateUseRolloverEvent_{ 474961 };
+		inline constexpr REL::ID BSTEventSink_MurderCrime__Event_{ 541622 };
+		inline constexpr REL::ID BSTEventSink_MysteriousStrangerVisits__Event_{ 1064943 };
+		inline constexpr REL::ID BSTEventSink_ObjectiveState__Event_{ 1023602 };
+		inline constexpr REL::ID BSTEventSink_OnCompanionDisconnected__Event_{ 1568282 };
+		inline constexpr REL::ID BSTEventSink_OpenContainerMenuEventData_{ 962429 };
+		inline constexpr REL::ID BSTEventSink_OtherEventEnabledEvent_{ 617502 };
+		inline constexpr REL::ID BSTEventSink_PerkAdded__Event_{ 881990 };
+		inline constexpr REL::ID BSTEventSink_PerkPointIncreaseEvent_{ 1533806 };
+		inline constexpr REL::ID BSTEventSink_PerkValueEvents__PerkEntryUpdatedEvent_{ 272508 };
+		inline constexpr REL::ID BSTEventSink_PerkValueEvents__PerkValueChangedEvent_{ 1243346 };
+		inline constexpr REL::ID BSTEventSink_PickRefStateChangedEvent_{ 534886 };
+		inline constexpr REL::ID BSTEventSink_PickRefUpdateEvent_{ 1423174 };
+		inline constexpr REL::ID BSTEventSink_PipboyLightEvent_{ 980345 };
+		inline constexpr REL::ID BSTEventSink_PipboyValueChangedEvent_{ 449314 };
+		inline constexpr REL::ID BSTEventSink_PlayerActivatePickRefEvent_{ 726766 };
+		inline constexpr REL::ID BSTEventSink_PlayerActiveEffectChanged__Event_{ 209289 };
+		inline constexpr REL::ID BSTEventSink_PlayerActiveEffectIconsEvent_{ 226035 };
+		inline constexpr REL::ID BSTEventSink_PlayerAddicted__Event_{ 1457224 };
+		inline constexpr REL::ID BSTEventSink_PlayerAmmoCountEvent_{ 359583 };
+		inline constexpr REL::ID BSTEventSink_PlayerAutoAimActorEvent_{ 1524598 };
+		inline constexpr REL::ID BSTEventSink_PlayerCharacterQuestEvent__Event_{ 324318 };
+		inline constexpr REL::ID BSTEventSink_PlayerCommandTypeEvent_{ 381014 };
+		inline constexpr REL::ID BSTEventSink_PlayerCrosshairModeEvent_{ 565512 };
+		inline constexpr REL::ID BSTEventSink_PlayerDifficultySettingChanged__Event_{ 1575109 };
+		inline constexpr REL::ID BSTEventSink_PlayerInDialogueChanged__Event_{ 16663 };
+		inline constexpr REL::ID BSTEventSink_PlayerLifeStateChanged__Event_{ 987661 };
+		inline constexpr REL::ID BSTEventSink_PlayerSetWeaponStateEvent_{ 206202 };
+		inline constexpr REL::ID BSTEventSink_PlayerUpdateEvent_{ 1169060 };
+		inline constexpr REL::ID BSTEventSink_PlayerWeaponReloadEvent_{ 1363019 };
+		inline constexpr REL::ID BSTEventSink_PositionPlayerEvent_{ 455145 };
+		inline constexpr REL::ID BSTEventSink_PowerArmorLightData_{ 747696 };
+		inline constexpr REL::ID BSTEventSink_PreloadPowerArmor__Event_{ 1480046 };
+		inline constexpr REL::ID BSTEventSink_ProjectileBeginUpdateEvent_{ 1358651 };
+		inline constexpr REL::ID BSTEventSink_QuestStatus__Event_{ 1196626 };
+		inline constexpr REL::ID BSTEventSink_QueueSurvivalBumpDownMessage_{ 1189649 };
+		inline constexpr REL::ID BSTEventSink_QuickContainerStateEvent_{ 902857 };
+		inline constexpr REL::ID BSTEventSink_QuickContainerStateRequiresUpdate_{ 1370710 };
+		inline constexpr REL::ID BSTEventSink_RadioManager__PipboyFrequencyDetectionEvent_{ 908440 };
+		inline constexpr REL::ID BSTEventSink_RadioManager__PipboyRadioTuningEvent_{ 376387 };
+		inline constexpr REL::ID BSTEventSink_RadioManager__PipboyTransmitterDetectionEvent_{ 833133 };
+		inline constexpr REL::ID BSTEventSink_RequestHUDModesEvent_{ 635263 };
+		inline constexpr REL::ID BSTEventSink_RevertPlayerCharacterEvent_{ 937302 };
+		inline constexpr REL::ID BSTEventSink_RicochetHit__Event_{ 47450 };
+		inline constexpr REL::ID BSTEventSink_RolloverSuppressedEvent_{ 1011536 };
+		inline constexpr REL::ID BSTEventSink_SFRendererInitializedEvent_{ 572473 };
+		inline constexpr REL::ID BSTEventSink_SPECIALMenuEvent__NameChangedEvent_{ 296709 };
+		inline constexpr REL::ID BSTEventSink_SandmanKill__Event_{ 220478 };
+		inline constexpr REL::ID BSTEventSink_SaveLoadMessageStringEvent_{ 51782 };
+		inline constexpr REL::ID BSTEventSink_SaveLoadMessageTypeEvent_{ 578234 };
+		inline constexpr REL::ID BSTEventSink_ShowHUDMessageEvent_{ 1256127 };
+		inline constexpr REL::ID BSTEventSink_ShowingDialogueSpeechChallengeAnim_{ 1557183 };
+		inline constexpr REL::ID BSTEventSink_ShowingExperienceEvent_{ 182201 };
+		inline constexpr REL::ID BSTEventSink_ShowingFeaturedItemVaultBoyEvent_{ 401943 };
+		inline constexpr REL::ID BSTEventSink_ShowingLongSubtitleEvent_{ 218495 };
+		inline constexpr REL::ID BSTEventSink_ShowingPerkVaultBoyState_{ 1131909 };
+		inline constexpr REL::ID BSTEventSink_ShowingVATSCritAnim_{ 553623 };
+		inline constexpr REL::ID BSTEventSink_ShowingWideSubtitleEvent_{ 283889 };
+		inline constexpr REL::ID BSTEventSink_SpeechChallengeSucceeded__Event_{ 612634 };
+		inline constexpr REL::ID BSTEventSink_TESActivateEvent_{ 1017209 };
+		inline constexpr REL::ID BSTEventSink_TESActiveEffectApplyRemoveEvent_{ 1582342 };
+		inline constexpr REL::ID BSTEventSink_TESActorLocationChangeEvent_{ 611551 };
+		inline constexpr REL::ID BSTEventSink_TESBookReadEvent_{ 1003391 };
+		inline constexpr REL::ID BSTEventSink_TESCellAttachDetachEvent_{ 1395474 };
+		inline constexpr REL::ID BSTEventSink_TESCellFullyLoadedEvent_{ 424781 };
+		inline constexpr REL::ID BSTEventSink_TESCellReadyToApplyDecalsEvent_{ 1116906 };
+		inline constexpr REL::ID BSTEventSink_TESCombatEvent_{ 597897 };
+		inline constexpr REL::ID BSTEventSink_TESCommandModeCompleteCommandEvent_{ 770601 };
+		inline constexpr REL::ID BSTEventSink_TESCommandModeEnterEvent_{ 986986 };
+		inline constexpr REL::ID BSTEventSink_TESCommandModeExitEvent_{ 15971 };
+		inline constexpr REL::ID BSTEventSink_TESCommandModeGiveCommandEvent_{ 1381743 };
+		inline constexpr REL::ID BSTEventSink_TESConsciousnessEvent_{ 841580 };
+		inline constexpr REL::ID BSTEventSink_TESContainerChangedEvent_{ 1574234 };
+		inline constexpr REL::ID BSTEventSink_TESDataHandlerPostBuildFileListEvent_{ 257521 };
+		inline constexpr REL::ID BSTEventSink_TESDeathEvent_{ 168983 };
+		inline constexpr REL::ID BSTEventSink_TESDeferredKillEvent_{ 364436 };
+		inline constexpr REL::ID BSTEventSink_TESDestructionStageChangedEvent_{ 1377401 };
+		inline constexpr REL::ID BSTEventSink_TESEnterBleedoutEvent_{ 537471 };
+		inline constexpr REL::ID BSTEventSink_TESEnterSneakingEvent_{ 710556 };
+		inline constexpr REL::ID BSTEventSink_TESEquipEvent_{ 876879 };
+		inline constexpr REL::ID BSTEventSink_TESEscortWaitStartEvent_{ 1102223 };
+		inline constexpr REL::ID BSTEventSink_TESEscortWaitStopEvent_{ 1274966 };
+		inline constexpr REL::ID BSTEventSink_TESExitFurnitureEvent_{ 1190079 };
+		inline constexpr REL::ID BSTEventSink_TESFormDeleteEvent_{ 541264 };
+		inline constexpr REL::ID BSTEventSink_TESFormIDRemapEvent_{ 714277 };
+		inline constexpr REL::ID BSTEventSink_TESFurnitureEvent_{ 1060256 };
+		inline constexpr REL::ID BSTEventSink_TESGrabReleaseEvent_{ 1447687 };
+		inline constexpr REL::ID BSTEventSink_TESHarvestEvent__ItemHarvested_{ 579784 };
+		inline constexpr REL::ID BSTEventSink_TESHitEvent_{ 634094 };
+		inline constexpr REL::ID BSTEventSink_TESInitScriptEvent_{ 886552 };
+		inline constexpr REL::ID BSTEventSink_TESLimbCrippleEvent_{ 1014153 };
+		inline constexpr REL::ID BSTEventSink_TESLoadGameEvent_{ 1473738 };
+		inline constexpr REL::ID BSTEventSink_TESLocationClearedEvent_{ 1188203 };
+		inline constexpr REL::ID BSTEventSink_TESLockChangedEvent_{ 430037 };
+		inline constexpr REL::ID BSTEventSink_TESMagicEffectApplyEvent_{ 1529023 };
+		inline constexpr REL::ID BSTEventSink_TESObjectLoadedEvent_{ 603121 };
+		inline constexpr REL::ID BSTEventSink_TESObjectREFRTranslationEvent_{ 103928 };
+		inline constexpr REL::ID BSTEventSink_TESOnPCDialogueTargetEvent_{ 1406203 };
+		inline constexpr REL::ID BSTEventSink_TESOpenCloseEvent_{ 187779 };
+		inline constexpr REL::ID BSTEventSink_TESPackageEvent_{ 637092 };
+		inline constexpr REL::ID BSTEventSink_TESPerkEntryRunEvent_{ 590521 };
+		inline constexpr REL::ID BSTEventSink_TESPickNewIdleEvent_{ 1100144 };
+		inline constexpr REL::ID BSTEventSink_TESPickpocketFailedEvent_{ 994960 };
+		inline constexpr REL::ID BSTEventSink_TESQuestEvent__Event_{ 1514824 };
+		inline constexpr REL::ID BSTEventSink_TESQuestInitEvent_{ 1387084 };
+		inline constexpr REL::ID BSTEventSink_TESQuestStageEvent_{ 763250 };
+		inline constexpr REL::ID BSTEventSink_TESQuestStageItemDoneEvent_{ 283004 };
+		inline constexpr REL::ID BSTEventSink_TESQuestStartStopEvent_{ 771840 };
+		inline constexpr REL::ID BSTEventSink_TESResetEvent_{ 1560243 };
+		inline constexpr REL::ID BSTEventSink_TESResolveNPCTemplatesEvent_{ 1278722 };
+		inline constexpr REL::ID BSTEventSink_TESSceneActionEvent_{ 889169 };
+		inline constexpr REL::ID BSTEventSink_TESSceneEvent_{ 935744 };
+		inline constexpr REL::ID BSTEventSink_TESScenePhaseEvent_{ 1061865 };
+		inline constexpr REL::ID BSTEventSink_TESSellEvent_{ 1513708 };
+		inline constexpr REL::ID BSTEventSink_TESSleepStartEvent_{ 988984 };
+		inline constexpr REL::ID BSTEventSink_TESSleepStopEvent_{ 1162064 };
+		inline constexpr REL::ID BSTEventSink_TESSpellCastEvent_{ 1487495 };
+		inline constexpr REL::ID BSTEventSink_TESSwitchRaceCompleteEvent_{ 449128 };
+		inline constexpr REL::ID BSTEventSink_TESTopicInfoEvent_{ 1234780 };
+		inline constexpr REL::ID BSTEventSink_TESTrackedStatsEvent_{ 604245 };
+		inline constexpr REL::ID BSTEventSink_TESTrapHitEvent_{ 495910 };
+		inline constexpr REL::ID BSTEventSink_TESTriggerEnterEvent_{ 587468 };
+		inline constexpr REL::ID BSTEventSink_TESTriggerLeaveEvent_{ 760232 };
+		inline constexpr REL::ID BSTEventSink_TESUniqueIDChangeEvent_{ 88631 };
+		inline constexpr REL::ID BSTEventSink_TESWaitStartEvent_{ 1334534 };
+		inline constexpr REL::ID BSTEventSink_TESWaitStopEvent_{ 1507797 };
+		inline constexpr REL::ID BSTEventSink_TerminalHacked__Event_{ 1004447 };
+		inline constexpr REL::ID BSTEventSink_TerminalMenuItemRunEvent_{ 244829 };
+		inline constexpr REL::ID BSTEventSink_TravelMarkerStateChange__Event_{ 777172 };
+		inline constexpr REL::ID BSTEventSink_Trespass__Event_{ 1349915 };
+		inline constexpr REL::ID BSTEventSink_TutorialEvent_{ 596790 };
+		inline constexpr REL::ID BSTEventSink_UIAdvanceMenusFunctionCompleteEvent_{ 991434 };
+		inline constexpr REL::ID BSTEventSink_UserEventEnabledEvent_{ 1205142 };
+		inline constexpr REL::ID BSTEventSink_VATSCommandTargetEvent_{ 520834 };
+		inline constexpr REL::ID BSTEventSink_VATSCommand_{ 1357489 };
+		inline constexpr REL::ID BSTEventSink_VATSEvents__ModeChange_{ 1185040 };
+		inline constexpr REL::ID BSTEventSink_VATSForcedEnemyHealthPercentEvent_{ 367055 };
+		inline constexpr REL::ID BSTEventSink_ViewCasterUpdateEvent_{ 263154 };
+		inline constexpr REL::ID BSTEventSink_WeaponFiredEvent_{ 1511916 };
+		inline constexpr REL::ID BSTEventSink_WorkshopNPCTransferEvent_{ 37959 };
+		inline constexpr REL::ID BSTEventSink_Workshop__BuildableAreaEvent_{ 952730 };
+		inline constexpr REL::ID BSTEventSink_Workshop__ItemDestroyedEvent_{ 1552405 };
+		inline constexpr REL::ID BSTEventSink_Workshop__ItemGrabbedEvent_{ 279664 };
+		inline constexpr REL::ID BSTEventSink_Workshop__ItemMovedEvent_{ 106999 };
+		inline constexpr REL::ID BSTEventSink_Workshop__ItemPlacedEvent_{ 66814 };
+		inline constexpr REL::ID BSTEventSink_Workshop__ItemRepairedEvent_{ 1077632 };
+		inline constexpr REL::ID BSTEventSink_Workshop__ItemScrappedEvent_{ 678673 };
+		inline constexpr REL::ID BSTEventSink_Workshop__PlacementStatusEvent_{ 1564481 };
+		inline constexpr REL::ID BSTEventSink_Workshop__PowerOffEvent_{ 844579 };
+		inline constexpr REL::ID BSTEventSink_Workshop__PowerOnEvent_{ 672065 };
+		inline constexpr REL::ID BSTEventSink_Workshop__WorkshopModeEvent_{ 1240337 };
+		inline constexpr REL::ID BSTEventSink_bhkCharacterMoveFinishEvent_{ 680339 };
+		inline constexpr REL::ID BSTEventSink_bhkCharacterStateChangeEvent_{ 320561 };
+		inline constexpr REL::ID BSTEventSink_bhkNonSupportContactEvent_{ 1291373 };
+		inline constexpr REL::ID BSTEventSource_ActorCPMEvent_{ 1356841 };
+		inline constexpr REL::ID BSTEventSource_ActorValueEvents__ActorValueChangedEvent_{ 941163 };
+		inline constexpr REL::ID BSTEventSource_AnimationDataCleanupEvent_{ 224337 };
+		inline constexpr REL::ID BSTEventSource_AnimationDataSetupEvent_{ 265505 };
+		inline constexpr REL::ID BSTEventSource_ApplyColorUpdateEvent_{ 468167 };
+		inline constexpr REL::ID BSTEventSource_AutoLoadDoorRolloverEvent_{ 1081488 };
+		inline constexpr REL::ID BSTEventSource_BGSActorCellEvent_{ 1508957 };
+		inline constexpr REL::ID BSTEventSource_BGSActorDeathEvent_{ 99112 };
+		inline constexpr REL::ID BSTEventSource_BGSAppPausedEvent_{ 1074684 };
+		inline constexpr REL::ID BSTEventSource_BGSFootstepEvent_{ 1495930 };
+		inline constexpr REL::ID BSTEventSource_BSActiveGraphIfInactiveEvent_{ 362531 };
+		inline constexpr REL::ID BSTEventSource_BSAnimationGraphEvent_{ 973981 };
+		inline constexpr REL::ID BSTEventSource_BSMovementDataChangedEvent_{ 1146838 };
+		inline constexpr REL::ID BSTEventSource_BSPathEvent_{ 1346171 };
+		inline constexpr REL::ID BSTEventSource_BSProceduralGeomEvent_{ 250023 };
+		inline constexpr REL::ID BSTEventSource_BSScript__LogEvent_{ 959545 };
+		inline constexpr REL::ID BSTEventSource_BSScript__StatsEvent_{ 1548794 };
+		inline constexpr REL::ID BSTEventSource_BSSubGraphActivationUpdate_{ 176395 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent__{ 522629 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent__{ 556124 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage__{ 1407842 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective__{ 27751 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_CompanionMenuEnabled__{ 785790 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ConditionBoyEvent__{ 1442056 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ControlsRemappedEvent__{ 631052 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_CurrentRadiationSourceCount__{ 623430 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude__{ 588334 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal__{ 217993 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent__{ 1470773 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent__{ 1521365 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent__{ 1475502 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent__{ 1140418 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_FaderMenuDisplayState__{ 435878 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDCommmandModeEvent__{ 420081 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent__{ 1146436 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent__{ 1401857 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent__{ 1575393 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent__{ 659742 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent__{ 230136 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName__{ 966206 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDReinitializedEvent__{ 484308 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDRolloverIsCrime__{ 436863 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDRolloverStateEvent__{ 1442737 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent__{ 1001007 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HUDTutorialTextEvent__{ 621362 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_HasHUDMessagesEvent__{ 1369584 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_InventoryUpdateEvent__{ 1314455 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_IsPipboyActiveEvent__{ 1084848 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent__{ 468736 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ObjectivesInWayOfXP__{ 1224095 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PickRefStateChangedEvent__{ 660422 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PipboyLightEvent__{ 157526 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent__{ 55352 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent__{ 703366 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerAmmoCountEvent__{ 1039163 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent__{ 1418811 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerCommandTypeEvent__{ 621985 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent__{ 155853 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent__{ 152855 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent__{ 597718 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_QuickContainerStateEvent__{ 1286598 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate__{ 381936 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_RolloverSuppressedEvent__{ 517721 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent__{ 474284 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim__{ 1336696 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingExperienceEvent__{ 1174702 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent__{ 1305624 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent__{ 654450 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState__{ 1204007 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingVATSCritAnim__{ 994248 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent__{ 1382930 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_VATSCommandTargetEvent__{ 99752 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent__{ 397802 };
+		inline constexpr REL::ID BSTEventSource_BSTValueRequestEvent_ViewCasterUpdateEvent__{ 444064 };
+		inline constexpr REL::ID BSTEventSource_BSTaskManagerTaskCycleComleteEvent_{ 750087 };
+		inline constexpr REL::ID BSTEventSource_BSTaskManagerWaitAction_{ 138252 };
+		inline constexpr REL::ID BSTEventSource_BSThreadEvent__ThreadEvent_{ 880724 };
+		inline constexpr REL::ID BSTEventSource_BSTransformDeltaEvent_{ 787916 };
+		inline constexpr REL::ID BSTEventSource_BeamProjectileImpactEvent_{ 259666 };
+		inline constexpr REL::ID BSTEventSource_BinkMovieStoppedPlayingEvent_{ 830311 };
+		inline constexpr REL::ID BSTEventSource_BlockPipboyOpeningEvent_{ 563764 };
+		inline constexpr REL::ID BSTEventSource_BlurEvent_{ 317280 };
+		inline constexpr REL::ID BSTEventSource_ButtonBarMenuUpdateEvent_{ 1326712 };
+		inline constexpr REL::ID BSTEventSource_CanDisplayNextHUDMessage_{ 120940 };
+		inline constexpr REL::ID BSTEventSource_CanDisplayNextHUDObjective_{ 428479 };
+		inline constexpr REL::ID BSTEventSource_ClearHUDMessagesEvent_{ 1065529 };
+		inline constexpr REL::ID BSTEventSource_ClearQuickContainerEvent_{ 1122668 };
+		inline constexpr REL::ID BSTEventSource_ColorUpdateEvent_{ 278547 };
+		inline constexpr REL::ID BSTEventSource_CompanionMenuEnabled_{ 434953 };
+		inline constexpr REL::ID BSTEventSource_ConditionBoyEvent_{ 84636 };
+		inline constexpr REL::ID BSTEventSource_ControlsRemappedEvent_{ 326486 };
+		inline constexpr REL::ID BSTEventSource_CurrentRadiationSourceCount_{ 1459653 };
+		inline constexpr REL::ID BSTEventSource_CurrentRadsDisplayMagnitude_{ 1424140 };
+		inline constexpr REL::ID BSTEventSource_CurrentRadsPercentOfLethal_{ 1054109 };
+		inline constexpr REL::ID BSTEventSource_DeferredDeleter__QueueStatusEvent_{ 817298 };
+		inline constexpr REL::ID BSTEventSource_DirectionalHitIndicatorResultEvent_{ 458239 };
+		inline constexpr REL::ID BSTEventSource_DisplayFatigueWarningEvent_{ 339332 };
+		inline constexpr REL::ID BSTEventSource_DoBeforeNewOrLoadCompletedEvent_{ 533992 };
+		inline constexpr REL::ID BSTEventSource_EndLoadGameEvent_{ 1124735 };
+		inline constexpr REL::ID BSTEventSource_ExperienceMeterDisplayEvent_{ 998010 };
+		inline constexpr REL::ID BSTEventSource_ExplosiveIndicatorResultEvent_{ 1271959 };
+		inline constexpr REL::ID BSTEventSource_FaderMenuDisplayState_{ 1576761 };
+		inline constexpr REL::ID BSTEventSource_FavoriteMgr_Events__ComponentFavoriteEvent_{ 764450 };
+		inline constexpr REL::ID BSTEventSource_GameScript__StatsEvent_{ 626132 };
+		inline constexpr REL::ID BSTEventSource_HUDCommmandModeEvent_{ 645200 };
+		inline constexpr REL::ID BSTEventSource_HUDEnemyHealthDisplayEvent_{ 1547144 };
+		inline constexpr REL::ID BSTEventSource_HUDExperienceUpdateEvent_{ 531169 };
+		inline constexpr REL::ID BSTEventSource_HUDExplosiveAmmoCounterData_{ 949015 };
+		inline constexpr REL::ID BSTEventSource_HUDInventoryChangeMessageEvent_{ 795430 };
+		inline constexpr REL::ID BSTEventSource_HUDMessageDisplayDataEvent_{ 220347 };
+		inline constexpr REL::ID BSTEventSource_HUDModeEvent_{ 335453 };
+		inline constexpr REL::ID BSTEventSource_HUDNotificationDisplayEvent_{ 1313758 };
+		inline constexpr REL::ID BSTEventSource_HUDNotificationEvent_{ 316969 };
+		inline constexpr REL::ID BSTEventSource_HUDObjectiveDisplayEvent_{ 916310 };
+		inline constexpr REL::ID BSTEventSource_HUDPerkVaultBoyData_{ 1342814 };
+		inline constexpr REL::ID BSTEventSource_HUDPerkVaultBoySwfDisplayEvent_{ 896600 };
+		inline constexpr REL::ID BSTEventSource_HUDQuestVaultBoySwfName_{ 1366526 };
+		inline constexpr REL::ID BSTEventSource_HUDReinitializedEvent_{ 180338 };
+		inline constexpr REL::ID BSTEventSource_HUDRolloverIsCrime_{ 571790 };
+		inline constexpr REL::ID BSTEventSource_HUDRolloverStateEvent_{ 1138484 };
+		inline constexpr REL::ID BSTEventSource_HUDSubtitleDisplayEvent_{ 959919 };
+		inline constexpr REL::ID BSTEventSource_HUDTutorialTextEvent_{ 252933 };
+		inline constexpr REL::ID BSTEventSource_HasHUDMessagesEvent_{ 1489529 };
+		inline constexpr REL::ID BSTEventSource_IdleInputEvent_{ 628052 };
+		inline constexpr REL::ID BSTEventSource_InventoryUpdateEvent_{ 1010132 };
+		inline constexpr REL::ID BSTEventSource_IsPipboyActiveEvent_{ 780905 };
+		inline constexpr REL::ID BSTEventSource_MeleeAttackJustReleasedEvent_{ 681884 };
+		inline constexpr REL::ID BSTEventSource_MenuModeChangeEvent_{ 1170765 };
+		inline constexpr REL::ID BSTEventSource_MenuModeCounterChangedEvent_{ 1563191 };
+		inline constexpr REL::ID BSTEventSource_MenuOpenCloseEvent_{ 997790 };
+		inline constexpr REL::ID BSTEventSource_MovementMessageUpdateRequestImmediate_{ 1104864 };
+		inline constexpr REL::ID BSTEventSource_MultiActivateUseRolloverEvent_{ 1135394 };
+		inline constexpr REL::ID BSTEventSource_ObjectivesInWayOfXP_{ 1448687 };
+		inline constexpr REL::ID BSTEventSource_OpenContainerMenuEventData_{ 1225674 };
+		inline constexpr REL::ID BSTEventSource_PerkPointIncreaseEvent_{ 391682 };
+		inline constexpr REL::ID BSTEventSource_PerkValueEvents__PerkEntryUpdatedEvent_{ 745861 };
+		inline constexpr REL::ID BSTEventSource_PerkValueEvents__PerkValueChangedEvent_{ 134086 };
+		inline constexpr REL::ID BSTEventSource_PickRefStateChangedEvent_{ 423294 };
+		inline constexpr REL::ID BSTEventSource_PickRefUpdateEvent_{ 444390 };
+		inline constexpr REL::ID BSTEventSource_PipboyLightEvent_{ 317686 };
+		inline constexpr REL::ID BSTEventSource_PipboyValueChangedEvent_{ 1177454 };
+		inline constexpr REL::ID BSTEventSource_PlayerActivatePickRefEvent_{ 455696 };
+		inline constexpr REL::ID BSTEventSource_PlayerActiveEffectIconsEvent_{ 395536 };
+		inline constexpr REL::ID BSTEventSource_PlayerAmmoCountEvent_{ 735367 };
+		inline constexpr REL::ID BSTEventSource_PlayerAutoAimActorEvent_{ 58374 };
+		inline constexpr REL::ID BSTEventSource_PlayerCommandTypeEvent_{ 42422 };
+		inline constexpr REL::ID BSTEventSource_PlayerCrosshairModeEvent_{ 556417 };
+		inline constexpr REL::ID BSTEventSource_PlayerSetWeaponStateEvent_{ 553430 };
+		inline constexpr REL::ID BSTEventSource_PlayerUpdateEvent_{ 249631 };
+		inline constexpr REL::ID BSTEventSource_PlayerWeaponReloadEvent_{ 997777 };
+		inline constexpr REL::ID BSTEventSource_PositionPlayerEvent_{ 271997 };
+		inline constexpr REL::ID BSTEventSource_PowerArmorLightData_{ 291686 };
+		inline constexpr REL::ID BSTEventSource_QueueSurvivalBumpDownMessage_{ 237351 };
+		inline constexpr REL::ID BSTEventSource_QuickContainerStateEvent_{ 1245457 };
+		inline constexpr REL::ID BSTEventSource_QuickContainerStateRequiresUpdate_{ 918156 };
+		inline constexpr REL::ID BSTEventSource_RequestHUDModesEvent_{ 944601 };
+		inline constexpr REL::ID BSTEventSource_RevertPlayerCharacterEvent_{ 931280 };
+		inline constexpr REL::ID BSTEventSource_RolloverSuppressedEvent_{ 1043582 };
+		inline constexpr REL::ID BSTEventSource_SaveLoadMessageStringEvent_{ 43154 };
+		inline constexpr REL::ID BSTEventSource_SaveLoadMessageTypeEvent_{ 1279867 };
+		inline constexpr REL::ID BSTEventSource_ShowHUDMessageEvent_{ 581314 };
+		inline constexpr REL::ID BSTEventSource_ShowingDialogueSpeechChallengeAnim_{ 1125862 };
+		inline constexpr REL::ID BSTEventSource_ShowingExperienceEvent_{ 394989 };
+		inline constexpr REL::ID BSTEventSource_ShowingFeaturedItemVaultBoyEvent_{ 1094755 };
+		inline constexpr REL::ID BSTEventSource_ShowingLongSubtitleEvent_{ 1054605 };
+		inline constexpr REL::ID BSTEventSource_ShowingPerkVaultBoyState_{ 627770 };
+		inline constexpr REL::ID BSTEventSource_ShowingVATSCritAnim_{ 690532 };
+		inline constexpr REL::ID BSTEventSource_ShowingWideSubtitleEvent_{ 201574 };
+		inline constexpr REL::ID BSTEventSource_TutorialEvent_{ 372733 };
+		inline constexpr REL::ID BSTEventSource_UIAdvanceMenusFunctionCompleteEvent_{ 684794 };
+		inline constexpr REL::ID BSTEventSource_VATSCommandTargetEvent_{ 938942 };
+		inline constexpr REL::ID BSTEventSource_VATSForcedEnemyHealthPercentEvent_{ 187188 };
+		inline constexpr REL::ID BSTEventSource_ViewCasterUpdateEvent_{ 1546702 };
+		inline constexpr REL::ID BSTEventSource_bhkCharacterMoveFinishEvent_{ 1365877 };
+		inline constexpr REL::ID BSTEventSource_bhkCharacterStateChangeEvent_{ 1006801 };
+		inline constexpr REL::ID BSTEventSource_bhkNonSupportContactEvent_{ 395344 };
+		inline constexpr REL::ID BSTFreeList_ActorMovementMessageMap_16___RawMessageHandlerWrapperType_{ 1192108 };
+		inline constexpr REL::ID BSTFreeList_BSScript__Internal__FunctionMessage_{ 1049534 };
+		inline constexpr REL::ID BSTFreeList_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ 692004 };
+		inline constexpr REL::ID BSTFunction_ButtonHintBar_{ 986166 };
+		inline constexpr REL::ID BSTFunction_ButtonHintDataWithClone_{ 443743 };
+		inline constexpr REL::ID BSTFunction_FlashHitIndicator_{ 676769 };
+		inline constexpr REL::ID BSTFunction_HUDActorValueMeterBase_{ 326815 };
+		inline constexpr REL::ID BSTFunction_HUDPerkVaultBoy_{ 680683 };
+		inline constexpr REL::ID BSTFunction_VATSMenuPrivate__VatsMenuObj_{ 409782 };
+		inline constexpr REL::ID BSTGlobalEvent{ 1440230 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_AnimationDataCleanupEvent_{ 876784 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_AnimationDataSetupEvent_{ 1356663 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ApplyColorUpdateEvent_{ 416164 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent_{ 152203 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BGSAppPausedEvent_{ 317997 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent__{ 1534776 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent__{ 1568221 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage__{ 837876 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective__{ 1040071 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled__{ 654378 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent__{ 167330 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent__{ 499204 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount__{ 758095 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude__{ 723023 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal__{ 1230013 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent__{ 288654 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent__{ 950937 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent__{ 27069 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent__{ 836247 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState__{ 304583 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent__{ 288589 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent__{ 576378 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent__{ 831784 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent__{ 127457 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent__{ 89282 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent__{ 1508350 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName__{ 395989 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent__{ 352746 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime__{ 744600 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent__{ 1311179 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent__{ 430699 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent__{ 489655 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent__{ 1238503 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent__{ 1183110 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent__{ 953474 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent__{ 164856 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP__{ 1092355 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent__{ 89942 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent__{ 464302 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent__{ 1067315 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent__{ 837433 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent__{ 907851 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent__{ 848737 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent__{ 490307 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent__{ 1167741 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent__{ 1164766 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent__{ 26837 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent__{ 716757 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate__{ 782766 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent__{ 1529903 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent__{ 1486708 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim__{ 155359 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent__{ 1043123 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent__{ 124030 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent__{ 83988 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState__{ 633794 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim__{ 862866 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent__{ 813052 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent__{ 1550618 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent__{ 798635 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent__{ 312830 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent_{ 1044232 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent_{ 72966 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_BlurEvent_{ 1096201 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent_{ 836173 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage_{ 1212741 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective_{ 642909 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ClearHUDMessagesEvent_{ 1013447 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ClearQuickContainerEvent_{ 632286 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ColorUpdateEvent_{ 1542917 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_CompanionMenuEnabled_{ 1260837 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ConditionBoyEvent_{ 910158 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ControlsRemappedEvent_{ 274593 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_CurrentRadiationSourceCount_{ 91329 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude_{ 56031 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal_{ 1268213 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent_{ 1377065 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent_{ 553652 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent_{ 309065 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_EndLoadGameEvent_{ 807043 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent_{ 1212523 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent_{ 1047193 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_FaderMenuDisplayState_{ 1524812 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDCommmandModeEvent_{ 1470694 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent_{ 178982 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent_{ 40079 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData_{ 1163144 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent_{ 570610 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent_{ 434001 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDModeEvent_{ 675934 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent_{ 1528041 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDNotificationEvent_{ 1142441 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent_{ 425460 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDPerkVaultBoyData_{ 586471 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent_{ 672070 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName_{ 875947 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDReinitializedEvent_{ 128092 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDRolloverIsCrime_{ 1396925 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDRolloverStateEvent_{ 1086521 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent_{ 468946 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HUDTutorialTextEvent_{ 1078358 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_HasHUDMessagesEvent_{ 732829 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_InventoryUpdateEvent_{ 253628 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_IsPipboyActiveEvent_{ 23516 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent_{ 895477 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent_{ 910813 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ObjectivesInWayOfXP_{ 692193 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_OpenContainerMenuEventData_{ 1439409 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PerkPointIncreaseEvent_{ 339704 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PickRefStateChangedEvent_{ 1515260 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PipboyLightEvent_{ 1582093 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent_{ 670234 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent_{ 609754 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerAmmoCountEvent_{ 1560805 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent_{ 1149837 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerCommandTypeEvent_{ 1573070 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent_{ 65514 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent_{ 1206158 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerUpdateEvent_{ 1075045 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent_{ 507251 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_PowerArmorLightData_{ 1117311 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage_{ 451011 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_QuickContainerStateEvent_{ 754858 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate_{ 254812 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_RequestHUDModesEvent_{ 188186 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent_{ 1145241 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_RolloverSuppressedEvent_{ 553113 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent_{ 257366 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent_{ 789348 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowHUDMessageEvent_{ 1406468 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim_{ 462109 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingExperienceEvent_{ 343004 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent_{ 869801 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent_{ 564077 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState_{ 136761 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingVATSCritAnim_{ 1516023 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent_{ 1292900 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent_{ 20514 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_VATSCommandTargetEvent_{ 887009 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent_{ 1105662 };
+		inline constexpr REL::ID BSTGlobalEvent__EventSource_ViewCasterUpdateEvent_{ 1494950 };
+		inline constexpr REL::ID BSTIOStream__TIStream_BSIOStreamTraits_{ 1092245 };
+		inline constexpr REL::ID BSTIOStream__TOStream_BSIOStreamTraits_{ 294079 };
+		inline constexpr REL::ID BSTMessageQueue_BGSCombinedCellGeometryDB__ModelDB__DBTraits__StorageType_{ 1205747 };
+		inline constexpr REL::ID BSTMessageQueue_BGSCombinedCellGeometryDB__PreloadTask__PreloadRequest_{ 1391837 };
+		inline constexpr REL::ID BSTMessageQueue_BGSDecalManager__PendingSkinnedDecal_{ 299522 };
+		inline constexpr REL::ID BSTMessageQueue_BGSSaveLoadThread__AsyncRequest_{ 1203928 };
+		inline constexpr REL::ID BSTMessageQueue_BSFaceGenManager__PendingCustomizationData_{ 873281 };
+		inline constexpr REL::ID BSTMessageQueue_BSPackedTask_{ 440231 };
+		inline constexpr REL::ID BSTMessageQueue_BSScript__Internal__FunctionMessage_{ 597255 };
+		inline constexpr REL::ID BSTMessageQueue_BSScript__Internal__SuspendedStack_{ 676871 };
+		inline constexpr REL::ID BSTMessageQueue_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ 1023265 };
+		inline constexpr REL::ID BSTMessageQueue_NiPointer_NiAVObject__{ 934889 };
+		inline constexpr REL::ID BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy_{ 32989 };
+		inline constexpr REL::ID BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy_{ 395553 };
+		inline constexpr REL::ID BSTSDMTraits_ActorMediator_BSTSingletonSDMOpStaticBuffer_ActorMediator__{ 1386058 };
+		inline constexpr REL::ID BSTSDMTraits_AnimationClipDataSingleton_BSTSingletonSDMOpStaticBuffer_AnimationClipDataSingleton__{ 1215956 };
+		inline constexpr REL::ID BSTSDMTraits_AnimationFileManagerSingleton_BSTSingletonSDMOpStaticBuffer_AnimationFileManagerSingleton__{ 79932 };
+		inline constexpr REL::ID BSTSDMTraits_AppResourceCaching____Manager_BSTSingletonSDMOpStaticBuffer_AppResourceCaching____Manager__{ 402559 };
+		inline constexpr REL::ID BSTSDMTraits_BGSCombinedCellGeometryDB__CDX_BSTSingletonSDMOpStaticBuffer_BGSCombinedCellGeometryDB__CDX__{ 715274 };
+		inline constexpr REL::ID BSTSDMTraits_BGSFootIkRaycastInterfaceDB_BSTSingletonSDMOpStaticBuffer_BGSFootIkRaycastInterfaceDB__{ 55198 };
+		inline constexpr REL::ID BSTSDMTraits_BGSFootstepManager_BSTSingletonSDMOpStaticBuffer_BGSFootstepManager__{ 557895 };
+		inline constexpr REL::ID BSTSDMTraits_BGSGamebryoSequenceGeneratorHolderSingleton_BSTSingletonSDMOpStaticBuffer_BGSGamebryoSequenceGeneratorHolderSingleton__{ 546283 };
+		inline constexpr REL::ID BSTSDMTraits_BGSImpactManager_BSTSingletonSDMOpStaticBuffer_BGSImpactManager__{ 939561 };
+		inline constexpr REL::ID BSTSDMTraits_BGSStoryManager_BSTSingletonSDMOpStaticBuffer_BGSStoryManager__{ 1135982 };
+		inline constexpr REL::ID BSTSDMTraits_BGSStoryTeller_BSTSingletonSDMOpStaticBuffer_BGSStoryTeller__{ 1346863 };
+		inline constexpr REL::ID BSTSDMTraits_BGSSynchronizedAnimationManager_BSTSingletonSDMOpStaticBuffer_BGSSynchronizedAnimationManager__{ 584485 };
+		inline constexpr REL::ID BSTSDMTraits_BSAlignBoneModifierInterface_BSTSingletonSDMOpStaticBuffer_BSAlignBoneModifierInterface__{ 498605 };
+		inline constexpr REL::ID BSTSDMTraits_BSBehaviorGraphSwapSingleton_BSTSingletonSDMOpStaticBuffer_BSBehaviorGraphSwapSingleton__{ 1307442 };
+		inline constexpr REL::ID BSTSDMTraits_BSCompanionAutodiscover_BSTSingletonSDMOpStaticBuffer_BSCompanionAutodiscover__{ 1013569 };
+		inline constexpr REL::ID BSTSDMTraits_BSDirectAtModifierInterface_BSTSingletonSDMOpStaticBuffer_BSDirectAtModifierInterface__{ 13075 };
+		inline constexpr REL::ID BSTSDMTraits_BSIdleInputWatcher_BSTSingletonSDMOpStaticBuffer_BSIdleInputWatcher__{ 1253165 };
+		inline constexpr REL::ID BSTSDMTraits_BSLimbIKModifierUtility_BSTSingletonSDMOpStaticBuffer_BSLimbIKModifierUtility__{ 76781 };
+		inline constexpr REL::ID BSTSDMTraits_BSLookAtModifierInterface_BSTSingletonSDMOpStaticBuffer_BSLookAtModifierInterface__{ 1521654 };
+		inline constexpr REL::ID BSTSDMTraits_BSPassByTargetTriggerModifierInterface_BSTSingletonSDMOpStaticBuffer_BSPassByTargetTriggerModifierInterface__{ 1209218 };
+		inline constexpr REL::ID BSTSDMTraits_BSPathEventManager_BSTSingletonSDMOpStaticBuffer_BSPathEventManager__{ 389291 };
+		inline constexpr REL::ID BSTSDMTraits_BSPlatform__BSBethesdaPlatform_BSTSingletonSDMOpStaticBuffer_BSPlatform__BSBethesdaPlatform__{ 191290 };
+		inline constexpr REL::ID BSTSDMTraits_BSRagdollContactListenerModifierInterface_BSTSingletonSDMOpStaticBuffer_BSRagdollContactListenerModifierInterface__{ 912481 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BGSBtoDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBtoDB__DBTraits___{ 270829 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BGSBtrDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBtrDB__DBTraits___{ 1065588 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BGSBttDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBttDB__DBTraits___{ 1106929 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits___{ 1274399 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits___{ 797594 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits___{ 450837 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits___{ 1353243 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits___{ 78474 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSMaterialDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSMaterialDB__DBTraits___{ 870370 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSModelDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSModelDB__DBTraits___{ 1578479 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits___{ 602047 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits___{ 423980 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BSTextureDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSTextureDB__DBTraits___{ 566482 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_BShkbHkxDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BShkbHkxDB__DBTraits___{ 79710 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_LipSynchAnimDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_LipSynchAnimDB__DBTraits___{ 221902 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__EntryDB_ScaleformFile__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_ScaleformFile__DBTraits___{ 448280 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource__SDirectory2__ThreadCursor_BSTSingletonSDMOpStaticBuffer_BSResource__SDirectory2__ThreadCursor__{ 1497356 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource____DefaultLocationData_BSTSingletonSDMOpStaticBuffer_BSResource____DefaultLocationData__{ 333697 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource____DevNull_BSTSingletonSDMOpStaticBuffer_BSResource____DevNull__{ 1573673 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource____EventSources_BSTSingletonSDMOpStaticBuffer_BSResource____EventSources__{ 1013811 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource____GlobalLocations_BSTSingletonSDMOpStaticBuffer_BSResource____GlobalLocations__{ 844264 };
+		inline constexpr REL::ID BSTSDMTraits_BSResource____GlobalPaths_BSTSingletonSDMOpStaticBuffer_BSResource____GlobalPaths__{ 723854 };
+		inline constexpr REL::ID BSTSDMTraits_BSScaleformManager_BSTSingletonSDMOpStaticBuffer_BSScaleformManager__{ 1197760 };
+		inline constexpr REL::ID BSTSDMTraits_BSStateMachineCallbackSingleton_BSTSingletonSDMOpStaticBuffer_BSStateMachineCallbackSingleton__{ 1581350 };
+		inline constexpr REL::ID BSTSDMTraits_BSStaticTriShapeDB__Manager_BSTSingletonSDMOpStaticBuffer_BSStaticTriShapeDB__Manager__{ 303251 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent_BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__{ 1426378 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_AnimationDataCleanupEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AnimationDataCleanupEvent___{ 503918 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_AnimationDataSetupEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AnimationDataSetupEvent___{ 983722 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ApplyColorUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ApplyColorUpdateEvent___{ 43198 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent___{ 1361035 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BGSAppPausedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BGSAppPausedEvent___{ 649933 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent____{ 629825 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent____{ 663176 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage____{ 1515372 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective____{ 135152 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled____{ 1331163 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent____{ 405494 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent____{ 1176569 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount____{ 730672 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude____{ 695483 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal____{ 324849 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent____{ 700527 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent____{ 45737 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent____{ 1582386 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent____{ 808850 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState____{ 981704 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent____{ 965925 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent____{ 1253608 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent____{ 1509331 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent____{ 99969 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent____{ 766684 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent____{ 1480895 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName____{ 1073238 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent____{ 1029975 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime____{ 982657 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent____{ 406137 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent____{ 1108176 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent____{ 1166997 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent____{ 333356 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent____{ 278050 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent____{ 48262 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent____{ 137208 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP____{ 187632 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent____{ 767344 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent____{ 703617 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent____{ 162575 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent____{ 810065 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent____{ 2164 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent____{ 1526231 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent____{ 1167668 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent____{ 262718 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent____{ 259653 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent____{ 704990 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent____{ 1393345 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate____{ 1193862 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent____{ 624878 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent____{ 581550 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim____{ 566587 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent____{ 138134 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent____{ 535383 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent____{ 761359 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState____{ 1310720 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim____{ 1540336 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent____{ 1490468 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent____{ 645706 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent____{ 1209881 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent____{ 989825 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent___{ 1110040 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent___{ 1282096 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_BlurEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BlurEvent___{ 550687 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent___{ 462777 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage___{ 839490 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective___{ 708932 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ClearHUDMessagesEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ClearHUDMessagesEvent___{ 640840 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ClearQuickContainerEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ClearQuickContainerEvent___{ 259050 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ColorUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ColorUpdateEvent___{ 292098 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_CompanionMenuEnabled__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CompanionMenuEnabled___{ 9699 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ConditionBoyEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ConditionBoyEvent___{ 1242000 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ControlsRemappedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ControlsRemappedEvent___{ 1484162 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_CurrentRadiationSourceCount__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadiationSourceCount___{ 157225 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude___{ 121869 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal___{ 1333694 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent___{ 299394 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent___{ 619306 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent___{ 813715 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_EndLoadGameEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_EndLoadGameEvent___{ 1138552 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent___{ 1278018 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent___{ 1551801 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_FaderMenuDisplayState__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_FaderMenuDisplayState___{ 1151559 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDCommmandModeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDCommmandModeEvent___{ 220051 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent___{ 244565 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent___{ 1249751 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData___{ 1228924 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent___{ 1074883 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent___{ 499931 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDModeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDModeEvent___{ 568745 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent___{ 10851 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDNotificationEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDNotificationEvent___{ 1474551 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent___{ 52507 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDPerkVaultBoyData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDPerkVaultBoyData___{ 917939 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent___{ 1176343 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName___{ 503026 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDReinitializedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDReinitializedEvent___{ 1337120 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDRolloverIsCrime__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDRolloverIsCrime___{ 146675 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDRolloverStateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDRolloverStateEvent___{ 713988 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent___{ 96165 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HUDTutorialTextEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDTutorialTextEvent___{ 1409912 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_HasHUDMessagesEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HasHUDMessagesEvent___{ 1064114 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_InventoryUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_InventoryUpdateEvent___{ 585527 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_IsPipboyActiveEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_IsPipboyActiveEvent___{ 355541 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent___{ 961138 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent___{ 1415026 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ObjectivesInWayOfXP__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ObjectivesInWayOfXP___{ 1023443 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_OpenContainerMenuEventData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_OpenContainerMenuEventData___{ 1505602 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PerkPointIncreaseEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PerkPointIncreaseEvent___{ 1549135 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PickRefStateChangedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PickRefStateChangedEvent___{ 1141934 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PipboyLightEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PipboyLightEvent___{ 331433 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent___{ 736035 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent___{ 675705 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerAmmoCountEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerAmmoCountEvent___{ 310041 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent___{ 777238 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerCommandTypeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerCommandTypeEvent___{ 1199986 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent___{ 1274790 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent___{ 832951 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerUpdateEvent___{ 1406616 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent___{ 134221 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_PowerArmorLightData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PowerArmorLightData___{ 1449243 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage___{ 517030 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_QuickContainerStateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QuickContainerStateEvent___{ 381476 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate___{ 759465 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_RequestHUDModesEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RequestHUDModesEvent___{ 519700 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent___{ 1211318 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_RolloverSuppressedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RolloverSuppressedEvent___{ 180104 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent___{ 322999 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent___{ 415878 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowHUDMessageEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowHUDMessageEvent___{ 156309 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim___{ 966868 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingExperienceEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingExperienceEvent___{ 1552482 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent___{ 1374267 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent___{ 191226 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState___{ 1345829 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingVATSCritAnim__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingVATSCritAnim___{ 265301 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent___{ 919827 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent___{ 525507 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_VATSCommandTargetEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_VATSCommandTargetEvent___{ 514011 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent___{ 27528 };
+		inline constexpr REL::ID BSTSDMTraits_BSTGlobalEvent__EventSource_ViewCasterUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ViewCasterUpdateEvent___{ 1121468 };
+		inline constexpr REL::ID BSTSDMTraits_BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy__BSTSingletonSDMOpStaticBuffer_BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy___{ 416851 };
+		inline constexpr REL::ID BSTSDMTraits_BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy__BSTSingletonSDMOpStaticBuffer_BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy___{ 700326 };
+		inline constexpr REL::ID BSTSDMTraits_BSTextureStreamer__Manager_BSTSingletonSDMOpStaticBuffer_BSTextureStreamer__Manager__{ 801982 };
+		inline constexpr REL::ID BSTSDMTraits_BSThreadEvent____Source_BSTSingletonSDMOpStaticBuffer_BSThreadEvent____Source__{ 1478908 };
+		inline constexpr REL::ID BSTSDMTraits_BSiStateTaggingListenerSingleton_BSTSingletonSDMOpStaticBuffer_BSiStateTaggingListenerSingleton__{ 1277006 };
+		inline constexpr REL::ID BSTSDMTraits_CharacterCollisionHandler_BSTSingletonSDMOpStaticBuffer_CharacterCollisionHandler__{ 1002609 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 539073 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 904202 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 728565 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 489809 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 1537085 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 390481 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 1434587 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 1345567 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy___{ 1310881 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 142973 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy___{ 266852 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy___{ 953181 };
+		inline constexpr REL::ID BSTSDMTraits_CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy___{ 1558743 };
+		inline constexpr REL::ID BSTSDMTraits_DynamicIdleDataSingletonHelper_BSTSingletonSDMOpStaticBuffer_DynamicIdleDataSingletonHelper__{ 369321 };
+		inline constexpr REL::ID BSTSDMTraits_FOCollisionListener_BSTSingletonSDMOpStaticBuffer_FOCollisionListener__{ 1494389 };
+		inline constexpr REL::ID BSTSDMTraits_FavoritesManager_BSTSingletonSDMOpStaticBuffer_FavoritesManager__{ 246038 };
+		inline constexpr REL::ID BSTSDMTraits_FlatScreenModel_BSTSingletonSDMOpStaticBuffer_FlatScreenModel__{ 473336 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__BasicEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__BasicEventHandler__{ 1164930 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__CombatEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__CombatEventHandler__{ 889871 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__CustomEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__CustomEventHandler__{ 183906 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__DistanceEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__DistanceEventHandler__{ 1191012 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__FragmentEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__FragmentEventHandler__{ 1346823 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__InventoryEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__InventoryEventHandler__{ 1334659 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__LOSEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__LOSEventHandler__{ 1304240 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__MenuEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__MenuEventHandler__{ 50697 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__PathingCallbackMgr_BSTSingletonSDMOpStaticBuffer_GameScript__PathingCallbackMgr__{ 845790 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__QuestCallbackMgr_BSTSingletonSDMOpStaticBuffer_GameScript__QuestCallbackMgr__{ 444979 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__SleepEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__SleepEventHandler__{ 670267 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__SoundCallbackMgr_BSTSingletonSDMOpStaticBuffer_GameScript__SoundCallbackMgr__{ 176469 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__TeleportEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__TeleportEventHandler__{ 944767 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__TimerEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__TimerEventHandler__{ 558195 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__TrackedStatsEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__TrackedStatsEventHandler__{ 461392 };
+		inline constexpr REL::ID BSTSDMTraits_GameScript__WaitEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__WaitEventHandler__{ 44289 };
+		inline constexpr REL::ID BSTSDMTraits_GameUIModel_BSTSingletonSDMOpStaticBuffer_GameUIModel__{ 246439 };
+		inline constexpr REL::ID BSTSDMTraits_GameVM_BSTSingletonSDMOpStaticBuffer_GameVM__{ 905695 };
+		inline constexpr REL::ID BSTSDMTraits_HUDDataModel_BSTSingletonSDMOpStaticBuffer_HUDDataModel__{ 191688 };
+		inline constexpr REL::ID BSTSDMTraits_HUDScreenModel_BSTSingletonSDMOpStaticBuffer_HUDScreenModel__{ 138666 };
+		inline constexpr REL::ID BSTSDMTraits_HelpMessageManager_BSTSingletonSDMOpStaticBuffer_HelpMessageManager__{ 210508 };
+		inline constexpr REL::ID BSTSDMTraits_HolotapeDataManager_BSTSingletonSDMOpStaticBuffer_HolotapeDataManager__{ 1261455 };
+		inline constexpr REL::ID BSTSDMTraits_JobListManager__ServingThread_BSTSingletonSDMOpStaticBuffer_JobListManager__ServingThread__{ 1061493 };
+		inline constexpr REL::ID BSTSDMTraits_MenuControls_BSTSingletonSDMOpStaticBuffer_MenuControls__{ 1316162 };
+		inline constexpr REL::ID BSTSDMTraits_MenuCursor_BSTSingletonSDMOpStaticBuffer_MenuCursor__{ 158207 };
+		inline constexpr REL::ID BSTSDMTraits_MenuTopicManager_BSTSingletonSDMOpStaticBuffer_MenuTopicManager__{ 653645 };
+		inline constexpr REL::ID BSTSDMTraits_MovementAvoidanceManager_BSTSingletonSDMOpStaticBuffer_MovementAvoidanceManager__{ 1493807 };
+		inline constexpr REL::ID BSTSDMTraits_MultiActivateManager_BSTSingletonSDMOpStaticBuffer_MultiActivateManager__{ 466127 };
+		inline constexpr REL::ID BSTSDMTraits_NVFlex__DebrisInstanceManager_NVFlex__SingletonSDMOpShared_NVFlex__DebrisInstanceManager__{ 263317 };
+		inline constexpr REL::ID BSTSDMTraits_Pathing_BSTSingletonSDMOpStaticBuffer_Pathing__{ 1071467 };
+		inline constexpr REL::ID BSTSDMTraits_PipboyCompanionService_BSTSingletonSDMOpStaticBuffer_PipboyCompanionService__{ 490148 };
+		inline constexpr REL::ID BSTSDMTraits_PipboyManager_BSTSingletonSDMOpStaticBuffer_PipboyManager__{ 79904 };
+		inline constexpr REL::ID BSTSDMTraits_PlayerCamera_BSTSingletonSDMOpStaticBuffer_PlayerCamera__{ 1305208 };
+		inline constexpr REL::ID BSTSDMTraits_PlayerControls_BSTSingletonSDMOpStaticBuffer_PlayerControls__{ 282792 };
+		inline constexpr REL::ID BSTSDMTraits_PlayerRegionState_BSTSingletonSDMOpStaticBuffer_PlayerRegionState__{ 452068 };
+		inline constexpr REL::ID BSTSDMTraits_PowerArmorGeometry_BSTSingletonSDMOpStaticBuffer_PowerArmorGeometry__{ 522739 };
+		inline constexpr REL::ID BSTSDMTraits_ProcessLists_BSTSingletonSDMOpStaticBuffer_ProcessLists__{ 328520 };
+		inline constexpr REL::ID BSTSDMTraits_RagdollFurnitureModifier_BSTSingletonSDMOpStaticBuffer_RagdollFurnitureModifier__{ 907075 };
+		inline constexpr REL::ID BSTSDMTraits_StaticAvoidNodeManager_BSTSingletonSDMOpStaticBuffer_StaticAvoidNodeManager__{ 134559 };
+		inline constexpr REL::ID BSTSDMTraits_SynchronizedAnimationSingleton_BSTSingletonSDMOpStaticBuffer_SynchronizedAnimationSingleton__{ 995273 };
+		inline constexpr REL::ID BSTSDMTraits_TESAudio__ScriptedMusicState_BSTSingletonSDMOpStaticBuffer_TESAudio__ScriptedMusicState__{ 1440500 };
+		inline constexpr REL::ID BSTSDMTraits_UIBlurManager_BSTSingletonSDMOpStaticBuffer_UIBlurManager__{ 232523 };
+		inline constexpr REL::ID BSTSDMTraits_UISaveLoadManager_BSTSingletonSDMOpStaticBuffer_UISaveLoadManager__{ 1233185 };
+		inline constexpr REL::ID BSTSDMTraits_UI_BSTSingletonSDMOpStaticBuffer_UI__{ 1576811 };
+		inline constexpr REL::ID BSTSDMTraits_VATS_BSTSingletonSDMOpStaticBuffer_VATS__{ 135882 };
+		inline constexpr REL::ID BSTSDMTraits___AnimationFileListener_BSTSingletonSDMOpStaticBuffer___AnimationFileListener__{ 391495 };
+		inline constexpr REL::ID BSTSDMTraits___AnimationFileLookupSingletonHelper_BSTSingletonSDMOpStaticBuffer___AnimationFileLookupSingletonHelper__{ 287652 };
+		inline constexpr REL::ID BSTSDMTraits___ArchiveCacheEvent_BSTSingletonSDMOpStaticBuffer___ArchiveCacheEvent__{ 1401276 };
+		inline constexpr REL::ID BSTSDMTraits___BSRagdollDriverInterface_BSTSingletonSDMOpStaticBuffer___BSRagdollDriverInterface__{ 1478380 };
+		inline constexpr REL::ID BSTSDMTraits___BSScaleformAllocatorPaged_BSTSingletonSDMOpStaticBuffer___BSScaleformAllocatorPaged__{ 278792 };
+		inline constexpr REL::ID BSTSDMTraits___BehaviorGraphSpecificDataLookupSingleton_BSTSingletonSDMOpStaticBuffer___BehaviorGraphSpecificDataLookupSingleton__{ 147743 };
+		inline constexpr REL::ID BSTSDMTraits___ConsoleHotkeyManager_BSTSingletonSDMOpStaticBuffer___ConsoleHotkeyManager__{ 542743 };
+		inline constexpr REL::ID BSTSDMTraits___DDQueueCollection_BSTSingletonSDMOpStaticBuffer___DDQueueCollection__{ 565114 };
+		inline constexpr REL::ID BSTSDMTraits___HavokThreadMemorySink_BSTSingletonSDMOpStaticBuffer___HavokThreadMemorySink__{ 1222823 };
+		inline constexpr REL::ID BSTSDMTraits___Jobber_BSTSingletonSDMOpStaticBuffer___Jobber__{ 408813 };
+		inline constexpr REL::ID BSTSDMTraits___LooseAudioRegistrar_BSTSingletonSDMOpStaticBuffer___LooseAudioRegistrar__{ 367118 };
+		inline constexpr REL::ID BSTSDMTraits___MainCullingCamera_BSTSingletonSDMOpStaticBuffer___MainCullingCamera__{ 1430129 };
+		inline constexpr REL::ID BSTSDMTraits_bhkBipedOrientationController_BSTSingletonSDMOpStaticBuffer_bhkBipedOrientationController__{ 832777 };
+		inline constexpr REL::ID BSTSDMTraits_bhkCollisionFilter_BSTSingletonSDMOpStaticBuffer_bhkCollisionFilter__{ 1048191 };
+		inline constexpr REL::ID BSTSDMTraits_hknpBSMoveLimitModifier_BSTSingletonSDMOpStaticBuffer_hknpBSMoveLimitModifier__{ 806876 };
+		inline constexpr REL::ID BSTSDMTraits_hknpBSShapeCodec_BSTSingletonSDMOpStaticBuffer_hknpBSShapeCodec__{ 1185825 };
+		inline constexpr REL::ID BSTSDMTraits_hknpBackfaceCollisionModifier_BSTSingletonSDMOpStaticBuffer_hknpBackfaceCollisionModifier__{ 1385784 };
+		inline constexpr REL::ID BSTSingletonExplicit_BSModelDB__BSModelProcessor_{ 849855 };
+		inline constexpr REL::ID BSTSingletonExplicit_BSNavmeshInfoMap_{ 1499948 };
+		inline constexpr REL::ID BSTSingletonExplicit_BSPathingCellManager_{ 1351029 };
+		inline constexpr REL::ID BSTSingletonExplicit_BSPathing_{ 227031 };
+		inline constexpr REL::ID BSTSingletonExplicit_BSPrecomputedNavmeshInfoPathMap_{ 435257 };
+		inline constexpr REL::ID BSTSingletonExplicit_IDDQueueCollection_{ 679902 };
+		inline constexpr REL::ID BSTSingletonExplicit_IMemoryManagerFileFactory_{ 1109321 };
+		inline constexpr REL::ID BSTSingletonExplicit_IMovementAvoidanceManager_{ 17828 };
+		inline constexpr REL::ID BSTSingletonExplicit_IMovementFormIDManager_{ 580956 };
+		inline constexpr REL::ID BSTSingletonExplicit_IStaticAvoidNodeManager_{ 241612 };
+		inline constexpr REL::ID BSTSingletonExplicit_MovementManager_{ 1496858 };
+		inline constexpr REL::ID BSTSingletonExplicit_bhkCharacterCollisionHandler_{ 1109764 };
+		inline constexpr REL::ID BSTSingletonImplicit_BGSDefaultObjectManager_{ 1376903 };
+		inline constexpr REL::ID BSTSingletonImplicit_BGSObjectVisibilityManager_{ 653111 };
+		inline constexpr REL::ID BSTSingletonImplicit_BGSPlayerMusicChanger_{ 190406 };
+		inline constexpr REL::ID BSTSingletonImplicit_BSSystemFileStreamer__Streamer_{ 1195886 };
+		inline constexpr REL::ID BSTSingletonImplicit_GameScript____LatentPlayerMover_{ 829447 };
+		inline constexpr REL::ID BSTSingletonImplicit_MovementAgentNullTracker_IMovementHandlerAgent_MovementHandlerOutputDataSmallDelta__{ 969991 };
+		inline constexpr REL::ID BSTSingletonImplicit_MovementAgentNullTracker_IMovementHandlerAgent_MovementHandlerUpdateDataSmallDelta__{ 279097 };
+		inline constexpr REL::ID BSTSingletonImplicit_MovementAgentNullTracker_IMovementPlannerAgent_MovementPlannerAgentReturnDataSmallDelta__{ 577614 };
+		inline constexpr REL::ID BSTSingletonImplicit_MovementAgentNullTracker_IMovementTweenerAgent_MovementTweenerAgentOutputData__{ 566711 };
+		inline constexpr REL::ID BSTSingletonImplicit_MovementControllerNullDataTracker_{ 1208806 };
+		inline constexpr REL::ID BSTSingletonImplicit_MovementPathManagerNullTracker_{ 709295 };
+		inline constexpr REL::ID BSTSingletonImplicit_NavMeshObstacleCoverManager_{ 509468 };
+		inline constexpr REL::ID BSTSingletonImplicit_NullMovementState_{ 1477969 };
+		inline constexpr REL::ID BSTSingletonImplicit_NullPathBuilderTracker_{ 482343 };
+		inline constexpr REL::ID BSTSingletonImplicit___LogWriteThread_{ 702939 };
+		inline constexpr REL::ID BSTSingletonImplicit___ScriptFoundCallback_{ 1541758 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_ActorMediator_BSTSingletonSDMOpStaticBuffer_ActorMediator___{ 602137 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_AnimationClipDataSingleton_BSTSingletonSDMOpStaticBuffer_AnimationClipDataSingleton___{ 1575138 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_AnimationFileManagerSingleton_BSTSingletonSDMOpStaticBuffer_AnimationFileManagerSingleton___{ 1582800 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_AppResourceCaching____Manager_BSTSingletonSDMOpStaticBuffer_AppResourceCaching____Manager___{ 1466829 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSCombinedCellGeometryDB__CDX_BSTSingletonSDMOpStaticBuffer_BGSCombinedCellGeometryDB__CDX___{ 635556 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSFootIkRaycastInterfaceDB_BSTSingletonSDMOpStaticBuffer_BGSFootIkRaycastInterfaceDB___{ 414346 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSFootstepManager_BSTSingletonSDMOpStaticBuffer_BGSFootstepManager___{ 1355463 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSGamebryoSequenceGeneratorHolderSingleton_BSTSingletonSDMOpStaticBuffer_BGSGamebryoSequenceGeneratorHolderSingleton___{ 27362 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSImpactManager_BSTSingletonSDMOpStaticBuffer_BGSImpactManager___{ 155490 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSStoryManager_BSTSingletonSDMOpStaticBuffer_BGSStoryManager___{ 351686 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSStoryTeller_BSTSingletonSDMOpStaticBuffer_BGSStoryTeller___{ 562946 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BGSSynchronizedAnimationManager_BSTSingletonSDMOpStaticBuffer_BGSSynchronizedAnimationManager___{ 504762 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSAlignBoneModifierInterface_BSTSingletonSDMOpStaticBuffer_BSAlignBoneModifierInterface___{ 857917 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSBehaviorGraphSwapSingleton_BSTSingletonSDMOpStaticBuffer_BSBehaviorGraphSwapSingleton___{ 84593 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSCompanionAutodiscover_BSTSingletonSDMOpStaticBuffer_BSCompanionAutodiscover___{ 1372742 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSDirectAtModifierInterface_BSTSingletonSDMOpStaticBuffer_BSDirectAtModifierInterface___{ 372740 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSIdleInputWatcher_BSTSingletonSDMOpStaticBuffer_BSIdleInputWatcher___{ 468581 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSLimbIKModifierUtility_BSTSingletonSDMOpStaticBuffer_BSLimbIKModifierUtility___{ 435722 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSLookAtModifierInterface_BSTSingletonSDMOpStaticBuffer_BSLookAtModifierInterface___{ 298274 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSPassByTargetTriggerModifierInterface_BSTSingletonSDMOpStaticBuffer_BSPassByTargetTriggerModifierInterface___{ 691090 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSPathEventManager_BSTSingletonSDMOpStaticBuffer_BSPathEventManager___{ 1187424 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSPlatform__BSBethesdaPlatform_BSTSingletonSDMOpStaticBuffer_BSPlatform__BSBethesdaPlatform___{ 111467 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSRagdollContactListenerModifierInterface_BSTSingletonSDMOpStaticBuffer_BSRagdollContactListenerModifierInterface___{ 394120 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BGSBtoDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBtoDB__DBTraits____{ 1334487 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BGSBtrDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBtrDB__DBTraits____{ 547693 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BGSBttDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBttDB__DBTraits____{ 588937 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits____{ 1460999 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits____{ 545367 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits____{ 637804 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits____{ 396314 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits____{ 704159 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSMaterialDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSMaterialDB__DBTraits____{ 1496149 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSModelDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSModelDB__DBTraits____{ 1060033 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits____{ 349527 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits____{ 1049378 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BSTextureDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSTextureDB__DBTraits____{ 47920 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_BShkbHkxDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BShkbHkxDB__DBTraits____{ 1143608 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_LipSynchAnimDB__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_LipSynchAnimDB__DBTraits____{ 846966 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__EntryDB_ScaleformFile__DBTraits__BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_ScaleformFile__DBTraits____{ 1073748 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource__SDirectory2__ThreadCursor_BSTSingletonSDMOpStaticBuffer_BSResource__SDirectory2__ThreadCursor___{ 1417296 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource____DefaultLocationData_BSTSingletonSDMOpStaticBuffer_BSResource____DefaultLocationData___{ 1397487 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource____DevNull_BSTSingletonSDMOpStaticBuffer_BSResource____DevNull___{ 1494286 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource____EventSources_BSTSingletonSDMOpStaticBuffer_BSResource____EventSources___{ 934419 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource____GlobalLocations_BSTSingletonSDMOpStaticBuffer_BSResource____GlobalLocations___{ 325948 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSResource____GlobalPaths_BSTSingletonSDMOpStaticBuffer_BSResource____GlobalPaths___{ 644186 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSScaleformManager_BSTSingletonSDMOpStaticBuffer_BSScaleformManager___{ 413133 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSStateMachineCallbackSingleton_BSTSingletonSDMOpStaticBuffer_BSStateMachineCallbackSingleton___{ 1502108 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSStaticTriShapeDB__Manager_BSTSingletonSDMOpStaticBuffer_BSStaticTriShapeDB__Manager___{ 662854 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent_BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent___{ 642582 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_AnimationDataCleanupEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AnimationDataCleanupEvent____{ 690741 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_AnimationDataSetupEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AnimationDataSetupEvent____{ 1170424 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ApplyColorUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ApplyColorUpdateEvent____{ 229973 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent____{ 1547921 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BGSAppPausedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BGSAppPausedEvent____{ 1275030 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent_____{ 1082052 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent_____{ 1115381 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage_____{ 385254 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective_____{ 587897 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled_____{ 201730 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent_____{ 1296762 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent_____{ 46613 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount_____{ 744300 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude_____{ 709388 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal_____{ 777672 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent_____{ 714282 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent_____{ 498334 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent_____{ 13290 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent_____{ 822506 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState_____{ 1434192 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent_____{ 1418283 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent_____{ 123801 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent_____{ 379219 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent_____{ 113635 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent_____{ 1219264 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent_____{ 1494644 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName_____{ 1526007 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent_____{ 1482961 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime_____{ 291657 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent_____{ 858731 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent_____{ 1560963 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent_____{ 37030 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent_____{ 786083 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent_____{ 730899 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent_____{ 500856 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent_____{ 151122 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP_____{ 640098 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent_____{ 1219894 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent_____{ 11658 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent_____{ 615104 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent_____{ 823706 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent_____{ 455017 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent_____{ 396205 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent_____{ 37682 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent_____{ 715647 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent_____{ 712649 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent_____{ 1157039 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent_____{ 263871 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate_____{ 1207731 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent_____{ 1077169 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent_____{ 1033807 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim_____{ 580331 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent_____{ 590929 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent_____{ 549198 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent_____{ 1213947 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState_____{ 181285 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim_____{ 410285 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent_____{ 360288 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent_____{ 1098086 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent_____{ 1223651 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent___BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent_____{ 1442591 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent____{ 1296467 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent____{ 1468834 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_BlurEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BlurEvent____{ 31768 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent____{ 649830 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage____{ 1025807 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective____{ 895018 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ClearHUDMessagesEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ClearHUDMessagesEvent____{ 827171 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ClearQuickContainerEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ClearQuickContainerEvent____{ 445275 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ColorUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ColorUpdateEvent____{ 917495 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_CompanionMenuEnabled__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CompanionMenuEnabled____{ 635715 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ConditionBoyEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ConditionBoyEvent____{ 284767 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ControlsRemappedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ControlsRemappedEvent____{ 88098 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_CurrentRadiationSourceCount__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadiationSourceCount____{ 343448 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude____{ 308307 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal____{ 1520648 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent____{ 47148 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent____{ 805880 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent____{ 561476 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_EndLoadGameEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_EndLoadGameEvent____{ 181799 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent____{ 1464650 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent____{ 1299379 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_FaderMenuDisplayState__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_FaderMenuDisplayState____{ 1337890 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDCommmandModeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDCommmandModeEvent____{ 845258 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent____{ 430766 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent____{ 1435858 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData____{ 1415095 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent____{ 822727 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent____{ 686862 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDModeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDModeEvent____{ 50206 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent____{ 198052 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDNotificationEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDNotificationEvent____{ 517254 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent____{ 239147 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDPerkVaultBoyData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDPerkVaultBoyData____{ 1543335 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent____{ 923942 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName____{ 689889 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDReinitializedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDReinitializedEvent____{ 1524104 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDRolloverIsCrime__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDRolloverIsCrime____{ 772112 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDRolloverStateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDRolloverStateEvent____{ 900043 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent____{ 282632 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HUDTutorialTextEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDTutorialTextEvent____{ 452886 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_HasHUDMessagesEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HasHUDMessagesEvent____{ 107285 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_InventoryUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_InventoryUpdateEvent____{ 1210801 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_IsPipboyActiveEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_IsPipboyActiveEvent____{ 980724 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent____{ 1147626 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent____{ 1163071 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ObjectivesInWayOfXP__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ObjectivesInWayOfXP____{ 66662 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_OpenContainerMenuEventData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_OpenContainerMenuEventData____{ 109539 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PerkPointIncreaseEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PerkPointIncreaseEvent____{ 153458 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PickRefStateChangedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PickRefStateChangedEvent____{ 1328292 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PipboyLightEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PipboyLightEvent____{ 956707 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent____{ 922114 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent____{ 861781 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerAmmoCountEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerAmmoCountEvent____{ 935275 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent____{ 963413 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerCommandTypeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerCommandTypeEvent____{ 1386131 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent____{ 1461391 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent____{ 1019361 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerUpdateEvent____{ 449529 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent____{ 320713 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_PowerArmorLightData__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PowerArmorLightData____{ 492004 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage____{ 704017 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_QuickContainerStateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QuickContainerStateEvent____{ 568227 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate____{ 506980 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_RequestHUDModesEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RequestHUDModesEvent____{ 1144820 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent____{ 1397369 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_RolloverSuppressedEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RolloverSuppressedEvent____{ 366322 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent____{ 509573 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent____{ 602682 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowHUDMessageEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowHUDMessageEvent____{ 781640 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim____{ 715151 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingExperienceEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingExperienceEvent____{ 156756 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent____{ 1122129 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent____{ 377405 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState____{ 1532650 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingVATSCritAnim__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingVATSCritAnim____{ 890534 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent____{ 1106405 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent____{ 273286 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_VATSCommandTargetEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_VATSCommandTargetEvent____{ 700983 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent____{ 1357681 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTGlobalEvent__EventSource_ViewCasterUpdateEvent__BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ViewCasterUpdateEvent____{ 1307986 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy__BSTSingletonSDMOpStaticBuffer_BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy____{ 444307 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy__BSTSingletonSDMOpStaticBuffer_BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy____{ 1338658 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSTextureStreamer__Manager_BSTSingletonSDMOpStaticBuffer_BSTextureStreamer__Manager___{ 1161071 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSThreadEvent____Source_BSTSingletonSDMOpStaticBuffer_BSThreadEvent____Source___{ 1398845 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_BSiStateTaggingListenerSingleton_BSTSingletonSDMOpStaticBuffer_BSiStateTaggingListenerSingleton___{ 1197665 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CharacterCollisionHandler_BSTSingletonSDMOpStaticBuffer_CharacterCollisionHandler___{ 1361758 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 1523585 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 306335 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 396363 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 1035531 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 500345 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 1374846 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 398178 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 1452891 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy____{ 274533 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 1127369 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy____{ 1251472 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy____{ 1060070 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy____{ 522096 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_DynamicIdleDataSingletonHelper_BSTSingletonSDMOpStaticBuffer_DynamicIdleDataSingletonHelper___{ 289708 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_FOCollisionListener_BSTSingletonSDMOpStaticBuffer_FOCollisionListener___{ 710315 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_FavoritesManager_BSTSingletonSDMOpStaticBuffer_FavoritesManager___{ 1043884 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_FlatScreenModel_BSTSingletonSDMOpStaticBuffer_FlatScreenModel___{ 1271520 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__BasicEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__BasicEventHandler___{ 1524342 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__CombatEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__CombatEventHandler___{ 810541 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__CustomEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__CustomEventHandler___{ 104224 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__DistanceEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__DistanceEventHandler___{ 1111491 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__FragmentEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__FragmentEventHandler___{ 1267576 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__InventoryEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__InventoryEventHandler___{ 1255439 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__LOSEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__LOSEventHandler___{ 81373 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__MenuEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__MenuEventHandler___{ 409879 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__PathingCallbackMgr_BSTSingletonSDMOpStaticBuffer_GameScript__PathingCallbackMgr___{ 766507 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__QuestCallbackMgr_BSTSingletonSDMOpStaticBuffer_GameScript__QuestCallbackMgr___{ 804716 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__SleepEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__SleepEventHandler___{ 1029129 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__SoundCallbackMgr_BSTSingletonSDMOpStaticBuffer_GameScript__SoundCallbackMgr___{ 535648 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__TeleportEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__TeleportEventHandler___{ 865119 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__TimerEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__TimerEventHandler___{ 917236 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__TrackedStatsEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__TrackedStatsEventHandler___{ 382181 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameScript__WaitEventHandler_BSTSingletonSDMOpStaticBuffer_GameScript__WaitEventHandler___{ 403603 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameUIModel_BSTSingletonSDMOpStaticBuffer_GameUIModel___{ 1483493 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_GameVM_BSTSingletonSDMOpStaticBuffer_GameVM___{ 560330 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_HUDDataModel_BSTSingletonSDMOpStaticBuffer_HUDDataModel___{ 1427913 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_HUDScreenModel_BSTSingletonSDMOpStaticBuffer_HUDScreenModel___{ 936661 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_HelpMessageManager_BSTSingletonSDMOpStaticBuffer_HelpMessageManager___{ 1008223 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_HolotapeDataManager_BSTSingletonSDMOpStaticBuffer_HolotapeDataManager___{ 477029 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_JobListManager__ServingThread_BSTSingletonSDMOpStaticBuffer_JobListManager__ServingThread___{ 1420546 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_MenuControls_BSTSingletonSDMOpStaticBuffer_MenuControls___{ 970626 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_MenuCursor_BSTSingletonSDMOpStaticBuffer_MenuCursor___{ 1394564 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_MenuTopicManager_BSTSingletonSDMOpStaticBuffer_MenuTopicManager___{ 1451457 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_MovementAvoidanceManager_BSTSingletonSDMOpStaticBuffer_MovementAvoidanceManager___{ 270615 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_MultiActivateManager_BSTSingletonSDMOpStaticBuffer_MultiActivateManager___{ 1264461 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_NVFlex__DebrisInstanceManager_NVFlex__SingletonSDMOpShared_NVFlex__DebrisInstanceManager___{ 622635 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_Pathing_BSTSingletonSDMOpStaticBuffer_Pathing___{ 726374 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_PipboyCompanionService_BSTSingletonSDMOpStaticBuffer_PipboyCompanionService___{ 849503 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_PipboyManager_BSTSingletonSDMOpStaticBuffer_PipboyManager___{ 877752 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_PlayerCamera_BSTSingletonSDMOpStaticBuffer_PlayerCamera___{ 959790 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_PlayerControls_BSTSingletonSDMOpStaticBuffer_PlayerControls___{ 1080781 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_PlayerRegionState_BSTSingletonSDMOpStaticBuffer_PlayerRegionState___{ 1250530 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_PowerArmorGeometry_BSTSingletonSDMOpStaticBuffer_PowerArmorGeometry___{ 1320559 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_ProcessLists_BSTSingletonSDMOpStaticBuffer_ProcessLists___{ 1565573 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_RagdollFurnitureModifier_BSTSingletonSDMOpStaticBuffer_RagdollFurnitureModifier___{ 1266363 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_StaticAvoidNodeManager_BSTSingletonSDMOpStaticBuffer_StaticAvoidNodeManager___{ 493669 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_SynchronizedAnimationSingleton_BSTSingletonSDMOpStaticBuffer_SynchronizedAnimationSingleton___{ 915949 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_TESAudio__ScriptedMusicState_BSTSingletonSDMOpStaticBuffer_TESAudio__ScriptedMusicState___{ 217689 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_UIBlurManager_BSTSingletonSDMOpStaticBuffer_UIBlurManager___{ 1030278 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_UISaveLoadManager_BSTSingletonSDMOpStaticBuffer_UISaveLoadManager___{ 448600 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_UI_BSTSingletonSDMOpStaticBuffer_UI___{ 87698 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_VATS_BSTSingletonSDMOpStaticBuffer_VATS___{ 229266 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___AnimationFileListener_BSTSingletonSDMOpStaticBuffer___AnimationFileListener___{ 312038 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___AnimationFileLookupSingletonHelper_BSTSingletonSDMOpStaticBuffer___AnimationFileLookupSingletonHelper___{ 913092 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___ArchiveCacheEvent_BSTSingletonSDMOpStaticBuffer___ArchiveCacheEvent___{ 1321761 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___BSRagdollDriverInterface_BSTSingletonSDMOpStaticBuffer___BSRagdollDriverInterface___{ 959781 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___BSScaleformAllocatorPaged_BSTSingletonSDMOpStaticBuffer___BSScaleformAllocatorPaged___{ 1342639 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___BehaviorGraphSpecificDataLookupSingleton_BSTSingletonSDMOpStaticBuffer___BehaviorGraphSpecificDataLookupSingleton___{ 334224 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___ConsoleHotkeyManager_BSTSingletonSDMOpStaticBuffer___ConsoleHotkeyManager___{ 462652 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___DDQueueCollection_BSTSingletonSDMOpStaticBuffer___DDQueueCollection___{ 485452 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___HavokThreadMemorySink_BSTSingletonSDMOpStaticBuffer___HavokThreadMemorySink___{ 1143025 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___Jobber_BSTSingletonSDMOpStaticBuffer___Jobber___{ 1207176 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___LooseAudioRegistrar_BSTSingletonSDMOpStaticBuffer___LooseAudioRegistrar___{ 287534 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits___MainCullingCamera_BSTSingletonSDMOpStaticBuffer___MainCullingCamera___{ 1350623 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_bhkBipedOrientationController_BSTSingletonSDMOpStaticBuffer_bhkBipedOrientationController___{ 753591 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_bhkCollisionFilter_BSTSingletonSDMOpStaticBuffer_bhkCollisionFilter___{ 263992 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_hknpBSMoveLimitModifier_BSTSingletonSDMOpStaticBuffer_hknpBSMoveLimitModifier___{ 1165974 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_hknpBSShapeCodec_BSTSingletonSDMOpStaticBuffer_hknpBSShapeCodec___{ 401317 };
+		inline constexpr REL::ID BSTSingletonSDMBase_BSTSDMTraits_hknpBackfaceCollisionModifier_BSTSingletonSDMOpStaticBuffer_hknpBackfaceCollisionModifier___{ 1306419 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_ActorMediator_{ 1292991 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_AnimationClipDataSingleton_{ 417492 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_AnimationFileManagerSingleton_{ 863970 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_AppResourceCaching____Manager_{ 43316 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSCombinedCellGeometryDB__CDX_{ 1499478 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSFootIkRaycastInterfaceDB_{ 839554 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSFootstepManager_{ 903247 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSGamebryoSequenceGeneratorHolderSingleton_{ 625719 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSImpactManager_{ 846288 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSStoryManager_{ 1042767 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSStoryTeller_{ 1253873 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BGSSynchronizedAnimationManager_{ 1368246 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSAlignBoneModifierInterface_{ 1282901 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSBehaviorGraphSwapSingleton_{ 509531 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSCompanionAutodiscover_{ 1358965 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSDirectAtModifierInterface_{ 798003 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSIdleInputWatcher_{ 15819 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSLimbIKModifierUtility_{ 422090 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSLookAtModifierInterface_{ 723813 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSPassByTargetTriggerModifierInterface_{ 849738 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSPathEventManager_{ 735196 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSPlatform__BSBethesdaPlatform_{ 975059 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSRagdollContactListenerModifierInterface_{ 991683 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBtoDB__DBTraits__{ 350026 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBtrDB__DBTraits__{ 1145070 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSBttDB__DBTraits__{ 1186503 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits__{ 649262 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits__{ 610999 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits__{ 1407903 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits__{ 1432671 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits__{ 158067 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSMaterialDB__DBTraits__{ 950058 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSModelDB__DBTraits__{ 75674 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits__{ 1559117 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits__{ 942314 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BSTextureDB__DBTraits__{ 646045 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_BShkbHkxDB__DBTraits__{ 159288 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_LipSynchAnimDB__DBTraits__{ 301145 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__EntryDB_ScaleformFile__DBTraits__{ 528124 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource__SDirectory2__ThreadCursor_{ 1137672 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource____DefaultLocationData_{ 412978 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource____DevNull_{ 775703 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource____EventSources_{ 655001 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource____GlobalLocations_{ 484970 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSResource____GlobalPaths_{ 364097 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSScaleformManager_{ 1543175 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSStateMachineCallbackSingleton_{ 783454 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSStaticTriShapeDB__Manager_{ 1087578 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent_{ 1333145 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AnimationDataCleanupEvent__{ 1461057 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AnimationDataSetupEvent__{ 1502566 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ApplyColorUpdateEvent__{ 561762 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent__{ 736383 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BGSAppPausedEvent__{ 1168008 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent___{ 1320465 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent___{ 1353750 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage___{ 623987 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective___{ 826213 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled___{ 696 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent___{ 658130 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent___{ 1428596 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount___{ 1421063 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude___{ 1385897 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal___{ 1015826 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent___{ 247571 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent___{ 737230 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent___{ 691295 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent___{ 1500106 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState___{ 1234259 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent___{ 1218542 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent___{ 362126 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent___{ 617859 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent___{ 791172 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent___{ 1457544 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent___{ 589529 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName___{ 182239 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent___{ 1282305 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime___{ 1235251 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent___{ 658810 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent___{ 217033 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent___{ 1419040 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent___{ 585828 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent___{ 530414 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent___{ 300533 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent___{ 828275 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP___{ 439380 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent___{ 1458210 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent___{ 955405 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent___{ 853401 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent___{ 1501301 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent___{ 255095 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent___{ 634987 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent___{ 1419663 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent___{ 953758 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent___{ 950706 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent___{ 1395274 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent___{ 502287 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate___{ 741554 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent___{ 1315621 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent___{ 1272423 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim___{ 113859 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent___{ 390330 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent___{ 82791 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent___{ 1452245 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState___{ 419411 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim___{ 210351 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent___{ 599072 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent___{ 897792 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent___{ 757426 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent___{ 1242508 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent__{ 484770 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent__{ 218217 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_BlurEvent__{ 630157 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent__{ 981175 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage__{ 1357453 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective__{ 83231 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ClearHUDMessagesEvent__{ 1158888 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ClearQuickContainerEvent__{ 777574 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ColorUpdateEvent__{ 371746 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CompanionMenuEnabled__{ 528596 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ConditionBoyEvent__{ 178029 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ControlsRemappedEvent__{ 419644 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadiationSourceCount__{ 1114001 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude__{ 1078804 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal__{ 709172 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent__{ 113026 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent__{ 1576354 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent__{ 188574 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_EndLoadGameEvent__{ 1218395 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent__{ 652988 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent__{ 926354 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_FaderMenuDisplayState__{ 87657 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDCommmandModeEvent__{ 738551 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent__{ 1201677 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent__{ 185774 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData__{ 603641 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent__{ 449378 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent__{ 1457107 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDModeEvent__{ 648235 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent__{ 968266 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDNotificationEvent__{ 410066 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent__{ 571060 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDPerkVaultBoyData__{ 1436078 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent__{ 551329 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName__{ 1021193 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDReinitializedEvent__{ 273433 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDRolloverIsCrime__{ 665100 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDRolloverStateEvent__{ 1231905 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent__{ 614589 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HUDTutorialTextEvent__{ 346000 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_HasHUDMessagesEvent__{ 1582614 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_InventoryUpdateEvent__{ 1103536 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_IsPipboyActiveEvent__{ 873817 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent__{ 335954 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent__{ 790211 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ObjectivesInWayOfXP__{ 1541935 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_OpenContainerMenuEventData__{ 879874 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PerkPointIncreaseEvent__{ 485007 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PickRefStateChangedEvent__{ 78040 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PipboyLightEvent__{ 410736 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent__{ 110462 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent__{ 49974 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerAmmoCountEvent__{ 828343 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent__{ 1295109 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerCommandTypeEvent__{ 135798 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent__{ 210871 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent__{ 207858 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerUpdateEvent__{ 342724 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent__{ 652746 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_PowerArmorLightData__{ 385055 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage__{ 1474316 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QuickContainerStateEvent__{ 899827 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate__{ 572867 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RequestHUDModesEvent__{ 1037759 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent__{ 586045 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_RolloverSuppressedEvent__{ 698615 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent__{ 1280086 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent__{ 934300 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowHUDMessageEvent__{ 674725 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim__{ 780688 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingExperienceEvent__{ 488246 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent__{ 749523 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent__{ 709676 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState__{ 281957 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingVATSCritAnim__{ 783716 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent__{ 1438089 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent__{ 338877 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_VATSCommandTargetEvent__{ 1032110 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent__{ 1423496 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTGlobalEvent__EventSource_ViewCasterUpdateEvent__{ 57503 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy__{ 1533190 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy__{ 765832 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSTextureStreamer__Manager_{ 3162 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSThreadEvent____Source_{ 1119255 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_BSiStateTaggingListenerSingleton_{ 478888 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CharacterCollisionHandler_{ 204920 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 259084 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 1063125 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 182636 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 649075 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 113600 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 549813 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 11015 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 361111 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__{ 1470170 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 301868 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__{ 425621 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__{ 1551005 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy__{ 135307 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_DynamicIdleDataSingletonHelper_{ 1153579 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_FOCollisionListener_{ 257350 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_FavoritesManager_{ 152895 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_FlatScreenModel_{ 380146 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__BasicEventHandler_{ 366794 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__CombatEventHandler_{ 91858 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__CustomEventHandler_{ 967858 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__DistanceEventHandler_{ 392889 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__FragmentEventHandler_{ 549227 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__InventoryEventHandler_{ 537087 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__LOSEventHandler_{ 506354 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__MenuEventHandler_{ 835102 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__PathingCallbackMgr_{ 47596 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__QuestCallbackMgr_{ 1229626 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__SleepEventHandler_{ 1454368 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__SoundCallbackMgr_{ 960462 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__TeleportEventHandler_{ 146860 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__TimerEventHandler_{ 1342099 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__TrackedStatsEventHandler_{ 102524 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameScript__WaitEventHandler_{ 828722 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameUIModel_{ 153302 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_GameVM_{ 373650 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_HUDDataModel_{ 98072 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_HUDScreenModel_{ 45291 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_HelpMessageManager_{ 556052 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_HolotapeDataManager_{ 24168 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_JobListManager__ServingThread_{ 263598 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_MenuControls_{ 1223240 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_MenuCursor_{ 64799 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_MenuTopicManager_{ 560227 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_MovementAvoidanceManager_{ 256787 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_MultiActivateManager_{ 812045 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_Pathing_{ 539698 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_PipboyCompanionService_{ 835794 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_PipboyManager_{ 1569090 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_PlayerCamera_{ 1212320 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_PlayerControls_{ 189893 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_PlayerRegionState_{ 798069 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_PowerArmorGeometry_{ 867964 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_ProcessLists_{ 235420 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_RagdollFurnitureModifier_{ 1252670 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_StaticAvoidNodeManager_{ 480006 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_SynchronizedAnimationSingleton_{ 197686 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_TESAudio__ScriptedMusicState_{ 642842 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_UIBlurManager_{ 139127 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_UISaveLoadManager_{ 1578732 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_UI_{ 825322 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_VATS_{ 966695 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___AnimationFileListener_{ 31922 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___AnimationFileLookupSingletonHelper_{ 367224 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___ArchiveCacheEvent_{ 603495 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___BSRagdollDriverInterface_{ 1118705 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___BSScaleformAllocatorPaged_{ 1502200 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___BehaviorGraphSpecificDataLookupSingleton_{ 666171 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___ConsoleHotkeyManager_{ 183452 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___DDQueueCollection_{ 1348991 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___HavokThreadMemorySink_{ 863188 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___Jobber_{ 754753 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___LooseAudioRegistrar_{ 1151409 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer___MainCullingCamera_{ 632526 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_bhkBipedOrientationController_{ 34489 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_bhkCollisionFilter_{ 1393460 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_hknpBSMoveLimitModifier_{ 1152105 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_hknpBSShapeCodec_{ 1092473 };
+		inline constexpr REL::ID BSTSingletonSDMOpStaticBuffer_hknpBackfaceCollisionModifier_{ 588231 };
+		inline constexpr REL::ID BSTSingletonSDM_ActorMediator_BSTSingletonSDMOpStaticBuffer_{ 1133930 };
+		inline constexpr REL::ID BSTSingletonSDM_AnimationClipDataSingleton_BSTSingletonSDMOpStaticBuffer_{ 85994 };
+		inline constexpr REL::ID BSTSingletonSDM_AnimationFileManagerSingleton_BSTSingletonSDMOpStaticBuffer_{ 93637 };
+		inline constexpr REL::ID BSTSingletonSDM_AppResourceCaching____Manager_BSTSingletonSDMOpStaticBuffer_{ 1121118 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSCombinedCellGeometryDB__CDX_BSTSingletonSDMOpStaticBuffer_{ 728926 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSFootIkRaycastInterfaceDB_BSTSingletonSDMOpStaticBuffer_{ 507753 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSFootstepManager_BSTSingletonSDMOpStaticBuffer_{ 305424 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSGamebryoSequenceGeneratorHolderSingleton_BSTSingletonSDMOpStaticBuffer_{ 1264605 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSImpactManager_BSTSingletonSDMOpStaticBuffer_{ 687649 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSStoryManager_BSTSingletonSDMOpStaticBuffer_{ 883769 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSStoryTeller_BSTSingletonSDMOpStaticBuffer_{ 1094828 };
+		inline constexpr REL::ID BSTSingletonSDM_BGSSynchronizedAnimationManager_BSTSingletonSDMOpStaticBuffer_{ 598209 };
+		inline constexpr REL::ID BSTSingletonSDM_BSAlignBoneModifierInterface_BSTSingletonSDMOpStaticBuffer_{ 951234 };
+		inline constexpr REL::ID BSTSingletonSDM_BSBehaviorGraphSwapSingleton_BSTSingletonSDMOpStaticBuffer_{ 177997 };
+		inline constexpr REL::ID BSTSingletonSDM_BSCompanionAutodiscover_BSTSingletonSDMOpStaticBuffer_{ 1466352 };
+		inline constexpr REL::ID BSTSingletonSDM_BSDirectAtModifierInterface_BSTSingletonSDMOpStaticBuffer_{ 465749 };
+		inline constexpr REL::ID BSTSingletonSDM_BSIdleInputWatcher_BSTSingletonSDMOpStaticBuffer_{ 1000648 };
+		inline constexpr REL::ID BSTSingletonSDM_BSLimbIKModifierUtility_BSTSingletonSDMOpStaticBuffer_{ 529337 };
+		inline constexpr REL::ID BSTSingletonSDM_BSLookAtModifierInterface_BSTSingletonSDMOpStaticBuffer_{ 391599 };
+		inline constexpr REL::ID BSTSingletonSDM_BSPassByTargetTriggerModifierInterface_BSTSingletonSDMOpStaticBuffer_{ 345154 };
+		inline constexpr REL::ID BSTSingletonSDM_BSPathEventManager_BSTSingletonSDMOpStaticBuffer_{ 137111 };
+		inline constexpr REL::ID BSTSingletonSDM_BSPlatform__BSBethesdaPlatform_BSTSingletonSDMOpStaticBuffer_{ 204894 };
+		inline constexpr REL::ID BSTSingletonSDM_BSRagdollContactListenerModifierInterface_BSTSingletonSDMOpStaticBuffer_{ 48570 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BGSBtoDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 988939 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BGSBtrDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 202090 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BGSBttDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 243180 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 676934 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 1342928 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 1435470 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSFaceGenDB__FG__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 50810 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 357996 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSMaterialDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 1150199 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSModelDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 715044 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 1147616 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 704367 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BSTextureDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 1284843 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_BShkbHkxDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 798382 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_LipSynchAnimDB__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 501498 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__EntryDB_ScaleformFile__DBTraits__BSTSingletonSDMOpStaticBuffer_{ 728643 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource__SDirectory2__ThreadCursor_BSTSingletonSDMOpStaticBuffer_{ 1511015 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource____DefaultLocationData_BSTSingletonSDMOpStaticBuffer_{ 1052168 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource____DevNull_BSTSingletonSDMOpStaticBuffer_{ 4350 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource____EventSources_BSTSingletonSDMOpStaticBuffer_{ 1027560 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource____GlobalLocations_BSTSingletonSDMOpStaticBuffer_{ 1563028 };
+		inline constexpr REL::ID BSTSingletonSDM_BSResource____GlobalPaths_BSTSingletonSDMOpStaticBuffer_{ 737538 };
+		inline constexpr REL::ID BSTSingletonSDM_BSScaleformManager_BSTSingletonSDMOpStaticBuffer_{ 945282 };
+		inline constexpr REL::ID BSTSingletonSDM_BSStateMachineCallbackSingleton_BSTSingletonSDMOpStaticBuffer_{ 12253 };
+		inline constexpr REL::ID BSTSingletonSDM_BSStaticTriShapeDB__Manager_BSTSingletonSDMOpStaticBuffer_{ 756147 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent_BSTSingletonSDMOpStaticBuffer_{ 1174377 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_AnimationDataCleanupEvent__BSTSingletonSDMOpStaticBuffer_{ 1488715 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_AnimationDataSetupEvent__BSTSingletonSDMOpStaticBuffer_{ 386111 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ApplyColorUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 1027713 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent__BSTSingletonSDMOpStaticBuffer_{ 763789 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BGSAppPausedEvent__BSTSingletonSDMOpStaticBuffer_{ 929432 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent___BSTSingletonSDMOpStaticBuffer_{ 1441276 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent___BSTSingletonSDMOpStaticBuffer_{ 1475012 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage___BSTSingletonSDMOpStaticBuffer_{ 744807 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective___BSTSingletonSDMOpStaticBuffer_{ 946887 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled___BSTSingletonSDMOpStaticBuffer_{ 560983 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent___BSTSingletonSDMOpStaticBuffer_{ 73910 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent___BSTSingletonSDMOpStaticBuffer_{ 405917 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount___BSTSingletonSDMOpStaticBuffer_{ 664800 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude___BSTSingletonSDMOpStaticBuffer_{ 629592 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal___BSTSingletonSDMOpStaticBuffer_{ 1136572 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent___BSTSingletonSDMOpStaticBuffer_{ 634542 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent___BSTSingletonSDMOpStaticBuffer_{ 857640 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent___BSTSingletonSDMOpStaticBuffer_{ 1516707 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent___BSTSingletonSDMOpStaticBuffer_{ 743222 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState___BSTSingletonSDMOpStaticBuffer_{ 211538 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent___BSTSingletonSDMOpStaticBuffer_{ 195786 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent___BSTSingletonSDMOpStaticBuffer_{ 482976 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent___BSTSingletonSDMOpStaticBuffer_{ 738829 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent___BSTSingletonSDMOpStaticBuffer_{ 33904 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent___BSTSingletonSDMOpStaticBuffer_{ 1578364 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent___BSTSingletonSDMOpStaticBuffer_{ 1414582 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName___BSTSingletonSDMOpStaticBuffer_{ 302690 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent___BSTSingletonSDMOpStaticBuffer_{ 259595 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime___BSTSingletonSDMOpStaticBuffer_{ 651333 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent___BSTSingletonSDMOpStaticBuffer_{ 1218324 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent___BSTSingletonSDMOpStaticBuffer_{ 337655 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent___BSTSingletonSDMOpStaticBuffer_{ 396400 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent___BSTSingletonSDMOpStaticBuffer_{ 1145005 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent___BSTSingletonSDMOpStaticBuffer_{ 1089729 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent___BSTSingletonSDMOpStaticBuffer_{ 860105 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent___BSTSingletonSDMOpStaticBuffer_{ 71560 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP___BSTSingletonSDMOpStaticBuffer_{ 998911 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent___BSTSingletonSDMOpStaticBuffer_{ 1579024 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent___BSTSingletonSDMOpStaticBuffer_{ 371321 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent___BSTSingletonSDMOpStaticBuffer_{ 974018 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent___BSTSingletonSDMOpStaticBuffer_{ 744373 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent___BSTSingletonSDMOpStaticBuffer_{ 814666 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent___BSTSingletonSDMOpStaticBuffer_{ 755805 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent___BSTSingletonSDMOpStaticBuffer_{ 397073 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent___BSTSingletonSDMOpStaticBuffer_{ 1074434 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent___BSTSingletonSDMOpStaticBuffer_{ 1071397 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent___BSTSingletonSDMOpStaticBuffer_{ 1516507 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent___BSTSingletonSDMOpStaticBuffer_{ 623200 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate___BSTSingletonSDMOpStaticBuffer_{ 1127886 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent___BSTSingletonSDMOpStaticBuffer_{ 1436297 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent___BSTSingletonSDMOpStaticBuffer_{ 1392895 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim___BSTSingletonSDMOpStaticBuffer_{ 500615 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent___BSTSingletonSDMOpStaticBuffer_{ 949941 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent___BSTSingletonSDMOpStaticBuffer_{ 469239 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent___BSTSingletonSDMOpStaticBuffer_{ 1573138 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState___BSTSingletonSDMOpStaticBuffer_{ 540517 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim___BSTSingletonSDMOpStaticBuffer_{ 769889 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent___BSTSingletonSDMOpStaticBuffer_{ 720120 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent___BSTSingletonSDMOpStaticBuffer_{ 1457321 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent___BSTSingletonSDMOpStaticBuffer_{ 1143856 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent___BSTSingletonSDMOpStaticBuffer_{ 219678 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent__BSTSingletonSDMOpStaticBuffer_{ 512291 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent__BSTSingletonSDMOpStaticBuffer_{ 684728 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_BlurEvent__BSTSingletonSDMOpStaticBuffer_{ 1268975 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 1447664 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage__BSTSingletonSDMOpStaticBuffer_{ 241747 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective__BSTSingletonSDMOpStaticBuffer_{ 110677 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ClearHUDMessagesEvent__BSTSingletonSDMOpStaticBuffer_{ 42698 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ClearQuickContainerEvent__BSTSingletonSDMOpStaticBuffer_{ 1243744 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ColorUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 572209 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_CompanionMenuEnabled__BSTSingletonSDMOpStaticBuffer_{ 289816 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ConditionBoyEvent__BSTSingletonSDMOpStaticBuffer_{ 1521822 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ControlsRemappedEvent__BSTSingletonSDMOpStaticBuffer_{ 886053 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_CurrentRadiationSourceCount__BSTSingletonSDMOpStaticBuffer_{ 1141516 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude__BSTSingletonSDMOpStaticBuffer_{ 1106331 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal__BSTSingletonSDMOpStaticBuffer_{ 736495 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent__BSTSingletonSDMOpStaticBuffer_{ 845324 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent__BSTSingletonSDMOpStaticBuffer_{ 20957 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent__BSTSingletonSDMOpStaticBuffer_{ 1359073 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_EndLoadGameEvent__BSTSingletonSDMOpStaticBuffer_{ 1418134 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent__BSTSingletonSDMOpStaticBuffer_{ 680716 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent__BSTSingletonSDMOpStaticBuffer_{ 515148 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_FaderMenuDisplayState__BSTSingletonSDMOpStaticBuffer_{ 554085 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDCommmandModeEvent__BSTSingletonSDMOpStaticBuffer_{ 499642 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent__BSTSingletonSDMOpStaticBuffer_{ 1229144 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 651968 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData__BSTSingletonSDMOpStaticBuffer_{ 631326 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent__BSTSingletonSDMOpStaticBuffer_{ 38218 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent__BSTSingletonSDMOpStaticBuffer_{ 1484930 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDModeEvent__BSTSingletonSDMOpStaticBuffer_{ 1287102 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent__BSTSingletonSDMOpStaticBuffer_{ 995641 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDNotificationEvent__BSTSingletonSDMOpStaticBuffer_{ 172019 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent__BSTSingletonSDMOpStaticBuffer_{ 1036990 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDPerkVaultBoyData__BSTSingletonSDMOpStaticBuffer_{ 1197925 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent__BSTSingletonSDMOpStaticBuffer_{ 139754 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName__BSTSingletonSDMOpStaticBuffer_{ 1487860 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDReinitializedEvent__BSTSingletonSDMOpStaticBuffer_{ 739952 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDRolloverIsCrime__BSTSingletonSDMOpStaticBuffer_{ 426219 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDRolloverStateEvent__BSTSingletonSDMOpStaticBuffer_{ 115755 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent__BSTSingletonSDMOpStaticBuffer_{ 1080636 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HUDTutorialTextEvent__BSTSingletonSDMOpStaticBuffer_{ 107695 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_HasHUDMessagesEvent__BSTSingletonSDMOpStaticBuffer_{ 1343784 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_InventoryUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 864883 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_IsPipboyActiveEvent__BSTSingletonSDMOpStaticBuffer_{ 635654 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent__BSTSingletonSDMOpStaticBuffer_{ 363308 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent__BSTSingletonSDMOpStaticBuffer_{ 378713 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ObjectivesInWayOfXP__BSTSingletonSDMOpStaticBuffer_{ 1303249 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_OpenContainerMenuEventData__BSTSingletonSDMOpStaticBuffer_{ 907531 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PerkPointIncreaseEvent__BSTSingletonSDMOpStaticBuffer_{ 951316 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PickRefStateChangedEvent__BSTSingletonSDMOpStaticBuffer_{ 544473 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PipboyLightEvent__BSTSingletonSDMOpStaticBuffer_{ 611310 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent__BSTSingletonSDMOpStaticBuffer_{ 137908 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent__BSTSingletonSDMOpStaticBuffer_{ 77687 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerAmmoCountEvent__BSTSingletonSDMOpStaticBuffer_{ 590040 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent__BSTSingletonSDMOpStaticBuffer_{ 179434 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerCommandTypeEvent__BSTSingletonSDMOpStaticBuffer_{ 602203 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent__BSTSingletonSDMOpStaticBuffer_{ 677314 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent__BSTSingletonSDMOpStaticBuffer_{ 235336 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 104364 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent__BSTSingletonSDMOpStaticBuffer_{ 1118689 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_PowerArmorLightData__BSTSingletonSDMOpStaticBuffer_{ 146711 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage__BSTSingletonSDMOpStaticBuffer_{ 1501934 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_QuickContainerStateEvent__BSTSingletonSDMOpStaticBuffer_{ 1365761 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate__BSTSingletonSDMOpStaticBuffer_{ 1304879 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_RequestHUDModesEvent__BSTSingletonSDMOpStaticBuffer_{ 799594 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent__BSTSingletonSDMOpStaticBuffer_{ 613447 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_RolloverSuppressedEvent__BSTSingletonSDMOpStaticBuffer_{ 1164471 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent__BSTSingletonSDMOpStaticBuffer_{ 1307492 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent__BSTSingletonSDMOpStaticBuffer_{ 1400455 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowHUDMessageEvent__BSTSingletonSDMOpStaticBuffer_{ 435647 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim__BSTSingletonSDMOpStaticBuffer_{ 1512983 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingExperienceEvent__BSTSingletonSDMOpStaticBuffer_{ 954626 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent__BSTSingletonSDMOpStaticBuffer_{ 337952 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent__BSTSingletonSDMOpStaticBuffer_{ 1175462 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState__BSTSingletonSDMOpStaticBuffer_{ 748565 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingVATSCritAnim__BSTSingletonSDMOpStaticBuffer_{ 545234 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent__BSTSingletonSDMOpStaticBuffer_{ 322129 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent__BSTSingletonSDMOpStaticBuffer_{ 1071167 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_VATSCommandTargetEvent__BSTSingletonSDMOpStaticBuffer_{ 1498882 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent__BSTSingletonSDMOpStaticBuffer_{ 573818 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTGlobalEvent__EventSource_ViewCasterUpdateEvent__BSTSingletonSDMOpStaticBuffer_{ 523901 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy__BSTSingletonSDMOpStaticBuffer_{ 1163163 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy__BSTSingletonSDMOpStaticBuffer_{ 209302 };
+		inline constexpr REL::ID BSTSingletonSDM_BSTextureStreamer__Manager_BSTSingletonSDMOpStaticBuffer_{ 1254343 };
+		inline constexpr REL::ID BSTSingletonSDM_BSThreadEvent____Source_BSTSingletonSDMOpStaticBuffer_{ 1492662 };
+		inline constexpr REL::ID BSTSingletonSDM_BSiStateTaggingListenerSingleton_BSTSingletonSDMOpStaticBuffer_{ 1290762 };
+		inline constexpr REL::ID BSTSingletonSDM_CharacterCollisionHandler_BSTSingletonSDMOpStaticBuffer_{ 1455361 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 566517 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 931639 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 144182 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 1222432 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 687257 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 417934 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 585022 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 56952 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 460647 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 170778 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 294111 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 1246826 };
+		inline constexpr REL::ID BSTSingletonSDM_CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy__BSTSingletonSDMOpStaticBuffer_{ 709099 };
+		inline constexpr REL::ID BSTSingletonSDM_DynamicIdleDataSingletonHelper_BSTSingletonSDMOpStaticBuffer_{ 383067 };
+		inline constexpr REL::ID BSTSingletonSDM_FOCollisionListener_BSTSingletonSDMOpStaticBuffer_{ 1241985 };
+		inline constexpr REL::ID BSTSingletonSDM_FavoritesManager_BSTSingletonSDMOpStaticBuffer_{ 1576171 };
+		inline constexpr REL::ID BSTSingletonSDM_FlatScreenModel_BSTSingletonSDMOpStaticBuffer_{ 221324 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__BasicEventHandler_BSTSingletonSDMOpStaticBuffer_{ 34857 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__CombatEventHandler_BSTSingletonSDMOpStaticBuffer_{ 903632 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__CustomEventHandler_BSTSingletonSDMOpStaticBuffer_{ 197655 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__DistanceEventHandler_BSTSingletonSDMOpStaticBuffer_{ 1204951 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__FragmentEventHandler_BSTSingletonSDMOpStaticBuffer_{ 1360469 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__InventoryEventHandler_BSTSingletonSDMOpStaticBuffer_{ 1348446 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__LOSEventHandler_BSTSingletonSDMOpStaticBuffer_{ 174833 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__MenuEventHandler_BSTSingletonSDMOpStaticBuffer_{ 503293 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__PathingCallbackMgr_BSTSingletonSDMOpStaticBuffer_{ 859491 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__QuestCallbackMgr_BSTSingletonSDMOpStaticBuffer_{ 897824 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__SleepEventHandler_BSTSingletonSDMOpStaticBuffer_{ 1122362 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__SoundCallbackMgr_BSTSingletonSDMOpStaticBuffer_{ 628972 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__TeleportEventHandler_BSTSingletonSDMOpStaticBuffer_{ 958554 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__TimerEventHandler_BSTSingletonSDMOpStaticBuffer_{ 1010383 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__TrackedStatsEventHandler_BSTSingletonSDMOpStaticBuffer_{ 475426 };
+		inline constexpr REL::ID BSTSingletonSDM_GameScript__WaitEventHandler_BSTSingletonSDMOpStaticBuffer_{ 496866 };
+		inline constexpr REL::ID BSTSingletonSDM_GameUIModel_BSTSingletonSDMOpStaticBuffer_{ 432596 };
+		inline constexpr REL::ID BSTSingletonSDM_GameVM_BSTSingletonSDMOpStaticBuffer_{ 1092170 };
+		inline constexpr REL::ID BSTSingletonSDM_HUDDataModel_BSTSingletonSDMOpStaticBuffer_{ 377843 };
+		inline constexpr REL::ID BSTSingletonSDM_HUDScreenModel_BSTSingletonSDMOpStaticBuffer_{ 1468899 };
+		inline constexpr REL::ID BSTSingletonSDM_HelpMessageManager_BSTSingletonSDMOpStaticBuffer_{ 1540483 };
+		inline constexpr REL::ID BSTSingletonSDM_HolotapeDataManager_BSTSingletonSDMOpStaticBuffer_{ 1008928 };
+		inline constexpr REL::ID BSTSingletonSDM_JobListManager__ServingThread_BSTSingletonSDMOpStaticBuffer_{ 1514343 };
+		inline constexpr REL::ID BSTSingletonSDM_MenuControls_BSTSingletonSDMOpStaticBuffer_{ 1503149 };
+		inline constexpr REL::ID BSTSingletonSDM_MenuCursor_BSTSingletonSDMOpStaticBuffer_{ 344458 };
+		inline constexpr REL::ID BSTSingletonSDM_MenuTopicManager_BSTSingletonSDMOpStaticBuffer_{ 400930 };
+		inline constexpr REL::ID BSTSingletonSDM_MovementAvoidanceManager_BSTSingletonSDMOpStaticBuffer_{ 363604 };
+		inline constexpr REL::ID BSTSingletonSDM_MultiActivateManager_BSTSingletonSDMOpStaticBuffer_{ 214317 };
+		inline constexpr REL::ID BSTSingletonSDM_NVFlex__DebrisInstanceManager_NVFlex__SingletonSDMOpShared_{ 1154489 };
+		inline constexpr REL::ID BSTSingletonSDM_Pathing_BSTSingletonSDMOpStaticBuffer_{ 1258111 };
+		inline constexpr REL::ID BSTSingletonSDM_PipboyCompanionService_BSTSingletonSDMOpStaticBuffer_{ 942693 };
+		inline constexpr REL::ID BSTSingletonSDM_PipboyManager_BSTSingletonSDMOpStaticBuffer_{ 1409600 };
+		inline constexpr REL::ID BSTSingletonSDM_PlayerCamera_BSTSingletonSDMOpStaticBuffer_{ 1492139 };
+		inline constexpr REL::ID BSTSingletonSDM_PlayerControls_BSTSingletonSDMOpStaticBuffer_{ 30235 };
+		inline constexpr REL::ID BSTSingletonSDM_PlayerRegionState_BSTSingletonSDMOpStaticBuffer_{ 200295 };
+		inline constexpr REL::ID BSTSingletonSDM_PowerArmorGeometry_BSTSingletonSDMOpStaticBuffer_{ 270566 };
+		inline constexpr REL::ID BSTSingletonSDM_ProcessLists_BSTSingletonSDMOpStaticBuffer_{ 515005 };
+		inline constexpr REL::ID BSTSingletonSDM_RagdollFurnitureModifier_BSTSingletonSDMOpStaticBuffer_{ 1359295 };
+		inline constexpr REL::ID BSTSingletonSDM_StaticAvoidNodeManager_BSTSingletonSDMOpStaticBuffer_{ 587293 };
+		inline constexpr REL::ID BSTSingletonSDM_SynchronizedAnimationSingleton_BSTSingletonSDMOpStaticBuffer_{ 1009067 };
+		inline constexpr REL::ID BSTSingletonSDM_TESAudio__ScriptedMusicState_BSTSingletonSDMOpStaticBuffer_{ 310856 };
+		inline constexpr REL::ID BSTSingletonSDM_UIBlurManager_BSTSingletonSDMOpStaticBuffer_{ 1562724 };
+		inline constexpr REL::ID BSTSingletonSDM_UISaveLoadManager_BSTSingletonSDMOpStaticBuffer_{ 980653 };
+		inline constexpr REL::ID BSTSingletonSDM_UI_BSTSingletonSDMOpStaticBuffer_{ 1058291 };
+		inline constexpr REL::ID BSTSingletonSDM_VATS_BSTSingletonSDMOpStaticBuffer_{ 1200065 };
+		inline constexpr REL::ID BSTSingletonSDM___AnimationFileListener_BSTSingletonSDMOpStaticBuffer_{ 405236 };
+		inline constexpr REL::ID BSTSingletonSDM___AnimationFileLookupSingletonHelper_BSTSingletonSDMOpStaticBuffer_{ 567730 };
+		inline constexpr REL::ID BSTSingletonSDM___ArchiveCacheEvent_BSTSingletonSDMOpStaticBuffer_{ 1414956 };
+		inline constexpr REL::ID BSTSingletonSDM___BSRagdollDriverInterface_BSTSingletonSDMOpStaticBuffer_{ 614458 };
+		inline constexpr REL::ID BSTSingletonSDM___BSScaleformAllocatorPaged_BSTSingletonSDMOpStaticBuffer_{ 997087 };
+		inline constexpr REL::ID BSTSingletonSDM___BehaviorGraphSpecificDataLookupSingleton_BSTSingletonSDMOpStaticBuffer_{ 1132117 };
+		inline constexpr REL::ID BSTSingletonSDM___ConsoleHotkeyManager_BSTSingletonSDMOpStaticBuffer_{ 556444 };
+		inline constexpr REL::ID BSTSingletonSDM___DDQueueCollection_BSTSingletonSDMOpStaticBuffer_{ 578825 };
+		inline constexpr REL::ID BSTSingletonSDM___HavokThreadMemorySink_BSTSingletonSDMOpStaticBuffer_{ 1236471 };
+		inline constexpr REL::ID BSTSingletonSDM___Jobber_BSTSingletonSDMOpStaticBuffer_{ 156880 };
+		inline constexpr REL::ID BSTSingletonSDM___LooseAudioRegistrar_BSTSingletonSDMOpStaticBuffer_{ 380893 };
+		inline constexpr REL::ID BSTSingletonSDM___MainCullingCamera_BSTSingletonSDMOpStaticBuffer_{ 1444037 };
+		inline constexpr REL::ID BSTSingletonSDM_bhkBipedOrientationController_BSTSingletonSDMOpStaticBuffer_{ 846469 };
+		inline constexpr REL::ID BSTSingletonSDM_bhkCollisionFilter_BSTSingletonSDMOpStaticBuffer_{ 796223 };
+		inline constexpr REL::ID BSTSingletonSDM_hknpBSMoveLimitModifier_BSTSingletonSDMOpStaticBuffer_{ 1259269 };
+		inline constexpr REL::ID BSTSingletonSDM_hknpBSShapeCodec_BSTSingletonSDMOpStaticBuffer_{ 933442 };
+		inline constexpr REL::ID BSTSingletonSDM_hknpBackfaceCollisionModifier_BSTSingletonSDMOpStaticBuffer_{ 1399577 };
+		inline constexpr REL::ID BSTStaticFreeList_ActorMovementMessageMap_16___RawMessageHandlerWrapperType_16_{ 1285321 };
+		inline constexpr REL::ID BSTStaticFreeList_BSScript__Internal__FunctionMessage_1024_{ 1581691 };
+		inline constexpr REL::ID BSTStaticFreeList_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__512_{ 1489997 };
+		inline constexpr REL::ID BSTValueEventSink_AutoLoadDoorRolloverEvent_{ 348066 };
+		inline constexpr REL::ID BSTValueEventSink_BlockPipboyOpeningEvent_{ 1115914 };
+		inline constexpr REL::ID BSTValueEventSink_CanDisplayNextHUDMessage_{ 145405 };
+		inline constexpr REL::ID BSTValueEventSink_CanDisplayNextHUDObjective_{ 319965 };
+		inline constexpr REL::ID BSTValueEventSink_CompanionMenuEnabled_{ 773449 };
+		inline constexpr REL::ID BSTValueEventSink_ConditionBoyEvent_{ 783682 };
+		inline constexpr REL::ID BSTValueEventSink_ControlsRemappedEvent_{ 1514634 };
+		inline constexpr REL::ID BSTValueEventSink_CurrentRadiationSourceCount_{ 1372445 };
+		inline constexpr REL::ID BSTValueEventSink_CurrentRadsDisplayMagnitude_{ 1081828 };
+		inline constexpr REL::ID BSTValueEventSink_CurrentRadsPercentOfLethal_{ 6340 };
+		inline constexpr REL::ID BSTValueEventSink_DirectionalHitIndicatorResultEvent_{ 640649 };
+		inline constexpr REL::ID BSTValueEventSink_DisplayFatigueWarningEvent_{ 912682 };
+		inline constexpr REL::ID BSTValueEventSink_ExperienceMeterDisplayEvent_{ 1571773 };
+		inline constexpr REL::ID BSTValueEventSink_ExplosiveIndicatorResultEvent_{ 1265756 };
+		inline constexpr REL::ID BSTValueEventSink_FaderMenuDisplayState_{ 298206 };
+		inline constexpr REL::ID BSTValueEventSink_HUDEnemyHealthDisplayEvent_{ 538247 };
+		inline constexpr REL::ID BSTValueEventSink_HUDMessageDisplayDataEvent_{ 149972 };
+		inline constexpr REL::ID BSTValueEventSink_HUDNotificationDisplayEvent_{ 1451734 };
+		inline constexpr REL::ID BSTValueEventSink_HUDObjectiveDisplayEvent_{ 149187 };
+		inline constexpr REL::ID BSTValueEventSink_HUDPerkVaultBoySwfDisplayEvent_{ 1258926 };
+		inline constexpr REL::ID BSTValueEventSink_HUDQuestVaultBoySwfName_{ 947838 };
+		inline constexpr REL::ID BSTValueEventSink_HUDReinitializedEvent_{ 1146143 };
+		inline constexpr REL::ID BSTValueEventSink_HUDRolloverIsCrime_{ 1051609 };
+		inline constexpr REL::ID BSTValueEventSink_HUDRolloverStateEvent_{ 661784 };
+		inline constexpr REL::ID BSTValueEventSink_HUDSubtitleDisplayEvent_{ 1069891 };
+		inline constexpr REL::ID BSTValueEventSink_HUDTutorialTextEvent_{ 946119 };
+		inline constexpr REL::ID BSTValueEventSink_HasHUDMessagesEvent_{ 1368173 };
+		inline constexpr REL::ID BSTValueEventSink_InventoryUpdateEvent_{ 1557617 };
+		inline constexpr REL::ID BSTValueEventSink_IsPipboyActiveEvent_{ 655554 };
+		inline constexpr REL::ID BSTValueEventSink_MultiActivateUseRolloverEvent_{ 1445785 };
+		inline constexpr REL::ID BSTValueEventSink_PickRefStateChangedEvent_{ 1505843 };
+		inline constexpr REL::ID BSTValueEventSink_PipboyLightEvent_{ 807986 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerActivatePickRefEvent_{ 114807 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerActiveEffectIconsEvent_{ 1196760 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerAmmoCountEvent_{ 1549927 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerAutoAimActorEvent_{ 912902 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerCommandTypeEvent_{ 1571486 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerCrosshairModeEvent_{ 1536247 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerSetWeaponStateEvent_{ 1176862 };
+		inline constexpr REL::ID BSTValueEventSink_PlayerWeaponReloadEvent_{ 752085 };
+		inline constexpr REL::ID BSTValueEventSink_QuickContainerStateEvent_{ 291155 };
+		inline constexpr REL::ID BSTValueEventSink_QuickContainerStateRequiresUpdate_{ 759683 };
+		inline constexpr REL::ID BSTValueEventSink_RolloverSuppressedEvent_{ 400039 };
+		inline constexpr REL::ID BSTValueEventSink_SaveLoadMessageStringEvent_{ 1022487 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingDialogueSpeechChallengeAnim_{ 945462 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingExperienceEvent_{ 1371884 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingFeaturedItemVaultBoyEvent_{ 1372633 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingLongSubtitleEvent_{ 1189215 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingPerkVaultBoyState_{ 520559 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingVATSCritAnim_{ 161419 };
+		inline constexpr REL::ID BSTValueEventSink_ShowingWideSubtitleEvent_{ 1254737 };
+		inline constexpr REL::ID BSTValueEventSink_VATSCommandTargetEvent_{ 128614 };
+		inline constexpr REL::ID BSTValueEventSink_VATSForcedEnemyHealthPercentEvent_{ 1337660 };
+		inline constexpr REL::ID BSTValueEventSink_ViewCasterUpdateEvent_{ 1453401 };
+		inline constexpr REL::ID BSTValueEventSource_BlockPipboyOpeningEvent_{ 1373535 };
+		inline constexpr REL::ID BSTValueEventSource_CanDisplayNextHUDMessage_{ 868153 };
+		inline constexpr REL::ID BSTValueEventSource_CanDisplayNextHUDObjective_{ 1572670 };
+		inline constexpr REL::ID BSTValueEventSource_CompanionMenuEnabled_{ 705360 };
+		inline constexpr REL::ID BSTValueEventSource_ConditionBoyEvent_{ 710125 };
+		inline constexpr REL::ID BSTValueEventSource_CurrentRadiationSourceCount_{ 1210563 };
+		inline constexpr REL::ID BSTValueEventSource_CurrentRadsDisplayMagnitude_{ 1051302 };
+		inline constexpr REL::ID BSTValueEventSource_CurrentRadsPercentOfLethal_{ 1130734 };
+		inline constexpr REL::ID BSTValueEventSource_DirectionalHitIndicatorResultEvent_{ 1300754 };
+		inline constexpr REL::ID BSTValueEventSource_ExperienceMeterDisplayEvent_{ 1543122 };
+		inline constexpr REL::ID BSTValueEventSource_ExplosiveIndicatorResultEvent_{ 756990 };
+		inline constexpr REL::ID BSTValueEventSource_FaderMenuDisplayState_{ 712678 };
+		inline constexpr REL::ID BSTValueEventSource_HUDCommmandModeEvent_{ 1184487 };
+		inline constexpr REL::ID BSTValueEventSource_HUDEnemyHealthDisplayEvent_{ 978506 };
+		inline constexpr REL::ID BSTValueEventSource_HUDMessageDisplayDataEvent_{ 65982 };
+		inline constexpr REL::ID BSTValueEventSource_HUDNotificationDisplayEvent_{ 161204 };
+		inline constexpr REL::ID BSTValueEventSource_HUDObjectiveDisplayEvent_{ 1441 };
+		inline constexpr REL::ID BSTValueEventSource_HUDPerkVaultBoySwfDisplayEvent_{ 1639 };
+		inline constexpr REL::ID BSTValueEventSource_HUDQuestVaultBoySwfName_{ 81559 };
+		inline constexpr REL::ID BSTValueEventSource_HUDRolloverIsCrime_{ 1422706 };
+		inline constexpr REL::ID BSTValueEventSource_HUDRolloverStateEvent_{ 1264021 };
+		inline constexpr REL::ID BSTValueEventSource_HUDSubtitleDisplayEvent_{ 1167371 };
+		inline constexpr REL::ID BSTValueEventSource_HUDTutorialTextEvent_{ 1505173 };
+		inline constexpr REL::ID BSTValueEventSource_HasHUDMessagesEvent_{ 789149 };
+		inline constexpr REL::ID BSTValueEventSource_IsPipboyActiveEvent_{ 598300 };
+		inline constexpr REL::ID BSTValueEventSource_MultiActivateUseRolloverEvent_{ 13437 };
+		inline constexpr REL::ID BSTValueEventSource_ObjectivesInWayOfXP_{ 69752 };
+		inline constexpr REL::ID BSTValueEventSource_PlayerActivatePickRefEvent_{ 1502833 };
+		inline constexpr REL::ID BSTValueEventSource_PlayerActiveEffectIconsEvent_{ 727743 };
+		inline constexpr REL::ID BSTValueEventSource_PlayerAmmoCountEvent_{ 1058024 };
+		inline constexpr REL::ID BSTValueEventSource_PlayerAutoAimActorEvent_{ 869422 };
+		inline constexpr REL::ID BSTValueEventSource_PlayerCommandTypeEvent_{ 790362 };
+		inline constexpr REL::ID BSTValueEventSource_PlayerCrosshairModeEvent_{ 1343256 };
+		inline constexpr REL::ID BSTValueEventSource_QuickContainerStateEvent_{ 1215035 };
+		inline constexpr REL::ID BSTValueEventSource_RolloverSuppressedEvent_{ 1294198 };
+		inline constexpr REL::ID BSTValueEventSource_SaveLoadMessageStringEvent_{ 218937 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingDialogueSpeechChallengeAnim_{ 287057 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingExperienceEvent_{ 240544 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingFeaturedItemVaultBoyEvent_{ 273644 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingLongSubtitleEvent_{ 272073 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingPerkVaultBoyState_{ 1179337 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingVATSCritAnim_{ 330455 };
+		inline constexpr REL::ID BSTValueEventSource_ShowingWideSubtitleEvent_{ 351337 };
+		inline constexpr REL::ID BSTValueEventSource_ViewCasterUpdateEvent_{ 233478 };
+		inline constexpr REL::ID BSTableCurve{ 760051 };
+		inline constexpr REL::ID BSTaskJobber{ 295971 };
+		inline constexpr REL::ID BSTaskJobber__Task{ 879543 };
+		inline constexpr REL::ID BSTaskThread{ 1283944 };
+		inline constexpr REL::ID BSTasklet{ 1458857 };
+		inline constexpr REL::ID BSTaskletData{ 754305 };
+		inline constexpr REL::ID BSTaskletGroupData{ 142491 };
+		inline constexpr REL::ID BSTaskletManager{ 893961 };
+		inline constexpr REL::ID BSTaskletManagerCallback{ 268746 };
+		inline constexpr REL::ID BSTempEffect{ 1429225 };
+		inline constexpr REL::ID BSTempEffectDebris{ 1283173 };
+		inline constexpr REL::ID BSTempEffectGeometryDecal{ 345204 };
+		inline constexpr REL::ID BSTempEffectParticle{ 863414 };
+		inline constexpr REL::ID BSTempEffectSPG{ 724057 };
+		inline constexpr REL::ID BSTempEffectWeaponBlood{ 51692 };
+		inline constexpr REL::ID BSTerrainEffect{ 397213 };
+		inline constexpr REL::ID BSTextureArray__MasterTexture{ 576456 };
+		inline constexpr REL::ID BSTextureArray__StaticTexture{ 449936 };
+		inline constexpr REL::ID BSTextureArray__StaticTextureIndexed{ 403482 };
+		inline constexpr REL::ID BSTextureArray__Texture{ 716649 };
+		inline constexpr REL::ID BSTextureDB__DBTraits{ 1331314 };
+		inline constexpr REL::ID BSTextureDB__QueuedHandles{ 1385388 };
+		inline constexpr REL::ID BSTextureDB__QueuedHandlesWithCallback{ 1213115 };
+		inline constexpr REL::ID BSTextureDB____NiTextureDBForwarded{ 552800 };
+		inline constexpr REL::ID BSTextureSet{ 1307579 };
+		inline constexpr REL::ID BSTextureStreamer__Manager{ 1520536 };
+		inline constexpr REL::ID BSTextureStreamer__StreamDetailI{ 834693 };
+		inline constexpr REL::ID BSTextureStreamer__TextureModifyBatch{ 1347361 };
+		inline constexpr REL::ID BSTextureStreamer__TextureModifyBatchNoLimit{ 960767 };
+		inline constexpr REL::ID BSTextureStreamer__zlibStreamDetail{ 788289 };
+		inline constexpr REL::ID BSThread{ 798789 };
+		inline constexpr REL::ID BSThreadEvent____Source{ 708573 };
+		inline constexpr REL::ID BSTimerModifier{ 636616 };
+		inline constexpr REL::ID BSTransformExtra{ 1238000 };
+		inline constexpr REL::ID BSTreadTransfInterpolator{ 1343401 };
+		inline constexpr REL::ID BSTreeManager__IQueryCullingCamera{ 1035757 };
+		inline constexpr REL::ID BSTreeNode{ 1216019 };
+		inline constexpr REL::ID BSTriShape{ 1535592 };
+		inline constexpr REL::ID BSTweenerModifier{ 370355 };
+		inline constexpr REL::ID BSUIMessageData{ 112478 };
+		inline constexpr REL::ID BSUIScaleformData{ 331508 };
+		inline constexpr REL::ID BSUtilityShader{ 1030925 };
+		inline constexpr REL::ID BSVMLoadTask{ 492083 };
+		inline constexpr REL::ID BSValueNode{ 250731 };
+		inline constexpr REL::ID BSVirtualKeyboardDevice{ 658738 };
+		inline constexpr REL::ID BSWArray{ 1132768 };
+		inline constexpr REL::ID BSWaterShader{ 1401626 };
+		inline constexpr REL::ID BSWaterShaderMaterial{ 1275686 };
+		inline constexpr REL::ID BSWaterShaderProperty{ 470444 };
+		inline constexpr REL::ID BSWin32GameDataSystemUtility{ 292559 };
+		inline constexpr REL::ID BSWin32TaskletGroupData{ 2011 };
+		inline constexpr REL::ID BSWin32TaskletManager{ 408381 };
+		inline constexpr REL::ID BSWindModifier{ 1572554 };
+		inline constexpr REL::ID BSXAudio2Audio{ 1368048 };
+		inline constexpr REL::ID BSXAudio2AudioListener{ 934902 };
+		inline constexpr REL::ID BSXAudio2DataSrc{ 1532801 };
+		inline constexpr REL::ID BSXAudio2GameSound{ 860725 };
+		inline constexpr REL::ID BSXFlags{ 955448 };
+		inline constexpr REL::ID BShkFloatController{ 1219842 };
+		inline constexpr REL::ID BShkNonTransformController{ 1266293 };
+		inline constexpr REL::ID BShkVisibilityController{ 632107 };
+		inline constexpr REL::ID BShkbAnimationGraph{ 1113996 };
+		inline constexpr REL::ID BShkbGlobalTransitionData{ 293455 };
+		inline constexpr REL::ID BShkbHkxDB__DBTraits{ 844783 };
+		inline constexpr REL::ID BShkbHkxDB__ProjectDBData{ 1124412 };
+		inline constexpr REL::ID BShkbHkxDB__QueuedHandles{ 626887 };
+		inline constexpr REL::ID BShkbHkxDB__StreamAdaptor{ 197589 };
+		inline constexpr REL::ID BShkbHkxDB__hkxDBData{ 858508 };
+		inline constexpr REL::ID BShkbUtils__GraphInspectionFunctor{ 949101 };
+		inline constexpr REL::ID BShkbUtils__SearchAllStateMachineChildrenFunctor{ 693353 };
+		inline constexpr REL::ID BSiStateTaggingGenerator{ 72452 };
+		inline constexpr REL::ID BSiStateTaggingListenerSingleton{ 1117905 };
+		inline constexpr REL::ID BSiStateTaggingStateListener{ 1388455 };
+		inline constexpr REL::ID BackgroundProcessThread{ 1550060 };
+		inline constexpr REL::ID BanishEffect{ 1191428 };
+		inline constexpr REL::ID BarrierProjectile{ 399454 };
+		inline constexpr REL::ID BarterMenu{ 1409128 };
+		inline constexpr REL::ID BaseFormComponent{ 654815 };
+		inline constexpr REL::ID BasicArrayImplementation_char_{ 156712 };
+		inline constexpr REL::ID BasicArrayImplementation_float_{ 436070 };
+		inline constexpr REL::ID BasicArrayImplementation_hkDataArrayImpl_{ 63269 };
+		inline constexpr REL::ID BasicArrayImplementation_hkDataObjectImpl_{ 1393087 };
+		inline constexpr REL::ID BasicArrayImplementation_unsignedchar_{ 842256 };
+		inline constexpr REL::ID BeamProjectile{ 745316 };
+		inline constexpr REL::ID BedEnterHandler{ 1472509 };
+		inline constexpr REL::ID BedFurnitureExitHandler{ 454611 };
+		inline constexpr REL::ID BleedoutCameraState{ 1417467 };
+		inline constexpr REL::ID BookMenu{ 630673 };
+		inline constexpr REL::ID BowDrawnHandler{ 759364 };
+		inline constexpr REL::ID BowReleaseHandler{ 273799 };
+		inline constexpr REL::ID BowZoomStartHandler{ 838661 };
+		inline constexpr REL::ID BowZoomStopHandler{ 572776 };
+		inline constexpr REL::ID BuildABot__InputHandler{ 380864 };
+		inline constexpr REL::ID ButtonBarMenu{ 677495 };
+		inline constexpr REL::ID ButtonEvent{ 1452395 };
+		inline constexpr REL::ID ButtonHintBar{ 1438775 };
+		inline constexpr REL::ID ByteArrayImplementation{ 1108172 };
+		inline constexpr REL::ID bhkBipedOrientationController{ 674104 };
+		inline constexpr REL::ID bhkBlockStreamAllocator_2048_{ 121774 };
+		inline constexpr REL::ID bhkCharProxyController{ 616556 };
+		inline constexpr REL::ID bhkCharProxyControllerCinfo{ 1447352 };
+		inline constexpr REL::ID bhkCharProxyManager{ 1366603 };
+		inline constexpr REL::ID bhkCharRigidBodyController{ 1167559 };
+		inline constexpr REL::ID bhkCharRigidBodyControllerCinfo{ 808483 };
+		inline constexpr REL::ID bhkCharRigidBodyManager{ 1100976 };
+		inline constexpr REL::ID bhkCharacterCollisionHandler{ 1156383 };
+		inline constexpr REL::ID bhkCharacterController{ 49805 };
+		inline constexpr REL::ID bhkCharacterControllerCinfo{ 1352207 };
+		inline constexpr REL::ID bhkCharacterPointCollector{ 1385973 };
+		inline constexpr REL::ID bhkCharacterProxy{ 350267 };
+		inline constexpr REL::ID bhkCharacterRigidBody{ 1074282 };
+		inline constexpr REL::ID bhkCharacterRigidBodyCinfo{ 1120817 };
+		inline constexpr REL::ID bhkCharacterState{ 315916 };
+		inline constexpr REL::ID bhkCharacterStateClimbing{ 400632 };
+		inline constexpr REL::ID bhkCharacterStateFloating{ 316798 };
+		inline constexpr REL::ID bhkCharacterStateFlying{ 134784 };
+		inline constexpr REL::ID bhkCharacterStateInAir{ 1147637 };
+		inline constexpr REL::ID bhkCharacterStateJumping{ 1101157 };
+		inline constexpr REL::ID bhkCharacterStateOnGround{ 1446581 };
+		inline constexpr REL::ID bhkCharacterStateSwimming{ 1399764 };
+		inline constexpr REL::ID bhkCollisionFilter{ 842640 };
+		inline constexpr REL::ID bhkIAddToWorld{ 848620 };
+		inline constexpr REL::ID bhkICharOrientationController{ 1398813 };
+		inline constexpr REL::ID bhkIWorldStepListener{ 913750 };
+		inline constexpr REL::ID bhkMemorySystem{ 599793 };
+		inline constexpr REL::ID bhkNPCollisionObject{ 757986 };
+		inline constexpr REL::ID bhkNPCollisionObjectBase{ 491588 };
+		inline constexpr REL::ID bhkNPCollisionObjectUnlinked{ 225862 };
+		inline constexpr REL::ID bhkNPCollisionObjectUnlinked__LinkExtraData{ 132416 };
+		inline constexpr REL::ID bhkNPCollisionProxyObject{ 179287 };
+		inline constexpr REL::ID bhkPhysicsSystem{ 744202 };
+		inline constexpr REL::ID bhkQuadOrientationController{ 648719 };
+		inline constexpr REL::ID bhkRagdollPenetrationUtil{ 1316423 };
+		inline constexpr REL::ID bhkRagdollSystem{ 258588 };
+		inline constexpr REL::ID bhkTTNode_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___{ 644278 };
+		inline constexpr REL::ID bhkThreadMemorySource{ 1219089 };
+		inline constexpr REL::ID bhkThreadPool{ 1176685 };
+		inline constexpr REL::ID bhkTrapListener{ 726263 };
+		inline constexpr REL::ID bhkWorld{ 489304 };
+		inline constexpr REL::ID bhkWorldM{ 1456511 };
+		inline constexpr REL::ID bnet__AcceptLegalDocumentsRequest{ 263492 };
+		inline constexpr REL::ID bnet__AccountDeletionRequest{ 167390 };
+		inline constexpr REL::ID bnet__AccountInfoRequest{ 216245 };
+		inline constexpr REL::ID bnet__AccountLinkingRequest{ 675014 };
+		inline constexpr REL::ID bnet__AccountQuickCreateFlow{ 1412082 };
+		inline constexpr REL::ID bnet__AccountUnlinkingRequest{ 327043 };
+		inline constexpr REL::ID bnet__AccountUpgradeAnonymousToQuickRequest{ 333868 };
+		inline constexpr REL::ID bnet__AcquirableFreeLessHeap{ 104494 };
+		inline constexpr REL::ID bnet__AddFingerprintRequest{ 339838 };
+		inline constexpr REL::ID bnet__AnonymousAuthRequest{ 587955 };
+		inline constexpr REL::ID bnet__AnonymousAuthenticationFlow{ 680515 };
+		inline constexpr REL::ID bnet__AuthenticationFlow{ 1365376 };
+		inline constexpr REL::ID bnet__BaseCallback{ 1142541 };
+		inline constexpr REL::ID bnet__BaseCallbackJob_bnet__Sequence_bnet__ta__ThreadSafe_bnet__ta__ErrorPropagation__bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__bnet__ta__ThreadSafe_{ 454332 };
+		inline constexpr REL::ID bnet__BaseFileDownloader{ 384813 };
+		inline constexpr REL::ID bnet__BaseHttpRequest{ 415235 };
+		inline constexpr REL::ID bnet__BeamAuthenticationRequest{ 1138798 };
+		inline constexpr REL::ID bnet__BeamExternalAuthenticationRequest{ 1311498 };
+		inline constexpr REL::ID bnet__BeamQuickCreationRequest{ 69587 };
+		inline constexpr REL::ID bnet__BeamUserCredentialsAuthenticationRequest{ 746987 };
+		inline constexpr REL::ID bnet__CMS__ListMessagesRequest{ 785878 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__AnonymousAuthenticationFlow_{ 633622 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__ExternalAuthenticationFlow_{ 1442121 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountExternalAuthenticationFlow_{ 531242 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountExternalLinkConflictResolveFlow_{ 1529504 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountExternalLinkFlow_{ 1128694 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountGameCodeAuthenticationFlow_{ 942254 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountLinkConflictResolveFlow_{ 1277109 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountLinkFlow_{ 320024 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountUserCredentialsAuthenticationFlow_{ 278809 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameCodeAuthenticationFlow_{ 1162450 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__SessionAnonymousCreateFlow_{ 7630 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__SessionQuickCreateFlow_{ 965128 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__SessionResumeFlow_{ 317039 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__UserCredentialsAuthenticationFlow_{ 844420 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__AccountLinkingResult__bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ 218760 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__AccountResult__bnet__AccountAuthenticationStatus__BSPlatform__BSBNetAccountManager_{ 1030307 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__bnet__ExternalAuthenticationFlow_{ 219216 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__bnet__GameAccountUserCredentialsAuthenticationFlow_{ 199547 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__bnet__UserCredentialsAuthenticationFlow_{ 765126 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamUserData__bnet__HttpResponseInfo__bnet__AccountQuickCreateFlow_{ 1006265 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__CdpAuthenticationResult__bnet__HttpResponseInfo__bnet__AuthenticationFlow_{ 455972 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__CdpFileInfoResult__bnet__HttpResponseInfo__bnet__DownloadFlow_{ 1336314 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__CdpKeyResult__bnet__HttpResponseInfo__bnet__DownloadFlow_{ 538779 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__bnet__RetrieveExternalAccountJob_{ 1411368 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 74938 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo__bnet__DownloadFlow_{ 1322624 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo__bnet__LegalDocument_{ 1454604 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__Status__ExtServerStatusResult__bnet__HttpResponseInfo__BSPlatform__BSCoreServicesManager_{ 1282895 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcChunkUploadResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 433844 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 979912 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 793622 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 99567 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 1166429 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 299696 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 1522836 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 1550447 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 233994 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UpgradeTokenResult__bnet__HttpResponseInfo__bnet__UnlinkAccountFlow_{ 4541 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Catalog__Item__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 19644 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__Balance__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 607239 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 620994 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo__bnet__UgcMtxPurchaseFlow_{ 953095 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__CMS__Message_5_1_bnet___impl__StdAllocator_bnet__CMS__Message____bnet__HttpResponseInfo__BSPlatform__BSCoreServicesManager_{ 246499 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ 18031 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__bnet__AccountQuickCreateFlow_{ 647369 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__bnet__AuthenticationFlow_{ 96965 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__bnet__ListLegalDocumentsFlow_{ 1220686 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 47391 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 313341 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char____const__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 1163428 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__Vector_bnet__Entitlements__Item___bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ 789197 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet___impl__FixedString_40_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo__bnet__AuthenticationFlow_{ 349066 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ 298044 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ 686923 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ 807306 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__ChunkedUploadFlow_{ 566205 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__DownloadFlow_{ 524824 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__ExternalAuthenticationFlow_{ 644355 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__GameAccountExternalAuthenticationFlow_{ 172082 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__ListLegalDocumentsFlow_{ 1472948 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__NewGameSessionFlow_{ 396466 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__UgcMtxPurchaseFlow_{ 594019 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__UnlinkAccountFlow_{ 1228251 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_bool_bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ 1455566 };
+		inline constexpr REL::ID bnet__CallbackBind_bnet__Callback_unsigned__int64_bnet__HttpResponseInfo__bnet__ChunkedUploadFlow_{ 659596 };
+		inline constexpr REL::ID bnet__CallbackSequence_bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__bnet__ta__ThreadSafe_bnet__ta__ErrorPropagation_{ 375107 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet__BNetErrorResult_bnet__EmptyStatus__void___unsigned__int64_bnet__BNetErrorResult_bnet__BNetError_bnet__EmptyStatusconst__{ 442989 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo___lambda_2a3d09749ab1a7a2d04ec09309520633__{ 1273906 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo___lambda_588386b9a62f46a0d077492bf9f69e10__{ 184162 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_4a6a5efa89cc01e0bddd7eed4a328cc4__{ 914563 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_52f202907a4771e1bca18533ce859533__{ 327519 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_761a956714b46e17e88dcfef586f7e7e__{ 168774 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_934f5db8ee421f65975536d028146cb7__{ 555516 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_9399aef1f3d23d97f9f1ddcffcd7a809__{ 53785 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_b03e91aa70ad18dc8c2bb34f59e295dc__{ 527921 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_bcae189c2ac764aa6f3e67710cd5d9f3__{ 443404 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_bfa368bfcee47d43a2050e26590ced32__{ 428546 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_c211967adeece705f7f006a03cf00ecb__{ 803126 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_cb01a8382207de35475da81539317ca7__{ 1391337 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_d7c73fab7dc6a0b97bfa0a1cf0071488__{ 412926 };
+		inline constexpr REL::ID bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_ede56f28efebb3c2d40cf8b19f53b40e__{ 1581215 };
+		inline constexpr REL::ID bnet__Callback_bnet__BNetErrorResult_bnet__EmptyStatus_{ 657524 };
+		inline constexpr REL::ID bnet__Callback_bnet__BNetError_bnet__HttpResponseInfo_{ 1268794 };
+		inline constexpr REL::ID bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo_{ 223741 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__AccountLinkingResult__bnet__HttpResponseInfo_{ 778423 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__AccountResult__bnet__AccountAuthenticationStatus_{ 871297 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo_{ 685761 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__BeamUserData__bnet__HttpResponseInfo_{ 1099776 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__CdpAuthenticationResult__bnet__HttpResponseInfo_{ 549721 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__CdpFileInfoResult__bnet__HttpResponseInfo_{ 1523260 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__CdpKeyResult__bnet__HttpResponseInfo_{ 1429591 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo_{ 295434 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo_{ 1407686 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__Status__ExtServerStatusResult__bnet__HttpResponseInfo_{ 1483549 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__UgcChunkUploadResult__bnet__HttpResponseInfo_{ 862058 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo_{ 875788 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo_{ 769078 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo_{ 675987 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo_{ 582579 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__UpgradeTokenResult__bnet__HttpResponseInfo_{ 98369 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__VCCS__Catalog__Item__bnet__HttpResponseInfo_{ 728225 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__Balance__bnet__HttpResponseInfo_{ 475527 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo_{ 382278 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__CMS__Message_5_1_bnet___impl__StdAllocator_bnet__CMS__Message____bnet__HttpResponseInfo_{ 1403555 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo_{ 353121 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo_{ 782879 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char____const__bnet__HttpResponseInfo_{ 489050 };
+		inline constexpr REL::ID bnet__Callback_bnet__UniquePtr_bnet___impl__Vector_bnet__Entitlements__Item___bnet__HttpResponseInfo_{ 685304 };
+		inline constexpr REL::ID bnet__Callback_bnet___impl__FixedString_40_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo_{ 204147 };
+		inline constexpr REL::ID bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo_{ 357499 };
+		inline constexpr REL::ID bnet__Callback_bool_bnet__HttpResponseInfo_{ 1323775 };
+		inline constexpr REL::ID bnet__Callback_unsigned__int64_bnet__HttpResponseInfo_{ 47627 };
+		inline constexpr REL::ID bnet__Caller_void___bnet__InternalBNet__bnet__InternalBNet_{ 1222123 };
+		inline constexpr REL::ID bnet__Caller_void___bnet__NetworkLoop__bnet__NetworkLoop_{ 1449707 };
+		inline constexpr REL::ID bnet__CdpAuthenticationRequest{ 990270 };
+		inline constexpr REL::ID bnet__CdpFileInfoRequest{ 1183201 };
+		inline constexpr REL::ID bnet__CdpKeyRequest{ 1482356 };
+		inline constexpr REL::ID bnet__CheckEmailRequest{ 1247475 };
+		inline constexpr REL::ID bnet__ChunkedUploadFlow{ 845819 };
+		inline constexpr REL::ID bnet__Composite_bnet__ta__NonThreadSafe_{ 237414 };
+		inline constexpr REL::ID bnet__Composite_bnet__ta__ThreadSafe_{ 1156097 };
+		inline constexpr REL::ID bnet__ConfigurationEntry{ 1307313 };
+		inline constexpr REL::ID bnet__ConfigurationEntryBoolean{ 1386693 };
+		inline constexpr REL::ID bnet__ConfigurationEntryFloat{ 1293609 };
+		inline constexpr REL::ID bnet__ConfigurationEntryInteger{ 1340054 };
+		inline constexpr REL::ID bnet__ConfigurationEntryLong{ 1247237 };
+		inline constexpr REL::ID bnet__ConfigurationEntryPool_bnet__ConfigurationEntryBoolean_bool_{ 1093396 };
+		inline constexpr REL::ID bnet__ConfigurationEntryPool_bnet__ConfigurationEntryFloat_float_{ 42985 };
+		inline constexpr REL::ID bnet__ConfigurationEntryPool_bnet__ConfigurationEntryInteger_int_{ 1372910 };
+		inline constexpr REL::ID bnet__ConfigurationEntryPool_bnet__ConfigurationEntryLong___int64_{ 575259 };
+		inline constexpr REL::ID bnet__ConfigurationEntryPool_bnet__ConfigurationEntryString_charconst_{ 561534 };
+		inline constexpr REL::ID bnet__ConfigurationEntryString{ 1200548 };
+		inline constexpr REL::ID bnet__ConfigurationVariable_int_{ 459436 };
+		inline constexpr REL::ID bnet__DownloadFlow{ 426020 };
+		inline constexpr REL::ID bnet__EmptyTerminationCB{ 443878 };
+		inline constexpr REL::ID bnet__Entitlements__ConsumeRequest{ 336192 };
+		inline constexpr REL::ID bnet__Entitlements__ListRequest{ 742336 };
+		inline constexpr REL::ID bnet__Entitlements__SearchRequest{ 415474 };
+		inline constexpr REL::ID bnet__EventLog__LogEventRequest{ 368974 };
+		inline constexpr REL::ID bnet__EventLog____CollectErrorRequest{ 368760 };
+		inline constexpr REL::ID bnet__EventLog____CollectLogBatchRequest{ 1498943 };
+		inline constexpr REL::ID bnet__EventLog____CollectLogRequest{ 887068 };
+		inline constexpr REL::ID bnet__ExternalAuthInfo{ 10205 };
+		inline constexpr REL::ID bnet__ExternalAuthenticationFlow{ 46251 };
+		inline constexpr REL::ID bnet__ExternalServiceRetrieveAccountRequest{ 1052334 };
+		inline constexpr REL::ID bnet__FileDownloader{ 651142 };
+		inline constexpr REL::ID bnet__FreeLessHeap{ 590064 };
+		inline constexpr REL::ID bnet__GameAccountAuthenticationRequest{ 612328 };
+		inline constexpr REL::ID bnet__GameAccountExternalAuthRequest{ 785178 };
+		inline constexpr REL::ID bnet__GameAccountExternalAuthenticationFlow{ 1502219 };
+		inline constexpr REL::ID bnet__GameAccountExternalLinkConflictResolveFlow{ 917777 };
+		inline constexpr REL::ID bnet__GameAccountExternalLinkConflictResolveRequest{ 110 };
+		inline constexpr REL::ID bnet__GameAccountExternalLinkFlow{ 1175490 };
+		inline constexpr REL::ID bnet__GameAccountExternalLinkRequest{ 957683 };
+		inline constexpr REL::ID bnet__GameAccountGameCodeAuthenticationFlow{ 330815 };
+		inline constexpr REL::ID bnet__GameAccountLinkConflictResolveFlow{ 884976 };
+		inline constexpr REL::ID bnet__GameAccountLinkConflictResolveRequest{ 971327 };
+		inline constexpr REL::ID bnet__GameAccountLinkFlow{ 366638 };
+		inline constexpr REL::ID bnet__GameAccountLinkRequest{ 798919 };
+		inline constexpr REL::ID bnet__GameAccountUserCredentialsAuthenticationFlow{ 1170083 };
+		inline constexpr REL::ID bnet__GameCodeAuthenticationFlow{ 1209227 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__Entitlements__ConsumeResponse_bnet__HttpResponseInfo__{ 289362 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__{ 324681 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UgcReleaseNote_bnet__HttpResponseInfo__{ 823018 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UgcType__UploadStatus_bnet__HttpResponseInfo__{ 469519 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__AccountInfoResult__bnet__HttpResponseInfo__{ 1532495 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__AccountLinkingResult__bnet__HttpResponseInfo__{ 847370 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__{ 401049 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__BeamUserData__bnet__HttpResponseInfo__{ 242250 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__CdpAuthenticationResult__bnet__HttpResponseInfo__{ 943912 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__CdpFileInfoResult__bnet__HttpResponseInfo__{ 1136420 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__CdpKeyResult__bnet__HttpResponseInfo__{ 1216260 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__{ 452944 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__SessionValidateResult__bnet__HttpResponseInfo__{ 1013990 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__Status__ExtServerStatusResult__bnet__HttpResponseInfo__{ 286393 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__TwitchAccountInfoResult__bnet__HttpResponseInfo__{ 682793 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo__{ 16795 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo__{ 1053754 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo__{ 587740 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo__{ 1122390 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcUploadDetails__bnet__HttpResponseInfo__{ 535671 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UpgradeTokenResult__bnet__HttpResponseInfo__{ 1344298 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Catalog__Item__bnet__HttpResponseInfo__{ 141244 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__Balance__bnet__HttpResponseInfo__{ 1499187 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo__{ 434506 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__CMS__Message_5_1_bnet___impl__StdAllocator_bnet__CMS__Message____bnet__HttpResponseInfo__{ 739366 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__Count_bnet___impl__FixedString_64_1_1_bnet___impl__StdAllocator_char____40_1_bnet___impl__StdAllocator_bnet__Count_bnet___impl__FixedString_64_1_1_bnet___impl__StdAllocator_char_______bnet__HttpResponseInfo__{ 231394 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__ExternalIdAccountInfo_4_1_bnet___impl__StdAllocator_bnet__ExternalIdAccountInfo____bnet__HttpResponseInfo__{ 81619 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__{ 829250 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__Platform_10_1_bnet___impl__StdAllocator_bnet__Platform____bnet__HttpResponseInfo__{ 1264825 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcAuthor_20_1_bnet___impl__StdAllocator_bnet__UgcAuthor____bnet__HttpResponseInfo__{ 971100 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo__{ 1039897 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcNotification_20_1_bnet___impl__StdAllocator_bnet__UgcNotification____bnet__HttpResponseInfo__{ 518768 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char____const__bnet__HttpResponseInfo__{ 66284 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_128_1_1_bnet___impl__StdAllocator_char___8_1_bnet___impl__StdAllocator_bnet___impl__FixedString_128_1_1_bnet___impl__StdAllocator_char______bnet__HttpResponseInfo__{ 373471 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_32_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_32_1_1_bnet___impl__StdAllocator_char______bnet__HttpResponseInfo__{ 1105723 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__Vector_bnet__Entitlements__Item___bnet__HttpResponseInfo__{ 914781 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet__VCCS__Catalog__ListItemsResult_bnet__HttpResponseInfo__{ 659804 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet___impl__FixedString_2000_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo__{ 945303 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet___impl__FixedString_40_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo__{ 1368673 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__{ 980123 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_bool_bnet__HttpResponseInfo__{ 435941 };
+		inline constexpr REL::ID bnet__HttpRequest_bnet__Callback_unsigned__int64_bnet__HttpResponseInfo__{ 179720 };
+		inline constexpr REL::ID bnet__HttpTransport{ 637545 };
+		inline constexpr REL::ID bnet__IDispenser_bnet__Job_{ 819071 };
+		inline constexpr REL::ID bnet__IDownloader{ 911613 };
+		inline constexpr REL::ID bnet__IDynamicVariableDeleter{ 1353848 };
+		inline constexpr REL::ID bnet__IHeap{ 879294 };
+		inline constexpr REL::ID bnet__IHttpConnectionProvider{ 393897 };
+		inline constexpr REL::ID bnet__IJobCollection{ 202294 };
+		inline constexpr REL::ID bnet__IProducerConsumerQueue_bnet__UniquePtr_bnet__BaseCallback__{ 254224 };
+		inline constexpr REL::ID bnet__IProducerConsumerQueue_bnet__UniquePtr_bnet__Job__{ 1195607 };
+		inline constexpr REL::ID bnet__IUgcUploader{ 1331042 };
+		inline constexpr REL::ID bnet__IsAccountLinkableRequest{ 512639 };
+		inline constexpr REL::ID bnet__Job{ 1252525 };
+		inline constexpr REL::ID bnet__JobProcessorCollection{ 45325 };
+		inline constexpr REL::ID bnet__ListLegalDocumentsFlow{ 1267131 };
+		inline constexpr REL::ID bnet__ListRequiredLegalDocumentsRequest{ 656748 };
+		inline constexpr REL::ID bnet__LogoutFlow{ 813078 };
+		inline constexpr REL::ID bnet__Network{ 1304271 };
+		inline constexpr REL::ID bnet__NetworkLoop{ 935300 };
+		inline constexpr REL::ID bnet__NewGameSessionFlow{ 662793 };
+		inline constexpr REL::ID bnet__Parallel_bnet__ta__NonThreadSafe_bnet__ta__ErrorPropagation_{ 338221 };
+		inline constexpr REL::ID bnet__Parallel_bnet__ta__ThreadSafe_bnet__ta__NoErrorPropagation_{ 1328667 };
+		inline constexpr REL::ID bnet__ProducerConsumerQueue_bnet__UniquePtr_bnet__BaseCallback__bnet__ta__ThreadSafe_{ 347212 };
+		inline constexpr REL::ID bnet__ProducerConsumerQueue_bnet__UniquePtr_bnet__Job__bnet__ta__NonThreadSafe_{ 1021460 };
+		inline constexpr REL::ID bnet__ProducerConsumerQueue_bnet__UniquePtr_bnet__Job__bnet__ta__ThreadSafe_{ 772616 };
+		inline constexpr REL::ID bnet__RecoverPasswordRequest{ 981051 };
+		inline constexpr REL::ID bnet__RecoverUsernameRequest{ 934580 };
+		inline constexpr REL::ID bnet__ResendVerificationRequest{ 888006 };
+		inline constexpr REL::ID bnet__ResumeFlow{ 709483 };
+		inline constexpr REL::ID bnet__RetrieveExternalAccountJob{ 202524 };
+		inline constexpr REL::ID bnet__RetrieveExternalAccountRequest{ 280431 };
+		inline constexpr REL::ID bnet__Sequence_bnet__ta__NonThreadSafe_bnet__ta__ErrorPropagation_{ 769509 };
+		inline constexpr REL::ID bnet__Sequence_bnet__ta__ThreadSafe_bnet__ta__ErrorPropagation_{ 579933 };
+		inline constexpr REL::ID bnet__SessionAnonymousAccountCreateRequest{ 321671 };
+		inline constexpr REL::ID bnet__SessionAnonymousCreateFlow{ 1417459 };
+		inline constexpr REL::ID bnet__SessionAuthRequest{ 447595 };
+		inline constexpr REL::ID bnet__SessionExternalAuthRequest{ 1484721 };
+		inline constexpr REL::ID bnet__SessionLogoutRequest{ 1070681 };
+		inline constexpr REL::ID bnet__SessionQuickCreateFlow{ 792642 };
+		inline constexpr REL::ID bnet__SessionQuickCreateRequest{ 494327 };
+		inline constexpr REL::ID bnet__SessionRefreshRequest{ 231615 };
+		inline constexpr REL::ID bnet__SessionResumeFlow{ 363542 };
+		inline constexpr REL::ID bnet__SessionResumeRequest{ 1501529 };
+		inline constexpr REL::ID bnet__SessionResumeTokenRequest{ 1196277 };
+		inline constexpr REL::ID bnet__SessionTokenRequest{ 185137 };
+		inline constexpr REL::ID bnet__SessionValidateRequest{ 1060671 };
+		inline constexpr REL::ID bnet__Session__GameAccountGameCodeAuthRequest{ 1130343 };
+		inline constexpr REL::ID bnet__Session__GameCodeAuthRequest{ 1437630 };
+		inline constexpr REL::ID bnet__Status__GetExtServerStatusRequest{ 1476961 };
+		inline constexpr REL::ID bnet__SteamExternalAuthInfo{ 1326832 };
+		inline constexpr REL::ID bnet__SuspendFlow{ 1035213 };
+		inline constexpr REL::ID bnet__TokenUpgradeRequest{ 27819 };
+		inline constexpr REL::ID bnet__TwitchAccountInfoRequest{ 509639 };
+		inline constexpr REL::ID bnet__UgcAddReleaseNoteRequest{ 650397 };
+		inline constexpr REL::ID bnet__UgcAddVideoRequest{ 329912 };
+		inline constexpr REL::ID bnet__UgcArgLessRequest{ 105229 };
+		inline constexpr REL::ID bnet__UgcBrowseRequest{ 1169198 };
+		inline constexpr REL::ID bnet__UgcCancelUploadRequest{ 1023969 };
+		inline constexpr REL::ID bnet__UgcCategoryCountRequest{ 58440 };
+		inline constexpr REL::ID bnet__UgcChunkUploadRequest{ 1229872 };
+		inline constexpr REL::ID bnet__UgcChunkedUploadCompletionRequest{ 1197017 };
+		inline constexpr REL::ID bnet__UgcChunkedUploadInitiationRequest{ 6163 };
+		inline constexpr REL::ID bnet__UgcContentRequest{ 283234 };
+		inline constexpr REL::ID bnet__UgcContentUploadDetailsRequest{ 362633 };
+		inline constexpr REL::ID bnet__UgcContentUploadRequest{ 1533934 };
+		inline constexpr REL::ID bnet__UgcCreationRequest{ 1100488 };
+		inline constexpr REL::ID bnet__UgcEditRequest{ 36128 };
+		inline constexpr REL::ID bnet__UgcFlagRequest{ 1352429 };
+		inline constexpr REL::ID bnet__UgcImageUploadRequest{ 376519 };
+		inline constexpr REL::ID bnet__UgcListBlacklistedRequest{ 1476026 };
+		inline constexpr REL::ID bnet__UgcListByEntitlementIdsRequest{ 444320 };
+		inline constexpr REL::ID bnet__UgcListCategoriesRequest{ 414561 };
+		inline constexpr REL::ID bnet__UgcListContentRequest{ 1086601 };
+		inline constexpr REL::ID bnet__UgcListDlcRequest{ 1152313 };
+		inline constexpr REL::ID bnet__UgcListFeaturedContentRequest{ 271942 };
+		inline constexpr REL::ID bnet__UgcListFollowedAuthorRequest{ 798701 };
+		inline constexpr REL::ID bnet__UgcListNotificationRequest{ 345851 };
+		inline constexpr REL::ID bnet__UgcMtxPurchaseFlow{ 999461 };
+		inline constexpr REL::ID bnet__UgcNotificationAcknowledgeRequest{ 836775 };
+		inline constexpr REL::ID bnet__UgcPreviewUploadRequest{ 1009293 };
+		inline constexpr REL::ID bnet__UgcQueryRequest{ 962751 };
+		inline constexpr REL::ID bnet__UgcRateRequest{ 916156 };
+		inline constexpr REL::ID bnet__UgcRemoveReleaseNoteRequest{ 463369 };
+		inline constexpr REL::ID bnet__UgcUpdateReleaseNoteRequest{ 510344 };
+		inline constexpr REL::ID bnet__UgcUploadRequest_bnet__Callback_bnet__UgcType__UploadStatus_bnet__HttpResponseInfo__{ 124314 };
+		inline constexpr REL::ID bnet__Ugc__ListPlatformsRequest{ 1311268 };
+		inline constexpr REL::ID bnet__Ugc__ListProductsRequest{ 419970 };
+		inline constexpr REL::ID bnet__Ugc__RefreshEntitlementRequest{ 416863 };
+		inline constexpr REL::ID bnet__UnlinkAccountFlow{ 364287 };
+		inline constexpr REL::ID bnet__UserCredentialsAuthenticationFlow{ 372750 };
+		inline constexpr REL::ID bnet__UserProcessor{ 449659 };
+		inline constexpr REL::ID bnet__UserProcessorCollection{ 92130 };
+		inline constexpr REL::ID bnet__UserQueue{ 577577 };
+		inline constexpr REL::ID bnet__UsernameValidationRequest{ 210891 };
+		inline constexpr REL::ID bnet__VCCS__Catalog__GetItemRequest{ 1550913 };
+		inline constexpr REL::ID bnet__VCCS__Catalog__ListItemsRequest{ 486711 };
+		inline constexpr REL::ID bnet__VCCS__Fulfillment__UpdateFirstPartyEntitlementRequest{ 939244 };
+		inline constexpr REL::ID bnet__VCCS__Wallet__BalanceRequest{ 1545568 };
+		inline constexpr REL::ID bnet__VCCS__Wallet__PurchaseRequest{ 262022 };
+		inline constexpr REL::ID bnet__VerifyFingerprintRequest{ 383416 };
+		inline constexpr REL::ID bnet__VerifyLinkRequest{ 556441 };
+		inline constexpr REL::ID bnet__WinHttpTransport{ 371315 };
+		inline constexpr REL::ID bnet____ModuleDeleter{ 281600 };
+		inline constexpr REL::ID bnet___detail__Composite{ 1518611 };
+		inline constexpr REL::ID bnet___detail__implComposite_bnet__ta__NonThreadSafe_{ 409907 };
+		inline constexpr REL::ID bnet___detail__implComposite_bnet__ta__ThreadSafe_{ 544854 };
+		inline constexpr REL::ID bnet___impl__AsyncOperation{ 251159 };
+		inline constexpr REL::ID bnet___impl__FixedPool_152_50_{ 621870 };
+		inline constexpr REL::ID bnet___impl__FixedPool_163840_3_{ 598643 };
+		inline constexpr REL::ID bnet___impl__FixedPool_432_50_{ 29001 };
+		inline constexpr REL::ID bnet___impl__IPool{ 289840 };
+		inline constexpr REL::ID bnet___impl__MemoryDeleter_HINSTANCE___{ 454102 };
+		inline constexpr REL::ID bnet___impl__MemoryDeleter__SECURITY_FUNCTION_TABLE_Aconst_{ 1065806 };
+		inline constexpr REL::ID bnet___impl__Observable_bnet___impl__AsyncOperation_bnet__BNetError_{ 1567624 };
+		inline constexpr REL::ID bnet___impl__OneToManyObservable_bnet__ConfigurationEntry_{ 1041318 };
+		inline constexpr REL::ID bnet___impl__OneToManyObserver_bnet__ConfigurationEntry_{ 267972 };
+		inline constexpr REL::ID bnet___impl__RefCount{ 303697 };
+		inline constexpr REL::ID bnet___impl__SharedMutex{ 37565 };
+		inline constexpr REL::ID bool___BSScrapArray_BSScript__Variable__{ 1175523 };
+	}
+}
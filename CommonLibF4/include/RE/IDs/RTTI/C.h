@@ -0,0 +1,1354 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID CCallResult_BSSteamSystemUtility_EncryptedAppTicketResponse_t_{ 787673 };
+		inline constexpr REL::ID CCallbackBase{ 1193383 };
+		inline constexpr REL::ID CCallback_BSSteamSystemUtility_DlcInstalled_t_0_{ 176172 };
+		inline constexpr REL::ID CCallback_BSSteamSystemUtility_GameOverlayActivated_t_0_{ 708415 };
+		inline constexpr REL::ID CXAPOBase{ 617045 };
+		inline constexpr REL::ID CachedRaycastData{ 1039674 };
+		inline constexpr REL::ID CalcContainerWeight{ 1199000 };
+		inline constexpr REL::ID CalmEffect{ 706486 };
+		inline constexpr REL::ID CameraOverrideStartHandler{ 435486 };
+		inline constexpr REL::ID CameraOverrideStopHandler{ 389054 };
+		inline constexpr REL::ID CameraShakeHandler{ 1123585 };
+		inline constexpr REL::ID CameraZoomHandler{ 504509 };
+		inline constexpr REL::ID CellHfCollision{ 251026 };
+		inline constexpr REL::ID CellLoaderTask{ 157784 };
+		inline constexpr REL::ID ChainExplosion{ 753884 };
+		inline constexpr REL::ID ChairEnterHandler{ 688295 };
+		inline constexpr REL::ID ChairFurnitureExitHandler{ 721311 };
+		inline constexpr REL::ID CharacterCollisionHandler{ 138969 };
+		inline constexpr REL::ID CharacterCollisionMessagePlayerAdapter{ 1057229 };
+		inline constexpr REL::ID CharacterEvent{ 779419 };
+		inline constexpr REL::ID CheckFastTravelCommand{ 68381 };
+		inline constexpr REL::ID CheckGoalReachedFunctor{ 220444 };
+		inline constexpr REL::ID CheckHardcoreFastTravelCommand{ 7369 };
+		inline constexpr REL::ID CheckLineOfSightFilterMisc{ 1344842 };
+		inline constexpr REL::ID CheckParameterReachedFunctor{ 533139 };
+		inline constexpr REL::ID CheckStoppedMovingFunctor{ 1536775 };
+		inline constexpr REL::ID CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 925538 };
+		inline constexpr REL::ID CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 1290957 };
+		inline constexpr REL::ID CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 64700 };
+		inline constexpr REL::ID CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 1581554 };
+		inline constexpr REL::ID CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 1046196 };
+		inline constexpr REL::ID CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 777603 };
+		inline constexpr REL::ID CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 943998 };
+		inline constexpr REL::ID CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 1559979 };
+		inline constexpr REL::ID CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy_{ 820301 };
+		inline constexpr REL::ID CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 529858 };
+		inline constexpr REL::ID CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ 653870 };
+		inline constexpr REL::ID CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy_{ 1167168 };
+		inline constexpr REL::ID CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy_{ 1067689 };
+		inline constexpr REL::ID ClearIdleCommand{ 899203 };
+		inline constexpr REL::ID ClickHandler{ 644596 };
+		inline constexpr REL::ID CloakEffect{ 1299058 };
+		inline constexpr REL::ID Clouds{ 884899 };
+		inline constexpr REL::ID CollectionAnimationSpeedContour{ 526394 };
+		inline constexpr REL::ID CombatAcquireSearchDebugData{ 1142427 };
+		inline constexpr REL::ID CombatAimController{ 155195 };
+		inline constexpr REL::ID CombatAimControllerBase{ 1471512 };
+		inline constexpr REL::ID CombatAnimatedPath{ 372348 };
+		inline constexpr REL::ID CombatApproachTargetPathController{ 1480183 };
+		inline constexpr REL::ID CombatArea{ 1085412 };
+		inline constexpr REL::ID CombatAreaHoldPosition{ 433807 };
+		inline constexpr REL::ID CombatAreaReference{ 965999 };
+		inline constexpr REL::ID CombatAreaShape{ 600228 };
+		inline constexpr REL::ID CombatAreaStandard{ 700544 };
+		inline constexpr REL::ID CombatBehaviorMoveInCover{ 887364 };
+		inline constexpr REL::ID CombatBehaviorResource{ 119704 };
+		inline constexpr REL::ID CombatBehaviorTree{ 237424 };
+		inline constexpr REL::ID CombatBehaviorTreeAcquireObject{ 1095909 };
+		inline constexpr REL::ID CombatBehaviorTreeAction{ 300060 };
+		inline constexpr REL::ID CombatBehaviorTreeActionEquipmentSelector{ 253651 };
+		inline constexpr REL::ID CombatBehaviorTreeAvoidThreat{ 807198 };
+		inline constexpr REL::ID CombatBehaviorTreeBlock{ 26286 };
+		inline constexpr REL::ID CombatBehaviorTreeBow{ 530112 };
+		inline constexpr REL::ID CombatBehaviorTreeChargingCloseMovement{ 1553759 };
+		inline constexpr REL::ID CombatBehaviorTreeChargingMovement{ 64573 };
+		inline constexpr REL::ID CombatBehaviorTreeCheckUnreachableTarget{ 1413118 };
+		inline constexpr REL::ID CombatBehaviorTreeCloseMovement{ 70443 };
+		inline constexpr REL::ID CombatBehaviorTreeCombat{ 1203020 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpEquals___{ 119900 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_float_CombatBehaviorContextCover____void___float_OpLessThan___{ 702238 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextSearch_unsignedint_CombatBehaviorContextSearch____void___unsignedint_OpGreaterThan___{ 512010 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatState_unsignedint_CombatState____void___int_OpGreaterThan___{ 97298 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ 367567 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc1_float___Actor__CombatBehaviorTree__CombatBehaviorAttacker_____{ 495987 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection______{ 1044687 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc2_float___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget_____{ 177548 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc_float___void______{ 815628 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextChargingMovement_float_CombatBehaviorContextChargingMovement____bool__bool_____{ 870328 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_float_CombatBehaviorContextChargingMovement____void______{ 365948 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextGrenade_float_CombatBehaviorContextGrenade____void______{ 554363 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextMagic_float_CombatBehaviorContextMagic____void______{ 552848 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextThrow_float_CombatBehaviorContextThrow____void______{ 1239231 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBlackboard_bool_CombatBlackboard____CombatBlackboardFlagconst__CombatBlackboardFlag___{ 1061637 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_AIProcess_bool_AIProcess____void____{ 1144726 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_ActorState____void____{ 871120 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void____{ 937685 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_bool_CombatBehaviorContextAcquireObject____void____{ 1065259 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAvoidThreat_bool_CombatBehaviorContextAvoidThreat____void____{ 208021 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCloseMovement_bool_CombatBehaviorContextCloseMovement____void____{ 892891 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void____{ 1299479 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextFlankingMovement_bool_CombatBehaviorContextFlankingMovement____void____{ 319912 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextFlee_bool_CombatBehaviorContextFlee____void____{ 1296942 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextGun_bool_CombatBehaviorContextGun____void____{ 748627 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextRangedMovement_bool_CombatBehaviorContextRangedMovement____void____{ 738258 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_bool_CombatBehaviorEquipContext____void____{ 675874 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorFunc2_bool___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget__OpNot___{ 1011055 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc1_CombatGroup_bool_CombatGroup____Actor__CombatBehaviorTree__CombatBehaviorTarget__OpNot___{ 180504 };
+		inline constexpr REL::ID CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void___OpNot___{ 1326873 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextBow_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ 264057 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextGrenade_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ 861337 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextGun_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ 792888 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextMagic_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ 1499292 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextThrow_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ 295653 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextUsePotion_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ 194572 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode1_CombatBehaviorEquipContext_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorThread_unsignedint_CombatBehaviorThread____void____{ 851265 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode2_CombatBehaviorContextBlock_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____CombatBehaviorContextMelee__ATTACK_TYPE_{ 1562629 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode2_CombatBehaviorContextMelee_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____CombatBehaviorContextMelee__ATTACK_TYPE_{ 1374860 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNodeBase{ 1268563 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextAcquireObject_{ 97586 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextAvoidThreat_{ 369814 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextBlock_{ 1109857 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextBow_{ 516226 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextChargingMovement_{ 161272 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextCloseMovement_{ 243069 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextCover_{ 269227 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextFindAttackLocation_{ 438649 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextFlankingMovement_{ 374975 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextFlee_{ 1448396 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextGrenade_{ 1113647 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextGun_{ 1044831 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextHide_{ 115238 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextMagic_{ 169110 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextMelee_{ 483816 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextMovementRequest_{ 930156 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextRangedMovement_{ 1539115 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextSearch_{ 290146 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextThrow_{ 548342 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorContextUsePotion_{ 446222 };
+		inline constexpr REL::ID CombatBehaviorTreeCreateContextNode_CombatBehaviorEquipContext_{ 1369315 };
+		inline constexpr REL::ID CombatBehaviorTreeFindAttackLocation{ 703732 };
+		inline constexpr REL::ID CombatBehaviorTreeFindValidLocation{ 1321560 };
+		inline constexpr REL::ID CombatBehaviorTreeFlankingMovement{ 342508 };
+		inline constexpr REL::ID CombatBehaviorTreeFlee{ 1073642 };
+		inline constexpr REL::ID CombatBehaviorTreeFlight{ 1162553 };
+		inline constexpr REL::ID CombatBehaviorTreeGrenade{ 1127277 };
+		inline constexpr REL::ID CombatBehaviorTreeGun{ 839305 };
+		inline constexpr REL::ID CombatBehaviorTreeHide{ 132022 };
+		inline constexpr REL::ID CombatBehaviorTreeLinkNode{ 1296010 };
+		inline constexpr REL::ID CombatBehaviorTreeLowCombat{ 923198 };
+		inline constexpr REL::ID CombatBehaviorTreeMagic{ 1545683 };
+		inline constexpr REL::ID CombatBehaviorTreeMelee{ 291774 };
+		inline constexpr REL::ID CombatBehaviorTreeMovement{ 108095 };
+		inline constexpr REL::ID CombatBehaviorTreeMovementRequest{ 976681 };
+		inline constexpr REL::ID CombatBehaviorTreeNode{ 1534658 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeCondition_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpEquals___{ 1225411 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void____{ 1077765 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextFlee_bool_CombatBehaviorContextFlee____void____{ 557240 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextMovementRequest_bool_CombatBehaviorContextMovementRequest____void____{ 211824 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_bool_CombatBehaviorEquipContext____void____{ 1580660 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void____{ 474452 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAvoidThreat_bool_CombatBehaviorContextAvoidThreat____void___OpNot___{ 528988 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___OpNot___{ 861219 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeExecuteFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextChargingMovement_void_CombatBehaviorContextChargingMovement____float__float___{ 423939 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeExecuteFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextSearch_void_CombatBehaviorContextSearch____CombatCoverLocation__std__nullptr_t___{ 287122 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeExecuteFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_void_CombatBehaviorContextChargingMovement____void____{ 1249809 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorAcquireFurniture_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_CombatAcquireObjectconst_CombatBehaviorContextAcquireObject____void____{ 308554 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorAcquireItem_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_CombatAcquireObjectconst_CombatBehaviorContextAcquireObject____void____{ 1026924 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorCastConcentrationSpell_bool_{ 141347 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorCastImmediateSpell_bool_{ 155311 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorChargePast_bool_{ 621430 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorCheckRangedTarget__CombatBehaviorExpression_CombatBehaviorFunc1_float___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ 1031312 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorTrackTarget__float_{ 1317172 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorDynamicSelector_ConditionalChildSelector__float_{ 1432822 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorEnableBlackboardFlag_CombatBlackboardFlag_{ 1165577 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorFindCover_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ 808949 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorFlee_float_{ 249866 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorFollowPath_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_NiPointer_CombatPath__CombatBehaviorContextAcquireObject____void____{ 163466 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorIdle_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ 280757 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorIdle_CombatBehaviorExpression_CombatBehaviorFunc2_float___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget___{ 1340375 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorIdle_float_{ 248346 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorLandNearby_float_{ 679921 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorLand_float_{ 1038594 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorMovementIdle_float_{ 294894 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorRepeat_CombatBehaviorRepeat__FLAGS_{ 175203 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorRepeat_float_{ 1068236 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorResetResource_BSFixedString_{ 833115 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorSearchCenter_CombatSearchLocation__PRIORITY_{ 674401 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorSearchInvestigateFromCover_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ 487442 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorSearchLocation_CombatSearchLocation__PRIORITY_{ 90101 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorSearchWander_CombatSearchLocation__PRIORITY_{ 860491 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorSearch_CombatSearchLocation__PRIORITY_{ 1486155 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorWaitBehindCover_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ 1558010 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject1_CombatBehaviorWatchTarget_float_{ 1383790 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorAcquireResource_BSFixedString_CombatBehaviorResource__PRIORITY_{ 291013 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorChangeResourcePriority_BSFixedString_CombatBehaviorResource__PRIORITY_{ 1498107 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorFaceAngle_float_bool_{ 315528 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorMoveToReference_CombatBehaviorExpression_CombatBehaviorFunc_TESObjectREFR___void____float_{ 978916 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorSetBlackboardData_CombatBlackboardKey_AITimeStamp__CombatBehaviorExpression_CombatBehaviorFunc_float___void____{ 1008944 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorSetBlackboardFlag_CombatBlackboardFlag_bool_{ 1435928 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorSpawnParallel_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatInventory_unsignedint_CombatInventory____void____CombatBehaviorParallel__FLAGS_{ 426162 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject2_CombatBehaviorWithdraw_CombatPath__SPEED_CombatPath__SPEED_{ 1540195 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject3_CombatBehaviorAcquireResource_BSFixedString_CombatBehaviorResource__PRIORITY_CombatBehaviorAcquireResource__FLAGS_{ 522649 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject3_CombatBehaviorAnimate_CombatAnimation__ANIM_int_bool_{ 479012 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject3_CombatBehaviorWithdraw_CombatPath__SPEED_CombatPath__SPEED_bool_{ 1526507 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAOEAttack_{ 876441 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireFurniture_{ 122097 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireItem_{ 840643 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireOptimalRange_{ 1431725 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireResource_{ 1075406 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAdjustRange_{ 447200 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAdvance_{ 701265 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAnimate_{ 385780 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAttackFromCover_{ 1091539 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAttackLow_{ 1488470 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAttack_{ 1081543 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAvoidThreatCover_{ 846807 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorAvoidThreat_{ 1364803 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBackoff_{ 286397 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBash_{ 125371 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlindFireFromCover_{ 27165 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlockAttack_{ 45686 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlockThreat_{ 1427606 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlock_{ 1348145 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorBowAttack_{ 595963 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCastConcentrationSpell_{ 1191676 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCastImmediateSpell_{ 1205574 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeCoverDirection_{ 1143516 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeCoverPosition_{ 1340589 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeCoverStance_{ 822607 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeResourcePriority_{ 1138417 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChargePast_{ 1553987 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChase_{ 254331 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCheckUnreachableTarget_{ 1562113 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_ConditionalChildSelector__{ 495173 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_IndexChildSelector__{ 419485 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_RandomChanceChildSelector__{ 753056 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_RandomChoiceChildSelector__{ 1278105 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_ValueChildSelector__{ 118995 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCircleDistant_{ 827112 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCircle_{ 207182 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorComposite_CombatBehaviorCrouch_CombatBehaviorCheckRangedTarget__{ 247243 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorCheckRangedTarget__{ 579085 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorTrackTarget__{ 519328 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverAdvance_{ 224947 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverFlank_{ 1288790 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverPairedRush_{ 770736 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverRush_{ 304217 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorDistract_{ 534167 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorDiveBomb_{ 1252836 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorDodgeThreat_{ 328610 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorDynamicConditionalNode_{ 305515 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorDynamicSelector_ConditionalChildSelector__{ 196550 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorEnableBlackboardFlag_{ 1511276 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorEquipObject_{ 1076031 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorEquipRangedWeapon_{ 11564 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorEquipSpell_{ 530432 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorEvadeThreat_{ 1392382 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFaceAngle_{ 1365481 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackSelector_NextChildSelector__{ 54003 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackSelector_RandomChanceChildSelector__{ 957077 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackSelector_WeightedRandomChildSelector__{ 136704 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackToRanged_{ 308778 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallback_{ 127523 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindAllyAttackLocation_{ 1102434 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindAttackLocation_{ 770811 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindCover_{ 348451 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindHoldPositionAttackLocation_{ 145351 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindLateralAttackLocation_{ 1395686 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindObject_{ 1054555 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindValidLocationLargeActor_{ 377053 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindValidLocationOnNavmesh_{ 190863 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindValidLocation_{ 1002176 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlankDistant_{ 333749 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlank_{ 613603 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFleeThroughDoor_{ 622913 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFleeToAlly_{ 104630 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFleeToCover_{ 1141032 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlee_{ 1220806 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlipDynamicObject_{ 797331 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlyingAttack_{ 707429 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorFollowPath_{ 1559301 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorForceFail_{ 1153238 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorForceSuccess_{ 1576937 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGrenadeFlushTarget_{ 568067 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGrenadeThrowAtGroup_{ 1086139 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGrenadeThrow_{ 49534 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGroundAttack_{ 1532595 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunBurstFire_{ 1083096 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunFireCharge_{ 975979 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunFire_{ 46475 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunReloadBehindCover_{ 868892 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunReload_{ 948575 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunSuppressiveBurstFire_{ 18695 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunSuppressiveFireCharge_{ 1494716 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunSuppressiveFire_{ 565025 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorHide_{ 1445277 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorHover_{ 29338 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorIdle_{ 859747 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorIgnoreFailure_{ 625510 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorImmediateFallbackSelector_NextChildSelector__{ 183589 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorLandNearby_{ 147506 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorLand_{ 68038 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorLoopFallbackSelector_NextChildSelector__{ 672142 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorLoop_{ 427916 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorMaintainOptimalRange_{ 913706 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorMoveToReference_{ 1058407 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorMovementIdle_{ 1345103 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorMovementRequest_{ 10923 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorOrbitDistant_{ 682908 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorOrbit_{ 762203 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorPanic_{ 1527989 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorParallel_{ 1548500 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorParry_{ 1507635 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorPause_{ 689623 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorPerchAttack_{ 189004 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorPrepareDualCast_{ 687462 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorPursueTarget_{ 424030 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorRepeat_{ 679811 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorReposition_{ 939254 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorResetResource_{ 740180 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorRetargetAttack_{ 17140 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorReturnToCombatArea_{ 484027 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchCenter_{ 1019459 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchInvestigateDoor_{ 819367 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchInvestigateFromCover_{ 1444527 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchLocation_{ 435285 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchTakeCover_{ 622159 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchWander_{ 1206243 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearch_{ 1392310 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSequence_{ 1010950 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSetBlackboardData_{ 1527550 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSetBlackboardFlag_{ 199553 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSideswipe_{ 475963 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSpawnParallel_{ 1383095 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSpecialAttack_{ 1001947 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSprintAway_{ 489726 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorStalk_{ 893326 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorStrafe_{ 1511720 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorSurround_{ 780526 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorTakeoff_{ 164344 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorThrow_{ 627843 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorTrackTarget_{ 847478 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorUsePotion_{ 526069 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorUseTurret_{ 201753 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitBehindCover_{ 507550 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForCondition_{ 267103 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForEvent_CombatNewThreatEvent__{ 23959 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForEvent_CombatUnreachableTargetAddedEventconst__{ 231920 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForMovementRequest_{ 304893 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWatchTarget_{ 851906 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObjectBase_CombatBehaviorWithdraw_{ 956128 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAOEAttack_{ 265148 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAcquireOptimalRange_{ 381645 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAdjustRange_{ 979338 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAdvance_{ 89339 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAttackFromCover_{ 41146 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAttackLow_{ 876528 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAttack_{ 469856 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAvoidThreatCover_{ 1378625 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorAvoidThreat_{ 314889 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBackoff_{ 1257347 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBash_{ 1096124 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBlindFireFromCover_{ 559734 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBlockAttack_{ 577949 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBlockThreat_{ 377545 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBlock_{ 737170 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorBowAttack_{ 1566803 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCastConcentrationSpell_{ 1098465 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCastImmediateSpell_{ 673694 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChangeCoverDirection_{ 93339 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChangeCoverPosition_{ 290379 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChangeCoverStance_{ 1354346 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChargePast_{ 503566 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChase_{ 1225202 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCheckUnreachableTarget_{ 511586 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_ConditionalChildSelector__{ 149913 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_IndexChildSelector__{ 512892 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_RandomChanceChildSelector__{ 407168 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_RandomChoiceChildSelector__{ 932534 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_ValueChildSelector__{ 212455 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCircleDistant_{ 1358796 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCircle_{ 1177817 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorComposite_CombatBehaviorCrouch_CombatBehaviorCheckRangedTarget__{ 1045164 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCoverAdvance_{ 757093 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCoverFlank_{ 238592 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCoverPairedRush_{ 1302448 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorCoverRush_{ 1275094 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorDistract_{ 1505111 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorDiveBomb_{ 641451 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorDodgeThreat_{ 860558 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorDynamicConditionalNode_{ 837596 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorEquipObject_{ 25360 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorEquipRangedWeapon_{ 544305 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorEquipSpell_{ 1062257 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorEvadeThreat_{ 342272 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFallbackSelector_NextChildSelector__{ 147401 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFallbackSelector_RandomChanceChildSelector__{ 611707 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFallbackSelector_WeightedRandomChildSelector__{ 1373245 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFallbackToRanged_{ 840845 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFallback_{ 1098369 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindAllyAttackLocation_{ 52021 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindAttackLocation_{ 1302527 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindCover_{ 1319224 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindHoldPositionAttackLocation_{ 238663 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindLateralAttackLocation_{ 345520 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindObject_{ 3733 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindValidLocationLargeActor_{ 470098 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindValidLocationOnNavmesh_{ 283761 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFindValidLocation_{ 1534506 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFlankDistant_{ 865570 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFlank_{ 1382 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFleeThroughDoor_{ 1154772 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFleeToAlly_{ 636734 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFleeToCover_{ 90838 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFlee_{ 609156 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFlipDynamicObject_{ 1328891 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorFlyingAttack_{ 1239107 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorForceFail_{ 542046 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorForceSuccess_{ 526616 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGrenadeFlushTarget_{ 1100010 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGrenadeThrowAtGroup_{ 35623 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGrenadeThrow_{ 581834 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGroundAttack_{ 482159 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunBurstFire_{ 32524 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunFireCharge_{ 1508417 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunFire_{ 1017291 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunReloadBehindCover_{ 1400976 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunReload_{ 337089 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunSuppressiveBurstFire_{ 551396 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunSuppressiveFireCharge_{ 443848 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorGunSuppressiveFire_{ 1096945 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorHide_{ 833804 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorHover_{ 1000291 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorIgnoreFailure_{ 1157373 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorImmediateFallbackSelector_NextChildSelector__{ 1419901 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorLand_{ 1197870 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorLoopFallbackSelector_NextChildSelector__{ 326338 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorLoop_{ 1398609 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorMaintainOptimalRange_{ 1445738 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorMovementRequest_{ 543703 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorOrbitDistant_{ 1214755 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorOrbit_{ 150597 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorPanic_{ 916264 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorParallel_{ 936820 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorParry_{ 895877 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorPause_{ 77870 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorPerchAttack_{ 721154 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorPrepareDualCast_{ 1219423 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorPursueTarget_{ 956221 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorRepeat_{ 67937 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorReposition_{ 1471534 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorRetargetAttack_{ 549826 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorReturnToCombatArea_{ 1016014 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSearchInvestigateDoor_{ 1351063 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSearchTakeCover_{ 1154001 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSequence_{ 399476 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSideswipe_{ 1446840 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSpecialAttack_{ 1534264 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSprintAway_{ 1021692 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorStalk_{ 281707 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorStrafe_{ 899989 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorSurround_{ 169005 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorTakeoff_{ 1134900 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorThrow_{ 15600 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorTrackTarget_{ 1379308 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorUsePotion_{ 1497117 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorUseTurret_{ 1172333 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorWaitBehindCover_{ 1039461 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorWaitForCondition_{ 799256 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorWaitForEvent_CombatNewThreatEvent__{ 117560 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorWaitForEvent_CombatUnreachableTargetAddedEventconst__{ 1468775 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorWaitForMovementRequest_{ 837008 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeObject_CombatBehaviorWithdraw_{ 344484 };
+		inline constexpr REL::ID CombatBehaviorTreeNodeUpdateFunction_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextSearch_bool_CombatBehaviorContextSearch____void___OpNot___{ 805756 };
+		inline constexpr REL::ID CombatBehaviorTreeRangedMovement{ 236600 };
+		inline constexpr REL::ID CombatBehaviorTreeReturnToCombatArea{ 3224 };
+		inline constexpr REL::ID CombatBehaviorTreeRootNode{ 1342565 };
+		inline constexpr REL::ID CombatBehaviorTreeSearch{ 1242612 };
+		inline constexpr REL::ID CombatBehaviorTreeThrow{ 342360 };
+		inline constexpr REL::ID CombatBehaviorTreeUseCover{ 933963 };
+		inline constexpr REL::ID CombatBehaviorTreeUsePotion{ 240907 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_float_CombatBehaviorExpression_CombatBehaviorFunc1_float___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ 563387 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_float_CombatBehaviorExpression_CombatBehaviorFunc2_float___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget___{ 817524 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_float_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_float_CombatBehaviorContextCover____void____{ 76582 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_COMBAT_WEAPON_TYPE_{ 727909 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpEquals___{ 1515969 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void___CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpNotEquals___OpOr___{ 52935 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_bool_CombatBehaviorContextAcquireObject____void___bool_OpEquals___{ 1252008 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatInventory_float_CombatInventory____void___float_OpGreaterThan___{ 1421000 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void____OpOr___{ 291325 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___OpNot__CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorFunc2_float___TESObjectREFRconst_TESObjectREFRconst__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget__float_OpLessThan___OpAnd___{ 1367125 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorFunc1_COMBAT_WEAPON_TYPE___CombatInventoryItemconst__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void______{ 302415 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorFunc1_bool___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ 212156 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextChargingMovement_bool_CombatBehaviorContextChargingMovement____bool__bool___{ 1029402 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_ActorState____void____{ 1328992 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void____{ 227100 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAvoidThreat_bool_CombatBehaviorContextAvoidThreat____void____{ 287177 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextBlock_bool_CombatBehaviorContextBlock____void____{ 536781 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_bool_CombatBehaviorContextChargingMovement____void____{ 1109026 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_bool_CombatBehaviorContextCloseMovement____void____{ 1188547 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCloseMovement_bool_CombatBehaviorContextCloseMovement____void____{ 813449 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void____{ 940226 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextGun_CombatBehaviorContextGun__ATTACK_TYPE_CombatBehaviorContextGun____void____{ 416400 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextMagic_MagicSystem__CastingType_CombatBehaviorContextMagic____void____{ 566536 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_CombatInventoryItem__TYPE_CombatBehaviorEquipContext____void____{ 316263 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatGroup_bool_CombatGroup____void____{ 1073876 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void____{ 1474732 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorFunc1_bool___Actor__CombatBehaviorTree__CombatBehaviorAttacker__OpNot___{ 1303422 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc1_CombatController_bool_CombatController____Actor__CombatBehaviorTree__CombatBehaviorAttacker__OpNot___{ 676750 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_Actor_bool_ActorState____void___OpNot___{ 219776 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void___OpNot___{ 1116953 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_bool_CombatBehaviorEquipContext____void___OpNot___{ 1300697 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___OpNot___{ 555852 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_CombatInventoryItem__TYPE_{ 834548 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_MagicSystem__CastingType_{ 1084578 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNodeT_unsignedint_int_{ 1122617 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNode_float_{ 642981 };
+		inline constexpr REL::ID CombatBehaviorTreeValueNode_unsignedint_{ 1076112 };
+		inline constexpr REL::ID CombatBehaviorTreeWrapperNode{ 1581225 };
+		inline constexpr REL::ID CombatBlackboardKey_AITimeStamp_{ 1486984 };
+		inline constexpr REL::ID CombatBlackboardKey_AITimer_{ 1426986 };
+		inline constexpr REL::ID CombatBlackboardKey_BSTSet_BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ 1259896 };
+		inline constexpr REL::ID CombatBlackboardKey_BSTSet_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ 168304 };
+		inline constexpr REL::ID CombatBlackboardKey_BSTTuple_TESObjectREFR_AITimeStamp__{ 1260274 };
+		inline constexpr REL::ID CombatBlackboardKey_CombatSuppressiveFireBehavior_{ 1029614 };
+		inline constexpr REL::ID CombatBlackboardKey_NiPointer_CombatCoverLocation__{ 1145022 };
+		inline constexpr REL::ID CombatBlackboardMemberBase{ 1533452 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_AITimeStamp_{ 77235 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_AITimer_{ 17273 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_BSTSet_BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ 900583 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_BSTSet_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ 247585 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_BSTTuple_TESObjectREFR_AITimeStamp__{ 728548 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_CombatSuppressiveFireBehavior_{ 58889 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatBlackboardMemberBase_NiPointer_CombatCoverLocation__{ 613233 };
+		inline constexpr REL::ID CombatBlackboardMember_CombatStaticBlackboardMemberBase_AITimer_{ 324777 };
+		inline constexpr REL::ID CombatChangePositionPathController{ 782225 };
+		inline constexpr REL::ID CombatChargingSearchData{ 264917 };
+		inline constexpr REL::ID CombatCluster{ 1572721 };
+		inline constexpr REL::ID CombatCoverLocation{ 576393 };
+		inline constexpr REL::ID CombatCoverSearch{ 263710 };
+		inline constexpr REL::ID CombatCoverSearchDebugData{ 310300 };
+		inline constexpr REL::ID CombatCoverSearchResult{ 842353 };
+		inline constexpr REL::ID CombatCoveredPath{ 550221 };
+		inline constexpr REL::ID CombatCoveredPathDebugData{ 838619 };
+		inline constexpr REL::ID CombatDisableActionController{ 1460083 };
+		inline constexpr REL::ID CombatDisableAimController{ 846015 };
+		inline constexpr REL::ID CombatEnterCoverPathController{ 1360250 };
+		inline constexpr REL::ID CombatFindCoverPathSpeedController{ 621492 };
+		inline constexpr REL::ID CombatFlankingSearchData{ 608721 };
+		inline constexpr REL::ID CombatFollowTargetPathController{ 185439 };
+		inline constexpr REL::ID CombatFormObject{ 924938 };
+		inline constexpr REL::ID CombatGroupDetectionListener{ 1087050 };
+		inline constexpr REL::ID CombatInventoryItem{ 1004343 };
+		inline constexpr REL::ID CombatInventoryItemComposite{ 738847 };
+		inline constexpr REL::ID CombatInventoryItemGrenade{ 1476452 };
+		inline constexpr REL::ID CombatInventoryItemMagic{ 850869 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor_{ 522188 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem_{ 887463 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon_{ 375307 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak_{ 859691 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm_{ 1225262 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility_{ 1445361 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight_{ 494287 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive_{ 59806 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze_{ 37484 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate_{ 402887 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore_{ 739085 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript_{ 1254679 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger_{ 7588 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon_{ 373423 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect_{ 1473330 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard_{ 1104043 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor_{ 335667 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem_{ 701434 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon_{ 189082 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak_{ 673523 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm_{ 1038440 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility_{ 1258947 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight_{ 307893 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive_{ 1455739 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze_{ 1433218 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate_{ 216638 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore_{ 552509 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript_{ 1068026 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger_{ 1403740 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon_{ 187203 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect_{ 1286618 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard_{ 917513 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor_{ 242422 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem_{ 607818 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon_{ 95519 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak_{ 580115 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm_{ 945258 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility_{ 1165642 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight_{ 214849 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive_{ 1362106 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze_{ 1339977 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate_{ 123287 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore_{ 458708 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript_{ 974722 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger_{ 1310517 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon_{ 93692 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect_{ 1193406 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard_{ 824373 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor_{ 428732 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem_{ 794454 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon_{ 281972 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak_{ 766706 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm_{ 1131685 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility_{ 1351861 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight_{ 401006 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive_{ 1548999 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze_{ 1526892 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate_{ 309763 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore_{ 645724 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript_{ 1161439 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger_{ 1497494 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon_{ 280168 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect_{ 1379602 };
+		inline constexpr REL::ID CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard_{ 1010674 };
+		inline constexpr REL::ID CombatInventoryItemMelee{ 692245 };
+		inline constexpr REL::ID CombatInventoryItemOneHandedBlock{ 1163611 };
+		inline constexpr REL::ID CombatInventoryItemPotion{ 1157514 };
+		inline constexpr REL::ID CombatInventoryItemRanged{ 425752 };
+		inline constexpr REL::ID CombatInventoryItemScroll{ 891527 };
+		inline constexpr REL::ID CombatInventoryItemShield{ 1429335 };
+		inline constexpr REL::ID CombatInventoryItemStaff{ 1423271 };
+		inline constexpr REL::ID CombatInventoryItemThrown{ 160056 };
+		inline constexpr REL::ID CombatInventoryItemTorch{ 1116829 };
+		inline constexpr REL::ID CombatMagicCaster{ 326540 };
+		inline constexpr REL::ID CombatMagicCasterArmor{ 1428656 };
+		inline constexpr REL::ID CombatMagicCasterBoundItem{ 1475768 };
+		inline constexpr REL::ID CombatMagicCasterChameleon{ 1522334 };
+		inline constexpr REL::ID CombatMagicCasterCloak{ 518487 };
+		inline constexpr REL::ID CombatMagicCasterDisarm{ 784696 };
+		inline constexpr REL::ID CombatMagicCasterInvisibility{ 1568961 };
+		inline constexpr REL::ID CombatMagicCasterLight{ 252504 };
+		inline constexpr REL::ID CombatMagicCasterOffensive{ 312804 };
+		inline constexpr REL::ID CombatMagicCasterParalyze{ 1069507 };
+		inline constexpr REL::ID CombatMagicCasterReanimate{ 1116131 };
+		inline constexpr REL::ID CombatMagicCasterRestore{ 1582636 };
+		inline constexpr REL::ID CombatMagicCasterScript{ 803762 };
+		inline constexpr REL::ID CombatMagicCasterStagger{ 1050446 };
+		inline constexpr REL::ID CombatMagicCasterSummon{ 1316356 };
+		inline constexpr REL::ID CombatMagicCasterTargetEffect{ 1162925 };
+		inline constexpr REL::ID CombatMagicCasterWard{ 266290 };
+		inline constexpr REL::ID CombatMagicItemData{ 625667 };
+		inline constexpr REL::ID CombatMagicItemSkillChecker{ 359333 };
+		inline constexpr REL::ID CombatMantlePathController{ 1313812 };
+		inline constexpr REL::ID CombatMatchTargetAimController{ 799575 };
+		inline constexpr REL::ID CombatMathUtilities__ShapeCollection{ 712913 };
+		inline constexpr REL::ID CombatMeleeAimController{ 1158679 };
+		inline constexpr REL::ID CombatMeleeDebugData{ 272966 };
+		inline constexpr REL::ID CombatMovementRequest{ 831606 };
+		inline constexpr REL::ID CombatMovementRequestFollowActor{ 565763 };
+		inline constexpr REL::ID CombatNavmeshSearch{ 1053969 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ 1151017 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 432303 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ 335492 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyCharge__{ 1105948 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyCovered_{ 1167292 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyStandard_{ 393651 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 1084694 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ 942134 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyDistract__{ 1540069 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ 636305 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 356204 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ 160781 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 851553 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ 1364958 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 646984 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ 866293 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 413755 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ 135537 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 1437970 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ 437452 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 1301336 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ 1169964 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyFlank__{ 1328772 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ 923884 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 1348792 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ 406237 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 831386 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ 522817 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 682191 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyStandard_{ 917375 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 1342252 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ 291808 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 717443 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ 335822 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 55976 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ 17840 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 881943 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ 1534935 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 377490 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyStandard_{ 594242 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ 1285011 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyWithdraw__{ 812607 };
+		inline constexpr REL::ID CombatNavmeshSearchT_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ 214900 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ 87144 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ 760701 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyStandard_{ 739595 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ 1194536 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ 1154294 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ 506107 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ 301120 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ 1212235 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ 654117 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ 956005 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ 983261 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ 1003342 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ 485846 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ 1480113 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyStandard_{ 996713 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ 371463 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ 854047 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ 536715 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ 31622 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyStandard_{ 939475 };
+		inline constexpr REL::ID CombatNavmeshSearchTunnel_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ 466733 };
+		inline constexpr REL::ID CombatObject{ 684825 };
+		inline constexpr REL::ID CombatObjectBase{ 544862 };
+		inline constexpr REL::ID CombatObjectT_CombatFormObject_CombatObjectSaveLoadManager_BGSSaveFormBuffer_BGSLoadFormBuffer_{ 659336 };
+		inline constexpr REL::ID CombatObjectT_CombatObject_CombatObjectSaveLoadManager_BGSSaveGameBuffer_BGSLoadGameBuffer_{ 199319 };
+		inline constexpr REL::ID CombatObjectT_CombatSharedObject_CombatObjectSharedSaveLoadManager_BGSSaveGameBuffer_BGSLoadGameBuffer_{ 266773 };
+		inline constexpr REL::ID CombatPath{ 59153 };
+		inline constexpr REL::ID CombatPathBuilder{ 851355 };
+		inline constexpr REL::ID CombatPathBuilderCovered{ 792151 };
+		inline constexpr REL::ID CombatPathBuilderOpen{ 1319842 };
+		inline constexpr REL::ID CombatPathBuilderStandard{ 1117314 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ 366772 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyStandard_{ 355386 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ 385645 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ 995148 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ 958603 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ 581184 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ 695434 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ 1183774 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ 139691 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ 311723 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyStandard_{ 133154 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ 1089967 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ 1054270 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ 1109780 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ 325507 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ 535919 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ 1333538 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ 1225916 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ 399363 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ 1204589 };
+		inline constexpr REL::ID CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyStandard_{ 1153461 };
+		inline constexpr REL::ID CombatPathController{ 157728 };
+		inline constexpr REL::ID CombatPathDestination{ 577584 };
+		inline constexpr REL::ID CombatPathDestinationActor{ 311445 };
+		inline constexpr REL::ID CombatPathDestinationFollowActor{ 418835 };
+		inline constexpr REL::ID CombatPathDestinationLocation{ 624273 };
+		inline constexpr REL::ID CombatPathDestinationLocations{ 1211416 };
+		inline constexpr REL::ID CombatPathDestinationNone{ 876657 };
+		inline constexpr REL::ID CombatPathDestinationRef{ 890151 };
+		inline constexpr REL::ID CombatPathDestinationRefs{ 450874 };
+		inline constexpr REL::ID CombatPathMovementMessage{ 78939 };
+		inline constexpr REL::ID CombatPathMovementMessageEvent_CombatPathTeleportEvent_{ 31831 };
+		inline constexpr REL::ID CombatPathRequestAdapter_PathingRequestFlyAction_{ 1414905 };
+		inline constexpr REL::ID CombatPathRequestAdapter_PathingRequestFlyHover_{ 198386 };
+		inline constexpr REL::ID CombatPathRequestAdapter_PathingRequestFlyLand_{ 1175029 };
+		inline constexpr REL::ID CombatPathRequestAdapter_PathingRequestFlyOrbit_{ 1101633 };
+		inline constexpr REL::ID CombatPathRequestAdapter_PathingRequestFly_{ 69626 };
+		inline constexpr REL::ID CombatPathRequestCovered{ 531481 };
+		inline constexpr REL::ID CombatPathRequestFlight{ 335523 };
+		inline constexpr REL::ID CombatPathRequestFlyingAttack{ 1242540 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ 424765 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ 1503633 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ 682685 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ 1011996 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ 1452491 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ 1308507 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ 216845 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ 1285111 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ 400726 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ 651706 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ 1316719 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ 368054 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ 863442 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ 692877 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ 312708 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ 1300636 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ 514822 };
+		inline constexpr REL::ID CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ 468188 };
+		inline constexpr REL::ID CombatPathRequestHover{ 244866 };
+		inline constexpr REL::ID CombatPathRequestLanding{ 1440914 };
+		inline constexpr REL::ID CombatPathRequestMultiGoal{ 426768 };
+		inline constexpr REL::ID CombatPathRequestOrbit{ 1367284 };
+		inline constexpr REL::ID CombatPathRequestRotatePath{ 434541 };
+		inline constexpr REL::ID CombatPathRequestStandard{ 1070264 };
+		inline constexpr REL::ID CombatPathRequestStraightPath{ 580941 };
+		inline constexpr REL::ID CombatPathRequestWeightedMultiGoal{ 261133 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestAdapter_{ 681454 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestCovered_{ 265373 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__{ 770587 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__{ 266566 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__{ 1027614 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__{ 214336 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__{ 215790 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__{ 71932 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__{ 1000814 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__{ 487025 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__{ 746637 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__{ 996783 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__{ 80147 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__{ 714078 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__{ 65611 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__{ 1037896 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__{ 1097045 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__{ 63907 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__{ 860264 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__{ 814013 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestMultiGoal_{ 599811 };
+		inline constexpr REL::ID CombatPathRequest_CombatPathingRequestStandard_{ 804550 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestCovered_CombatPathDestinationNone_{ 341676 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor_{ 230244 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation_{ 1292512 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef_{ 1552598 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ 444091 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 410987 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ 1050728 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ 668726 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1437023 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1438537 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1294770 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ 641979 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 127834 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 387098 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ 199204 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 864179 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ 1498257 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1288558 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 679246 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 738042 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1286980 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 62282 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ 454342 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone_{ 809857 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation_{ 204414 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ 1383725 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ 234483 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation_{ 130789 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation_{ 607681 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor_{ 526294 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation_{ 1415657 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef_{ 970914 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation_{ 534326 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ 653581 };
+		inline constexpr REL::ID CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ 1165506 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone_{ 624744 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor_{ 323302 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation_{ 428585 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef_{ 63425 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ 1335409 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1489241 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ 1423556 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ 164119 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 493757 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 934094 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 790614 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ 1280754 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 767046 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1465023 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ 572144 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1237461 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ 1431880 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1489177 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 571929 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1376495 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 782718 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 435054 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ 1532503 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone_{ 557620 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation_{ 1534433 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ 520221 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ 327563 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation_{ 1460977 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation_{ 528190 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor_{ 619636 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation_{ 1163683 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef_{ 1064201 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation_{ 454372 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ 135041 };
+		inline constexpr REL::ID CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ 820025 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestCovered_CombatPathDestinationNone_{ 1139691 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor_{ 482314 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation_{ 840030 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef_{ 222587 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ 1574338 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 304062 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ 943698 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ 561654 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 625595 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1331475 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1187927 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ 1411991 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 898395 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1157659 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ 91989 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 757585 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ 1390637 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 476732 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1317694 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1508511 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1179960 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1537706 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ 347449 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone_{ 1061898 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation_{ 1333795 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ 931366 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ 1363761 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation_{ 1260647 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation_{ 155246 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor_{ 73775 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation_{ 963292 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef_{ 1223527 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation_{ 81660 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ 200961 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ 713408 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestCovered_CombatPathDestinationNone_{ 248577 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor_{ 136853 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation_{ 55676 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef_{ 1459297 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ 790096 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 929357 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ 1569232 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ 1186805 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 812060 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 374592 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 230989 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ 15986 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1084789 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 1343947 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ 717666 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1382383 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ 433577 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 663554 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 1197164 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ 112456 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 223105 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ 580750 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ 972695 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone_{ 716857 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation_{ 549985 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ 147200 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ 579974 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation_{ 476210 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation_{ 953130 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor_{ 871575 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation_{ 179308 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef_{ 877700 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation_{ 879538 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ 998561 };
+		inline constexpr REL::ID CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ 1511217 };
+		inline constexpr REL::ID CombatPathingDebugData{ 237925 };
+		inline constexpr REL::ID CombatPathingGoalPolicy{ 695104 };
+		inline constexpr REL::ID CombatPathingGoalPolicyAvoidThreat{ 1277263 };
+		inline constexpr REL::ID CombatPathingGoalPolicyCharge{ 242261 };
+		inline constexpr REL::ID CombatPathingGoalPolicyCovered{ 1293374 };
+		inline constexpr REL::ID CombatPathingGoalPolicyDistract{ 1068205 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFindAttackLocation{ 981409 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFindCover{ 1246969 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFindFlankCover{ 128483 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFindTargetLocation{ 414770 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFindValidLocation{ 480999 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFlank{ 1076678 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFlankDistant{ 563968 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFlee{ 830782 };
+		inline constexpr REL::ID CombatPathingGoalPolicyFollow{ 532647 };
+		inline constexpr REL::ID CombatPathingGoalPolicyInvestigateLocation{ 868029 };
+		inline constexpr REL::ID CombatPathingGoalPolicyLocation{ 741646 };
+		inline constexpr REL::ID CombatPathingGoalPolicyMultiGoal{ 1043495 };
+		inline constexpr REL::ID CombatPathingGoalPolicyRetreat{ 417991 };
+		inline constexpr REL::ID CombatPathingGoalPolicyReturnToCombatArea{ 681762 };
+		inline constexpr REL::ID CombatPathingGoalPolicySearch{ 78704 };
+		inline constexpr REL::ID CombatPathingGoalPolicySearchWander{ 144357 };
+		inline constexpr REL::ID CombatPathingGoalPolicyStandard{ 788250 };
+		inline constexpr REL::ID CombatPathingGoalPolicyWithdraw{ 340796 };
+		inline constexpr REL::ID CombatPathingRequest{ 1156109 };
+		inline constexpr REL::ID CombatPathingRequestAdapter{ 1507779 };
+		inline constexpr REL::ID CombatPathingRequestBuilder{ 500230 };
+		inline constexpr REL::ID CombatPathingRequestCovered{ 885201 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ 1143355 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ 1078204 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ 1400624 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ 1291896 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ 588880 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ 5515 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ 496398 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ 1565148 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ 1119307 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ 226653 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ 891918 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ 1086608 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ 705083 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ 972144 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ 592701 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ 436725 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ 89885 };
+		inline constexpr REL::ID CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ 1186925 };
+		inline constexpr REL::ID CombatPathingRequestMultiGoal{ 1461010 };
+		inline constexpr REL::ID CombatPathingRequestStandard{ 1554291 };
+		inline constexpr REL::ID CombatPathingSearchArea{ 978294 };
+		inline constexpr REL::ID CombatPathingSearchPolicy{ 382043 };
+		inline constexpr REL::ID CombatPathingSearchPolicyCharge{ 587964 };
+		inline constexpr REL::ID CombatPathingSearchPolicyCovered{ 1200295 };
+		inline constexpr REL::ID CombatPathingSearchPolicyDistract{ 1021565 };
+		inline constexpr REL::ID CombatPathingSearchPolicyFlank{ 1029948 };
+		inline constexpr REL::ID CombatPathingSearchPolicyStandard{ 428557 };
+		inline constexpr REL::ID CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyCharge_{ 747000 };
+		inline constexpr REL::ID CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyDistract_{ 1180717 };
+		inline constexpr REL::ID CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyFlank_{ 969592 };
+		inline constexpr REL::ID CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard_{ 925665 };
+		inline constexpr REL::ID CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyWithdraw_{ 452956 };
+		inline constexpr REL::ID CombatPathingSearchPolicyWithdraw{ 294028 };
+		inline constexpr REL::ID CombatPathingTweener{ 138496 };
+		inline constexpr REL::ID CombatPositionTracker{ 146935 };
+		inline constexpr REL::ID CombatProjectileAimController{ 892739 };
+		inline constexpr REL::ID CombatProjectileDebugData{ 753038 };
+		inline constexpr REL::ID CombatQueuedEvent{ 1217541 };
+		inline constexpr REL::ID CombatQueuedEventT_CombatAnimationEvent_{ 128022 };
+		inline constexpr REL::ID CombatSearchLockData{ 912332 };
+		inline constexpr REL::ID CombatSharedObject{ 313318 };
+		inline constexpr REL::ID CombatSharedPathT_CombatCoveredPath_{ 377212 };
+		inline constexpr REL::ID CombatSharedPathT_CombatPath_{ 423703 };
+		inline constexpr REL::ID CombatStaticBlackboardMemberBase{ 319458 };
+		inline constexpr REL::ID CombatStaticBlackboardMember_CombatBehaviorStaticBlackboardBase_CombatBehaviorContextMelee_CombatBehaviorContextBase__AITimer_{ 245427 };
+		inline constexpr REL::ID CombatStaticBlackboardMember_CombatBehaviorStaticBlackboardBase_CombatBehaviorContextRangedMovement_CombatBehaviorContextBase__AITimer_{ 409071 };
+		inline constexpr REL::ID CombatSuppressiveFireBehavior{ 1076336 };
+		inline constexpr REL::ID CombatTargetLocation{ 461638 };
+		inline constexpr REL::ID CombatTargetLocationSearch{ 196260 };
+		inline constexpr REL::ID CombatTargetLocationSearchResult{ 508613 };
+		inline constexpr REL::ID CombatTargetSelector{ 885602 };
+		inline constexpr REL::ID CombatTargetSelectorFixed{ 526415 };
+		inline constexpr REL::ID CombatTargetSelectorPreferred{ 573105 };
+		inline constexpr REL::ID CombatTargetSelectorRandom{ 260297 };
+		inline constexpr REL::ID CombatTargetSelectorStandard{ 619739 };
+		inline constexpr REL::ID CombatThreat{ 729279 };
+		inline constexpr REL::ID CombatThreatExplosion{ 243556 };
+		inline constexpr REL::ID CombatThreatLOF{ 1293768 };
+		inline constexpr REL::ID CombatThreatMelee{ 808601 };
+		inline constexpr REL::ID CombatThreatProjectile{ 1560001 };
+		inline constexpr REL::ID CombatTrackTargetAimController{ 1205468 };
+		inline constexpr REL::ID CombatTunnelPathController{ 1474110 };
+		inline constexpr REL::ID CombatViewController{ 382247 };
+		inline constexpr REL::ID CombatViewControllerGlance{ 69823 };
+		inline constexpr REL::ID CombatViewControllerPath{ 22634 };
+		inline constexpr REL::ID CombatViewControllerStandard{ 116285 };
+		inline constexpr REL::ID CommandEffect{ 1112592 };
+		inline constexpr REL::ID CommandSummonedEffect{ 580770 };
+		inline constexpr REL::ID CompactingStore__MoveCallback{ 1308758 };
+		inline constexpr REL::ID CompactingStore__NoopMoveCallback{ 1262332 };
+		inline constexpr REL::ID CompactingStore__Store{ 1575075 };
+		inline constexpr REL::ID CompanionListener{ 1190287 };
+		inline constexpr REL::ID CompressedArchiveFile{ 562310 };
+		inline constexpr REL::ID ConcreteBoundObjectFormFactory_TESFurniture_42_22_3_{ 827725 };
+		inline constexpr REL::ID ConcreteBoundObjectFormFactory_TESNPC_45_13_0_{ 1363648 };
+		inline constexpr REL::ID ConcreteBoundObjectFormFactory_TESObjectARMO_29_1_1_{ 528210 };
+		inline constexpr REL::ID ConcreteBoundObjectFormFactory_TESObjectWEAP_43_12_1_{ 361487 };
+		inline constexpr REL::ID ConcreteExplosionFactory_ChainExplosion_1_{ 175191 };
+		inline constexpr REL::ID ConcreteExplosionFactory_Explosion_0_{ 152875 };
+		inline constexpr REL::ID ConcreteFormFactory_ActorValueInfo_98_{ 1174615 };
+		inline constexpr REL::ID ConcreteFormFactory_AlchemyItem_48_{ 1119974 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAcousticSpace_19_{ 1439527 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAction_6_{ 1550363 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAddonNode_97_{ 615227 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAimModel_141_{ 1572334 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSArtObject_129_{ 853522 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAssociationType_127_{ 1363426 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAttractionRule_151_{ 1249638 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSAudioEffectChain_149_{ 952932 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSBendableSpline_53_{ 307775 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSBodyPartData_96_{ 458425 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSCameraPath_100_{ 1332421 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSCameraShot_99_{ 1478182 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSCollisionLayer_136_{ 147898 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSColorForm_137_{ 227481 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSComponent_8_{ 1350161 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSConstructibleObject_143_{ 1078254 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSDamageType_12_{ 1402203 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSDebris_91_{ 891865 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSDialogueBranch_119_{ 1509306 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSDualCastData_133_{ 1451944 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSEncounterZone_106_{ 221152 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSEquipSlot_124_{ 1497225 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSExplosion_90_{ 532699 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSFootstepSet_115_{ 1442863 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSFootstep_114_{ 46986 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSGodRays_157_{ 300423 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSHazard_52_{ 1223775 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSHeadPart_15_{ 1389615 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSIdleMarker_49_{ 764831 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSImpactDataSet_104_{ 631379 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSImpactData_103_{ 112870 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSInstanceNamingRules_147_{ 856582 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSKeyword_4_{ 578220 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSLensFlare_155_{ 332287 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSLightingTemplate_112_{ 1164363 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSListForm_94_{ 711125 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSLocationRefType_5_{ 1216550 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSLocation_107_{ 1136698 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMaterialObject_130_{ 1401467 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMaterialSwap_145_{ 231451 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMaterialType_102_{ 71676 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMenuIcon_10_{ 1028486 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMessage_108_{ 403232 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMod__Attachment__Mod_144_{ 1406814 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMovableStatic_38_{ 1182310 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMovementType_131_{ 909918 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMusicTrackFormWrapper_120_{ 1370836 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSMusicType_113_{ 1184613 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSNote_50_{ 1162162 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSOutfit_128_{ 1220758 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSPackIn_139_{ 156645 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSPerk_95_{ 1494138 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSProjectile_51_{ 49366 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSReferenceEffect_60_{ 152439 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSReferenceGroup_140_{ 1548152 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSRelationship_125_{ 1159110 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSReverbParameters_138_{ 732409 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSScene_126_{ 566813 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSShaderParticleGeometryData_59_{ 31136 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSSoundCategorySnapshot_152_{ 483550 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSSoundCategory_134_{ 545809 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSSoundDescriptorForm_132_{ 798038 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSSoundKeywordMapping_148_{ 30716 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSSoundOutput_135_{ 863402 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSSoundTagSet_153_{ 987859 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSStaticCollection_37_{ 820046 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSStoryManagerBranchNode_116_{ 510824 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSStoryManagerEventNode_118_{ 763272 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSStoryManagerQuestNode_117_{ 137755 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSTalkingActivator_28_{ 526572 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSTerminal_55_{ 1296891 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSTextureSet_9_{ 1433562 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSTransform_7_{ 1067438 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSVoiceType_101_{ 1156021 };
+		inline constexpr REL::ID ConcreteFormFactory_BGSZoomData_146_{ 671971 };
+		inline constexpr REL::ID ConcreteFormFactory_EffectSetting_21_{ 1127624 };
+		inline constexpr REL::ID ConcreteFormFactory_EnchantmentItem_24_{ 675609 };
+		inline constexpr REL::ID ConcreteFormFactory_IngredientItem_33_{ 1006883 };
+		inline constexpr REL::ID ConcreteFormFactory_NavMesh_76_{ 1386970 };
+		inline constexpr REL::ID ConcreteFormFactory_Script_22_{ 646723 };
+		inline constexpr REL::ID ConcreteFormFactory_ScrollItem_26_{ 151097 };
+		inline constexpr REL::ID ConcreteFormFactory_SpellItem_25_{ 1546812 };
+		inline constexpr REL::ID ConcreteFormFactory_TESAmmo_44_{ 658248 };
+		inline constexpr REL::ID ConcreteFormFactory_TESClass_13_{ 437271 };
+		inline constexpr REL::ID ConcreteFormFactory_TESClimate_58_{ 1320138 };
+		inline constexpr REL::ID ConcreteFormFactory_TESCombatStyle_83_{ 1494546 };
+		inline constexpr REL::ID ConcreteFormFactory_TESEffectShader_88_{ 336938 };
+		inline constexpr REL::ID ConcreteFormFactory_TESEyes_16_{ 78325 };
+		inline constexpr REL::ID ConcreteFormFactory_TESFaction_14_{ 769444 };
+		inline constexpr REL::ID ConcreteFormFactory_TESFlora_41_{ 1466804 };
+		inline constexpr REL::ID ConcreteFormFactory_TESFurniture_42_{ 907216 };
+		inline constexpr REL::ID ConcreteFormFactory_TESGlobal_11_{ 235393 };
+		inline constexpr REL::ID ConcreteFormFactory_TESGrass_39_{ 1331995 };
+		inline constexpr REL::ID ConcreteFormFactory_TESIdleForm_81_{ 1380540 };
+		inline constexpr REL::ID ConcreteFormFactory_TESImageSpaceModifier_93_{ 242513 };
+		inline constexpr REL::ID ConcreteFormFactory_TESImageSpace_92_{ 960976 };
+		inline constexpr REL::ID ConcreteFormFactory_TESKey_47_{ 972752 };
+		inline constexpr REL::ID ConcreteFormFactory_TESLandTexture_23_{ 812891 };
+		inline constexpr REL::ID ConcreteFormFactory_TESLevCharacter_46_{ 1397710 };
+		inline constexpr REL::ID ConcreteFormFactory_TESLevItem_56_{ 506650 };
+		inline constexpr REL::ID ConcreteFormFactory_TESLevSpell_85_{ 320079 };
+		inline constexpr REL::ID ConcreteFormFactory_TESLoadScreen_84_{ 1364678 };
+		inline constexpr REL::ID ConcreteFormFactory_TESNPC_45_{ 1004543 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectACTI_27_{ 1142569 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectANIO_86_{ 517383 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectARMA_105_{ 1380903 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectARMO_29_{ 607698 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectBOOK_30_{ 1032471 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectCELL_63_{ 146242 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectCONT_31_{ 1191632 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectDOOR_32_{ 113760 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectLAND_75_{ 294308 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectLIGH_34_{ 119853 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectMISC_35_{ 895106 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectSTAT_36_{ 974385 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectTREE_40_{ 788294 };
+		inline constexpr REL::ID ConcreteFormFactory_TESObjectWEAP_43_{ 440903 };
+		inline constexpr REL::ID ConcreteFormFactory_TESQuest_80_{ 870010 };
+		inline constexpr REL::ID ConcreteFormFactory_TESRace_17_{ 1440327 };
+		inline constexpr REL::ID ConcreteFormFactory_TESRegion_61_{ 361053 };
+		inline constexpr REL::ID ConcreteFormFactory_TESShout_123_{ 261496 };
+		inline constexpr REL::ID ConcreteFormFactory_TESSoulGem_54_{ 1118293 };
+		inline constexpr REL::ID ConcreteFormFactory_TESSound_18_{ 779997 };
+		inline constexpr REL::ID ConcreteFormFactory_TESTopicInfo_79_{ 1189859 };
+		inline constexpr REL::ID ConcreteFormFactory_TESTopic_78_{ 227609 };
+		inline constexpr REL::ID ConcreteFormFactory_TESWaterForm_87_{ 724517 };
+		inline constexpr REL::ID ConcreteFormFactory_TESWeather_57_{ 537844 };
+		inline constexpr REL::ID ConcreteFormFactory_TESWordOfPower_122_{ 593476 };
+		inline constexpr REL::ID ConcreteFormFactory_TESWorldSpace_74_{ 1187416 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_ActorValueInfo_98_119_4_{ 124391 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_AlchemyItem_48_17_2_{ 508564 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAcousticSpace_19_64_8_{ 389287 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAction_6_76_0_{ 938712 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAddonNode_97_41_6_{ 2948 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAimModel_141_108_4_{ 960557 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSArtObject_129_84_4_{ 242097 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAssociationType_127_82_5_{ 313494 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAttractionRule_151_120_4_{ 199373 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSAudioEffectChain_149_117_8_{ 1485275 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSBendableSpline_53_105_4_{ 839830 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSBodyPartData_96_40_0_{ 990446 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSCameraShot_99_43_6_{ 866190 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSCollisionLayer_136_99_4_{ 680310 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSColorForm_137_101_4_{ 1198290 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSComponent_8_109_4_{ 739199 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSConstructibleObject_143_63_1_{ 27656 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSDamageType_12_118_4_{ 791075 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSDebris_91_36_6_{ 280269 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSDualCastData_133_95_2_{ 401392 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSEncounterZone_106_61_7_{ 753353 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSEquipSlot_124_81_5_{ 885367 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSExplosion_90_34_6_{ 1503673 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSFootstepSet_115_74_6_{ 392552 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSFootstep_114_73_6_{ 1017750 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSGodRays_157_125_6_{ 1271356 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSHazard_52_92_6_{ 612153 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSHeadPart_15_52_5_{ 778561 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSIdleMarker_49_30_4_{ 153287 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSImpactDataSet_104_45_6_{ 1163202 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSImpactData_103_44_6_{ 1083594 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSInstanceNamingRules_147_114_4_{ 1388395 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSKeyword_4_70_4_{ 1548971 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSLensFlare_155_123_6_{ 1302899 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSLightingTemplate_112_87_7_{ 113984 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSListForm_94_38_4_{ 99075 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSLocationRefType_5_72_7_{ 166212 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSLocation_107_71_7_{ 525326 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMaterialObject_130_85_4_{ 351243 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMaterialSwap_145_111_4_{ 763572 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMaterialType_102_75_6_{ 603689 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMenuIcon_10_37_9_{ 416894 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMessage_108_62_4_{ 1373886 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMod__Attachment__Mod_144_110_1_{ 356605 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMovableStatic_38_42_3_{ 131983 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMovementType_131_91_5_{ 1441786 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMusicTrackFormWrapper_120_77_8_{ 320759 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSMusicType_113_68_8_{ 573210 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSNote_50_54_1_{ 550861 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSOutfit_128_83_1_{ 609113 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSPackIn_139_103_4_{ 1127123 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSPerk_95_39_0_{ 882274 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSProjectile_51_32_6_{ 1020147 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSReferenceEffect_60_89_7_{ 684628 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSReferenceGroup_140_104_9_{ 497703 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSRelationship_125_80_5_{ 108884 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSReverbParameters_138_102_8_{ 1264152 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSShaderParticleGeometryData_59_88_7_{ 563660 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSSoundCategorySnapshot_152_121_8_{ 1015526 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSSoundCategory_134_96_8_{ 1077495 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSSoundDescriptorForm_132_94_8_{ 1329645 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSSoundKeywordMapping_148_115_8_{ 563215 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSSoundOutput_135_98_8_{ 1395329 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSSoundTagSet_153_122_8_{ 1520328 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSStaticCollection_37_69_9_{ 1351751 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSStoryManagerEventNode_118_93_5_{ 1294948 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSTalkingActivator_28_33_0_{ 1058363 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSTerminal_55_116_3_{ 685807 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSTextureSet_9_35_4_{ 822334 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSTransform_7_112_4_{ 455820 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSVoiceType_101_48_5_{ 544795 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_BGSZoomData_146_113_4_{ 60146 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_EffectSetting_21_67_2_{ 516252 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_EnchantmentItem_24_16_2_{ 1207483 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_IngredientItem_33_5_1_{ 395430 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_Script_22_66_9_{ 34728 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_ScrollItem_26_100_9_{ 1121597 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_SpellItem_25_15_2_{ 935167 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESAmmo_44_20_1_{ 46304 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESClass_13_49_5_{ 1408024 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESClimate_58_56_7_{ 709289 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESCombatStyle_83_25_4_{ 443687 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESEffectShader_88_31_6_{ 868725 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESEyes_16_51_9_{ 1049043 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESFaction_14_53_5_{ 157911 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESFlora_41_21_3_{ 855156 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESFurniture_42_22_3_{ 295488 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESGlobal_11_58_4_{ 1206201 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESGrass_39_9_3_{ 721115 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESImageSpaceModifier_93_60_6_{ 774756 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESImageSpace_92_59_6_{ 349362 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESKey_47_19_1_{ 361277 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESLandTexture_23_24_4_{ 1344573 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESLevCharacter_46_14_0_{ 347507 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESLevItem_56_18_1_{ 1477738 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESLevSpell_85_27_2_{ 1290924 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESLoadScreen_84_26_4_{ 753818 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESNPC_45_13_0_{ 393121 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectACTI_27_0_3_{ 531306 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectANIO_86_28_4_{ 1488423 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectARMA_105_57_1_{ 769788 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectARMO_29_1_1_{ 1578490 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectBOOK_30_2_1_{ 420945 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectCONT_31_3_3_{ 580225 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectDOOR_32_4_3_{ 1084523 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectLIGH_34_6_3_{ 1090580 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectMISC_35_7_1_{ 283496 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectSTAT_36_8_3_{ 362893 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectTREE_40_10_3_{ 176777 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESObjectWEAP_43_12_1_{ 1411637 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESQuest_80_46_5_{ 258704 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESRace_17_50_5_{ 828956 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESShout_123_79_9_{ 1232383 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESSoulGem_54_97_9_{ 506884 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESSound_18_23_8_{ 168491 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESWaterForm_87_29_7_{ 112637 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESWeather_57_55_7_{ 1508715 };
+		inline constexpr REL::ID ConcreteObjectFormFactory_TESWordOfPower_122_78_9_{ 1125177 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTempEffectGeometryDecal_3_{ 79353 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTempEffectSPG_6_{ 238355 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTempEffect_1_{ 200278 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTempEffect_4_{ 811740 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTempEffect_5_{ 1422836 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTempEffect_7_{ 1170813 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_BSTerrainEffect_0_{ 743068 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_ModelReferenceEffect_9_{ 64662 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_ReferenceEffect_8_{ 210076 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_ShaderReferenceEffect_10_{ 1153110 };
+		inline constexpr REL::ID ConcreteTempEffectFactory_SummonPlacementEffect_11_{ 766615 };
+		inline constexpr REL::ID ConcreteTempEffectFactory___BSTempEffectScreenSpaceDecal_2_{ 1163493 };
+		inline constexpr REL::ID ConeProjectile{ 997092 };
+		inline constexpr REL::ID Console{ 37788 };
+		inline constexpr REL::ID ConsoleData{ 542072 };
+		inline constexpr REL::ID ConsoleNativeUIMenu{ 43216 };
+		inline constexpr REL::ID ContainerMenu{ 514966 };
+		inline constexpr REL::ID ContainerMenuBase{ 923907 };
+		inline constexpr REL::ID ContainerMenuBase__FXQuantityMenu{ 1345792 };
+		inline constexpr REL::ID ContainerMenuBase__IValidFunc{ 139710 };
+		inline constexpr REL::ID CookingMenu{ 986512 };
+		inline constexpr REL::ID CreationClubMenu{ 963824 };
+		inline constexpr REL::ID CreationClub__AsyncModRequest{ 478444 };
+		inline constexpr REL::ID CreationClub__BundleChildrenRequest{ 385177 };
+		inline constexpr REL::ID CreationClub__CategorySearchRequest{ 558159 };
+		inline constexpr REL::ID CreationClub__CreationChanged_ConfirmResetCallback{ 889763 };
+		inline constexpr REL::ID CreationClub__CreationListRequest{ 431578 };
+		inline constexpr REL::ID CreationClub__DownloadCreationRequest{ 497541 };
+		inline constexpr REL::ID CreationClub__DownloadImageRequest{ 637658 };
+		inline constexpr REL::ID CreationClub__GetCreationRequest{ 731144 };
+		inline constexpr REL::ID CreationClub__GetIntRequest{ 684478 };
+		inline constexpr REL::ID CreationClub__SavedGFxValueRequest{ 544499 };
+		inline constexpr REL::ID CreationClub__StringStringRequest{ 591115 };
+		inline constexpr REL::ID CreditsMenu{ 939930 };
+		inline constexpr REL::ID CstringArrayImplementation{ 203339 };
+		inline constexpr REL::ID CullFurnitureBoneHandler{ 1172697 };
+		inline constexpr REL::ID CullWeaponsHandler{ 859991 };
+		inline constexpr REL::ID CureEffect{ 268064 };
+		inline constexpr REL::ID CursorMenu{ 1551630 };
+		inline constexpr REL::ID CursorMoveEvent{ 167935 };
+		inline constexpr REL::ID CustomActorPackageData{ 1484053 };
+		inline constexpr REL::ID CustomUtils__HasForceGreetVisitor{ 142695 };
+	}
+}
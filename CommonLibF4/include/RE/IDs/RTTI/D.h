@@ -0,0 +1,43 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID DamageEffect{ 1318126 };
+		inline constexpr REL::ID DarknessEffect{ 786446 };
+		inline constexpr REL::ID DeathEmoteHandler{ 325707 };
+		inline constexpr REL::ID DeathStopHandler{ 1044158 };
+		inline constexpr REL::ID DebugText{ 734018 };
+		inline constexpr REL::ID DefaultMessageBoxCallback{ 445956 };
+		inline constexpr REL::ID DemoralizeEffect{ 580035 };
+		inline constexpr REL::ID DesyncInteractionHandler{ 319626 };
+		inline constexpr REL::ID DetectLifeEffect{ 254310 };
+		inline constexpr REL::ID DetectionCollector{ 851889 };
+		inline constexpr REL::ID DetectionListener{ 1383779 };
+		inline constexpr REL::ID DetectionState{ 1568793 };
+		inline constexpr REL::ID DeviceConnectEvent{ 293602 };
+		inline constexpr REL::ID DialogueCameraState{ 715459 };
+		inline constexpr REL::ID DialogueMenu{ 772843 };
+		inline constexpr REL::ID DialogueMenuUtils__DialogueMessageData{ 1274342 };
+		inline constexpr REL::ID DialoguePackage{ 375880 };
+		inline constexpr REL::ID DirectionalHitIndicators{ 687361 };
+		inline constexpr REL::ID DisableCharacterBumperHandler{ 251689 };
+		inline constexpr REL::ID DisableCharacterPitchHandler{ 583523 };
+		inline constexpr REL::ID DisableCollisionHandler{ 1521449 };
+		inline constexpr REL::ID DisarmEffect{ 1304371 };
+		inline constexpr REL::ID DisconnectHandler{ 1129630 };
+		inline constexpr REL::ID DisguiseEffect{ 286943 };
+		inline constexpr REL::ID DisguiseEffect__DetectionChecker{ 898634 };
+		inline constexpr REL::ID DispelEffect{ 53874 };
+		inline constexpr REL::ID DiveBombPathController{ 896544 };
+		inline constexpr REL::ID DoNotInterruptAnimationHandler{ 1090803 };
+		inline constexpr REL::ID DoNothingUnhandledPolicy_BSFixedString_{ 397445 };
+		inline constexpr REL::ID DoorObstacleAdapter{ 996728 };
+		inline constexpr REL::ID DropItemCommand{ 1025138 };
+		inline constexpr REL::ID DualValueModifierEffect{ 1104197 };
+		inline constexpr REL::ID DynamicAnimationTaggingGenerator{ 1467454 };
+		inline constexpr REL::ID DynamicIdleDataSingletonHelper{ 210551 };
+		inline constexpr REL::ID DynamicNavmesh__BuildThread{ 208171 };
+	}
+}
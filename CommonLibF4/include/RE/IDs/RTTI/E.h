@@ -0,0 +1,230 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID EffectArchetypes__MainStatusHandler{ 338107 };
+		inline constexpr REL::ID EffectSetting{ 1234912 };
+		inline constexpr REL::ID EjectShellCasingHandler{ 599586 };
+		inline constexpr REL::ID EnableCharacterBumperHandler{ 298075 };
+		inline constexpr REL::ID EnableCharacterPitchHandler{ 630221 };
+		inline constexpr REL::ID EnableCollisionHandler{ 205140 };
+		inline constexpr REL::ID EnchantmentItem{ 376391 };
+		inline constexpr REL::ID EndSummonAnimationHandler{ 40407 };
+		inline constexpr REL::ID EnhanceWeaponEffect{ 865775 };
+		inline constexpr REL::ID EquipActorOutfitItemsFunctor{ 687864 };
+		inline constexpr REL::ID EquippedItemData{ 1070519 };
+		inline constexpr REL::ID EquippedWeaponData{ 585455 };
+		inline constexpr REL::ID ErrorCommandDispatcher{ 1213153 };
+		inline constexpr REL::ID EscortActorPackageData{ 1124317 };
+		inline constexpr REL::ID EtherealizationEffect{ 791806 };
+		inline constexpr REL::ID ExamineConfirmMenu{ 846789 };
+		inline constexpr REL::ID ExamineConfirmMenu__ICallback{ 659434 };
+		inline constexpr REL::ID ExamineConfirmMenu__InitData{ 581017 };
+		inline constexpr REL::ID ExamineConfirmMenu__InitDataBuild{ 534409 };
+		inline constexpr REL::ID ExamineConfirmMenu__InitDataRepairFailure{ 440749 };
+		inline constexpr REL::ID ExamineConfirmMenu__InitDataScrap{ 487498 };
+		inline constexpr REL::ID ExamineMenu{ 501299 };
+		inline constexpr REL::ID ExamineMenu__FXExamineMenu{ 1510624 };
+		inline constexpr REL::ID ExamineMenu__FXExamineMenu__FXExamineSubMenu{ 1244495 };
+		inline constexpr REL::ID Explosion{ 268302 };
+		inline constexpr REL::ID ExplosionClosestHitCollector{ 545070 };
+		inline constexpr REL::ID ExplosiveIndicators{ 1531803 };
+		inline constexpr REL::ID ExtraAcousticParent{ 431332 };
+		inline constexpr REL::ID ExtraAction{ 714867 };
+		inline constexpr REL::ID ExtraActivateLoopSound{ 925302 };
+		inline constexpr REL::ID ExtraActivateRef{ 514167 };
+		inline constexpr REL::ID ExtraActivateRefChildren{ 28393 };
+		inline constexpr REL::ID ExtraActivateText{ 912360 };
+		inline constexpr REL::ID ExtraActorCause{ 816887 };
+		inline constexpr REL::ID ExtraActorValueStorage{ 991565 };
+		inline constexpr REL::ID ExtraAliasInstanceArray{ 645875 };
+		inline constexpr REL::ID ExtraAlphaCutoff{ 1370 };
+		inline constexpr REL::ID ExtraAmmo{ 1559961 };
+		inline constexpr REL::ID ExtraAnimGraphManager{ 1386099 };
+		inline constexpr REL::ID ExtraAnimGraphPreload{ 1067467 };
+		inline constexpr REL::ID ExtraAnimSounds{ 1477530 };
+		inline constexpr REL::ID ExtraAnimationSequencer{ 1454489 };
+		inline constexpr REL::ID ExtraAshPileRef{ 132719 };
+		inline constexpr REL::ID ExtraAttachRef{ 388642 };
+		inline constexpr REL::ID ExtraAttachRefChildren{ 1485974 };
+		inline constexpr REL::ID ExtraAttachedArrows3D{ 268070 };
+		inline constexpr REL::ID ExtraBadPosition{ 98237 };
+		inline constexpr REL::ID ExtraBendableSplineParams{ 736201 };
+		inline constexpr REL::ID ExtraBiped{ 854291 };
+		inline constexpr REL::ID ExtraBoneScaleMap{ 492555 };
+		inline constexpr REL::ID ExtraCachedScale{ 309219 };
+		inline constexpr REL::ID ExtraCanTalkToPlayer{ 1476828 };
+		inline constexpr REL::ID ExtraCannotWear{ 1078994 };
+		inline constexpr REL::ID ExtraCell3D{ 1453578 };
+		inline constexpr REL::ID ExtraCellAcousticSpace{ 375721 };
+		inline constexpr REL::ID ExtraCellGodRays{ 1047588 };
+		inline constexpr REL::ID ExtraCellGrassData{ 703488 };
+		inline constexpr REL::ID ExtraCellImageSpace{ 1313490 };
+		inline constexpr REL::ID ExtraCellMusicType{ 641934 };
+		inline constexpr REL::ID ExtraCellSkyRegion{ 1579684 };
+		inline constexpr REL::ID ExtraCellWaterEnvMap{ 832849 };
+		inline constexpr REL::ID ExtraCellWaterType{ 109714 };
+		inline constexpr REL::ID ExtraCharge{ 877020 };
+		inline constexpr REL::ID ExtraCollisionData{ 188746 };
+		inline constexpr REL::ID ExtraCombatStyle{ 1159290 };
+		inline constexpr REL::ID ExtraCombinedRefs{ 854973 };
+		inline constexpr REL::ID ExtraCount{ 139463 };
+		inline constexpr REL::ID ExtraCreatureAwakeSound{ 1568401 };
+		inline constexpr REL::ID ExtraCreatureMovementSound{ 971886 };
+		inline constexpr REL::ID ExtraCulledBone{ 592252 };
+		inline constexpr REL::ID ExtraDecalGroup{ 379580 };
+		inline constexpr REL::ID ExtraDetachTime{ 1392805 };
+		inline constexpr REL::ID ExtraDirectAtTarget{ 549593 };
+		inline constexpr REL::ID ExtraDismemberedLimbs{ 1120196 };
+		inline constexpr REL::ID ExtraDistantData{ 966588 };
+		inline constexpr REL::ID ExtraDroppedItemList{ 939119 };
+		inline constexpr REL::ID ExtraEditorID{ 1433406 };
+		inline constexpr REL::ID ExtraEditorRef3DData{ 1421278 };
+		inline constexpr REL::ID ExtraEditorRefMoveData{ 1155475 };
+		inline constexpr REL::ID ExtraEmittanceSource{ 165782 };
+		inline constexpr REL::ID ExtraEnableStateChildren{ 215459 };
+		inline constexpr REL::ID ExtraEnableStateParent{ 481246 };
+		inline constexpr REL::ID ExtraEnchantment{ 1274701 };
+		inline constexpr REL::ID ExtraEncounterZone{ 127395 };
+		inline constexpr REL::ID ExtraEssentialProtected{ 1104200 };
+		inline constexpr REL::ID ExtraFXPickNodes{ 6773 };
+		inline constexpr REL::ID ExtraFactionChanges{ 659693 };
+		inline constexpr REL::ID ExtraFavorCost{ 929088 };
+		inline constexpr REL::ID ExtraFavorite{ 948222 };
+		inline constexpr REL::ID ExtraFlags{ 1400614 };
+		inline constexpr REL::ID ExtraFollower{ 1488976 };
+		inline constexpr REL::ID ExtraFollowerSwimBreadcrumbs{ 692609 };
+		inline constexpr REL::ID ExtraForcedLandingMarker{ 1098933 };
+		inline constexpr REL::ID ExtraForcedTarget{ 789505 };
+		inline constexpr REL::ID ExtraFriendHits{ 590866 };
+		inline constexpr REL::ID ExtraFromAlias{ 1546139 };
+		inline constexpr REL::ID ExtraFurnitureEntryData{ 708857 };
+		inline constexpr REL::ID ExtraGIDBuffer{ 1200638 };
+		inline constexpr REL::ID ExtraGhost{ 327621 };
+		inline constexpr REL::ID ExtraGlobal{ 1329493 };
+		inline constexpr REL::ID ExtraGroupConstraint{ 1534037 };
+		inline constexpr REL::ID ExtraGuardedRefData{ 889516 };
+		inline constexpr REL::ID ExtraHasNoRumors{ 1033000 };
+		inline constexpr REL::ID ExtraHavok{ 967977 };
+		inline constexpr REL::ID ExtraHeadTrackingWeight{ 1195229 };
+		inline constexpr REL::ID ExtraHeadingTarget{ 251977 };
+		inline constexpr REL::ID ExtraHealth{ 265722 };
+		inline constexpr REL::ID ExtraHorse{ 177965 };
+		inline constexpr REL::ID ExtraIgnoredAttractKeywords{ 586192 };
+		inline constexpr REL::ID ExtraIgnoredBySandbox{ 623636 };
+		inline constexpr REL::ID ExtraInitActions{ 481701 };
+		inline constexpr REL::ID ExtraInputEnableLayer{ 815488 };
+		inline constexpr REL::ID ExtraInstanceData{ 469622 };
+		inline constexpr REL::ID ExtraInteraction{ 944473 };
+		inline constexpr REL::ID ExtraInteriorLODWorldspace{ 539544 };
+		inline constexpr REL::ID ExtraInvestedGold{ 838251 };
+		inline constexpr REL::ID ExtraItemDropper{ 1424320 };
+		inline constexpr REL::ID ExtraKeywords{ 566988 };
+		inline constexpr REL::ID ExtraLargeRefOwnerCells{ 1505099 };
+		inline constexpr REL::ID ExtraLastFinishedSequence{ 593895 };
+		inline constexpr REL::ID ExtraLevCreaModifier{ 963571 };
+		inline constexpr REL::ID ExtraLeveledCreature{ 1465949 };
+		inline constexpr REL::ID ExtraLeveledItem{ 1236555 };
+		inline constexpr REL::ID ExtraLeveledItemBase{ 1229747 };
+		inline constexpr REL::ID ExtraLight{ 368848 };
+		inline constexpr REL::ID ExtraLightData{ 1238900 };
+		inline constexpr REL::ID ExtraLinkedRef{ 1531685 };
+		inline constexpr REL::ID ExtraLinkedRefChildren{ 1046170 };
+		inline constexpr REL::ID ExtraLitWaterRefs{ 1518711 };
+		inline constexpr REL::ID ExtraLocation{ 1140055 };
+		inline constexpr REL::ID ExtraLocationRefType{ 780398 };
+		inline constexpr REL::ID ExtraLock{ 106715 };
+		inline constexpr REL::ID ExtraLockList{ 458849 };
+		inline constexpr REL::ID ExtraMagicCaster{ 917652 };
+		inline constexpr REL::ID ExtraMapMarker{ 1199958 };
+		inline constexpr REL::ID ExtraMasterFileCell{ 585497 };
+		inline constexpr REL::ID ExtraMasterLocation{ 319251 };
+		inline constexpr REL::ID ExtraMaterialSwap{ 81492 };
+		inline constexpr REL::ID ExtraMissingRefIDs{ 649567 };
+		inline constexpr REL::ID ExtraModRank{ 753669 };
+		inline constexpr REL::ID ExtraModelSwap{ 547991 };
+		inline constexpr REL::ID ExtraMultiBound{ 949876 };
+		inline constexpr REL::ID ExtraMultiBoundData{ 1482236 };
+		inline constexpr REL::ID ExtraMultiBoundRef{ 1216138 };
+		inline constexpr REL::ID ExtraNavMeshPortal{ 1162322 };
+		inline constexpr REL::ID ExtraNorthRotation{ 76878 };
+		inline constexpr REL::ID ExtraObjectBreakable{ 726213 };
+		inline constexpr REL::ID ExtraObjectHealth{ 1302017 };
+		inline constexpr REL::ID ExtraObjectSavedDynamicIdles{ 459534 };
+		inline constexpr REL::ID ExtraObjectSavedUnrecoverableSubgraphs{ 413025 };
+		inline constexpr REL::ID ExtraOcclusionPlaneRefData{ 896322 };
+		inline constexpr REL::ID ExtraOcclusionShape{ 856625 };
+		inline constexpr REL::ID ExtraOpenCloseActivateRef{ 1060544 };
+		inline constexpr REL::ID ExtraOriginalReference{ 1003091 };
+		inline constexpr REL::ID ExtraOutfitItem{ 751271 };
+		inline constexpr REL::ID ExtraOwnership{ 232893 };
+		inline constexpr REL::ID ExtraPackage{ 621300 };
+		inline constexpr REL::ID ExtraPackageData{ 674190 };
+		inline constexpr REL::ID ExtraPackageStartLocation{ 851217 };
+		inline constexpr REL::ID ExtraPatrolRefData{ 1428061 };
+		inline constexpr REL::ID ExtraPatrolRefInUseData{ 958267 };
+		inline constexpr REL::ID ExtraPersistentCell{ 53183 };
+		inline constexpr REL::ID ExtraPlayerCrimeList{ 135770 };
+		inline constexpr REL::ID ExtraPoison{ 737578 };
+		inline constexpr REL::ID ExtraPortal{ 464176 };
+		inline constexpr REL::ID ExtraPortalRefData{ 849622 };
+		inline constexpr REL::ID ExtraPowerArmor{ 1567037 };
+		inline constexpr REL::ID ExtraPowerArmorPreload{ 1081296 };
+		inline constexpr REL::ID ExtraPowerLinks{ 1219863 };
+		inline constexpr REL::ID ExtraPreVisRefs{ 369549 };
+		inline constexpr REL::ID ExtraPrimitive{ 462514 };
+		inline constexpr REL::ID ExtraProcessMiddleLow{ 907733 };
+		inline constexpr REL::ID ExtraProjectedDecalData{ 1178372 };
+		inline constexpr REL::ID ExtraPromotedRef{ 357356 };
+		inline constexpr REL::ID ExtraRaceData{ 1221531 };
+		inline constexpr REL::ID ExtraRadioData{ 331400 };
+		inline constexpr REL::ID ExtraRadioReceiver{ 426829 };
+		inline constexpr REL::ID ExtraRadioRepeater{ 161143 };
+		inline constexpr REL::ID ExtraRadius{ 62308 };
+		inline constexpr REL::ID ExtraRagDollData{ 1369267 };
+		inline constexpr REL::ID ExtraRandomTeleportMarker{ 1344848 };
+		inline constexpr REL::ID ExtraRangedDistOverride{ 383288 };
+		inline constexpr REL::ID ExtraRank{ 844307 };
+		inline constexpr REL::ID ExtraRefWeaponSounds{ 283325 };
+		inline constexpr REL::ID ExtraReferenceHandles{ 1405937 };
+		inline constexpr REL::ID ExtraReflectedRefs{ 734597 };
+		inline constexpr REL::ID ExtraReflectorRefs{ 468042 };
+		inline constexpr REL::ID ExtraRefrPath{ 1188420 };
+		inline constexpr REL::ID ExtraRefractionProperty{ 141113 };
+		inline constexpr REL::ID ExtraRegionList{ 482653 };
+		inline constexpr REL::ID ExtraReservedMarkers{ 398663 };
+		inline constexpr REL::ID ExtraRoom{ 1561635 };
+		inline constexpr REL::ID ExtraRoomRefData{ 1443612 };
+		inline constexpr REL::ID ExtraRunOncePacks{ 1452154 };
+		inline constexpr REL::ID ExtraSavedAnimation{ 673449 };
+		inline constexpr REL::ID ExtraSavedHavokData{ 407036 };
+		inline constexpr REL::ID ExtraSayToTopicInfo{ 1210770 };
+		inline constexpr REL::ID ExtraSayTopicInfoOnceADay{ 393279 };
+		inline constexpr REL::ID ExtraScale{ 391686 };
+		inline constexpr REL::ID ExtraSceneData{ 583827 };
+		inline constexpr REL::ID ExtraScriptedAnimDependence{ 1267944 };
+		inline constexpr REL::ID ExtraSeed{ 1325714 };
+		inline constexpr REL::ID ExtraSeenData{ 562347 };
+		inline constexpr REL::ID ExtraShouldWear{ 229150 };
+		inline constexpr REL::ID ExtraSoul{ 1556186 };
+		inline constexpr REL::ID ExtraSound{ 1457480 };
+		inline constexpr REL::ID ExtraSoundOutputOverride{ 117313 };
+		inline constexpr REL::ID ExtraSpawnContainer{ 698085 };
+		inline constexpr REL::ID ExtraStartingPosition{ 498690 };
+		inline constexpr REL::ID ExtraStartingWorldOrCell{ 105329 };
+		inline constexpr REL::ID ExtraTeleport{ 983949 };
+		inline constexpr REL::ID ExtraTeleportName{ 794843 };
+		inline constexpr REL::ID ExtraTextDisplayData{ 443510 };
+		inline constexpr REL::ID ExtraTimeLeft{ 1362237 };
+		inline constexpr REL::ID ExtraTransitionCellCount{ 1466613 };
+		inline constexpr REL::ID ExtraTresPassPackage{ 655040 };
+		inline constexpr REL::ID ExtraUniqueID{ 303804 };
+		inline constexpr REL::ID ExtraUsedMarkers{ 884073 };
+		inline constexpr REL::ID ExtraVoiceType{ 352711 };
+		inline constexpr REL::ID ExtraWaterCurrentZoneData{ 915357 };
+		inline constexpr REL::ID ExtraWaterData{ 436756 };
+		inline constexpr REL::ID ExtraWaterLightRefs{ 202410 };
+	}
+}
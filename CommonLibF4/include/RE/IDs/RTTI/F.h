@@ -0,0 +1,55 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID FOCollisionListener{ 1508102 };
+		inline constexpr REL::ID FaceEmotionalIdleHandler{ 627162 };
+		inline constexpr REL::ID FaderData{ 882098 };
+		inline constexpr REL::ID FaderMenu{ 1197777 };
+		inline constexpr REL::ID FastTravelCommand{ 493142 };
+		inline constexpr REL::ID FastTravelCommandResult{ 1277551 };
+		inline constexpr REL::ID FavoritesManager{ 479003 };
+		inline constexpr REL::ID FavoritesMenu{ 12374 };
+		inline constexpr REL::ID FindEffectKeywordOnTargetFunctor{ 563952 };
+		inline constexpr REL::ID FindEqualsFunctor{ 1218287 };
+		inline constexpr REL::ID FindNonExcludedDeliveryFunctor{ 1357616 };
+		inline constexpr REL::ID FindTriangleForLocationFilter{ 1224062 };
+		inline constexpr REL::ID FindTriangleForLocationFilterCheckDeltaZ{ 1177249 };
+		inline constexpr REL::ID FindTriangleForLocationTraversableFilter{ 1143509 };
+		inline constexpr REL::ID FindTriangleForLocationWaterFilter{ 1316217 };
+		inline constexpr REL::ID FirstPersonState{ 1151626 };
+		inline constexpr REL::ID FlameProjectile{ 671202 };
+		inline constexpr REL::ID FlashDirectionalHitIndicators{ 1474753 };
+		inline constexpr REL::ID FlashDirectionalHitIndicators__SingleDirectionalHitIndicator{ 1427587 };
+		inline constexpr REL::ID FlashExplosiveIndicators{ 1128814 };
+		inline constexpr REL::ID FlashExplosiveIndicators__SingleExplosiveIndicator{ 1082276 };
+		inline constexpr REL::ID FlashHitIndicator{ 923216 };
+		inline constexpr REL::ID FlashLocationText{ 1534989 };
+		inline constexpr REL::ID FlashStealth{ 437694 };
+		inline constexpr REL::ID FlashVaultBoyCondition{ 1049444 };
+		inline constexpr REL::ID FlatScreenModel{ 707063 };
+		inline constexpr REL::ID FleePackage{ 694003 };
+		inline constexpr REL::ID FlightActionEndHandler{ 1384184 };
+		inline constexpr REL::ID FlightActionEntryEndHandler{ 1430778 };
+		inline constexpr REL::ID FlightActionGrabHandler{ 1118291 };
+		inline constexpr REL::ID FlightActionHandler{ 114667 };
+		inline constexpr REL::ID FlightActionReleaseHandler{ 852309 };
+		inline constexpr REL::ID FlightCrashLandStartHandler{ 805957 };
+		inline constexpr REL::ID FlightCruisingHandler{ 347739 };
+		inline constexpr REL::ID FlightHoveringHandler{ 81910 };
+		inline constexpr REL::ID FlightLandEndHandler{ 380684 };
+		inline constexpr REL::ID FlightLandHandler{ 865948 };
+		inline constexpr REL::ID FlightLandingHandler{ 1397920 };
+		inline constexpr REL::ID FlightPerchingHandler{ 1132043 };
+		inline constexpr REL::ID FlightTakeOffHandler{ 614011 };
+		inline constexpr REL::ID ForEachFunctorAdapter_SpellItem_Actor__ForEachSpellVisitor__lambda_74d47e067d27bfae8c7df29fba23a31e__{ 1391066 };
+		inline constexpr REL::ID ForEachFunctorAdapter_SpellItem_Actor__ForEachSpellVisitor__lambda_7f2e9e9062ce8d44ebd94a5be87bcf37__{ 593512 };
+		inline constexpr REL::ID FreeCameraState{ 1118722 };
+		inline constexpr REL::ID FrenzyEffect{ 220740 };
+		inline constexpr REL::ID FurnitureCameraState{ 148084 };
+		inline constexpr REL::ID FutBinaryFileC{ 464888 };
+		inline constexpr REL::ID float___ActorValueOwnerconst_ActorValueInfoconst_{ 1547709 };
+	}
+}
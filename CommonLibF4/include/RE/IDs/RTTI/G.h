@@ -0,0 +1,172 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID GFxConvertHandler{ 32517 };
+		inline constexpr REL::ID GameMenuBase{ 438396 };
+		inline constexpr REL::ID GameScript__BaseHandleReaderWriter{ 300366 };
+		inline constexpr REL::ID GameScript__BasicEventHandler{ 81775 };
+		inline constexpr REL::ID GameScript__CombatEventHandler{ 731232 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____AddItemFunctor_19_{ 1012984 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____ApplyHavokImpulseFunctor_16_{ 1127688 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____AttachAshPileFunctor_13_{ 21667 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____CastFunctor_21_{ 1222750 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____ClearDestructionFunctor_27_{ 36062 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____DamageObjectFunctor_2_{ 505608 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____DeleteFunctor_5_{ 1182920 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____DisableFunctor_4_{ 1103347 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____DropObjectFunctor_12_{ 1234976 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____DropRefFunctor_30_{ 985417 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____EnableFunctor_3_{ 1023699 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____ForceAddRemoveRagdollFunctor_15_{ 171101 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToFunctor_0_{ 1238012 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToNearestNavmeshLocFunctor_26_{ 1130770 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToOwnEditorLocFunctor_1_{ 174109 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToPackLocFunctor_10_{ 1058498 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____NonLatentDeleteFunctor_9_{ 118796 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____PlayBinkFunctor_25_{ 919562 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____RemoveComponentFunctor_29_{ 467173 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____RemoveItemFunctor_23_{ 1092607 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____ResetFunctor_17_{ 63786 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____ResurrectFunctor_20_{ 540551 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____ScrollCastFunctor_22_{ 12792 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____SendPlayerToJailFunctor_18_{ 1353784 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____SetAngleFunctor_7_{ 1155329 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____SetMotionTypeFunctor_8_{ 1072755 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____SetPositionFunctor_6_{ 1075831 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____SetScaleFunctor_11_{ 554756 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____WaitFor3DFunctor_24_{ 143290 };
+		inline constexpr REL::ID GameScript__ConcreteDelayFunctorFactory_GameScript____WaitForResourceRecalcFunctor_28_{ 661813 };
+		inline constexpr REL::ID GameScript__CustomEventHandler{ 24262 };
+		inline constexpr REL::ID GameScript__DataFileHandleReaderWriter{ 253954 };
+		inline constexpr REL::ID GameScript__DelayFunctor{ 1410908 };
+		inline constexpr REL::ID GameScript__DelayFunctorFactory{ 1145037 };
+		inline constexpr REL::ID GameScript__DispatchAndClean_GameScript__Internal__HitRegistrationList_{ 1142058 };
+		inline constexpr REL::ID GameScript__DispatchAndClean_GameScript__Internal__MagicEffectApplyRegistrationList_{ 689922 };
+		inline constexpr REL::ID GameScript__DispatchAndClean_GameScript__Internal__RadiationDamageRegistrationList_{ 1114528 };
+		inline constexpr REL::ID GameScript__DistanceEventHandler{ 1031847 };
+		inline constexpr REL::ID GameScript__FragmentEventHandler{ 1407190 };
+		inline constexpr REL::ID GameScript__HandlePolicy{ 798885 };
+		inline constexpr REL::ID GameScript__Internal__AnimationCallbacks{ 1391782 };
+		inline constexpr REL::ID GameScript__Internal__IProfileCallQuery{ 566179 };
+		inline constexpr REL::ID GameScript__Internal__LOSDetectionEventData{ 1556763 };
+		inline constexpr REL::ID GameScript__Internal__LOSDirectEventData{ 147125 };
+		inline constexpr REL::ID GameScript__Internal__LOSEventData{ 267940 };
+		inline constexpr REL::ID GameScript__InventoryEventHandler{ 1175937 };
+		inline constexpr REL::ID GameScript__LOSEventHandler{ 221318 };
+		inline constexpr REL::ID GameScript__Logger{ 128646 };
+		inline constexpr REL::ID GameScript__MenuEventHandler{ 550183 };
+		inline constexpr REL::ID GameScript__ObjectBindPolicy{ 532833 };
+		inline constexpr REL::ID GameScript__PathingCallbackMgr{ 687120 };
+		inline constexpr REL::ID GameScript__Profiler{ 739102 };
+		inline constexpr REL::ID GameScript__QuestCallbackMgr{ 944346 };
+		inline constexpr REL::ID GameScript__SaveFileHandleReaderWriter{ 426462 };
+		inline constexpr REL::ID GameScript__SavePatcher{ 478045 };
+		inline constexpr REL::ID GameScript__SingleActorArgument{ 990493 };
+		inline constexpr REL::ID GameScript__SingleObjectRefrHandleArgument{ 1308665 };
+		inline constexpr REL::ID GameScript__SingleSimpleArgument_bool_{ 413994 };
+		inline constexpr REL::ID GameScript__SingleSimpleArgument_unsignedint_{ 963215 };
+		inline constexpr REL::ID GameScript__SleepEventHandler{ 949749 };
+		inline constexpr REL::ID GameScript__SoundCallbackMgr{ 455728 };
+		inline constexpr REL::ID GameScript__Store{ 1525567 };
+		inline constexpr REL::ID GameScript__TeleportEventHandler{ 1005011 };
+		inline constexpr REL::ID GameScript__TimerEventHandler{ 1057069 };
+		inline constexpr REL::ID GameScript__TrackedStatsEventHandler{ 302653 };
+		inline constexpr REL::ID GameScript__WaitEventHandler{ 324126 };
+		inline constexpr REL::ID GameScript____AddItemFunctor{ 840417 };
+		inline constexpr REL::ID GameScript____AddUniqueIDVisitor{ 599533 };
+		inline constexpr REL::ID GameScript____AnimationEventArguments{ 388328 };
+		inline constexpr REL::ID GameScript____ApplyHavokImpulseFunctor{ 516314 };
+		inline constexpr REL::ID GameScript____AttachAshPileFunctor{ 992626 };
+		inline constexpr REL::ID GameScript____CastFunctor{ 1049722 };
+		inline constexpr REL::ID GameScript____ClearDestructionFunctor{ 1006939 };
+		inline constexpr REL::ID GameScript____DamageObjectFunctor{ 1476654 };
+		inline constexpr REL::ID GameScript____DeleteFunctor{ 1009938 };
+		inline constexpr REL::ID GameScript____DisableFunctor{ 930570 };
+		inline constexpr REL::ID GameScript____DropObjectFunctor{ 1062054 };
+		inline constexpr REL::ID GameScript____DropRefFunctor{ 593716 };
+		inline constexpr REL::ID GameScript____EnableFunctor{ 631944 };
+		inline constexpr REL::ID GameScript____FadeThenMainMenuCallback{ 826460 };
+		inline constexpr REL::ID GameScript____ForceAddRemoveRagdollFunctor{ 1141555 };
+		inline constexpr REL::ID GameScript____LatentPlayerMover{ 656958 };
+		inline constexpr REL::ID GameScript____LinkParentFunctor__lambda_10580ac741bfa706def9f15af95ca75d__{ 744552 };
+		inline constexpr REL::ID GameScript____LinkParentFunctor__lambda_3bab0297006047a3c95f5ff9fb7db710__{ 1023906 };
+		inline constexpr REL::ID GameScript____LinkParentFunctor__lambda_c273be970791f0519c5d877440ad9e75__{ 930812 };
+		inline constexpr REL::ID GameScript____LinkParentFunctor__lambda_e776a4297db3f3762fd98c1aa8429394__{ 651295 };
+		inline constexpr REL::ID GameScript____MoveToBaseFunctor{ 892468 };
+		inline constexpr REL::ID GameScript____MoveToFunctor{ 1065029 };
+		inline constexpr REL::ID GameScript____MoveToNearestNavmeshLocFunctor{ 519412 };
+		inline constexpr REL::ID GameScript____MoveToOwnEditorLocFunctor{ 1144534 };
+		inline constexpr REL::ID GameScript____MoveToPackLocFunctor{ 446824 };
+		inline constexpr REL::ID GameScript____NonLatentDeleteFunctor{ 1089543 };
+		inline constexpr REL::ID GameScript____PlayBinkFunctor{ 527624 };
+		inline constexpr REL::ID GameScript____ProfileCallQueryTranslator{ 1084215 };
+		inline constexpr REL::ID GameScript____RawProfileCallQuery{ 472592 };
+		inline constexpr REL::ID GameScript____RemoveComponentFunctor{ 1438043 };
+		inline constexpr REL::ID GameScript____RemoveItemFunctor{ 919789 };
+		inline constexpr REL::ID GameScript____RemoveUniqueIDAndRefrFunctor{ 819754 };
+		inline constexpr REL::ID GameScript____ResetFunctor{ 1254018 };
+		inline constexpr REL::ID GameScript____ResurrectFunctor{ 148279 };
+		inline constexpr REL::ID GameScript____ScriptMessageBoxCallback{ 1565013 };
+		inline constexpr REL::ID GameScript____ScrollCastFunctor{ 1422511 };
+		inline constexpr REL::ID GameScript____SendPlayerToJailFunctor{ 742734 };
+		inline constexpr REL::ID GameScript____SetAngleFunctor{ 982383 };
+		inline constexpr REL::ID GameScript____SetMotionTypeFunctor{ 460970 };
+		inline constexpr REL::ID GameScript____SetPositionFunctor{ 464013 };
+		inline constexpr REL::ID GameScript____SetScaleFunctor{ 162570 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 304618 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____KeywordStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_{ 905480 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 387189 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1445133 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1192957 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 532617 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1157744 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__BoolStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 951413 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 795671 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 929886 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 501862 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1324201 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 598387 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1012307 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 850422 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 249728 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 819966 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__BoolStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 699632 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 384101 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1072083 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1489781 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 760440 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 507926 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1420422 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 874796 };
+		inline constexpr REL::ID GameScript____StoryEventArguments_GameScript____UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_{ 1340978 };
+		inline constexpr REL::ID GameScript____UniqueIDCompareFunctor{ 208340 };
+		inline constexpr REL::ID GameScript____WaitFor3DFunctor{ 1552998 };
+		inline constexpr REL::ID GameScript____WaitForResourceRecalcFunctor{ 49937 };
+		inline constexpr REL::ID GameScript____WriteStackWrapper{ 1199794 };
+		inline constexpr REL::ID GameSettingCollection{ 1302515 };
+		inline constexpr REL::ID GameUIModel{ 918188 };
+		inline constexpr REL::ID GameVM{ 214866 };
+		inline constexpr REL::ID GenericMenu{ 1329015 };
+		inline constexpr REL::ID GetBestAmmoFunctor{ 400641 };
+		inline constexpr REL::ID GetBestArmorFunctor{ 134790 };
+		inline constexpr REL::ID GetBestLightFunctor{ 1451164 };
+		inline constexpr REL::ID GetBestWeaponFunctor{ 667042 };
+		inline constexpr REL::ID GetCostliestEffectFunctor{ 732987 };
+		inline constexpr REL::ID GetMagicItemDescriptionFunctor{ 995360 };
+		inline constexpr REL::ID GetUpEndHandler{ 704586 };
+		inline constexpr REL::ID GetUpStartHandler{ 1189519 };
+		inline constexpr REL::ID GrabRotationHandler{ 1039451 };
+		inline constexpr REL::ID GrenadeProjectile{ 358150 };
+		inline constexpr REL::ID GridArray{ 989680 };
+		inline constexpr REL::ID GridCellArray{ 192306 };
+		inline constexpr REL::ID GroundPathPathingNodeGenerator{ 567144 };
+		inline constexpr REL::ID GroundPathRayValidator{ 1364686 };
+		inline constexpr REL::ID GuardActorPackageData{ 718959 };
+		inline constexpr REL::ID GuardPackageData{ 1204143 };
+		inline constexpr REL::ID GuideEffect{ 1576043 };
+		inline constexpr REL::ID GunDownStateChangeHandler{ 966988 };
+	}
+}
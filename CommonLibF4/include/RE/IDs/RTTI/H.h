@@ -0,0 +1,1039 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID HUDActionPointData{ 1016029 };
+		inline constexpr REL::ID HUDActionPointMeter{ 1049091 };
+		inline constexpr REL::ID HUDActiveEffectsDisplay{ 1462789 };
+		inline constexpr REL::ID HUDActiveEffectsModel{ 475032 };
+		inline constexpr REL::ID HUDActorValueMeterBase{ 783302 };
+		inline constexpr REL::ID HUDAmmoCounter{ 233719 };
+		inline constexpr REL::ID HUDCompass{ 92327 };
+		inline constexpr REL::ID HUDCompassBase{ 577787 };
+		inline constexpr REL::ID HUDCompassDirectionMarker{ 201801 };
+		inline constexpr REL::ID HUDCompassMarker{ 1518105 };
+		inline constexpr REL::ID HUDCompassMarkerBase{ 467454 };
+		inline constexpr REL::ID HUDComponentBase{ 909259 };
+		inline constexpr REL::ID HUDCriticalMeter{ 1331233 };
+		inline constexpr REL::ID HUDCrosshair{ 753020 };
+		inline constexpr REL::ID HUDCrosshair__FXCrosshairBase{ 267448 };
+		inline constexpr REL::ID HUDCrosshair__FXCrosshairBase__FXCrosshairTicks{ 439914 };
+		inline constexpr REL::ID HUDData{ 540482 };
+		inline constexpr REL::ID HUDDataBase{ 1417579 };
+		inline constexpr REL::ID HUDDataModel{ 863112 };
+		inline constexpr REL::ID HUDDirectionalHitIndicatorDataModel{ 1174737 };
+		inline constexpr REL::ID HUDEnemyHealthMeter{ 804216 };
+		inline constexpr REL::ID HUDExperienceMeter{ 35584 };
+		inline constexpr REL::ID HUDExplosiveAmmoCounter{ 598395 };
+		inline constexpr REL::ID HUDExplosivesDataModel{ 1022557 };
+		inline constexpr REL::ID HUDFatigueWarning{ 1397846 };
+		inline constexpr REL::ID HUDFlashLightWidget{ 281139 };
+		inline constexpr REL::ID HUDFloatingQuestMarkers{ 17969 };
+		inline constexpr REL::ID HUDFloatingQuestMarkers__QuestMarker{ 1334423 };
+		inline constexpr REL::ID HUDLocationText{ 434512 };
+		inline constexpr REL::ID HUDMenu{ 1339583 };
+		inline constexpr REL::ID HUDMessages{ 882068 };
+		inline constexpr REL::ID HUDMessagesModel{ 1349101 };
+		inline constexpr REL::ID HUDMeter{ 517066 };
+		inline constexpr REL::ID HUDMeterBase{ 1394323 };
+		inline constexpr REL::ID HUDNotificationsModel{ 767374 };
+		inline constexpr REL::ID HUDObjectiveUpdates{ 36511 };
+		inline constexpr REL::ID HUDPerkVaultBoy{ 1445343 };
+		inline constexpr REL::ID HUDPerkVaultBoyModel{ 95503 };
+		inline constexpr REL::ID HUDPlayerHealthMeter{ 53458 };
+		inline constexpr REL::ID HUDPowerArmorLowBatterWarningText{ 794289 };
+		inline constexpr REL::ID HUDQuestUpdates{ 354630 };
+		inline constexpr REL::ID HUDQuestVaultBoy{ 522171 };
+		inline constexpr REL::ID HUDQuickContainer{ 1308590 };
+		inline constexpr REL::ID HUDQuickContainerDataModel{ 1008966 };
+		inline constexpr REL::ID HUDRadiationMeter{ 1347693 };
+		inline constexpr REL::ID HUDRadiationModel{ 267160 };
+		inline constexpr REL::ID HUDRollover{ 927468 };
+		inline constexpr REL::ID HUDRolloverModel{ 189507 };
+		inline constexpr REL::ID HUDScreenModel{ 371787 };
+		inline constexpr REL::ID HUDStealthMeter{ 920082 };
+		inline constexpr REL::ID HUDSubtitleText{ 1335745 };
+		inline constexpr REL::ID HUDTutorialText{ 1212453 };
+		inline constexpr REL::ID HandlerCreationMissPolicy_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ 1456691 };
+		inline constexpr REL::ID HasSpellVisitor{ 928355 };
+		inline constexpr REL::ID HavokError{ 1331873 };
+		inline constexpr REL::ID HavokFileStreambufReader{ 575394 };
+		inline constexpr REL::ID HavokFileStreambufWriter{ 309262 };
+		inline constexpr REL::ID HavokStreambufFactory{ 15318 };
+		inline constexpr REL::ID Hazard{ 698804 };
+		inline constexpr REL::ID HeadTrackingOffHandler{ 972958 };
+		inline constexpr REL::ID HeadTrackingOnHandler{ 1239285 };
+		inline constexpr REL::ID HeadTrackingRotationOffHandler{ 660779 };
+		inline constexpr REL::ID HeadTrackingRotationOnHandler{ 707604 };
+		inline constexpr REL::ID HealthDamageFunctor{ 942242 };
+		inline constexpr REL::ID HeldStateHandler{ 782206 };
+		inline constexpr REL::ID HelpMessageManager{ 224289 };
+		inline constexpr REL::ID HighActorCuller{ 796485 };
+		inline constexpr REL::ID HitFrameHandler{ 123163 };
+		inline constexpr REL::ID HolotapeDataManager{ 1055681 };
+		inline constexpr REL::ID HolotapeLoadedHandler{ 1191834 };
+		inline constexpr REL::ID HolotapeMenu{ 636291 };
+		inline constexpr REL::ID HorseCameraState{ 468832 };
+		inline constexpr REL::ID hclAction{ 67728 };
+		inline constexpr REL::ID hclAntiPinchConstraintInstanceData{ 1420435 };
+		inline constexpr REL::ID hclAntiPinchConstraintSet{ 1577979 };
+		inline constexpr REL::ID hclBSClothParameterizedWindAction{ 679607 };
+		inline constexpr REL::ID hclBSWorld{ 834930 };
+		inline constexpr REL::ID hclBendLinkConstraintSet{ 513818 };
+		inline constexpr REL::ID hclBendLinkConstraintSetMx{ 1298007 };
+		inline constexpr REL::ID hclBendStiffnessConstraintSet{ 985249 };
+		inline constexpr REL::ID hclBendStiffnessConstraintSetMx{ 406712 };
+		inline constexpr REL::ID hclBlendSomeVerticesOperator{ 1410234 };
+		inline constexpr REL::ID hclBonePlanesConstraintSet{ 1097902 };
+		inline constexpr REL::ID hclBoneSpaceMeshMeshDeformOperator{ 1051167 };
+		inline constexpr REL::ID hclBoneSpaceMeshMeshDeformPNOperator{ 1224180 };
+		inline constexpr REL::ID hclBoneSpaceMeshMeshDeformPNTBOperator{ 1396498 };
+		inline constexpr REL::ID hclBoneSpaceMeshMeshDeformPNTOperator{ 1569691 };
+		inline constexpr REL::ID hclBoneSpaceMeshMeshDeformPOperator{ 160085 };
+		inline constexpr REL::ID hclBoneSpaceSkinOperator{ 332694 };
+		inline constexpr REL::ID hclBoneSpaceSkinPNOperator{ 66747 };
+		inline constexpr REL::ID hclBoneSpaceSkinPNTBOperator{ 19628 };
+		inline constexpr REL::ID hclBoneSpaceSkinPNTOperator{ 1555852 };
+		inline constexpr REL::ID hclBoneSpaceSkinPOperator{ 1509377 };
+		inline constexpr REL::ID hclBuffer{ 546294 };
+		inline constexpr REL::ID hclBufferDefinition{ 1462585 };
+		inline constexpr REL::ID hclCapsuleShape{ 491546 };
+		inline constexpr REL::ID hclClothContainer{ 449642 };
+		inline constexpr REL::ID hclClothData{ 1308683 };
+		inline constexpr REL::ID hclClothInstance{ 1104116 };
+		inline constexpr REL::ID hclClothState{ 291236 };
+		inline constexpr REL::ID hclCollidable{ 6695 };
+		inline constexpr REL::ID hclCompressibleLinkConstraintSet{ 1122169 };
+		inline constexpr REL::ID hclCompressibleLinkConstraintSetMx{ 543940 };
+		inline constexpr REL::ID hclConstraintSet{ 480907 };
+		inline constexpr REL::ID hclConvexGeometryShape{ 716839 };
+		inline constexpr REL::ID hclConvexHeightFieldShape{ 450135 };
+		inline constexpr REL::ID hclConvexPlanesShape{ 184665 };
+		inline constexpr REL::ID hclCopyVerticesOperator{ 1501109 };
+		inline constexpr REL::ID hclGatherAllVerticesOperator{ 1234792 };
+		inline constexpr REL::ID hclGatherSomeVerticesOperator{ 921939 };
+		inline constexpr REL::ID hclInputConvertOperator{ 875286 };
+		inline constexpr REL::ID hclInstantiationUtil{ 951921 };
+		inline constexpr REL::ID hclLocalRangeConstraintSet{ 157084 };
+		inline constexpr REL::ID hclMeshBoneDeformOperator{ 1426314 };
+		inline constexpr REL::ID hclMeshMeshDeformOperator{ 1226455 };
+		inline constexpr REL::ID hclMoveParticlesOperator{ 913625 };
+		inline constexpr REL::ID hclObjectSpaceMeshMeshDeformOperator{ 647808 };
+		inline constexpr REL::ID hclObjectSpaceMeshMeshDeformPNOperator{ 820444 };
+		inline constexpr REL::ID hclObjectSpaceMeshMeshDeformPNTBOperator{ 992900 };
+		inline constexpr REL::ID hclObjectSpaceMeshMeshDeformPNTOperator{ 1165939 };
+		inline constexpr REL::ID hclObjectSpaceMeshMeshDeformPOperator{ 1338443 };
+		inline constexpr REL::ID hclObjectSpaceSkinOperator{ 1511629 };
+		inline constexpr REL::ID hclObjectSpaceSkinPNOperator{ 1464903 };
+		inline constexpr REL::ID hclObjectSpaceSkinPNTBOperator{ 573642 };
+		inline constexpr REL::ID hclObjectSpaceSkinPNTOperator{ 526996 };
+		inline constexpr REL::ID hclObjectSpaceSkinPOperator{ 480186 };
+		inline constexpr REL::ID hclOperator{ 313548 };
+		inline constexpr REL::ID hclOutputConvertOperator{ 433326 };
+		inline constexpr REL::ID hclPlaneShape{ 167859 };
+		inline constexpr REL::ID hclPointContactPlanesShape{ 201590 };
+		inline constexpr REL::ID hclScratchBuffer{ 1412065 };
+		inline constexpr REL::ID hclScratchBufferDefinition{ 1484254 };
+		inline constexpr REL::ID hclShadowBuffer{ 926838 };
+		inline constexpr REL::ID hclShadowBufferDefinition{ 1437131 };
+		inline constexpr REL::ID hclShape{ 1196548 };
+		inline constexpr REL::ID hclSimClothData{ 625692 };
+		inline constexpr REL::ID hclSimClothInstance{ 273326 };
+		inline constexpr REL::ID hclSimClothPose{ 359367 };
+		inline constexpr REL::ID hclSimpleMeshBoneDeformOperator{ 1190401 };
+		inline constexpr REL::ID hclSimpleWindAction{ 945096 };
+		inline constexpr REL::ID hclSimulateOperator{ 877650 };
+		inline constexpr REL::ID hclSkinOperator{ 565278 };
+		inline constexpr REL::ID hclSphereShape{ 79802 };
+		inline constexpr REL::ID hclStandardLinkConstraintSet{ 644838 };
+		inline constexpr REL::ID hclStandardLinkConstraintSetMx{ 66039 };
+		inline constexpr REL::ID hclStaticShadowBuffer{ 441297 };
+		inline constexpr REL::ID hclStaticShadowBufferDefinition{ 663944 };
+		inline constexpr REL::ID hclStretchLinkConstraintSet{ 776331 };
+		inline constexpr REL::ID hclStretchLinkConstraintSetMx{ 104242 };
+		inline constexpr REL::ID hclTaperedCapsuleShape{ 57519 };
+		inline constexpr REL::ID hclTransformSet{ 1437170 };
+		inline constexpr REL::ID hclTransformSetDefinition{ 1107804 };
+		inline constexpr REL::ID hclTransitionConstraintInstanceData{ 1267115 };
+		inline constexpr REL::ID hclTransitionConstraintSet{ 575919 };
+		inline constexpr REL::ID hclUpdateAllVertexFramesOperator{ 529314 };
+		inline constexpr REL::ID hclUpdateSomeVertexFramesOperator{ 170217 };
+		inline constexpr REL::ID hclVolumeConstraint{ 1173605 };
+		inline constexpr REL::ID hclVolumeConstraintInstanceData{ 1439705 };
+		inline constexpr REL::ID hclVolumeConstraintMx{ 1425634 };
+		inline constexpr REL::ID hclVolumeConstraintMxInstanceData{ 1392941 };
+		inline constexpr REL::ID hclWorld{ 349351 };
+		inline constexpr REL::ID hclWorldListener{ 29021 };
+		inline constexpr REL::ID hkArrayBase_hkVector4d_{ 1240442 };
+		inline constexpr REL::ID hkArrayStreamWriter{ 50138 };
+		inline constexpr REL::ID hkArray_hkVector4d_hkContainerHeapAllocator_{ 628987 };
+		inline constexpr REL::ID hkBaseObject{ 518410 };
+		inline constexpr REL::ID hkBinaryPackfileWriter{ 1538685 };
+		inline constexpr REL::ID hkBinaryTagfileReader{ 1272612 };
+		inline constexpr REL::ID hkBinaryTagfileWriter{ 862395 };
+		inline constexpr REL::ID hkBlockStreamAllocator{ 498682 };
+		inline constexpr REL::ID hkBlockStreamCommandWriter{ 1259614 };
+		inline constexpr REL::ID hkBsdSocket{ 839163 };
+		inline constexpr REL::ID hkBufferedStreamReader{ 1567065 };
+		inline constexpr REL::ID hkBufferedStreamWriter{ 1225431 };
+		inline constexpr REL::ID hkBuiltinTypeRegistry{ 1399684 };
+		inline constexpr REL::ID hkClassNameRegistry{ 83689 };
+		inline constexpr REL::ID hkCommandRouter{ 254532 };
+		inline constexpr REL::ID hkContainerDebugAllocator__Allocator{ 709384 };
+		inline constexpr REL::ID hkContainerHeapAllocator__Allocator{ 536310 };
+		inline constexpr REL::ID hkContainerResourceMap{ 203912 };
+		inline constexpr REL::ID hkContainerTempAllocator__Allocator{ 363245 };
+		inline constexpr REL::ID hkCrc32StreamWriter{ 484077 };
+		inline constexpr REL::ID hkCrcStreamWriter_unsignedint_3988292384_{ 218210 };
+		inline constexpr REL::ID hkDataArrayImpl{ 244487 };
+		inline constexpr REL::ID hkDataArrayNative{ 708154 };
+		inline constexpr REL::ID hkDataClassDict{ 855944 };
+		inline constexpr REL::ID hkDataClassImpl{ 1341132 };
+		inline constexpr REL::ID hkDataClassNative{ 362039 };
+		inline constexpr REL::ID hkDataObjectDict{ 370506 };
+		inline constexpr REL::ID hkDataObjectImpl{ 1215482 };
+		inline constexpr REL::ID hkDataObjectNative{ 973513 };
+		inline constexpr REL::ID hkDataRefCounted{ 730163 };
+		inline constexpr REL::ID hkDataWorld{ 118254 };
+		inline constexpr REL::ID hkDataWorldDict{ 1467599 };
+		inline constexpr REL::ID hkDataWorldNative{ 1459154 };
+		inline constexpr REL::ID hkDebugCommandProcessor{ 1386595 };
+		inline constexpr REL::ID hkDebugDisplay{ 1119746 };
+		inline constexpr REL::ID hkDebugDisplayHandler{ 588073 };
+		inline constexpr REL::ID hkDebugDisplayProcess{ 1199518 };
+		inline constexpr REL::ID hkDefaultBuiltinTypeRegistry{ 242607 };
+		inline constexpr REL::ID hkDefaultClassNameRegistry{ 1260082 };
+		inline constexpr REL::ID hkDefaultClassWrapper{ 381236 };
+		inline constexpr REL::ID hkDefaultError{ 187107 };
+		inline constexpr REL::ID hkDefaultImage{ 1151606 };
+		inline constexpr REL::ID hkDefaultMemoryTracker{ 104838 };
+		inline constexpr REL::ID hkDisplayAABB{ 1490139 };
+		inline constexpr REL::ID hkDisplayBox{ 1034840 };
+		inline constexpr REL::ID hkDisplayCapsule{ 878236 };
+		inline constexpr REL::ID hkDisplayCone{ 1174844 };
+		inline constexpr REL::ID hkDisplayConvex{ 392848 };
+		inline constexpr REL::ID hkDisplayCylinder{ 549808 };
+		inline constexpr REL::ID hkDisplayGeometry{ 266887 };
+		inline constexpr REL::ID hkDisplayMesh{ 1520568 };
+		inline constexpr REL::ID hkDisplayPlane{ 423286 };
+		inline constexpr REL::ID hkDisplaySemiCircle{ 689791 };
+		inline constexpr REL::ID hkDisplaySerializeIStream{ 3914 };
+		inline constexpr REL::ID hkDisplaySerializeOStream{ 583364 };
+		inline constexpr REL::ID hkDisplaySphere{ 1363359 };
+		inline constexpr REL::ID hkDisplayTaperedCapsule{ 64154 };
+		inline constexpr REL::ID hkDisplayWireframe{ 1004241 };
+		inline constexpr REL::ID hkDummyMemoryTrackerImpl{ 370681 };
+		inline constexpr REL::ID hkDummySingleton{ 707445 };
+		inline constexpr REL::ID hkDynamicClassNameRegistry{ 1306519 };
+		inline constexpr REL::ID hkErrStream{ 721649 };
+		inline constexpr REL::ID hkError{ 980975 };
+		inline constexpr REL::ID hkFileSystem{ 1107277 };
+		inline constexpr REL::ID hkFileSystem__Iterator__Impl{ 861027 };
+		inline constexpr REL::ID hkFixedBlockStreamAllocator{ 232883 };
+		inline constexpr REL::ID hkGeometry{ 1179027 };
+		inline constexpr REL::ID hkGeometryProcessing__ConstFunction_hkGeometryProcessing__IFunction_hkVector4f_float__{ 871891 };
+		inline constexpr REL::ID hkGeometryProcessing__IFunction_hkVector4f_float_{ 1497664 };
+		inline constexpr REL::ID hkGeometryUtils__IVertices{ 985386 };
+		inline constexpr REL::ID hkHardwareInfo{ 361329 };
+		inline constexpr REL::ID hkIArchive{ 535306 };
+		inline constexpr REL::ID hkImage{ 274200 };
+		inline constexpr REL::ID hkIndexedTransformSet{ 788326 };
+		inline constexpr REL::ID hkInspectProcess{ 284219 };
+		inline constexpr REL::ID hkIstream{ 1528008 };
+		inline constexpr REL::ID hkLifoAllocator{ 196240 };
+		inline constexpr REL::ID hkLoader{ 998184 };
+		inline constexpr REL::ID hkLocalFrame{ 455620 };
+		inline constexpr REL::ID hkLocalFrameCollector{ 903965 };
+		inline constexpr REL::ID hkLocalFrameGroup{ 983937 };
+		inline constexpr REL::ID hkMallocAllocator{ 195101 };
+		inline constexpr REL::ID hkMemoryAllocator{ 848699 };
+		inline constexpr REL::ID hkMemoryMeshBody{ 1341317 };
+		inline constexpr REL::ID hkMemoryMeshMaterial{ 27575 };
+		inline constexpr REL::ID hkMemoryMeshShape{ 593068 };
+		inline constexpr REL::ID hkMemoryMeshTexture{ 173018 };
+		inline constexpr REL::ID hkMemoryMeshTexture__Sampler{ 1423537 };
+		inline constexpr REL::ID hkMemoryMeshVertexBuffer{ 845109 };
+		inline constexpr REL::ID hkMemoryResourceContainer{ 469506 };
+		inline constexpr REL::ID hkMemoryResourceHandle{ 736083 };
+		inline constexpr REL::ID hkMemorySnapshotProcess{ 1380930 };
+		inline constexpr REL::ID hkMemoryStreamReader{ 1207245 };
+		inline constexpr REL::ID hkMemorySystem{ 1524279 };
+		inline constexpr REL::ID hkMemoryTrackStreamReader{ 1133530 };
+		inline constexpr REL::ID hkMemoryTrackStreamWriter{ 316240 };
+		inline constexpr REL::ID hkMemoryTracker{ 856123 };
+		inline constexpr REL::ID hkMeshBody{ 244680 };
+		inline constexpr REL::ID hkMeshMaterial{ 513341 };
+		inline constexpr REL::ID hkMeshShape{ 1078176 };
+		inline constexpr REL::ID hkMeshTexture{ 658438 };
+		inline constexpr REL::ID hkMeshTexture__Sampler{ 1376854 };
+		inline constexpr REL::ID hkMeshVertexBuffer{ 1111110 };
+		inline constexpr REL::ID hkMonitorStreamColorTable{ 1440737 };
+		inline constexpr REL::ID hkMultipleVertexBuffer{ 313066 };
+		inline constexpr REL::ID hkOArchive{ 477499 };
+		inline constexpr REL::ID hkObjectCopier{ 1433392 };
+		inline constexpr REL::ID hkObjectResource{ 1552681 };
+		inline constexpr REL::ID hkObjectWriter{ 1182609 };
+		inline constexpr REL::ID hkOffsetOnlyStreamWriter{ 1448650 };
+		inline constexpr REL::ID hkOstream{ 548699 };
+		inline constexpr REL::ID hkPackfileData{ 455400 };
+		inline constexpr REL::ID hkPackfileWriter{ 430696 };
+		inline constexpr REL::ID hkPackfileWriter__AddObjectListener{ 632720 };
+		inline constexpr REL::ID hkParserBuffer{ 1490358 };
+		inline constexpr REL::ID hkPlatformObjectWriter{ 697622 };
+		inline constexpr REL::ID hkPlatformObjectWriter__Cache{ 430907 };
+		inline constexpr REL::ID hkProcess{ 321785 };
+		inline constexpr REL::ID hkProcessFactory{ 939795 };
+		inline constexpr REL::ID hkProcessHandler{ 1005642 };
+		inline constexpr REL::ID hkReferencedObject{ 1388894 };
+		inline constexpr REL::ID hkReferencedObjectLock{ 677029 };
+		inline constexpr REL::ID hkRemoteObjectClientSideListener{ 1086585 };
+		inline constexpr REL::ID hkRemoteObjectProcess{ 1115089 };
+		inline constexpr REL::ID hkReplayStreamReader{ 317138 };
+		inline constexpr REL::ID hkResource{ 1034677 };
+		inline constexpr REL::ID hkResourceBase{ 609763 };
+		inline constexpr REL::ID hkResourceContainer{ 875515 };
+		inline constexpr REL::ID hkResourceHandle{ 1221411 };
+		inline constexpr REL::ID hkResourceMap{ 124299 };
+		inline constexpr REL::ID hkSecondaryCommandDispatcher{ 1181220 };
+		inline constexpr REL::ID hkSeekableStreamReader{ 1300685 };
+		inline constexpr REL::ID hkSerializeDeprecated{ 992551 };
+		inline constexpr REL::ID hkServerDebugDisplayHandler{ 51072 };
+		inline constexpr REL::ID hkServerProcessHandler{ 520491 };
+		inline constexpr REL::ID hkSignal0__MemberSlot_hknpShapeManager__MutableShapeInfo_void_hknpShapeManager__MutableShapeInfo____void__{ 521914 };
+		inline constexpr REL::ID hkSignal0__Slot{ 1366204 };
+		inline constexpr REL::ID hkSignal1_hknpBodyQualityId___MemberSlot_hknpWorldEx_void_hknpWorldEx____hknpBodyQualityId__{ 333543 };
+		inline constexpr REL::ID hkSignal1_hknpBodyQualityId___Slot{ 1326252 };
+		inline constexpr REL::ID hkSignal1_hknpMaterialId___MemberSlot_hknpWorldEx_void_hknpWorldEx____hknpMaterialId__{ 426629 };
+		inline constexpr REL::ID hkSignal1_hknpMaterialId___Slot{ 1320907 };
+		inline constexpr REL::ID hkSignal1_hknpWorld___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld__{ 1090190 };
+		inline constexpr REL::ID hkSignal1_hknpWorld___MemberSlot_hknpBSCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld__{ 261796 };
+		inline constexpr REL::ID hkSignal1_hknpWorld___MemberSlot_hknpCharacterProxy_void_hknpCharacterProxy____hknpWorld__{ 1312989 };
+		inline constexpr REL::ID hkSignal1_hknpWorld___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld__{ 926253 };
+		inline constexpr REL::ID hkSignal1_hknpWorld___Slot{ 459349 };
+		inline constexpr REL::ID hkSignal1_unsignedchar___MemberSlot_hknpShapeManager__MutableShapeInfo_void_hknpShapeManager__MutableShapeInfo____unsignedchar__{ 615277 };
+		inline constexpr REL::ID hkSignal1_unsignedchar___Slot{ 881025 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___GlobalSlot_void___hknpEventHandlerInputconst_hknpEventconst__{ 1404291 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_BGSWaterCollisionManager__AutoWater_void_BGSWaterCollisionManager__BGSWaterUpdateI____hknpEventHandlerInputconst_hknpEventconst__{ 102635 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_BGSWaterCollisionManager__bhkPlaceableWater_void_BGSWaterCollisionManager__BGSWaterUpdateI____hknpEventHandlerInputconst_hknpEventconst__{ 1352930 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_BGSWaterCollisionManager__bhkWaterfall_void_BGSWaterCollisionManager__BGSWaterUpdateI____hknpEventHandlerInputconst_hknpEventconst__{ 728235 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_FOCollisionListener_void_FOCollisionListener____hknpEventHandlerInputconst_hknpEventconst__{ 491599 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_NavMeshObstacleManager_void_NavMeshObstacleManager____hknpEventHandlerInputconst_hknpEventconst__{ 846704 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_bhkCharRigidBodyController_void_bhkCharRigidBodyController____hknpEventHandlerInputconst_hknpEventconst__{ 980839 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpBSCharacterRigidBody_void_hknpCharacterRigidBody____hknpEventHandlerInputconst_hknpEventconst__{ 1246487 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpEventHandlerInputconst_hknpEventconst__{ 1565611 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpProjectileGun_void_hknpProjectileGun____hknpEventHandlerInputconst_hknpEventconst__{ 1406732 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpWorldEx_void_hknpWorldEx____hknpEventHandlerInputconst_hknpEventconst__{ 786260 };
+		inline constexpr REL::ID hkSignal2_hknpEventHandlerInputconst_hknpEventconst___Slot{ 864577 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hkbnpPhysicsInterface_void_hkbnpPhysicsInterface____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ 459095 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ 160120 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpConstraintCollisionFilter_void_hknpConstraintCollisionFilter____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ 1278666 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpSafeEaseConstraintsAction_void_hknpSafeEaseConstraintsAction____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ 967223 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____Slot{ 1465269 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkVector4fconst___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld_hkVector4fconst__{ 1435585 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hkVector4fconst___Slot{ 412839 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___GlobalSlot_void___hknpWorld_hknpBodyId__{ 509558 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___MemberSlot_NavMeshObstacleManager_void_NavMeshObstacleManager____hknpWorld_hknpBodyId__{ 62479 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld_hknpBodyId__{ 1449600 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___MemberSlot_bhkTrapListener_void_bhkTrapListener____hknpWorld_hknpBodyId__{ 1555884 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___MemberSlot_hkbnpPhysicsInterface_void_hkbnpPhysicsInterface____hknpWorld_hknpBodyId__{ 1257475 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hknpBodyId__{ 1410266 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___MemberSlot_hknpUniqueBodyIdHitCollector_void_hknpUniqueBodyIdHitCollector____hknpWorld_hknpBodyId__{ 233519 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyId___Slot{ 1480665 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyManager___GlobalSlot_void___hknpWorld_hknpBodyManager__{ 294296 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpBodyManager___Slot{ 1081708 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpConstraintManager___GlobalSlot_void___hknpWorld_hknpConstraintManager__{ 1424035 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpConstraintManager___Slot{ 722908 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpMotionManager___GlobalSlot_void___hknpWorld_hknpMotionManager__{ 640212 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpMotionManager___Slot{ 111012 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpSolverData___MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hknpSolverData__{ 626418 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpSolverData___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld_hknpSolverData__{ 1285587 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpSolverData___Slot{ 1220088 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpStepInputconst___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld_hknpStepInputconst__{ 1369771 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpStepInputconst___MemberSlot_hknpBSCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld_hknpStepInputconst__{ 182500 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpStepInputconst___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld_hknpStepInputconst__{ 62525 };
+		inline constexpr REL::ID hkSignal2_hknpWorld_hknpStepInputconst___Slot{ 1024358 };
+		inline constexpr REL::ID hkSignal3_hknpWorld_hknpBodyCinfoconst_hknpBodyId___MemberSlot_hkbnpPhysicsInterface_void_hkbnpPhysicsInterface____hknpWorld_hknpBodyCinfoconst_hknpBodyId__{ 712108 };
+		inline constexpr REL::ID hkSignal3_hknpWorld_hknpBodyCinfoconst_hknpBodyId___Slot{ 1284907 };
+		inline constexpr REL::ID hkSignal3_hknpWorld_hknpConstraintCinfoconst_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hknpConstraintCinfoconst_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ 612584 };
+		inline constexpr REL::ID hkSignal3_hknpWorld_hknpConstraintCinfoconst_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____Slot{ 190810 };
+		inline constexpr REL::ID hkSimpleLocalFrame{ 1552921 };
+		inline constexpr REL::ID hkSingleton_hkBuiltinTypeRegistry_{ 1133774 };
+		inline constexpr REL::ID hkSingleton_hkDebugDisplay_{ 634681 };
+		inline constexpr REL::ID hkSingleton_hkDefaultClassNameRegistry_{ 1432492 };
+		inline constexpr REL::ID hkSingleton_hkDummySingleton_{ 221690 };
+		inline constexpr REL::ID hkSingleton_hkError_{ 276427 };
+		inline constexpr REL::ID hkSingleton_hkFileSystem_{ 622008 };
+		inline constexpr REL::ID hkSingleton_hkHardwareInfo_{ 1458427 };
+		inline constexpr REL::ID hkSingleton_hkProcessFactory_{ 454188 };
+		inline constexpr REL::ID hkSingleton_hkReferencedObjectLock_{ 410513 };
+		inline constexpr REL::ID hkSingleton_hkSerializeDeprecated_{ 727177 };
+		inline constexpr REL::ID hkSingleton_hkTypeInfoRegistry_{ 1175148 };
+		inline constexpr REL::ID hkSingleton_hkUuidPseudoRandomGenerator_{ 483476 };
+		inline constexpr REL::ID hkSingleton_hkVersionPatchManager_{ 35516 };
+		inline constexpr REL::ID hkSingleton_hkVtableClassRegistry_{ 1493425 };
+		inline constexpr REL::ID hkSingleton_hknpGlobals_{ 885809 };
+		inline constexpr REL::ID hkSkinBinding{ 1582896 };
+		inline constexpr REL::ID hkSkinnedMeshShape{ 1045305 };
+		inline constexpr REL::ID hkSkinnedRefMeshShape{ 1050704 };
+		inline constexpr REL::ID hkSlot{ 1349878 };
+		inline constexpr REL::ID hkSocket{ 579109 };
+		inline constexpr REL::ID hkSocket__ReaderAdapter{ 1456581 };
+		inline constexpr REL::ID hkSocket__WriterAdapter{ 1190505 };
+		inline constexpr REL::ID hkSolverAllocator{ 1046065 };
+		inline constexpr REL::ID hkStackTracer{ 728083 };
+		inline constexpr REL::ID hkStaticClassNameRegistry{ 587145 };
+		inline constexpr REL::ID hkStatisticsProcess{ 849110 };
+		inline constexpr REL::ID hkStdioStreamReader{ 175215 };
+		inline constexpr REL::ID hkStorageSkinnedMeshShape{ 779584 };
+		inline constexpr REL::ID hkStreamReader{ 9862 };
+		inline constexpr REL::ID hkStreamWriter{ 369604 };
+		inline constexpr REL::ID hkStringObject{ 1296851 };
+		inline constexpr REL::ID hkSubStreamWriter{ 441438 };
+		inline constexpr REL::ID hkTagfileReader{ 1347688 };
+		inline constexpr REL::ID hkTagfileWriter{ 171762 };
+		inline constexpr REL::ID hkTagfileWriter__AddDataObjectListener{ 1268456 };
+		inline constexpr REL::ID hkTask{ 583639 };
+		inline constexpr REL::ID hkTaskQueue{ 1572399 };
+		inline constexpr REL::ID hkTaskQueue__EmptyTask{ 1086733 };
+		inline constexpr REL::ID hkThreadMemory{ 865486 };
+		inline constexpr REL::ID hkThreadPool{ 79836 };
+		inline constexpr REL::ID hkTrackerArrayLayoutHandler{ 919450 };
+		inline constexpr REL::ID hkTrackerEnumLayoutHandler{ 1410065 };
+		inline constexpr REL::ID hkTrackerFlagsLayoutHandler{ 1457005 };
+		inline constexpr REL::ID hkTrackerJobQueueDynamicDataLayoutHandler{ 1550273 };
+		inline constexpr REL::ID hkTrackerJobQueueLayoutHandler{ 1377170 };
+		inline constexpr REL::ID hkTrackerLayoutCalculator{ 201238 };
+		inline constexpr REL::ID hkTrackerLayoutHandler{ 872816 };
+		inline constexpr REL::ID hkTrackerPadSpuLayoutHandler{ 1423848 };
+		inline constexpr REL::ID hkTrackerPointerMapLayoutHandler{ 607073 };
+		inline constexpr REL::ID hkTrackerQueueLayoutHandler{ 1470894 };
+		inline constexpr REL::ID hkTrackerRefPtrLayoutHandler{ 1517521 };
+		inline constexpr REL::ID hkTrackerScanSnapshot{ 793673 };
+		inline constexpr REL::ID hkTrackerSetLayoutHandler{ 140648 };
+		inline constexpr REL::ID hkTrackerStringMapLayoutHandler{ 513672 };
+		inline constexpr REL::ID hkTrackerStringPtrLayoutHandler{ 560461 };
+		inline constexpr REL::ID hkTrackerTypeLayout{ 466813 };
+		inline constexpr REL::ID hkTrackerTypeTreeCache{ 1185629 };
+		inline constexpr REL::ID hkTypeInfoRegistry{ 1441033 };
+		inline constexpr REL::ID hkTypeManager{ 940999 };
+		inline constexpr REL::ID hkUuidPseudoRandomGenerator{ 530272 };
+		inline constexpr REL::ID hkVdbCommandWriter{ 963783 };
+		inline constexpr REL::ID hkVersionPatchManager{ 301661 };
+		inline constexpr REL::ID hkVersionPatchManager__ClassWrapper{ 208747 };
+		inline constexpr REL::ID hkVisualDebugger{ 1521739 };
+		inline constexpr REL::ID hkVtableClassRegistry{ 177082 };
+		inline constexpr REL::ID hkWin32FileSystem{ 501096 };
+		inline constexpr REL::ID hkWin32StreamWriter{ 1491577 };
+		inline constexpr REL::ID hkXmlLexAnalyzer{ 926023 };
+		inline constexpr REL::ID hkXmlParser{ 519341 };
+		inline constexpr REL::ID hkXmlParser__Characters{ 598981 };
+		inline constexpr REL::ID hkXmlParser__EndElement{ 864634 };
+		inline constexpr REL::ID hkXmlParser__Node{ 1349946 };
+		inline constexpr REL::ID hkXmlParser__StartElement{ 33622 };
+		inline constexpr REL::ID hkXmlStreamParser{ 1004481 };
+		inline constexpr REL::ID hkXmlTagfileReader{ 596723 };
+		inline constexpr REL::ID hkXmlTagfileWriter{ 330488 };
+		inline constexpr REL::ID hkaAngularReferenceFrame{ 455026 };
+		inline constexpr REL::ID hkaAnimatedReferenceFrame{ 876192 };
+		inline constexpr REL::ID hkaAnimation{ 831244 };
+		inline constexpr REL::ID hkaAnimationBinding{ 852131 };
+		inline constexpr REL::ID hkaAnimationContainer{ 652135 };
+		inline constexpr REL::ID hkaAnimationControl{ 777638 };
+		inline constexpr REL::ID hkaAnimationPreviewColorContainer{ 922846 };
+		inline constexpr REL::ID hkaBoneAttachment{ 868785 };
+		inline constexpr REL::ID hkaDefaultAnimatedReferenceFrame{ 610467 };
+		inline constexpr REL::ID hkaDefaultAnimationControl{ 824032 };
+		inline constexpr REL::ID hkaDefaultAnimationControlMapperData{ 511381 };
+		inline constexpr REL::ID hkaDirectionalReferenceFrame{ 189591 };
+		inline constexpr REL::ID hkaFootPlacementIkSolver{ 1295283 };
+		inline constexpr REL::ID hkaFootstepAnalysisInfo{ 142639 };
+		inline constexpr REL::ID hkaFootstepAnalysisInfoContainer{ 563851 };
+		inline constexpr REL::ID hkaInterleavedUncompressedAnimation{ 517078 };
+		inline constexpr REL::ID hkaLosslessCompressedAnimation{ 909269 };
+		inline constexpr REL::ID hkaMeshBinding{ 891178 };
+		inline constexpr REL::ID hkaMirroredSkeleton{ 722285 };
+		inline constexpr REL::ID hkaNpRagdollPenetrationDetector{ 1213736 };
+		inline constexpr REL::ID hkaNpRagdollRaycastInterface{ 1362846 };
+		inline constexpr REL::ID hkaParameterizedAnimationReferenceFrame{ 1081907 };
+		inline constexpr REL::ID hkaParameterizedReferenceFrame{ 501878 };
+		inline constexpr REL::ID hkaPredictiveCompressedAnimation{ 1459012 };
+		inline constexpr REL::ID hkaQuantizedAnimation{ 1380602 };
+		inline constexpr REL::ID hkaRaycastInterface{ 35906 };
+		inline constexpr REL::ID hkaReferencePoseAnimation{ 345716 };
+		inline constexpr REL::ID hkaSkeleton{ 1300474 };
+		inline constexpr REL::ID hkaSkeletonMapper{ 882703 };
+		inline constexpr REL::ID hkaSplineCompressedAnimation{ 1029875 };
+		inline constexpr REL::ID hkbAiControlCancelPathCommand{ 64083 };
+		inline constexpr REL::ID hkbAiControlPathToCommand{ 330137 };
+		inline constexpr REL::ID hkbAlignBoneModifier{ 1399035 };
+		inline constexpr REL::ID hkbAnimatedSkeletonGenerator{ 1133172 };
+		inline constexpr REL::ID hkbAnimationBindingSet{ 1379799 };
+		inline constexpr REL::ID hkbAnimationBindingWithTriggers{ 397302 };
+		inline constexpr REL::ID hkbAssetBundle{ 1289067 };
+		inline constexpr REL::ID hkbAssetLoader{ 73172 };
+		inline constexpr REL::ID hkbAttachmentFixupSceneModifier{ 1011504 };
+		inline constexpr REL::ID hkbAttachmentModifier{ 154981 };
+		inline constexpr REL::ID hkbAttachmentSceneModifier{ 1058160 };
+		inline constexpr REL::ID hkbAttachmentSetup{ 1334021 };
+		inline constexpr REL::ID hkbAttributeModifier{ 1471277 };
+		inline constexpr REL::ID hkbAuxiliaryNodeInfo{ 349085 };
+		inline constexpr REL::ID hkbBehaviorClient{ 1039878 };
+		inline constexpr REL::ID hkbBehaviorEventsInfo{ 1413035 };
+		inline constexpr REL::ID hkbBehaviorGraph{ 1001735 };
+		inline constexpr REL::ID hkbBehaviorGraphData{ 299080 };
+		inline constexpr REL::ID hkbBehaviorGraphInternalState{ 1021490 };
+		inline constexpr REL::ID hkbBehaviorGraphInternalStateInfo{ 83315 };
+		inline constexpr REL::ID hkbBehaviorGraphStringData{ 7024 };
+		inline constexpr REL::ID hkbBehaviorGraph__GlobalTransitionData{ 386884 };
+		inline constexpr REL::ID hkbBehaviorInfo{ 316363 };
+		inline constexpr REL::ID hkbBehaviorReferenceGenerator{ 679938 };
+		inline constexpr REL::ID hkbBindable{ 1528707 };
+		inline constexpr REL::ID hkbBindableCollector{ 802763 };
+		inline constexpr REL::ID hkbBindable__CacheBindablesCollector{ 536763 };
+		inline constexpr REL::ID hkbBlenderGenerator{ 289474 };
+		inline constexpr REL::ID hkbBlenderGeneratorChild{ 555866 };
+		inline constexpr REL::ID hkbBlenderGeneratorInternalState{ 871632 };
+		inline constexpr REL::ID hkbBlendingTransitionEffect{ 965820 };
+		inline constexpr REL::ID hkbBlendingTransitionEffectInternalState{ 952885 };
+		inline constexpr REL::ID hkbBoneIndexArray{ 1344781 };
+		inline constexpr REL::ID hkbBoneWeightArray{ 821716 };
+		inline constexpr REL::ID hkbBoolVariableSequencedData{ 827525 };
+		inline constexpr REL::ID hkbCameraShakeEventPayload{ 8553 };
+		inline constexpr REL::ID hkbCameraVariablesChangedCommand{ 376752 };
+		inline constexpr REL::ID hkbCharacter{ 257549 };
+		inline constexpr REL::ID hkbCharacterAddedInfo{ 17063 };
+		inline constexpr REL::ID hkbCharacterControlCommand{ 44854 };
+		inline constexpr REL::ID hkbCharacterController{ 1455874 };
+		inline constexpr REL::ID hkbCharacterControllerDriver{ 1286763 };
+		inline constexpr REL::ID hkbCharacterControllerModifier{ 1205243 };
+		inline constexpr REL::ID hkbCharacterControllerModifierInternalState{ 174180 };
+		inline constexpr REL::ID hkbCharacterControllerSceneModifier{ 699525 };
+		inline constexpr REL::ID hkbCharacterData{ 1240332 };
+		inline constexpr REL::ID hkbCharacterInfo{ 1333550 };
+		inline constexpr REL::ID hkbCharacterSelectedInfo{ 36374 };
+		inline constexpr REL::ID hkbCharacterSetup{ 350604 };
+		inline constexpr REL::ID hkbCharacterSkinInfo{ 582562 };
+		inline constexpr REL::ID hkbCharacterSteppedInfo{ 848324 };
+		inline constexpr REL::ID hkbCharacterStringData{ 986948 };
+		inline constexpr REL::ID hkbClientCharacterState{ 554809 };
+		inline constexpr REL::ID hkbClipGenerator{ 586430 };
+		inline constexpr REL::ID hkbClipGeneratorInternalState{ 877748 };
+		inline constexpr REL::ID hkbClipTriggerArray{ 100850 };
+		inline constexpr REL::ID hkbClosestLocalFrameCollector{ 638110 };
+		inline constexpr REL::ID hkbCombineTransformsModifier{ 1158457 };
+		inline constexpr REL::ID hkbCombineTransformsModifierInternalState{ 785694 };
+		inline constexpr REL::ID hkbCompiledExpressionSet{ 419334 };
+		inline constexpr REL::ID hkbComputeDirectionModifier{ 1111792 };
+		inline constexpr REL::ID hkbComputeDirectionModifierInternalState{ 1462831 };
+		inline constexpr REL::ID hkbComputeRotationFromAxisAngleModifier{ 1065084 };
+		inline constexpr REL::ID hkbComputeRotationFromAxisAngleModifierInternalState{ 930665 };
+		inline constexpr REL::ID hkbComputeRotationToTargetModifier{ 1238067 };
+		inline constexpr REL::ID hkbComputeRotationToTargetModifierInternalState{ 398576 };
+		inline constexpr REL::ID hkbComputeWorldFromModelModifier{ 288444 };
+		inline constexpr REL::ID hkbCondition{ 32864 };
+		inline constexpr REL::ID hkbCustomIdSelector{ 876230 };
+		inline constexpr REL::ID hkbCustomTestGenerator{ 573867 };
+		inline constexpr REL::ID hkbCustomTestGeneratorAnnotatedTypes{ 400826 };
+		inline constexpr REL::ID hkbCustomTestGeneratorBoneTypes{ 447348 };
+		inline constexpr REL::ID hkbCustomTestGeneratorComplexTypes{ 148774 };
+		inline constexpr REL::ID hkbCustomTestGeneratorHiddenTypes{ 242027 };
+		inline constexpr REL::ID hkbCustomTestGeneratorNestedTypes{ 494077 };
+		inline constexpr REL::ID hkbCustomTestGeneratorNestedTypesBase{ 321426 };
+		inline constexpr REL::ID hkbCustomTestGeneratorSimpleTypes{ 195655 };
+		inline constexpr REL::ID hkbDampingModifier{ 1410444 };
+		inline constexpr REL::ID hkbDampingModifierInternalState{ 1355433 };
+		inline constexpr REL::ID hkbDelayedModifier{ 1144581 };
+		inline constexpr REL::ID hkbDelayedModifierInternalState{ 823749 };
+		inline constexpr REL::ID hkbDetectCloseToGroundModifier{ 878580 };
+		inline constexpr REL::ID hkbDetectCloseToGroundModifierInternalState{ 903206 };
+		inline constexpr REL::ID hkbDockingDriver{ 1354185 };
+		inline constexpr REL::ID hkbDockingGenerator{ 1051384 };
+		inline constexpr REL::ID hkbDockingGeneratorInternalState{ 829046 };
+		inline constexpr REL::ID hkbDockingSceneModifier{ 649103 };
+		inline constexpr REL::ID hkbDockingTarget{ 1038578 };
+		inline constexpr REL::ID hkbEvaluateExpressionModifier{ 785669 };
+		inline constexpr REL::ID hkbEvaluateExpressionModifierInternalState{ 1114111 };
+		inline constexpr REL::ID hkbEvaluateHandleModifier{ 739113 };
+		inline constexpr REL::ID hkbEventDrivenModifier{ 472609 };
+		inline constexpr REL::ID hkbEventDrivenModifierInternalState{ 1525615 };
+		inline constexpr REL::ID hkbEventPayload{ 815285 };
+		inline constexpr REL::ID hkbEventPayloadList{ 1148664 };
+		inline constexpr REL::ID hkbEventRaisedInfo{ 1147175 };
+		inline constexpr REL::ID hkbEventRangeDataArray{ 807084 };
+		inline constexpr REL::ID hkbEventSequencedData{ 1140045 };
+		inline constexpr REL::ID hkbEventsFromRangeModifier{ 206931 };
+		inline constexpr REL::ID hkbEventsFromRangeModifierInternalState{ 541098 };
+		inline constexpr REL::ID hkbExpressionCondition{ 1129959 };
+		inline constexpr REL::ID hkbExpressionDataArray{ 1379909 };
+		inline constexpr REL::ID hkbExtractRagdollPoseModifier{ 160316 };
+		inline constexpr REL::ID hkbExtrapolatingTransitionEffect{ 1012351 };
+		inline constexpr REL::ID hkbExtrapolatingTransitionEffectInternalState{ 1138598 };
+		inline constexpr REL::ID hkbFootIkControlsModifier{ 113472 };
+		inline constexpr REL::ID hkbFootIkDriver{ 278044 };
+		inline constexpr REL::ID hkbFootIkDriverInfo{ 1519425 };
+		inline constexpr REL::ID hkbFootIkModifier{ 66972 };
+		inline constexpr REL::ID hkbFootIkSceneModifier{ 1227707 };
+		inline constexpr REL::ID hkbGenerator{ 1043092 };
+		inline constexpr REL::ID hkbGeneratorOutputListener{ 1453946 };
+		inline constexpr REL::ID hkbGeneratorTransitionEffect{ 1377934 };
+		inline constexpr REL::ID hkbGeneratorTransitionEffectInternalState{ 811566 };
+		inline constexpr REL::ID hkbGetHandleOnBoneModifier{ 1163862 };
+		inline constexpr REL::ID hkbGetUpModifier{ 1117080 };
+		inline constexpr REL::ID hkbGetUpModifierInternalState{ 949065 };
+		inline constexpr REL::ID hkbGetWorldFromModelModifier{ 631987 };
+		inline constexpr REL::ID hkbGetWorldFromModelModifierInternalState{ 1121752 };
+		inline constexpr REL::ID hkbGravityModifier{ 307700 };
+		inline constexpr REL::ID hkbHandIkControlsModifier{ 585379 };
+		inline constexpr REL::ID hkbHandIkDriver{ 1447658 };
+		inline constexpr REL::ID hkbHandIkDriverInfo{ 54575 };
+		inline constexpr REL::ID hkbHandIkFixupSceneModifier{ 695934 };
+		inline constexpr REL::ID hkbHandIkModifier{ 319144 };
+		inline constexpr REL::ID hkbHandIkSceneModifier{ 961482 };
+		inline constexpr REL::ID hkbHandle{ 962165 };
+		inline constexpr REL::ID hkbHoldFromBlendingTransitionEffect{ 244616 };
+		inline constexpr REL::ID hkbIntEventPayload{ 250318 };
+		inline constexpr REL::ID hkbIntVariableSequencedData{ 781074 };
+		inline constexpr REL::ID hkbInternal__LuaPlus__LuaStateOutFile{ 47030 };
+		inline constexpr REL::ID hkbInternal__hks__BinOperatorEnum{ 518857 };
+		inline constexpr REL::ID hkbInternal__hks__ChunkVisitor{ 804118 };
+		inline constexpr REL::ID hkbInternal__hks__CodeGenerator{ 565611 };
+		inline constexpr REL::ID hkbInternal__hks__CompilerParseAcceptor{ 392614 };
+		inline constexpr REL::ID hkbInternal__hks__CompilerStateInterface{ 220007 };
+		inline constexpr REL::ID hkbInternal__hks__FrequencyProfiler{ 897248 };
+		inline constexpr REL::ID hkbInternal__hks__GettableProfiler{ 850527 };
+		inline constexpr REL::ID hkbInternal__hks__HeapVisualizer{ 930004 };
+		inline constexpr REL::ID hkbInternal__hks__IProfiler{ 1163257 };
+		inline constexpr REL::ID hkbInternal__hks__MemoryAllocationsByType{ 1550049 };
+		inline constexpr REL::ID hkbInternal__hks__Preprocessor{ 598502 };
+		inline constexpr REL::ID hkbInternal__hks__Preprocessor__PreprocessorStateProxy{ 551945 };
+		inline constexpr REL::ID hkbInternal__hks__ReachableChunksAreValid{ 757559 };
+		inline constexpr REL::ID hkbInternal__hks__SimpleCompilerState{ 425379 };
+		inline constexpr REL::ID hkbInternal__hks__UnOperatorEnum{ 471969 };
+		inline constexpr REL::ID hkbInternal__hks__Visitor{ 233829 };
+		inline constexpr REL::ID hkbInternal__hks__netTransport{ 140416 };
+		inline constexpr REL::ID hkbInternal__hks__netTransportTCPIP{ 93803 };
+		inline constexpr REL::ID hkbJigglerGroup{ 1486782 };
+		inline constexpr REL::ID hkbJigglerModifier{ 1415812 };
+		inline constexpr REL::ID hkbJigglerModifierInternalState{ 109860 };
+		inline constexpr REL::ID hkbKeyframeBonesModifier{ 1149889 };
+		inline constexpr REL::ID hkbLayer{ 883958 };
+		inline constexpr REL::ID hkbLayerGenerator{ 179484 };
+		inline constexpr REL::ID hkbLayerGeneratorInternalState{ 287773 };
+		inline constexpr REL::ID hkbLineDockingTarget{ 553549 };
+		inline constexpr REL::ID hkbLinkedSymbolInfo{ 615388 };
+		inline constexpr REL::ID hkbLookAtModifier{ 1276176 };
+		inline constexpr REL::ID hkbLookAtModifierInternalState{ 101462 };
+		inline constexpr REL::ID hkbManualSelectorGenerator{ 790999 };
+		inline constexpr REL::ID hkbManualSelectorGeneratorInternalState{ 54729 };
+		inline constexpr REL::ID hkbManualSelectorTransitionEffect{ 744381 };
+		inline constexpr REL::ID hkbManualSelectorTransitionEffectInternalState{ 1543924 };
+		inline constexpr REL::ID hkbMirrorModifier{ 697973 };
+		inline constexpr REL::ID hkbMirroredSkeletonInfo{ 1370664 };
+		inline constexpr REL::ID hkbModifier{ 468032 };
+		inline constexpr REL::ID hkbModifierGenerator{ 431236 };
+		inline constexpr REL::ID hkbModifierList{ 165671 };
+		inline constexpr REL::ID hkbModifierWrapper{ 353598 };
+		inline constexpr REL::ID hkbMoveBoneAttachmentModifier{ 1482129 };
+		inline constexpr REL::ID hkbMoveCharacterModifier{ 1434967 };
+		inline constexpr REL::ID hkbMoveCharacterModifierInternalState{ 306983 };
+		inline constexpr REL::ID hkbNamedEventPayload{ 1566821 };
+		inline constexpr REL::ID hkbNamedIntEventPayload{ 1034414 };
+		inline constexpr REL::ID hkbNamedRealEventPayload{ 1300438 };
+		inline constexpr REL::ID hkbNamedStringEventPayload{ 768691 };
+		inline constexpr REL::ID hkbNode{ 651260 };
+		inline constexpr REL::ID hkbNodeInternalStateInfo{ 516502 };
+		inline constexpr REL::ID hkbNode__BoundVariablesCollector{ 709838 };
+		inline constexpr REL::ID hkbNullPhysicsInterface{ 417115 };
+		inline constexpr REL::ID hkbParametricMotionGenerator{ 863941 };
+		inline constexpr REL::ID hkbParticleSystemEventPayload{ 842381 };
+		inline constexpr REL::ID hkbPhysicsInterface{ 1331383 };
+		inline constexpr REL::ID hkbPinBonesGenerator{ 41549 };
+		inline constexpr REL::ID hkbPlaneDockingTarget{ 287136 };
+		inline constexpr REL::ID hkbPoseMatchingGenerator{ 108605 };
+		inline constexpr REL::ID hkbPoseMatchingGeneratorInternalState{ 1374678 };
+		inline constexpr REL::ID hkbPoseStoringGeneratorOutputListener{ 1407002 };
+		inline constexpr REL::ID hkbPoseStoringGeneratorOutputListener__StoredPose{ 217155 };
+		inline constexpr REL::ID hkbPoweredRagdollControlsModifier{ 1169177 };
+		inline constexpr REL::ID hkbProceduralBlenderGenerator{ 817540 };
+		inline constexpr REL::ID hkbProjectAssetManager{ 973947 };
+		inline constexpr REL::ID hkbProjectData{ 927925 };
+		inline constexpr REL::ID hkbProjectStringData{ 1194076 };
+		inline constexpr REL::ID hkbRadialSelectorGenerator{ 1357736 };
+		inline constexpr REL::ID hkbRagdollController{ 1143075 };
+		inline constexpr REL::ID hkbRagdollDriver{ 1529398 };
+		inline constexpr REL::ID hkbRagdollInterface{ 138099 };
+		inline constexpr REL::ID hkbRagdollSceneModifier{ 965010 };
+		inline constexpr REL::ID hkbRaiseEventCommand{ 1580757 };
+		inline constexpr REL::ID hkbRealEventPayload{ 516243 };
+		inline constexpr REL::ID hkbRealVariableSequencedData{ 873987 };
+		inline constexpr REL::ID hkbRebuildScriptsCommand{ 642994 };
+		inline constexpr REL::ID hkbReferencePoseGenerator{ 726469 };
+		inline constexpr REL::ID hkbReferencedGeneratorSyncInfo{ 662915 };
+		inline constexpr REL::ID hkbRigidBodyRagdollControlsModifier{ 1122373 };
+		inline constexpr REL::ID hkbRotateCharacterModifier{ 1295154 };
+		inline constexpr REL::ID hkbRotateCharacterModifierInternalState{ 186569 };
+		inline constexpr REL::ID hkbSceneModifier{ 130659 };
+		inline constexpr REL::ID hkbScriptAssetLoader{ 883361 };
+		inline constexpr REL::ID hkbScriptCondition{ 578542 };
+		inline constexpr REL::ID hkbScriptGenerator{ 1248883 };
+		inline constexpr REL::ID hkbSenseHandleModifier{ 982431 };
+		inline constexpr REL::ID hkbSequence{ 1565382 };
+		inline constexpr REL::ID hkbSequenceInternalState{ 207970 };
+		inline constexpr REL::ID hkbSequenceStringData{ 734587 };
+		inline constexpr REL::ID hkbSequencedData{ 43080 };
+		inline constexpr REL::ID hkbSetBehaviorCommand{ 1174777 };
+		inline constexpr REL::ID hkbSetLocalTimeOfClipGeneratorCommand{ 1001864 };
+		inline constexpr REL::ID hkbSetNodePropertyCommand{ 908811 };
+		inline constexpr REL::ID hkbSetSelectedCharacterCommand{ 1314564 };
+		inline constexpr REL::ID hkbSetWordVariableCommand{ 1268080 };
+		inline constexpr REL::ID hkbSetWorldFromModelModifier{ 717077 };
+		inline constexpr REL::ID hkbSimulationControlCommand{ 91669 };
+		inline constexpr REL::ID hkbSimulationStateInfo{ 881145 };
+		inline constexpr REL::ID hkbSpatialQueryInterface{ 1352194 };
+		inline constexpr REL::ID hkbStateChooserWrapper{ 610504 };
+		inline constexpr REL::ID hkbStateDependentModifier{ 1311255 };
+		inline constexpr REL::ID hkbStateListener{ 557961 };
+		inline constexpr REL::ID hkbStateMachine{ 1178621 };
+		inline constexpr REL::ID hkbStateMachineInternalState{ 924356 };
+		inline constexpr REL::ID hkbStateMachine__EventPropertyArray{ 865805 };
+		inline constexpr REL::ID hkbStateMachine__StateInfo{ 1038610 };
+		inline constexpr REL::ID hkbStateMachine__TransitionInfoArray{ 693582 };
+		inline constexpr REL::ID hkbStringCondition{ 1024710 };
+		inline constexpr REL::ID hkbStringEventPayload{ 329819 };
+		inline constexpr REL::ID hkbSymbolIdMap{ 583852 };
+		inline constexpr REL::ID hkbTestIdSelector{ 595658 };
+		inline constexpr REL::ID hkbTimerModifier{ 670280 };
+		inline constexpr REL::ID hkbTimerModifierInternalState{ 884993 };
+		inline constexpr REL::ID hkbTransformVectorModifier{ 184886 };
+		inline constexpr REL::ID hkbTransformVectorModifierInternalState{ 731725 };
+		inline constexpr REL::ID hkbTransitionEffect{ 61874 };
+		inline constexpr REL::ID hkbTwistModifier{ 137949 };
+		inline constexpr REL::ID hkbVariableBindingSet{ 1324090 };
+		inline constexpr REL::ID hkbVariableValueSet{ 250577 };
+		inline constexpr REL::ID hkbWorld{ 835455 };
+		inline constexpr REL::ID hkbnpCharacterController{ 139457 };
+		inline constexpr REL::ID hkbnpCharacterProxyController{ 186417 };
+		inline constexpr REL::ID hkbnpCharacterRigidBodyController{ 1189793 };
+		inline constexpr REL::ID hkbnpPhysicsInterface{ 253855 };
+		inline constexpr REL::ID hkbnpRagdollInterface{ 1314449 };
+		inline constexpr REL::ID hkbnpRagdollPoweredConstraintController{ 877009 };
+		inline constexpr REL::ID hkbnpRagdollRigidBodyController{ 1049875 };
+		inline constexpr REL::ID hkbnpRagdollScaledSkeleton{ 1360873 };
+		inline constexpr REL::ID hkbnpRagdollSkeletonRemapData{ 1407555 };
+		inline constexpr REL::ID hkbnpRefCountedId_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant__{ 566550 };
+		inline constexpr REL::ID hkbnpRefCountedId_hknpBodyId_{ 393524 };
+		inline constexpr REL::ID hkbnpSerializedRagdollInterface{ 1454511 };
+		inline constexpr REL::ID hkcdConvexCellsCollection{ 1254064 };
+		inline constexpr REL::ID hkcdConvexCellsTree2D{ 21452 };
+		inline constexpr REL::ID hkcdConvexCellsTree3D{ 1272479 };
+		inline constexpr REL::ID hkcdConvexCellsTree_hkcdConvexCellsCollection__Cell_hkHandle_unsignedint_0_hkcdConvexCellsCollection__CellIdDiscriminant__hkcdConvexCellsCollection_{ 1006251 };
+		inline constexpr REL::ID hkcdConvexCellsTree_hkcdPlanarGeometryPolygonCollection__Polygon_hkHandle_unsignedint_0_hkcdPlanarGeometryPolygonCollection__PolygonIdDiscriminant__hkcdPlanarGeometry_{ 1337944 };
+		inline constexpr REL::ID hkcdDynamicAabbTree{ 348838 };
+		inline constexpr REL::ID hkcdGskBase__RayCastShapeInterface_hkcdGsk_Vector4Shape_{ 1418770 };
+		inline constexpr REL::ID hkcdGskBase__ShapeInterface{ 1292841 };
+		inline constexpr REL::ID hkcdGsk_Vector4ShapeInterface{ 1246412 };
+		inline constexpr REL::ID hkcdGsk__Cache{ 667821 };
+		inline constexpr REL::ID hkcdPlanarCsgOperand{ 987781 };
+		inline constexpr REL::ID hkcdPlanarEntity{ 42528 };
+		inline constexpr REL::ID hkcdPlanarGeometry{ 722388 };
+		inline constexpr REL::ID hkcdPlanarGeometryPlanesCollection{ 1193724 };
+		inline constexpr REL::ID hkcdPlanarGeometryPolygonCollection{ 1366066 };
+		inline constexpr REL::ID hkcdPlanarGeometryPrimitives__Collection_28_{ 374418 };
+		inline constexpr REL::ID hkcdPlanarGeometry__VertexStorage{ 455737 };
+		inline constexpr REL::ID hkcdPlanarSolid{ 1539238 };
+		inline constexpr REL::ID hkcdPlanarSolid__ArrayMgr{ 1520240 };
+		inline constexpr REL::ID hkcdPlanarSolid__NodeStorage{ 1065353 };
+		inline constexpr REL::ID hkcdShape{ 1053729 };
+		inline constexpr REL::ID hkcdSimdTree{ 720040 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__EmptyRunnable{ 811821 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__IRefit{ 984180 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromAabbs16_{ 844541 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromAabbs_{ 937703 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromICustomRefit_{ 658309 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromSpheres_{ 751526 };
+		inline constexpr REL::ID hkcdSimdTreeUtils__Build__Task{ 564919 };
+		inline constexpr REL::ID hkcdSimdTree__BuildContext{ 812292 };
+		inline constexpr REL::ID hkcdSimdTree__IParallelBuild__IRunnable{ 639103 };
+		inline constexpr REL::ID hkcdSimdTree__LeafCollector{ 234341 };
+		inline constexpr REL::ID hkcdStaticAabbTree{ 83086 };
+		inline constexpr REL::ID hkcdStaticMeshTree_hkcdStaticMeshTreeCommonConfig_unsignedint_unsigned__int64_11_21__hknpCompressedMeshShapeTreeDataRun___BaseUnaryQuery{ 472527 };
+		inline constexpr REL::ID hkcdStaticMeshTree_hkcdStaticMeshTreeCommonConfig_unsignedint_unsigned__int64_11_21__hknpCompressedMeshShapeTreeDataRun___BuildGeometryProvider_hknpCompressedMeshShapeInternals__GeometryProvider_{ 1336208 };
+		inline constexpr REL::ID hkcdStaticMeshTree_hkcdStaticMeshTreeCommonConfig_unsignedint_unsigned__int64_11_21__hknpCompressedMeshShapeTreeDataRun___CustomGeometryConverter{ 140935 };
+		inline constexpr REL::ID hkcdVertexGeometry{ 427623 };
+		inline constexpr REL::ID hkcdVertexGeometry__VPolygonCollection{ 554129 };
+		inline constexpr REL::ID hkcdVertexGeometry__VPolygonCollectionBase{ 381089 };
+		inline constexpr REL::ID hkgpAbstractMesh_hkgpConvexHullImpl__Edge_hkgpConvexHullImpl__Vertex_hkgpConvexHullImpl__Triangle_hkContainerHeapAllocator_{ 512773 };
+		inline constexpr REL::ID hkgpAbstractMesh_hkgpIndexedMeshDefinitions__Edge_hkgpIndexedMeshDefinitions__Vertex_hkgpIndexedMeshDefinitions__Triangle_hkContainerHeapAllocator_{ 526637 };
+		inline constexpr REL::ID hkgpAbstractMesh_hkgpMeshBase__Edge_hkgpMeshBase__Vertex_hkgpMeshBase__Triangle_hkContainerHeapAllocator_{ 66851 };
+		inline constexpr REL::ID hkgpAbstractMesh_hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0___Edge_hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0___Vertex_hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0___Triangle_hkContainerHeapAllocator_{ 823608 };
+		inline constexpr REL::ID hkgpCgoInternal__ICollapse{ 558603 };
+		inline constexpr REL::ID hkgpConvexHull{ 779008 };
+		inline constexpr REL::ID hkgpIndexedMesh{ 1015325 };
+		inline constexpr REL::ID hkgpIndexedMeshInternals__DefaultEdgeCollapseInterface{ 609650 };
+		inline constexpr REL::ID hkgpIndexedMesh__EdgeBarrier{ 605156 };
+		inline constexpr REL::ID hkgpIndexedMesh__IEdgeCollapse{ 436516 };
+		inline constexpr REL::ID hkgpIndexedMesh__ITriangleRemoval{ 483366 };
+		inline constexpr REL::ID hkgpIndexedMesh__IVertexRemoval{ 530136 };
+		inline constexpr REL::ID hkgpJobQueue__Box_hkgpCgoInternal__UpdateJob_{ 511794 };
+		inline constexpr REL::ID hkgpJobQueue__Box_hkgpMeshInternals__ConcaveEdgeJob__Handle_{ 184765 };
+		inline constexpr REL::ID hkgpJobQueue__IJob{ 1308794 };
+		inline constexpr REL::ID hkgpMesh{ 552425 };
+		inline constexpr REL::ID hkgpMesh__ExternShape{ 1196654 };
+		inline constexpr REL::ID hkgpMesh__IConvexOverlap{ 1555951 };
+		inline constexpr REL::ID hkgpMesh__IConvexOverlap__IConvexShape{ 1289772 };
+		inline constexpr REL::ID hkgpMesh__TriangleShape{ 1462676 };
+		inline constexpr REL::ID hkgpTriangulatorBase{ 930501 };
+		inline constexpr REL::ID hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0_{ 664764 };
+		inline constexpr REL::ID hknpAction{ 1122976 };
+		inline constexpr REL::ID hknpActionManager{ 53686 };
+		inline constexpr REL::ID hknpAllHitsCollector{ 1254641 };
+		inline constexpr REL::ID hknpAnyHitCollector{ 566056 };
+		inline constexpr REL::ID hknpApiCommandProcessor{ 1499568 };
+		inline constexpr REL::ID hknpArrayAction{ 1433662 };
+		inline constexpr REL::ID hknpBSBroadPhaseConfig{ 1060466 };
+		inline constexpr REL::ID hknpBSCharacterProxy{ 1559140 };
+		inline constexpr REL::ID hknpBSCharacterRigidBody{ 1512572 };
+		inline constexpr REL::ID hknpBSCustomCollisionFilter{ 17395 };
+		inline constexpr REL::ID hknpBSMaterial{ 768614 };
+		inline constexpr REL::ID hknpBSMaterialProperties{ 560658 };
+		inline constexpr REL::ID hknpBSMouseSpringAction{ 191780 };
+		inline constexpr REL::ID hknpBSMoveLimitModifier{ 1305693 };
+		inline constexpr REL::ID hknpBSShapeCodec{ 1418652 };
+		inline constexpr REL::ID hknpBSWorld{ 974604 };
+		inline constexpr REL::ID hknpBackfaceCollisionModifier{ 1227201 };
+		inline constexpr REL::ID hknpBallGun{ 1546922 };
+		inline constexpr REL::ID hknpBodyQualityLibrary{ 1531055 };
+		inline constexpr REL::ID hknpBodyReference{ 1373629 };
+		inline constexpr REL::ID hknpBreakableConstraintData{ 870446 };
+		inline constexpr REL::ID hknpBroadPhase{ 1111242 };
+		inline constexpr REL::ID hknpBroadPhaseConfig{ 946844 };
+		inline constexpr REL::ID hknpBuildConstraintJacobiansTask{ 480783 };
+		inline constexpr REL::ID hknpCapsuleShape{ 760983 };
+		inline constexpr REL::ID hknpCharacterContext{ 233630 };
+		inline constexpr REL::ID hknpCharacterProxy{ 967510 };
+		inline constexpr REL::ID hknpCharacterProxyCinfo{ 1570291 };
+		inline constexpr REL::ID hknpCharacterProxyInternals__QueryCollector{ 702035 };
+		inline constexpr REL::ID hknpCharacterProxyListener{ 663293 };
+		inline constexpr REL::ID hknpCharacterRigidBody{ 249145 };
+		inline constexpr REL::ID hknpCharacterRigidBodyCinfo{ 1303916 };
+		inline constexpr REL::ID hknpCharacterRigidBodyListener{ 1214450 };
+		inline constexpr REL::ID hknpCharacterState{ 582116 };
+		inline constexpr REL::ID hknpCharacterStateManager{ 1029290 };
+		inline constexpr REL::ID hknpCircularSurfaceVelocity{ 482531 };
+		inline constexpr REL::ID hknpClosestHitCollector{ 1568866 };
+		inline constexpr REL::ID hknpClosestUniqueBodyIdHitCollector{ 60589 };
+		inline constexpr REL::ID hknpCollisionDetector{ 1447224 };
+		inline constexpr REL::ID hknpCollisionFilter{ 1520837 };
+		inline constexpr REL::ID hknpCollisionQueryCollector{ 32649 };
+		inline constexpr REL::ID hknpCompositeCollisionDetector{ 1293505 };
+		inline constexpr REL::ID hknpCompositeCompositeCollisionDetector{ 1247140 };
+		inline constexpr REL::ID hknpCompositeShape{ 1048988 };
+		inline constexpr REL::ID hknpCompoundShape{ 1563792 };
+		inline constexpr REL::ID hknpCompoundShapeInternalsKeyMask{ 560750 };
+		inline constexpr REL::ID hknpCompoundShapeInternals_hknpDynamicCompoundShapeInternals___ScaleAndTransformCollector{ 1232596 };
+		inline constexpr REL::ID hknpCompoundShapeInternals_hknpStaticCompoundShapeInternals___ScaleAndTransformCollector{ 687045 };
+		inline constexpr REL::ID hknpCompoundShapeKeyMask{ 873100 };
+		inline constexpr REL::ID hknpCompressedHeightFieldShape{ 530906 };
+		inline constexpr REL::ID hknpCompressedMeshShape{ 1114751 };
+		inline constexpr REL::ID hknpCompressedMeshShapeCinfo{ 642542 };
+		inline constexpr REL::ID hknpCompressedMeshShapeData{ 187843 };
+		inline constexpr REL::ID hknpCompressedMeshShapeInternals__AabbOverlaps_hkArray_unsignedint_hkContainerHeapAllocator__{ 1536869 };
+		inline constexpr REL::ID hknpCompressedMeshShapeInternals__AabbOverlaps_hknpCollisionQueryCollector_{ 1257008 };
+		inline constexpr REL::ID hknpCompressedMeshShapeInternals__BaseUnaryQuery{ 1443439 };
+		inline constexpr REL::ID hknpCompressedMeshShapeInternals__KeyMask{ 1363631 };
+		inline constexpr REL::ID hknpConstraintAtomSolver{ 1087888 };
+		inline constexpr REL::ID hknpConstraintCollisionFilter{ 1371634 };
+		inline constexpr REL::ID hknpConstraintForceEventCreator{ 1285169 };
+		inline constexpr REL::ID hknpConstraintForceExceededEventCreator{ 1238701 };
+		inline constexpr REL::ID hknpConstraintSolver{ 1461085 };
+		inline constexpr REL::ID hknpContactConstraintSolver{ 1494117 };
+		inline constexpr REL::ID hknpContactImpulseClippedEventCreator{ 920465 };
+		inline constexpr REL::ID hknpContactImpulseEventCreator{ 1093293 };
+		inline constexpr REL::ID hknpConvexCompositeCollisionDetector{ 1120705 };
+		inline constexpr REL::ID hknpConvexConvexCollisionDetector{ 1205847 };
+		inline constexpr REL::ID hknpConvexConvexShapeBaseInterface{ 1531262 };
+		inline constexpr REL::ID hknpConvexPolytopeShape{ 1026616 };
+		inline constexpr REL::ID hknpConvexShape{ 231008 };
+		inline constexpr REL::ID hknpDecoratorShape{ 847257 };
+		inline constexpr REL::ID hknpDefaultBroadPhaseConfig{ 681321 };
+		inline constexpr REL::ID hknpDefaultCompressedMeshShapeCinfo{ 595913 };
+		inline constexpr REL::ID hknpDefaultExternMeshShapeGeometry{ 1113181 };
+		inline constexpr REL::ID hknpDefaultModifierSet{ 821974 };
+		inline constexpr REL::ID hknpDestructionShapeProperties{ 1346349 };
+		inline constexpr REL::ID hknpDisableCollisionFilter{ 1285989 };
+		inline constexpr REL::ID hknpDummyShape{ 952850 };
+		inline constexpr REL::ID hknpDynamicCompoundShape{ 1078077 };
+		inline constexpr REL::ID hknpDynamicCompoundShapeData{ 1279128 };
+		inline constexpr REL::ID hknpDynamicSpaceSplitter{ 154439 };
+		inline constexpr REL::ID hknpEaseConstraintsAction{ 948464 };
+		inline constexpr REL::ID hknpEventDispatcher{ 1264946 };
+		inline constexpr REL::ID hknpEventMergeAndDispatcher{ 998643 };
+		inline constexpr REL::ID hknpExternMeshShape{ 467228 };
+		inline constexpr REL::ID hknpExternMeshShapeBuildContext{ 280117 };
+		inline constexpr REL::ID hknpExternMeshShapeData{ 546397 };
+		inline constexpr REL::ID hknpExternMeshShapeGeometry{ 1159889 };
+		inline constexpr REL::ID hknpFirstPersonGun{ 1061390 };
+		inline constexpr REL::ID hknpFixedClosestHitCollector{ 18281 };
+		inline constexpr REL::ID hknpFlippedGetClosestPointsQueryCollector{ 190891 };
+		inline constexpr REL::ID hknpFlippedShapeCastQueryCollector{ 299764 };
+		inline constexpr REL::ID hknpGlobals{ 1370927 };
+		inline constexpr REL::ID hknpGridSpaceSplitter{ 420076 };
+		inline constexpr REL::ID hknpGroupCollisionFilter{ 533686 };
+		inline constexpr REL::ID hknpGroupCollisionFilterBase_hknpGroupCollisionFilterTypes__Config_5_5_5_16__{ 486821 };
+		inline constexpr REL::ID hknpGunProjectile{ 310053 };
+		inline constexpr REL::ID hknpHBPFinishUpdateTask{ 1564251 };
+		inline constexpr REL::ID hknpHBPTreeVsTreeTask{ 247715 };
+		inline constexpr REL::ID hknpHBPUpdateDirtyBodiesTask{ 560491 };
+		inline constexpr REL::ID hknpHBPUpdateTreeTask{ 513706 };
+		inline constexpr REL::ID hknpHeightFieldShape{ 783191 };
+		inline constexpr REL::ID hknpHybridBroadPhase{ 626056 };
+		inline constexpr REL::ID hknpInternalCommandProcessor{ 1134471 };
+		inline constexpr REL::ID hknpLinearSurfaceVelocity{ 65210 };
+		inline constexpr REL::ID hknpLodShape{ 1299868 };
+		inline constexpr REL::ID hknpMalleableConstraintData{ 814679 };
+		inline constexpr REL::ID hknpManifoldEventCreator{ 1233262 };
+		inline constexpr REL::ID hknpMaskedShape{ 848783 };
+		inline constexpr REL::ID hknpMaskedShape__MaskWrapper{ 363317 };
+		inline constexpr REL::ID hknpMassChangerModifier{ 1046686 };
+		inline constexpr REL::ID hknpMaterialLibrary{ 597431 };
+		inline constexpr REL::ID hknpMaterialPalette{ 227439 };
+		inline constexpr REL::ID hknpModifier{ 1466668 };
+		inline constexpr REL::ID hknpMotionPropertiesLibrary{ 1146135 };
+		inline constexpr REL::ID hknpMotionWeldingModifier{ 1471913 };
+		inline constexpr REL::ID hknpMultithreadedSimulation{ 1470691 };
+		inline constexpr REL::ID hknpMxContactSolver{ 1411045 };
+		inline constexpr REL::ID hknpNarrowPhaseTask{ 1423668 };
+		inline constexpr REL::ID hknpNeighborWeldingModifier{ 1518505 };
+		inline constexpr REL::ID hknpNullShapeTagCodec{ 148919 };
+		inline constexpr REL::ID hknpPairCollisionFilter{ 1325025 };
+		inline constexpr REL::ID hknpPhysicsSceneData{ 768103 };
+		inline constexpr REL::ID hknpPhysicsSystem{ 357837 };
+		inline constexpr REL::ID hknpPhysicsSystemData{ 516961 };
+		inline constexpr REL::ID hknpPostCollideTask{ 556120 };
+		inline constexpr REL::ID hknpPostSolveTask{ 289734 };
+		inline constexpr REL::ID hknpPrepare2ndRoundNarrowPhaseTask{ 354599 };
+		inline constexpr REL::ID hknpPrepareConstraintsTask{ 527555 };
+		inline constexpr REL::ID hknpPrepareNarrowPhaseTask{ 401161 };
+		inline constexpr REL::ID hknpProjectileGun{ 795687 };
+		inline constexpr REL::ID hknpRagdoll{ 525157 };
+		inline constexpr REL::ID hknpRagdollController{ 205405 };
+		inline constexpr REL::ID hknpRagdollData{ 1010344 };
+		inline constexpr REL::ID hknpRagdollKeyFrameHierarchyController{ 32119 };
+		inline constexpr REL::ID hknpRagdollMotorController{ 1052420 };
+		inline constexpr REL::ID hknpRefMaterial{ 1082530 };
+		inline constexpr REL::ID hknpRefWorldCinfo{ 1011401 };
+		inline constexpr REL::ID hknpRestitutionModifier{ 514671 };
+		inline constexpr REL::ID hknpSafeEaseConstraintsAction{ 1013777 };
+		inline constexpr REL::ID hknpScaledConvexShape{ 581506 };
+		inline constexpr REL::ID hknpScaledConvexShapeBase{ 1113314 };
+		inline constexpr REL::ID hknpSetShapeKeyACdDetector{ 1419459 };
+		inline constexpr REL::ID hknpShape{ 171731 };
+		inline constexpr REL::ID hknpShapeKeyArrayCacheCdDetector{ 1372811 };
+		inline constexpr REL::ID hknpShapeKeyMask{ 1358353 };
+		inline constexpr REL::ID hknpShapeMassProperties{ 624168 };
+		inline constexpr REL::ID hknpShapeTagCodec{ 634466 };
+		inline constexpr REL::ID hknpSignedDistanceFieldCollisionDetector{ 1159082 };
+		inline constexpr REL::ID hknpSimulation{ 224367 };
+		inline constexpr REL::ID hknpSingleCellSpaceSplitter{ 466619 };
+		inline constexpr REL::ID hknpSingleThreadedSimulation{ 967092 };
+		inline constexpr REL::ID hknpSingleThreadedSolverData{ 447713 };
+		inline constexpr REL::ID hknpSoftContactModifier{ 248728 };
+		inline constexpr REL::ID hknpSolverData{ 933286 };
+		inline constexpr REL::ID hknpSolverSchedulerTask{ 407733 };
+		inline constexpr REL::ID hknpSolverTask{ 433932 };
+		inline constexpr REL::ID hknpSpaceSplitter{ 952270 };
+		inline constexpr REL::ID hknpSphereShape{ 1327600 };
+		inline constexpr REL::ID hknpStaticCompoundShape{ 1501978 };
+		inline constexpr REL::ID hknpStaticCompoundShapeData{ 607367 };
+		inline constexpr REL::ID hknpStaticCompoundShapeInternals{ 1548338 };
+		inline constexpr REL::ID hknpStaticCompoundShapeKeyMask{ 513962 };
+		inline constexpr REL::ID hknpStreamContactSolver{ 1052025 };
+		inline constexpr REL::ID hknpStreamContactSolverBase{ 1145197 };
+		inline constexpr REL::ID hknpStreamContactSolverTypes{ 1098741 };
+		inline constexpr REL::ID hknpSurfaceVelocity{ 331207 };
+		inline constexpr REL::ID hknpSurfaceVelocityModifier{ 1157899 };
+		inline constexpr REL::ID hknpTriangleShape{ 182414 };
+		inline constexpr REL::ID hknpTriangleWeldingModifier{ 1565204 };
+		inline constexpr REL::ID hknpTriggerCollisionDetector{ 1331639 };
+		inline constexpr REL::ID hknpTriggerModifier{ 780902 };
+		inline constexpr REL::ID hknpTyremarksInfo{ 1282878 };
+		inline constexpr REL::ID hknpTyremarksWheel{ 1549027 };
+		inline constexpr REL::ID hknpUnaryAction{ 637891 };
+		inline constexpr REL::ID hknpUniqueBodyIdHitCollector{ 612639 };
+		inline constexpr REL::ID hknpVehicleAerodynamics{ 46011 };
+		inline constexpr REL::ID hknpVehicleBrake{ 1082616 };
+		inline constexpr REL::ID hknpVehicleData{ 531707 };
+		inline constexpr REL::ID hknpVehicleDefaultAerodynamics{ 1362133 };
+		inline constexpr REL::ID hknpVehicleDefaultAnalogDriverInput{ 1175958 };
+		inline constexpr REL::ID hknpVehicleDefaultBrake{ 597508 };
+		inline constexpr REL::ID hknpVehicleDefaultEngine{ 1427956 };
+		inline constexpr REL::ID hknpVehicleDefaultSteering{ 896203 };
+		inline constexpr REL::ID hknpVehicleDefaultSuspension{ 243389 };
+		inline constexpr REL::ID hknpVehicleDefaultTransmission{ 1513313 };
+		inline constexpr REL::ID hknpVehicleDefaultVelocityDamper{ 1200536 };
+		inline constexpr REL::ID hknpVehicleDriverInput{ 1269204 };
+		inline constexpr REL::ID hknpVehicleDriverInputAnalogStatus{ 1002977 };
+		inline constexpr REL::ID hknpVehicleDriverInputStatus{ 1315708 };
+		inline constexpr REL::ID hknpVehicleEngine{ 331296 };
+		inline constexpr REL::ID hknpVehicleInstance{ 887756 };
+		inline constexpr REL::ID hknpVehicleLinearCastWheelCollide{ 89781 };
+		inline constexpr REL::ID hknpVehicleRayCastWheelCollide{ 42969 };
+		inline constexpr REL::ID hknpVehicleSteering{ 1162218 };
+		inline constexpr REL::ID hknpVehicleSuspension{ 509397 };
+		inline constexpr REL::ID hknpVehicleTransmission{ 196989 };
+		inline constexpr REL::ID hknpVehicleVelocityDamper{ 1466502 };
+		inline constexpr REL::ID hknpVehicleWheelCollide{ 355616 };
+		inline constexpr REL::ID hknpWeldingModifier{ 1195022 };
+		inline constexpr REL::ID hknpWorld{ 928882 };
+		inline constexpr REL::ID hknpWorldSnapshot{ 805490 };
+		inline constexpr REL::ID hkpBallAndSocketConstraintData{ 1382619 };
+		inline constexpr REL::ID hkpCallbackConstraintMotor{ 144529 };
+		inline constexpr REL::ID hkpCogWheelConstraintData{ 51215 };
+		inline constexpr REL::ID hkpConstraintData{ 39568 };
+		inline constexpr REL::ID hkpConstraintMotor{ 1235768 };
+		inline constexpr REL::ID hkpDeformableFixedConstraintData{ 425664 };
+		inline constexpr REL::ID hkpFixedConstraintData{ 692158 };
+		inline constexpr REL::ID hkpHingeConstraintData{ 1070114 };
+		inline constexpr REL::ID hkpHingeLimitsData{ 113154 };
+		inline constexpr REL::ID hkpLimitedForceConstraintMotor{ 969500 };
+		inline constexpr REL::ID hkpLimitedHingeConstraintData{ 738756 };
+		inline constexpr REL::ID hkpLinearClearanceConstraintData{ 1087750 };
+		inline constexpr REL::ID hkpLinearParametricCurve{ 150024 };
+		inline constexpr REL::ID hkpParametricCurve{ 415703 };
+		inline constexpr REL::ID hkpPointToPathConstraintData{ 179117 };
+		inline constexpr REL::ID hkpPointToPlaneConstraintData{ 491417 };
+		inline constexpr REL::ID hkpPositionConstraintMotor{ 922886 };
+		inline constexpr REL::ID hkpPrismaticConstraintData{ 804376 };
+		inline constexpr REL::ID hkpPulleyConstraintData{ 444645 };
+		inline constexpr REL::ID hkpRackAndPinionConstraintData{ 1186480 };
+		inline constexpr REL::ID hkpRagdollConstraintData{ 757839 };
+		inline constexpr REL::ID hkpRagdollLimitsData{ 379152 };
+		inline constexpr REL::ID hkpRotationalConstraintData{ 827215 };
+		inline constexpr REL::ID hkpSpringDamperConstraintMotor{ 115871 };
+		inline constexpr REL::ID hkpStiffSpringConstraintData{ 1429252 };
+		inline constexpr REL::ID hkpVehicleFrictionDescription{ 620268 };
+		inline constexpr REL::ID hkpVelocityConstraintMotor{ 1147897 };
+		inline constexpr REL::ID hkpWheelConstraintData{ 1335944 };
+		inline constexpr REL::ID hkpWheelFrictionConstraintData{ 212768 };
+		inline constexpr REL::ID hkpWrappedConstraintData{ 1136536 };
+		inline constexpr REL::ID hkxAnimatedFloat{ 900466 };
+		inline constexpr REL::ID hkxAnimatedMatrix{ 1325210 };
+		inline constexpr REL::ID hkxAnimatedQuaternion{ 760779 };
+		inline constexpr REL::ID hkxAnimatedVector{ 1246109 };
+		inline constexpr REL::ID hkxAttributeHolder{ 1422885 };
+		inline constexpr REL::ID hkxEnum{ 1306211 };
+		inline constexpr REL::ID hkxIndexBuffer{ 1205555 };
+		inline constexpr REL::ID hkxMaterial{ 805079 };
+		inline constexpr REL::ID hkxMesh{ 498220 };
+		inline constexpr REL::ID hkxMeshSection{ 983447 };
+		inline constexpr REL::ID hkxMesh__UserChannelInfo{ 1157165 };
+		inline constexpr REL::ID hkxSparselyAnimatedBool{ 522091 };
+		inline constexpr REL::ID hkxSparselyAnimatedEnum{ 601714 };
+		inline constexpr REL::ID hkxSparselyAnimatedInt{ 256115 };
+		inline constexpr REL::ID hkxSparselyAnimatedString{ 335581 };
+		inline constexpr REL::ID hkxVertexAnimation{ 179796 };
+		inline constexpr REL::ID hkxVertexBuffer{ 1273522 };
+	}
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID IAITarget{ 406318 };
+		inline constexpr REL::ID IAIWorldLocation{ 247725 };
+		inline constexpr REL::ID IAIWorldLocationHandle{ 719498 };
+		inline constexpr REL::ID IAnimationClipLoaderSingleton{ 1549843 };
+		inline constexpr REL::ID IAnimationEventDataForEachFunctor{ 268565 };
+		inline constexpr REL::ID IAnimationGraphManagerHolder{ 755273 };
+		inline constexpr REL::ID IAnimationGraphManagerLoadingTask{ 673597 };
+		inline constexpr REL::ID IAnimationStanceData{ 1228844 };
+		inline constexpr REL::ID IAnimationStreamRead{ 200717 };
+		inline constexpr REL::ID IAnimationStreamWrite{ 466288 };
+		inline constexpr REL::ID IBSTCreator_AnimationSpeedContour_{ 1203730 };
+		inline constexpr REL::ID IBSTCreator_BGSSoundDescriptor_{ 439750 };
+		inline constexpr REL::ID IBSTCreator_BSAnimationDBData_{ 617113 };
+		inline constexpr REL::ID IBSTCreator_BSAudio_{ 416482 };
+		inline constexpr REL::ID IBSTCreator_BSIAudioEffectParameters_{ 521409 };
+		inline constexpr REL::ID IBSTCreator_BSIMusicTrack_{ 595446 };
+		inline constexpr REL::ID IBSTCreator_BSPathingCell_{ 564146 };
+		inline constexpr REL::ID IBSTCreator_BSPathingDoor_{ 536676 };
+		inline constexpr REL::ID IBSTCreator_BSPathingLockData_{ 23156 };
+		inline constexpr REL::ID IBSTCreator_BSPathingRequest_{ 1565364 };
+		inline constexpr REL::ID IBSTCreator_BSPathingSolution_{ 117699 };
+		inline constexpr REL::ID IBSTCreator_BShkNonTransformController_{ 1411218 };
+		inline constexpr REL::ID IBSTCreator_CombatObjectBase_{ 648743 };
+		inline constexpr REL::ID IBSTCreator_IAIWorldLocation_{ 1475386 };
+		inline constexpr REL::ID IBSTCreator_IAnimationStanceData_{ 230589 };
+		inline constexpr REL::ID IBSTCreator_IHandlerFunctor_Actor_BSFixedString__{ 25721 };
+		inline constexpr REL::ID IBSTCreator_IMovementParameters_{ 1277165 };
+		inline constexpr REL::ID IBSTCreator_IPackageData_{ 883350 };
+		inline constexpr REL::ID IBSTCreator_IProcedureTreeExecState_{ 1162526 };
+		inline constexpr REL::ID IBSTCreator_IProcedureTreeItem_{ 1380923 };
+		inline constexpr REL::ID IBSTCreator_IProcedure_{ 861461 };
+		inline constexpr REL::ID IBSTCreator_InitActionI_{ 1435557 };
+		inline constexpr REL::ID IBSTCreator_MovementAgent_{ 652594 };
+		inline constexpr REL::ID IBSTCreator_MovementArbiter_{ 418831 };
+		inline constexpr REL::ID IBSTCreator_MovementMessage_{ 469800 };
+		inline constexpr REL::ID IBSTCreator_RefrInteraction_{ 801416 };
+		inline constexpr REL::ID IBehaviorGraphSwapSingleton{ 98269 };
+		inline constexpr REL::ID IBehaviorGraphSymbolSwapSingleton{ 51563 };
+		inline constexpr REL::ID ICheckEndReachedFunctor{ 486321 };
+		inline constexpr REL::ID ICheckEndReachedFunctorMapper{ 579754 };
+		inline constexpr REL::ID IConvexOverlapImpl{ 497058 };
+		inline constexpr REL::ID IConvexOverlapImpl__ShapeInterface{ 231266 };
+		inline constexpr REL::ID IDDQueueCollection{ 945393 };
+		inline constexpr REL::ID IDEvent{ 574912 };
+		inline constexpr REL::ID IDebugText{ 1219308 };
+		inline constexpr REL::ID IExplosionFactory{ 1239093 };
+		inline constexpr REL::ID IFadeDoneCallback{ 1350380 };
+		inline constexpr REL::ID IForEachDynamicIdleInDir{ 476302 };
+		inline constexpr REL::ID IFormFactory{ 363212 };
+		inline constexpr REL::ID IFormFactory__IFactoryVisitor{ 240013 };
+		inline constexpr REL::ID IGCQueue{ 68019 };
+		inline constexpr REL::ID IGamebryoSequenceGeneratorHolderSingleton{ 480209 };
+		inline constexpr REL::ID IHandlerFunctor_Actor_BSFixedString_{ 1527468 };
+		inline constexpr REL::ID IKeywordFormBase{ 1460349 };
+		inline constexpr REL::ID IMemoryHeap{ 1360561 };
+		inline constexpr REL::ID IMemoryManagerFile{ 1421725 };
+		inline constexpr REL::ID IMemoryManagerFileFactory{ 1155927 };
+		inline constexpr REL::ID IMemoryStore{ 99628 };
+		inline constexpr REL::ID IMemoryStoreBase{ 1196618 };
+		inline constexpr REL::ID IMenu{ 1535673 };
+		inline constexpr REL::ID IMessageBoxCallback{ 925040 };
+		inline constexpr REL::ID IMovementAgentDataTracker_IMovementHandlerAgent_MovementHandlerOutputDataSmallDelta_{ 54282 };
+		inline constexpr REL::ID IMovementAgentDataTracker_IMovementHandlerAgent_MovementHandlerUpdateDataSmallDelta_{ 1291145 };
+		inline constexpr REL::ID IMovementAgentDataTracker_IMovementPathManagerAgent_MovementPathManagerAgentReturnData__AGENT_RESULT_{ 377013 };
+		inline constexpr REL::ID IMovementAgentDataTracker_IMovementPlannerAgent_MovementPlannerAgentReturnDataSmallDelta_{ 100559 };
+		inline constexpr REL::ID IMovementAgentDataTracker_IMovementTweenerAgent_MovementTweenerAgentOutputData_{ 514572 };
+		inline constexpr REL::ID IMovementAvoidanceManager{ 64877 };
+		inline constexpr REL::ID IMovementControllerDataTracker{ 78935 };
+		inline constexpr REL::ID IMovementControllerNPCFunctor{ 270872 };
+		inline constexpr REL::ID IMovementControllerRegisterInterface{ 1372496 };
+		inline constexpr REL::ID IMovementDeltaStore{ 407682 };
+		inline constexpr REL::ID IMovementDirectControl{ 1214018 };
+		inline constexpr REL::ID IMovementFormIDManager{ 627653 };
+		inline constexpr REL::ID IMovementHandlerAgent{ 1384461 };
+		inline constexpr REL::ID IMovementInterface{ 690927 };
+		inline constexpr REL::ID IMovementMessageInterface{ 1480097 };
+		inline constexpr REL::ID IMovementMotionDrivenControl{ 635322 };
+		inline constexpr REL::ID IMovementParameters{ 192347 };
+		inline constexpr REL::ID IMovementPathManagerAgent{ 1487955 };
+		inline constexpr REL::ID IMovementPathManagerDataTracker{ 423483 };
+		inline constexpr REL::ID IMovementPlannerAgent{ 1525878 };
+		inline constexpr REL::ID IMovementPlannerDirectControl{ 947704 };
+		inline constexpr REL::ID IMovementPlannerSetArbitration{ 194090 };
+		inline constexpr REL::ID IMovementPlayIdleResult{ 1447119 };
+		inline constexpr REL::ID IMovementPlayerControls{ 1313886 };
+		inline constexpr REL::ID IMovementPlayerControlsFilter{ 332286 };
+		inline constexpr REL::ID IMovementQueryActorAvoidance{ 1396765 };
+		inline constexpr REL::ID IMovementQueryAnimDeltas{ 588707 };
+		inline constexpr REL::ID IMovementQueryDeltas{ 674121 };
+		inline constexpr REL::ID IMovementQueryDesiredDeltas{ 158755 };
+		inline constexpr REL::ID IMovementQueryFlight{ 1166886 };
+		inline constexpr REL::ID IMovementQueryPathFollowing{ 719941 };
+		inline constexpr REL::ID IMovementQueryPathFollowing__INodeVisitor{ 673165 };
+		inline constexpr REL::ID IMovementQueryPathingState{ 470055 };
+		inline constexpr REL::ID IMovementQueryState{ 522061 };
+		inline constexpr REL::ID IMovementQueryStaticAvoider{ 1558238 };
+		inline constexpr REL::ID IMovementQueryTweener{ 1312484 };
+		inline constexpr REL::ID IMovementQueryTweenerState{ 1243989 };
+		inline constexpr REL::ID IMovementSelectIdle{ 901118 };
+		inline constexpr REL::ID IMovementSetCorrectionData{ 1290455 };
+		inline constexpr REL::ID IMovementSetGoal{ 955684 };
+		inline constexpr REL::ID IMovementSetPathFollowing{ 845631 };
+		inline constexpr REL::ID IMovementSetPlayerControls{ 111980 };
+		inline constexpr REL::ID IMovementSetSprinting{ 53368 };
+		inline constexpr REL::ID IMovementSetState{ 588248 };
+		inline constexpr REL::ID IMovementSetStaticAvoider{ 241844 };
+		inline constexpr REL::ID IMovementSetTweener{ 1046599 };
+		inline constexpr REL::ID IMovementSetWarp{ 1531204 };
+		inline constexpr REL::ID IMovementState{ 1305028 };
+		inline constexpr REL::ID IMovementTweenerAgent{ 424465 };
+		inline constexpr REL::ID IMultiActivateUser{ 746385 };
+		inline constexpr REL::ID INIPrefSettingCollection{ 828461 };
+		inline constexpr REL::ID INISettingCollection{ 611766 };
+		inline constexpr REL::ID INavmeshSearchFilterSet{ 1396986 };
+		inline constexpr REL::ID IOManager{ 843117 };
+		inline constexpr REL::ID IOManagerThread{ 1361024 };
+		inline constexpr REL::ID IOSystemTask{ 1532070 };
+		inline constexpr REL::ID IOTask{ 913723 };
+		inline constexpr REL::ID IPackageData{ 1213094 };
+		inline constexpr REL::ID IPackageDataAIWorldLocationHandle{ 452800 };
+		inline constexpr REL::ID IPackageDataTypeCheck{ 38878 };
+		inline constexpr REL::ID IPathBuilder{ 1441152 };
+		inline constexpr REL::ID IPathBuilderFactoryBase{ 229811 };
+		inline constexpr REL::ID IPathBuilderTracker{ 795281 };
+		inline constexpr REL::ID IPathFollowerAction{ 985297 };
+		inline constexpr REL::ID IPathFollowerState{ 1496844 };
+		inline constexpr REL::ID IPathSmootherRayCast{ 1409288 };
+		inline constexpr REL::ID IPathingNodeGenerator{ 833008 };
+		inline constexpr REL::ID IPipboyThrottledValue{ 603533 };
+		inline constexpr REL::ID IPipelineStageInterface{ 647212 };
+		inline constexpr REL::ID IPostAnimationChannelUpdateFunctor{ 713209 };
+		inline constexpr REL::ID IProcedure{ 1089250 };
+		inline constexpr REL::ID IProcedureTreeExecState{ 1355092 };
+		inline constexpr REL::ID IProcedureTreeItem{ 1428266 };
+		inline constexpr REL::ID IProcedureTreeVisitor{ 408592 };
+		inline constexpr REL::ID IPromptMenuRequest{ 1008047 };
+		inline constexpr REL::ID IRaceSubGraphDataFunctor{ 842455 };
+		inline constexpr REL::ID IRendererResourceManager{ 451126 };
+		inline constexpr REL::ID ISelectIdleFilter{ 1181118 };
+		inline constexpr REL::ID ISmoothingRayValidator{ 48617 };
+		inline constexpr REL::ID IStateMachineCallbackSingleton{ 1469038 };
+		inline constexpr REL::ID IStaticAvoidNodeManager{ 288023 };
+		inline constexpr REL::ID IStringForwarder{ 915488 };
+		inline constexpr REL::ID ISynchronizedAnimationSingleton{ 345635 };
+		inline constexpr REL::ID ITempEffectFactory{ 878213 };
+		inline constexpr REL::ID ITextureDB{ 1564882 };
+		inline constexpr REL::ID ITrianglePathSplitter{ 93336 };
+		inline constexpr REL::ID ITweenerNodeFollowerSetup{ 752382 };
+		inline constexpr REL::ID IUIMessageData{ 635285 };
+		inline constexpr REL::ID IUnknown{ 789923 };
+		inline constexpr REL::ID IValidateGoalFunctor{ 122163 };
+		inline constexpr REL::ID IVisitProcedures{ 1233599 };
+		inline constexpr REL::ID IXAPO{ 1494795 };
+		inline constexpr REL::ID IXAudio2EngineCallback{ 51970 };
+		inline constexpr REL::ID IXAudio2VoiceCallback{ 1126681 };
+		inline constexpr REL::ID IdleDialogueEnterHandler{ 270842 };
+		inline constexpr REL::ID IdleDialogueExitHandler{ 4106 };
+		inline constexpr REL::ID IdleFlavorHandler{ 328033 };
+		inline constexpr REL::ID IiStateTaggingListenerSingleton{ 1164696 };
+		inline constexpr REL::ID ImageSpaceEffect{ 782608 };
+		inline constexpr REL::ID ImageSpaceEffectAmbientOcclusion{ 1119604 };
+		inline constexpr REL::ID ImageSpaceEffectBlur{ 1105207 };
+		inline constexpr REL::ID ImageSpaceEffectBlurCS{ 249253 };
+		inline constexpr REL::ID ImageSpaceEffectBokehDepthOfField{ 1111305 };
+		inline constexpr REL::ID ImageSpaceEffectDepthOfField{ 1047187 };
+		inline constexpr REL::ID ImageSpaceEffectDepthOfFieldSplitScreen{ 1000370 };
+		inline constexpr REL::ID ImageSpaceEffectFullScreenBlur{ 839262 };
+		inline constexpr REL::ID ImageSpaceEffectFullScreenColor{ 293266 };
+		inline constexpr REL::ID ImageSpaceEffectGetHit{ 792841 };
+		inline constexpr REL::ID ImageSpaceEffectHDR{ 774445 };
+		inline constexpr REL::ID ImageSpaceEffectHDRCS{ 594915 };
+		inline constexpr REL::ID ImageSpaceEffectHUDGlass{ 128378 };
+		inline constexpr REL::ID ImageSpaceEffectMap{ 328659 };
+		inline constexpr REL::ID ImageSpaceEffectModMenu{ 151408 };
+		inline constexpr REL::ID ImageSpaceEffectMotionBlur{ 480622 };
+		inline constexpr REL::ID ImageSpaceEffectNoise{ 753962 };
+		inline constexpr REL::ID ImageSpaceEffectOption{ 1470765 };
+		inline constexpr REL::ID ImageSpaceEffectParam{ 278772 };
+		inline constexpr REL::ID ImageSpaceEffectPipboyScreen{ 184383 };
+		inline constexpr REL::ID ImageSpaceEffectRadialBlur{ 260570 };
+		inline constexpr REL::ID ImageSpaceEffectRainSplash{ 66465 };
+		inline constexpr REL::ID ImageSpaceEffectRefraction{ 1359547 };
+		inline constexpr REL::ID ImageSpaceEffectScalableAmbientObscurance{ 1484682 };
+		inline constexpr REL::ID ImageSpaceEffectScalableAmbientObscuranceCS{ 368243 };
+		inline constexpr REL::ID ImageSpaceEffectSunbeams{ 88625 };
+		inline constexpr REL::ID ImageSpaceEffectTemporalAA{ 859016 };
+		inline constexpr REL::ID ImageSpaceEffectUpsampleDynamicResolution{ 1351182 };
+		inline constexpr REL::ID ImageSpaceEffectVLS{ 1397837 };
+		inline constexpr REL::ID ImageSpaceEffectVLSLight{ 81815 };
+		inline constexpr REL::ID ImageSpaceEffectVatsTarget{ 1427418 };
+		inline constexpr REL::ID ImageSpaceEffectWaterDisplacement{ 916334 };
+		inline constexpr REL::ID ImageSpaceModifierInstance{ 1208115 };
+		inline constexpr REL::ID ImageSpaceModifierInstanceDOF{ 1114580 };
+		inline constexpr REL::ID ImageSpaceModifierInstanceForm{ 1254581 };
+		inline constexpr REL::ID ImageSpaceModifierInstanceRB{ 1067913 };
+		inline constexpr REL::ID ImageSpaceModifierInstanceTemp{ 1161319 };
+		inline constexpr REL::ID ImageSpaceShaderParam{ 12330 };
+		inline constexpr REL::ID ImmunityEffect{ 1043754 };
+		inline constexpr REL::ID IndividualClipAnimationSpeedContour{ 400035 };
+		inline constexpr REL::ID IngredientItem{ 1146809 };
+		inline constexpr REL::ID InitActionI{ 712336 };
+		inline constexpr REL::ID InputEvent{ 1060100 };
+		inline constexpr REL::ID IntSeenData{ 990548 };
+		inline constexpr REL::ID InteractionCombatDataCollectFunctor{ 968435 };
+		inline constexpr REL::ID InterruptCastHandler{ 306541 };
+		inline constexpr REL::ID Inventory3DManager{ 746996 };
+		inline constexpr REL::ID InventoryScoringFunctor{ 932746 };
+		inline constexpr REL::ID InventoryUpdateData{ 830802 };
+		inline constexpr REL::ID InvisibilityEffect{ 511800 };
+		inline constexpr REL::ID IronSightsState{ 633627 };
+		inline constexpr REL::ID IsFavoriteFunctor{ 708345 };
+	}
+}
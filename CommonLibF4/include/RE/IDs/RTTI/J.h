@@ -0,0 +1,26 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID JetpackEffect{ 857324 };
+		inline constexpr REL::ID JobListManager__ServingThread{ 1341099 };
+		inline constexpr REL::ID Json__BuiltStyledStreamWriter{ 700038 };
+		inline constexpr REL::ID Json__CharReader{ 1417819 };
+		inline constexpr REL::ID Json__CharReaderBuilder{ 666909 };
+		inline constexpr REL::ID Json__CharReader__Factory{ 932611 };
+		inline constexpr REL::ID Json__Exception{ 1291910 };
+		inline constexpr REL::ID Json__FastWriter{ 956563 };
+		inline constexpr REL::ID Json__LogicError{ 321122 };
+		inline constexpr REL::ID Json__OurCharReader{ 965485 };
+		inline constexpr REL::ID Json__RuntimeError{ 806754 };
+		inline constexpr REL::ID Json__StreamWriter{ 400506 };
+		inline constexpr REL::ID Json__StreamWriterBuilder{ 1231674 };
+		inline constexpr REL::ID Json__StreamWriter__Factory{ 1497928 };
+		inline constexpr REL::ID Json__StyledWriter{ 727452 };
+		inline constexpr REL::ID Json__Writer{ 470929 };
+		inline constexpr REL::ID JumpAnimEventHandler{ 536924 };
+		inline constexpr REL::ID JumpHandler{ 568116 };
+	}
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID KillActorHandler{ 142230 };
+		inline constexpr REL::ID KillMoveEndHandler{ 591945 };
+		inline constexpr REL::ID KillMoveStartHandler{ 857721 };
+		inline constexpr REL::ID KinectEvent{ 27411 };
+		inline constexpr REL::ID KnockdownHandler{ 67497 };
+		inline constexpr REL::ID KnockdownTargetHandler{ 1164360 };
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID LOCALNAMESPACE__hkNativeResource{ 549621 };
+		inline constexpr REL::ID LargestAreaFunctor{ 200785 };
+		inline constexpr REL::ID LeftHandSpellCastHandler{ 934876 };
+		inline constexpr REL::ID LeftHandSpellFireHandler{ 150792 };
+		inline constexpr REL::ID LevelUpMenu{ 1367145 };
+		inline constexpr REL::ID LightEffect{ 325278 };
+		inline constexpr REL::ID LipSynchAnimDB__DBTraits{ 767735 };
+		inline constexpr REL::ID LipSynchAnimDB__LipAudioInterface{ 208206 };
+		inline constexpr REL::ID LoadGameMagicCasterVisitor{ 547955 };
+		inline constexpr REL::ID LoadStorageWrapper{ 537399 };
+		inline constexpr REL::ID LoadedAreaBound{ 1145436 };
+		inline constexpr REL::ID LoadingMenu{ 883491 };
+		inline constexpr REL::ID LoadingMenuData{ 177621 };
+		inline constexpr REL::ID LocalMapCamera{ 413460 };
+		inline constexpr REL::ID LocalMapCamera__DefaultState{ 805992 };
+		inline constexpr REL::ID LocalMapSnapshotCommand{ 964888 };
+		inline constexpr REL::ID LockEffect{ 232145 };
+		inline constexpr REL::ID LockpickingMenu{ 104751 };
+		inline constexpr REL::ID LongestDurationFunctor{ 466356 };
+		inline constexpr REL::ID LookHandler{ 96321 };
+		inline constexpr REL::ID LooksInputRepeatHandler{ 1578559 };
+		inline constexpr REL::ID LooksMenu{ 1312333 };
+		inline constexpr REL::ID LooksMenuUtils__ChangePresetConfirmCallback{ 999594 };
+		inline constexpr REL::ID LooksMenuUtils__ExitConfirmCallback{ 607771 };
+		inline constexpr REL::ID LoopingActivateHandler{ 388371 };
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID MagicCaster{ 432039 };
+		inline constexpr REL::ID MagicCaster__PostCreationCallback{ 311527 };
+		inline constexpr REL::ID MagicItem{ 223609 };
+		inline constexpr REL::ID MagicItemDataCollector{ 355711 };
+		inline constexpr REL::ID MagicItemFindFunctor{ 134867 };
+		inline constexpr REL::ID MagicItemFindKeywordFunctor{ 1451226 };
+		inline constexpr REL::ID MagicItemTraversalFunctor{ 400716 };
+		inline constexpr REL::ID MagicItem__PreloadableVisitor{ 447224 };
+		inline constexpr REL::ID MagicTarget{ 539539 };
+		inline constexpr REL::ID MagicTarget__IPostCreationModification{ 813862 };
+		inline constexpr REL::ID Main{ 393730 };
+		inline constexpr REL::ID MainMenu{ 987313 };
+		inline constexpr REL::ID MatchEquippedAndFavoriteDataFunctor{ 535286 };
+		inline constexpr REL::ID MeleeThrowHandler{ 1525145 };
+		inline constexpr REL::ID MemoryHeap{ 749636 };
+		inline constexpr REL::ID MemoryManagerFile{ 138515 };
+		inline constexpr REL::ID MenuControls{ 186763 };
+		inline constexpr REL::ID MenuCursor{ 610691 };
+		inline constexpr REL::ID MenuOpenHandler{ 1475536 };
+		inline constexpr REL::ID MenuTopicManager{ 667316 };
+		inline constexpr REL::ID MessageBoxData{ 762318 };
+		inline constexpr REL::ID MessageBoxMenu{ 276744 };
+		inline constexpr REL::ID MessageBoxMenu__FXMessageBoxMenu{ 1373354 };
+		inline constexpr REL::ID MiscStatManager__FindStatByCRC{ 701974 };
+		inline constexpr REL::ID MiscStatManager__IMiscStatVisitor{ 748433 };
+		inline constexpr REL::ID MiscStatManager____RevertStatVisitor{ 390708 };
+		inline constexpr REL::ID MiscStatManager____SaveStatVisitor{ 1361306 };
+		inline constexpr REL::ID MissileProjectile{ 445922 };
+		inline constexpr REL::ID MobIterOperator{ 1027031 };
+		inline constexpr REL::ID ModManager__AsyncModRequest{ 1155032 };
+		inline constexpr REL::ID ModManager__CategorySearchRequest{ 1061756 };
+		inline constexpr REL::ID ModManager__CloseModManager_ConfirmCallback{ 614808 };
+		inline constexpr REL::ID ModManager__DeleteAllMods_ConfirmCallback{ 222690 };
+		inline constexpr REL::ID ModManager__DeleteLibraryMod_ConfirmCallback{ 1412437 };
+		inline constexpr REL::ID ModManager__DeleteMod_ConfirmCallback{ 1240123 };
+		inline constexpr REL::ID ModManager__DownloadImageRequest{ 921823 };
+		inline constexpr REL::ID ModManager__DownloadModRequest{ 1108400 };
+		inline constexpr REL::ID ModManager__GetDependencyRequest{ 968471 };
+		inline constexpr REL::ID ModManager__GetDetailsRequest{ 1015100 };
+		inline constexpr REL::ID ModManager__GetIntRequest{ 828691 };
+		inline constexpr REL::ID ModManager__ModsChanged_ConfirmResetCallback{ 735746 };
+		inline constexpr REL::ID ModManager__ReportMod_CategoryCallback{ 1253747 };
+		inline constexpr REL::ID ModManager__ReportMod_ConfirmCallback{ 1426197 };
+		inline constexpr REL::ID ModManager__SavedGFxValueRequest{ 875169 };
+		inline constexpr REL::ID ModManager__StringStringRequest{ 562808 };
+		inline constexpr REL::ID ModTimeLeftFunctor{ 1431496 };
+		inline constexpr REL::ID ModelReferenceEffect{ 596903 };
+		inline constexpr REL::ID Moon{ 1277033 };
+		inline constexpr REL::ID MotionDrivenHandler{ 937160 };
+		inline constexpr REL::ID MountDismountEndHandler{ 1535139 };
+		inline constexpr REL::ID MountInteraction{ 1141674 };
+		inline constexpr REL::ID MouseMoveEvent{ 653350 };
+		inline constexpr REL::ID MovementAgent{ 287586 };
+		inline constexpr REL::ID MovementAgentActorAvoider{ 1350135 };
+		inline constexpr REL::ID MovementAgentActorState{ 102670 };
+		inline constexpr REL::ID MovementAgentNullTracker_IMovementHandlerAgent_MovementHandlerOutputDataSmallDelta_{ 1063315 };
+		inline constexpr REL::ID MovementAgentNullTracker_IMovementHandlerAgent_MovementHandlerUpdateDataSmallDelta_{ 372343 };
+		inline constexpr REL::ID MovementAgentNullTracker_IMovementPlannerAgent_MovementPlannerAgentReturnDataSmallDelta_{ 232085 };
+		inline constexpr REL::ID MovementAgentNullTracker_IMovementTweenerAgent_MovementTweenerAgentOutputData_{ 660092 };
+		inline constexpr REL::ID MovementAgentPathFollowerFlight{ 900888 };
+		inline constexpr REL::ID MovementAgentPathFollowerStandard{ 1270667 };
+		inline constexpr REL::ID MovementAgentPathFollowerVirtual{ 1485241 };
+		inline constexpr REL::ID MovementArbiter{ 1557301 };
+		inline constexpr REL::ID MovementArbitrationAverageFloat{ 869903 };
+		inline constexpr REL::ID MovementArbitrationAverage_float_{ 823554 };
+		inline constexpr REL::ID MovementArbitrationMaxWeightParameters{ 1467993 };
+		inline constexpr REL::ID MovementArbitrationMaxWeightPoint{ 730575 };
+		inline constexpr REL::ID MovementArbitrationMaxWeight_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__{ 277734 };
+		inline constexpr REL::ID MovementArbitrationMaxWeight_NiPoint3_{ 902989 };
+		inline constexpr REL::ID MovementArbitrationScheme_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__{ 1061931 };
+		inline constexpr REL::ID MovementArbitrationScheme_MovementVector_{ 843775 };
+		inline constexpr REL::ID MovementArbitrationScheme_NiPoint3_{ 1294982 };
+		inline constexpr REL::ID MovementArbitrationScheme_float_{ 777111 };
+		inline constexpr REL::ID MovementArbitrationVectorAdd{ 671254 };
+		inline constexpr REL::ID MovementAvoidBoxEventAdapter{ 1150459 };
+		inline constexpr REL::ID MovementAvoidanceManager{ 629982 };
+		inline constexpr REL::ID MovementControllerAI{ 56411 };
+		inline constexpr REL::ID MovementControllerNPC{ 322429 };
+		inline constexpr REL::ID MovementControllerNullDataTracker{ 1035737 };
+		inline constexpr REL::ID MovementHandler{ 581884 };
+		inline constexpr REL::ID MovementHandlerAgent{ 553992 };
+		inline constexpr REL::ID MovementHandlerAgentAngleGain{ 1010036 };
+		inline constexpr REL::ID MovementHandlerAgentAnglePassThrough{ 1473677 };
+		inline constexpr REL::ID MovementHandlerAgentAnimationDriven{ 380947 };
+		inline constexpr REL::ID MovementHandlerAgentDirectControl{ 607694 };
+		inline constexpr REL::ID MovementHandlerAgentDirectionPassThrough{ 1352465 };
+		inline constexpr REL::ID MovementHandlerAgentGraphDrivenAnimationDriven{ 778702 };
+		inline constexpr REL::ID MovementHandlerAgentPlayerControls{ 65376 };
+		inline constexpr REL::ID MovementHandlerAgentPlayerControlsActionTrigger{ 1410755 };
+		inline constexpr REL::ID MovementHandlerAgentSpeedPassThrough{ 1374596 };
+		inline constexpr REL::ID MovementHandlerAgentSprintActionTrigger{ 1369437 };
+		inline constexpr REL::ID MovementHandlerAgentStairsHelper{ 324736 };
+		inline constexpr REL::ID MovementHandlerAgentStandard{ 1329650 };
+		inline constexpr REL::ID MovementHandlerAgentStorePlannerOutput{ 666574 };
+		inline constexpr REL::ID MovementHandlerAgentStrafing{ 135036 };
+		inline constexpr REL::ID MovementHandlerArbiter{ 240897 };
+		inline constexpr REL::ID MovementLargeDelta__IEnumVisitor{ 772870 };
+		inline constexpr REL::ID MovementManager{ 399505 };
+		inline constexpr REL::ID MovementMessage{ 955453 };
+		inline constexpr REL::ID MovementMessageActivateDoor{ 1552124 };
+		inline constexpr REL::ID MovementMessageActorCollision{ 423253 };
+		inline constexpr REL::ID MovementMessageApproachingDoor{ 15876 };
+		inline constexpr REL::ID MovementMessageBlocked{ 186357 };
+		inline constexpr REL::ID MovementMessageDoor{ 282311 };
+		inline constexpr REL::ID MovementMessageFreezeDirection{ 775449 };
+		inline constexpr REL::ID MovementMessageJump{ 89835 };
+		inline constexpr REL::ID MovementMessageNewPath{ 895329 };
+		inline constexpr REL::ID MovementMessagePathCleared{ 1381618 };
+		inline constexpr REL::ID MovementMessagePathComplete{ 112165 };
+		inline constexpr REL::ID MovementMessagePathEvent{ 629511 };
+		inline constexpr REL::ID MovementMessagePathFailed{ 65565 };
+		inline constexpr REL::ID MovementMessagePlayIdle{ 1428001 };
+		inline constexpr REL::ID MovementMessageSetStaticPath{ 1134594 };
+		inline constexpr REL::ID MovementMessageUpdateRequestImmediate{ 363140 };
+		inline constexpr REL::ID MovementMessageWarpToLocation{ 1478191 };
+		inline constexpr REL::ID MovementMessageWarpToMultiple{ 40662 };
+		inline constexpr REL::ID MovementParameters{ 1508543 };
+		inline constexpr REL::ID MovementParametersFixed{ 263944 };
+		inline constexpr REL::ID MovementPathManagerAgent{ 1221937 };
+		inline constexpr REL::ID MovementPathManagerAgentAvoidBox{ 285544 };
+		inline constexpr REL::ID MovementPathManagerAgentLoadedAreaMonitor{ 988479 };
+		inline constexpr REL::ID MovementPathManagerAgentStaticAvoider{ 1511677 };
+		inline constexpr REL::ID MovementPathManagerArbiter{ 941861 };
+		inline constexpr REL::ID MovementPathManagerNullTracker{ 536210 };
+		inline constexpr REL::ID MovementPlannerAgent{ 209569 };
+		inline constexpr REL::ID MovementPlannerAgentDirectControl{ 256086 };
+		inline constexpr REL::ID MovementPlannerAgentNavmeshBounds{ 13833 };
+		inline constexpr REL::ID MovementPlannerAgentWarp{ 1045623 };
+		inline constexpr REL::ID MovementPlannerArbiter{ 147192 };
+		inline constexpr REL::ID MovementPostUpdateArbiter{ 141756 };
+		inline constexpr REL::ID MovementSelectIdleUtils__SelectClosestIdleToMovementSelectionData{ 1526781 };
+		inline constexpr REL::ID MovementSelectIdleUtils__SelectClosestIdleToPath{ 915062 };
+		inline constexpr REL::ID MovementStateFollowPath{ 1533238 };
+		inline constexpr REL::ID MovementStateTransformOverride{ 730068 };
+		inline constexpr REL::ID MovementStateTweener{ 683505 };
+		inline constexpr REL::ID MovementTweenerAgent{ 439284 };
+		inline constexpr REL::ID MovementTweenerAgentFixedDelta{ 1197324 };
+		inline constexpr REL::ID MovementTweenerAgentNodeFollower{ 486116 };
+		inline constexpr REL::ID MovementTweenerAgentTargetPosAndVel{ 1006298 };
+		inline constexpr REL::ID MovementTweenerArbiter{ 780806 };
+		inline constexpr REL::ID Movie{ 653088 };
+		inline constexpr REL::ID MoviePlayer{ 1159500 };
+		inline constexpr REL::ID MultiActivateManager{ 480074 };
+		inline constexpr REL::ID MultiActivateMenu{ 93402 };
+	}
+}
@@ -0,0 +1,364 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID NEW_REFR_DATA{ 93135 };
+		inline constexpr REL::ID NPCAttachHandler{ 1269024 };
+		inline constexpr REL::ID NPCDetachHandler{ 783831 };
+		inline constexpr REL::ID NVFlex__DebrisInstanceData{ 945483 };
+		inline constexpr REL::ID NVFlex__DebrisInstanceDataOwner{ 1087489 };
+		inline constexpr REL::ID NVFlex__DebrisInstanceGroup{ 1134057 };
+		inline constexpr REL::ID NVFlex__DebrisInstanceGroupPass{ 1040830 };
+		inline constexpr REL::ID NVFlex__DebrisInstanceManager{ 1201319 };
+		inline constexpr REL::ID NVFlex__DebrisInstanceNode{ 1380818 };
+		inline constexpr REL::ID NVFlex__DebrisNode{ 1439547 };
+		inline constexpr REL::ID NVFlex__DebrisRenderer{ 422142 };
+		inline constexpr REL::ID NVFlex__FlexThread{ 721584 };
+		inline constexpr REL::ID NVFlex__SingletonSDMOpShared_NVFlex__DebrisInstanceManager_{ 608902 };
+		inline constexpr REL::ID NavMesh{ 1214696 };
+		inline constexpr REL::ID NavMeshInfoMap{ 668893 };
+		inline constexpr REL::ID NavMeshObstacleCoverManager{ 556272 };
+		inline constexpr REL::ID NavMeshSearchClosePoint{ 500493 };
+		inline constexpr REL::ID NavMeshSearchFitSphere{ 1191615 };
+		inline constexpr REL::ID NavMeshSearchFlee{ 127555 };
+		inline constexpr REL::ID NavMeshSearchHide{ 1131084 };
+		inline constexpr REL::ID NavMeshSearchLOS{ 1383226 };
+		inline constexpr REL::ID NavMeshSearchMaxCost{ 1336574 };
+		inline constexpr REL::ID NavMeshSearchMultipleGoals{ 1243722 };
+		inline constexpr REL::ID NavMeshSearchSLPoint{ 1416105 };
+		inline constexpr REL::ID NiAVObject{ 365312 };
+		inline constexpr REL::ID NiAVObjectPalette{ 1490548 };
+		inline constexpr REL::ID NiAccumulator{ 664945 };
+		inline constexpr REL::ID NiAdditionalGeometryData{ 1580572 };
+		inline constexpr REL::ID NiAllocator{ 863913 };
+		inline constexpr REL::ID NiAlphaAccumulator{ 179546 };
+		inline constexpr REL::ID NiAlphaProperty{ 817303 };
+		inline constexpr REL::ID NiAmbientLight{ 1449055 };
+		inline constexpr REL::ID NiBSPNode{ 431293 };
+		inline constexpr REL::ID NiBSplineBasisData{ 776636 };
+		inline constexpr REL::ID NiBSplineColorInterpolator{ 244417 };
+		inline constexpr REL::ID NiBSplineCompColorInterpolator{ 151276 };
+		inline constexpr REL::ID NiBSplineCompFloatInterpolator{ 323790 };
+		inline constexpr REL::ID NiBSplineCompPoint3Interpolator{ 449718 };
+		inline constexpr REL::ID NiBSplineCompTransformInterpolator{ 576227 };
+		inline constexpr REL::ID NiBSplineData{ 510395 };
+		inline constexpr REL::ID NiBSplineFloatInterpolator{ 277274 };
+		inline constexpr REL::ID NiBSplineInterpolator{ 197948 };
+		inline constexpr REL::ID NiBSplinePoint3Interpolator{ 403260 };
+		inline constexpr REL::ID NiBSplineTransformInterpolator{ 749141 };
+		inline constexpr REL::ID NiBackToFrontAccumulator{ 1495927 };
+		inline constexpr REL::ID NiBillboardNode{ 180356 };
+		inline constexpr REL::ID NiBinaryExtraData{ 963519 };
+		inline constexpr REL::ID NiBinaryStream{ 747726 };
+		inline constexpr REL::ID NiBlendAccumTransformInterpolator{ 518826 };
+		inline constexpr REL::ID NiBlendBoolInterpolator{ 1321984 };
+		inline constexpr REL::ID NiBlendColorInterpolator{ 1275549 };
+		inline constexpr REL::ID NiBlendFloatInterpolator{ 1456753 };
+		inline constexpr REL::ID NiBlendInterpolator{ 1503665 };
+		inline constexpr REL::ID NiBlendPoint3Interpolator{ 1228999 };
+		inline constexpr REL::ID NiBlendQuaternionInterpolator{ 1182303 };
+		inline constexpr REL::ID NiBlendTransformInterpolator{ 1550012 };
+		inline constexpr REL::ID NiBoolData{ 1135559 };
+		inline constexpr REL::ID NiBoolInterpController{ 831431 };
+		inline constexpr REL::ID NiBoolInterpolator{ 869417 };
+		inline constexpr REL::ID NiBoolTimelineInterpolator{ 823062 };
+		inline constexpr REL::ID NiBooleanExtraData{ 478137 };
+		inline constexpr REL::ID NiBoundingVolume{ 63889 };
+		inline constexpr REL::ID NiBoxBV{ 1160861 };
+		inline constexpr REL::ID NiBoxCapsuleIntersector{ 1572322 };
+		inline constexpr REL::ID NiBoxSphereIntersector{ 255861 };
+		inline constexpr REL::ID NiCamera{ 191073 };
+		inline constexpr REL::ID NiCapsuleBV{ 455802 };
+		inline constexpr REL::ID NiCapsuleCapsuleIntersector{ 1305985 };
+		inline constexpr REL::ID NiCapsuleSphereIntersector{ 1259538 };
+		inline constexpr REL::ID NiCapsuleTriIntersector{ 1213065 };
+		inline constexpr REL::ID NiCollisionData{ 1034600 };
+		inline constexpr REL::ID NiCollisionObject{ 549550 };
+		inline constexpr REL::ID NiCollisionTraversals__IFindIntersections{ 861860 };
+		inline constexpr REL::ID NiColorData{ 1040435 };
+		inline constexpr REL::ID NiColorExtraData{ 1308996 };
+		inline constexpr REL::ID NiColorExtraDataController{ 1579882 };
+		inline constexpr REL::ID NiColorInterpolator{ 1124817 };
+		inline constexpr REL::ID NiControllerManager{ 1292284 };
+		inline constexpr REL::ID NiControllerSequence{ 1278597 };
+		inline constexpr REL::ID NiCullingProcess{ 585481 };
+		inline constexpr REL::ID NiDefaultAVObjectPalette{ 1004679 };
+		inline constexpr REL::ID NiDirectionalLight{ 958220 };
+		inline constexpr REL::ID NiExtraData{ 1008264 };
+		inline constexpr REL::ID NiExtraDataController{ 1363100 };
+		inline constexpr REL::ID NiFile{ 1569056 };
+		inline constexpr REL::ID NiFloatController{ 1431242 };
+		inline constexpr REL::ID NiFloatData{ 1526093 };
+		inline constexpr REL::ID NiFloatExtraData{ 823774 };
+		inline constexpr REL::ID NiFloatExtraDataController{ 1409801 };
+		inline constexpr REL::ID NiFloatInterpController{ 926901 };
+		inline constexpr REL::ID NiFloatInterpolator{ 340619 };
+		inline constexpr REL::ID NiFloatsExtraData{ 338262 };
+		inline constexpr REL::ID NiFloatsExtraDataController{ 170513 };
+		inline constexpr REL::ID NiFloatsExtraDataPoint3Controller{ 342908 };
+		inline constexpr REL::ID NiFogProperty{ 1435020 };
+		inline constexpr REL::ID NiFormArray{ 375647 };
+		inline constexpr REL::ID NiGeometry{ 944426 };
+		inline constexpr REL::ID NiGeometryData{ 363377 };
+		inline constexpr REL::ID NiHalfSpaceBV{ 1553117 };
+		inline constexpr REL::ID NiIntegerExtraData{ 881675 };
+		inline constexpr REL::ID NiIntegersExtraData{ 426072 };
+		inline constexpr REL::ID NiInterpController{ 480478 };
+		inline constexpr REL::ID NiInterpolator{ 1390684 };
+		inline constexpr REL::ID NiIntersector{ 741476 };
+		inline constexpr REL::ID NiKeyBasedInterpolator{ 74738 };
+		inline constexpr REL::ID NiKeyframeManager{ 515715 };
+		inline constexpr REL::ID NiLight{ 1488178 };
+		inline constexpr REL::ID NiLightColorController{ 1505985 };
+		inline constexpr REL::ID NiLightDimmerController{ 1193040 };
+		inline constexpr REL::ID NiLightRadiusController{ 880242 };
+		inline constexpr REL::ID NiLookAtController{ 833754 };
+		inline constexpr REL::ID NiLookAtInterpolator{ 787352 };
+		inline constexpr REL::ID NiMemStream{ 724540 };
+		inline constexpr REL::ID NiMeshPSysData{ 1181610 };
+		inline constexpr REL::ID NiMeshParticleSystem{ 537357 };
+		inline constexpr REL::ID NiMorphData{ 740785 };
+		inline constexpr REL::ID NiMultiTargetTransformController{ 527285 };
+		inline constexpr REL::ID NiNode{ 976765 };
+		inline constexpr REL::ID NiOBBLeaf{ 1558471 };
+		inline constexpr REL::ID NiOBBNode{ 681258 };
+		inline constexpr REL::ID NiOBBRoot{ 1226747 };
+		inline constexpr REL::ID NiObject{ 130882 };
+		inline constexpr REL::ID NiObjectNET{ 850736 };
+		inline constexpr REL::ID NiPSysAgeDeathModifier{ 1499961 };
+		inline constexpr REL::ID NiPSysAirFieldAirFrictionCtlr{ 1340348 };
+		inline constexpr REL::ID NiPSysAirFieldInheritVelocityCtlr{ 1247521 };
+		inline constexpr REL::ID NiPSysAirFieldModifier{ 276561 };
+		inline constexpr REL::ID NiPSysAirFieldSpreadCtlr{ 1546311 };
+		inline constexpr REL::ID NiPSysBombModifier{ 1453054 };
+		inline constexpr REL::ID NiPSysBoundUpdateModifier{ 1406104 };
+		inline constexpr REL::ID NiPSysBoxEmitter{ 1359412 };
+		inline constexpr REL::ID NiPSysCollider{ 1463805 };
+		inline constexpr REL::ID NiPSysColliderManager{ 1093670 };
+		inline constexpr REL::ID NiPSysColorModifier{ 1047043 };
+		inline constexpr REL::ID NiPSysCylinderEmitter{ 710450 };
+		inline constexpr REL::ID NiPSysData{ 789672 };
+		inline constexpr REL::ID NiPSysDragFieldModifier{ 1000237 };
+		inline constexpr REL::ID NiPSysDragModifier{ 953831 };
+		inline constexpr REL::ID NiPSysEmitter{ 93092 };
+		inline constexpr REL::ID NiPSysEmitterCtlr{ 1428240 };
+		inline constexpr REL::ID NiPSysEmitterCtlrData{ 688077 };
+		inline constexpr REL::ID NiPSysEmitterDeclinationCtlr{ 641395 };
+		inline constexpr REL::ID NiPSysEmitterDeclinationVarCtlr{ 814055 };
+		inline constexpr REL::ID NiPSysEmitterInitialRadiusCtlr{ 986436 };
+		inline constexpr REL::ID NiPSysEmitterLifeSpanCtlr{ 1159465 };
+		inline constexpr REL::ID NiPSysEmitterPlanarAngleCtlr{ 1112783 };
+		inline constexpr REL::ID NiPSysEmitterPlanarAngleVarCtlr{ 1285548 };
+		inline constexpr REL::ID NiPSysEmitterSpeedCtlr{ 1458370 };
+		inline constexpr REL::ID NiPSysFieldAttenuationCtlr{ 1411414 };
+		inline constexpr REL::ID NiPSysFieldMagnitudeCtlr{ 1540 };
+		inline constexpr REL::ID NiPSysFieldMaxDistanceCtlr{ 1537918 };
+		inline constexpr REL::ID NiPSysFieldModifier{ 9988 };
+		inline constexpr REL::ID NiPSysGravityFieldModifier{ 128239 };
+		inline constexpr REL::ID NiPSysGravityModifier{ 896494 };
+		inline constexpr REL::ID NiPSysGravityStrengthCtlr{ 300891 };
+		inline constexpr REL::ID NiPSysGrowFadeModifier{ 254495 };
+		inline constexpr REL::ID NiPSysInitialRotAngleCtlr{ 207928 };
+		inline constexpr REL::ID NiPSysInitialRotAngleVarCtlr{ 161313 };
+		inline constexpr REL::ID NiPSysInitialRotSpeedCtlr{ 333923 };
+		inline constexpr REL::ID NiPSysInitialRotSpeedVarCtlr{ 287103 };
+		inline constexpr REL::ID NiPSysMeshEmitter{ 578575 };
+		inline constexpr REL::ID NiPSysMeshUpdateModifier{ 584020 };
+		inline constexpr REL::ID NiPSysModifier{ 1189971 };
+		inline constexpr REL::ID NiPSysModifierActiveCtlr{ 459694 };
+		inline constexpr REL::ID NiPSysModifierBoolCtlr{ 194333 };
+		inline constexpr REL::ID NiPSysModifierCtlr{ 943014 };
+		inline constexpr REL::ID NiPSysModifierFloatCtlr{ 1293882 };
+		inline constexpr REL::ID NiPSysPlanarCollider{ 147449 };
+		inline constexpr REL::ID NiPSysPositionModifier{ 1197828 };
+		inline constexpr REL::ID NiPSysRadialFieldModifier{ 1150917 };
+		inline constexpr REL::ID NiPSysResetOnLoopCtlr{ 1104377 };
+		inline constexpr REL::ID NiPSysRotationModifier{ 1057666 };
+		inline constexpr REL::ID NiPSysSpawnModifier{ 1010994 };
+		inline constexpr REL::ID NiPSysSphereEmitter{ 964470 };
+		inline constexpr REL::ID NiPSysSphericalCollider{ 917828 };
+		inline constexpr REL::ID NiPSysTurbulenceFieldModifier{ 871104 };
+		inline constexpr REL::ID NiPSysUpdateCtlr{ 23864 };
+		inline constexpr REL::ID NiPSysVolumeEmitter{ 443680 };
+		inline constexpr REL::ID NiPSysVortexFieldModifier{ 1043938 };
+		inline constexpr REL::ID NiParticleMeshes{ 856570 };
+		inline constexpr REL::ID NiParticleMeshesData{ 903241 };
+		inline constexpr REL::ID NiParticleSystem{ 844468 };
+		inline constexpr REL::ID NiParticles{ 788784 };
+		inline constexpr REL::ID NiParticlesData{ 1169238 };
+		inline constexpr REL::ID NiPathController{ 208673 };
+		inline constexpr REL::ID NiPathInterpolator{ 13852 };
+		inline constexpr REL::ID NiPick__Results{ 1048456 };
+		inline constexpr REL::ID NiPoint3InterpController{ 1239814 };
+		inline constexpr REL::ID NiPoint3Interpolator{ 1524929 };
+		inline constexpr REL::ID NiPointLight{ 577839 };
+		inline constexpr REL::ID NiPosData{ 719472 };
+		inline constexpr REL::ID NiProperty{ 1302474 };
+		inline constexpr REL::ID NiQuaternionInterpolator{ 1478437 };
+		inline constexpr REL::ID NiRefObject{ 616414 };
+		inline constexpr REL::ID NiRollController{ 946047 };
+		inline constexpr REL::ID NiRotData{ 680566 };
+		inline constexpr REL::ID NiSearchPath{ 1209770 };
+		inline constexpr REL::ID NiSequence{ 195026 };
+		inline constexpr REL::ID NiSequenceStreamHelper{ 1450687 };
+		inline constexpr REL::ID NiShadeProperty{ 930696 };
+		inline constexpr REL::ID NiSingleInterpController{ 1078246 };
+		inline constexpr REL::ID NiSkinData{ 99862 };
+		inline constexpr REL::ID NiSkinInstance{ 1415878 };
+		inline constexpr REL::ID NiSkinPartition{ 365766 };
+		inline constexpr REL::ID NiSphereBV{ 1067427 };
+		inline constexpr REL::ID NiSphereTriIntersector{ 946762 };
+		inline constexpr REL::ID NiSpotLight{ 590824 };
+		inline constexpr REL::ID NiStandardAllocator{ 1475858 };
+		inline constexpr REL::ID NiStream{ 451332 };
+		inline constexpr REL::ID NiStringExtraData{ 64616 };
+		inline constexpr REL::ID NiStringPalette{ 1184636 };
+		inline constexpr REL::ID NiStringsExtraData{ 105275 };
+		inline constexpr REL::ID NiSwitchNode{ 171912 };
+		inline constexpr REL::ID NiSwitchStringExtraData{ 1421226 };
+		inline constexpr REL::ID NiTArray_BGSAddonNode_NiTMallocInterface_BGSAddonNode__{ 984154 };
+		inline constexpr REL::ID NiTArray_BGSCameraPath_NiTMallocInterface_BGSCameraPath__{ 534776 };
+		inline constexpr REL::ID NiTArray_BSAnimNoteListener__BSAnimReceiverType_NiTMallocInterface_BSAnimNoteListener__BSAnimReceiverType__{ 598469 };
+		inline constexpr REL::ID NiTArray_BSGraphics__TextureFilterMode_NiTMallocInterface_BSGraphics__TextureFilterMode__{ 1095951 };
+		inline constexpr REL::ID NiTArray_CombatGroup_NiTMallocInterface_CombatGroup__{ 1399700 };
+		inline constexpr REL::ID NiTArray_ImageSpaceEffectParam_NiTMallocInterface_ImageSpaceEffectParam__{ 1433711 };
+		inline constexpr REL::ID NiTArray_ImageSpaceEffect_NiTMallocInterface_ImageSpaceEffect__{ 1407397 };
+		inline constexpr REL::ID NiTArray_ImageSpaceEffect__EffectInput_NiTMallocInterface_ImageSpaceEffect__EffectInput__{ 888183 };
+		inline constexpr REL::ID NiTArray_ImageSpaceTexture_NiTMallocInterface_ImageSpaceTexture__{ 369862 };
+		inline constexpr REL::ID NiTArray_NiAVObject_NiTMallocInterface_NiAVObject__{ 930194 };
+		inline constexpr REL::ID NiTArray_NiBoundingVolume_NiTMallocInterface_NiBoundingVolume__{ 801745 };
+		inline constexpr REL::ID NiTArray_NiPick__Record_NiTScrapHeapInterface_NiPick__Record__{ 736159 };
+		inline constexpr REL::ID NiTArray_NiPointer_BSTriShape__NiTNewInterface_NiPointer_BSTriShape___{ 1535602 };
+		inline constexpr REL::ID NiTArray_NiPointer_NiAVObject__NiTMallocInterface_NiPointer_NiAVObject___{ 1371782 };
+		inline constexpr REL::ID NiTArray_NiPointer_NiAVObject__NiTNewInterface_NiPointer_NiAVObject___{ 199362 };
+		inline constexpr REL::ID NiTArray_NiPointer_NiControllerSequence__NiTNewInterface_NiPointer_NiControllerSequence___{ 55462 };
+		inline constexpr REL::ID NiTArray_NiPointer_NiGeometry__NiTNewInterface_NiPointer_NiGeometry___{ 471216 };
+		inline constexpr REL::ID NiTArray_NiPointer_NiTexture__NiTNewInterface_NiPointer_NiTexture___{ 577777 };
+		inline constexpr REL::ID NiTArray_NiPointer_NiTransformController__NiTNewInterface_NiPointer_NiTransformController___{ 885734 };
+		inline constexpr REL::ID NiTArray_NiTObjectArray_NiPointer_NiAVObject___NiTMallocInterface_NiTObjectArray_NiPointer_NiAVObject____{ 164284 };
+		inline constexpr REL::ID NiTArray_TESObjectCELL_NiTMallocInterface_TESObjectCELL__{ 625306 };
+		inline constexpr REL::ID NiTArray_bool_NiTMallocInterface_bool__{ 938486 };
+		inline constexpr REL::ID NiTArray_char_NiTMallocInterface_char__{ 1245127 };
+		inline constexpr REL::ID NiTArray_int_NiTMallocInterface_int__{ 967605 };
+		inline constexpr REL::ID NiTArray_unsignedint_NiTMallocInterface_unsignedint__{ 504364 };
+		inline constexpr REL::ID NiTArray_void___NiStream_NiObject__NiTMallocInterface_void___NiStream_NiObject___{ 234498 };
+		inline constexpr REL::ID NiTLargeArray_BSFixedString_NiTNewInterface_BSFixedString__{ 1232735 };
+		inline constexpr REL::ID NiTLargeArray_NiPointer_NiObject__NiTNewInterface_NiPointer_NiObject___{ 368811 };
+		inline constexpr REL::ID NiTLargeArray_TESForm_NiTMallocInterface_TESForm__{ 282304 };
+		inline constexpr REL::ID NiTLargeArray_unsignedint_NiTMallocInterface_unsignedint__{ 448121 };
+		inline constexpr REL::ID NiTLargeObjectArray_BSFixedString_{ 840536 };
+		inline constexpr REL::ID NiTLargeObjectArray_NiPointer_NiObject__{ 1339412 };
+		inline constexpr REL::ID NiTLargePrimitiveArray_TESForm_{ 1472751 };
+		inline constexpr REL::ID NiTLargePrimitiveArray_unsignedint_{ 275650 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5_____BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___{ 288271 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___unsignedint___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___unsignedint_{ 729443 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_ENUM_FORM_ID_BSSimpleList_SavedFormData____ENUM_FORM_ID_BSSimpleList_SavedFormData__{ 1521990 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_TESFile_TESWorldSpace__OFFSET_DATA___TESFile_TESWorldSpace__OFFSET_DATA_{ 1546750 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_TESForm_bool___TESForm_bool_{ 1337313 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_charconst_IDLE_ANIM_ROOT___charconst_IDLE_ANIM_ROOT_{ 569175 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_unsignedint_TESFile___unsignedint_TESFile_{ 1302239 };
+		inline constexpr REL::ID NiTMapBase_DFALL_NiTMapItem_unsignedint_unsignedchar___unsignedint_unsignedchar_{ 19225 };
+		inline constexpr REL::ID NiTMapBase_NiTPointerAllocator_unsigned__int64__BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___WadingWaterData_{ 33529 };
+		inline constexpr REL::ID NiTMapBase_NiTPointerAllocator_unsigned__int64__NiObjectconst_unsignedint_{ 873254 };
+		inline constexpr REL::ID NiTMapBase_NiTPointerAllocator_unsigned__int64__charconst_NiObject___void__{ 155051 };
+		inline constexpr REL::ID NiTMapBase_NiTPointerAllocator_unsigned__int64__charconst_NiPointer_NiSequence__{ 236113 };
+		inline constexpr REL::ID NiTMapBase_NiTPointerAllocator_unsigned__int64__charconst_unsignedshort_{ 659646 };
+		inline constexpr REL::ID NiTMap_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___{ 381610 };
+		inline constexpr REL::ID NiTMap_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___unsignedint_{ 822404 };
+		inline constexpr REL::ID NiTMap_ENUM_FORM_ID_BSSimpleList_SavedFormData__{ 471258 };
+		inline constexpr REL::ID NiTMap_TESFile_TESWorldSpace__OFFSET_DATA_{ 935104 };
+		inline constexpr REL::ID NiTMap_TESForm_bool_{ 1383990 };
+		inline constexpr REL::ID NiTMap_charconst_IDLE_ANIM_ROOT_{ 615781 };
+		inline constexpr REL::ID NiTMap_unsignedint_TESFile_{ 1348783 };
+		inline constexpr REL::ID NiTMap_unsignedint_unsignedchar_{ 285567 };
+		inline constexpr REL::ID NiTObjectArray_NiPointer_BSTriShape__{ 923831 };
+		inline constexpr REL::ID NiTObjectArray_NiPointer_NiAVObject__{ 1169903 };
+		inline constexpr REL::ID NiTObjectArray_NiPointer_NiControllerSequence__{ 1026131 };
+		inline constexpr REL::ID NiTObjectArray_NiPointer_NiGeometry__{ 1442174 };
+		inline constexpr REL::ID NiTObjectArray_NiPointer_NiTexture__{ 1548544 };
+		inline constexpr REL::ID NiTObjectArray_NiPointer_NiTransformController__{ 274267 };
+		inline constexpr REL::ID NiTPointerMap_BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___WadingWaterData_{ 1270639 };
+		inline constexpr REL::ID NiTPointerMap_NiObjectconst_unsignedint_{ 701089 };
+		inline constexpr REL::ID NiTPointerMap_charconst_NiObject___void__{ 1564669 };
+		inline constexpr REL::ID NiTPointerMap_charconst_NiPointer_NiSequence__{ 1206954 };
+		inline constexpr REL::ID NiTPointerMap_charconst_unsignedshort_{ 706447 };
+		inline constexpr REL::ID NiTPrimitiveArray_BGSAddonNode_{ 811793 };
+		inline constexpr REL::ID NiTPrimitiveArray_BGSCameraPath_{ 142466 };
+		inline constexpr REL::ID NiTPrimitiveArray_BSAnimNoteListener__BSAnimReceiverType_{ 1130155 };
+		inline constexpr REL::ID NiTPrimitiveArray_BSGraphics__TextureFilterMode_{ 484374 };
+		inline constexpr REL::ID NiTPrimitiveArray_CombatGroup_{ 1227322 };
+		inline constexpr REL::ID NiTPrimitiveArray_ImageSpaceEffectParam_{ 822494 };
+		inline constexpr REL::ID NiTPrimitiveArray_ImageSpaceEffect_{ 796401 };
+		inline constexpr REL::ID NiTPrimitiveArray_ImageSpaceEffect__EffectInput_{ 276704 };
+		inline constexpr REL::ID NiTPrimitiveArray_ImageSpaceTexture_{ 1340486 };
+		inline constexpr REL::ID NiTPrimitiveArray_NiAVObject_{ 757770 };
+		inline constexpr REL::ID NiTPrimitiveArray_NiBoundingVolume_{ 2936 };
+		inline constexpr REL::ID NiTPrimitiveArray_NiPointer_NiAVObject__{ 760743 };
+		inline constexpr REL::ID NiTPrimitiveArray_NiTObjectArray_NiPointer_NiAVObject___{ 696573 };
+		inline constexpr REL::ID NiTPrimitiveArray_TESObjectCELL_{ 452106 };
+		inline constexpr REL::ID NiTPrimitiveArray_bool_{ 1204763 };
+		inline constexpr REL::ID NiTPrimitiveArray_char_{ 1291581 };
+		inline constexpr REL::ID NiTPrimitiveArray_int_{ 1233767 };
+		inline constexpr REL::ID NiTPrimitiveArray_unsignedint_{ 770533 };
+		inline constexpr REL::ID NiTPrimitiveArray_void___NiStream_NiObject__{ 1205307 };
+		inline constexpr REL::ID NiTScrapArray_NiPick__Record_{ 563205 };
+		inline constexpr REL::ID NiTStringMap_IDLE_ANIM_ROOT_{ 755791 };
+		inline constexpr REL::ID NiTStringPointerMap_NiObject___void__{ 1485265 };
+		inline constexpr REL::ID NiTStringPointerMap_NiPointer_NiSequence__{ 249806 };
+		inline constexpr REL::ID NiTStringPointerMap_unsignedshort_{ 579995 };
+		inline constexpr REL::ID NiTStringTemplateMap_NiTMap_charconst_IDLE_ANIM_ROOT__IDLE_ANIM_ROOT_{ 928225 };
+		inline constexpr REL::ID NiTStringTemplateMap_NiTPointerMap_charconst_NiObject___void___NiObject___void__{ 75457 };
+		inline constexpr REL::ID NiTStringTemplateMap_NiTPointerMap_charconst_NiPointer_NiSequence___NiPointer_NiSequence__{ 861181 };
+		inline constexpr REL::ID NiTStringTemplateMap_NiTPointerMap_charconst_unsignedshort__unsignedshort_{ 313858 };
+		inline constexpr REL::ID NiTextKeyExtraData{ 699718 };
+		inline constexpr REL::ID NiTextKeyMatch{ 1012380 };
+		inline constexpr REL::ID NiTexture{ 1189054 };
+		inline constexpr REL::ID NiTimeController{ 655277 };
+		inline constexpr REL::ID NiTransformController{ 785013 };
+		inline constexpr REL::ID NiTransformData{ 1149276 };
+		inline constexpr REL::ID NiTransformInterpolator{ 1031518 };
+		inline constexpr REL::ID NiTriBasedGeom{ 1429650 };
+		inline constexpr REL::ID NiTriBasedGeomData{ 889468 };
+		inline constexpr REL::ID NiTriShape{ 332987 };
+		inline constexpr REL::ID NiTriShapeData{ 1374615 };
+		inline constexpr REL::ID NiTriStrips{ 576917 };
+		inline constexpr REL::ID NiTriStripsData{ 842893 };
+		inline constexpr REL::ID NiUVData{ 432922 };
+		inline constexpr REL::ID NiUnionBV{ 488841 };
+		inline constexpr REL::ID NiVectorExtraData{ 310815 };
+		inline constexpr REL::ID NiVisController{ 1316679 };
+		inline constexpr REL::ID NightEyeEffect{ 676509 };
+		inline constexpr REL::ID NoInitializationPolicy_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ 1536261 };
+		inline constexpr REL::ID NonActorMagicCaster{ 1183763 };
+		inline constexpr REL::ID NonActorMagicTarget{ 296644 };
+		inline constexpr REL::ID NullMovementSelectIdleResult{ 44417 };
+		inline constexpr REL::ID NullMovementState{ 161554 };
+		inline constexpr REL::ID NullPathBuilderTracker{ 529139 };
+		inline constexpr REL::ID nsBarterMenu__CancelTradeInProgressCallback{ 691233 };
+		inline constexpr REL::ID nsBarterMenu__ConfirmInvestmentCallback{ 989475 };
+		inline constexpr REL::ID nsBarterMenu__ConfirmTradeCallback{ 1082991 };
+		inline constexpr REL::ID nsBarterMenu__HideMenuCallback{ 1036289 };
+		inline constexpr REL::ID nsBarterMenu__ValidFunc{ 564925 };
+		inline constexpr REL::ID nsBarterMenu__VendorCapsTooLowCallback{ 298641 };
+		inline constexpr REL::ID nsContainerMenu__CanPickPocketAliasChecker{ 860425 };
+		inline constexpr REL::ID nsContainerMenu__ConfirmTakeAllTheThingsCallback{ 249062 };
+		inline constexpr REL::ID nsContainerMenu__ValidFunc{ 1033134 };
+		inline constexpr REL::ID nsInventory3DManager__NewInventoryMenuItemLoadTask{ 1311839 };
+		inline constexpr REL::ID nsInventory3DManager__NewInventoryMenuItemMaterialSwapMaterialLoadTask{ 700560 };
+		inline constexpr REL::ID nsInventory3DManager__NewInventoryMenuItemMaterialSwapTextureLoadTask{ 74912 };
+		inline constexpr REL::ID nsInventory3DManager__WorkshopMenuItemLoadTask{ 341146 };
+		inline constexpr REL::ID nsLevelUpMenu__LevelUpPromptRequest{ 835461 };
+		inline constexpr REL::ID nsMainMenu__DLCChanged_ConfirmResetCallback{ 628521 };
+		inline constexpr REL::ID nsMainMenu__DeviceSelectCallback{ 282738 };
+		inline constexpr REL::ID nsMainMenu__NoDurangoUserSignedInCallback{ 236289 };
+		inline constexpr REL::ID nsPauseMenu__UserDisengagedCallback{ 1209580 };
+		inline constexpr REL::ID nsPlayBinkMenu__InitDataMessage{ 1090872 };
+		inline constexpr REL::ID nsSPECIALMenu__ConfirmResetPointsCallback{ 1386567 };
+		inline constexpr REL::ID nsStartMenu_InputMapping__RemapHandler{ 1452620 };
+		inline constexpr REL::ID nsUIDebug__UIDebugLogger_NoOp{ 774229 };
+		inline constexpr REL::ID nsWS_Caravan__MessageData{ 1191201 };
+		inline constexpr REL::ID nsWorkshopMenu__WorkshopMenuPromptRequest{ 1330908 };
+	}
+}
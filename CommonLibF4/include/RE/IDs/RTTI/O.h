@@ -0,0 +1,15 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID ObjectListItem{ 978881 };
+		inline constexpr REL::ID ObstacleTaskData{ 1364689 };
+		inline constexpr REL::ID OpenBarterMenuMessage{ 93169 };
+		inline constexpr REL::ID OpenContainerMenuMessage{ 781221 };
+		inline constexpr REL::ID OpenEffect{ 536506 };
+		inline constexpr REL::ID OwnedCameraEffectController{ 708554 };
+		inline constexpr REL::ID OwnedController{ 1143540 };
+	}
+}
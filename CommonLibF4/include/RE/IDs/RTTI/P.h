@@ -0,0 +1,175 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID PArrayPoint{ 1512157 };
+		inline constexpr REL::ID PackageCreator{ 861171 };
+		inline constexpr REL::ID PackageList__IPackageVisitor{ 1310394 };
+		inline constexpr REL::ID PackageLocation{ 68674 };
+		inline constexpr REL::ID PairedAttackDialogueHandler{ 1444005 };
+		inline constexpr REL::ID PairedStopHandler{ 26418 };
+		inline constexpr REL::ID ParalysisEffect{ 3676 };
+		inline constexpr REL::ID PassengerInteraction{ 1487206 };
+		inline constexpr REL::ID PathBuilderFlee__PathBuilderFleePath{ 1252977 };
+		inline constexpr REL::ID PathBuilderFlight__PathBuilderFlyActionPath{ 833259 };
+		inline constexpr REL::ID PathBuilderFlight__PathBuilderFlyHoverPath{ 208144 };
+		inline constexpr REL::ID PathBuilderFlight__PathBuilderFlyLandPath{ 1244628 };
+		inline constexpr REL::ID PathBuilderFlight__PathBuilderFlyOrbitPath{ 726594 };
+		inline constexpr REL::ID PathBuilderFlight__PathBuilderFlyPath{ 95587 };
+		inline constexpr REL::ID PathBuilderFlight__PathBuilderFlyTakeOffPath{ 619373 };
+		inline constexpr REL::ID PathBuilderHide__PathBuilderHidePath{ 1529773 };
+		inline constexpr REL::ID PathBuilderLOS__PathBuilderLOSPath{ 418797 };
+		inline constexpr REL::ID PathBuilderOptimalLocation__PathBuilderOptimalLocationPath{ 405086 };
+		inline constexpr REL::ID PathBuilderSafeStraightLine__PathBuilderSafeStraightLinePath{ 830223 };
+		inline constexpr REL::ID PathFollowerStateFollowPathToParameter{ 605328 };
+		inline constexpr REL::ID PathFollowerStateKeepLastDirection{ 731736 };
+		inline constexpr REL::ID PathFollowerStatePlayIdle{ 1183928 };
+		inline constexpr REL::ID PathFollowerStateShortcut{ 1076830 };
+		inline constexpr REL::ID PathFollowerStateTurnToAngle{ 764477 };
+		inline constexpr REL::ID PathManagerPositionPlayerAdapter{ 1103931 };
+		inline constexpr REL::ID PathSmootherRayCastUsePreferredTris{ 82883 };
+		inline constexpr REL::ID PathSmootherRayCastUseTrianglePath{ 255607 };
+		inline constexpr REL::ID Pathing{ 161305 };
+		inline constexpr REL::ID PathingCell{ 1375505 };
+		inline constexpr REL::ID PathingCoverLocation{ 786620 };
+		inline constexpr REL::ID PathingDoor{ 1348045 };
+		inline constexpr REL::ID PathingLockData{ 396509 };
+		inline constexpr REL::ID PathingNumericIDVisitor{ 1512862 };
+		inline constexpr REL::ID PathingRequest{ 778238 };
+		inline constexpr REL::ID PathingRequestClosePoint{ 1043925 };
+		inline constexpr REL::ID PathingRequestClosestGoal{ 1076142 };
+		inline constexpr REL::ID PathingRequestClosestGoal__PathBuilder{ 30889 };
+		inline constexpr REL::ID PathingRequestCover{ 643006 };
+		inline constexpr REL::ID PathingRequestFlee{ 615409 };
+		inline constexpr REL::ID PathingRequestFly{ 587989 };
+		inline constexpr REL::ID PathingRequestFlyAction{ 121525 };
+		inline constexpr REL::ID PathingRequestFlyHover{ 971367 };
+		inline constexpr REL::ID PathingRequestFlyLand{ 239262 };
+		inline constexpr REL::ID PathingRequestFlyOrbit{ 650673 };
+		inline constexpr REL::ID PathingRequestFlyTakeOff{ 1500911 };
+		inline constexpr REL::ID PathingRequestHide{ 987344 };
+		inline constexpr REL::ID PathingRequestLOS{ 741004 };
+		inline constexpr REL::ID PathingRequestOptimalLocation{ 274482 };
+		inline constexpr REL::ID PathingRequestRotate{ 1343608 };
+		inline constexpr REL::ID PathingRequestSafeStraightLine{ 1090556 };
+		inline constexpr REL::ID PathingRequestStopMoving{ 850019 };
+		inline constexpr REL::ID PathingSpace{ 341496 };
+		inline constexpr REL::ID PathingStreamLoadGame{ 1023342 };
+		inline constexpr REL::ID PathingStreamMasterFileRead{ 854942 };
+		inline constexpr REL::ID PathingStreamSaveGame{ 757775 };
+		inline constexpr REL::ID PatrolActorPackageData{ 405827 };
+		inline constexpr REL::ID PauseMenu{ 1302510 };
+		inline constexpr REL::ID PeakValueModifierEffect{ 1101264 };
+		inline constexpr REL::ID PerformActivationHandler{ 1424714 };
+		inline constexpr REL::ID PerkEntryVisitor{ 1206581 };
+		inline constexpr REL::ID PerkRankVisitor{ 1000278 };
+		inline constexpr REL::ID PickNewIdleHandler{ 1356596 };
+		inline constexpr REL::ID PipboyArray{ 566085 };
+		inline constexpr REL::ID PipboyBootSequenceHandler{ 893030 };
+		inline constexpr REL::ID PipboyCommand{ 1384381 };
+		inline constexpr REL::ID PipboyCommandResult{ 1543641 };
+		inline constexpr REL::ID PipboyCompanionService{ 377880 };
+		inline constexpr REL::ID PipboyDataGroup{ 80580 };
+		inline constexpr REL::ID PipboyHandler{ 18689 };
+		inline constexpr REL::ID PipboyHolotapeMenu{ 150874 };
+		inline constexpr REL::ID PipboyInventoryData{ 507835 };
+		inline constexpr REL::ID PipboyInventoryMenu{ 1253073 };
+		inline constexpr REL::ID PipboyLogData{ 460908 };
+		inline constexpr REL::ID PipboyLogData__PopulateStatsVisitor{ 1558298 };
+		inline constexpr REL::ID PipboyLogMenu{ 622430 };
+		inline constexpr REL::ID PipboyManager{ 312944 };
+		inline constexpr REL::ID PipboyMapData{ 337414 };
+		inline constexpr REL::ID PipboyMapMenu{ 29603 };
+		inline constexpr REL::ID PipboyMenu{ 1192619 };
+		inline constexpr REL::ID PipboyObject{ 759646 };
+		inline constexpr REL::ID PipboyOpeningSequenceMenu{ 843862 };
+		inline constexpr REL::ID PipboyPerksData{ 885546 };
+		inline constexpr REL::ID PipboyPerksMenu{ 1272120 };
+		inline constexpr REL::ID PipboyPlayerInfoData{ 605892 };
+		inline constexpr REL::ID PipboyPlayerInfoMenu{ 68272 };
+		inline constexpr REL::ID PipboyPrimitiveThrottledValue_bool_{ 329051 };
+		inline constexpr REL::ID PipboyPrimitiveThrottledValue_float_{ 422173 };
+		inline constexpr REL::ID PipboyPrimitiveThrottledValue_unsignedchar_{ 375713 };
+		inline constexpr REL::ID PipboyPrimitiveValue_BGSLocalizedString_{ 477243 };
+		inline constexpr REL::ID PipboyPrimitiveValue_BSFixedStringCS_{ 1398896 };
+		inline constexpr REL::ID PipboyPrimitiveValue_BSFixedString_{ 573046 };
+		inline constexpr REL::ID PipboyPrimitiveValue_BSStringT_char_1_DynamicMemoryManagementPol__{ 1009146 };
+		inline constexpr REL::ID PipboyPrimitiveValue_bool_{ 1572135 };
+		inline constexpr REL::ID PipboyPrimitiveValue_char_{ 871636 };
+		inline constexpr REL::ID PipboyPrimitiveValue_float_{ 774143 };
+		inline constexpr REL::ID PipboyPrimitiveValue_int_{ 1305765 };
+		inline constexpr REL::ID PipboyPrimitiveValue_unsignedchar_{ 869239 };
+		inline constexpr REL::ID PipboyPrimitiveValue_unsignedint_{ 1039751 };
+		inline constexpr REL::ID PipboyQuestData{ 745899 };
+		inline constexpr REL::ID PipboyQuestMenu{ 1397988 };
+		inline constexpr REL::ID PipboyRadioData{ 224545 };
+		inline constexpr REL::ID PipboyRadioMenu{ 1524532 };
+		inline constexpr REL::ID PipboySpecialData{ 1302010 };
+		inline constexpr REL::ID PipboySpecialMenu{ 413494 };
+		inline constexpr REL::ID PipboyStatsData{ 18352 };
+		inline constexpr REL::ID PipboyStatsMenu{ 540001 };
+		inline constexpr REL::ID PipboyStatusData{ 364140 };
+		inline constexpr REL::ID PipboySubMenu{ 136950 };
+		inline constexpr REL::ID PipboyValue{ 1051269 };
+		inline constexpr REL::ID PipboyWorkshopData{ 490268 };
+		inline constexpr REL::ID PipboyWorkshopMenu{ 1277453 };
+		inline constexpr REL::ID PitchOverrideEndHandler{ 696087 };
+		inline constexpr REL::ID PitchOverrideStartHandler{ 961626 };
+		inline constexpr REL::ID PlayBinkMenu{ 1184241 };
+		inline constexpr REL::ID PlayerBedEnterHandler{ 986663 };
+		inline constexpr REL::ID PlayerCamera{ 175785 };
+		inline constexpr REL::ID PlayerCameraTransitionState{ 1464459 };
+		inline constexpr REL::ID PlayerChairEnterHandler{ 202785 };
+		inline constexpr REL::ID PlayerCharacter{ 411602 };
+		inline constexpr REL::ID PlayerControllerXRawChannel_Actor_float_{ 1053109 };
+		inline constexpr REL::ID PlayerControllerXSmoothedChannel_Actor_float_{ 973453 };
+		inline constexpr REL::ID PlayerControllerXSumChannel_Actor_float_{ 735452 };
+		inline constexpr REL::ID PlayerControllerYRawChannel_Actor_float_{ 694225 };
+		inline constexpr REL::ID PlayerControllerYSmoothedChannel_Actor_float_{ 455106 };
+		inline constexpr REL::ID PlayerControllerYSumChannel_Actor_float_{ 375891 };
+		inline constexpr REL::ID PlayerControls{ 296441 };
+		inline constexpr REL::ID PlayerDirectionSmoothedChannel_Actor_float_{ 137356 };
+		inline constexpr REL::ID PlayerFastEquipSoundHandler{ 366215 };
+		inline constexpr REL::ID PlayerFirstSpeedSmoothedChannel_Actor_float_{ 655943 };
+		inline constexpr REL::ID PlayerFurnitureExitHandler{ 189194 };
+		inline constexpr REL::ID PlayerInputHandler{ 1047976 };
+		inline constexpr REL::ID PlayerPitchDeltaSmoothedChannel_Actor_float_{ 57800 };
+		inline constexpr REL::ID PlayerRegionState{ 465822 };
+		inline constexpr REL::ID PlayerSightedStateChangeHandler{ 243195 };
+		inline constexpr REL::ID PlayerSleepWaitMovementControllerAdapter{ 1230166 };
+		inline constexpr REL::ID PlayerSleepWaitMovementControllerAdapter__SwitchToLoadedSetControllerFunctor{ 1402692 };
+		inline constexpr REL::ID PlayerSleepWaitMovementControllerAdapter__SwitchToUnloadedSetControllerFunctor{ 1309486 };
+		inline constexpr REL::ID PlayerSneakStateChangeHandler{ 434787 };
+		inline constexpr REL::ID PlayerTerminalEnterHandler{ 1519132 };
+		inline constexpr REL::ID PointerArrayImplementation{ 1220822 };
+		inline constexpr REL::ID PowerArmorGeometry{ 317044 };
+		inline constexpr REL::ID PowerArmorHUDCompass{ 610678 };
+		inline constexpr REL::ID PowerArmorHUDMenu{ 242922 };
+		inline constexpr REL::ID PowerArmorHUDUtils__MainStatusHandler{ 14683 };
+		inline constexpr REL::ID PowerArmorModMenu{ 1348353 };
+		inline constexpr REL::ID PowerArmor__EventHandler{ 666989 };
+		inline constexpr REL::ID Precipitation{ 86922 };
+		inline constexpr REL::ID PrecomputedNavmeshInfoPathMap{ 309382 };
+		inline constexpr REL::ID PreloadResponsesInitializationPolicy_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ 1332610 };
+		inline constexpr REL::ID ProcessListMovementInterface{ 972747 };
+		inline constexpr REL::ID ProcessLists{ 781276 };
+		inline constexpr REL::ID ProcessLists__GetActorsFilter{ 264994 };
+		inline constexpr REL::ID ProcessObjects{ 1316455 };
+		inline constexpr REL::ID ProcessObjects1{ 252598 };
+		inline constexpr REL::ID ProcessObjects2{ 1349202 };
+		inline constexpr REL::ID ProcessObjects3{ 863915 };
+		inline constexpr REL::ID ProcessObjects4{ 378649 };
+		inline constexpr REL::ID ProcessObjectsDecals{ 724545 };
+		inline constexpr REL::ID ProcessObjectsDetached{ 518604 };
+		inline constexpr REL::ID ProcessObjectsGrass{ 989905 };
+		inline constexpr REL::ID ProcessObjectsLOD{ 1475861 };
+		inline constexpr REL::ID ProcessObjectsLocal{ 1582734 };
+		inline constexpr REL::ID ProcessWeaponStrikeMagicFunctor{ 1165785 };
+		inline constexpr REL::ID Projectile{ 142037 };
+		inline constexpr REL::ID ProjectileLOSCollector{ 352765 };
+		inline constexpr REL::ID PromptMenu{ 284476 };
+		inline constexpr REL::ID PromptMenuData{ 1381191 };
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID QuestPathingRequest{ 980886 };
+		inline constexpr REL::ID QuestPathingRequestBuilder{ 1424977 };
+		inline constexpr REL::ID QueuedActor{ 27693 };
+		inline constexpr REL::ID QueuedAnimationObject{ 233838 };
+		inline constexpr REL::ID QueuedCharacter{ 154412 };
+		inline constexpr REL::ID QueuedFile{ 1398903 };
+		inline constexpr REL::ID QueuedHead{ 1251283 };
+		inline constexpr REL::ID QueuedModel{ 639804 };
+		inline constexpr REL::ID QueuedNamedFile{ 875809 };
+		inline constexpr REL::ID QueuedPlayer{ 252861 };
+		inline constexpr REL::ID QueuedPromoteLargeReferencesTask{ 1570441 };
+		inline constexpr REL::ID QueuedPromoteLocationReferencesTask{ 133140 };
+		inline constexpr REL::ID QueuedPromoteQuestTask{ 837397 };
+		inline constexpr REL::ID QueuedPromoteReferencesTask{ 225678 };
+		inline constexpr REL::ID QueuedReference{ 1124860 };
+		inline constexpr REL::ID QueuedTree{ 738510 };
+		inline constexpr REL::ID QuickSaveLoadHandler{ 159139 };
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID REFREventCallbacks__ConcreteEventCallbackFactory_TerminalRunResultsCallback_{ 944938 };
+		inline constexpr REL::ID REFREventCallbacks__ConcreteEventCallbackFactory___SceneActionResultsCallBack_{ 917480 };
+		inline constexpr REL::ID REFREventCallbacks__ConcreteEventCallbackFactory___ScenePhaseResultsCallBack_{ 1342356 };
+		inline constexpr REL::ID REFREventCallbacks__ConcreteEventCallbackFactory___SceneResultsCallBack_{ 693131 };
+		inline constexpr REL::ID REFREventCallbacks__ConcreteEventCallbackFactory___StageItemFinishedCallback_{ 417514 };
+		inline constexpr REL::ID REFREventCallbacks__ConcreteEventCallbackFactory___TopicResultCallBack_{ 1535468 };
+		inline constexpr REL::ID REFREventCallbacks__IEventCallback{ 1283635 };
+		inline constexpr REL::ID REFREventCallbacks__IEventCallbackFactory{ 1237164 };
+		inline constexpr REL::ID RagdollAndGetUpHandler{ 218793 };
+		inline constexpr REL::ID RagdollFurnitureModifier{ 43135 };
+		inline constexpr REL::ID RagdollStartHandler{ 1455592 };
+		inline constexpr REL::ID RallyEffect{ 1065204 };
+		inline constexpr REL::ID ReadyStateChangeHandler{ 1233153 };
+		inline constexpr REL::ID ReadyWeaponHandler{ 708312 };
+		inline constexpr REL::ID RealArrayImplementation{ 702776 };
+		inline constexpr REL::ID RealArrayView{ 389602 };
+		inline constexpr REL::ID ReanimateEffect{ 788827 };
+		inline constexpr REL::ID RecoilStopHandler{ 636219 };
+		inline constexpr REL::ID ReevaluateGraphStateHandler{ 122462 };
+		inline constexpr REL::ID RefAttachTechniqueInput{ 1359227 };
+		inline constexpr REL::ID RefHandleUIData{ 912154 };
+		inline constexpr REL::ID RefMatchFunctor{ 866685 };
+		inline constexpr REL::ID ReferenceEffect{ 330679 };
+		inline constexpr REL::ID ReferenceEffectController{ 1409312 };
+		inline constexpr REL::ID RefrInteraction{ 1221183 };
+		inline constexpr REL::ID RegSettingCollection{ 1129011 };
+		inline constexpr REL::ID RelaxedStateChangeHandler{ 183017 };
+		inline constexpr REL::ID ReloadCompleteHandler{ 775435 };
+		inline constexpr REL::ID ReloadStateChangeHandler{ 1041119 };
+		inline constexpr REL::ID RemoveCustomMapMarkerCommand{ 605760 };
+		inline constexpr REL::ID RemoveExtraFunctor{ 376136 };
+		inline constexpr REL::ID RemoveFavoriteFunctor{ 1538889 };
+		inline constexpr REL::ID RemoveOutfitItemsFunctor{ 1464948 };
+		inline constexpr REL::ID RemoveQuestAliasFunctor{ 381409 };
+		inline constexpr REL::ID RemoveRagdollHandler{ 139184 };
+		inline constexpr REL::ID Reset3DMobIterator{ 138607 };
+		inline constexpr REL::ID ResponseDefinitionMissPolicy_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ 375836 };
+		inline constexpr REL::ID RevertSelectedSpellFunctor{ 501008 };
+		inline constexpr REL::ID RightHandSpellCastHandler{ 669118 };
+		inline constexpr REL::ID RightHandSpellFireHandler{ 1467036 };
+		inline constexpr REL::ID RobotModMenu{ 490049 };
+		inline constexpr REL::ID RunHandler{ 1398593 };
+	}
+}
@@ -0,0 +1,445 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID SFRenderBufferManager{ 60768 };
+		inline constexpr REL::ID SPECIALMenu{ 289702 };
+		inline constexpr REL::ID SWFToCodeFunctionHandler{ 1376280 };
+		inline constexpr REL::ID SafeZoneMenu{ 841649 };
+		inline constexpr REL::ID SandManKillHandler{ 333443 };
+		inline constexpr REL::ID SaveGameMagicCasterVisitor{ 594564 };
+		inline constexpr REL::ID SaveLoadMagicCasterVisitor{ 641186 };
+		inline constexpr REL::ID SaveStorageWrapper{ 803419 };
+		inline constexpr REL::ID ScaleformFile__DBTraits{ 775143 };
+		inline constexpr REL::ID ScaleformFile__MemoryFile{ 215570 };
+		inline constexpr REL::ID Scaleform__AcquireInterface{ 785049 };
+		inline constexpr REL::ID Scaleform__File{ 363524 };
+		inline constexpr REL::ID Scaleform__FileConstants{ 270549 };
+		inline constexpr REL::ID Scaleform__GFx__FileOpener{ 1274111 };
+		inline constexpr REL::ID Scaleform__GFx__FileOpenerBase{ 1320542 };
+		inline constexpr REL::ID Scaleform__GFx__FunctionHandler{ 592511 };
+		inline constexpr REL::ID Scaleform__GFx__ImageCreator{ 422936 };
+		inline constexpr REL::ID Scaleform__GFx__State{ 1473 };
+		inline constexpr REL::ID Scaleform__GFx__Translator{ 473603 };
+		inline constexpr REL::ID Scaleform__GFx__Value{ 1518583 };
+		inline constexpr REL::ID Scaleform__GFx__Value__ObjectInterface__ArrVisitor{ 1164895 };
+		inline constexpr REL::ID Scaleform__GFx__ZlibSupport{ 161253 };
+		inline constexpr REL::ID Scaleform__GFx__ZlibSupportBase{ 207867 };
+		inline constexpr REL::ID Scaleform__Log{ 347425 };
+		inline constexpr REL::ID Scaleform__MemoryFile{ 3800 };
+		inline constexpr REL::ID Scaleform__NewOverrideBase_72_{ 451993 };
+		inline constexpr REL::ID Scaleform__RefCountBaseStatImpl_Scaleform__RefCountImpl_2_{ 1343461 };
+		inline constexpr REL::ID Scaleform__RefCountBaseStatImpl_Scaleform__RefCountImpl_72_{ 1203818 };
+		inline constexpr REL::ID Scaleform__RefCountBaseStatImpl_Scaleform__RefCountVImpl_3_{ 171120 };
+		inline constexpr REL::ID Scaleform__RefCountBaseV_Scaleform__Render__Image_3_{ 1141571 };
+		inline constexpr REL::ID Scaleform__RefCountBase_Scaleform__File_2_{ 1460694 };
+		inline constexpr REL::ID Scaleform__RefCountBase_Scaleform__GFx__FunctionHandler_2_{ 545913 };
+		inline constexpr REL::ID Scaleform__RefCountBase_Scaleform__GFx__State_2_{ 1318224 };
+		inline constexpr REL::ID Scaleform__RefCountBase_Scaleform__Log_2_{ 81607 };
+		inline constexpr REL::ID Scaleform__RefCountBase_Scaleform__Render__RenderBufferManager_72_{ 593032 };
+		inline constexpr REL::ID Scaleform__RefCountBase_Scaleform__Render__TextureManager_72_{ 205514 };
+		inline constexpr REL::ID Scaleform__RefCountImpl{ 1436765 };
+		inline constexpr REL::ID Scaleform__RefCountImplCore{ 1170919 };
+		inline constexpr REL::ID Scaleform__RefCountVImpl{ 1454346 };
+		inline constexpr REL::ID Scaleform__Render__D3D1x__MappedTexture{ 1143190 };
+		inline constexpr REL::ID Scaleform__Render__D3D1x__RenderTargetData{ 1315926 };
+		inline constexpr REL::ID Scaleform__Render__D3D1x__TextureManager{ 79303 };
+		inline constexpr REL::ID Scaleform__Render__Image{ 1001570 };
+		inline constexpr REL::ID Scaleform__Render__ImageBase{ 1188280 };
+		inline constexpr REL::ID Scaleform__Render__ImageUpdateSync{ 578508 };
+		inline constexpr REL::ID Scaleform__Render__MappedTextureBase{ 405545 };
+		inline constexpr REL::ID Scaleform__Render__RBGenericImpl__RenderBufferManager{ 1376820 };
+		inline constexpr REL::ID Scaleform__Render__RenderBufferManager{ 419928 };
+		inline constexpr REL::ID Scaleform__Render__RenderBuffer__RenderTargetData{ 751387 };
+		inline constexpr REL::ID Scaleform__Render__TextureImage{ 736049 };
+		inline constexpr REL::ID Scaleform__Render__TextureManager{ 252089 };
+		inline constexpr REL::ID Scaleform__SysAlloc{ 1409851 };
+		inline constexpr REL::ID Scaleform__SysAllocBase{ 93812 };
+		inline constexpr REL::ID Scaleform__SysAllocBase_SingletonSupport_Scaleform__SysAllocMalloc_Scaleform__SysAlloc_{ 1097517 };
+		inline constexpr REL::ID Scaleform__SysAllocMalloc{ 1144016 };
+		inline constexpr REL::ID Scaleform__SysAllocPaged{ 534261 };
+		inline constexpr REL::ID Scaleform__SysMemMapper{ 268197 };
+		inline constexpr REL::ID SceneGraph{ 783153 };
+		inline constexpr REL::ID ScopeMenu{ 210546 };
+		inline constexpr REL::ID ScopeMenuUtil__FadeCallback{ 257084 };
+		inline constexpr REL::ID ScrapHeap{ 804560 };
+		inline constexpr REL::ID ScreenshotHandler{ 989594 };
+		inline constexpr REL::ID Script{ 740077 };
+		inline constexpr REL::ID ScriptEffect{ 415325 };
+		inline constexpr REL::ID Script__ModifyFaceGen__29__ReplaceHeadTask{ 1079146 };
+		inline constexpr REL::ID Script__ResetDialogueFlags__2__MobDialogueFlagResetter{ 999485 };
+		inline constexpr REL::ID ScriptedRefEffect{ 1512686 };
+		inline constexpr REL::ID ScrollItem{ 1387502 };
+		inline constexpr REL::ID SeenData{ 113312 };
+		inline constexpr REL::ID SetCustomMapMarkerCommand{ 512394 };
+		inline constexpr REL::ID SetEnchantmentFunctor{ 787609 };
+		inline constexpr REL::ID SetFavoriteFunctor{ 222655 };
+		inline constexpr REL::ID SetItemOriginalReferenceFunctor{ 853081 };
+		inline constexpr REL::ID SetItemOwnershipFunctor{ 1119032 };
+		inline constexpr REL::ID SetPlayerHasTakenStackFunctor{ 422627 };
+		inline constexpr REL::ID SetPoisonFunctor{ 1272813 };
+		inline constexpr REL::ID SetQuickkeyCommand{ 857881 };
+		inline constexpr REL::ID SetTimeLeftFunctor{ 115465 };
+		inline constexpr REL::ID Setting{ 1190295 };
+		inline constexpr REL::ID SettingCollectionList_Setting_{ 485489 };
+		inline constexpr REL::ID SettingCollectionMap_Setting_{ 1036494 };
+		inline constexpr REL::ID SettingCollection_Setting_{ 658561 };
+		inline constexpr REL::ID SettingT_GameSettingCollection_{ 989716 };
+		inline constexpr REL::ID SettingT_INIPrefSettingCollection_{ 562575 };
+		inline constexpr REL::ID SettingT_INISettingCollection_{ 345506 };
+		inline constexpr REL::ID SettingT_RegSettingCollection_{ 863013 };
+		inline constexpr REL::ID ShaderReferenceEffect{ 1418969 };
+		inline constexpr REL::ID ShadowSceneNode{ 1411336 };
+		inline constexpr REL::ID SightedStateChangeHandler{ 509213 };
+		inline constexpr REL::ID SimpleAnimationGraphManagerHolder{ 801798 };
+		inline constexpr REL::ID SimpleAnimationGraphManagerLoadingTask{ 1253197 };
+		inline constexpr REL::ID SitWaitMenu{ 43455 };
+		inline constexpr REL::ID Sky{ 1175414 };
+		inline constexpr REL::ID SkyEffectController{ 423845 };
+		inline constexpr REL::ID SkyObject{ 931480 };
+		inline constexpr REL::ID SkyStaticFindFunctor{ 158141 };
+		inline constexpr REL::ID SleepWaitMenu{ 1266658 };
+		inline constexpr REL::ID SlowTimeEffect{ 1013140 };
+		inline constexpr REL::ID SneakHandler{ 913446 };
+		inline constexpr REL::ID SneakStateChangeHandler{ 701524 };
+		inline constexpr REL::ID SortInventoryCommand{ 1203560 };
+		inline constexpr REL::ID SoulTrapEffect{ 481240 };
+		inline constexpr REL::ID SpawnHazardEffect{ 111048 };
+		inline constexpr REL::ID SpecificItemCollector{ 613641 };
+		inline constexpr REL::ID SpectatorPackage{ 751679 };
+		inline constexpr REL::ID SpeedSampledAnimationSpeedContour{ 573085 };
+		inline constexpr REL::ID SpellItem{ 1413384 };
+		inline constexpr REL::ID SprintHandler{ 1193278 };
+		inline constexpr REL::ID StaggerEffect{ 819162 };
+		inline constexpr REL::ID StaggeredStopHandler{ 954040 };
+		inline constexpr REL::ID Stars{ 895651 };
+		inline constexpr REL::ID StartFloatingHandler{ 1255265 };
+		inline constexpr REL::ID StartMenuBase{ 598071 };
+		inline constexpr REL::ID StartPCapVoiceHandler{ 865255 };
+		inline constexpr REL::ID StaticAvoidNodeManager{ 633912 };
+		inline constexpr REL::ID StimpakEffect{ 1485305 };
+		inline constexpr REL::ID StopFloatingHandler{ 988952 };
+		inline constexpr REL::ID StopMountCameraHandler{ 292645 };
+		inline constexpr REL::ID StreamingInstallMenu{ 1098710 };
+		inline constexpr REL::ID StructArrayImplementation{ 455172 };
+		inline constexpr REL::ID StructArrayImplementation__Object{ 189739 };
+		inline constexpr REL::ID SubgraphAndOffsetDBData{ 179390 };
+		inline constexpr REL::ID SummonCreatureEffect{ 1032279 };
+		inline constexpr REL::ID SummonPlacementEffect{ 1298345 };
+		inline constexpr REL::ID Sun{ 1320485 };
+		inline constexpr REL::ID SyncDeferDeathHandler{ 898349 };
+		inline constexpr REL::ID SyncEarlyExitHandler{ 632498 };
+		inline constexpr REL::ID SyncQueueObj{ 735855 };
+		inline constexpr REL::ID SynchronizedAnimationSingleton{ 836559 };
+		inline constexpr REL::ID std___Bind_0_void__lambda_ffd3f5230f1f91b6b2078decebfc8bd4__std___Ph_1__TESObjectREFRconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1296573 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult__void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1565782 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator___void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 380662 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator___void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1019647 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 453660 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_BSPlatform__BNetResult_BSPlatform__BSUserContent__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_BSPlatform__BNetResult_BSPlatform__BSUserContent_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSPlatform__BSUserContent_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 878841 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1197056 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 119109 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 827014 };
+		inline constexpr REL::ID std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 333203 };
+		inline constexpr REL::ID std___Func_base_BSContainer__ForEachResult_BSFlattenedBoneTreeconst_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 838212 };
+		inline constexpr REL::ID std___Func_base_BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 608369 };
+		inline constexpr REL::ID std___Func_base_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1256959 };
+		inline constexpr REL::ID std___Func_base_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 472462 };
+		inline constexpr REL::ID std___Func_base_BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 267504 };
+		inline constexpr REL::ID std___Func_base_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1447292 };
+		inline constexpr REL::ID std___Func_base_BSScript__Variable_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1040369 };
+		inline constexpr REL::ID std___Func_base_BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1120279 };
+		inline constexpr REL::ID std___Func_base_bool_BSFixedStringconst_BSScript__TypeInfo_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1431408 };
+		inline constexpr REL::ID std___Func_base_bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 668159 };
+		inline constexpr REL::ID std___Func_base_bool_BSScript__Objectconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 370604 };
+		inline constexpr REL::ID std___Func_base_bool_BSScript__Variableconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 414995 };
+		inline constexpr REL::ID std___Func_base_bool_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1455756 };
+		inline constexpr REL::ID std___Func_base_bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1213938 };
+		inline constexpr REL::ID std___Func_base_bool_bool_bool_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 463244 };
+		inline constexpr REL::ID std___Func_base_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1434120 };
+		inline constexpr REL::ID std___Func_base_float_ActorValueOwnerconst_ActorValueInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 217671 };
+		inline constexpr REL::ID std___Func_base_void_Actor_ActorValueInfoconst_float_float_Actor_std___Nil_std___Nil_{ 749881 };
+		inline constexpr REL::ID std___Func_base_void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 180454 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 596463 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 634829 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 1239998 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 498595 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 1346716 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 8576 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 955526 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1471061 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 270820 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 502955 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1082403 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 16431 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1297794 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 1501634 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 565781 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 379275 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1109953 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 582664 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 820940 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_{ 437013 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 700813 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1487790 };
+		inline constexpr REL::ID std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 475306 };
+		inline constexpr REL::ID std___Func_base_void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 947178 };
+		inline constexpr REL::ID std___Func_base_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1466025 };
+		inline constexpr REL::ID std___Func_base_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 135857 };
+		inline constexpr REL::ID std___Func_base_void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_TESObjectREFR_TESObjectREFR_float_GameScript__Internal__DistanceEventData__EventType_std___Nil_std___Nil_{ 1443216 };
+		inline constexpr REL::ID std___Func_base_void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_bool_TESObjectREFR_TESObjectREFR_std___Nil_std___Nil_std___Nil_{ 319781 };
+		inline constexpr REL::ID std___Func_base_void_BSTSmartPointer_GameScript__Internal__HitRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 610227 };
+		inline constexpr REL::ID std___Func_base_void_BSTSmartPointer_GameScript__Internal__MagicEffectApplyRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 596565 };
+		inline constexpr REL::ID std___Func_base_void_BSTSmartPointer_GameScript__Internal__RadiationDamageRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1021223 };
+		inline constexpr REL::ID std___Func_base_void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1372148 };
+		inline constexpr REL::ID std___Func_base_void_Interface3D__Renderer_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 481380 };
+		inline constexpr REL::ID std___Func_base_void_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 388127 };
+		inline constexpr REL::ID std___Func_base_void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1548600 };
+		inline constexpr REL::ID std___Func_base_void_unsignedchar_unsigned__int64_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_{ 467779 };
+		inline constexpr REL::ID std___Func_base_void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1106624 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_bool_const__BSScrapArray_BSScript__Variable___0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 558063 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_float_const__ActorValueOwnerconst_ActorValueInfoconst__0__std__allocator_std___Func_class_float_ActorValueOwnerconst_ActorValueInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___float_ActorValueOwnerconst_ActorValueInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 204001 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__Actor_ActorValueInfoconst_float_float_Actor__0__std__allocator_std___Func_class_void_Actor_ActorValueInfoconst_float_float_Actor_std___Nil_std___Nil___void_Actor_ActorValueInfoconst_float_float_Actor_std___Nil_std___Nil_{ 190390 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 1564256 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 2414 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 1226339 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 793707 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 1550314 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 68982 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 50368 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 102495 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_charconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_{ 1177247 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_int__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_{ 1432231 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript__SingleActorArgument_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1226442 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript__SingleObjectRefrHandleArgument_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 850202 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript__SingleSimpleArgument_bool__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 484573 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript__SingleSimpleArgument_unsignedint__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 518510 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____AnimationEventArguments_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 14908 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 797300 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____KeywordStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 482031 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 762042 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 113673 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 659774 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 534244 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1518816 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__BoolStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1254262 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 994045 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 638231 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 327727 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1202391 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1463722 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 164201 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 917742 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 873411 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 711967 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__BoolStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 217785 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 517291 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 165876 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1131708 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 710369 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1255674 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 835312 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 714962 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1114972 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj___SetPapyrusVarFunctor_0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 744650 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj___TopicInfoEventArguments_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 663937 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_00842126f1bbffa3508825ec58c727d1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 574944 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0130c5f5b7af476843d91c891c7d41ff__0__std__allocator_std___Func_class_bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1358628 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0334f48246e016c65176d35a1707687d__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 179264 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_054c0f92026acdc3af737f9060c8d16c__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 722261 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_07bd1a2a24b5297104651f958fd07edd__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 866839 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_07eb95b259b64dbe637196df0095a500__0__BSTThreadScrapSTLAllocator_void__bool_BSFixedStringconst_BSScript__TypeInfo_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1338187 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_08aeb2b67f0f6c76e11e7ebc816b65a5__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 409370 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_099db76688b3e7d9a1ba0689b7c86b3f__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1412531 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0b964dbed50845a5b080c9e8b152e95b__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 40564 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0bac696f8a7e0d598f906fcbb5de76d4__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 749581 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0bc23d5b7c7de87ef94325d843ed86e3__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 561509 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0bc91e0ed7f0805edf36c7aa85993e84__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 297946 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0f372fe2caf63a32ad7be51a11219d8b__0__std__allocator_std___Func_class_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1262684 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0fb5607cc13ade26aa5aae69ef117f05__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 622568 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_0fbe6c20cb848d3946f7eb3dad25598a__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1078017 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_10a9a02b0a42abae558918086ec73866__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 331970 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_13e98d26afef434c8bbd209b0a32bf5c__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1577773 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_14bc8f35ebd88d5bb2deba19bd34df54__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Variableconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 721480 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_1591a3a9b6a71b0468163ee32c1d0231__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 872880 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_16114c1d7b79d596669e1fd2b8827eef__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Variableconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1346122 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_184a234d8f4f5896e118ec502d1c0a8a__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 201975 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_193429bc9a476f2b0613b82566cacb70__0__BSTThreadScrapSTLAllocator_void__BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1562227 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_19d063effc045d3b08475b14b55c3c64__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1250942 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_1a447c76d8c737033622fe11b6950011__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 857602 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_1e19f6a5dec586b6dd5a59f75ceb0d67__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1507656 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_1e2e2f3207944ac8aaf62ff35af4ee45__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 562996 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_203712f3aa68aac3e863990ca400c297__0__std__allocator_std___Func_class_bool_bool_bool_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_bool_bool_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1165342 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_20bd48cc4695620b1b9bf55287c67586__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1230732 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2111e863258cf77e7ca2cbf1665b88c4__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 111599 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2836ae453004c671939bf2a4b23d7d4b__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 436818 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_299489c7fc39f925edd3aa5540d66d13__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 526736 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2d6b8ee094eebaded7bb8a988c4d0739__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 371347 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2e9353996ef31dba39c8029ef29317a4__0__std__allocator_std___Func_class_void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 53283 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2f5407eb96d0a1b6dc937f3276f48c32__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 271494 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2f5dbdab527b375862b772755a0f8758__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1416940 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_2f6d6b02ef19c948c746f8b099acb567__0__std__allocator_std___Func_class_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 599296 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_322960b94ee4fd4c4057c4420b7e75cf__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1146401 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_3265f8f8f18f753faed2cfea48d6fee5__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 930906 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_3786e9703307cff26b8fe5f52b4734d0__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1214396 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_37beb9fc3b1b01fd41019e7b60e98c01__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 952392 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_39ffcfa6da85b565c1035d777af94bf4__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 700789 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_3f5623e42efbb25feab69a80646642a1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1246474 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_42508bb0ea655875a10b84da51e7510d__0__BSTThreadScrapSTLAllocator_void__BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 311399 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_443487bcb1670fdeccb22dd4dfbf70cd__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 228121 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_44d85ecd6175de7e9a3f9e6d25689f33__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 16538 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_454aa4e702ce0b6f8956d050711fed66__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 955342 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_4651b87cc57a2dfcf69d0bfe8de014d9__0__BSTThreadScrapSTLAllocator_void__BSScript__Variable_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 57495 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_48efb91e7dd54e8b3938c1e8bc3eccb3__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 327067 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_4af6dde34eba7b7ab79d5897fc243ab8__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 943463 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_4c3a9600039c37368088ffe3a15909dc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 16472 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_4d6e63e22afb2d37e36510106c6a6393__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 203615 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_4ebcbf817bc4f7282d9d2977d2448ad1__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 143592 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_5016f41b4f1d50c8770fe9bb9903028b__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 969459 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_5168267b0012478f3bc13e73ddfdb0ac__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 480201 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_52f4adbee5e1ab1b20c95afc65b99ad1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 942679 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_53c4cd4f81ad9e0ce88b1946a0041bb4__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1437116 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_541a261ee3462efd6bfdb689a437a443__0__std__allocator_std___Func_class_void_Interface3D__Renderer_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_Interface3D__Renderer_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 174428 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_54a6f70cd8572b5a19dc8d526b478c14__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 642717 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_55872eda7971030057a292dfb64e1621__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 873168 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_5b7ab3e59f7cb440b252086626e4a60d__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1582651 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_5e1d78085d6cfb76254daab0334336da__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1392710 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_672a9e28d3924c6c989b92853963f20f__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1250909 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_686312c712459af8e284b8c88446107a__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1174326 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_6b0764d404d008b173edce8b25a702d1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1436338 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_6bb2d8505908dfefd6dd0fc5fd65a187__0__std__allocator_std___Func_class_void_unsignedchar_unsigned__int64_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil___void_unsignedchar_unsigned__int64_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_{ 1079421 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_6ceeec5bb504410218d413efc75d68ec__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_GameScript__Internal__MagicEffectApplyRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 499960 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_6d02d13e57cb3dd99fefd56472403b09__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 156784 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_6d4359260f667c5c02878b9918893e31__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 307222 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_72b2a86752ade662ef1830fca3318a49__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1292016 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_74a5677d8445429941d293114f04ff81__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 414309 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_756bd23804314ebe6f44aa82db90dd5f__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1059712 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_76127435f1e52d9569cb10294889d615__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1052787 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_79fdf6b8350d099fe950940aa51b4afc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 601155 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_7afa60fa4da988fe1a0e7577cf1a647a__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_GameScript__Internal__HitRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 513803 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_7f4e4e03826a9abe37163875e4a1e5f3__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1574072 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_7f629fda89b801fdf6de6977c634dbfe__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 441804 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_8011a55efdca4ad481452747e7562a81__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 288700 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_80a2a17f893f4b761fa7dc30420eeb9f__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_TESObjectREFR_TESObjectREFR_float_GameScript__Internal__DistanceEventData__EventType_std___Nil_std___Nil_{ 883659 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_80b87164bd1b94025f86a68b48297b2e__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 620758 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_837b3483dbbb15d73d817d68e2c44104__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 477127 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_8698aa507c43b9faeedde86dfe883944__0__BSTThreadScrapSTLAllocator_void__void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1207857 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_88f19725b3d7fe760b64ee2fd2821de0__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 14827 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_898abd2961a84fe7b4220d0b27c32717__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_GameScript__Internal__RadiationDamageRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 486268 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_8e243b3fe42ff88cc62e562568eaa66a__0__std__allocator_std___Func_class_BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1331222 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_8ecb0e8b234fd35dc5ae505953507ccb__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1039721 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_929d9fe29ecc0b2964e28461ef73ac26__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 798523 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_92df1e715e43ea341101b09934dbe1ee__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 761532 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_95c1f664d5de6418541cd3f8f73d60d6__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Objectconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1151833 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_95c29fd74c394f17289570afade20edc__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1473807 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_95f5adb313c553bd8033fb5afcf6ba4d__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 16568 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_9656ec2329d67b8d2c13d09269547511__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 677934 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_99b9e662d59d0132ee41231142149a68__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1357581 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_9ef11ac1dee46003826067c89d8a3943__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 914102 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a268fc89d69badc06903122c3b3c0c5c__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1284102 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a3113fde1043ec947d3abfa6f74f6964__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1199030 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a3690e0998d05cccf6e570d26a24dd84__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 165349 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a448cbea5ffdafd16e8859655e50e0dd__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 389224 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a48f425a71cf820f5ea84b6e8daacfed__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1481931 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a4dff8aef94e3969d67ebf3e1c581996__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 235835 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a7f34831f1a4f8719fb3c49ce8627133__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 671382 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a83b60c3ea7bc1c3fbb195647ef164f0__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1198710 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_a9ebd384ee3271b6300721ad3ed6fe19__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 660988 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_aa508c0490b5d03f84e8df305b079f1d__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Objectconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1420671 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ac270bf75cbdbacc5d93f5465f5a2a6f__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 438778 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ac92e720bdcfda16adb3c5b4c31a2c2a__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1332770 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ad0c2d3e69eab858a59adca35b18951f__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 464239 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ad2bacf630a3b2a6c2dc56862e4d85e3__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 403764 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b0b33eca7979a6f6d3ed98d2584a8a39__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1539501 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b16391e4ab5327cbdd6c720c787ed6c8__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 909025 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b1f3e94a04102192b8a81cc79fdbb6e3__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1458893 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b39e63306dfe21c8d851a1aba608fa50__0__BSTThreadScrapSTLAllocator_void__BSScript__Variable_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 95772 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b3fc61b57caa2aa63196986f3e8b20fc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 886813 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b71d28fc0f58e163d52c746c9185a6bc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1458770 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_b868380e375d6a4b1a942c4a999c5d04__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1362153 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ba8546611bc871ec2a1ca3d14ab7b49a__0__BSTThreadScrapSTLAllocator_void__bool_BSFixedStringconst_BSScript__TypeInfo_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 497877 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ba86ef1f92ecd3d9fd739fbaa19fede0__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1044033 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ba9be308207c335d9f716b9c88a731e2__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 185165 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_bddc1f6b336f2334d7039c97ed3d6e9e__0__std__allocator_std___Func_class_void_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1303829 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_beab74417d22838e239406c4ea06bfd4__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 659151 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c09462a993663a6ec15d796cbad3f6bb__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1073267 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c0f98d04dfd33769154d1d2c08802bf4__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 501755 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c295031e45e4f267597ff5b253b39cd7__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1014453 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c29ad068b1cc55bbae20d4bf0f356e1f__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 518609 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c385c76f111362317b339a3f01aaffac__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 927729 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c4414c9f09a420b122d91443b1d39733__0__std__allocator_std___Func_class_void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 998042 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c442c15a60c255d7a2bd9f9d1c05158d__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1320706 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c4dfd8b813eb5a6fb55e5f83560882ce__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 795938 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c72710460c20a20e886a07d860aed384__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1064145 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_c917cf2a8d406fbb5d624e085c76a3e1__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ 1305444 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_caa16e10f5f5a8eb09eef71dab7d9225__0__std__allocator_std___Func_class_bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1344928 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_cb557151c02e694f8fbfcbca8873445d__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1501466 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_cc5f5a556d6959c44540ecb786b50983__0__std__allocator_std___Func_class_BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 174354 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ce7b2ef8d4e279bcf8c6300eb2f2a029__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 374836 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_d0a2a575e716eb88f726263bec9b909f__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1085660 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_d254e71fa71d5b987fec9a73c37299ca__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 833579 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_d2f89bfdd29a4ce6fb98ac28cd2146fe__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 427370 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_d628282d615ee146795c281527b66ba1__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1580767 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_d63480f72a49d2082d1e27bc3155bb9a__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 205319 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_d82ec403d6fa397ed31c217cc4b28817__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 982620 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_de53ae0526549b9b00c33bdb878e18ca__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1410841 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_de5fa4cfc080620cf719239da513c45b__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1117337 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_df3f751e4063cc55eb9b1b40f2ea0816__0__std__allocator_std___Func_class_BSContainer__ForEachResult_BSFlattenedBoneTreeconst_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_BSFlattenedBoneTreeconst_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1183728 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_e0e0472162cfbe6e8d034c0e6eba28aa__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 880729 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_e3889e3fd67be681b38effba84b8c044__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 324238 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_e6a7dd0792c8290a0b473794b0ea4e78__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1393913 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ea9bd93468855e8c3ccd3d77bfacfc33__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 828999 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_eaa26a7cf0e1aafa2e7090d8055fcbbc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 41304 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ebb4163806b7c3891829b7867c6fae15__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 388258 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ebeec7fcb09a1d6d16a3aa7dfd103a48__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1134244 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ec6ecb629c93fc27821aca8c19ff1dfa__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_bool_TESObjectREFR_TESObjectREFR_std___Nil_std___Nil_std___Nil_{ 1421867 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_eccc8916bf1950f378565b7cb531f575__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 947792 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_ed11d247ed2a6d04fca7da0c6a8f81a7__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 208484 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_eea0087e1385ac4b24f4c057e5d66995__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1246048 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_f0b55f18912cae1fd1caa24112611e2d__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1168271 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_f3f42e8ea05bba59e9218dd3bb61c98d__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1552517 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_f84b8c60e39bd2e01c8ba533b9b1d54f__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 244919 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_f95be250e8271d8ad375030edbfb2dd7__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 953809 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_fad6a62dfe7fdb293fc18fb1b8f8cdfb__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1403110 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_fb41d256e3f31cb3f14a0df8a346ce0c__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 402007 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_fc0b1edd0e44b87ee8f7b83612f47a7d__0__std__allocator_std___Func_class_void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1449205 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_fde5815b1f49c19cc09e8cd360ecf410__0__BSTThreadScrapSTLAllocator_void__bool_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1452738 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj__lambda_fe01bf3e01c516b8dcf06685b35eeaa0__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 131679 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_0_void__lambda_ffd3f5230f1f91b6b2078decebfc8bd4__std___Ph_1__TESObjectREFRconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1027466 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult__void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1307089 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator___void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 786140 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator___void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 827229 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 323996 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_BSPlatform__BNetResult_BSPlatform__BSUserContent__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_BSPlatform__BNetResult_BSPlatform__BSUserContent_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSPlatform__BSUserContent_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 562725 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 1384865 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 466028 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 883523 };
+		inline constexpr REL::ID std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ 708287 };
+		inline constexpr REL::ID std___Generic_error_category{ 1042102 };
+		inline constexpr REL::ID std___Iosb_int_{ 211432 };
+		inline constexpr REL::ID std___Iostream_error_category{ 995322 };
+		inline constexpr REL::ID std___Ref_count_HINSTANCE___{ 1057380 };
+		inline constexpr REL::ID std___Ref_count_base{ 314541 };
+		inline constexpr REL::ID std___Ref_count_del_alloc_HINSTANCE___bnet____ModuleDeleter_bnet___impl__StdAllocator_void__{ 478768 };
+		inline constexpr REL::ID std___Ref_count_del_alloc_HINSTANCE___bnet___impl__MemoryDeleter_HINSTANCE____bnet___impl__StdAllocator_void__{ 824425 };
+		inline constexpr REL::ID std___Ref_count_del_alloc__SECURITY_FUNCTION_TABLE_Aconst_bnet___impl__MemoryDeleter__SECURITY_FUNCTION_TABLE_Aconst__bnet___impl__StdAllocator_void__{ 25909 };
+		inline constexpr REL::ID std___Ref_count_obj_alloc_bnet__InternalUser_bnet___impl__StdAllocator_void__{ 145929 };
+		inline constexpr REL::ID std___System_error_category{ 836135 };
+		inline constexpr REL::ID std__bad_weak_ptr{ 767209 };
+		inline constexpr REL::ID std__basic_filebuf_char_std__char_traits_char__{ 197736 };
+		inline constexpr REL::ID std__basic_ios_char_std__char_traits_char__{ 523981 };
+		inline constexpr REL::ID std__basic_iostream_char_std__char_traits_char__{ 764470 };
+		inline constexpr REL::ID std__basic_istream_char_std__char_traits_char__{ 152915 };
+		inline constexpr REL::ID std__basic_ofstream_char_std__char_traits_char__{ 809200 };
+		inline constexpr REL::ID std__basic_ostream_char_std__char_traits_char__{ 1168328 };
+		inline constexpr REL::ID std__basic_ostringstream_char_std__char_traits_char__std__allocator_char__{ 241708 };
+		inline constexpr REL::ID std__basic_streambuf_char_std__char_traits_char__{ 131748 };
+		inline constexpr REL::ID std__basic_stringbuf_char_std__char_traits_char__std__allocator_char__{ 685063 };
+		inline constexpr REL::ID std__basic_stringstream_char_std__char_traits_char__std__allocator_char__{ 1386256 };
+		inline constexpr REL::ID std__error_category{ 1308064 };
+		inline constexpr REL::ID std__exception{ 992807 };
+		inline constexpr REL::ID std__ios_base{ 697083 };
+	}
+}
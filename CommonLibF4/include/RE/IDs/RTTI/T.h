@@ -0,0 +1,172 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID TBO_InstanceData{ 1296164 };
+		inline constexpr REL::ID TES{ 1160253 };
+		inline constexpr REL::ID TESAIForm{ 1299277 };
+		inline constexpr REL::ID TESActionData{ 1272843 };
+		inline constexpr REL::ID TESActorBase{ 1263989 };
+		inline constexpr REL::ID TESActorBaseData{ 594829 };
+		inline constexpr REL::ID TESAmbushPackageData{ 987126 };
+		inline constexpr REL::ID TESAmmo{ 751461 };
+		inline constexpr REL::ID TESAttackDamageForm{ 109273 };
+		inline constexpr REL::ID TESAudio__DuckingMgmt__AttenInstancedIni{ 1119513 };
+		inline constexpr REL::ID TESAudio__DuckingMgmt__InstancedIni{ 1166266 };
+		inline constexpr REL::ID TESAudio__ScriptedMusicState{ 357350 };
+		inline constexpr REL::ID TESBipedModelForm{ 88520 };
+		inline constexpr REL::ID TESBoundAnimObject{ 1105085 };
+		inline constexpr REL::ID TESBoundObject{ 1101055 };
+		inline constexpr REL::ID TESCamera{ 1510825 };
+		inline constexpr REL::ID TESCameraState{ 899059 };
+		inline constexpr REL::ID TESChildCell{ 1045873 };
+		inline constexpr REL::ID TESClass{ 311366 };
+		inline constexpr REL::ID TESClimate{ 974613 };
+		inline constexpr REL::ID TESCombatStyle{ 167258 };
+		inline constexpr REL::ID TESContainer{ 1183992 };
+		inline constexpr REL::ID TESCustomPackageData{ 675056 };
+		inline constexpr REL::ID TESDataHandler__ArchiveRegistrationListener{ 1409096 };
+		inline constexpr REL::ID TESDataHandler__PSGRegistrationListener{ 219308 };
+		inline constexpr REL::ID TESDescription{ 993717 };
+		inline constexpr REL::ID TESDialoguePackageData{ 96070 };
+		inline constexpr REL::ID TESEatPackageData{ 1412124 };
+		inline constexpr REL::ID TESEffectShader{ 761026 };
+		inline constexpr REL::ID TESEnchantableForm{ 1425243 };
+		inline constexpr REL::ID TESEscortPackageData{ 926887 };
+		inline constexpr REL::ID TESEyes{ 759875 };
+		inline constexpr REL::ID TESFaction{ 652630 };
+		inline constexpr REL::ID TESFlora{ 1340359 };
+		inline constexpr REL::ID TESFollowPackageData{ 661254 };
+		inline constexpr REL::ID TESForm{ 1344421 };
+		inline constexpr REL::ID TESFormUIData{ 426592 };
+		inline constexpr REL::ID TESFullName{ 1098715 };
+		inline constexpr REL::ID TESFurniture{ 1170838 };
+		inline constexpr REL::ID TESGlobal{ 137178 };
+		inline constexpr REL::ID TESGrass{ 1206232 };
+		inline constexpr REL::ID TESHealthForm{ 1159504 };
+		inline constexpr REL::ID TESIcon{ 1007569 };
+		inline constexpr REL::ID TESIdleForm{ 282866 };
+		inline constexpr REL::ID TESImageSpace{ 1511066 };
+		inline constexpr REL::ID TESImageSpaceModifiableCountForm_4_{ 1364753 };
+		inline constexpr REL::ID TESImageSpaceModifiableForm{ 1411455 };
+		inline constexpr REL::ID TESImageSpaceModifier{ 749685 };
+		inline constexpr REL::ID TESKey{ 633484 };
+		inline constexpr REL::ID TESLandTexture{ 1071261 };
+		inline constexpr REL::ID TESLevCharacter{ 613787 };
+		inline constexpr REL::ID TESLevItem{ 819392 };
+		inline constexpr REL::ID TESLevSpell{ 17125 };
+		inline constexpr REL::ID TESLeveledList{ 674420 };
+		inline constexpr REL::ID TESLoadScreen{ 1019417 };
+		inline constexpr REL::ID TESMagicCasterForm{ 1112092 };
+		inline constexpr REL::ID TESMagicTargetForm{ 540413 };
+		inline constexpr REL::ID TESModel{ 160903 };
+		inline constexpr REL::ID TESModelDB__TESQueuedHandles{ 587603 };
+		inline constexpr REL::ID TESModelDB____TESProcessor{ 710495 };
+		inline constexpr REL::ID TESModelRDT{ 1057710 };
+		inline constexpr REL::ID TESModelTri{ 1044288 };
+		inline constexpr REL::ID TESNPC{ 1277913 };
+		inline constexpr REL::ID TESNPC__InstanceData{ 1504217 };
+		inline constexpr REL::ID TESObject{ 615731 };
+		inline constexpr REL::ID TESObjectACTI{ 54814 };
+		inline constexpr REL::ID TESObjectANIO{ 391157 };
+		inline constexpr REL::ID TESObjectARMA{ 1255043 };
+		inline constexpr REL::ID TESObjectARMO{ 202609 };
+		inline constexpr REL::ID TESObjectARMO__InstanceData{ 1325914 };
+		inline constexpr REL::ID TESObjectBOOK{ 687418 };
+		inline constexpr REL::ID TESObjectCELL{ 640069 };
+		inline constexpr REL::ID TESObjectCELL__IDecalRefFunctor{ 1163675 };
+		inline constexpr REL::ID TESObjectCONT{ 846068 };
+		inline constexpr REL::ID TESObjectDOOR{ 181220 };
+		inline constexpr REL::ID TESObjectLAND{ 1531432 };
+		inline constexpr REL::ID TESObjectLIGH{ 922053 };
+		inline constexpr REL::ID TESObjectMISC{ 666622 };
+		inline constexpr REL::ID TESObjectREFR{ 486180 };
+		inline constexpr REL::ID TESObjectREFRDef__IAliasFunctor{ 465640 };
+		inline constexpr REL::ID TESObjectREFRDef__ILinkedReferenceFunctor{ 419125 };
+		inline constexpr REL::ID TESObjectREFRDef__NativeLinkFunctor__lambda_8a3e806b19528292376bd8bea3d0ed45__{ 1463389 };
+		inline constexpr REL::ID TESObjectREFRSync__REFRSyncController{ 345659 };
+		inline constexpr REL::ID TESObjectREFR__HandleOutfitItemsFunctor{ 535476 };
+		inline constexpr REL::ID TESObjectSTAT{ 1151717 };
+		inline constexpr REL::ID TESObjectTREE{ 442310 };
+		inline constexpr REL::ID TESObjectWEAP{ 1245179 };
+		inline constexpr REL::ID TESObjectWEAP__Data{ 1378780 };
+		inline constexpr REL::ID TESObjectWEAP__InstanceData{ 1425443 };
+		inline constexpr REL::ID TESPackage{ 619687 };
+		inline constexpr REL::ID TESPackageData{ 1472994 };
+		inline constexpr REL::ID TESPatrolPackageData{ 394884 };
+		inline constexpr REL::ID TESProduceForm{ 188990 };
+		inline constexpr REL::ID TESQuest{ 73835 };
+		inline constexpr REL::ID TESRace{ 769140 };
+		inline constexpr REL::ID TESRaceForm{ 1285597 };
+		inline constexpr REL::ID TESReactionForm{ 314838 };
+		inline constexpr REL::ID TESRegion{ 1065863 };
+		inline constexpr REL::ID TESRegionData{ 235206 };
+		inline constexpr REL::ID TESRegionDataGrass{ 534113 };
+		inline constexpr REL::ID TESRegionDataLandscape{ 268028 };
+		inline constexpr REL::ID TESRegionDataManager{ 1340 };
+		inline constexpr REL::ID TESRegionDataMap{ 1318092 };
+		inline constexpr REL::ID TESRegionDataObjects{ 1052175 };
+		inline constexpr REL::ID TESRegionDataSound{ 786416 };
+		inline constexpr REL::ID TESRegionDataWeather{ 1331798 };
+		inline constexpr REL::ID TESRegionGrassObject{ 473437 };
+		inline constexpr REL::ID TESRegionGrassObjectList{ 207700 };
+		inline constexpr REL::ID TESRegionList{ 333711 };
+		inline constexpr REL::ID TESRegionNoiseFunction{ 1383748 };
+		inline constexpr REL::ID TESRegionObject{ 1337051 };
+		inline constexpr REL::ID TESRegionObjectBase{ 739881 };
+		inline constexpr REL::ID TESRegionObjectList{ 586159 };
+		inline constexpr REL::ID TESShout{ 1114400 };
+		inline constexpr REL::ID TESSoulGem{ 773123 };
+		inline constexpr REL::ID TESSound{ 872908 };
+		inline constexpr REL::ID TESSpellList{ 800381 };
+		inline constexpr REL::ID TESTexture{ 302846 };
+		inline constexpr REL::ID TESTexture1024{ 192497 };
+		inline constexpr REL::ID TESTopic{ 1231165 };
+		inline constexpr REL::ID TESTopicInfo{ 134121 };
+		inline constexpr REL::ID TESTrapListener{ 1117928 };
+		inline constexpr REL::ID TESUseItemPackageData{ 128959 };
+		inline constexpr REL::ID TESUseWeaponPackageData{ 1445217 };
+		inline constexpr REL::ID TESValueForm{ 661752 };
+		inline constexpr REL::ID TESWaterDisplacement{ 1536758 };
+		inline constexpr REL::ID TESWaterForm{ 540223 };
+		inline constexpr REL::ID TESWaterNormals{ 439476 };
+		inline constexpr REL::ID TESWaterObject{ 1191103 };
+		inline constexpr REL::ID TESWaterReflections{ 706174 };
+		inline constexpr REL::ID TESWeather{ 1460267 };
+		inline constexpr REL::ID TESWeather__SkyStaticFunctor{ 470403 };
+		inline constexpr REL::ID TESWeightForm{ 914441 };
+		inline constexpr REL::ID TESWordOfPower{ 1391036 };
+		inline constexpr REL::ID TESWorldSpace{ 892154 };
+		inline constexpr REL::ID TargetEntry{ 551088 };
+		inline constexpr REL::ID TargetValueModifierEffect{ 1331130 };
+		inline constexpr REL::ID TelekinesisEffect{ 1490593 };
+		inline constexpr REL::ID TeleportDoorSearch{ 75664 };
+		inline constexpr REL::ID TempLoadGameBuffer{ 1474539 };
+		inline constexpr REL::ID TerminalHolotapeMenu{ 1467115 };
+		inline constexpr REL::ID TerminalMenu{ 1523861 };
+		inline constexpr REL::ID TerminalMenuButtons{ 991339 };
+		inline constexpr REL::ID TerminalMenuUtils__HolotapeSelectionCallback{ 851677 };
+		inline constexpr REL::ID TerminalRunResultsCallback{ 1038124 };
+		inline constexpr REL::ID TextureUpdateDone{ 192525 };
+		inline constexpr REL::ID TextureUpdateStage{ 831209 };
+		inline constexpr REL::ID TextureUpdateStart{ 457902 };
+		inline constexpr REL::ID ThirdPersonState{ 1200556 };
+		inline constexpr REL::ID ThumbstickEvent{ 1264649 };
+		inline constexpr REL::ID TitleSequenceMenu{ 109392 };
+		inline constexpr REL::ID ToggleComponentFavoriteCommand{ 1549018 };
+		inline constexpr REL::ID TogglePOVHandler{ 427899 };
+		inline constexpr REL::ID ToggleQuestActiveStatusCommand{ 1502676 };
+		inline constexpr REL::ID ToggleRadioStationCommand{ 484874 };
+		inline constexpr REL::ID ToggleRunHandler{ 1538852 };
+		inline constexpr REL::ID TrapEntry{ 240529 };
+		inline constexpr REL::ID TrapTargetEntry{ 1381496 };
+		inline constexpr REL::ID TrespassPackage{ 219500 };
+		inline constexpr REL::ID TrianglePathWaterAndLedgeSplitter{ 1442423 };
+		inline constexpr REL::ID TurnUndeadEffect{ 94517 };
+		inline constexpr REL::ID TutorialMenu{ 1378715 };
+		inline constexpr REL::ID TweenMenuCameraState{ 970407 };
+		inline constexpr REL::ID type_info{ 1548767 };
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID UI{ 181127 };
+		inline constexpr REL::ID UIBlurManager{ 246254 };
+		inline constexpr REL::ID UIMessage{ 149782 };
+		inline constexpr REL::ID UISaveLoadManager{ 1247067 };
+		inline constexpr REL::ID Umbra__OutOfMemoryException{ 1370276 };
+		inline constexpr REL::ID UncullBoneHandler{ 75891 };
+		inline constexpr REL::ID UncullFurnitureBoneHandler{ 906728 };
+		inline constexpr REL::ID UncullWeaponsHandler{ 594289 };
+		inline constexpr REL::ID UnitTestMemoryHeap{ 875355 };
+		inline constexpr REL::ID UnitTestZeroOverheadHeap{ 124154 };
+		inline constexpr REL::ID UpdateSightedHandler{ 53583 };
+		inline constexpr REL::ID UseItemCommand{ 830433 };
+		inline constexpr REL::ID UseStealthBoyHandler{ 1457889 };
+		inline constexpr REL::ID UseStimpakHandler{ 360797 };
+		inline constexpr REL::ID UseWeaponActorPackageData{ 694210 };
+		inline constexpr REL::ID UsesBSGFXFunctionHandler{ 1252497 };
+	}
+}
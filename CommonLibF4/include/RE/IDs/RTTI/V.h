@@ -0,0 +1,48 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID VATS{ 103064 };
+		inline constexpr REL::ID VATSCameraState{ 391814 };
+		inline constexpr REL::ID VATSCamera__ActorLookCameraState{ 48363 };
+		inline constexpr REL::ID VATSCamera__BaseState{ 1359144 };
+		inline constexpr REL::ID VATSCamera__LookAtCameraState{ 467944 };
+		inline constexpr REL::ID VATSCamera__ModifierBase{ 1093401 };
+		inline constexpr REL::ID VATSCamera__Modifier_VATSCamera__ModFuncEulerAngleSpring_VATSCamera__ModFuncSpringData_NiPoint3__{ 15180 };
+		inline constexpr REL::ID VATSCamera__Modifier_VATSCamera__ModFuncFOVSpring_VATSCamera__ModFuncSpringData_float__{ 360999 };
+		inline constexpr REL::ID VATSCamera__Modifier_VATSCamera__ModFuncLookAtEuler_NiPoint3_{ 1290 };
+		inline constexpr REL::ID VATSCamera__Modifier_VATSCamera__ModFuncLookAtObject_NiPointer_NiAVObject__{ 108973 };
+		inline constexpr REL::ID VATSCamera__Modifier_VATSCamera__ModFuncLookAtRefr_VATSCamera__ModFuncLookAtRefr__Data_{ 641136 };
+		inline constexpr REL::ID VATSCamera__Modifier_VATSCamera__ModFuncStateCopy_VATSCamera__StateOutput_{ 999962 };
+		inline constexpr REL::ID VATSCamera__StationaryCameraState{ 827454 };
+		inline constexpr REL::ID VATSMenu{ 138562 };
+		inline constexpr REL::ID VATSMenuPrivate__ASFunctionHandler{ 750378 };
+		inline constexpr REL::ID VATSMenuPrivate__VatsMenuObj{ 185488 };
+		inline constexpr REL::ID VATSMenuPrivate__VatsMenuObj__FXPartInfo{ 703948 };
+		inline constexpr REL::ID VATSUtils__ValidateStrangerLineOfSightGoalToOriginFunctor{ 1438331 };
+		inline constexpr REL::ID ValueModifierEffect{ 789500 };
+		inline constexpr REL::ID VariableIntArrayImplementation{ 1154789 };
+		inline constexpr REL::ID VecArrayImplementation{ 1486880 };
+		inline constexpr REL::ID VelocityObstacle__Utilities__BuildOpenEdgeListsVisitor{ 100772 };
+		inline constexpr REL::ID VertibirdMenu{ 270208 };
+		inline constexpr REL::ID VignetteMenu{ 881481 };
+		inline constexpr REL::ID VisitReturnData_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__BSTAlignedScrapArrayAllocator_16___Allocator_{ 1361511 };
+		inline constexpr REL::ID VisitReturnData_MovementVector_BSTAlignedScrapArrayAllocator_16___Allocator_{ 1441181 };
+		inline constexpr REL::ID VisitReturnData_NiPoint3_BSTAlignedScrapArrayAllocator_16___Allocator_{ 1347813 };
+		inline constexpr REL::ID VoiceSpellCastHandler{ 402767 };
+		inline constexpr REL::ID VoiceSpellFireHandler{ 1201064 };
+		inline constexpr REL::ID void___Actor_ActorValueInfoconst_float_float_Actor_{ 357336 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_{ 1336652 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_{ 53429 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_{ 828589 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_{ 417220 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_{ 1290288 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_{ 665251 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_{ 1028815 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_{ 599445 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_charconst_{ 1010346 };
+		inline constexpr REL::ID void___BSPlatform__BNetResult_unsigned__int64_int_{ 1383313 };
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID WaterPathPathingNodeGenerator{ 520431 };
+		inline constexpr REL::ID WaterPathRayValidator{ 1099093 };
+		inline constexpr REL::ID WeaponAnimationGraphManagerHolder{ 1425656 };
+		inline constexpr REL::ID WeaponAttachHandler{ 1397223 };
+		inline constexpr REL::ID WeaponBeginDrawHandler{ 136879 };
+		inline constexpr REL::ID WeaponBeginSheatheHandler{ 1453293 };
+		inline constexpr REL::ID WeaponDetachHandler{ 1131309 };
+		inline constexpr REL::ID WeaponDrawHandler{ 1187192 };
+		inline constexpr REL::ID WeaponEnchantmentController{ 508793 };
+		inline constexpr REL::ID WeaponFireHandler{ 1526766 };
+		inline constexpr REL::ID WeaponSheatheHandler{ 702225 };
+		inline constexpr REL::ID WeaponSwingHandler{ 337141 };
+		inline constexpr REL::ID WeaponUtils____CollectCalculationIdentifiers{ 1052626 };
+		inline constexpr REL::ID WeightedModifierVisitor_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__{ 445748 };
+		inline constexpr REL::ID WeightedModifierVisitor_MovementVector_{ 964215 };
+		inline constexpr REL::ID WeightedModifierVisitor_NiPoint3_{ 791743 };
+		inline constexpr REL::ID WorkbenchMenuBase{ 15507 };
+		inline constexpr REL::ID WorkshopMenu{ 108117 };
+		inline constexpr REL::ID WorkshopMenuGeometry{ 374037 };
+		inline constexpr REL::ID WorkshopMenu__FXWorkshopMenu{ 1377435 };
+		inline constexpr REL::ID Workshop_CaravanMenu{ 925070 };
+		inline constexpr REL::ID Workshop_CaravanMenu__FXWorkshopCaravanMenu{ 659469 };
+		inline constexpr REL::ID Workshop__CheckBuildRadiusCollector{ 631848 };
+		inline constexpr REL::ID Workshop__ExtraData{ 1449800 };
+		inline constexpr REL::ID Workshop__ForwardCastCollector{ 212141 };
+		inline constexpr REL::ID Workshop__GroundIntersectCollector{ 165521 };
+		inline constexpr REL::ID Workshop__MainStatusHandler{ 118696 };
+		inline constexpr REL::ID Workshop__RequestRepairCallback{ 883819 };
+		inline constexpr REL::ID Workshop__RequestScrapCallback{ 976977 };
+		inline constexpr REL::ID Workshop__RequestStoreCallback{ 930472 };
+		inline constexpr REL::ID Workshop__WorkshopReferenceEventSink{ 72172 };
+		inline constexpr REL::ID Workshop__hknpCheckShelterHitsCollector{ 804566 };
+		inline constexpr REL::ID Workshop__hknpClosestConnectPointCollector{ 1229490 };
+		inline constexpr REL::ID Workshop__hknpCountIntersectingRefsCollector{ 1401987 };
+		inline constexpr REL::ID Workshop__hknpWorkshopCastCollector{ 458590 };
+		inline constexpr REL::ID Workshop__hknpWorkshopIntersectCollector{ 837323 };
+	}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID ZeroOverheadHeap{ 609605 };
+		inline constexpr REL::ID ZeroPitchHandler{ 429479 };
+		inline constexpr REL::ID ZoneEntry{ 1348628 };
+	}
+}
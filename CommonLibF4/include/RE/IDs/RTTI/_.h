@@ -0,0 +1,442 @@
+#pragma once
+
+namespace RE
+{
+	namespace RTTI
+	{
+		inline constexpr REL::ID __ActorItemEquippedToMiscStatHandler{ 305207 };
+		inline constexpr REL::ID __ActorKillToMiscStatHandler{ 132449 };
+		inline constexpr REL::ID __ActorTargetCheck{ 567208 };
+		inline constexpr REL::ID __AddPackagesToListFunc{ 732238 };
+		inline constexpr REL::ID __AliasAddPackagesToListFunc{ 904619 };
+		inline constexpr REL::ID __AlternatesInitializer{ 1409031 };
+		inline constexpr REL::ID __AnimationFileListener{ 232699 };
+		inline constexpr REL::ID __AnimationFileLookupSingletonHelper{ 1538461 };
+		inline constexpr REL::ID __ApplyAllDecalsRefFunctor{ 869892 };
+		inline constexpr REL::ID __ApplyChangesFunctor{ 385900 };
+		inline constexpr REL::ID __ApplyTypedDamageFunctor{ 676631 };
+		inline constexpr REL::ID __ArchiveCacheEvent{ 1289031 };
+		inline constexpr REL::ID __ArchiveClearRegistrationListener{ 611502 };
+		inline constexpr REL::ID __AttachLightHitEffectVisitor{ 1421986 };
+		inline constexpr REL::ID __AudioLoadTask{ 436249 };
+		inline constexpr REL::ID __AutoDoorFadeCallback{ 679159 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterArmor_{ 514473 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterBoundItem_{ 1655 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterChameleon_{ 1072293 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterCloak_{ 851971 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterDisarm_{ 1217680 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterInvisibility_{ 121445 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterLight_{ 486667 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterOffensive_{ 757240 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterParalyze_{ 29656 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterReanimate_{ 1100195 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterRestore_{ 731433 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterScript_{ 1247160 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterStagger_{ 1582853 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterSummon_{ 365660 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterTargetEffect_{ 149206 };
+		inline constexpr REL::ID __AutoRegisterCombatMagicCaster_CombatMagicCasterWard_{ 1269177 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestFlight_CombatPathDestinationActor_{ 1006539 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestFlight_CombatPathDestinationLocation_{ 939282 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestFlight_CombatPathDestinationRef_{ 41819 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ 263977 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestHover_CombatPathDestinationNone_{ 536182 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestLanding_CombatPathDestinationLocation_{ 462216 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ 857944 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ 133356 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation_{ 1266688 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation_{ 865716 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestStandard_CombatPathDestinationActor_{ 425134 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestStandard_CombatPathDestinationLocation_{ 91923 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestStandard_CombatPathDestinationRef_{ 165490 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation_{ 353618 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ 566248 };
+		inline constexpr REL::ID __AutoRegisterCombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ 1423587 };
+		inline constexpr REL::ID __BSAutoCloseController{ 482144 };
+		inline constexpr REL::ID __BSChildLockExtra{ 1042793 };
+		inline constexpr REL::ID __BSDelayEffect_XAPO{ 728952 };
+		inline constexpr REL::ID __BSOverdrive_XAPO{ 602585 };
+		inline constexpr REL::ID __BSPointerAllocatorPageAllocator{ 289192 };
+		inline constexpr REL::ID __BSRagdollDriverInterface{ 708010 };
+		inline constexpr REL::ID __BSResourceAssetLoader{ 1169981 };
+		inline constexpr REL::ID __BSScaleformAllocatorPaged{ 605277 };
+		inline constexpr REL::ID __BSScaleformSysMemMapper{ 432140 };
+		inline constexpr REL::ID __BSScaleformTextureManager{ 1489087 };
+		inline constexpr REL::ID __BSStateVariableFilter_XAPO{ 556048 };
+		inline constexpr REL::ID __BSTempEffectScreenSpaceDecal{ 1256736 };
+		inline constexpr REL::ID __BSTextureExtra{ 428120 };
+		inline constexpr REL::ID __BSXAudio2Graph{ 85018 };
+		inline constexpr REL::ID __BShkbAnimationGraphLoadScrapper{ 241949 };
+		inline constexpr REL::ID __BaseBotConfirmCallback{ 4170 };
+		inline constexpr REL::ID __BaseCallbackAdapter{ 790509 };
+		inline constexpr REL::ID __BehaviorGraphSpecificDataLookupSingleton{ 520764 };
+		inline constexpr REL::ID __BehaviorGraphSwapInstanceInitializationFunctor{ 333758 };
+		inline constexpr REL::ID __BehaviorGraphSwapSetupFunctor{ 1304411 };
+		inline constexpr REL::ID __BindingInfo{ 1077343 };
+		inline constexpr REL::ID __BookReadToMiscStatHandler{ 949605 };
+		inline constexpr REL::ID __CastAliasSpellVisitor{ 583085 };
+		inline constexpr REL::ID __CategoryPrefSettingApplier{ 820772 };
+		inline constexpr REL::ID __CellAcousticSpaceListener{ 1226793 };
+		inline constexpr REL::ID __CellDetachWatcher{ 565353 };
+		inline constexpr REL::ID __CharProxyBeforeWholePhysicsUpdateTask{ 1565324 };
+		inline constexpr REL::ID __CharProxyBeforeWholePhysicsUpdateTriggerSeenTask{ 594526 };
+		inline constexpr REL::ID __CharRigidBodyBetweenCollideAndSolveTask{ 62240 };
+		inline constexpr REL::ID __CheckEndReachedFunctorMapper{ 319005 };
+		inline constexpr REL::ID __CheckItemSelectListFunc{ 199670 };
+		inline constexpr REL::ID __CheckLineOfSightTriangleFlagFiltersAdapter{ 395361 };
+		inline constexpr REL::ID __CheckNavmeshPathFilter{ 862996 };
+		inline constexpr REL::ID __CheckRefAgainstConditionsFunc{ 1042901 };
+		inline constexpr REL::ID __CheckSphereVisitor{ 378417 };
+		inline constexpr REL::ID __ChestLootedToMiscStatHandler{ 1341544 };
+		inline constexpr REL::ID __ClearOriginalReferenceFunctor{ 35929 };
+		inline constexpr REL::ID __ClearPrecomputedPathFlag{ 1047031 };
+		inline constexpr REL::ID __ClipAddingFunctor{ 1342541 };
+		inline constexpr REL::ID __ClipTimeVisitor{ 1028225 };
+		inline constexpr REL::ID __CloakEffectCallbackFunctor{ 986266 };
+		inline constexpr REL::ID __CollectQualifyingSubgraphsFunctor{ 576494 };
+		inline constexpr REL::ID __CompileExpressionFunctor{ 1295983 };
+		inline constexpr REL::ID __ComponentCountVerifyFunc{ 73391 };
+		inline constexpr REL::ID __ConsoleHotkeyManager{ 383420 };
+		inline constexpr REL::ID __ConsoleLogPrinter{ 429891 };
+		inline constexpr REL::ID __CriticalHitToMiscStatHandler{ 782460 };
+		inline constexpr REL::ID __CustomGeometryConverter{ 944276 };
+		inline constexpr REL::ID __DDQueueCollection{ 625532 };
+		inline constexpr REL::ID __DaysPassedToMiscStatHandler{ 609610 };
+		inline constexpr REL::ID __DeathItemAdder{ 1077304 };
+		inline constexpr REL::ID __DecalApplier{ 538572 };
+		inline constexpr REL::ID __DeepCopyStream{ 778030 };
+		inline constexpr REL::ID __DefaultObjectFormFactory{ 1528644 };
+		inline constexpr REL::ID __DisarmedToMiscStatHandler{ 955022 };
+		inline constexpr REL::ID __DispelAliasSpellVisitor{ 755919 };
+		inline constexpr REL::ID __DispelFirstOnlyFunctor{ 442786 };
+		inline constexpr REL::ID __EditorDeadClothCacheExtraData{ 319206 };
+		inline constexpr REL::ID __EnsureAliasCanBePickpocketedFunc{ 1098891 };
+		inline constexpr REL::ID __EventCallbackAdapter{ 743893 };
+		inline constexpr REL::ID __EventRelayFunctor{ 650597 };
+		inline constexpr REL::ID __ExitCallback{ 699054 };
+		inline constexpr REL::ID __ExitSurvivalModeCallback{ 1022710 };
+		inline constexpr REL::ID __ExitToMainMenuCallback{ 603870 };
+		inline constexpr REL::ID __FatmanDeathsToMiscStatHandler{ 1407274 };
+		inline constexpr REL::ID __FavoriteMissingComponentsConfirmCallback{ 177733 };
+		inline constexpr REL::ID __FilterBipedPartOnAdd{ 363169 };
+		inline constexpr REL::ID __FindAliasWithScript{ 655211 };
+		inline constexpr REL::ID __FindClosestOpenEdgeFunctor{ 1395605 };
+		inline constexpr REL::ID __FindFormFunc{ 339266 };
+		inline constexpr REL::ID __FindMovementIdleEnumHelper{ 679835 };
+		inline constexpr REL::ID __FindObjectTypeHelper{ 726359 };
+		inline constexpr REL::ID __FindPreferredConnectedNavmeshInfosWithinRadiusVisitor{ 398376 };
+		inline constexpr REL::ID __ForceReloadLoadingTask{ 500479 };
+		inline constexpr REL::ID __ForwardingPackfileListerer{ 64461 };
+		inline constexpr REL::ID __FusionCoreConsumedToMiscStatHandler{ 916676 };
+		inline constexpr REL::ID __FusionCoreEjectedToMiscStatHandler{ 1528423 };
+		inline constexpr REL::ID __GraphPhysicsStepListener{ 1259382 };
+		inline constexpr REL::ID __GraphVarTypeQuery{ 1230602 };
+		inline constexpr REL::ID __HandleEntryPointVisitor{ 721434 };
+		inline constexpr REL::ID __HandlePlayerPerspectiveSwitchForEyeTracking{ 439746 };
+		inline constexpr REL::ID __HarvestToMiscStatHandler{ 1542093 };
+		inline constexpr REL::ID __HavokThreadMemorySink{ 1063515 };
+		inline constexpr REL::ID __HoursPassedToMiscStatHandler{ 436490 };
+		inline constexpr REL::ID __InactiveGraphCheckVisitor{ 938095 };
+		inline constexpr REL::ID __InitGameDataThread{ 1197348 };
+		inline constexpr REL::ID __InitItemPerkRankDataVisitor{ 515046 };
+		inline constexpr REL::ID __InitialLoadListener{ 222403 };
+		inline constexpr REL::ID __InspectModeRepeatHandler{ 572616 };
+		inline constexpr REL::ID __InternedStringRefCounted{ 981870 };
+		inline constexpr REL::ID __InventoryKillStatHandler{ 277763 };
+		inline constexpr REL::ID __InventoryToMiscStatHandler{ 1514793 };
+		inline constexpr REL::ID __IsClosedDoorOnPath{ 823049 };
+		inline constexpr REL::ID __IsTeleportDoorOnPath{ 869395 };
+		inline constexpr REL::ID __ItemCraftedToMiscStatHandler{ 1552886 };
+		inline constexpr REL::ID __ItemPlacedToMiscStatHandler{ 535505 };
+		inline constexpr REL::ID __ItemScrappedToMiscStatHandler{ 143192 };
+		inline constexpr REL::ID __ItemsPickpocketedToMiscStatHandler{ 157147 };
+		inline constexpr REL::ID __ItemsStolenToMiscStatHandler{ 1379736 };
+		inline constexpr REL::ID __Jobber{ 422582 };
+		inline constexpr REL::ID __JunkItemFoundStatHandler{ 105067 };
+		inline constexpr REL::ID __LatentCallback{ 697471 };
+		inline constexpr REL::ID __LevelIncreaseToMiscStatHandler{ 568387 };
+		inline constexpr REL::ID __LinkedRefFinder{ 1529378 };
+		inline constexpr REL::ID __LoadGameListener{ 315512 };
+		inline constexpr REL::ID __LoadGameMissingContentCallBack{ 405646 };
+		inline constexpr REL::ID __LoadWatcher{ 932690 };
+		inline constexpr REL::ID __LocationDiscoveryMiscStatHandler{ 1179716 };
+		inline constexpr REL::ID __LogWriteThread{ 529824 };
+		inline constexpr REL::ID __LoggingDisabler{ 969671 };
+		inline constexpr REL::ID __LooseAudioRegistrar{ 427422 };
+		inline constexpr REL::ID __MainCullingCamera{ 1271393 };
+		inline constexpr REL::ID __MainStatusHandler{ 23348 };
+		inline constexpr REL::ID __MemoryManagerFileFactory{ 1235578 };
+		inline constexpr REL::ID __MenuModeHandler__MenuModeCounterListener{ 1399140 };
+		inline constexpr REL::ID __MessageMenuCallback{ 731316 };
+		inline constexpr REL::ID __MineDisarmedToMiscStatHandler{ 927401 };
+		inline constexpr REL::ID __MiscStatIncrementer_AssaultCrime__Event_{ 899973 };
+		inline constexpr REL::ID __MiscStatIncrementer_BobbleheadCollected__Event_{ 1431705 };
+		inline constexpr REL::ID __MiscStatIncrementer_CorpseEaten__Event_{ 209142 };
+		inline constexpr REL::ID __MiscStatIncrementer_InvestmentMade__Event_{ 620345 };
+		inline constexpr REL::ID __MiscStatIncrementer_LocationCleared__Event_{ 1152147 };
+		inline constexpr REL::ID __MiscStatIncrementer_LocksPicked__Event_{ 540912 };
+		inline constexpr REL::ID __MiscStatIncrementer_MurderCrime__Event_{ 1511698 };
+		inline constexpr REL::ID __MiscStatIncrementer_RicochetHit__Event_{ 88263 };
+		inline constexpr REL::ID __MiscStatIncrementer_SandmanKill__Event_{ 820516 };
+		inline constexpr REL::ID __ModConfirmCallback{ 432291 };
+		inline constexpr REL::ID __MonitorAPO{ 882889 };
+		inline constexpr REL::ID __MovementControllerAIAdapter{ 926223 };
+		inline constexpr REL::ID __MovementHandlerAgentAngleControllerLoadScrapper{ 74478 };
+		inline constexpr REL::ID __MovementHandlerAgentLargeDeltaLoadScrapper{ 1124551 };
+		inline constexpr REL::ID __MovementHandlerAgentTranslationControllerLoadScrapper{ 154114 };
+		inline constexpr REL::ID __MovementPlannerAgentHorseControlsLoadScrapper{ 1303320 };
+		inline constexpr REL::ID __MovementPlannerAgentKeepOffsetLoadScrapper{ 771615 };
+		inline constexpr REL::ID __MusicEventSink{ 592665 };
+		inline constexpr REL::ID __MysteriousStrangerToMiscStatHandler{ 1539099 };
+		inline constexpr REL::ID __NoExitSaveQuitConfirmCallBack{ 1381922 };
+		inline constexpr REL::ID __NoExitSaveQuitToDesktopConfirmCallBack{ 411191 };
+		inline constexpr REL::ID __NoMusic{ 905059 };
+		inline constexpr REL::ID __NonDialogSubCategory{ 1273295 };
+		inline constexpr REL::ID __NormalDoorFadeCallback{ 505962 };
+		inline constexpr REL::ID __ObjectConverter{ 319842 };
+		inline constexpr REL::ID __ObjectFactoryVisitor{ 585719 };
+		inline constexpr REL::ID __ObjectTypeFinder{ 539076 };
+		inline constexpr REL::ID __ObjectiveStateToMiscStatHandler{ 623365 };
+		inline constexpr REL::ID __ObsoleteSaveCallback{ 798098 };
+		inline constexpr REL::ID __OutputInfoStream{ 794313 };
+		inline constexpr REL::ID __PADataVisitor{ 1442038 };
+		inline constexpr REL::ID __PAFinder{ 1395224 };
+		inline constexpr REL::ID __PathBuilderBSPathingRequest{ 2684 };
+		inline constexpr REL::ID __PathBuilderClosePointPath{ 636202 };
+		inline constexpr REL::ID __PathBuilderPathingRequest{ 1107603 };
+		inline constexpr REL::ID __PathBuilderRotatePath{ 562051 };
+		inline constexpr REL::ID __PathBuilderStopMovingPath{ 263025 };
+		inline constexpr REL::ID __PathManagerServer{ 1513836 };
+		inline constexpr REL::ID __PathSmootherRayCastBuildNodesForLargeZDelta{ 1162758 };
+		inline constexpr REL::ID __PeekStreamReader{ 237311 };
+		inline constexpr REL::ID __PhysicsWorldHandler{ 1354117 };
+		inline constexpr REL::ID __PlayerAddictedToMiscStatHandler{ 557680 };
+		inline constexpr REL::ID __PlayerCellListener{ 362006 };
+		inline constexpr REL::ID __PlayerIDUpdater{ 233112 };
+		inline constexpr REL::ID __PlayerOPMMgr__HotloadRefresher{ 428409 };
+		inline constexpr REL::ID __PreloadCountVisitor{ 1311150 };
+		inline constexpr REL::ID __PreloadModelsVisitor{ 1264693 };
+		inline constexpr REL::ID __PrintPapyrusObjectsOnAliasToConsole{ 56382 };
+		inline constexpr REL::ID __ProcessQueuePolicyBase___ReferenceQueuePolicy_{ 1335212 };
+		inline constexpr REL::ID __ProcessQueuePolicyBase___TempEffectQueuePolicy_{ 1148846 };
+		inline constexpr REL::ID __QualifyAsCurrentPackage{ 1030576 };
+		inline constexpr REL::ID __QuestStatusToMiscStatHandler{ 450203 };
+		inline constexpr REL::ID __QueuedBGSStaticCollection{ 1212379 };
+		inline constexpr REL::ID __QueuedMagicItem{ 1404356 };
+		inline constexpr REL::ID __QueuedSubBehaviorHandles{ 423816 };
+		inline constexpr REL::ID __RagdollKeyFrameHierarchyController{ 1222890 };
+		inline constexpr REL::ID __RandomDialogueStoryEventProcessor{ 1051464 };
+		inline constexpr REL::ID __ReferenceHandleProcessPolicy___ReferenceQueuePolicy_{ 1428523 };
+		inline constexpr REL::ID __RemoveLeveledExtraFunctor{ 400591 };
+		inline constexpr REL::ID __RemoveUsedCountFunc{ 246161 };
+		inline constexpr REL::ID __RepairFailureCallback{ 863039 };
+		inline constexpr REL::ID __ResetJigglerWSModifiersFunctor{ 1121793 };
+		inline constexpr REL::ID __RobotSelectionCallback{ 1433031 };
+		inline constexpr REL::ID __SaveDataRestoreFunctor{ 1547752 };
+		inline constexpr REL::ID __SceneActionResultsCallBack{ 525449 };
+		inline constexpr REL::ID __ScenePhaseResultsCallBack{ 1169778 };
+		inline constexpr REL::ID __SceneResultsCallBack{ 739762 };
+		inline constexpr REL::ID __ScrapItemCallback{ 745464 };
+		inline constexpr REL::ID __ScriptFoundCallback{ 1368644 };
+		inline constexpr REL::ID __SearchLinkedRefChildrenFunctor{ 1482924 };
+		inline constexpr REL::ID __ServeJailTimeCallback{ 1299251 };
+		inline constexpr REL::ID __SetPapyrusVarFunctor{ 1002577 };
+		inline constexpr REL::ID __SkipJumpNode{ 1135542 };
+		inline constexpr REL::ID __SortIntersectingEdgesFunctor{ 205808 };
+		inline constexpr REL::ID __SpeechChallengeSucceededStatHandler{ 1127581 };
+		inline constexpr REL::ID __StageItemFinishedCallback{ 25143 };
+		inline constexpr REL::ID __StandardDetectionListener{ 47671 };
+		inline constexpr REL::ID __StateMachineSpeedInformationInitializationFunctor{ 603085 };
+		inline constexpr REL::ID __StopHitEffectsVisitor{ 854969 };
+		inline constexpr REL::ID __StopStartEquipabilityFunctor{ 615906 };
+		inline constexpr REL::ID __SubGraphCharacterPropertySymbolMap{ 81523 };
+		inline constexpr REL::ID __SubGraphEventSymbolMap{ 1098960 };
+		inline constexpr REL::ID __SubGraphVariableSymbolMap{ 1271670 };
+		inline constexpr REL::ID __SynchronizedClipNameVisitor{ 1431773 };
+		inline constexpr REL::ID __TESAudioInitialLoadListener{ 993238 };
+		inline constexpr REL::ID __TESObjectREFRFactory{ 82879 };
+		inline constexpr REL::ID __TempEffectProcessPolicy___TempEffectQueuePolicy_{ 1242368 };
+		inline constexpr REL::ID __TerminalsHackedToMiscStatHandler{ 768653 };
+		inline constexpr REL::ID __TopicInfoEventArguments{ 1481894 };
+		inline constexpr REL::ID __TopicResultCallBack{ 1582115 };
+		inline constexpr REL::ID __TrespassToMiscStatHandler{ 1015291 };
+		inline constexpr REL::ID __UpdateAllDecalsRefFunctor{ 697798 };
+		inline constexpr REL::ID __VATSFaceEmotionManager{ 1311030 };
+		inline constexpr REL::ID __VMInitThread{ 1463350 };
+		inline constexpr REL::ID __VoiceTypeFinder{ 292253 };
+		inline constexpr REL::ID __Win32Impl{ 814585 };
+		inline constexpr REL::ID __WorkshopListener{ 269014 };
+		inline constexpr REL::ID __bhkLifoAllocator{ 114188 };
+		inline constexpr REL::ID __hkBSFinishGraphPhysicsUpdateTask{ 866958 };
+		inline constexpr REL::ID __hknpBSFootIKCollector{ 88210 };
+		inline constexpr REL::ID __hknpBSHeightFieldShape{ 1347661 };
+		inline constexpr REL::ID __hknpBSIgnorePoseBoundForActorsInFurnitureCollector{ 204688 };
+		inline constexpr REL::ID __hknpBSQuadOrientationCollector{ 821379 };
+		inline constexpr REL::ID __hknpRagdollPenetrationHitCollector{ 1269933 };
+		inline constexpr REL::ID __hknpScaledConvexShapeScaleAndTransformCollector{ 315327 };
+		inline constexpr REL::ID __iStateTaggingFunctor{ 1416905 };
+		inline constexpr REL::ID _com_error{ 359146 };
+		inline constexpr REL::ID _lambda_00842126f1bbffa3508825ec58c727d1_{ 214133 };
+		inline constexpr REL::ID _lambda_0130c5f5b7af476843d91c891c7d41ff_{ 1334186 };
+		inline constexpr REL::ID _lambda_0334f48246e016c65176d35a1707687d_{ 185396 };
+		inline constexpr REL::ID _lambda_054c0f92026acdc3af737f9060c8d16c_{ 1232524 };
+		inline constexpr REL::ID _lambda_07bd1a2a24b5297104651f958fd07edd_{ 1394126 };
+		inline constexpr REL::ID _lambda_07eb95b259b64dbe637196df0095a500_{ 913393 };
+		inline constexpr REL::ID _lambda_08aeb2b67f0f6c76e11e7ebc816b65a5_{ 242643 };
+		inline constexpr REL::ID _lambda_099db76688b3e7d9a1ba0689b7c86b3f_{ 818130 };
+		inline constexpr REL::ID _lambda_0b964dbed50845a5b080c9e8b152e95b_{ 644787 };
+		inline constexpr REL::ID _lambda_0bac696f8a7e0d598f906fcbb5de76d4_{ 703845 };
+		inline constexpr REL::ID _lambda_0bc23d5b7c7de87ef94325d843ed86e3_{ 1110136 };
+		inline constexpr REL::ID _lambda_0bc91e0ed7f0805edf36c7aa85993e84_{ 587184 };
+		inline constexpr REL::ID _lambda_0f372fe2caf63a32ad7be51a11219d8b_{ 961331 };
+		inline constexpr REL::ID _lambda_0fb5607cc13ade26aa5aae69ef117f05_{ 1194209 };
+		inline constexpr REL::ID _lambda_0fbe6c20cb848d3946f7eb3dad25598a_{ 513898 };
+		inline constexpr REL::ID _lambda_10a9a02b0a42abae558918086ec73866_{ 1135949 };
+		inline constexpr REL::ID _lambda_13e98d26afef434c8bbd209b0a32bf5c_{ 867979 };
+		inline constexpr REL::ID _lambda_14bc8f35ebd88d5bb2deba19bd34df54_{ 176919 };
+		inline constexpr REL::ID _lambda_1591a3a9b6a71b0468163ee32c1d0231_{ 129994 };
+		inline constexpr REL::ID _lambda_16114c1d7b79d596669e1fd2b8827eef_{ 3329 };
+		inline constexpr REL::ID _lambda_184a234d8f4f5896e118ec502d1c0a8a_{ 559595 };
+		inline constexpr REL::ID _lambda_193429bc9a476f2b0613b82566cacb70_{ 1195091 };
+		inline constexpr REL::ID _lambda_19d063effc045d3b08475b14b55c3c64_{ 330363 };
+		inline constexpr REL::ID _lambda_1a447c76d8c737033622fe11b6950011_{ 68796 };
+		inline constexpr REL::ID _lambda_1e19f6a5dec586b6dd5a59f75ceb0d67_{ 932400 };
+		inline constexpr REL::ID _lambda_1e2e2f3207944ac8aaf62ff35af4ee45_{ 1059590 };
+		inline constexpr REL::ID _lambda_203712f3aa68aac3e863990ca400c297_{ 836641 };
+		inline constexpr REL::ID _lambda_20bd48cc4695620b1b9bf55287c67586_{ 1305380 };
+		inline constexpr REL::ID _lambda_2111e863258cf77e7ca2cbf1665b88c4_{ 759937 };
+		inline constexpr REL::ID _lambda_2836ae453004c671939bf2a4b23d7d4b_{ 1306558 };
+		inline constexpr REL::ID _lambda_299489c7fc39f925edd3aa5540d66d13_{ 1258994 };
+		inline constexpr REL::ID _lambda_2d6b8ee094eebaded7bb8a988c4d0739_{ 3844 };
+		inline constexpr REL::ID _lambda_2e9353996ef31dba39c8029ef29317a4_{ 616040 };
+		inline constexpr REL::ID _lambda_2f5407eb96d0a1b6dc937f3276f48c32_{ 285033 };
+		inline constexpr REL::ID _lambda_2f5dbdab527b375862b772755a0f8758_{ 1132652 };
+		inline constexpr REL::ID _lambda_2f6d6b02ef19c948c746f8b099acb567_{ 442928 };
+		inline constexpr REL::ID _lambda_322960b94ee4fd4c4057c4420b7e75cf_{ 178949 };
+		inline constexpr REL::ID _lambda_3265f8f8f18f753faed2cfea48d6fee5_{ 829999 };
+		inline constexpr REL::ID _lambda_3786e9703307cff26b8fe5f52b4734d0_{ 1123763 };
+		inline constexpr REL::ID _lambda_37beb9fc3b1b01fd41019e7b60e98c01_{ 695832 };
+		inline constexpr REL::ID _lambda_39ffcfa6da85b565c1035d777af94bf4_{ 837911 };
+		inline constexpr REL::ID _lambda_3f5623e42efbb25feab69a80646642a1_{ 78370 };
+		inline constexpr REL::ID _lambda_42508bb0ea655875a10b84da51e7510d_{ 1540617 };
+		inline constexpr REL::ID _lambda_443487bcb1670fdeccb22dd4dfbf70cd_{ 1509361 };
+		inline constexpr REL::ID _lambda_44d85ecd6175de7e9a3f9e6d25689f33_{ 645510 };
+		inline constexpr REL::ID _lambda_454aa4e702ce0b6f8956d050711fed66_{ 1479768 };
+		inline constexpr REL::ID _lambda_4651b87cc57a2dfcf69d0bfe8de014d9_{ 1067838 };
+		inline constexpr REL::ID _lambda_48efb91e7dd54e8b3938c1e8bc3eccb3_{ 349803 };
+		inline constexpr REL::ID _lambda_4af6dde34eba7b7ab79d5897fc243ab8_{ 676212 };
+		inline constexpr REL::ID _lambda_4c3a9600039c37368088ffe3a15909dc_{ 151599 };
+		inline constexpr REL::ID _lambda_4d6e63e22afb2d37e36510106c6a6393_{ 1561222 };
+		inline constexpr REL::ID _lambda_4ebcbf817bc4f7282d9d2977d2448ad1_{ 522766 };
+		inline constexpr REL::ID _lambda_5016f41b4f1d50c8770fe9bb9903028b_{ 95089 };
+		inline constexpr REL::ID _lambda_5168267b0012478f3bc13e73ddfdb0ac_{ 157755 };
+		inline constexpr REL::ID _lambda_52f4adbee5e1ab1b20c95afc65b99ad1_{ 863135 };
+		inline constexpr REL::ID _lambda_53c4cd4f81ad9e0ce88b1946a0041bb4_{ 272379 };
+		inline constexpr REL::ID _lambda_541a261ee3462efd6bfdb689a437a443_{ 311683 };
+		inline constexpr REL::ID _lambda_54a6f70cd8572b5a19dc8d526b478c14_{ 777272 };
+		inline constexpr REL::ID _lambda_55872eda7971030057a292dfb64e1621_{ 423663 };
+		inline constexpr REL::ID _lambda_5b7ab3e59f7cb440b252086626e4a60d_{ 790773 };
+		inline constexpr REL::ID _lambda_5e1d78085d6cfb76254daab0334336da_{ 1366588 };
+		inline constexpr REL::ID _lambda_672a9e28d3924c6c989b92853963f20f_{ 444758 };
+		inline constexpr REL::ID _lambda_686312c712459af8e284b8c88446107a_{ 875991 };
+		inline constexpr REL::ID _lambda_6b0764d404d008b173edce8b25a702d1_{ 817393 };
+		inline constexpr REL::ID _lambda_6bb2d8505908dfefd6dd0fc5fd65a187_{ 561365 };
+		inline constexpr REL::ID _lambda_6ceeec5bb504410218d413efc75d68ec_{ 1183409 };
+		inline constexpr REL::ID _lambda_6d02d13e57cb3dd99fefd56472403b09_{ 1040109 };
+		inline constexpr REL::ID _lambda_6d4359260f667c5c02878b9918893e31_{ 642268 };
+		inline constexpr REL::ID _lambda_72b2a86752ade662ef1830fca3318a49_{ 1567397 };
+		inline constexpr REL::ID _lambda_74a5677d8445429941d293114f04ff81_{ 1336048 };
+		inline constexpr REL::ID _lambda_756bd23804314ebe6f44aa82db90dd5f_{ 251125 };
+		inline constexpr REL::ID _lambda_76127435f1e52d9569cb10294889d615_{ 522237 };
+		inline constexpr REL::ID _lambda_79fdf6b8350d099fe950940aa51b4afc_{ 1163624 };
+		inline constexpr REL::ID _lambda_7afa60fa4da988fe1a0e7577cf1a647a_{ 1010463 };
+		inline constexpr REL::ID _lambda_7f4e4e03826a9abe37163875e4a1e5f3_{ 1400971 };
+		inline constexpr REL::ID _lambda_7f629fda89b801fdf6de6977c634dbfe_{ 1221904 };
+		inline constexpr REL::ID _lambda_8011a55efdca4ad481452747e7562a81_{ 204882 };
+		inline constexpr REL::ID _lambda_80a2a17f893f4b761fa7dc30420eeb9f_{ 686824 };
+		inline constexpr REL::ID _lambda_80b87164bd1b94025f86a68b48297b2e_{ 1241407 };
+		inline constexpr REL::ID _lambda_837b3483dbbb15d73d817d68e2c44104_{ 72083 };
+		inline constexpr REL::ID _lambda_8698aa507c43b9faeedde86dfe883944_{ 895756 };
+		inline constexpr REL::ID _lambda_88f19725b3d7fe760b64ee2fd2821de0_{ 732544 };
+		inline constexpr REL::ID _lambda_898abd2961a84fe7b4220d0b27c32717_{ 1355851 };
+		inline constexpr REL::ID _lambda_8e243b3fe42ff88cc62e562568eaa66a_{ 97634 };
+		inline constexpr REL::ID _lambda_8ecb0e8b234fd35dc5ae505953507ccb_{ 1578057 };
+		inline constexpr REL::ID _lambda_929d9fe29ecc0b2964e28461ef73ac26_{ 686993 };
+		inline constexpr REL::ID _lambda_92df1e715e43ea341101b09934dbe1ee_{ 41013 };
+		inline constexpr REL::ID _lambda_95c1f664d5de6418541cd3f8f73d60d6_{ 1086127 };
+		inline constexpr REL::ID _lambda_95c29fd74c394f17289570afade20edc_{ 70027 };
+		inline constexpr REL::ID _lambda_95f5adb313c553bd8033fb5afcf6ba4d_{ 1048881 };
+		inline constexpr REL::ID _lambda_9656ec2329d67b8d2c13d09269547511_{ 1032003 };
+		inline constexpr REL::ID _lambda_99b9e662d59d0132ee41231142149a68_{ 341112 };
+		inline constexpr REL::ID _lambda_9ef11ac1dee46003826067c89d8a3943_{ 1413734 };
+		inline constexpr REL::ID _lambda_a268fc89d69badc06903122c3b3c0c5c_{ 1068359 };
+		inline constexpr REL::ID _lambda_a3113fde1043ec947d3abfa6f74f6964_{ 168622 };
+		inline constexpr REL::ID _lambda_a3690e0998d05cccf6e570d26a24dd84_{ 859197 };
+		inline constexpr REL::ID _lambda_a448cbea5ffdafd16e8859655e50e0dd_{ 1413241 };
+		inline constexpr REL::ID _lambda_a48f425a71cf820f5ea84b6e8daacfed_{ 357727 };
+		inline constexpr REL::ID _lambda_a4dff8aef94e3969d67ebf3e1c581996_{ 1539745 };
+		inline constexpr REL::ID _lambda_a7f34831f1a4f8719fb3c49ce8627133_{ 241484 };
+		inline constexpr REL::ID _lambda_a83b60c3ea7bc1c3fbb195647ef164f0_{ 469052 };
+		inline constexpr REL::ID _lambda_a9ebd384ee3271b6300721ad3ed6fe19_{ 130099 };
+		inline constexpr REL::ID _lambda_aa508c0490b5d03f84e8df305b079f1d_{ 24728 };
+		inline constexpr REL::ID _lambda_ac270bf75cbdbacc5d93f5465f5a2a6f_{ 503094 };
+		inline constexpr REL::ID _lambda_ac92e720bdcfda16adb3c5b4c31a2c2a_{ 5380 };
+		inline constexpr REL::ID _lambda_ad0c2d3e69eab858a59adca35b18951f_{ 788661 };
+		inline constexpr REL::ID _lambda_ad2bacf630a3b2a6c2dc56862e4d85e3_{ 886909 };
+		inline constexpr REL::ID _lambda_b0b33eca7979a6f6d3ed98d2584a8a39_{ 1040887 };
+		inline constexpr REL::ID _lambda_b16391e4ab5327cbdd6c720c787ed6c8_{ 1422320 };
+		inline constexpr REL::ID _lambda_b1f3e94a04102192b8a81cc79fdbb6e3_{ 318365 };
+		inline constexpr REL::ID _lambda_b39e63306dfe21c8d851a1aba608fa50_{ 349296 };
+		inline constexpr REL::ID _lambda_b3fc61b57caa2aa63196986f3e8b20fc_{ 665350 };
+		inline constexpr REL::ID _lambda_b71d28fc0f58e163d52c746c9185a6bc_{ 1433999 };
+		inline constexpr REL::ID _lambda_b868380e375d6a4b1a942c4a999c5d04_{ 1058082 };
+		inline constexpr REL::ID _lambda_ba8546611bc871ec2a1ca3d14ab7b49a_{ 1367464 };
+		inline constexpr REL::ID _lambda_ba86ef1f92ecd3d9fd739fbaa19fede0_{ 1478546 };
+		inline constexpr REL::ID _lambda_ba9be308207c335d9f716b9c88a731e2_{ 377448 };
+		inline constexpr REL::ID _lambda_bddc1f6b336f2334d7039c97ed3d6e9e_{ 484436 };
+		inline constexpr REL::ID _lambda_beab74417d22838e239406c4ea06bfd4_{ 1213995 };
+		inline constexpr REL::ID _lambda_c09462a993663a6ec15d796cbad3f6bb_{ 492216 };
+		inline constexpr REL::ID _lambda_c0f98d04dfd33769154d1d2c08802bf4_{ 145566 };
+		inline constexpr REL::ID _lambda_c295031e45e4f267597ff5b253b39cd7_{ 1240887 };
+		inline constexpr REL::ID _lambda_c29ad068b1cc55bbae20d4bf0f356e1f_{ 859371 };
+		inline constexpr REL::ID _lambda_c385c76f111362317b339a3f01aaffac_{ 415173 };
+		inline constexpr REL::ID _lambda_c4414c9f09a420b122d91443b1d39733_{ 814925 };
+		inline constexpr REL::ID _lambda_c442c15a60c255d7a2bd9f9d1c05158d_{ 1105184 };
+		inline constexpr REL::ID _lambda_c4dfd8b813eb5a6fb55e5f83560882ce_{ 198114 };
+		inline constexpr REL::ID _lambda_c72710460c20a20e886a07d860aed384_{ 617896 };
+		inline constexpr REL::ID _lambda_c917cf2a8d406fbb5d624e085c76a3e1_{ 296383 };
+		inline constexpr REL::ID _lambda_caa16e10f5f5a8eb09eef71dab7d9225_{ 1507470 };
+		inline constexpr REL::ID _lambda_cb557151c02e694f8fbfcbca8873445d_{ 1133812 };
+		inline constexpr REL::ID _lambda_cc5f5a556d6959c44540ecb786b50983_{ 270523 };
+		inline constexpr REL::ID _lambda_ce7b2ef8d4e279bcf8c6300eb2f2a029_{ 1282863 };
+		inline constexpr REL::ID _lambda_d0a2a575e716eb88f726263bec9b909f_{ 302747 };
+		inline constexpr REL::ID _lambda_d254e71fa71d5b987fec9a73c37299ca_{ 490934 };
+		inline constexpr REL::ID _lambda_d2f89bfdd29a4ce6fb98ac28cd2146fe_{ 695328 };
+		inline constexpr REL::ID _lambda_d628282d615ee146795c281527b66ba1_{ 550495 };
+		inline constexpr REL::ID _lambda_d63480f72a49d2082d1e27bc3155bb9a_{ 1231062 };
+		inline constexpr REL::ID _lambda_d82ec403d6fa397ed31c217cc4b28817_{ 961104 };
+		inline constexpr REL::ID _lambda_de53ae0526549b9b00c33bdb878e18ca_{ 904950 };
+		inline constexpr REL::ID _lambda_de5fa4cfc080620cf719239da513c45b_{ 657519 };
+		inline constexpr REL::ID _lambda_df3f751e4063cc55eb9b1b40f2ea0816_{ 665664 };
+		inline constexpr REL::ID _lambda_e0e0472162cfbe6e8d034c0e6eba28aa_{ 1405008 };
+		inline constexpr REL::ID _lambda_e3889e3fd67be681b38effba84b8c044_{ 530777 };
+		inline constexpr REL::ID _lambda_e6a7dd0792c8290a0b473794b0ea4e78_{ 723364 };
+		inline constexpr REL::ID _lambda_ea9bd93468855e8c3ccd3d77bfacfc33_{ 604350 };
+		inline constexpr REL::ID _lambda_eaa26a7cf0e1aafa2e7090d8055fcbbc_{ 99540 };
+		inline constexpr REL::ID _lambda_ebb4163806b7c3891829b7867c6fae15_{ 386655 };
+		inline constexpr REL::ID _lambda_ebeec7fcb09a1d6d16a3aa7dfd103a48_{ 1277977 };
+		inline constexpr REL::ID _lambda_ec6ecb629c93fc27821aca8c19ff1dfa_{ 1504967 };
+		inline constexpr REL::ID _lambda_eccc8916bf1950f378565b7cb531f575_{ 1450810 };
+		inline constexpr REL::ID _lambda_ed11d247ed2a6d04fca7da0c6a8f81a7_{ 664058 };
+		inline constexpr REL::ID _lambda_eea0087e1385ac4b24f4c057e5d66995_{ 177416 };
+		inline constexpr REL::ID _lambda_f0b55f18912cae1fd1caa24112611e2d_{ 1021254 };
+		inline constexpr REL::ID _lambda_f3f42e8ea05bba59e9218dd3bb61c98d_{ 1213227 };
+		inline constexpr REL::ID _lambda_f84b8c60e39bd2e01c8ba533b9b1d54f_{ 714623 };
+		inline constexpr REL::ID _lambda_f95be250e8271d8ad375030edbfb2dd7_{ 1060694 };
+		inline constexpr REL::ID _lambda_fad6a62dfe7fdb293fc18fb1b8f8cdfb_{ 273557 };
+		inline constexpr REL::ID _lambda_fb41d256e3f31cb3f14a0df8a346ce0c_{ 846914 };
+		inline constexpr REL::ID _lambda_fc0b1edd0e44b87ee8f7b83612f47a7d_{ 788922 };
+		inline constexpr REL::ID _lambda_fde5815b1f49c19cc09e8cd360ecf410_{ 937334 };
+		inline constexpr REL::ID _lambda_fe01bf3e01c516b8dcf06685b35eeaa0_{ 848551 };
+	}
+}
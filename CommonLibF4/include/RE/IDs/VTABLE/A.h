@@ -0,0 +1,1841 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> AIProcess__PendingActorHeadData{ REL::ID(65996) };
+		inline constexpr std::array<REL::ID, 1> AStarSearch_BSFastNavmeshTriLocation_BSFastNavmeshEdgeHandle_3_{ REL::ID(271845) };
+		inline constexpr std::array<REL::ID, 1> AStarSearch_BSFastNavmeshTriLocation_void_3_{ REL::ID(1055931) };
+		inline constexpr std::array<REL::ID, 1> AStarSearch_BSNavmeshInfoconst_BSTSmartPointer_BSPathingDoor_BSTSmartPointerIntrusiveRefCount__22_{ REL::ID(682444) };
+		inline constexpr std::array<REL::ID, 1> AStarSearch_BSPathSmootherPOVNode_BSPathSmootherPOVLink_12_{ REL::ID(192334) };
+		inline constexpr std::array<REL::ID, 1> AStarSearch_CombatNavmeshSearchNode_BSFastNavmeshEdgeHandle_3_{ REL::ID(625566) };
+		inline constexpr std::array<REL::ID, 1> AStarSearch_ParentSpaceNode_TeleportLink_1_{ REL::ID(66184) };
+		inline constexpr std::array<REL::ID, 1> AbsorbEffect{ REL::ID(1096743) };
+		inline constexpr std::array<REL::ID, 1> AbstractHeap{ REL::ID(390304) };
+		inline constexpr std::array<REL::ID, 1> AccumulatingValueModifierEffect{ REL::ID(1069072) };
+		inline constexpr std::array<REL::ID, 1> ActionActivateDoneHandler{ REL::ID(273694) };
+		inline constexpr std::array<REL::ID, 1> ActionInput{ REL::ID(594599) };
+		inline constexpr std::array<REL::ID, 1> ActivateChoiceListener{ REL::ID(1246781) };
+		inline constexpr std::array<REL::ID, 1> ActivateHandler{ REL::ID(16994) };
+		inline constexpr std::array<REL::ID, 1> ActiveEffect{ REL::ID(1200790) };
+		inline constexpr std::array<REL::ID, 1> ActiveEffectReferenceEffectController{ REL::ID(336901) };
+		inline constexpr std::array<REL::ID, 1> ActiveEffect__ForEachHitEffectVisitor{ REL::ID(323059) };
+		inline constexpr std::array<REL::ID, 1> ActiveTriggers____hknpBSSpecificBodiesCollector{ REL::ID(468249) };
+		inline constexpr std::array<REL::ID, 17> Actor{ REL::ID(1455516), REL::ID(985925), REL::ID(61957), REL::ID(720550), REL::ID(1378017), REL::ID(453840), REL::ID(48089), REL::ID(1145017), REL::ID(613231), REL::ID(519904), REL::ID(1383399), REL::ID(459179), REL::ID(1117514), REL::ID(193789), REL::ID(851552), REL::ID(1510044), REL::ID(585842) };
+		inline constexpr std::array<REL::ID, 1> ActorKnowledge{ REL::ID(658361) };
+		inline constexpr std::array<REL::ID, 3> ActorMagicCaster{ REL::ID(1252765), REL::ID(361233), REL::ID(175123) };
+		inline constexpr std::array<REL::ID, 1> ActorMediator{ REL::ID(282945) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementDeltaSmoothedChannel_Actor_float_{ REL::ID(1340470) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___IMessageHandlerWrapper{ REL::ID(812809) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_CombatPathMovementMessage_{ REL::ID(1177328) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageActivateDoor_{ REL::ID(1191057) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageActorCollision_{ REL::ID(325) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageApproachingDoor_{ REL::ID(1443266) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageBlocked_{ REL::ID(266976) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageFreezeDirection_{ REL::ID(1051135) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageJump_{ REL::ID(785387) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageNewPath_{ REL::ID(659332) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessagePathComplete_{ REL::ID(1317036) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessagePathFailed_{ REL::ID(392944) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessagePlayIdle_{ REL::ID(924931) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageSetStaticPath_{ REL::ID(127039) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageUpdateRequestImmediate_{ REL::ID(253210) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageWarpToLocation_{ REL::ID(533052) };
+		inline constexpr std::array<REL::ID, 1> ActorMovementMessageMap_16___MessageHandlerWrapper_MovementMessageWarpToMultiple_{ REL::ID(519208) };
+		inline constexpr std::array<REL::ID, 1> ActorMover{ REL::ID(334518) };
+		inline constexpr std::array<REL::ID, 1> ActorPackageData{ REL::ID(1373528) };
+		inline constexpr std::array<REL::ID, 1> ActorSpeedSmoothedChannel_Actor_float_{ REL::ID(416342) };
+		inline constexpr std::array<REL::ID, 1> ActorState{ REL::ID(614888) };
+		inline constexpr std::array<REL::ID, 1> ActorTargetCheck{ REL::ID(1108294) };
+		inline constexpr std::array<REL::ID, 1> ActorTurnDeltaSmoothedChannel_Actor_float_{ REL::ID(150666) };
+		inline constexpr std::array<REL::ID, 1> ActorUtils__ArmorRatingVisitor{ REL::ID(1243904) };
+		inline constexpr std::array<REL::ID, 1> ActorUtils__ArmorRatingVisitorBase{ REL::ID(806843) };
+		inline constexpr std::array<REL::ID, 3> ActorValueInfo{ REL::ID(651546), REL::ID(1501706), REL::ID(530698) };
+		inline constexpr std::array<REL::ID, 1> ActorValueOwner{ REL::ID(100021) };
+		inline constexpr std::array<REL::ID, 1> Actor__ForEachSpellVisitor{ REL::ID(483230) };
+		inline constexpr std::array<REL::ID, 1> AddCellGrassTask{ REL::ID(1211956) };
+		inline constexpr std::array<REL::ID, 1> AddRagdollHandler{ REL::ID(133718) };
+		inline constexpr std::array<REL::ID, 1> AimModelPlayerComponent{ REL::ID(1226337) };
+		inline constexpr std::array<REL::ID, 1> AimModel__Component{ REL::ID(123955) };
+		inline constexpr std::array<REL::ID, 1> AlarmPackage{ REL::ID(653734) };
+		inline constexpr std::array<REL::ID, 13> AlchemyItem{ REL::ID(748301), REL::ID(81528), REL::ID(693359), REL::ID(1085055), REL::ID(599898), REL::ID(67835), REL::ID(1117910), REL::ID(1290768), REL::ID(1463651), REL::ID(492586), REL::ID(665731), REL::ID(838284), REL::ID(1010835) };
+		inline constexpr std::array<REL::ID, 1> AlertStateChangeHandler{ REL::ID(1535041) };
+		inline constexpr std::array<REL::ID, 1> AllowRotationHandler{ REL::ID(525934) };
+		inline constexpr std::array<REL::ID, 1> AnimatedCameraDeltaStartHandler{ REL::ID(1422278) };
+		inline constexpr std::array<REL::ID, 1> AnimatedCameraEndHandler{ REL::ID(498310) };
+		inline constexpr std::array<REL::ID, 1> AnimatedCameraStartHandler{ REL::ID(764626) };
+		inline constexpr std::array<REL::ID, 2> AnimationClipDataSingleton{ REL::ID(1110032), REL::ID(186177) };
+		inline constexpr std::array<REL::ID, 1> AnimationDrivenHandler{ REL::ID(1450109) };
+		inline constexpr std::array<REL::ID, 1> AnimationFileManagerSingleton{ REL::ID(379362) };
+		inline constexpr std::array<REL::ID, 1> AnimationObject{ REL::ID(235063) };
+		inline constexpr std::array<REL::ID, 1> AnimationObjectDrawHandler{ REL::ID(1562671) };
+		inline constexpr std::array<REL::ID, 1> AnimationObjectLoadHandler{ REL::ID(904283) };
+		inline constexpr std::array<REL::ID, 1> AnimationSpeedContour{ REL::ID(367916) };
+		inline constexpr std::array<REL::ID, 1> AnimationSpeedInformationDBData{ REL::ID(1345290) };
+		inline constexpr std::array<REL::ID, 1> AnimationStanceDataSingletonDBData{ REL::ID(990611) };
+		inline constexpr std::array<REL::ID, 1> AnimationStanceData_AnimationBoneTransform_{ REL::ID(916708) };
+		inline constexpr std::array<REL::ID, 1> AnimationStanceData_NiPoint3_{ REL::ID(305235) };
+		inline constexpr std::array<REL::ID, 1> AnimationStreamLoadGame{ REL::ID(87925) };
+		inline constexpr std::array<REL::ID, 1> AnimationStreamSaveGame{ REL::ID(871976) };
+		inline constexpr std::array<REL::ID, 2> AnimationSystemUtils__QueuedReferenceAnimationTask{ REL::ID(2315), REL::ID(740865) };
+		inline constexpr std::array<REL::ID, 2> AnimationSystemUtils__TESModelAndAnimationHandles{ REL::ID(902583), REL::ID(1201613) };
+		inline constexpr std::array<REL::ID, 1> AnticipateAttackHandler{ REL::ID(1505398) };
+		inline constexpr std::array<REL::ID, 1> AppResourceCaching____CacheESMOp{ REL::ID(1250461) };
+		inline constexpr std::array<REL::ID, 3> AppResourceCaching____Manager{ REL::ID(937569), REL::ID(13072), REL::ID(671908) };
+		inline constexpr std::array<REL::ID, 2> Archive{ REL::ID(757849), REL::ID(179129) };
+		inline constexpr std::array<REL::ID, 1> ArchiveFile{ REL::ID(837130) };
+		inline constexpr std::array<REL::ID, 1> ArrayArrayImplementation{ REL::ID(1380211) };
+		inline constexpr std::array<REL::ID, 1> ArrayOfTuplesImplementation{ REL::ID(654553) };
+		inline constexpr std::array<REL::ID, 1> ArrayOfTuplesImplementation__View{ REL::ID(1372519) };
+		inline constexpr std::array<REL::ID, 1> ArrowAttachHandler{ REL::ID(679989) };
+		inline constexpr std::array<REL::ID, 1> ArrowDetachHandler{ REL::ID(1337396) };
+		inline constexpr std::array<REL::ID, 8> ArrowProjectile{ REL::ID(1479747), REL::ID(1037470), REL::ID(113416), REL::ID(771781), REL::ID(1429498), REL::ID(505593), REL::ID(99733), REL::ID(1196702) };
+		inline constexpr std::array<REL::ID, 1> Atmosphere{ REL::ID(627676) };
+		inline constexpr std::array<REL::ID, 1> AttachDistant3DTask{ REL::ID(178426) };
+		inline constexpr std::array<REL::ID, 1> AttachReferenceHandler{ REL::ID(1255153) };
+		inline constexpr std::array<REL::ID, 1> AttackBlockHandler{ REL::ID(1001789) };
+		inline constexpr std::array<REL::ID, 1> AttackStateChangeHandler{ REL::ID(92535) };
+		inline constexpr std::array<REL::ID, 1> AttackStateChangeHandler0{ REL::ID(750892) };
+		inline constexpr std::array<REL::ID, 1> AttackStateChangeHandler1{ REL::ID(1408494) };
+		inline constexpr std::array<REL::ID, 1> AttackStateChangeHandler2{ REL::ID(484595) };
+		inline constexpr std::array<REL::ID, 1> AttackStateChangeHandler3{ REL::ID(1142677) };
+		inline constexpr std::array<REL::ID, 1> AttackStateChangeHandler4{ REL::ID(218691) };
+		inline constexpr std::array<REL::ID, 1> AttackStopHandler{ REL::ID(1126546) };
+		inline constexpr std::array<REL::ID, 1> AttackWinEndHandler{ REL::ID(468338) };
+		inline constexpr std::array<REL::ID, 1> AttackWinStartHandler{ REL::ID(1392412) };
+		inline constexpr std::array<REL::ID, 1> AttractionObjectLOSUtils__CacheEntry{ REL::ID(1567272) };
+		inline constexpr std::array<REL::ID, 1> AudioLoadForPlaybackTask{ REL::ID(723930) };
+		inline constexpr std::array<REL::ID, 1> AudioLoadToCacheTask{ REL::ID(630573) };
+		inline constexpr std::array<REL::ID, 1> AutoMoveHandler{ REL::ID(801872) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAcquireSearchDebugData_{ REL::ID(633023) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAimController_{ REL::ID(1258206) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAnimatedPath_{ REL::ID(508501) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatApproachTargetPathController_{ REL::ID(857264) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAreaHoldPosition_{ REL::ID(37221) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAreaReference_{ REL::ID(928647) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAreaShape_{ REL::ID(583403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatAreaStandard_{ REL::ID(1274266) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatChangePositionPathController_{ REL::ID(492987) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatChargingSearchData_{ REL::ID(197551) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatCluster_{ REL::ID(258455) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatCoverLocation_{ REL::ID(81077) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatCoverSearchDebugData_{ REL::ID(426378) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatCoverSearchResult_{ REL::ID(1317691) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatCoverSearch_{ REL::ID(972141) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatCoveredPathDebugData_{ REL::ID(374956) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatDisableActionController_{ REL::ID(57817) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatDisableAimController_{ REL::ID(1057745) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatEnterCoverPathController_{ REL::ID(772268) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatFindCoverPathSpeedController_{ REL::ID(202794) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatFlankingSearchData_{ REL::ID(1424763) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatFollowTargetPathController_{ REL::ID(1202901) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemGrenade_{ REL::ID(546138) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__{ REL::ID(1322516) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__{ REL::ID(1536846) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__{ REL::ID(168659) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__{ REL::ID(810676) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__{ REL::ID(1024338) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__{ REL::ID(382386) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__{ REL::ID(596702) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__{ REL::ID(512297) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__{ REL::ID(681085) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__{ REL::ID(894729) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__{ REL::ID(84367) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__{ REL::ID(466365) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__{ REL::ID(1238681) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__{ REL::ID(1452633) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__{ REL::ID(1108656) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__{ REL::ID(298155) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__{ REL::ID(431136) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__{ REL::ID(645644) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__{ REL::ID(859418) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__{ REL::ID(1501878) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__{ REL::ID(133212) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__{ REL::ID(1073400) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__{ REL::ID(1287476) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__{ REL::ID(1203472) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__{ REL::ID(1371375) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__{ REL::ID(2757) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__{ REL::ID(775526) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__{ REL::ID(1157655) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__{ REL::ID(347091) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__{ REL::ID(561421) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__{ REL::ID(217485) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__{ REL::ID(989028) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__{ REL::ID(777182) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__{ REL::ID(990635) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__{ REL::ID(1205154) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__{ REL::ID(264785) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__{ REL::ID(478658) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__{ REL::ID(1418751) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__{ REL::ID(50607) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__{ REL::ID(1548930) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__{ REL::ID(134879) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__{ REL::ID(348730) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__{ REL::ID(1120688) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__{ REL::ID(1503510) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__{ REL::ID(693089) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__{ REL::ID(906808) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__{ REL::ID(563042) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__{ REL::ID(1334574) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__{ REL::ID(85979) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__{ REL::ID(299818) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__{ REL::ID(513942) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__{ REL::ID(1155971) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__{ REL::ID(1369752) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__{ REL::ID(728334) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__{ REL::ID(941932) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__{ REL::ID(857797) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__{ REL::ID(1025966) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__{ REL::ID(1240349) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__{ REL::ID(429561) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__{ REL::ID(812268) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__{ REL::ID(1178) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__{ REL::ID(215931) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__{ REL::ID(1454281) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__{ REL::ID(644000) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemMelee_{ REL::ID(1437019) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemOneHandedBlock_{ REL::ID(1582564) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemRanged_{ REL::ID(200581) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemShield_{ REL::ID(1237027) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemThrown_{ REL::ID(891449) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatInventoryItemTorch_{ REL::ID(345517) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterArmor_{ REL::ID(977014) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterBoundItem_{ REL::ID(1191216) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterChameleon_{ REL::ID(1405050) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterCloak_{ REL::ID(464679) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterDisarm_{ REL::ID(679451) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterInvisibility_{ REL::ID(36707) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterLight_{ REL::ID(251034) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterOffensive_{ REL::ID(167010) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterParalyze_{ REL::ID(335147) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterReanimate_{ REL::ID(549367) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterRestore_{ REL::ID(1320890) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterScript_{ REL::ID(121098) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterStagger_{ REL::ID(893108) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterSummon_{ REL::ID(1107018) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterTargetEffect_{ REL::ID(763376) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMagicCasterWard_{ REL::ID(1535224) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMantlePathController_{ REL::ID(1117445) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMatchTargetAimController_{ REL::ID(1403222) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMeleeAimController_{ REL::ID(366764) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMeleeDebugData_{ REL::ID(296918) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatMovementRequestFollowActor_{ REL::ID(656418) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__{ REL::ID(476465) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__{ REL::ID(186359) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__{ REL::ID(331344) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ REL::ID(1057419) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1534262) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ REL::ID(482403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ REL::ID(1347635) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(600330) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1229991) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1411642) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ REL::ID(1273303) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1541639) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(1090133) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ REL::ID(127828) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1055875) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ REL::ID(289168) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(1273501) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(423728) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(719491) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(91710) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1556371) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ REL::ID(740370) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__{ REL::ID(912305) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__{ REL::ID(767249) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ REL::ID(896970) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ REL::ID(1042078) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__{ REL::ID(621899) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__{ REL::ID(40664) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__{ REL::ID(751912) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__{ REL::ID(460853) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__{ REL::ID(606546) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__{ REL::ID(1478192) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ REL::ID(1187425) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ REL::ID(1332428) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__{ REL::ID(29096) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__{ REL::ID(131031) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__{ REL::ID(1422609) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__{ REL::ID(1568341) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ REL::ID(712484) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1188629) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ REL::ID(136944) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ REL::ID(1002174) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(254757) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(884358) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1066287) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ REL::ID(927677) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1196119) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(744943) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ REL::ID(1364271) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(710946) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ REL::ID(1526323) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(927872) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(78430) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(373542) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1328264) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1210961) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ REL::ID(394502) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__{ REL::ID(566923) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__{ REL::ID(421388) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ REL::ID(551671) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ REL::ID(697052) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__{ REL::ID(276316) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__{ REL::ID(1277625) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__{ REL::ID(406040) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__{ REL::ID(115665) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__{ REL::ID(260890) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__{ REL::ID(1132289) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ REL::ID(841968) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ REL::ID(986896) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__{ REL::ID(1167575) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__{ REL::ID(876954) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__{ REL::ID(1022179) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ REL::ID(166446) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(643055) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ REL::ID(1173497) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ REL::ID(456295) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(1291183) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(338574) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(520697) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ REL::ID(381911) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(650457) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(199161) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ REL::ID(818933) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(164788) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ REL::ID(980157) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(382093) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1114795) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(1409817) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(782911) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(665195) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ REL::ID(1430850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__{ REL::ID(20571) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__{ REL::ID(1458129) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ REL::ID(5039) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ REL::ID(151036) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__{ REL::ID(1312712) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__{ REL::ID(732212) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__{ REL::ID(1442648) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__{ REL::ID(1152121) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__{ REL::ID(1297338) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__{ REL::ID(586825) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ REL::ID(295949) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ REL::ID(441121) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__{ REL::ID(822112) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__{ REL::ID(531760) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__{ REL::ID(677155) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__{ REL::ID(1402910) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(297173) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__{ REL::ID(828021) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__{ REL::ID(111058) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(945612) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1575603) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(175385) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__{ REL::ID(36227) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(304722) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(1435530) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__{ REL::ID(473201) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(1401290) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__{ REL::ID(635076) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(36422) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(769546) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__{ REL::ID(1064476) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(436953) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__{ REL::ID(319425) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__{ REL::ID(1085526) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__{ REL::ID(1257875) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__{ REL::ID(1112531) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__{ REL::ID(1242573) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__{ REL::ID(1387441) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__{ REL::ID(967239) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__{ REL::ID(386281) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__{ REL::ID(1097219) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__{ REL::ID(806892) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__{ REL::ID(951936) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__{ REL::ID(241122) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__{ REL::ID(1533014) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__{ REL::ID(95849) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathingDebugData_{ REL::ID(670101) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathingSearchArea_{ REL::ID(324274) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPathingTweener_{ REL::ID(1548395) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatPositionTracker_{ REL::ID(1427308) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatProjectileAimController_{ REL::ID(712813) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatProjectileDebugData_{ REL::ID(166760) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatSuppressiveFireBehavior_{ REL::ID(1298340) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetLocationSearchResult_{ REL::ID(1160909) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetLocationSearch_{ REL::ID(815497) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetLocation_{ REL::ID(469626) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetSelectorFixed_{ REL::ID(1547049) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetSelectorPreferred_{ REL::ID(1201594) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetSelectorRandom_{ REL::ID(310175) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTargetSelectorStandard_{ REL::ID(855922) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatThreatExplosion_{ REL::ID(348271) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatThreatLOF_{ REL::ID(1039292) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatThreatMelee_{ REL::ID(1384721) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatThreatProjectile_{ REL::ID(694276) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTrackTargetAimController_{ REL::ID(20887) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatTunnelPathController_{ REL::ID(1210761) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatViewControllerGlance_{ REL::ID(371172) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatViewControllerPath_{ REL::ID(717167) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_CombatViewControllerStandard_{ REL::ID(25309) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCombatObject_DiveBombPathController_{ REL::ID(1505078) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1520582), REL::ID(815731), REL::ID(110840), REL::ID(988102) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_CombatPathDestinationActor_{ REL::ID(468485), REL::ID(1346010), REL::ID(641710), REL::ID(1519196) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_CombatPathDestinationActor_{ REL::ID(1333857), REL::ID(629545), REL::ID(1507157), REL::ID(802250) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(586631), REL::ID(1464073), REL::ID(759411), REL::ID(54320) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1216397), REL::ID(511402), REL::ID(1388682), REL::ID(684489) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1397930), REL::ID(693749), REL::ID(1571187), REL::ID(865959) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationActor_{ REL::ID(1259594), REL::ID(554927), REL::ID(1431986), REL::ID(727873) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1527952), REL::ID(823081), REL::ID(118194), REL::ID(995561) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(1076420), REL::ID(371651), REL::ID(1249436), REL::ID(544706) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_CombatPathDestinationActor_{ REL::ID(114024), REL::ID(991317), REL::ID(286712), REL::ID(1164406) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1042110), REL::ID(337393), REL::ID(1215211), REL::ID(510195) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_CombatPathDestinationFollowActor_{ REL::ID(275628), REL::ID(1153055), REL::ID(448102), REL::ID(1325645) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(1259774), REL::ID(555107), REL::ID(1432181), REL::ID(728042) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(409947), REL::ID(1287620), REL::ID(583065), REL::ID(1460514) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(705756), REL::ID(1582981), REL::ID(877963), REL::ID(173539) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(78016), REL::ID(955464), REL::ID(250749), REL::ID(1128059) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1542544), REL::ID(837735), REL::ID(132917), REL::ID(1010286) };
+		inline constexpr std::array<REL::ID, 4> AutoRegisterCombatPathingRequestGenericPath_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_CombatPathDestinationLocation_{ REL::ID(726692), REL::ID(21102), REL::ID(899079), REL::ID(194621) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(283540), REL::ID(1161123), REL::ID(237049), REL::ID(1114407), REL::ID(409521), REL::ID(1287223) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_CombatPathDestinationActor_{ REL::ID(814346), REL::ID(109499), REL::ID(767768), REL::ID(62772), REL::ID(940279), REL::ID(235711) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_CombatPathDestinationActor_{ REL::ID(97293), REL::ID(974650), REL::ID(50566), REL::ID(928136), REL::ID(223582), REL::ID(1101030) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(931876), REL::ID(227298), REL::ID(885290), REL::ID(180753), REL::ID(1057938), REL::ID(353188) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1561901), REL::ID(856893), REL::ID(1515307), REL::ID(810441), REL::ID(105588), REL::ID(982824) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(161555), REL::ID(1038779), REL::ID(114680), REL::ID(991987), REL::ID(287333), REL::ID(1165068) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationActor_{ REL::ID(22298), REL::ID(900249), REL::ID(1558529), REL::ID(853567), REL::ID(148896), REL::ID(1026179) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(290849), REL::ID(1168554), REL::ID(244432), REL::ID(1121811), REL::ID(416939), REL::ID(1294555) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(1421741), REL::ID(717624), REL::ID(1375090), REL::ID(670861), REL::ID(1548199), REL::ID(843368) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_CombatPathDestinationActor_{ REL::ID(459297), REL::ID(1336846), REL::ID(412785), REL::ID(1290488), REL::ID(585955), REL::ID(1463362) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(1387469), REL::ID(683325), REL::ID(1340841), REL::ID(636480), REL::ID(1514110), REL::ID(809206) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_CombatPathDestinationFollowActor_{ REL::ID(621243), REL::ID(1498975), REL::ID(574618), REL::ID(1452098), REL::ID(747503), REL::ID(42331) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(22485), REL::ID(900449), REL::ID(1558720), REL::ID(853758), REL::ID(149098), REL::ID(1026361) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(755898), REL::ID(50768), REL::ID(709518), REL::ID(3617), REL::ID(881653), REL::ID(177201) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_CombatPathDestinationLocation_{ REL::ID(1050789), REL::ID(345913), REL::ID(1003981), REL::ID(299276), REL::ID(1176950), REL::ID(471952) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(423267), REL::ID(1300841), REL::ID(376800), REL::ID(1254359), REL::ID(549789), REL::ID(1426823) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_CombatPathDestinationNone_{ REL::ID(305645), REL::ID(1183260), REL::ID(259060), REL::ID(1136481), REL::ID(431535), REL::ID(1309232) };
+		inline constexpr std::array<REL::ID, 6> AutoRegisterCombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_CombatPathDestinationLocation_{ REL::ID(1071752), REL::ID(366986), REL::ID(1025035), REL::ID(320354), REL::ID(1198112), REL::ID(493041) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ActionActivateDoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1349764) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AddRagdollHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1248588) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AlertStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(309759) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AllowRotationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1122109) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimatedCameraDeltaStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1124432) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimatedCameraEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1470264) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimatedCameraStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(779294) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationDrivenHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(995884) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationObjectDrawHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(727472) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationObjectLoadHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(381492) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationSpeedInformationDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(813634) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationStanceDataSingletonDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(458613) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationStanceData_AnimationBoneTransform__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ REL::ID(244942) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnimationStanceData_NiPoint3__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ REL::ID(777162) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AnticipateAttackHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(459148) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ArrowAttachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(121672) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ArrowDetachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(247775) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttachReferenceHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(918168) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStateChangeHandler0_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(915851) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStateChangeHandler1_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1041954) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStateChangeHandler2_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1168172) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStateChangeHandler3_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1294211) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStateChangeHandler4_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1420145) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(790009) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(415636) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackWinEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(289527) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AttackWinStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(163705) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AwakeSoundFadeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(531641) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AwakeSoundPauseHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(783951) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AwakeSoundResumeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(909908) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_AwakeSoundStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(657879) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSAIWorldLocationInteriorCell_BGSAIWorldLocationFactory_{ REL::ID(1271490) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSAIWorldLocationPointRadius_BGSAIWorldLocationFactory_{ REL::ID(1229) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSAIWorldLocationPrimitive_BGSAIWorldLocationFactory_{ REL::ID(958814) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSAIWorldLocationRefRadius_BGSAIWorldLocationFactory_{ REL::ID(314470) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSAutoWeaponSoundDef_BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ REL::ID(718043) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSCompoundSoundDef_BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ REL::ID(635323) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSConveyorBelt__ConveyorBelt_BSTCreateFactoryManager_unsignedint_InitActionI_16__{ REL::ID(153485) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSMotorAction__FanMotor_BSTCreateFactoryManager_unsignedint_InitActionI_16__{ REL::ID(1255600) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSMusicPaletteTrack_BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ REL::ID(1556028) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSMusicSilenceTrack_BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ REL::ID(226015) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSMusicSingleTrack_BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ REL::ID(697934) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataBool_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(244060) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataFloat_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1307953) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataInt_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(776285) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataLocationWrapper_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1294228) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataLocation_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1321642) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataObjectList_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1220401) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataRefOLD_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(257825) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataRef_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(487784) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataTargetSelector_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(790030) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSPackageDataTopic_BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1444877) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureAcquireExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(950436) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureAcquire_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(77649) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureActivateExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(418262) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureActivate_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1026014) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureDialogueActivateExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(544803) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureDialogueActivate_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1182194) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureDialogueExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(451007) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureDialogue_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(140254) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureDoneExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1501930) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureDone_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(225989) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureEatExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1188944) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureEat_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(562411) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureEscortExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(876149) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureEscort_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1543850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFindExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(563797) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFind_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(830627) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFleeExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(31253) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFlee_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(855031) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFlightGrabExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1520898) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFlightGrab_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(314685) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFollowExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(988387) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFollowTo_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1068260) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureFollow_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1427392) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureForceGreet_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1325782) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureGuardArea_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(791167) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureGuardExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(676362) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureGuard_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(884133) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureHeadtrackExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(143990) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureHeadtrack_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(50627) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureHoldPositionExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(50661) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureHoldPosition_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1267999) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureHoverExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1320275) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureHover_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1432051) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureKeepAnEyeOnExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1227338) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureKeepAnEyeOn_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1470734) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureLockUnlockExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1133814) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureLock_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(417021) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureOrbitExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(821339) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureOrbit_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(222475) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedurePatrolExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(508636) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedurePatrol_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1516667) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedurePlayIdleExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1559086) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedurePlayIdle_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(640319) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedurePursue_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(630818) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureRangeExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(626565) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureRange_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(820571) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSandboxExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1246441) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSandbox_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(907308) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSayExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(714716) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSay_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1430670) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSitSleepExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(621145) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSit_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(158374) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureSleep_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1208677) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureStayAwayExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(89054) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureStayAway_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(392443) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTravelExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1139197) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTravel_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(621562) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeProcedure_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(160969) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeRandomExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1263125) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeRandom_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(931277) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeSequenceExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1276835) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeSequence_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(67631) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeSimultaneousExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(212936) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeSimultaneous_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(1244105) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeStackedExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(745027) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureTreeStacked_BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(1336931) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUnlock_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(323891) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUseIdleMarkerExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1046016) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUseIdleMarker_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(492148) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUseMagicExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(952794) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUseMagic_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1474035) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUseWeaponExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(420583) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureUseWeapon_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(359973) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureWaitExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1471218) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureWait_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1322299) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureWanderExecState_BGSProcedureTreeExecStateFactory_{ REL::ID(1158409) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSProcedureWander_BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(516046) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGSStandardSoundDef_BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ REL::ID(1091196) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGShkMatFadeController_BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ REL::ID(1482741) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BGShkPhonemeController_BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ REL::ID(38706) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BSAudioEffects__BSDelayEffectParams_BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ REL::ID(1466657) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BSAudioEffects__BSOverdriveParams_BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ REL::ID(1433447) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BSAudioEffects__BSStateVariableFilterParams_BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ REL::ID(1559991) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BSPathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(644708) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BSPathingSolution_BSTSmartPointerPathingFactoryManager_BSPathingSolution_64__{ REL::ID(700000) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BSXAudio2Audio_BSTCreateFactoryManager_BSFixedString_BSAudio_4__{ REL::ID(254353) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BShkVisibilityController_BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ REL::ID(76863) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BShkbHkxDB__ProjectDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(430000) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BShkbHkxDB__hkxDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(962163) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BedEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(837854) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BedFurnitureExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1090006) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BowDrawnHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(88824) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BowReleaseHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1577918) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BowZoomStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(373856) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_BowZoomStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(499912) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CameraOverrideStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1443905) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CameraOverrideStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(207348) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CameraShakeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(617832) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ChairEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(712158) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ChairFurnitureExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(744785) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CollectionAnimationSpeedContour_BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ REL::ID(1124619) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAcquireSearchDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1337319) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(380552) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAnimatedPath_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1213540) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatApproachTargetPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1562293) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAreaHoldPosition_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(742465) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAreaReference_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(51122) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAreaShape_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1287938) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatAreaStandard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(396599) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatChangePositionPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1198051) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatChargingSearchData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(902110) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatCluster_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(963125) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatCoverLocation_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(786019) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatCoverSearchDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1131177) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatCoverSearchResult_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(440078) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatCoverSearch_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(94785) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatCoveredPathDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1079691) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatDisableActionController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(762877) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatDisableAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(180562) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatEnterCoverPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1477105) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatFindCoverPathSpeedController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(907441) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatFlankingSearchData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(547756) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatFollowTargetPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(325220) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemGrenade_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1250814) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(444888) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(659487) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(873082) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1515525) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(147044) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1087185) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1301123) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1217349) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1385167) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(16676) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(789288) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1171382) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(360879) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(575147) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(231280) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1002882) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1136079) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1349967) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1564495) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(624144) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(838052) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(196224) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(409792) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(325782) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(493970) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(708626) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1480412) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(280093) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1052006) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1266102) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(922064) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(111801) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1482030) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(113383) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(327409) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(969369) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1183545) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(541677) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(755747) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(671585) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(839637) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1053624) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(243281) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(625815) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1397307) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(28870) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1267726) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(457018) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(790899) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1004503) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1219004) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(278491) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(492353) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1432468) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(64437) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1562860) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(148670) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(362512) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1134449) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1517097) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(706967) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(920443) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(576760) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1348367) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemMelee_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(559805) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemOneHandedBlock_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(705374) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemRanged_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(905139) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemShield_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(359249) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemThrown_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(13448) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatInventoryItemTorch_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1050367) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterArmor_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(99699) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterBoundItem_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(313671) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterChameleon_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(527794) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterCloak_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1169747) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterDisarm_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1383549) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterInvisibility_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(741991) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterLight_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(955758) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterOffensive_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(871414) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterParalyze_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1039767) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterReanimate_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1253966) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterRestore_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(443287) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterScript_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(825940) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterStagger_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(15045) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterSummon_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(229640) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterTargetEffect_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1468066) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMagicCasterWard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(657848) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMantlePathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(240055) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMatchTargetAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(525895) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMeleeAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1071546) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMeleeDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1001684) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatMovementRequestFollowActor_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1360601) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathMovementMessageEvent_CombatPathTeleportEvent__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1016176) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1181364) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(890888) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1035963) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(180245) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(656854) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1187263) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(470094) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1304815) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(352264) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(534573) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(395680) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(664249) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(212839) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(832600) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(178626) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(993887) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(395878) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1128497) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1423614) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(796719) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(679167) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1444805) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(34502) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1472051) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(18980) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(164750) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1326394) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(745841) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1456531) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1165988) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1311085) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(600525) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(309885) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(454843) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(734589) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(835850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(545592) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(690890) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1416587) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(311065) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(841778) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(124850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(959421) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(6315) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(189208) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(50120) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(318581) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1449553) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(487018) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1414966) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(648778) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(50305) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(783364) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1078264) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(450653) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(333242) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1099400) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1271587) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1126182) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1256218) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1401255) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(980855) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(399950) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1110926) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(820498) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(965611) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(254944) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1546757) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(109652) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(289881) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1581997) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(144781) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(870851) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1347409) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(295760) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1161359) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(413467) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1043334) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1225575) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1086712) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1354802) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(903728) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1523834) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(869214) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(102898) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1086914) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(237451) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(532708) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1487738) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1369449) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(553801) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(726157) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(580711) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(710915) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(855626) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(435017) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1436436) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(565324) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(274712) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(419779) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1291351) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1000709) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1146032) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1527011) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1236481) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1381379) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(525568) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1001943) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1532837) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(815941) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(68244) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(698357) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(879784) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(741528) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1009370) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(558362) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1178124) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(523990) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1339396) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(741706) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1474409) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(187319) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1141901) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1024035) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(208238) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(380210) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(235182) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(364811) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(510159) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(89839) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1091049) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(219738) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1511679) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(74479) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(945820) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(655689) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(800790) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1374371) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestAdapter_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(604201) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestCovered_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1312765) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(889742) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1420106) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(703924) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1538195) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(585759) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(767710) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(629109) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(897235) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(445558) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1065651) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(411399) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1227427) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(629288) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1361512) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(74759) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1029453) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(911888) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(95659) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestMultiGoal_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(949587) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingRequestStandard_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(258605) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingSearchArea_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1028989) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPathingTweener_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(671024) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatPositionTracker_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(550306) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatProjectileAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1416921) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatProjectileDebugData_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(871187) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatSearchLockData_BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ REL::ID(464374) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatSuppressiveFireBehavior_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(420740) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetLocationSearchResult_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(283336) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetLocationSearch_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1520378) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetLocation_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1174640) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetSelectorFixed_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(669678) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetSelectorPreferred_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(323836) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetSelectorRandom_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1014838) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTargetSelectorStandard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1560942) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatThreatExplosion_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1053154) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatThreatLOF_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(162044) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatThreatMelee_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(507376) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatThreatProjectile_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1398428) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTrackTargetAimController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(726483) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatTunnelPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(333032) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatViewControllerGlance_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1075978) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatViewControllerPath_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1421266) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CombatViewControllerStandard_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(730853) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CullFurnitureBoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(394546) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_CullWeaponsHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1085573) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DeathEmoteHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(744102) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DeathStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1224111) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DesyncInteractionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(42903) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DisableCharacterBumperHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1113809) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DisableCharacterPitchHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1417835) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DisableCollisionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(2569) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DiveBombPathController_BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(627435) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_DoNotInterruptAnimationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(934271) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_EjectShellCasingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(177783) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_EnableCharacterBumperHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(768508) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_EnableCharacterPitchHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1072521) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_EnableCollisionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1459417) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_EndSummonAnimationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(752515) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FaceEmotionalIdleHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1516249) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightActionEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(475446) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightActionEntryEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(130007) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightActionGrabHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(601798) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightActionHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(3280) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightActionReleaseHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(728141) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightCrashLandStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1073209) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightCruisingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(829420) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightHoveringHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(955567) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightLandEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1460144) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightLandHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1333708) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightLandingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1081613) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightPerchingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1207998) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_FlightTakeOffHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(703767) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_GetUpEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(609456) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_GetUpStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(483190) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_GunDownStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(562172) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_HeadTrackingOffHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1545024) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_HeadTrackingOnHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1418539) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_HeadTrackingRotationOffHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(101123) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_HeadTrackingRotationOnHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1337627) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_HitFrameHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(552915) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_HolotapeLoadedHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1389609) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_IdleDialogueEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(307401) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_IdleDialogueExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(653198) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_IdleFlavorHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(446320) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_IndividualClipAnimationSpeedContour_BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ REL::ID(606607) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_InterruptCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(626314) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_JumpAnimEventHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(181511) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_KillActorHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(577243) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_KillMoveEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(365402) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_KillMoveStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(239389) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_KnockdownHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(429596) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_KnockdownTargetHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(556135) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_LeftHandSpellCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1485595) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_LeftHandSpellFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(668304) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_LoopingActivateHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1378895) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MotionDrivenHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(869781) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MountDismountEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(642433) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MountInteraction_BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ REL::ID(737454) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementAgentActorAvoider_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(679665) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementAgentActorState_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(679430) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementAgentPathFollowerFlight_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1405926) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementAgentPathFollowerStandard_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1413374) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementAgentPathFollowerVirtual_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(846532) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentAngleGain_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(259548) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentAnglePassThrough_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1062904) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentAnimationDriven_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(19920) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentDirectControl_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(668792) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentDirectionPassThrough_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(783415) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentGraphDrivenAnimationDriven_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1322675) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentPlayerControlsActionTrigger_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1079786) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentPlayerControls_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(922236) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentSpeedPassThrough_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1342509) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentSprintActionTrigger_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(380345) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentStairsHelper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(306200) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentStandard_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1202285) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentStorePlannerOutput_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1528665) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerAgentStrafing_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(64653) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementHandlerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(1126723) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageActivateDoor_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1280691) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageActorCollision_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(731657) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageBlocked_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(235929) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageFreezeDirection_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1217330) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageJump_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(241171) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageNewPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(376597) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessagePathComplete_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(722490) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessagePathFailed_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1067460) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessagePlayIdle_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(222177) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageSetStaticPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(35270) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageWarpToLocation_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(608924) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementMessageWarpToMultiple_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(422170) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementParametersFixed_BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ REL::ID(932185) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementParameters_BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ REL::ID(586967) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPathManagerAgentAvoidBox_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(900931) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPathManagerAgentLoadedAreaMonitor_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(271122) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPathManagerAgentStaticAvoider_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(751966) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPathManagerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(660155) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPlannerAgentDirectControl_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1062988) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPlannerAgentNavmeshBounds_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1007773) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPlannerAgentWarp_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1068279) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPlannerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(1003081) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementPostUpdateArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(260243) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementStateFollowPath_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1303661) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementStateTweener_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(892627) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementTweenerAgentFixedDelta_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1068684) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementTweenerAgentNodeFollower_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(103029) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementTweenerAgentTargetPosAndVel_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(977219) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_MovementTweenerArbiter_BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(783895) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_NPCAttachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(233422) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_NPCDetachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(359291) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PairedAttackDialogueHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1035841) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PairedStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(491477) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PassengerInteraction_BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ REL::ID(69439) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingCell_BSTSmartPointerPathingFactoryManager_BSPathingCell_64__{ REL::ID(1558327) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingDoor_BSTSmartPointerPathingFactoryManager_BSPathingDoor_64__{ REL::ID(1138483) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingLockData_BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ REL::ID(1409637) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestClosePoint_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(449559) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestClosestGoal_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(874723) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestCover_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(408449) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFlee_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(222209) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFlyAction_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1431099) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFlyHover_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1244976) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFlyLand_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1058200) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFlyOrbit_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(871663) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFlyTakeOff_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(685645) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestFly_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(35306) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestHide_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(937484) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestLOS_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(751302) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestOptimalLocation_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(564700) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestRotate_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(816912) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestSafeStraightLine_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(630564) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequestStopMoving_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(882463) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(79933) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PerformActivationHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(572882) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PickNewIdleHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1097828) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PipboyBootSequenceHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1044282) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PitchOverrideEndHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(831084) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PitchOverrideStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(485533) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerBedEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(105620) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerChairEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1216435) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerFastEquipSoundHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1279843) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerFurnitureExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(231773) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerSightedStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(444008) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerSneakStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1033545) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_PlayerTerminalEnterHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1342120) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_QuestPathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1357795) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RagdollAndGetUpHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(516065) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RagdollStartHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1501040) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ReadyStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(435623) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RecoilStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(542218) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ReevaluateGraphStateHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1505616) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RelaxedStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1546648) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ReloadCompleteHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1555114) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ReloadStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1209636) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RemoveRagdollHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1374250) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RightHandSpellCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(248523) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_RightHandSpellFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1013425) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SandManKillHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(303611) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SightedStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(98754) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SneakStateChangeHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(907544) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SpeedSampledAnimationSpeedContour_BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ REL::ID(74530) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_StaggeredStopHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(585806) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_StartFloatingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(129306) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_StartPCapVoiceHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(51369) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_StopFloatingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(255488) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_StopMountCameraHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(113209) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SubgraphAndOffsetDBData_BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(783892) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SyncDeferDeathHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(682501) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_SyncEarlyExitHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(808392) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_UncullBoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(268608) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_UncullFurnitureBoneHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(740423) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_UncullWeaponsHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1212007) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_UpdateSightedHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(388478) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_UseStealthBoyHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(405254) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_UseStimpakHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(279197) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_VoiceSpellCastHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(594186) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_VoiceSpellFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1358830) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponAttachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1381246) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponBeginDrawHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(720516) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponBeginSheatheHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(846173) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponDetachHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1507888) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponDrawHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1191733) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponFireHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1083263) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponSheatheHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1317725) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_WeaponSwingHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(37259) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator_ZeroPitchHandler_BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(957182) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator___MovementHandlerAgentAngleControllerLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1116267) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator___MovementHandlerAgentLargeDeltaLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1461963) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator___MovementHandlerAgentTranslationControllerLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(225226) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator___MovementPlannerAgentHorseControlsLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(829119) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterCreator___MovementPlannerAgentKeepOffsetLoadScrapper_BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1174625) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ActionActivateDoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(472316) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AddRagdollHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(370759) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AlertStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1014402) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AllowRotationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(244776) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimatedCameraDeltaStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(247095) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimatedCameraEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(592772) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimatedCameraStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1484179) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationDrivenHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(118539) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationObjectDrawHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1431577) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationObjectLoadHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1086310) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationSpeedInformationDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(1518456) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationStanceDataSingletonDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(1163734) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationStanceData_AnimationBoneTransform__IAnimationStanceData__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ REL::ID(949636) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnimationStanceData_NiPoint3__IAnimationStanceData__BSTCreateFactoryManager_BSFixedString_IAnimationStanceData_4__{ REL::ID(1482015) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AnticipateAttackHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1164265) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ArrowAttachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(826440) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ArrowDetachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(952544) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttachReferenceHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(40545) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler0_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(38193) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler1_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(164629) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler2_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(290476) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler3_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(416570) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler4_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(543139) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1494891) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1120504) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackWinEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(994261) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AttackWinStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(868131) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AwakeSoundFadeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1236369) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AwakeSoundPauseHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1488769) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AwakeSoundResumeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(31939) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_AwakeSoundStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1362065) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationInteriorCell_IAIWorldLocation__BGSAIWorldLocationFactory_{ REL::ID(393830) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationPointRadius_IAIWorldLocation__BGSAIWorldLocationFactory_{ REL::ID(707025) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationPrimitive_IAIWorldLocation__BGSAIWorldLocationFactory_{ REL::ID(81341) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSAIWorldLocationRefRadius_IAIWorldLocation__BGSAIWorldLocationFactory_{ REL::ID(1019090) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSAutoWeaponSoundDef_BGSSoundDescriptor__BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ REL::ID(1422162) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSCompoundSoundDef_BGSSoundDescriptor__BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ REL::ID(1339628) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSConveyorBelt__ConveyorBelt_InitActionI__BSTCreateFactoryManager_unsignedint_InitActionI_16__{ REL::ID(858032) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSMotorAction__FanMotor_InitActionI__BSTCreateFactoryManager_unsignedint_InitActionI_16__{ REL::ID(378040) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSMusicPaletteTrack_BSIMusicTrack__BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ REL::ID(678800) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSMusicSilenceTrack_BSIMusicTrack__BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ REL::ID(930596) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSMusicSingleTrack_BSIMusicTrack__BSTCreateFactoryManager_unsignedint_BSIMusicTrack_8__{ REL::ID(1402089) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataBool_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(948747) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataFloat_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(430297) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataInt_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1481157) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataLocationWrapper_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(416590) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataLocation_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(444031) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataObjectList_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(342566) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataRefOLD_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(962466) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataRef_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1192695) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataTargetSelector_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(1494909) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSPackageDataTopic_IPackageData__BSTCreateFactoryManager_BSFixedString_IPackageData_256__{ REL::ID(567532) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureAcquireExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(73001) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureAcquire_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(782569) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureActivateExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1123037) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureActivate_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(148716) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogueActivateExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1249518) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogueActivate_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(304579) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogueExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1156033) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDialogue_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(845057) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDoneExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(624200) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureDone_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(930572) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEatExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(311374) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEat_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1267068) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEscortExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1581141) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureEscort_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(666466) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFindExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1268491) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFind_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1535482) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFleeExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(736749) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFlee_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1560017) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFlightGrabExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(643365) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFlightGrab_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1019325) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFollowExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(111144) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFollowTo_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(191182) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureFollow_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(550386) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureForceGreet_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(448231) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureGuardArea_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1496026) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureGuardExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1380553) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureGuard_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(6090) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHeadtrackExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(848734) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHeadtrack_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(755771) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHoldPositionExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(755803) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHoldPosition_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(390329) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHoverExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(442673) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureHover_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(554980) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureKeepAnEyeOnExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(349502) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureKeepAnEyeOn_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(593240) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureLockUnlockExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(256443) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureLock_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1121898) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureOrbitExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1526226) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureOrbit_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(927010) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePatrolExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1213682) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePatrol_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(639135) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePlayIdleExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(681852) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePlayIdle_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1344669) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedurePursue_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1335064) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureRangeExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1330974) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureRange_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1525504) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSandboxExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(368683) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSandbox_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(29390) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSayExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1418809) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSay_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(553621) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSitSleepExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1325542) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSit_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(862863) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureSleep_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(330969) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureStayAwayExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(793991) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureStayAway_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1097320) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTravelExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(261740) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTravel_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1326024) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeProcedure_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(865400) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeRandomExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(385464) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeRandom_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(53723) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSequenceExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(399193) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSequence_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(772547) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSimultaneousExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(917494) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeSimultaneous_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(366356) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeStackedExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1449638) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureTreeStacked_IProcedureTreeItem__BSTCreateFactoryManager_BSFixedString_IProcedureTreeItem_32__{ REL::ID(459379) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUnlock_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1028621) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseIdleMarkerExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(168707) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseIdleMarker_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1197180) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseMagicExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(75335) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseMagic_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(596496) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseWeaponExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(1125418) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureUseWeapon_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1064784) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWaitExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(593717) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWait_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(444687) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWanderExecState_IProcedureTreeExecState__BGSProcedureTreeExecStateFactory_{ REL::ID(280830) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSProcedureWander_IProcedure__BSTCreateFactoryManager_BSFixedString_IProcedure_256__{ REL::ID(1221096) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGSStandardSoundDef_BGSSoundDescriptor__BSTCreateFactoryManager_unsignedint_BGSSoundDescriptor_8__{ REL::ID(213924) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGShkMatFadeController_BShkNonTransformController__BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ REL::ID(604988) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BGShkPhonemeController_BShkNonTransformController__BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ REL::ID(743895) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BSAudioEffects__BSDelayEffectParams_BSIAudioEffectParameters__BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ REL::ID(589292) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BSAudioEffects__BSOverdriveParams_BSIAudioEffectParameters__BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ REL::ID(556348) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BSAudioEffects__BSStateVariableFilterParams_BSIAudioEffectParameters__BSTCreateFactoryManager_unsignedint_BSIAudioEffectParameters_3__{ REL::ID(682710) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BSPathingRequest_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1349021) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BSPathingSolution_BSPathingSolution__BSTSmartPointerPathingFactoryManager_BSPathingSolution_64__{ REL::ID(1404123) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BSXAudio2Audio_BSAudio__BSTCreateFactoryManager_BSFixedString_BSAudio_4__{ REL::ID(959018) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BShkVisibilityController_BShkNonTransformController__BSTCreateFactoryManager_BSFixedString_BShkNonTransformController_32__{ REL::ID(781783) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BShkbHkxDB__ProjectDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(1134907) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BShkbHkxDB__hkxDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(84816) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BedEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1542656) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BedFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(212699) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BowDrawnHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(793757) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BowReleaseHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(700730) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BowZoomStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1078590) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_BowZoomStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1204967) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CameraOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(566600) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CameraOverrideStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(911989) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CameraShakeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1322310) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ChairEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1416230) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ChairFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1449417) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CollectionAnimationSpeedContour_AnimationSpeedContour__BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ REL::ID(247261) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAcquireSearchDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(459740) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1085300) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAnimatedPath_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(335777) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatApproachTargetPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(684851) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAreaHoldPosition_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1446964) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAreaReference_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(756231) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAreaShape_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(410261) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatAreaStandard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1101514) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatChangePositionPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(320294) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatChargingSearchData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(24164) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatCluster_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(85748) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatCoverLocation_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1490880) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatCoverSearchDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(253872) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatCoverSearchResult_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1144950) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatCoverSearch_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(799743) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatCoveredPathDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(202402) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatDisableActionController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1467539) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatDisableAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(885112) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatEnterCoverPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(599456) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatFindCoverPathSpeedController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(29537) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatFlankingSearchData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1252387) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatFollowTargetPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1029886) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemGrenade_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(373121) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1149779) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1363612) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1578103) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(637898) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(851692) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(209859) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(423558) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(339498) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(507850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(722296) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1494101) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(293653) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1065686) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1279802) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(935871) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(125608) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(258660) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(472507) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(687029) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1328537) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1542854) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(900739) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1114651) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1030408) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1199071) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1412667) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(602628) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(984636) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(174745) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(388444) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(44493) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(816670) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(604254) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(818276) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1032050) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(91984) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(305915) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1246394) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1460358) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1375808) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1544513) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(176379) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(948002) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1330200) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(520060) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(734383) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(390073) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1162110) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1495780) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(127188) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(341161) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(983035) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1197394) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(555393) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(769403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(685414) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(853341) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1067254) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(257095) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(639565) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1411027) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(42860) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1281390) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(470842) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemMelee_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1264480) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemOneHandedBlock_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1409360) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemRanged_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(27230) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemShield_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1064057) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemThrown_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(719046) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatInventoryItemTorch_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(173132) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterArmor_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(804611) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterBoundItem_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1018323) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterChameleon_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1232580) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterCloak_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(292040) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterDisarm_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(506255) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterInvisibility_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1446477) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterLight_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(78284) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterOffensive_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1576503) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterParalyze_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(162522) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterReanimate_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(376403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterRestore_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1148214) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterScript_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1530823) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterStagger_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(720705) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterSummon_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(934236) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterTargetEffect_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(590654) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMagicCasterWard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1362031) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMantlePathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(944741) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMatchTargetAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1230713) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMeleeAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(194415) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMeleeDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(124383) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatMovementRequestFollowActor_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(483367) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathMovementMessageEvent_CombatPathTeleportEvent__MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(138719) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(303736) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(12892) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(158725) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(884778) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1361086) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(309701) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1175095) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(427253) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1057045) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1239296) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1100588) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1368511) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(917403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1537498) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(883139) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(116559) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1100777) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(251200) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(546569) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1501592) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1383253) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(567454) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(739850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(594543) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(724524) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(869175) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(448778) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1450437) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(579042) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(288279) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(433381) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1305010) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1014527) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1159939) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1438883) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1540687) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1250286) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1395107) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(539476) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1015770) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1546600) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(829589) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(81949) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(712129) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(893715) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(755277) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1023145) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(572111) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1191880) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(537892) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1353202) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(755467) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1488162) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(200991) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1155677) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1037820) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(221932) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(393932) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(248870) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(378634) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(523953) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(103600) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1104840) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(233538) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1525397) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(88241) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(959604) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(669367) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(814506) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(994615) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(704828) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(849565) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1575986) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(469852) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1000531) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(283758) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1118341) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(166058) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(347753) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(209400) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(477440) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(25764) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(646322) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1574403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(807796) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(209579) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(942063) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1237426) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(610063) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(492056) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1258427) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1430336) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1285292) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1414931) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1560624) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1139991) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(559258) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1269949) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(979299) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1124553) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(413647) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(123402) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(268726) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(649500) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(358671) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(504069) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1230369) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(124632) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(655519) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1520816) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(773172) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1402511) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1769) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1445996) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(131990) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1263037) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(300478) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1228779) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(461761) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1446182) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(596853) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(891876) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(264507) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(146776) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(912832) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1084973) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(939749) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1069574) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1215167) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(794790) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(213779) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(924305) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(634158) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(779401) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(68441) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1359864) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1505750) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(497002) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestAdapter_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1308735) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestCovered_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(435072) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(11762) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(543079) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1407964) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(660823) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1290301) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1472521) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1333411) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(19242) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1150474) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(188494) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1116241) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(349601) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1333601) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(484213) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(779662) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(152208) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(34054) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(800628) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestMultiGoal_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(72144) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingRequestStandard_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(963288) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingSearchArea_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(151725) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPathingTweener_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1375265) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatPositionTracker_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1254842) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatProjectileAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(539786) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatProjectileDebugData_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1576292) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatSearchLockData_BSPathingLockData__BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ REL::ID(1169481) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatSuppressiveFireBehavior_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1125578) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetLocationSearchResult_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(987901) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetLocationSearch_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(642852) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetLocation_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(296948) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorFixed_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1373966) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorPreferred_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1028562) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorRandom_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(137406) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTargetSelectorStandard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(683573) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatThreatExplosion_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(175893) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatThreatLOF_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(866475) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatThreatMelee_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1212428) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatThreatProjectile_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(521213) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTrackTargetAimController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1430651) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatTunnelPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1037628) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatViewControllerGlance_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(198692) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatViewControllerPath_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(544245) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CombatViewControllerStandard_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1435059) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1099448) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_CullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(208290) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DeathEmoteHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1448703) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DeathStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(346221) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DesyncInteractionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(748072) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DisableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(236454) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DisableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(540769) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DisableCollisionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(708433) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DiveBombPathController_CombatObjectBase__BSTCreateFactoryManager_unsignedint_CombatObjectBase_512__{ REL::ID(1331806) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_DoNotInterruptAnimationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(56749) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_EjectShellCasingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(882262) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_EnableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1473327) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_EnableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(195366) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_EnableCollisionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(582012) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_EndSummonAnimationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1457081) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FaceEmotionalIdleHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(638674) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightActionEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1180282) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightActionEntryEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(834814) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightActionGrabHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1306305) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightActionHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(709184) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightActionReleaseHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1432272) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightCrashLandStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(196044) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightCruisingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1534335) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightHoveringHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(78107) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightLandEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(582705) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightLandHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(456127) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightLandingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(204319) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightPerchingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(330289) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_FlightTakeOffHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1407819) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_GetUpEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1314000) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_GetUpStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1188023) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_GunDownStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1266825) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_HeadTrackingOffHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(667603) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_HeadTrackingOnHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(541473) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_HeadTrackingRotationOffHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(806075) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_HeadTrackingRotationOnHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(460009) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_HitFrameHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1257533) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_HolotapeLoadedHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(512331) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_IdleDialogueEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1012031) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_IdleDialogueExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1357429) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_IdleFlavorHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1151304) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_IndividualClipAnimationSpeedContour_AnimationSpeedContour__BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ REL::ID(1311137) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_InterruptCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1330727) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_JumpAnimEventHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(886065) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_KillActorHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1281890) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_KillMoveEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1070163) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_KillMoveStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(944077) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_KnockdownHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1134489) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_KnockdownTargetHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1260784) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_LeftHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(607815) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_LeftHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1372613) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_LoopingActivateHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(501580) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MotionDrivenHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1574931) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MountDismountEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1346764) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MountInteraction_RefrInteraction__BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ REL::ID(1441822) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementAgentActorAvoider_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1383774) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementAgentActorState_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1383528) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementAgentPathFollowerFlight_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(528701) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementAgentPathFollowerStandard_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(536268) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementAgentPathFollowerVirtual_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1551495) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentAngleGain_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(964265) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentAnglePassThrough_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(185685) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentAnimationDriven_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(725463) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentDirectControl_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1373084) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentDirectionPassThrough_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1488209) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentGraphDrivenAnimationDriven_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(445066) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentPlayerControlsActionTrigger_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(202481) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentPlayerControls_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(44680) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentSpeedPassThrough_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(464901) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentSprintActionTrigger_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1085105) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStairsHelper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1010888) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStandard_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(324534) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStorePlannerOutput_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(651222) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerAgentStrafing_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(769591) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementHandlerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(249401) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageActivateDoor_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(403052) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageActorCollision_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1435873) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageBlocked_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(940508) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageFreezeDirection_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(339479) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageJump_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(945869) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageNewPath_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1081287) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessagePathComplete_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1426624) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessagePathFailed_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(190399) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessagePlayIdle_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(926722) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageSetStaticPath_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(740605) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageWarpToLocation_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1313480) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementMessageWarpToMultiple_MovementMessage__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1126940) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementParametersFixed_IMovementParameters__BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ REL::ID(54651) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementParameters_IMovementParameters__BSTSmartPointerPathingFactoryManager_IMovementParameters_64__{ REL::ID(1291498) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerAgentAvoidBox_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(22959) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerAgentLoadedAreaMonitor_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(975590) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerAgentStaticAvoider_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1456580) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPathManagerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(1364284) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPlannerAgentDirectControl_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(185788) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPlannerAgentNavmeshBounds_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(130403) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPlannerAgentWarp_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(191201) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPlannerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(125802) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementPostUpdateArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(965007) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementStateFollowPath_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(426101) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementStateTweener_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(14551) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementTweenerAgentFixedDelta_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(191595) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementTweenerAgentNodeFollower_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(807936) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementTweenerAgentTargetPosAndVel_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(99900) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_MovementTweenerArbiter_MovementArbiter__BSTCreateFactoryManager_BSFixedString_MovementArbiter_32__{ REL::ID(1488701) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_NPCAttachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(937986) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_NPCDetachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1064079) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PairedAttackDialogueHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(158609) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PairedStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1196469) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PassengerInteraction_RefrInteraction__BSTCreateFactoryManager_RefrInteraction__INTERACT_METHOD_RefrInteraction_2__{ REL::ID(774350) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingCell_BSPathingCell__BSTSmartPointerPathingFactoryManager_BSPathingCell_64__{ REL::ID(681107) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingDoor_BSPathingDoor__BSTSmartPointerPathingFactoryManager_BSPathingDoor_64__{ REL::ID(260987) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingLockData_BSPathingLockData__BSTSmartPointerPathingFactoryManager_BSPathingLockData_64__{ REL::ID(532543) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestClosePoint_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1154550) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestClosestGoal_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1579715) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestCover_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1113315) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlee_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(926754) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyAction_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(554049) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyHover_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(367225) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyLand_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(181042) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyOrbit_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1576721) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFlyTakeOff_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1389815) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestFly_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(740640) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestHide_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(59986) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestLOS_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1455915) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestOptimalLocation_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1269339) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestRotate_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1521776) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestSafeStraightLine_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1334811) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequestStopMoving_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(4433) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PathingRequest_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(784858) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PerformActivationHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1277493) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PickNewIdleHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(220317) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PipboyBootSequenceHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(167052) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PitchOverrideEndHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1535960) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PitchOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1190340) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerBedEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(810481) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerChairEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(338613) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerFastEquipSoundHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(402172) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(936363) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerSightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1148926) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerSneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(156286) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_PlayerTerminalEnterHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(464480) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_QuestPathingRequest_BSPathingRequest__BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(480486) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RagdollAndGetUpHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1221115) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RagdollStartHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(623210) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ReadyStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1140619) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RecoilStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1246911) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ReevaluateGraphStateHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(627999) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RelaxedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(669242) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ReloadCompleteHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(677781) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ReloadStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(331914) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RemoveRagdollHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(496883) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RightHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(953266) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_RightHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(136076) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SandManKillHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1008299) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(803721) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(29649) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SpeedSampledAnimationSpeedContour_AnimationSpeedContour__BSTCreateFactoryManager_BSFixedString_AnimationSpeedContour_32__{ REL::ID(779455) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_StaggeredStopHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1290335) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_StartFloatingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(834114) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_StartPCapVoiceHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(756480) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_StopFloatingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(960200) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_StopMountCameraHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(818066) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SubgraphAndOffsetDBData_BSAnimationDBData__BSTCreateFactoryManager_BSFixedString_BSAnimationDBData_32__{ REL::ID(1488698) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SyncDeferDeathHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1386606) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_SyncEarlyExitHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1513242) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_UncullBoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(973078) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_UncullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1444857) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_UncullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(334270) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_UpdateSightedHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1093309) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_UseStealthBoyHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1110089) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_UseStimpakHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(983765) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_VoiceSpellCastHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1298661) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_VoiceSpellFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(481519) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponAttachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(503961) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponBeginDrawHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1424610) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponBeginSheatheHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(1551090) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponDetachHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(630349) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponDrawHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(314227) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponFireHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(205904) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponSheatheHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(440105) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_WeaponSwingHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(742500) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator_ZeroPitchHandler_IHandlerFunctor_Actor_BSFixedString___BSTCreateFactoryManager_BSFixedString_IHandlerFunctor_Actor_BSFixedString__256__{ REL::ID(79723) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator___MovementHandlerAgentAngleControllerLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(238859) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator___MovementHandlerAgentLargeDeltaLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(584557) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator___MovementHandlerAgentTranslationControllerLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(929769) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator___MovementPlannerAgentHorseControlsLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(1534030) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory_BSTDerivedCreator___MovementPlannerAgentKeepOffsetLoadScrapper_MovementAgent__BSTCreateFactoryManager_BSFixedString_MovementAgent_64__{ REL::ID(296935) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterFactory___BShkbAnimationGraphLoadScrapper_BSTFactoryManager_BSFixedString_BSAnimationGraphLoadScrapper_2_BSTSingletonImplicit__{ REL::ID(1172769) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementAgentActorAvoider_{ REL::ID(1556889) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementAgentActorState_{ REL::ID(1556661) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementAgentPathFollowerFlight_{ REL::ID(701805) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementAgentPathFollowerStandard_{ REL::ID(709342) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementAgentPathFollowerVirtual_{ REL::ID(141795) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentAngleGain_{ REL::ID(1136981) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentAnglePassThrough_{ REL::ID(358005) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentAnimationDriven_{ REL::ID(897912) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentDirectControl_{ REL::ID(1546214) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentDirectionPassThrough_{ REL::ID(78483) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentGraphDrivenAnimationDriven_{ REL::ID(618207) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentPlayerControlsActionTrigger_{ REL::ID(375050) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentPlayerControls_{ REL::ID(217651) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentSpeedPassThrough_{ REL::ID(638106) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentSprintActionTrigger_{ REL::ID(1258023) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentStairsHelper_{ REL::ID(1183850) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentStandard_{ REL::ID(497278) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentStorePlannerOutput_{ REL::ID(823802) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementHandlerAgentStrafing_{ REL::ID(942108) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementPathManagerAgentAvoidBox_{ REL::ID(196408) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementPathManagerAgentLoadedAreaMonitor_{ REL::ID(1148407) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementPathManagerAgentStaticAvoider_{ REL::ID(46806) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementPlannerAgentDirectControl_{ REL::ID(358109) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementPlannerAgentNavmeshBounds_{ REL::ID(303068) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementPlannerAgentWarp_{ REL::ID(363485) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementStateFollowPath_{ REL::ID(599187) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementStateTweener_{ REL::ID(188027) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementTweenerAgentFixedDelta_{ REL::ID(363897) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementTweenerAgentNodeFollower_{ REL::ID(980292) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator_MovementTweenerAgentTargetPosAndVel_{ REL::ID(272722) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator___MovementHandlerAgentAngleControllerLoadScrapper_{ REL::ID(411420) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator___MovementHandlerAgentLargeDeltaLoadScrapper_{ REL::ID(757351) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator___MovementHandlerAgentTranslationControllerLoadScrapper_{ REL::ID(1102619) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator___MovementPlannerAgentHorseControlsLoadScrapper_{ REL::ID(124405) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementAgentCreator___MovementPlannerAgentKeepOffsetLoadScrapper_{ REL::ID(469613) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementArbiterCreator_MovementHandlerArbiter_{ REL::ID(421929) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementArbiterCreator_MovementPathManagerArbiter_{ REL::ID(1537517) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementArbiterCreator_MovementPlannerArbiter_{ REL::ID(298350) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementArbiterCreator_MovementPostUpdateArbiter_{ REL::ID(1137710) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterMovementArbiterCreator_MovementTweenerArbiter_{ REL::ID(78985) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_BSPathingRequest___PathBuilderBSPathingRequest_{ REL::ID(1504156) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestCovered_CombatPathingRequestBuilder_{ REL::ID(1485966) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(1062445) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathingRequestBuilder_{ REL::ID(10302) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathingRequestBuilder_{ REL::ID(876071) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(128519) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(758549) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(940219) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(801807) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(1069834) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(618692) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathingRequestBuilder_{ REL::ID(1238640) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(584536) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(1399821) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(802000) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(1534687) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(247458) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(1202488) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathingRequestBuilder_{ REL::ID(1084535) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathingRequestBuilder_{ REL::ID(268558) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestMultiGoal_CombatPathingRequestBuilder_{ REL::ID(198425) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_CombatPathingRequestStandard_CombatPathingRequestBuilder_{ REL::ID(1122221) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestClosePoint___PathBuilderClosePointPath_{ REL::ID(84594) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestClosestGoal_PathingRequestClosestGoal__PathBuilder_{ REL::ID(1047614) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFlee_PathBuilderFlee__PathBuilderFleePath_{ REL::ID(1527103) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFlyAction_PathBuilderFlight__PathBuilderFlyActionPath_{ REL::ID(668742) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFlyHover_PathBuilderFlight__PathBuilderFlyHoverPath_{ REL::ID(1326484) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFlyLand_PathBuilderFlight__PathBuilderFlyLandPath_{ REL::ID(1060578) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFlyOrbit_PathBuilderFlight__PathBuilderFlyOrbitPath_{ REL::ID(402380) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFlyTakeOff_PathBuilderFlight__PathBuilderFlyTakeOffPath_{ REL::ID(136506) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestFly_PathBuilderFlight__PathBuilderFlyPath_{ REL::ID(9841) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestHide_PathBuilderHide__PathBuilderHidePath_{ REL::ID(967329) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestLOS_PathBuilderLOS__PathBuilderLOSPath_{ REL::ID(1359268) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestOptimalLocation_PathBuilderOptimalLocation__PathBuilderOptimalLocationPath_{ REL::ID(388671) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestRotate___PathBuilderRotatePath_{ REL::ID(1134682) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestSafeStraightLine_PathBuilderSafeStraightLine__PathBuilderSafeStraightLinePath_{ REL::ID(781108) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequestStopMoving___PathBuilderStopMovingPath_{ REL::ID(476555) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_PathingRequest___PathBuilderPathingRequest_{ REL::ID(1400642) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathBuilderFactory_QuestPathingRequest_QuestPathingRequestBuilder_{ REL::ID(1530994) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_BSPathingRequest_BSTSmartPointerPathingFactoryManager_BSPathingRequest_64__{ REL::ID(1522247) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_BSPathingSolution_BSTSmartPointerPathingFactoryManager_BSPathingSolution_64__{ REL::ID(1577188) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_CombatPathMovementMessageEvent_CombatPathTeleportEvent__BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(311468) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageActivateDoor_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(576022) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageActorCollision_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(26080) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageBlocked_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1113270) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageFreezeDirection_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(512286) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageJump_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1118563) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageNewPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1254156) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessagePathComplete_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(16895) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessagePathFailed_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(362714) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessagePlayIdle_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1099628) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageSetStaticPath_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(913054) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageWarpToLocation_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1486632) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterPathing_MovementMessageWarpToMultiple_BSTSmartPointerPathingFactoryManager_MovementMessage_64__{ REL::ID(1299749) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestAdapter_BSPathingRequest_64_{ REL::ID(1481971) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestCovered_BSPathingRequest_64_{ REL::ID(608204) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(185239) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSPathingRequest_64_{ REL::ID(716007) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSPathingRequest_64_{ REL::ID(1581059) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(833317) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(1463177) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(62712) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(1506710) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(192767) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(1323161) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSPathingRequest_64_{ REL::ID(360838) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(1289046) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(522520) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(1506898) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(657286) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(952216) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(324749) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSPathingRequest_64_{ REL::ID(207246) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSPathingRequest_64_{ REL::ID(973021) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestMultiGoal_BSPathingRequest_64_{ REL::ID(244897) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_CombatPathingRequestStandard_BSPathingRequest_64_{ REL::ID(1136011) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_MovementParametersFixed_IMovementParameters_64_{ REL::ID(227641) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_MovementParameters_IMovementParameters_64_{ REL::ID(1464404) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestClosePoint_BSPathingRequest_64_{ REL::ID(1327187) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestClosestGoal_BSPathingRequest_64_{ REL::ID(170361) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestCover_BSPathingRequest_64_{ REL::ID(1286130) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlee_BSPathingRequest_64_{ REL::ID(1099659) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyAction_BSPathingRequest_64_{ REL::ID(726948) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyHover_BSPathingRequest_64_{ REL::ID(540251) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyLand_BSPathingRequest_64_{ REL::ID(353477) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyOrbit_BSPathingRequest_64_{ REL::ID(167286) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFlyTakeOff_BSPathingRequest_64_{ REL::ID(1563092) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestFly_BSPathingRequest_64_{ REL::ID(913094) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestHide_BSPathingRequest_64_{ REL::ID(232925) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestLOS_BSPathingRequest_64_{ REL::ID(46159) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestOptimalLocation_BSPathingRequest_64_{ REL::ID(1442010) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestRotate_BSPathingRequest_64_{ REL::ID(112047) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestSafeStraightLine_BSPathingRequest_64_{ REL::ID(1508074) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequestStopMoving_BSPathingRequest_64_{ REL::ID(177998) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_PathingRequest_BSPathingRequest_64_{ REL::ID(957376) };
+		inline constexpr std::array<REL::ID, 1> AutoRegisterSmartPtrDerivedPathingType_QuestPathingRequest_BSPathingRequest_64_{ REL::ID(653605) };
+		inline constexpr std::array<REL::ID, 1> AutoVanityState{ REL::ID(820250) };
+		inline constexpr std::array<REL::ID, 1> AwakeSoundFadeHandler{ REL::ID(456815) };
+		inline constexpr std::array<REL::ID, 1> AwakeSoundPauseHandler{ REL::ID(191426) };
+		inline constexpr std::array<REL::ID, 1> AwakeSoundResumeHandler{ REL::ID(849207) };
+		inline constexpr std::array<REL::ID, 1> AwakeSoundStopHandler{ REL::ID(1115182) };
+	}
+}
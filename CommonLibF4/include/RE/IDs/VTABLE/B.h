@@ -0,0 +1,3715 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> BGSAIWorldLocation{ REL::ID(896109) };
+		inline constexpr std::array<REL::ID, 1> BGSAIWorldLocationInteriorCell{ REL::ID(523135) };
+		inline constexpr std::array<REL::ID, 1> BGSAIWorldLocationPointRadius{ REL::ID(589048) };
+		inline constexpr std::array<REL::ID, 1> BGSAIWorldLocationPrimitive{ REL::ID(1266127) };
+		inline constexpr std::array<REL::ID, 1> BGSAIWorldLocationRefRadius{ REL::ID(360909) };
+		inline constexpr std::array<REL::ID, 1> BGSAbilityPerkEntry{ REL::ID(940261) };
+		inline constexpr std::array<REL::ID, 1> BGSAcousticSpace{ REL::ID(1381066) };
+		inline constexpr std::array<REL::ID, 1> BGSAction{ REL::ID(1247581) };
+		inline constexpr std::array<REL::ID, 1> BGSActionData{ REL::ID(826650) };
+		inline constexpr std::array<REL::ID, 2> BGSAddonNode{ REL::ID(505252), REL::ID(1168770) };
+		inline constexpr std::array<REL::ID, 1> BGSAddonNodeSoundHandleExtra{ REL::ID(636922) };
+		inline constexpr std::array<REL::ID, 1> BGSAimModel{ REL::ID(609322) };
+		inline constexpr std::array<REL::ID, 4> BGSArtObject{ REL::ID(1538853), REL::ID(620068), REL::ID(1011905), REL::ID(526800) };
+		inline constexpr std::array<REL::ID, 2> BGSArtObjectCloneTask{ REL::ID(1390208), REL::ID(107138) };
+		inline constexpr std::array<REL::ID, 1> BGSAssociationType{ REL::ID(594841) };
+		inline constexpr std::array<REL::ID, 1> BGSAttachParentArray{ REL::ID(515572) };
+		inline constexpr std::array<REL::ID, 1> BGSAttachTechniquesUtil__AttachTechniquesFunctor{ REL::ID(114260) };
+		inline constexpr std::array<REL::ID, 1> BGSAttachTechniquesUtil__DetachTechniquesFunctor{ REL::ID(772711) };
+		inline constexpr std::array<REL::ID, 1> BGSAttachTechniquesUtil__ProcessTechniquesFunctor{ REL::ID(1038355) };
+		inline constexpr std::array<REL::ID, 1> BGSAttackData{ REL::ID(1393382) };
+		inline constexpr std::array<REL::ID, 1> BGSAttackDataForm{ REL::ID(52954) };
+		inline constexpr std::array<REL::ID, 1> BGSAttackDataMap{ REL::ID(469234) };
+		inline constexpr std::array<REL::ID, 1> BGSAttractionRule{ REL::ID(356600) };
+		inline constexpr std::array<REL::ID, 2> BGSAudioEffectChain{ REL::ID(600048), REL::ID(1230633) };
+		inline constexpr std::array<REL::ID, 1> BGSAutoWeaponSoundDef{ REL::ID(199593) };
+		inline constexpr std::array<REL::ID, 1> BGSBaseAlias{ REL::ID(400448) };
+		inline constexpr std::array<REL::ID, 1> BGSBehaviorGraphModel{ REL::ID(50805) };
+		inline constexpr std::array<REL::ID, 1> BGSBendableSpline{ REL::ID(139884) };
+		inline constexpr std::array<REL::ID, 1> BGSBipedObjectForm{ REL::ID(212177) };
+		inline constexpr std::array<REL::ID, 1> BGSBlockBashData{ REL::ID(823613) };
+		inline constexpr std::array<REL::ID, 3> BGSBodyPartData{ REL::ID(352978), REL::ID(1203214), REL::ID(671323) };
+		inline constexpr std::array<REL::ID, 1> BGSCameraPath{ REL::ID(542263) };
+		inline constexpr std::array<REL::ID, 3> BGSCameraShot{ REL::ID(1364157), REL::ID(632444), REL::ID(100255) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__Entry{ REL::ID(1351748) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__MaskEntry{ REL::ID(1524934) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__PaletteEntry{ REL::ID(115170) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__Template__Entry{ REL::ID(460378) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__Template__Mask{ REL::ID(195034) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__Template__Palette{ REL::ID(1511232) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__Template__TextureSet{ REL::ID(1245133) };
+		inline constexpr std::array<REL::ID, 1> BGSCharacterTint__TextureSetEntry{ REL::ID(287808) };
+		inline constexpr std::array<REL::ID, 2> BGSCollisionLayer{ REL::ID(1216477), REL::ID(483918) };
+		inline constexpr std::array<REL::ID, 2> BGSColorForm{ REL::ID(736550), REL::ID(3320) };
+		inline constexpr std::array<REL::ID, 1> BGSCombinedCellGeometryDB__CDX{ REL::ID(473350) };
+		inline constexpr std::array<REL::ID, 1> BGSCombinedCellGeometryDB__CDX__PsgBatchIter{ REL::ID(34461) };
+		inline constexpr std::array<REL::ID, 2> BGSCombinedCellGeometryDB__LoadTask{ REL::ID(426722), REL::ID(726108) };
+		inline constexpr std::array<REL::ID, 2> BGSCombinedCellGeometryDB__ModelDB__QueuedHandles{ REL::ID(972470), REL::ID(1271531) };
+		inline constexpr std::array<REL::ID, 1> BGSCombinedCellGeometryDB__PreloadTask{ REL::ID(758870) };
+		inline constexpr std::array<REL::ID, 1> BGSCombinedCellGeometryDB__Unpacker__Thread{ REL::ID(884721) };
+		inline constexpr std::array<REL::ID, 4> BGSComponent{ REL::ID(876484), REL::ID(1540239), REL::ID(569512), REL::ID(742390) };
+		inline constexpr std::array<REL::ID, 1> BGSCompoundSoundDef{ REL::ID(994137) };
+		inline constexpr std::array<REL::ID, 3> BGSConstructibleObject{ REL::ID(243924), REL::ID(1093896), REL::ID(1266711) };
+		inline constexpr std::array<REL::ID, 1> BGSConveyorBelt__ConveyorBelt{ REL::ID(512549) };
+		inline constexpr std::array<REL::ID, 1> BGSCraftingUseSound{ REL::ID(1126966) };
+		inline constexpr std::array<REL::ID, 1> BGSDamageType{ REL::ID(103142) };
+		inline constexpr std::array<REL::ID, 2> BGSDebris{ REL::ID(972959), REL::ID(240891) };
+		inline constexpr std::array<REL::ID, 1> BGSDecalNode{ REL::ID(999328) };
+		inline constexpr std::array<REL::ID, 1> BGSDefaultObject{ REL::ID(766795) };
+		inline constexpr std::array<REL::ID, 1> BGSDefaultObjectManager{ REL::ID(1436365) };
+		inline constexpr std::array<REL::ID, 1> BGSDestructibleObjectForm{ REL::ID(1155252) };
+		inline constexpr std::array<REL::ID, 1> BGSDialogueBranch{ REL::ID(1096090) };
+		inline constexpr std::array<REL::ID, 1> BGSDualCastData{ REL::ID(119689) };
+		inline constexpr std::array<REL::ID, 1> BGSEncounterZone{ REL::ID(824415) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionData{ REL::ID(1232311) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataAVAndValue{ REL::ID(1092305) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataActivateChoice{ REL::ID(859152) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataBooleanGraphVariable{ REL::ID(952475) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataLeveledList{ REL::ID(1045680) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataOneValue{ REL::ID(1185650) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataSpellItem{ REL::ID(998850) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataText{ REL::ID(905839) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointFunctionDataTwoValue{ REL::ID(1138903) };
+		inline constexpr std::array<REL::ID, 1> BGSEntryPointPerkEntry{ REL::ID(846981) };
+		inline constexpr std::array<REL::ID, 1> BGSEquipSlot{ REL::ID(1031799) };
+		inline constexpr std::array<REL::ID, 1> BGSEquipType{ REL::ID(530144) };
+		inline constexpr std::array<REL::ID, 6> BGSExplosion{ REL::ID(492975), REL::ID(1156623), REL::ID(186115), REL::ID(1236253), REL::ID(265420), REL::ID(876707) };
+		inline constexpr std::array<REL::ID, 1> BGSFeaturedItemMessage{ REL::ID(156492) };
+		inline constexpr std::array<REL::ID, 1> BGSFootIkRaycastInterfaceDB{ REL::ID(276636) };
+		inline constexpr std::array<REL::ID, 1> BGSFootstep{ REL::ID(704737) };
+		inline constexpr std::array<REL::ID, 1> BGSFootstepManager{ REL::ID(123318) };
+		inline constexpr std::array<REL::ID, 1> BGSFootstepSet{ REL::ID(224420) };
+		inline constexpr std::array<REL::ID, 1> BGSForcedLocRefType{ REL::ID(768015) };
+		inline constexpr std::array<REL::ID, 1> BGSGameWarningsHandler__GameWarningsSink{ REL::ID(493858) };
+		inline constexpr std::array<REL::ID, 1> BGSGamebryoSequenceGenerator{ REL::ID(1305058) };
+		inline constexpr std::array<REL::ID, 1> BGSGamebryoSequenceGeneratorHolderSingleton{ REL::ID(482173) };
+		inline constexpr std::array<REL::ID, 1> BGSGodRays{ REL::ID(1049102) };
+		inline constexpr std::array<REL::ID, 1> BGSHavokGeometryAttach{ REL::ID(1416637) };
+		inline constexpr std::array<REL::ID, 1> BGSHavokGeometryAttach__ActionPolicy{ REL::ID(1024557) };
+		inline constexpr std::array<REL::ID, 1> BGSHavokGeometryAttach__AttachPolicy{ REL::ID(100608) };
+		inline constexpr std::array<REL::ID, 1> BGSHavokGeometryAttach__DetachPolicy{ REL::ID(758972) };
+		inline constexpr std::array<REL::ID, 5> BGSHazard{ REL::ID(690663), REL::ID(1353646), REL::ID(382990), REL::ID(1433083), REL::ID(462232) };
+		inline constexpr std::array<REL::ID, 3> BGSHeadPart{ REL::ID(285806), REL::ID(1135827), REL::ID(165304) };
+		inline constexpr std::array<REL::ID, 1> BGSIdleCollection{ REL::ID(1127621) };
+		inline constexpr std::array<REL::ID, 5> BGSIdleMarker{ REL::ID(763122), REL::ID(1426182), REL::ID(236388), REL::ID(1332926), REL::ID(801298) };
+		inline constexpr std::array<REL::ID, 2> BGSImpactData{ REL::ID(715420), REL::ID(1565267) };
+		inline constexpr std::array<REL::ID, 2> BGSImpactDataSet{ REL::ID(407597), REL::ID(1257799) };
+		inline constexpr std::array<REL::ID, 3> BGSImpactManager{ REL::ID(1391551), REL::ID(467467), REL::ID(1125698) };
+		inline constexpr std::array<REL::ID, 1> BGSInstanceNamingRules{ REL::ID(1084519) };
+		inline constexpr std::array<REL::ID, 1> BGSInstanceNamingRulesForm{ REL::ID(940550) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__CheckExtraDataFunctor{ REL::ID(826145) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__CheckStackIDFunctor{ REL::ID(168197) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__ClearEquipFlagsFunctor{ REL::ID(365926) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__FindEquippedStackFunctor{ REL::ID(1376966) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__HasExtraDataFunctor{ REL::ID(738507) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__IsUIEquivalentStackFunctor{ REL::ID(452815) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__ModCountFunctor{ REL::ID(340662) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__ModifyModDataFunctor{ REL::ID(1045422) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__SetFlagFunctor{ REL::ID(1111206) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__SetHealthFunctor{ REL::ID(606842) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__Stack{ REL::ID(938404) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__StackDataCompareFunctor{ REL::ID(1092064) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__StackDataWriteFunctor{ REL::ID(1484591) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryItem__WriteTextExtra{ REL::ID(1392075) };
+		inline constexpr std::array<REL::ID, 1> BGSInventoryList__InventoryWeightFunctor{ REL::ID(804957) };
+		inline constexpr std::array<REL::ID, 1> BGSKeyword{ REL::ID(1492475) };
+		inline constexpr std::array<REL::ID, 2> BGSKeywordForm{ REL::ID(768696), REL::ID(1160678) };
+		inline constexpr std::array<REL::ID, 1> BGSLOSData{ REL::ID(403340) };
+		inline constexpr std::array<REL::ID, 1> BGSLensFlare{ REL::ID(887569) };
+		inline constexpr std::array<REL::ID, 1> BGSLensFlareSprite{ REL::ID(893031) };
+		inline constexpr std::array<REL::ID, 1> BGSLightingTemplate{ REL::ID(1353158) };
+		inline constexpr std::array<REL::ID, 1> BGSListForm{ REL::ID(805434) };
+		inline constexpr std::array<REL::ID, 1> BGSLoadFormBuffer{ REL::ID(950365) };
+		inline constexpr std::array<REL::ID, 1> BGSLoadGameBuffer{ REL::ID(447349) };
+		inline constexpr std::array<REL::ID, 1> BGSLocAlias{ REL::ID(1011963) };
+		inline constexpr std::array<REL::ID, 4> BGSLocation{ REL::ID(859507), REL::ID(127288), REL::ID(739121), REL::ID(1130820) };
+		inline constexpr std::array<REL::ID, 1> BGSLocationRefType{ REL::ID(977127) };
+		inline constexpr std::array<REL::ID, 3> BGSMaterialObject{ REL::ID(591415), REL::ID(1441091), REL::ID(690115) };
+		inline constexpr std::array<REL::ID, 1> BGSMaterialSwap{ REL::ID(1309218) };
+		inline constexpr std::array<REL::ID, 1> BGSMaterialType{ REL::ID(1427183) };
+		inline constexpr std::array<REL::ID, 1> BGSMenuDisplayObject{ REL::ID(675607) };
+		inline constexpr std::array<REL::ID, 2> BGSMenuIcon{ REL::ID(774911), REL::ID(42253) };
+		inline constexpr std::array<REL::ID, 3> BGSMessage{ REL::ID(1172134), REL::ID(439645), REL::ID(1051356) };
+		inline constexpr std::array<REL::ID, 1> BGSMessageIcon{ REL::ID(1286768) };
+		inline constexpr std::array<REL::ID, 4> BGSMod__Attachment__Mod{ REL::ID(511534), REL::ID(1361269), REL::ID(390667), REL::ID(563655) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Property__BridgeI{ REL::ID(409234) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Property__Bridge_TESFurniture__InstanceData_{ REL::ID(1459785) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Property__Bridge_TESNPC__InstanceData_{ REL::ID(1455860) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Property__Bridge_TESObjectARMO__InstanceData_{ REL::ID(16320) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Property__Bridge_TESObjectWEAP__InstanceData_{ REL::ID(1099535) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Template__Item{ REL::ID(1099663) };
+		inline constexpr std::array<REL::ID, 1> BGSMod__Template__Items{ REL::ID(128818) };
+		inline constexpr std::array<REL::ID, 1> BGSModelMaterialSwap{ REL::ID(35309) };
+		inline constexpr std::array<REL::ID, 1> BGSMotorAction__Action{ REL::ID(1442014) };
+		inline constexpr std::array<REL::ID, 1> BGSMotorAction__FanMotor{ REL::ID(910127) };
+		inline constexpr std::array<REL::ID, 7> BGSMovableStatic{ REL::ID(1285061), REL::ID(366220), REL::ID(1416344), REL::ID(6464), REL::ID(180006), REL::ID(352418), REL::ID(744899) };
+		inline constexpr std::array<REL::ID, 1> BGSMovementType{ REL::ID(1357362) };
+		inline constexpr std::array<REL::ID, 1> BGSMoviePlayer{ REL::ID(929204) };
+		inline constexpr std::array<REL::ID, 1> BGSMultiTechniqueAttach{ REL::ID(964274) };
+		inline constexpr std::array<REL::ID, 1> BGSMultiTechniqueAttach__ActionPolicy{ REL::ID(572374) };
+		inline constexpr std::array<REL::ID, 1> BGSMultiTechniqueAttach__AttachPolicy{ REL::ID(1230425) };
+		inline constexpr std::array<REL::ID, 1> BGSMultiTechniqueAttach__DetachPolicy{ REL::ID(306125) };
+		inline constexpr std::array<REL::ID, 1> BGSMusicPaletteTrack{ REL::ID(599060) };
+		inline constexpr std::array<REL::ID, 1> BGSMusicSilenceTrack{ REL::ID(146396) };
+		inline constexpr std::array<REL::ID, 1> BGSMusicSingleTrack{ REL::ID(398510) };
+		inline constexpr std::array<REL::ID, 1> BGSMusicTrack{ REL::ID(889371) };
+		inline constexpr std::array<REL::ID, 2> BGSMusicTrackFormWrapper{ REL::ID(796393), REL::ID(63801) };
+		inline constexpr std::array<REL::ID, 2> BGSMusicType{ REL::ID(222981), REL::ID(1072773) };
+		inline constexpr std::array<REL::ID, 1> BGSNamedNodeAttach{ REL::ID(180305) };
+		inline constexpr std::array<REL::ID, 1> BGSNamedNodeAttach__ActionPolicy{ REL::ID(1369957) };
+		inline constexpr std::array<REL::ID, 1> BGSNamedNodeAttach__AttachPolicy{ REL::ID(445801) };
+		inline constexpr std::array<REL::ID, 1> BGSNamedNodeAttach__DetachPolicy{ REL::ID(1104199) };
+		inline constexpr std::array<REL::ID, 2> BGSNamedPackageData_IAITarget_{ REL::ID(41265), REL::ID(1530644) };
+		inline constexpr std::array<REL::ID, 2> BGSNamedPackageData_IPackageDataAIWorldLocationHandle_{ REL::ID(1064111), REL::ID(798422) };
+		inline constexpr std::array<REL::ID, 1> BGSNamedPackageData_IPackageData_{ REL::ID(1319331) };
+		inline constexpr std::array<REL::ID, 1> BGSNativeTerminalForm{ REL::ID(21362) };
+		inline constexpr std::array<REL::ID, 7> BGSNote{ REL::ID(1568841), REL::ID(650028), REL::ID(822639), REL::ID(995115), REL::ID(463000), REL::ID(1074799), REL::ID(543058) };
+		inline constexpr std::array<REL::ID, 1> BGSObjectInstanceExtra{ REL::ID(137209) };
+		inline constexpr std::array<REL::ID, 1> BGSObjectVisibilityManager{ REL::ID(258189) };
+		inline constexpr std::array<REL::ID, 1> BGSOpenCloseForm{ REL::ID(580923) };
+		inline constexpr std::array<REL::ID, 1> BGSOutfit{ REL::ID(560651) };
+		inline constexpr std::array<REL::ID, 1> BGSOverridePackCollection{ REL::ID(274775) };
+		inline constexpr std::array<REL::ID, 1> BGSPackIn{ REL::ID(1051205) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataBasicTemplate_IAITarget_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___kPackageDataRefTypeName_0_{ REL::ID(1437087), REL::ID(1343778) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataBasicTemplate_IPackageData_float_kPackageDataFloatTypeName_fPackageDataFloatDefault_{ REL::ID(1132903) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataBasicTemplate_IPackageData_int_kPackageDataIntTypeName_iPackageDataIntDefault_{ REL::ID(587437) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataBool{ REL::ID(1226406) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataFloat{ REL::ID(241743) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataInt{ REL::ID(1278230) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataLocation{ REL::ID(345573), REL::ID(79750) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataLocationWrapper{ REL::ID(1568941), REL::ID(1302578) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataObjectList{ REL::ID(795424), REL::ID(702360) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataPointerTemplate_IAITarget_PackageTarget_kPackageDataRef2TypeName_{ REL::ID(249473), REL::ID(156303) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataPointerTemplate_IPackageDataAIWorldLocationHandle_PackageLocation_kPackageDataLocationTypeName_{ REL::ID(705414), REL::ID(438708) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataPointerTemplate_IPackageData_PackageTarget_kPackageDataTargetSelectorTypeName_{ REL::ID(1209653) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataRef{ REL::ID(62841), REL::ID(1552019) };
+		inline constexpr std::array<REL::ID, 2> BGSPackageDataRefOLD{ REL::ID(1250870), REL::ID(1157494) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataSaveableTemplate_IPackageData_float_kPackageDataFloatTypeName_fPackageDataFloatDefault_{ REL::ID(1478788) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataSaveableTemplate_IPackageData_int_kPackageDataIntTypeName_iPackageDataIntDefault_{ REL::ID(932644) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTargetSelector{ REL::ID(1555135) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTopic{ REL::ID(1365070) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_BGSPackageDataBool_BGSPackageDataBool_{ REL::ID(676335) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_BGSPackageDataFloat_BGSPackageDataFloat_{ REL::ID(190925) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_BGSPackageDataInt_BGSPackageDataInt_{ REL::ID(474962) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_BGSPackageDataObjectList_BGSPackageDataObjectList_{ REL::ID(1408960) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_BGSPackageDataTargetSelector_BGSPackageDataTargetSelector_{ REL::ID(733732) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_BGSPackageDataTopic_BGSPackageDataTopic_{ REL::ID(938242) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_IAITarget_BGSPackageDataObjectList_{ REL::ID(93642) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_IAITarget_BGSPackageDataRef_{ REL::ID(941956) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_IPackageDataAIWorldLocationHandle_BGSPackageDataLocation_{ REL::ID(131865) };
+		inline constexpr std::array<REL::ID, 1> BGSPackageDataTypeCheck_IPackageDataAIWorldLocationHandle_BGSPackageDataRef_{ REL::ID(1161686) };
+		inline constexpr std::array<REL::ID, 1> BGSParticleArrayAttach{ REL::ID(898635) };
+		inline constexpr std::array<REL::ID, 1> BGSParticleArrayAttach__ClearEmitterPolicy{ REL::ID(20631) };
+		inline constexpr std::array<REL::ID, 1> BGSParticleArrayAttach__CollectEmitterPolicy{ REL::ID(726210) };
+		inline constexpr std::array<REL::ID, 1> BGSParticleArrayAttach__EmitterPolicy{ REL::ID(1430395) };
+		inline constexpr std::array<REL::ID, 1> BGSParticleObjectCloneTask{ REL::ID(393786) };
+		inline constexpr std::array<REL::ID, 4> BGSPerk{ REL::ID(754098), REL::ID(21089), REL::ID(633244), REL::ID(806008) };
+		inline constexpr std::array<REL::ID, 1> BGSPerkEntry{ REL::ID(1126707) };
+		inline constexpr std::array<REL::ID, 1> BGSPerkRankArray{ REL::ID(886236) };
+		inline constexpr std::array<REL::ID, 1> BGSPerk__AddPerkVisitor{ REL::ID(1371591) };
+		inline constexpr std::array<REL::ID, 1> BGSPerk__ApplyPerksVisitor{ REL::ID(228447) };
+		inline constexpr std::array<REL::ID, 1> BGSPerk__FindPerkInRanksVisitor{ REL::ID(933044) };
+		inline constexpr std::array<REL::ID, 1> BGSPickupPutdownSounds{ REL::ID(1498127) };
+		inline constexpr std::array<REL::ID, 2> BGSPlayerMusicChanger{ REL::ID(1116857), REL::ID(193146) };
+		inline constexpr std::array<REL::ID, 1> BGSPreloadable{ REL::ID(361482) };
+		inline constexpr std::array<REL::ID, 1> BGSPreviewTransform{ REL::ID(633518) };
+		inline constexpr std::array<REL::ID, 1> BGSPrimitive{ REL::ID(1108140) };
+		inline constexpr std::array<REL::ID, 1> BGSPrimitiveBox{ REL::ID(1014828) };
+		inline constexpr std::array<REL::ID, 1> BGSPrimitiveEllipsoid{ REL::ID(655978) };
+		inline constexpr std::array<REL::ID, 1> BGSPrimitiveLine{ REL::ID(968188) };
+		inline constexpr std::array<REL::ID, 1> BGSPrimitivePlane{ REL::ID(842229) };
+		inline constexpr std::array<REL::ID, 1> BGSPrimitiveSphere{ REL::ID(921578) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureAcquire{ REL::ID(1029094) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureAcquireExecState{ REL::ID(483432) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureActivate{ REL::ID(880830) };
+		inline constexpr std::array<REL::ID, 3> BGSProcedureActivateExecState{ REL::ID(69288), REL::ID(681144), REL::ID(1338605) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureBase{ REL::ID(464707) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureDialogue{ REL::ID(733050) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureDialogueActivate{ REL::ID(66215) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureDialogueActivateExecState{ REL::ID(1102683) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureDialogueExecState{ REL::ID(589076) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureDone{ REL::ID(1429520) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureDoneExecState{ REL::ID(713084) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureEat{ REL::ID(1327227) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureEatExecState{ REL::ID(229692) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureEscort{ REL::ID(661149) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureEscortExecState{ REL::ID(115044) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFind{ REL::ID(1203770) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFindExecState{ REL::ID(1452693) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFlee{ REL::ID(271198) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFleeExecState{ REL::ID(1307489) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFlightGrab{ REL::ID(1000120) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFlightGrabExecState{ REL::ID(454268) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFollow{ REL::ID(1117941) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFollowExecState{ REL::ID(1422057) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureFollowTo{ REL::ID(385698) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureForceGreet{ REL::ID(1432746) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureGuard{ REL::ID(1471450) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureGuardArea{ REL::ID(739299) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureGuardExecState{ REL::ID(193512) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureHeadtrack{ REL::ID(876122) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureHeadtrackExecState{ REL::ID(330492) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureHoldPosition{ REL::ID(936145) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureHoldPositionExecState{ REL::ID(1093332) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureHover{ REL::ID(974256) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureHoverExecState{ REL::ID(428472) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureKeepAnEyeOn{ REL::ID(214827) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureKeepAnEyeOnExecState{ REL::ID(734445) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureLock{ REL::ID(1396188) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureLockUnlockExecState{ REL::ID(118287) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureOrbit{ REL::ID(249907) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureOrbitExecState{ REL::ID(1286380) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedurePatrol{ REL::ID(446781) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedurePatrolExecState{ REL::ID(1483927) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedurePlayIdle{ REL::ID(807672) };
+		inline constexpr std::array<REL::ID, 2> BGSProcedurePlayIdleExecState{ REL::ID(1139160), REL::ID(168677) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedurePursue{ REL::ID(1442287) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureRange{ REL::ID(590673) };
+		inline constexpr std::array<REL::ID, 2> BGSProcedureRangeExecState{ REL::ID(922081), REL::ID(1533838) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSandbox{ REL::ID(1214810) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSandboxExecState{ REL::ID(669013) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSay{ REL::ID(1052492) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSayExecState{ REL::ID(374799) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSit{ REL::ID(652177) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSitSleepExecState{ REL::ID(956272) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureSleep{ REL::ID(1502376) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureStayAway{ REL::ID(27496) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureStayAwayExecState{ REL::ID(1064303) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTravel{ REL::ID(914932) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTravelExecState{ REL::ID(369120) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeBranch{ REL::ID(964853) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeConditionalItem{ REL::ID(1323933) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeOneChildExecState{ REL::ID(605719) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeProcedure{ REL::ID(1125858) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeRandom{ REL::ID(1400453) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeRandomExecState{ REL::ID(509353) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeSequence{ REL::ID(1296542) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeSequenceExecState{ REL::ID(405273) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeSimultaneous{ REL::ID(896154) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeSimultaneousExecState{ REL::ID(1148267) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeStacked{ REL::ID(1096413) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTreeStackedExecState{ REL::ID(205263) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureAcquireParamTypes_{ REL::ID(604309) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureActivateParamTypes_{ REL::ID(455691) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureDialogueActivateParamTypes_{ REL::ID(1223646) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureDialogueParamTypes_{ REL::ID(307651) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureDoneParamTypes_{ REL::ID(1004557) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureEatParamTypes_{ REL::ID(902393) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureEscortParamTypes_{ REL::ID(236000) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureFindParamTypes_{ REL::ID(778801) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureFleeParamTypes_{ REL::ID(1428126) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureFlightGrabParamTypes_{ REL::ID(575403) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureFollowParamTypes_{ REL::ID(693393) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureFollowToParamTypes_{ REL::ID(1543119) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureForceGreetParamTypes_{ REL::ID(1007855) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureGuardAreaParamTypes_{ REL::ID(313968) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureGuardParamTypes_{ REL::ID(1046232) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureHeadtrackParamTypes_{ REL::ID(450976) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureHoldPositionParamTypes_{ REL::ID(511195) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureHoverParamTypes_{ REL::ID(549653) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureKeepAnEyeOnParamTypes_{ REL::ID(1371665) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureLockParamTypes_{ REL::ID(971249) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureOrbitParamTypes_{ REL::ID(1406913) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedurePatrolParamTypes_{ REL::ID(21630) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedurePlayIdleParamTypes_{ REL::ID(382406) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedurePursueParamTypes_{ REL::ID(1017210) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureRangeParamTypes_{ REL::ID(165585) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureSandboxParamTypes_{ REL::ID(789779) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureSayParamTypes_{ REL::ID(627765) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureSitParamTypes_{ REL::ID(227139) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureSleepParamTypes_{ REL::ID(1076939) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureStayAwayParamTypes_{ REL::ID(1185217) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureTravelParamTypes_{ REL::ID(489874) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureUnlockParamTypes_{ REL::ID(239145) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureUseIdleMarkerParamTypes_{ REL::ID(753212) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureUseMagicParamTypes_{ REL::ID(950163) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureUseWeaponParamTypes_{ REL::ID(853849) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureWaitParamTypes_{ REL::ID(80405) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureTyped_BGSProcedureBase_kProcedureWanderParamTypes_{ REL::ID(823418) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureUnlock{ REL::ID(664335) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureUseIdleMarker{ REL::ID(1177961) };
+		inline constexpr std::array<REL::ID, 2> BGSProcedureUseIdleMarkerExecState{ REL::ID(632379), REL::ID(1243852) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureUseMagic{ REL::ID(1374909) };
+		inline constexpr std::array<REL::ID, 2> BGSProcedureUseMagicExecState{ REL::ID(124695), REL::ID(736492) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureUseWeapon{ REL::ID(1278911) };
+		inline constexpr std::array<REL::ID, 2> BGSProcedureUseWeaponExecState{ REL::ID(27972), REL::ID(640094) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureWait{ REL::ID(505356) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureWaitExecState{ REL::ID(15105) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureWander{ REL::ID(1248572) };
+		inline constexpr std::array<REL::ID, 1> BGSProcedureWanderExecState{ REL::ID(703052) };
+		inline constexpr std::array<REL::ID, 5> BGSProjectile{ REL::ID(1528390), REL::ID(609575), REL::ID(1221234), REL::ID(689250), REL::ID(1300374) };
+		inline constexpr std::array<REL::ID, 1> BGSPropertySheet{ REL::ID(7522) };
+		inline constexpr std::array<REL::ID, 1> BGSQuestPerkEntry{ REL::ID(1033467) };
+		inline constexpr std::array<REL::ID, 2> BGSQueuedGrassModelHandles{ REL::ID(1556180), REL::ID(272729) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedObjectDowngrade{ REL::ID(1183796) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedObjectInitialLoad{ REL::ID(1137019) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedObjectUpgrade{ REL::ID(1230466) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedTerrainDowngrade{ REL::ID(1323423) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedTerrainInitialLoad{ REL::ID(1277007) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedTerrainUpdate{ REL::ID(1416671) };
+		inline constexpr std::array<REL::ID, 1> BGSQueuedTerrainUpgrade{ REL::ID(1369985) };
+		inline constexpr std::array<REL::ID, 1> BGSRefAlias{ REL::ID(125571) };
+		inline constexpr std::array<REL::ID, 1> BGSRefCollectionAlias{ REL::ID(978860) };
+		inline constexpr std::array<REL::ID, 1> BGSReferenceEffect{ REL::ID(324436) };
+		inline constexpr std::array<REL::ID, 1> BGSReferenceGroup{ REL::ID(1254066) };
+		inline constexpr std::array<REL::ID, 1> BGSRelationship{ REL::ID(191584) };
+		inline constexpr std::array<REL::ID, 1> BGSRetargetOnDeleteExtraData{ REL::ID(318401) };
+		inline constexpr std::array<REL::ID, 2> BGSReverbParameters{ REL::ID(1231948), REL::ID(499475) };
+		inline constexpr std::array<REL::ID, 1> BGSSaveFormBuffer{ REL::ID(13786) };
+		inline constexpr std::array<REL::ID, 1> BGSSaveGameBuffer{ REL::ID(1111111) };
+		inline constexpr std::array<REL::ID, 1> BGSSaveLoadManager{ REL::ID(47608) };
+		inline constexpr std::array<REL::ID, 1> BGSSaveLoadStatsMap{ REL::ID(848073) };
+		inline constexpr std::array<REL::ID, 1> BGSSaveLoadThread{ REL::ID(971790) };
+		inline constexpr std::array<REL::ID, 2> BGSScene{ REL::ID(1545891), REL::ID(594348) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneAction{ REL::ID(350551) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionConversationBase{ REL::ID(868723) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionDialogue{ REL::ID(360843) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionNPCResponseDialogue{ REL::ID(1397268) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionPackage{ REL::ID(879134) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionPlayerDialogue{ REL::ID(388825) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionRadio{ REL::ID(333494) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionStartScene{ REL::ID(175155) };
+		inline constexpr std::array<REL::ID, 1> BGSSceneActionTimer{ REL::ID(278461) };
+		inline constexpr std::array<REL::ID, 1> BGSShaderParticleGeometryData{ REL::ID(242032) };
+		inline constexpr std::array<REL::ID, 1> BGSSkinForm{ REL::ID(88302) };
+		inline constexpr std::array<REL::ID, 3> BGSSoundCategory{ REL::ID(738373), REL::ID(5185), REL::ID(617399) };
+		inline constexpr std::array<REL::ID, 1> BGSSoundCategorySnapshot{ REL::ID(656801) };
+		inline constexpr std::array<REL::ID, 1> BGSSoundDescriptor{ REL::ID(731759) };
+		inline constexpr std::array<REL::ID, 2> BGSSoundDescriptorForm{ REL::ID(1481385), REL::ID(529511) };
+		inline constexpr std::array<REL::ID, 1> BGSSoundKeywordMapping{ REL::ID(3167) };
+		inline constexpr std::array<REL::ID, 2> BGSSoundOutput{ REL::ID(987039), REL::ID(255076) };
+		inline constexpr std::array<REL::ID, 1> BGSSoundOutput__DynamicAttenuationCharacteristics{ REL::ID(1472902) };
+		inline constexpr std::array<REL::ID, 1> BGSSoundTagComponent{ REL::ID(619723) };
+		inline constexpr std::array<REL::ID, 1> BGSSoundTagSet{ REL::ID(228636) };
+		inline constexpr std::array<REL::ID, 1> BGSStandardSoundDef{ REL::ID(1450588) };
+		inline constexpr std::array<REL::ID, 1> BGSStandardSoundDef__SoundPlaybackCharacteristics{ REL::ID(1497495) };
+		inline constexpr std::array<REL::ID, 2> BGSStaticCollection{ REL::ID(1525387), REL::ID(606532) };
+		inline constexpr std::array<REL::ID, 1> BGSStaticCollection__RootFacade{ REL::ID(60594) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManager{ REL::ID(1226829) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerBranchNode{ REL::ID(1510184) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerEventNode{ REL::ID(1390753) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerNodeBase{ REL::ID(1364297) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerQuestFinder{ REL::ID(83201) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerQuestNode{ REL::ID(1335742) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerTreeForm{ REL::ID(1219654) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryManagerTreeVisitor{ REL::ID(1492950) };
+		inline constexpr std::array<REL::ID, 1> BGSStoryTeller{ REL::ID(10822) };
+		inline constexpr std::array<REL::ID, 1> BGSSynchronizedAnimationInstance{ REL::ID(109295) };
+		inline constexpr std::array<REL::ID, 2> BGSSynchronizedAnimationManager{ REL::ID(767543), REL::ID(1425268) };
+		inline constexpr std::array<REL::ID, 10> BGSTalkingActivator{ REL::ID(178572), REL::ID(1280636), REL::ID(309872), REL::ID(1359856), REL::ID(1533002), REL::ID(1266935), REL::ID(76800), REL::ID(1173648), REL::ID(1346161), REL::ID(1519361) };
+		inline constexpr std::array<REL::ID, 10> BGSTerminal{ REL::ID(1052852), REL::ID(134058), REL::ID(745827), REL::ID(213764), REL::ID(386275), REL::ID(120296), REL::ID(512443), REL::ID(26665), REL::ID(200044), REL::ID(372554) };
+		inline constexpr std::array<REL::ID, 1> BGSTextureModel{ REL::ID(583106) };
+		inline constexpr std::array<REL::ID, 2> BGSTextureSet{ REL::ID(877109), REL::ID(1540818) };
+		inline constexpr std::array<REL::ID, 1> BGSTransform{ REL::ID(1158052) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSAIWorldLocationInteriorCell_BGSAIWorldLocation_{ REL::ID(710093) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSAIWorldLocationPointRadius_BGSAIWorldLocation_{ REL::ID(775556) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSAIWorldLocationPrimitive_BGSAIWorldLocation_{ REL::ID(1452657) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSAIWorldLocationRefRadius_BGSAIWorldLocation_{ REL::ID(547811) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureAcquireExecState_IProcedureTreeExecState_{ REL::ID(1454337) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureActivateExecState_IProcedureTreeExecState_{ REL::ID(1305835) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureDialogueActivateExecState_IProcedureTreeExecState_{ REL::ID(491010) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureDialogueExecState_IProcedureTreeExecState_{ REL::ID(1559785) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureDoneExecState_IProcedureTreeExecState_{ REL::ID(101149) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureEatExecState_IProcedureTreeExecState_{ REL::ID(1200483) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureEscortExecState_IProcedureTreeExecState_{ REL::ID(1085824) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureFindExecState_IProcedureTreeExecState_{ REL::ID(841116) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureFleeExecState_IProcedureTreeExecState_{ REL::ID(696456) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureFlightGrabExecState_IProcedureTreeExecState_{ REL::ID(1425067) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureFollowExecState_IProcedureTreeExecState_{ REL::ID(810958) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureGuardExecState_IProcedureTreeExecState_{ REL::ID(1164034) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureHeadtrackExecState_IProcedureTreeExecState_{ REL::ID(1301149) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureHoldPositionExecState_IProcedureTreeExecState_{ REL::ID(481771) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureHoverExecState_IProcedureTreeExecState_{ REL::ID(1399195) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureKeepAnEyeOnExecState_IProcedureTreeExecState_{ REL::ID(122602) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureLockUnlockExecState_IProcedureTreeExecState_{ REL::ID(1089051) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureOrbitExecState_IProcedureTreeExecState_{ REL::ID(675176) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedurePatrolExecState_IProcedureTreeExecState_{ REL::ID(871930) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedurePlayIdleExecState_IProcedureTreeExecState_{ REL::ID(1232599) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureRangeExecState_IProcedureTreeExecState_{ REL::ID(1015364) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureSandboxExecState_IProcedureTreeExecState_{ REL::ID(57198) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureSayExecState_IProcedureTreeExecState_{ REL::ID(1345377) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureSitSleepExecState_IProcedureTreeExecState_{ REL::ID(344637) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureStayAwayExecState_IProcedureTreeExecState_{ REL::ID(452632) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTravelExecState_IProcedureTreeExecState_{ REL::ID(1339725) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeProcedure_BGSProcedureTreeConditionalItem_{ REL::ID(1485585) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeRandomExecState_BGSProcedureTreeOneChildExecState_{ REL::ID(1041262) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeRandom_BGSProcedureTreeBranch_{ REL::ID(177807) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeSequenceExecState_BGSProcedureTreeOneChildExecState_{ REL::ID(937298) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeSequence_BGSProcedureTreeBranch_{ REL::ID(73680) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeSimultaneousExecState_IProcedureTreeExecState_{ REL::ID(537053) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeSimultaneous_BGSProcedureTreeBranch_{ REL::ID(1255398) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeStackedExecState_BGSProcedureTreeOneChildExecState_{ REL::ID(737434) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureTreeStacked_BGSProcedureTreeBranch_{ REL::ID(1455724) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureUseIdleMarkerExecState_IProcedureTreeExecState_{ REL::ID(20229) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureUseMagicExecState_IProcedureTreeExecState_{ REL::ID(217988) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureUseWeaponExecState_IProcedureTreeExecState_{ REL::ID(121656) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureWaitExecState_IProcedureTreeExecState_{ REL::ID(986133) };
+		inline constexpr std::array<REL::ID, 1> BGSTypedItem_BGSProcedureWanderExecState_IProcedureTreeExecState_{ REL::ID(91108) };
+		inline constexpr std::array<REL::ID, 1> BGSVisitProceduresCheckGuardWarnTarget{ REL::ID(455428) };
+		inline constexpr std::array<REL::ID, 1> BGSVisitProceduresInitActorAnimPose{ REL::ID(293508) };
+		inline constexpr std::array<REL::ID, 1> BGSVisitProceduresInitActorLocation{ REL::ID(1379580) };
+		inline constexpr std::array<REL::ID, 1> BGSVisitProceduresProcess{ REL::ID(1218147) };
+		inline constexpr std::array<REL::ID, 1> BGSVoiceType{ REL::ID(1035074) };
+		inline constexpr std::array<REL::ID, 1> BGSWaterCollisionManager__AutoWater{ REL::ID(1213881) };
+		inline constexpr std::array<REL::ID, 1> BGSWaterCollisionManager__BGSWaterUpdateI{ REL::ID(695703) };
+		inline constexpr std::array<REL::ID, 1> BGSWaterCollisionManager__bhkPlaceableWater{ REL::ID(867851) };
+		inline constexpr std::array<REL::ID, 1> BGSWaterCollisionManager__bhkWaterfall{ REL::ID(1040770) };
+		inline constexpr std::array<REL::ID, 1> BGSZoneTargetListener{ REL::ID(109906) };
+		inline constexpr std::array<REL::ID, 1> BGSZoomData{ REL::ID(704816) };
+		inline constexpr std::array<REL::ID, 1> BGShkMatFadeController{ REL::ID(212918) };
+		inline constexpr std::array<REL::ID, 1> BGShkPhonemeController{ REL::ID(1056220) };
+		inline constexpr std::array<REL::ID, 1> BSAlignBoneModifier{ REL::ID(207861) };
+		inline constexpr std::array<REL::ID, 1> BSAlignBoneModifierInterface{ REL::ID(544493) };
+		inline constexpr std::array<REL::ID, 1> BSAnimGraphVisit__BShkbVisitor{ REL::ID(1245292) };
+		inline constexpr std::array<REL::ID, 1> BSAnimNote{ REL::ID(426792) };
+		inline constexpr std::array<REL::ID, 1> BSAnimNotes{ REL::ID(268031) };
+		inline constexpr std::array<REL::ID, 1> BSAnimationDBData{ REL::ID(219334) };
+		inline constexpr std::array<REL::ID, 1> BSAnimationGraphChannel{ REL::ID(832998) };
+		inline constexpr std::array<REL::ID, 1> BSAnimationGraphLoadScrapper{ REL::ID(616400) };
+		inline constexpr std::array<REL::ID, 1> BSAnimationGraphManager{ REL::ID(232653) };
+		inline constexpr std::array<REL::ID, 1> BSArrowConstructor{ REL::ID(870132) };
+		inline constexpr std::array<REL::ID, 1> BSAssignVariablesModifier{ REL::ID(539634) };
+		inline constexpr std::array<REL::ID, 1> BSAttachRefController{ REL::ID(372837) };
+		inline constexpr std::array<REL::ID, 1> BSAttachTechniques__AttachTechniqueInput{ REL::ID(1299207) };
+		inline constexpr std::array<REL::ID, 1> BSAttachTechniques__BSAttachTechnique{ REL::ID(1085030) };
+		inline constexpr std::array<REL::ID, 1> BSAudio{ REL::ID(56964) };
+		inline constexpr std::array<REL::ID, 1> BSAudioDataSrcBase{ REL::ID(100653) };
+		inline constexpr std::array<REL::ID, 1> BSAudioDataSrc_BSXAudio2DataSrc_{ REL::ID(1197680) };
+		inline constexpr std::array<REL::ID, 1> BSAudioEffects__BSDelayEffectParams{ REL::ID(1134694) };
+		inline constexpr std::array<REL::ID, 1> BSAudioEffects__BSOverdriveParams{ REL::ID(1494370) };
+		inline constexpr std::array<REL::ID, 1> BSAudioEffects__BSStateVariableFilterParams{ REL::ID(523357) };
+		inline constexpr std::array<REL::ID, 1> BSAudioListener{ REL::ID(646599) };
+		inline constexpr std::array<REL::ID, 1> BSAudioManagerThread{ REL::ID(537229) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_AnimationSystemUtils__TESModelAndAnimationHandles_{ REL::ID(921614) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_BSFaceGenDB__TRI__QueuedHandles_{ REL::ID(882776) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_BSMaterialDB__QueuedHandles_{ REL::ID(1462680) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_BSTextureDB__QueuedHandlesWithCallback_{ REL::ID(1447889) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_BSTextureDB__QueuedHandles_{ REL::ID(1008930) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_BShkbHkxDB__QueuedHandles_{ REL::ID(1401082) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection_TESModelDB__TESQueuedHandles_{ REL::ID(696156) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection___QueuedBGSStaticCollection_{ REL::ID(943493) };
+		inline constexpr std::array<REL::ID, 1> BSAutoQueuedResourceCollection___QueuedSubBehaviorHandles_{ REL::ID(529417) };
+		inline constexpr std::array<REL::ID, 1> BSAwardsSystemUtility{ REL::ID(827475) };
+		inline constexpr std::array<REL::ID, 1> BSBatchRenderer{ REL::ID(1263474) };
+		inline constexpr std::array<REL::ID, 1> BSBehaviorGraphExtraData{ REL::ID(929014) };
+		inline constexpr std::array<REL::ID, 1> BSBehaviorGraphSwapGenerator{ REL::ID(1523092) };
+		inline constexpr std::array<REL::ID, 2> BSBehaviorGraphSwapSingleton{ REL::ID(233592), REL::ID(1110975) };
+		inline constexpr std::array<REL::ID, 1> BSBlastNode{ REL::ID(620311) };
+		inline constexpr std::array<REL::ID, 1> BSBlendTreadTransfInterpolator{ REL::ID(1005873) };
+		inline constexpr std::array<REL::ID, 2> BSBloodSplatterShader{ REL::ID(1511942), REL::ID(1418221) };
+		inline constexpr std::array<REL::ID, 1> BSBloodSplatterShaderProperty{ REL::ID(1539330) };
+		inline constexpr std::array<REL::ID, 1> BSBoneLODExtraData{ REL::ID(752148) };
+		inline constexpr std::array<REL::ID, 1> BSBoneMap{ REL::ID(1413529) };
+		inline constexpr std::array<REL::ID, 1> BSBoneSwitchGenerator{ REL::ID(1216951) };
+		inline constexpr std::array<REL::ID, 1> BSBoneSwitchGeneratorBoneData{ REL::ID(829940) };
+		inline constexpr std::array<REL::ID, 1> BSBound{ REL::ID(352651) };
+		inline constexpr std::array<REL::ID, 1> BSBoxConstructor{ REL::ID(1229676) };
+		inline constexpr std::array<REL::ID, 1> BSByteBuffer{ REL::ID(3724) };
+		inline constexpr std::array<REL::ID, 1> BSCXAPOWrapper{ REL::ID(1408237) };
+		inline constexpr std::array<REL::ID, 1> BSCacheDriveSystemUtility{ REL::ID(295240) };
+		inline constexpr std::array<REL::ID, 1> BSCapsuleConstructor{ REL::ID(1575266) };
+		inline constexpr std::array<REL::ID, 1> BSCircleConstructor{ REL::ID(165712) };
+		inline constexpr std::array<REL::ID, 1> BSClearZNode{ REL::ID(1449313) };
+		inline constexpr std::array<REL::ID, 1> BSCloneReserver{ REL::ID(877246) };
+		inline constexpr std::array<REL::ID, 1> BSClothExtraData{ REL::ID(852013) };
+		inline constexpr std::array<REL::ID, 1> BSClothUtils__BSInstantiationUtil{ REL::ID(558742) };
+		inline constexpr std::array<REL::ID, 1> BSClothUtils__BSTransformSet{ REL::ID(465032) };
+		inline constexpr std::array<REL::ID, 1> BSClothUtils__BSTriShapeBuffer{ REL::ID(1502214) };
+		inline constexpr std::array<REL::ID, 1> BSCombinedNode{ REL::ID(648322) };
+		inline constexpr std::array<REL::ID, 1> BSCombinedTriShape{ REL::ID(358895) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionAutodiscover{ REL::ID(50887) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionConnection{ REL::ID(1446730) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionDirectConnection{ REL::ID(714908) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionDirectListener{ REL::ID(541943) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionIListener{ REL::ID(316949) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionService_PipboyCompanionService_{ REL::ID(487459) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionSocket{ REL::ID(1106569) };
+		inline constexpr std::array<REL::ID, 1> BSCompanionThread{ REL::ID(974942) };
+		inline constexpr std::array<REL::ID, 1> BSComputeAddBoneAnimModifier{ REL::ID(31529) };
+		inline constexpr std::array<REL::ID, 2> BSComputeShader{ REL::ID(582826), REL::ID(1460272) };
+		inline constexpr std::array<REL::ID, 1> BSConnectPoint__ChildOrigin{ REL::ID(817765) };
+		inline constexpr std::array<REL::ID, 1> BSConnectPoint__Children{ REL::ID(359381) };
+		inline constexpr std::array<REL::ID, 1> BSConnectPoint__Parents{ REL::ID(957246) };
+		inline constexpr std::array<REL::ID, 1> BSCounterStorage{ REL::ID(1453243) };
+		inline constexpr std::array<REL::ID, 1> BSCubeMapCamera{ REL::ID(349839) };
+		inline constexpr std::array<REL::ID, 1> BSCullingProcess{ REL::ID(556243) };
+		inline constexpr std::array<REL::ID, 1> BSCyclicBlendTransitionGenerator{ REL::ID(363515) };
+		inline constexpr std::array<REL::ID, 1> BSCylinderConstructor{ REL::ID(698023) };
+		inline constexpr std::array<REL::ID, 1> BSD3DResourceCreator{ REL::ID(889898) };
+		inline constexpr std::array<REL::ID, 2> BSDFCompositeShader{ REL::ID(435278), REL::ID(342198) };
+		inline constexpr std::array<REL::ID, 2> BSDFLightShader{ REL::ID(65824), REL::ID(1555006) };
+		inline constexpr std::array<REL::ID, 2> BSDFPrePassShader{ REL::ID(1091304), REL::ID(997876) };
+		inline constexpr std::array<REL::ID, 1> BSDamageStage{ REL::ID(565321) };
+		inline constexpr std::array<REL::ID, 1> BSDebrisNode{ REL::ID(592887) };
+		inline constexpr std::array<REL::ID, 1> BSDecomposeVectorModifier{ REL::ID(1213950) };
+		inline constexpr std::array<REL::ID, 1> BSDeferredDecal__BSDFDecal{ REL::ID(1350847) };
+		inline constexpr std::array<REL::ID, 1> BSDirectAtCapturePoseModifier{ REL::ID(1026978) };
+		inline constexpr std::array<REL::ID, 1> BSDirectAtModifier{ REL::ID(840699) };
+		inline constexpr std::array<REL::ID, 1> BSDirectAtModifierInterface{ REL::ID(1202797) };
+		inline constexpr std::array<REL::ID, 1> BSDirectoryMonitorThread{ REL::ID(13600) };
+		inline constexpr std::array<REL::ID, 1> BSDiscBootSystemUtility{ REL::ID(641163) };
+		inline constexpr std::array<REL::ID, 1> BSDiskConstructor{ REL::ID(1216077) };
+		inline constexpr std::array<REL::ID, 1> BSDismember__BSShaderDismembermentExtraData{ REL::ID(1481497) };
+		inline constexpr std::array<REL::ID, 1> BSDismembermentExtraData{ REL::ID(1096775) };
+		inline constexpr std::array<REL::ID, 1> BSDismembermentLimbExtraData{ REL::ID(498877) };
+		inline constexpr std::array<REL::ID, 1> BSDistTriggerModifier{ REL::ID(999433) };
+		inline constexpr std::array<REL::ID, 1> BSDistantObjectInstanceDataBlock{ REL::ID(1475330) };
+		inline constexpr std::array<REL::ID, 2> BSDistantTreeShader{ REL::ID(1507568), REL::ID(1413769) };
+		inline constexpr std::array<REL::ID, 1> BSDistantTreeShaderProperty{ REL::ID(1534930) };
+		inline constexpr std::array<REL::ID, 1> BSDoorHavokController{ REL::ID(767852) };
+		inline constexpr std::array<REL::ID, 1> BSDynPosData{ REL::ID(860295) };
+		inline constexpr std::array<REL::ID, 1> BSDynamicLines{ REL::ID(1312009) };
+		inline constexpr std::array<REL::ID, 1> BSDynamicTriShape{ REL::ID(681999) };
+		inline constexpr std::array<REL::ID, 2> BSEffectShader{ REL::ID(1203179), REL::ID(1109771) };
+		inline constexpr std::array<REL::ID, 1> BSEffectShaderMaterial{ REL::ID(1296172) };
+		inline constexpr std::array<REL::ID, 1> BSEffectShaderProperty{ REL::ID(708622) };
+		inline constexpr std::array<REL::ID, 1> BSEffectShaderPropertyColorController{ REL::ID(473930) };
+		inline constexpr std::array<REL::ID, 1> BSEffectShaderPropertyFloatController{ REL::ID(1378786) };
+		inline constexpr std::array<REL::ID, 1> BSEventEveryNEventsModifier{ REL::ID(108459) };
+		inline constexpr std::array<REL::ID, 1> BSEventOnDeactivateModifier{ REL::ID(346736) };
+		inline constexpr std::array<REL::ID, 1> BSEventOnFalseToTrueModifier{ REL::ID(1476939) };
+		inline constexpr std::array<REL::ID, 1> BSExternalAudioIO__ExternalIOInterface{ REL::ID(108580) };
+		inline constexpr std::array<REL::ID, 1> BSExtraData{ REL::ID(842040) };
+		inline constexpr std::array<REL::ID, 1> BSEyeCenterExtraData{ REL::ID(1325189) };
+		inline constexpr std::array<REL::ID, 2> BSFaceCustomizationShader{ REL::ID(339208), REL::ID(246095) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenAnimationData{ REL::ID(417061) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenBaseMorphExtraData{ REL::ID(421789) };
+		inline constexpr std::array<REL::ID, 2> BSFaceGenDB__TRI__QueuedHandles{ REL::ID(518256), REL::ID(817183) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenModel{ REL::ID(1400933) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenModelExtraData{ REL::ID(476859) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenModelMap__Entry{ REL::ID(150693) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenMorphData{ REL::ID(981235) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenMorphDataHair{ REL::ID(608539) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenMorphDataHead{ REL::ID(795179) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenNiNode{ REL::ID(539845) };
+		inline constexpr std::array<REL::ID, 1> BSFaceGenPendingHeadData{ REL::ID(798201) };
+		inline constexpr std::array<REL::ID, 1> BSFadeNode{ REL::ID(93613) };
+		inline constexpr std::array<REL::ID, 1> BSFadeNodeCuller{ REL::ID(1334420) };
+		inline constexpr std::array<REL::ID, 1> BSFile{ REL::ID(17166) };
+		inline constexpr std::array<REL::ID, 1> BSFile__PageCache__PhysReadType{ REL::ID(941702) };
+		inline constexpr std::array<REL::ID, 1> BSFlatQuadConstructor{ REL::ID(338246) };
+		inline constexpr std::array<REL::ID, 1> BSFlattenedBoneTree{ REL::ID(1324799) };
+		inline constexpr std::array<REL::ID, 1> BSFogProperty{ REL::ID(982750) };
+		inline constexpr std::array<REL::ID, 1> BSFrustumFOVController{ REL::ID(144118) };
+		inline constexpr std::array<REL::ID, 1> BSFurnitureMarkerNode{ REL::ID(1557523) };
+		inline constexpr std::array<REL::ID, 1> BSGFxDisplayObject{ REL::ID(734871) };
+		inline constexpr std::array<REL::ID, 1> BSGFxFunctionBase{ REL::ID(1269602) };
+		inline constexpr std::array<REL::ID, 1> BSGFxFunctionHandler{ REL::ID(611561) };
+		inline constexpr std::array<REL::ID, 2> BSGFxShaderFXTarget{ REL::ID(298683), REL::ID(956952) };
+		inline constexpr std::array<REL::ID, 1> BSGameDataSystemUtility{ REL::ID(696319) };
+		inline constexpr std::array<REL::ID, 1> BSGameSound{ REL::ID(1186834) };
+		inline constexpr std::array<REL::ID, 1> BSGameStreamUtility{ REL::ID(873930) };
+		inline constexpr std::array<REL::ID, 1> BSGamepadDevice{ REL::ID(268351) };
+		inline constexpr std::array<REL::ID, 1> BSGeometry{ REL::ID(1436492) };
+		inline constexpr std::array<REL::ID, 1> BSGeometryListCullingProcess{ REL::ID(1398386) };
+		inline constexpr std::array<REL::ID, 1> BSGeometrySegmentData{ REL::ID(661755) };
+		inline constexpr std::array<REL::ID, 1> BSGetTimeStepModifier{ REL::ID(1023944) };
+		inline constexpr std::array<REL::ID, 1> BSGrabIKNote{ REL::ID(147232) };
+		inline constexpr std::array<REL::ID, 1> BSGrassShaderProperty{ REL::ID(256570) };
+		inline constexpr std::array<REL::ID, 1> BSHandleRefObject{ REL::ID(632206) };
+		inline constexpr std::array<REL::ID, 1> BSIAlignBoneModifierSingleton{ REL::ID(7480) };
+		inline constexpr std::array<REL::ID, 1> BSIAudioEffectChain{ REL::ID(1085223) };
+		inline constexpr std::array<REL::ID, 1> BSIAudioEffectParameters{ REL::ID(882475) };
+		inline constexpr std::array<REL::ID, 1> BSIAudioEffectVisitorBase{ REL::ID(1123226) };
+		inline constexpr std::array<REL::ID, 1> BSIAudioEffectVisitor_std__reference_wrapper__lambda_f37815d38aa05819f55cde481fa665d1_const__{ REL::ID(1076710) };
+		inline constexpr std::array<REL::ID, 1> BSIDirectAtModifierSingleton{ REL::ID(424489) };
+		inline constexpr std::array<REL::ID, 1> BSIFootIkRaycastInterfaceDB{ REL::ID(981173) };
+		inline constexpr std::array<REL::ID, 1> BSILimbIKModifierSingleton{ REL::ID(759639) };
+		inline constexpr std::array<REL::ID, 1> BSILookAtModifierSingleton{ REL::ID(666381) };
+		inline constexpr std::array<REL::ID, 1> BSIMusicTrack{ REL::ID(1421122) };
+		inline constexpr std::array<REL::ID, 1> BSIMusicType{ REL::ID(1193689) };
+		inline constexpr std::array<REL::ID, 1> BSIPassByTargetTriggerModifierSingleton{ REL::ID(1302003) };
+		inline constexpr std::array<REL::ID, 1> BSIRagdollContactListenerModifierSingleton{ REL::ID(816873) };
+		inline constexpr std::array<REL::ID, 1> BSIRagdollDriver{ REL::ID(317412) };
+		inline constexpr std::array<REL::ID, 1> BSIRagdollDriverSingleton{ REL::ID(332091) };
+		inline constexpr std::array<REL::ID, 1> BSIReverbType{ REL::ID(181777) };
+		inline constexpr std::array<REL::ID, 1> BSISoundCategory{ REL::ID(1536229) };
+		inline constexpr std::array<REL::ID, 1> BSISoundDescriptor{ REL::ID(997157) };
+		inline constexpr std::array<REL::ID, 1> BSISoundDescriptor__BSIPlaybackCharacteristics{ REL::ID(1543864) };
+		inline constexpr std::array<REL::ID, 1> BSISoundOutputModel{ REL::ID(907827) };
+		inline constexpr std::array<REL::ID, 1> BSISoundOutputModel__BSIAttenuationCharacteristics{ REL::ID(1173816) };
+		inline constexpr std::array<REL::ID, 1> BSIStateManagerModifier{ REL::ID(837650) };
+		inline constexpr std::array<REL::ID, 1> BSIStateManagerModifier__BSIStateManagerStateListener{ REL::ID(464892) };
+		inline constexpr std::array<REL::ID, 1> BSIStream{ REL::ID(21265) };
+		inline constexpr std::array<REL::ID, 2> BSIdleInputWatcher{ REL::ID(1579916), REL::ID(436033) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceComputeShader{ REL::ID(1224907), REL::ID(646285), REL::ID(1304073) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShader{ REL::ID(737314), REL::ID(158509), REL::ID(816591) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderAlphaBlend{ REL::ID(592258), REL::ID(12958), REL::ID(671801) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderAmbientOcclusion{ REL::ID(305219), REL::ID(1308770), REL::ID(384661) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderAmbientOcclusionBlur{ REL::ID(903021), REL::ID(324299), REL::ID(982295) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur11{ REL::ID(481932), REL::ID(1485981), REL::ID(561648) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur13{ REL::ID(1079706), REL::ID(501046), REL::ID(1159297) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur15{ REL::ID(95228), REL::ID(1098938), REL::ID(174978) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur3{ REL::ID(1255574), REL::ID(677215), REL::ID(1334792) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur5{ REL::ID(1148422), REL::ID(570029), REL::ID(1228139) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur7{ REL::ID(1307420), REL::ID(729235), REL::ID(1386798) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlur9{ REL::ID(1466618), REL::ID(887880), REL::ID(1546149) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX11_480CS{ REL::ID(1520373), REL::ID(941452), REL::ID(16913) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX13_480CS{ REL::ID(1360849), REL::ID(782740), REL::ID(1440512) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX15_480CS{ REL::ID(1202305), REL::ID(623642), REL::ID(1281598) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX3_480CS{ REL::ID(573986), REL::ID(1577634), REL::ID(653652) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX5_480CS{ REL::ID(414655), REL::ID(1418254), REL::ID(494204) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX7_480CS{ REL::ID(255918), REL::ID(1259590), REL::ID(335356) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurX9_480CS{ REL::ID(96845), REL::ID(1100586), REL::ID(176597) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY11_270CS{ REL::ID(1489890), REL::ID(911029), REL::ID(1569312) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY13_270CS{ REL::ID(1330423), REL::ID(752213), REL::ID(1409857) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY15_270CS{ REL::ID(733217), REL::ID(154417), REL::ID(812486) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY3_270CS{ REL::ID(104619), REL::ID(1108152), REL::ID(184268) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY5_270CS{ REL::ID(384239), REL::ID(1387720), REL::ID(463475) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY7_270CS{ REL::ID(225447), REL::ID(1229039), REL::ID(304757) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBlurY9_270CS{ REL::ID(66386), REL::ID(1069865), REL::ID(145799) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBokehDepthOfFieldPass1{ REL::ID(797850), REL::ID(219058), REL::ID(876989) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBokehDepthOfFieldPass2{ REL::ID(1568366), REL::ID(989210), REL::ID(65384) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBokehDepthOfFieldPass3{ REL::ID(583794), REL::ID(4365), REL::ID(663337) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBokehDepthOfFieldPass4{ REL::ID(1181395), REL::ID(602815), REL::ID(1260938) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBokehDepthOfFieldPass4Fogged{ REL::ID(1340130), REL::ID(761906), REL::ID(1419617) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur11{ REL::ID(248192), REL::ID(1251963), REL::ID(327628) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur13{ REL::ID(407042), REL::ID(1410564), REL::ID(486586) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur15{ REL::ID(566311), REL::ID(1570033), REL::ID(645879) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur3{ REL::ID(316921), REL::ID(1320436), REL::ID(396341) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur5{ REL::ID(1353267), REL::ID(775041), REL::ID(1432694) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur7{ REL::ID(1512694), REL::ID(933753), REL::ID(9130) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlur9{ REL::ID(89214), REL::ID(1092781), REL::ID(168867) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY11_270CS{ REL::ID(792748), REL::ID(214074), REL::ID(871873) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY13_270CS{ REL::ID(1072217), REL::ID(493508), REL::ID(1151728) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY15_270CS{ REL::ID(474448), REL::ID(1478486), REL::ID(554231) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY3_270CS{ REL::ID(18571), REL::ID(1022461), REL::ID(98474) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY5_270CS{ REL::ID(1003335), REL::ID(424728), REL::ID(1082956) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY7_270CS{ REL::ID(405656), REL::ID(1409102), REL::ID(485228) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassBlurY9_270CS{ REL::ID(1390026), REL::ID(811800), REL::ID(1469952) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassHDRBlurY15_1024CS{ REL::ID(1459131), REL::ID(880296), REL::ID(1538661) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassHDRBlurY15_180CS{ REL::ID(263607), REL::ID(1267239), REL::ID(342948) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderBrightPassHDRBlurY15_270CS{ REL::ID(861211), REL::ID(282616), REL::ID(940736) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderCopy{ REL::ID(616848), REL::ID(37903), REL::ID(696615) };
+		inline constexpr std::array<REL::ID, 1> BSImagespaceShaderCopyParam{ REL::ID(740803) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderCopyScaleBias{ REL::ID(1480835), REL::ID(901877), REL::ID(1560186) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderCopyShadowMapToArray{ REL::ID(40236), REL::ID(1043982), REL::ID(119889) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderCopyStencil{ REL::ID(865783), REL::ID(287146), REL::ID(945405) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderCopyVisAlpha{ REL::ID(495856), REL::ID(1500012), REL::ID(575559) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderCopyWaterMask{ REL::ID(1024791), REL::ID(446027), REL::ID(1104415) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDepthOfField{ REL::ID(638369), REL::ID(59476), REL::ID(718084) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDepthOfFieldFogged{ REL::ID(92461), REL::ID(1096082), REL::ID(172180) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDepthOfFieldSplitScreen{ REL::ID(690482), REL::ID(111536), REL::ID(769823) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDistantBlur{ REL::ID(1287894), REL::ID(709817), REL::ID(1367117) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDistantBlurFogged{ REL::ID(1008018), REL::ID(429309), REL::ID(1087621) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDoubleVision{ REL::ID(1167180), REL::ID(588755), REL::ID(1246835) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderDownsampleDepth{ REL::ID(268311), REL::ID(1271864), REL::ID(347543) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderFXAA{ REL::ID(1219414), REL::ID(640744), REL::ID(1298581) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderFullScreenColor{ REL::ID(621521), REL::ID(42612), REL::ID(701355) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderGammaCorrect{ REL::ID(698314), REL::ID(119179), REL::ID(777616) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderGammaCorrectLUT{ REL::ID(1174854), REL::ID(596438), REL::ID(1254393) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderGammaCorrectResize{ REL::ID(1561862), REL::ID(982784), REL::ID(58754) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderGammaLinearize{ REL::ID(577167), REL::ID(1580836), REL::ID(656849) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderGreyScale{ REL::ID(1252827), REL::ID(674428), REL::ID(1332028) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRBlurX15_1024CS{ REL::ID(1482240), REL::ID(903295), REL::ID(1561642) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRBlurX15_320CS{ REL::ID(725501), REL::ID(146561), REL::ID(804841) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRBlurX15_480CS{ REL::ID(179601), REL::ID(1183088), REL::ID(258877) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample16{ REL::ID(401137), REL::ID(1404799), REL::ID(480760) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample16LightAdapt{ REL::ID(505294), REL::ID(1509216), REL::ID(585035) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample16Lum{ REL::ID(1227029), REL::ID(648351), REL::ID(1306223) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample16LumCS{ REL::ID(768437), REL::ID(189932), REL::ID(847688) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample16LumClamp{ REL::ID(14101), REL::ID(1018059), REL::ID(94037) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample2LightAdaptCS{ REL::ID(1525193), REL::ID(946320), REL::ID(21803) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample4{ REL::ID(1333638), REL::ID(755501), REL::ID(1413109) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample4CS{ REL::ID(449995), REL::ID(1454026), REL::ID(529871) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample4LightAdapt{ REL::ID(612414), REL::ID(33352), REL::ID(692132) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample4LumCS{ REL::ID(609373), REL::ID(30263), REL::ID(689092) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample4LumClamp{ REL::ID(560472), REL::ID(1564233), REL::ID(640030) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample4RGB2Lum{ REL::ID(242349), REL::ID(1246119), REL::ID(321764) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRDownSample64RGB2LumCS{ REL::ID(927192), REL::ID(348480), REL::ID(1006615) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRTonemapBlendCinematic{ REL::ID(1103054), REL::ID(524446), REL::ID(1182576) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHDRTonemapBlendCinematicFade{ REL::ID(995807), REL::ID(417196), REL::ID(1075500) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlass{ REL::ID(635591), REL::ID(56678), REL::ID(715311) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlassBlurX{ REL::ID(234985), REL::ID(1238636), REL::ID(314370) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlassBlurY{ REL::ID(514608), REL::ID(1518438), REL::ID(594340) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlassClear{ REL::ID(114019), REL::ID(1117614), REL::ID(193904) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlassCopy{ REL::ID(1416386), REL::ID(838008), REL::ID(1496428) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlassDropShadow{ REL::ID(355481), REL::ID(1358977), REL::ID(434816) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderHUDGlassMarkers{ REL::ID(1537495), REL::ID(958712), REL::ID(34314) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderLensFlare{ REL::ID(1230399), REL::ID(651887), REL::ID(1309717) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderLensFlareVisibility{ REL::ID(1216809), REL::ID(638086), REL::ID(1295920) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderLocalMap{ REL::ID(540685), REL::ID(1544218), REL::ID(620106) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderLocalMapCompanion{ REL::ID(260701), REL::ID(1264433), REL::ID(340183) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderMap{ REL::ID(858445), REL::ID(279828), REL::ID(937906) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderModMenuEffect{ REL::ID(1569766), REL::ID(990593), REL::ID(66826) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderModMenuGlowComposite{ REL::ID(146281), REL::ID(1149748), REL::ID(225905) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderMotionBlur{ REL::ID(1234881), REL::ID(656400), REL::ID(1314168) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNoiseNormalmap{ REL::ID(1522219), REL::ID(943306), REL::ID(18781) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNoiseScrollAndBlend{ REL::ID(578837), REL::ID(1582523), REL::ID(658528) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur11{ REL::ID(1156207), REL::ID(577683), REL::ID(1235857) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur13{ REL::ID(876311), REL::ID(297662), REL::ID(955998) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur15{ REL::ID(596916), REL::ID(17640), REL::ID(676520) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur3{ REL::ID(693329), REL::ID(114272), REL::ID(772725) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur5{ REL::ID(413033), REL::ID(1416649), REL::ID(492563) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur7{ REL::ID(133421), REL::ID(1136992), REL::ID(213103) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderNonHDRBlur9{ REL::ID(1435798), REL::ID(857336), REL::ID(1515747) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderPipboyScreen{ REL::ID(37402), REL::ID(1041161), REL::ID(117053) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRadialBlur{ REL::ID(537646), REL::ID(1541186), REL::ID(617056) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRadialBlurHigh{ REL::ID(855416), REL::ID(276842), REL::ID(934913) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRadialBlurMedium{ REL::ID(696842), REL::ID(117740), REL::ID(776202) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRainSplash{ REL::ID(621929), REL::ID(43052), REL::ID(701784) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRainSplashDraw{ REL::ID(407713), REL::ID(1411212), REL::ID(487227) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRainSplashUpdate{ REL::ID(1392088), REL::ID(813838), REL::ID(1472080) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderRefraction{ REL::ID(1014325), REL::ID(435530), REL::ID(1093937) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOBlurH{ REL::ID(1511712), REL::ID(932787), REL::ID(8182) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOBlurHCS{ REL::ID(430426), REL::ID(1434088), REL::ID(510189) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOBlurV{ REL::ID(88271), REL::ID(1091806), REL::ID(167947) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOBlurVCS{ REL::ID(1028293), REL::ID(449504), REL::ID(1107877) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOCameraAndMipsZCS{ REL::ID(1110954), REL::ID(532480), REL::ID(1190482) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOCameraZ{ REL::ID(1127589), REL::ID(549332), REL::ID(1207458) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOCameraZCS{ REL::ID(1390474), REL::ID(812223), REL::ID(1470414) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOMinify{ REL::ID(143201), REL::ID(1146779), REL::ID(222889) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOMinifyCS{ REL::ID(989911), REL::ID(411396), REL::ID(1069609) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAOMipsZCS{ REL::ID(1269982), REL::ID(691659), REL::ID(1349211) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAORawAO{ REL::ID(741279), REL::ID(162481), REL::ID(820525) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAORawAOCS{ REL::ID(710941), REL::ID(131751), REL::ID(790157) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSAORawAOEditor{ REL::ID(748924), REL::ID(170301), REL::ID(828210) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSSLRBlurH{ REL::ID(907702), REL::ID(329024), REL::ID(986927) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSSLRBlurV{ REL::ID(361754), REL::ID(1365221), REL::ID(441153) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSSLRPrepass{ REL::ID(1291385), REL::ID(713216), REL::ID(1370643) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSSLRRaytracing{ REL::ID(82185), REL::ID(1085740), REL::ID(161792) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderSunbeams{ REL::ID(745873), REL::ID(167227), REL::ID(825185) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderTemporalAA{ REL::ID(673683), REL::ID(94753), REL::ID(753145) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderTemporalAAPipboy{ REL::ID(1084572), REL::ID(505998), REL::ID(1164188) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderTemporalAAPowerArmorPipboy{ REL::ID(1243787), REL::ID(665231), REL::ID(1322935) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderTextureMask{ REL::ID(655281), REL::ID(76390), REL::ID(734802) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderUpsampleDynamicResolution{ REL::ID(1343190), REL::ID(764974), REL::ID(1422639) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSApplication{ REL::ID(374006), REL::ID(1377407), REL::ID(453269) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSComposite{ REL::ID(267099), REL::ID(1270701), REL::ID(346385) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSScatterAccum{ REL::ID(1465709), REL::ID(886914), REL::ID(1545182) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSSliceCoord{ REL::ID(259307), REL::ID(1263033), REL::ID(338747) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSSliceInterp{ REL::ID(591306), REL::ID(11983), REL::ID(670858) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSSliceScatterInterp{ REL::ID(1133720), REL::ID(555356), REL::ID(1213576) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSSliceScatterRay{ REL::ID(1520807), REL::ID(941894), REL::ID(17362) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSSliceStencil{ REL::ID(45161), REL::ID(1048951), REL::ID(124848) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVLSSpotLight{ REL::ID(215207), REL::ID(1218966), REL::ID(294351) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVatsTarget{ REL::ID(605906), REL::ID(26737), REL::ID(685623) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderVatsTargetDebug{ REL::ID(1417345), REL::ID(838955), REL::ID(1497408) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterBlendHeightmaps{ REL::ID(531574), REL::ID(1535186), REL::ID(611031) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterDisplacementClearSimulation{ REL::ID(735026), REL::ID(156207), REL::ID(814318) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterDisplacementNormals{ REL::ID(1021995), REL::ID(443242), REL::ID(1101707) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterDisplacementRainRipple{ REL::ID(320327), REL::ID(1323834), REL::ID(399780) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterDisplacementTexOffset{ REL::ID(1066321), REL::ID(487690), REL::ID(1145838) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterDisplacementWadingRipple{ REL::ID(1132086), REL::ID(553773), REL::ID(1211932) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterRainHeightmap{ REL::ID(372367), REL::ID(1375775), REL::ID(451617) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterSmoothHeightmap{ REL::ID(424264), REL::ID(1427807), REL::ID(503885) };
+		inline constexpr std::array<REL::ID, 3> BSImagespaceShaderWaterWadingHeightmap{ REL::ID(918103), REL::ID(339460), REL::ID(997420) };
+		inline constexpr std::array<REL::ID, 1> BSInputDevice{ REL::ID(95476) };
+		inline constexpr std::array<REL::ID, 1> BSInputEnableManager__DebugNameFunctor__lambda_0183a1083b444b9fd1a5d528e2445cea__{ REL::ID(428092) };
+		inline constexpr std::array<REL::ID, 1> BSInputEnableManager__DebugNameFunctor__lambda_2633b694cf8b2a29ef2701e4269a0982__{ REL::ID(1010569) };
+		inline constexpr std::array<REL::ID, 1> BSInputEnableManager__DebugNameFunctor__lambda_3f64572034d41d0f53dacb1f094581f4__{ REL::ID(525950) };
+		inline constexpr std::array<REL::ID, 1> BSInputEnableManager__DebugNameFunctor__lambda_51898d9d154d5883d1389df7da840cbf__{ REL::ID(236857) };
+		inline constexpr std::array<REL::ID, 1> BSInputEnableManager__DebugNameFunctor__lambda_9011be17262ef553c8f6835cfb8451c9__{ REL::ID(521313) };
+		inline constexpr std::array<REL::ID, 1> BSInputEnableManager__IDebugNameFunctor{ REL::ID(946944) };
+		inline constexpr std::array<REL::ID, 1> BSInputEventReceiver{ REL::ID(1141017) };
+		inline constexpr std::array<REL::ID, 2> BSInputEventSingleUser{ REL::ID(109921), REL::ID(768200) };
+		inline constexpr std::array<REL::ID, 1> BSInputEventUser{ REL::ID(253825) };
+		inline constexpr std::array<REL::ID, 1> BSInstanceGroup{ REL::ID(1114365) };
+		inline constexpr std::array<REL::ID, 1> BSInstanceTriShape{ REL::ID(1266945) };
+		inline constexpr std::array<REL::ID, 1> BSInterpValueModifier{ REL::ID(198819) };
+		inline constexpr std::array<REL::ID, 1> BSInvMarker{ REL::ID(1121767) };
+		inline constexpr std::array<REL::ID, 1> BSIsActiveModifier{ REL::ID(11629) };
+		inline constexpr std::array<REL::ID, 1> BSJobs__JobThread{ REL::ID(1426887) };
+		inline constexpr std::array<REL::ID, 1> BSKeyboardDevice{ REL::ID(1301573) };
+		inline constexpr std::array<REL::ID, 1> BSLODMultiIndexTriShape{ REL::ID(755672) };
+		inline constexpr std::array<REL::ID, 1> BSLODTriShape{ REL::ID(166727) };
+		inline constexpr std::array<REL::ID, 1> BSLagBoneController{ REL::ID(134285) };
+		inline constexpr std::array<REL::ID, 1> BSLeafAnimNode{ REL::ID(1448150) };
+		inline constexpr std::array<REL::ID, 1> BSLensFlareSpriteRenderData{ REL::ID(14958) };
+		inline constexpr std::array<REL::ID, 1> BSLight{ REL::ID(1277885) };
+		inline constexpr std::array<REL::ID, 2> BSLightingShader{ REL::ID(343833), REL::ID(250744) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterial{ REL::ID(1194322) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialBase{ REL::ID(1372276) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialDismemberment{ REL::ID(799450) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialEnvmap{ REL::ID(1013115) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialEye{ REL::ID(654324) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialFace{ REL::ID(439756) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialGlowmap{ REL::ID(294570) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialHairTint{ REL::ID(1303639) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialLODLandscape{ REL::ID(585465) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialLandscape{ REL::ID(944443) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialMultiLayerParallax{ REL::ID(1449069) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialParallax{ REL::ID(1517987) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialParallaxOcc{ REL::ID(1158541) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialSkinTint{ REL::ID(80796) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderMaterialSnow{ REL::ID(226130) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderProperty{ REL::ID(241915) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderPropertyColorController{ REL::ID(263059) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderPropertyFloatController{ REL::ID(757082) };
+		inline constexpr std::array<REL::ID, 1> BSLightingShaderPropertyUShortController{ REL::ID(1168069) };
+		inline constexpr std::array<REL::ID, 1> BSLimbCycleModifier{ REL::ID(1407632) };
+		inline constexpr std::array<REL::ID, 1> BSLimbIKModifier{ REL::ID(675937) };
+		inline constexpr std::array<REL::ID, 1> BSLimbIKModifierCastInfo{ REL::ID(320591) };
+		inline constexpr std::array<REL::ID, 1> BSLimbIKModifierUtility{ REL::ID(1258192) };
+		inline constexpr std::array<REL::ID, 1> BSLimbIKModifierUtilityCastInfo{ REL::ID(819421) };
+		inline constexpr std::array<REL::ID, 1> BSLines{ REL::ID(1339394) };
+		inline constexpr std::array<REL::ID, 1> BSListBase_BSTempEffectDebris_{ REL::ID(1367395) };
+		inline constexpr std::array<REL::ID, 1> BSList_BSTempEffectDebris_{ REL::ID(1540542) };
+		inline constexpr std::array<REL::ID, 1> BSListenSocket{ REL::ID(889074) };
+		inline constexpr std::array<REL::ID, 1> BSLookAtCapturePoseModifier{ REL::ID(302474) };
+		inline constexpr std::array<REL::ID, 1> BSLookAtModifier{ REL::ID(116040) };
+		inline constexpr std::array<REL::ID, 1> BSLookAtModifierInterface{ REL::ID(264554) };
+		inline constexpr std::array<REL::ID, 1> BSLookIKNote{ REL::ID(306101) };
+		inline constexpr std::array<REL::ID, 1> BSMasterParticleSystem{ REL::ID(112872) };
+		inline constexpr std::array<REL::ID, 2> BSMaterialDB__QueuedHandles{ REL::ID(428841), REL::ID(728258) };
+		inline constexpr std::array<REL::ID, 1> BSMaterialObject{ REL::ID(1515584) };
+		inline constexpr std::array<REL::ID, 1> BSMemStorage{ REL::ID(745900) };
+		inline constexpr std::array<REL::ID, 1> BSMemStorageAllocated_BSMemStorageHeapAllocator_{ REL::ID(1381074) };
+		inline constexpr std::array<REL::ID, 1> BSMemStorageAllocated_BSMemStorageScrapAllocator_{ REL::ID(605354) };
+		inline constexpr std::array<REL::ID, 1> BSMergeInstancedTriShape{ REL::ID(245837) };
+		inline constexpr std::array<REL::ID, 1> BSMeshLODTriShape{ REL::ID(403494) };
+		inline constexpr std::array<REL::ID, 1> BSModelDB__BSModelProcessor{ REL::ID(1509483) };
+		inline constexpr std::array<REL::ID, 2> BSModelDB__QueuedHandles{ REL::ID(373592), REL::ID(672786) };
+		inline constexpr std::array<REL::ID, 1> BSModifyOnceModifier{ REL::ID(1484695) };
+		inline constexpr std::array<REL::ID, 1> BSMouseDevice{ REL::ID(1526628) };
+		inline constexpr std::array<REL::ID, 1> BSMsgDialogSystemUtility{ REL::ID(687841) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBound{ REL::ID(14288) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundAABB{ REL::ID(736911) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundCapsule{ REL::ID(735435) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundNode{ REL::ID(218331) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundOBB{ REL::ID(1068188) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundRoom{ REL::ID(173986) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundShape{ REL::ID(496280) };
+		inline constexpr std::array<REL::ID, 1> BSMultiBoundSphere{ REL::ID(389564) };
+		inline constexpr std::array<REL::ID, 1> BSMultiIndexTriShape{ REL::ID(918758) };
+		inline constexpr std::array<REL::ID, 1> BSMultiStreamInstanceTriShape{ REL::ID(95842) };
+		inline constexpr std::array<REL::ID, 1> BSMultiTargetTreadTransfController{ REL::ID(955494) };
+		inline constexpr std::array<REL::ID, 1> BSNavmesh{ REL::ID(1362698) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshInfoMap{ REL::ID(914431) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshInfoMap__IRecursiveVisitor{ REL::ID(36689) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshInfoMap__IVisitor{ REL::ID(1158372) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshInfoSearch{ REL::ID(1559710) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshObstacleCoverData{ REL::ID(728985) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshObstacleData{ REL::ID(70645) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshObstacleUndoData{ REL::ID(420047) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshReferenceObstacleArray{ REL::ID(398462) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshSearch{ REL::ID(1265394) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshSearchFilters{ REL::ID(275445) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshSearchHideFilter{ REL::ID(1527777) };
+		inline constexpr std::array<REL::ID, 1> BSNavmeshSearchMaxCostFilters{ REL::ID(463274) };
+		inline constexpr std::array<REL::ID, 1> BSNiAllocator{ REL::ID(698349) };
+		inline constexpr std::array<REL::ID, 1> BSNiAlphaPropertyTestRefController{ REL::ID(712960) };
+		inline constexpr std::array<REL::ID, 1> BSNiNode{ REL::ID(276310) };
+		inline constexpr std::array<REL::ID, 1> BSNodeReferences{ REL::ID(346567) };
+		inline constexpr std::array<REL::ID, 1> BSNonUniformScaleExtraData{ REL::ID(465795) };
+		inline constexpr std::array<REL::ID, 1> BSNullImplAudio{ REL::ID(32177) };
+		inline constexpr std::array<REL::ID, 1> BSNullImplAudioListener{ REL::ID(1524113) };
+		inline constexpr std::array<REL::ID, 1> BSNullImplGameSound{ REL::ID(1038396) };
+		inline constexpr std::array<REL::ID, 1> BSOStream{ REL::ID(899262) };
+		inline constexpr std::array<REL::ID, 1> BSOcclusionBox{ REL::ID(292884) };
+		inline constexpr std::array<REL::ID, 1> BSOcclusionPlane{ REL::ID(1329423) };
+		inline constexpr std::array<REL::ID, 1> BSOcclusionShape{ REL::ID(1193536) };
+		inline constexpr std::array<REL::ID, 1> BSOffsetAnimationGenerator{ REL::ID(1190827) };
+		inline constexpr std::array<REL::ID, 1> BSOrderedNode{ REL::ID(452311) };
+		inline constexpr std::array<REL::ID, 1> BSOrientedBoxConstructor{ REL::ID(524852) };
+		inline constexpr std::array<REL::ID, 1> BSPCGamepadDevice{ REL::ID(1194768) };
+		inline constexpr std::array<REL::ID, 1> BSPCGamepadDeviceDelegate{ REL::ID(849164) };
+		inline constexpr std::array<REL::ID, 1> BSPCGamepadDeviceHandler{ REL::ID(503682) };
+		inline constexpr std::array<REL::ID, 1> BSPCKeyboardDevice{ REL::ID(553595) };
+		inline constexpr std::array<REL::ID, 1> BSPCMouseDevice{ REL::ID(506722) };
+		inline constexpr std::array<REL::ID, 1> BSPCOrbisGamepadDevice{ REL::ID(1540322) };
+		inline constexpr std::array<REL::ID, 1> BSPCVirtualKeyboardDevice{ REL::ID(1474760) };
+		inline constexpr std::array<REL::ID, 1> BSPSysArrayEmitter{ REL::ID(430394) };
+		inline constexpr std::array<REL::ID, 1> BSPSysHavokUpdateModifier{ REL::ID(1423606) };
+		inline constexpr std::array<REL::ID, 1> BSPSysHavokUpdateModifier__ICollisionObjectHandler{ REL::ID(503219) };
+		inline constexpr std::array<REL::ID, 1> BSPSysInheritVelocityModifier{ REL::ID(176565) };
+		inline constexpr std::array<REL::ID, 1> BSPSysLODModifier{ REL::ID(139195) };
+		inline constexpr std::array<REL::ID, 1> BSPSysMultiTargetEmitterCtlr{ REL::ID(25246) };
+		inline constexpr std::array<REL::ID, 1> BSPSysRecycleBoundModifier{ REL::ID(663077) };
+		inline constexpr std::array<REL::ID, 1> BSPSysScaleModifier{ REL::ID(680548) };
+		inline constexpr std::array<REL::ID, 1> BSPSysSimpleColorModifier{ REL::ID(246309) };
+		inline constexpr std::array<REL::ID, 1> BSPSysStripUpdateModifier{ REL::ID(1066730) };
+		inline constexpr std::array<REL::ID, 1> BSPSysSubTexModifier{ REL::ID(82381) };
+		inline constexpr std::array<REL::ID, 1> BSPackedCombinedGeomDataExtra{ REL::ID(1014803) };
+		inline constexpr std::array<REL::ID, 1> BSPackedCombinedSharedGeomDataExtra{ REL::ID(628368) };
+		inline constexpr std::array<REL::ID, 1> BSPackedSharedGeometryBuilder{ REL::ID(189679) };
+		inline constexpr std::array<REL::ID, 1> BSParabolicCullingProcess{ REL::ID(845854) };
+		inline constexpr std::array<REL::ID, 1> BSParentVelocityModifier{ REL::ID(85433) };
+		inline constexpr std::array<REL::ID, 2> BSParticleShader{ REL::ID(1568806), REL::ID(1475603) };
+		inline constexpr std::array<REL::ID, 1> BSParticleShaderCubeEmitter{ REL::ID(115845) };
+		inline constexpr std::array<REL::ID, 1> BSParticleShaderEmitter{ REL::ID(601396) };
+		inline constexpr std::array<REL::ID, 1> BSParticleShaderRainEmitter{ REL::ID(1213006) };
+		inline constexpr std::array<REL::ID, 1> BSParticleShaderSnowEmitter{ REL::ID(727760) };
+		inline constexpr std::array<REL::ID, 1> BSParticleSystemManager{ REL::ID(380206) };
+		inline constexpr std::array<REL::ID, 1> BSPassByTargetTriggerModifier{ REL::ID(1495387) };
+		inline constexpr std::array<REL::ID, 1> BSPassByTargetTriggerModifierInterface{ REL::ID(484093) };
+		inline constexpr std::array<REL::ID, 1> BSPathBuilder{ REL::ID(327387) };
+		inline constexpr std::array<REL::ID, 1> BSPathEventManager{ REL::ID(948913) };
+		inline constexpr std::array<REL::ID, 1> BSPathSmootherPOVSearch{ REL::ID(1069416) };
+		inline constexpr std::array<REL::ID, 1> BSPathfindingTemporary_BSPathingSolution_{ REL::ID(348748) };
+		inline constexpr std::array<REL::ID, 1> BSPathfindingTemporary_PathingDoor_{ REL::ID(457965) };
+		inline constexpr std::array<REL::ID, 1> BSPathfindingTemporary_PathingRequestClosePoint_{ REL::ID(1006906) };
+		inline constexpr std::array<REL::ID, 1> BSPathfindingTemporary_PathingRequestCover_{ REL::ID(1288940) };
+		inline constexpr std::array<REL::ID, 1> BSPathfindingTemporary_PathingRequestSafeStraightLine_{ REL::ID(927466) };
+		inline constexpr std::array<REL::ID, 1> BSPathfindingTemporary_PathingRequest_{ REL::ID(1539163) };
+		inline constexpr std::array<REL::ID, 1> BSPathing{ REL::ID(1132831) };
+		inline constexpr std::array<REL::ID, 1> BSPathingCell{ REL::ID(36027) };
+		inline constexpr std::array<REL::ID, 1> BSPathingCellManager{ REL::ID(1473534) };
+		inline constexpr std::array<REL::ID, 1> BSPathingDoor{ REL::ID(806976) };
+		inline constexpr std::array<REL::ID, 1> BSPathingLOSGrid{ REL::ID(467087) };
+		inline constexpr std::array<REL::ID, 1> BSPathingLOSGridCell{ REL::ID(1344633) };
+		inline constexpr std::array<REL::ID, 1> BSPathingLOSGridMap{ REL::ID(1172057) };
+		inline constexpr std::array<REL::ID, 1> BSPathingLockData{ REL::ID(1376765) };
+		inline constexpr std::array<REL::ID, 1> BSPathingNumericIDVisitor{ REL::ID(1143823) };
+		inline constexpr std::array<REL::ID, 1> BSPathingRequest{ REL::ID(1050347) };
+		inline constexpr std::array<REL::ID, 1> BSPathingSearchRayCast{ REL::ID(508053) };
+		inline constexpr std::array<REL::ID, 1> BSPathingSpace{ REL::ID(691711) };
+		inline constexpr std::array<REL::ID, 1> BSPathingStreamRead{ REL::ID(1385348) };
+		inline constexpr std::array<REL::ID, 1> BSPathingStreamSimpleBufferRead{ REL::ID(1019723) };
+		inline constexpr std::array<REL::ID, 1> BSPathingStreamSimpleBufferWrite{ REL::ID(1480690) };
+		inline constexpr std::array<REL::ID, 1> BSPathingStreamWrite{ REL::ID(696469) };
+		inline constexpr std::array<REL::ID, 1> BSPathing__CheckLineOfSightFilter{ REL::ID(832524) };
+		inline constexpr std::array<REL::ID, 1> BSPathing__EdgeFoundVisitor{ REL::ID(474692) };
+		inline constexpr std::array<REL::ID, 1> BSPistonController{ REL::ID(256035) };
+		inline constexpr std::array<REL::ID, 1> BSPlatform__BSAsyncRequestBase{ REL::ID(1412402) };
+		inline constexpr std::array<REL::ID, 1> BSPlatform__BSAsyncRequest_std__function_void__{ REL::ID(1300162) };
+		inline constexpr std::array<REL::ID, 1> BSPlatform__BSBethesdaPlatform{ REL::ID(600080) };
+		inline constexpr std::array<REL::ID, 1> BSPlatform__BSDownloadRequest{ REL::ID(731277) };
+		inline constexpr std::array<REL::ID, 1> BSPlatform__BSTerminatedCallback{ REL::ID(1383983) };
+		inline constexpr std::array<REL::ID, 1> BSPlatform__BSUploadRequest{ REL::ID(291939) };
+		inline constexpr std::array<REL::ID, 1> BSPlayerDistanceCheckController{ REL::ID(1524605) };
+		inline constexpr std::array<REL::ID, 1> BSPointerListBase_BSTempEffectDebris_{ REL::ID(663171) };
+		inline constexpr std::array<REL::ID, 1> BSPortal{ REL::ID(721834) };
+		inline constexpr std::array<REL::ID, 1> BSPortalGraph{ REL::ID(535479) };
+		inline constexpr std::array<REL::ID, 1> BSPortalGraphEntry{ REL::ID(1459547) };
+		inline constexpr std::array<REL::ID, 1> BSPortalSharedNode{ REL::ID(517865) };
+		inline constexpr std::array<REL::ID, 1> BSPositionData{ REL::ID(361786) };
+		inline constexpr std::array<REL::ID, 1> BSPrecomputedNavmeshInfoPathMap__INavmeshInfoVisitor{ REL::ID(382372) };
+		inline constexpr std::array<REL::ID, 1> BSPrecomputedNavmeshInfoSearch{ REL::ID(854758) };
+		inline constexpr std::array<REL::ID, 1> BSPrecomputedVisibility__MultiCellVisibilityData__TomeCollectionBuildTask{ REL::ID(1027370) };
+		inline constexpr std::array<REL::ID, 1> BSProceduralLightningController{ REL::ID(168141) };
+		inline constexpr std::array<REL::ID, 1> BSProceduralLightningTasklet{ REL::ID(1549985) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollectionBase{ REL::ID(999042), REL::ID(1078714) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits__2_{ REL::ID(1159174), REL::ID(1458086) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits__2_{ REL::ID(705198), REL::ID(1003425) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSMaterialDB__DBTraits__1_{ REL::ID(828151), REL::ID(1126856) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSMaterialDB__DBTraits__2_{ REL::ID(615670), REL::ID(914362) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSModelDB__DBTraits__1_{ REL::ID(1577114), REL::ID(293351) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSModelDB__DBTraits__2_{ REL::ID(560264), REL::ID(858962) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSStaticTriShapeDB__DBTraits__2_{ REL::ID(431755), REL::ID(731291) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSTextureDB__DBTraits__1_{ REL::ID(1201257), REL::ID(1500395) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BSTextureDB__DBTraits__2_{ REL::ID(470050), REL::ID(769345) };
+		inline constexpr std::array<REL::ID, 2> BSQueuedResourceCollection_BSResource__EntryDB_BShkbHkxDB__DBTraits__2_{ REL::ID(1255817), REL::ID(1554832) };
+		inline constexpr std::array<REL::ID, 1> BSRagdollContactListenerModifier{ REL::ID(603880) };
+		inline constexpr std::array<REL::ID, 1> BSRagdollContactListenerModifierInterface{ REL::ID(1347706) };
+		inline constexpr std::array<REL::ID, 1> BSRandomAlarmModifier{ REL::ID(1294685) };
+		inline constexpr std::array<REL::ID, 1> BSRangeNode{ REL::ID(647848) };
+		inline constexpr std::array<REL::ID, 1> BSReference{ REL::ID(1331072) };
+		inline constexpr std::array<REL::ID, 1> BSReloadShaderI{ REL::ID(453698) };
+		inline constexpr std::array<REL::ID, 1> BSResourceFaceGenBinaryFile{ REL::ID(1450848) };
+		inline constexpr std::array<REL::ID, 1> BSResourceNiBinaryStream{ REL::ID(1116978) };
+		inline constexpr std::array<REL::ID, 2> BSResourceStreamParser{ REL::ID(413530), REL::ID(586697) };
+		inline constexpr std::array<REL::ID, 1> BSResource__Archive2__AsyncReaderStream{ REL::ID(283788) };
+		inline constexpr std::array<REL::ID, 2> BSResource__Archive2__Index{ REL::ID(1567500), REL::ID(643304) };
+		inline constexpr std::array<REL::ID, 1> BSResource__Archive2__Manager__MemoryCacheLocation{ REL::ID(1520841) };
+		inline constexpr std::array<REL::ID, 1> BSResource__Archive2__ReaderStream{ REL::ID(218182) };
+		inline constexpr std::array<REL::ID, 1> BSResource__ArchiveFoundStreamCB{ REL::ID(795209) };
+		inline constexpr std::array<REL::ID, 1> BSResource__AsyncStream{ REL::ID(297442) };
+		inline constexpr std::array<REL::ID, 1> BSResource__CacheDrive{ REL::ID(1092550) };
+		inline constexpr std::array<REL::ID, 1> BSResource__CacheDrive__Impl{ REL::ID(513934) };
+		inline constexpr std::array<REL::ID, 1> BSResource__CacheDrive__Op{ REL::ID(1077451) };
+		inline constexpr std::array<REL::ID, 1> BSResource__CacheDrive__Task{ REL::ID(481034) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BGSBtoDB__DBTraits_{ REL::ID(76202) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BGSBtrDB__DBTraits_{ REL::ID(674220) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BGSBttDB__DBTraits_{ REL::ID(328354) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BGSCombinedCellGeometryDB__DBTraits_{ REL::ID(566880) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BGSCombinedCellGeometryDB__ModelDB__DBTraits_{ REL::ID(986183) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BGSTerrainVisibilityDataDB__DBTraits_{ REL::ID(1128589) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSFaceGenDB__FG__DBTraits_{ REL::ID(1530435) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSFaceGenDB__TRI__DBTraits_{ REL::ID(1577024) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSMaterialDB__DBTraits_{ REL::ID(442537) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSModelDB__DBTraits_{ REL::ID(1188820) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSPrecomputedVisibility__BSVisDB__DBTraits_{ REL::ID(308994) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSStaticTriShapeDB__DBTraits_{ REL::ID(259270) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BSTextureDB__DBTraits_{ REL::ID(516895) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_BShkbHkxDB__DBTraits_{ REL::ID(298631) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_LipSynchAnimDB__DBTraits_{ REL::ID(766818) };
+		inline constexpr std::array<REL::ID, 1> BSResource__EntryDB_ScaleformFile__DBTraits_{ REL::ID(1129091) };
+		inline constexpr std::array<REL::ID, 1> BSResource__ICacheDriveOp{ REL::ID(308277) };
+		inline constexpr std::array<REL::ID, 1> BSResource__IEntryDB{ REL::ID(1155963) };
+		inline constexpr std::array<REL::ID, 1> BSResource__IEntryDB__PostFlushNotify{ REL::ID(278486) };
+		inline constexpr std::array<REL::ID, 1> BSResource__Location{ REL::ID(160428) };
+		inline constexpr std::array<REL::ID, 1> BSResource__LocationTraverser{ REL::ID(1507181) };
+		inline constexpr std::array<REL::ID, 1> BSResource__LooseFileLocation{ REL::ID(67067) };
+		inline constexpr std::array<REL::ID, 1> BSResource__MemoryFileLocation{ REL::ID(80590) };
+		inline constexpr std::array<REL::ID, 1> BSResource__MemoryFileStream{ REL::ID(1569804) };
+		inline constexpr std::array<REL::ID, 1> BSResource__RegisterPrefix__2__Traverser{ REL::ID(242589) };
+		inline constexpr std::array<REL::ID, 1> BSResource__ReplicateAt__9__ReplicateFoundFunctor{ REL::ID(1166740) };
+		inline constexpr std::array<REL::ID, 1> BSResource__SDirectory2__ThreadCursor{ REL::ID(629565) };
+		inline constexpr std::array<REL::ID, 1> BSResource__Stream{ REL::ID(138567) };
+		inline constexpr std::array<REL::ID, 1> BSResource__StreamBase{ REL::ID(404489) };
+		inline constexpr std::array<REL::ID, 1> BSResource____DefaultLocationData{ REL::ID(1232570) };
+		inline constexpr std::array<REL::ID, 1> BSResource____DevNull{ REL::ID(1040518) };
+		inline constexpr std::array<REL::ID, 1> BSResource____DevNull__NullStream{ REL::ID(961044) };
+		inline constexpr std::array<REL::ID, 1> BSResource____EventSources{ REL::ID(728328) };
+		inline constexpr std::array<REL::ID, 1> BSResource____GlobalLocations{ REL::ID(1241035) };
+		inline constexpr std::array<REL::ID, 1> BSResource____GlobalPaths{ REL::ID(1054292) };
+		inline constexpr std::array<REL::ID, 1> BSResource____LocationTree{ REL::ID(1147536) };
+		inline constexpr std::array<REL::ID, 1> BSResource____LooseFileAsyncBase__FunctorType{ REL::ID(900734) };
+		inline constexpr std::array<REL::ID, 1> BSResource____LooseFileAsyncChild{ REL::ID(1559026) };
+		inline constexpr std::array<REL::ID, 1> BSResource____LooseFileAsyncStream{ REL::ID(1465749) };
+		inline constexpr std::array<REL::ID, 1> BSResource____LooseFileStream{ REL::ID(1372098) };
+		inline constexpr std::array<REL::ID, 1> BSResource____RegisterFoundStreamTraverser{ REL::ID(582895) };
+		inline constexpr std::array<REL::ID, 1> BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy_{ REL::ID(276688) };
+		inline constexpr std::array<REL::ID, 1> BSRetargetBodyBlend{ REL::ID(1360237) };
+		inline constexpr std::array<REL::ID, 1> BSReverseSpineTwistModifier{ REL::ID(96242) };
+		inline constexpr std::array<REL::ID, 1> BSRingConstructor{ REL::ID(1043004) };
+		inline constexpr std::array<REL::ID, 1> BSRootTwistModifier{ REL::ID(1557919) };
+		inline constexpr std::array<REL::ID, 1> BSRotAccumTransfInterpolator{ REL::ID(1342485) };
+		inline constexpr std::array<REL::ID, 1> BSSaveDataSystemUtility{ REL::ID(1307346) };
+		inline constexpr std::array<REL::ID, 1> BSScaleformFileOpener{ REL::ID(31930) };
+		inline constexpr std::array<REL::ID, 1> BSScaleformImageLoader{ REL::ID(631376) };
+		inline constexpr std::array<REL::ID, 1> BSScaleformManager{ REL::ID(287435) };
+		inline constexpr std::array<REL::ID, 1> BSScaleformTranslator{ REL::ID(945684) };
+		inline constexpr std::array<REL::ID, 1> BSSceneGraph{ REL::ID(867766) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ByteCode__PackedInstructionStream__InstructionFunctor{ REL::ID(378485) };
+		inline constexpr std::array<REL::ID, 1> BSScript__CompiledScriptLoader{ REL::ID(1141746) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ErrorLogger{ REL::ID(388017) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ICachedErrorMessage{ REL::ID(1312123) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IClientVM{ REL::ID(814222) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IComplexType{ REL::ID(1444352) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IFindBoundObjectFunctor{ REL::ID(1165390) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IFunction{ REL::ID(906368) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IHandleReaderWriter{ REL::ID(29236) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ILoader{ REL::ID(515180) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IMemoryPagePolicy{ REL::ID(1235189) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IObjectHandlePolicy{ REL::ID(1406261) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IObjectProcessor{ REL::ID(455185) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IProfilePolicy{ REL::ID(781451) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ISavePatcherInterface{ REL::ID(986606) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IStackCallbackFunctor{ REL::ID(608569) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IStackCallbackSaveInterface{ REL::ID(109389) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IStore{ REL::ID(282732) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ITypeLinkedCallback{ REL::ID(520310) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IVMDebugInterface{ REL::ID(772753) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IVMObjectBindInterface{ REL::ID(241221) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IVMSaveLoadInterface{ REL::ID(1178416) };
+		inline constexpr std::array<REL::ID, 1> BSScript__IVirtualMachine{ REL::ID(726255) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__AutoPropGetFunction{ REL::ID(1477103) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__AutoPropSetFunction{ REL::ID(1556456) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_0036e789dfc29f04e3b76a58fd3ed225__{ REL::ID(976800) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_033381a3e53eabbac9a4c55b3f82524d__{ REL::ID(231616) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_0333d0192dcba271222b8a769ecf64ba__{ REL::ID(766861) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_03937cd3aeb16f62e8fdf01fb07b776b__{ REL::ID(81072) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_03f40d5b7a83646873d4cffcf0f8af1e__{ REL::ID(1229316) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_03f6be1707c4dadc1e6a4f21830461d0__{ REL::ID(1556230) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_05e45791d9c9dae046656640fdcc5915__{ REL::ID(430925) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_06310060173b6edb3d4ab2762098609d__{ REL::ID(747910) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_06ae58094c6c7679c62733e817acbeee__{ REL::ID(232285) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_072ca50fef522dae621eda4732773008__{ REL::ID(984993) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_09405778e6c90dfad4217962044524a7__{ REL::ID(1032547) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_0bf7f2a013840c8c83f46a5799c25cac__{ REL::ID(1243136) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_0d75bd85c27993a12547983c5f26276a__{ REL::ID(557499) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_0ea3f8189c538f92a2fb24da35641954__{ REL::ID(90865) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_101df2fa8f221612756e26cbcc27a354__{ REL::ID(907513) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_12ff1bd31f77080f55398b412c956589__{ REL::ID(1156330) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_135c095b11613df466acaa235bb1737e__{ REL::ID(1467844) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_148b56cf9e51025f0478c68d2ed2b907__{ REL::ID(1251393) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_15e19293b3f1ccacb5cd574f8a5892f6__{ REL::ID(305508) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_172af002300d2a96541d1e913078d1a7__{ REL::ID(1155607) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_17f62e19215467b2ae3e574ef40bb035__{ REL::ID(1393098) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_196222729b99521a093bbc916f34a3bb__{ REL::ID(753187) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_199e09d3489a851ba35b83a2b5a4c78a__{ REL::ID(906582) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1a42f860b383b72827675c5211efbf43__{ REL::ID(150381) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1ab215191a5b2d792f6892cc57f2e7a6__{ REL::ID(37442) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1af8c5e23b50e17795263c6a83509e48__{ REL::ID(698122) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1b434c7e9dc9658fa97fc97f1aa10ffe__{ REL::ID(1507842) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1bea699fc0d60f626a403b1b5966905d__{ REL::ID(1424577) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1f3d803f88c5774e6695dfbb76152abf__{ REL::ID(1509252) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_1f6960099da300d413a1b96512f644fb__{ REL::ID(837132) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_20df7b2a95b034a263939c11825c18b0__{ REL::ID(263846) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_216c63ee93f90c18ae2eb9b0ceb0da1e__{ REL::ID(1241734) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2282147843dd6ff975050bb419e25637__{ REL::ID(191619) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_231741e1bf1630cc3289131b16070523__{ REL::ID(1394) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_231cc2d7ae491f358fb3115e4f4ab8d7__{ REL::ID(809731) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_23f831893d8eb6d1de2c3f97c98ebf21__{ REL::ID(874948) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_256019cf0fbe9a3e77970966aad7a9c6__{ REL::ID(416056) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2581fa4f947018961d67bc610901ce7f__{ REL::ID(1519710) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2694ca287ec6da7f9b47c8132d87907b__{ REL::ID(1187985) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2941130b797500212f7c3f53a9c0c1a2__{ REL::ID(1565891) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2a1f1212fcf0357e9924e7804aa85ce9__{ REL::ID(1195251) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2a657124b2613bc4f82ab44d0b334ddc__{ REL::ID(277588) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2c63495431a436b4fc7769122a2c5648__{ REL::ID(395452) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2d49c3f20eef6392e512606a35c2020a__{ REL::ID(65191) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2f1b5f214f0a62905ff748180067474c__{ REL::ID(1014872) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_2f99d02b5d6324ec9ca1dc646cc3ad62__{ REL::ID(803246) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_305d2cc57e463c54eb8f5e94ed3475d0__{ REL::ID(1004986) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_30da130d6d128b27909b9e97e0c6bf55__{ REL::ID(593310) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_312354d41c9d53b3e3cca87bbffefe1f__{ REL::ID(1049924) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_313bb6085fdf73625826a32c5e4089ed__{ REL::ID(346874) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3176f3e95b60e72406f3519039d44854__{ REL::ID(892879) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_31d423451e709a3813235b0bc31fab03__{ REL::ID(656227) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3215cdc43d63422065bc965ccdcf40a9__{ REL::ID(109511) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_32cb6b89aa9ee3c6d829a981f5948e21__{ REL::ID(1331223) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_336031ded9834cecd57097a98ff4cd86__{ REL::ID(1470076) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_35d81f7772422dcac989e86f49f04739__{ REL::ID(39360) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_37c06a682adcf3342fb282ac6afd5db7__{ REL::ID(571246) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_37f85511682b6eea3f9aa523eb769f40__{ REL::ID(125857) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_37f8c67697c25dce77618cdd8cacf708__{ REL::ID(1551041) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_38168a794b3d0ecc11bad366c78afa17__{ REL::ID(823386) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_381c7b3e9bb0f3141cc09bca24bc8404__{ REL::ID(887511) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3961a85e44cb6cac9ccd75dcc6db6833__{ REL::ID(1454057) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3a56500349bdb6ec53fce93c8a277463__{ REL::ID(374513) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3a5d9d4ffdb182da59eac70a88bd4d9a__{ REL::ID(408196) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3b3fc679c4d2a656a7ca5513e3e141a0__{ REL::ID(165326) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3d8bdbfe73c95692b6441d9c8a4d2ed1__{ REL::ID(52729) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3dbd811ff149bd5578ab6a4d127170a7__{ REL::ID(9929) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3e02586ccc052d8695ffe8150ef6ce94__{ REL::ID(375483) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3ec8a23c50d51adfa49836b5c1935944__{ REL::ID(1313965) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3f05b2284942471abef61df84649a149__{ REL::ID(811924) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_3f09d96fbe7085a8947d5854f0bcc050__{ REL::ID(1299548) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_403c2f175212f070fc3099ef2bb7d37f__{ REL::ID(29126) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_42ad8da096f4da23888a88ab6daca7dd__{ REL::ID(1158834) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4483c9eba9e8e929c6fbe34db5737047__{ REL::ID(621624) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_452e38260b64d797ca29636ec9f36734__{ REL::ID(1545803) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_45e5f2e4702e33dfe0df9c61190b85ba__{ REL::ID(457015) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_466dd68b59cc45b5f012ccb0f0ebfd69__{ REL::ID(498138) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4713f5071ef5fa03b9016e3009a1cda2__{ REL::ID(859053) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_47fb9cba502debe7eadb015ef20a4823__{ REL::ID(953682) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_48fabceb832c00704fba06b82487f8cc__{ REL::ID(595542) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_48fecc7c9fa931e834800d15848059e6__{ REL::ID(1018796) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_495adafd421f29bc0da99c01b7e1121e__{ REL::ID(861248) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4a19ab8e56ecd2ccca3ec0ff1b1b5039__{ REL::ID(1530127) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4ae70dc3a428bd036fc4ecec3e5e86c9__{ REL::ID(1423034) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4b1b555910ca3777fc5821bc75fb556c__{ REL::ID(1013468) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4c8747d988f348c15af1c28c3695be48__{ REL::ID(177744) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4cddb4c3d1e852dee754f0f6a6c0e6fc__{ REL::ID(505201) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4d2c9b90743db4803968eafacce2b71e__{ REL::ID(1267273) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4d412be8a66137c852932ad039c81099__{ REL::ID(975371) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4db643e393934408a68d5c4f18914d62__{ REL::ID(391728) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4e0beadb02b6780b9eeeff8011270e3c__{ REL::ID(50234) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_4edbfa5e38e10c85855b60595af721ee__{ REL::ID(1439933) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_523ce1a6935cc369bb2a3e6e41db82ae__{ REL::ID(221005) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_53122849be2cf3bfa715ea670b851a44__{ REL::ID(735516) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5442fb5b4d9b249244bebb10cb7a4409__{ REL::ID(417233) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_55b0c554b1350278029c169d86615681__{ REL::ID(908238) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_56f6ce5baae90c7f4167387cdf1e73fb__{ REL::ID(1191577) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5752f5e0f9a89a1dfe55027ce6980f68__{ REL::ID(444661) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5894798851f4b1104f739189ff021882__{ REL::ID(1548575) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_59e0bd90bb20df61bf2b5b7ab8c0aa26__{ REL::ID(1566598) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5ae089e4d31f02bcafef0c614602203a__{ REL::ID(327046) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5ae28fa059d9cdc200eef8150ccfbbd7__{ REL::ID(835936) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5b5da570a496ebbb819cf0ff8b472897__{ REL::ID(1298622) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5d7495b661268e9e52116a4be2a615f4__{ REL::ID(1008762) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5eb4f15bb48aab1d07b8b05690c59e55__{ REL::ID(316350) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5f801f6d325daef8830fe3a0b0f34d4f__{ REL::ID(890382) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_5fc1c9001ae0709cbafcd7e84095aa10__{ REL::ID(989025) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_60beb8b81486c23f3295230a7cd21fc8__{ REL::ID(1564958) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_616ebea3a9b57e86466dea270db48a56__{ REL::ID(627012) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_642ffadad618b8545202d33d495fd0b1__{ REL::ID(249418) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_659ba9f00f15e9e5bf969b0686b6d7f5__{ REL::ID(784183) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_65ce5eb2fd29efd6f24701dd6e9e314a__{ REL::ID(613153) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_65e3ac93f1189026038230fd1f852714__{ REL::ID(38880) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_6706071d475a9d1117345e8a9240351a__{ REL::ID(687925) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_67b458e389b68dc567e66dccde93180f__{ REL::ID(342981) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_681e88a3bb9be38d24e78de7a09841a4__{ REL::ID(723689) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_68a6c31974e8de6f68b7fe5f6e129375__{ REL::ID(673535) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_68ae5d28c34207d14300f222945ceb13__{ REL::ID(267481) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_6c614d2155dc079018c9aef55ce7213b__{ REL::ID(94782) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_6c92b5e991bc8ffd1f1805ce6c951ac4__{ REL::ID(963613) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_6cc2429acefb064b213f994ad5fddc0f__{ REL::ID(1481798) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_6d057e0372eabecd40e1213b939db226__{ REL::ID(609177) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_6d40ed7ee267343454ab84bc01d2f95a__{ REL::ID(203350) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_70e12aa87cdb5e4e1e3e37e250caedc3__{ REL::ID(1279677) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_713d9943db73cdb801da7341722ad9a2__{ REL::ID(796076) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_71627b815f4f38b6c6be3e97252d45c2__{ REL::ID(683822) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_71bc88c464db362fd265ad074d8f8f68__{ REL::ID(1001017) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_71dece7077f4cb78d95bfd5d70b34a6d__{ REL::ID(583616) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_727d175a0b87166e976c6a169bb24f55__{ REL::ID(640784) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7294799d61c1e3e682e815fe615680f4__{ REL::ID(233242) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_732bf4c600b98afda8ae4eec4b5d487b__{ REL::ID(318846) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_73eb13eee84cacb82b9f3e1f98e3b7ad__{ REL::ID(217043) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_75b591447b162a3fe7151ea50e1b3f23__{ REL::ID(569801) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7aa398cdaccc55373dffd32cf1008a9e__{ REL::ID(1410820) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7ae6587ca2f2ac6677b89b6271cd5955__{ REL::ID(1537308) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7aeb830e2d5a2876b47cd3b64d2d2a89__{ REL::ID(1495558) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7b19da4d437f57776c7d00a2899d07d0__{ REL::ID(585069) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7b9ecf76b461d4bb6c9f88a0bb07c2e6__{ REL::ID(144866) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7bc3597ff58c6b9197f232777dc06e11__{ REL::ID(295325) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7d3df9f885eea772d0b9a7fa8e04bd8a__{ REL::ID(486836) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7e5af3061aa52fb97c445fc26b0193f4__{ REL::ID(537220) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7e875a23bccc241edab49fff33e92007__{ REL::ID(408221) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7ebb8ff6d1f3641795600d5299d81842__{ REL::ID(1533345) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_7ee7fcb491e4741902b16b8f32a92ecc__{ REL::ID(935657) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_82258dc9b4d751c75d44bcf0d3678d6d__{ REL::ID(108620) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_82350808aee40d100b72cd39ca845d3f__{ REL::ID(1440064) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_8381241688a84f917e957d5c9204a167__{ REL::ID(623771) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_845510b31e7011c8184d72d6539c2786__{ REL::ID(668835) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_86ddea8a4e72be7b8eb04c3a7a1c175d__{ REL::ID(207313) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_86f5c4639a23a24428b5166ae9993007__{ REL::ID(317430) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_87334e7a78cdc01ad5d8bb47ea8caf90__{ REL::ID(1163396) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_87513c01f69c2f40f8b29d01e0176b42__{ REL::ID(891504) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_87f131a239ae71be3ebd263eba470384__{ REL::ID(782292) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_8862c08c46909a23cce8d7a33c40ca38__{ REL::ID(1368821) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_896355432e47a86f66d44793c898b2fe__{ REL::ID(1517436) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_897dc3f8fa35add8003d4ec74ce26701__{ REL::ID(1144947) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_8e0f4ac913fe95ab0895d1bc17cabb82__{ REL::ID(749229) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_8e322d145299d90c86338d331f1312cf__{ REL::ID(500592) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_8f75d0740b5c1921ac319b8ae7fec9d8__{ REL::ID(669939) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_8faa52d4c5f0e81430a0b2e043af530b__{ REL::ID(1089255) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_911f8ecd3382cb7f1385e89dbf10f842__{ REL::ID(897364) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_914ba33a265437568f0efb69f8922606__{ REL::ID(4427) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_92d8ddaf25214a20908aab7e314e4c1e__{ REL::ID(271162) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_93e4c1ed6052968f3e710a5d4f1266f5__{ REL::ID(708996) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9455d53f6ddf9bb6036f7e3b2c460dbe__{ REL::ID(473012) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_94a0b9b0a6c8e0f0208ab2081abcf924__{ REL::ID(1172555) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9581e4b0df97dbd72c739a7e7e0d1607__{ REL::ID(233438) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9605dbb6caac1408269ee3684da356a9__{ REL::ID(248483) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9685fa74d0b4cd35e0a012cb13d9f54f__{ REL::ID(1061767) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_96ccd3487d363b9ff44245908443dff5__{ REL::ID(1172327) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_99f4dfdd75424bf5d4cf3af2f896c126__{ REL::ID(963119) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9b68ddbacc45b82256c95729b8f53ba7__{ REL::ID(800662) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9bb0063a395270cebfdcc140d6668582__{ REL::ID(410726) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9c72b51fbcbdda30778ba9cbbd1dab26__{ REL::ID(739505) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9ca7a24b94e4be92605d4508870cb0b4__{ REL::ID(1281723) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9dc072ec63fcd954e6603f6196975a53__{ REL::ID(571726) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_9fbbb53dc6d5854a1653d642e704e0b8__{ REL::ID(641724) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_a066242f84b30c708d1a072e17408fc6__{ REL::ID(177991) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_a13136b083e1b826292356e960a4a3b3__{ REL::ID(697635) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_a2400baec1235fdf245727167c1e5776__{ REL::ID(1367377) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_a2cee0234ecbf2d8c13b486af0d9b806__{ REL::ID(767782) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_a57a479d66a0a79461bdfe3100fb0f41__{ REL::ID(141246) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_a7eab2658a19a22342af0331061b8163__{ REL::ID(1101750) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_aa90b4a2ed4bb178d0cb7ef422babf77__{ REL::ID(921832) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ab282576f91eb23b1eb0a56da0565e22__{ REL::ID(1075541) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_abf18b61e9a88b34f8d4407b67f904e0__{ REL::ID(72464) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ad1e7e20c912169c90e4c6fa3cb88592__{ REL::ID(355380) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ad594db728bdf1959169d84e8940b2d9__{ REL::ID(929106) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ad73c806e9b712d198cfb9e11b13a9dc__{ REL::ID(482910) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_af63e1f76755fad3d19db80fe8ff61a5__{ REL::ID(710071) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_aff48f6caec89405f450186898b26347__{ REL::ID(1115355) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b13012d695ae3e201531fd05017c7718__{ REL::ID(996361) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b223b0b06990ca72d0f0d072b1d5d19a__{ REL::ID(11060) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b27aa35e62aed7fdf548ae3121233188__{ REL::ID(1048051) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b3124df4a3043de82c08effc2d80eb75__{ REL::ID(546001) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b32fc1eceb5384f98388d8230715e120__{ REL::ID(24873) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b33dd30fb9b734980f23b782f3bebe6a__{ REL::ID(305017) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b541d1962f76df86bb0685999b0fbab4__{ REL::ID(77131) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b98602201d38392d9a69c8e6fd471ec2__{ REL::ID(333870) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_b9d7b298c6aca4ae4b8b5eb206b97e8c__{ REL::ID(897986) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ba104fb8977a947bd5e22f90ef7accb2__{ REL::ID(533568) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ba40e40a40d2895650e1b615719542b0__{ REL::ID(497418) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_bd382ebe2d29447078b65b1df3fa26c1__{ REL::ID(543827) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_be00e65bd0d4d0520ac6b10f3ee9f384__{ REL::ID(1461307) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_be3baeb0cd288915edf499e42c95298d__{ REL::ID(234818) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_be5583c8170254d249223e895b42877f__{ REL::ID(123964) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c03fb01d6395ccf54f9de160c0e1f59a__{ REL::ID(1229788) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c27e0645b30443d4ea5952b73f0bf516__{ REL::ID(1341362) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c44894a3c61c9f7bda60497d55fd495f__{ REL::ID(1405579) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c45d90f3f35e188aaed57e7a51a3a7da__{ REL::ID(991696) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c5582e3d579d368083e3ddddf8321e64__{ REL::ID(1406888) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c78f3e46052c1effbaed723d3a0a4245__{ REL::ID(389840) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c7936a9edc0a96155ddae87bfa8968cb__{ REL::ID(248232) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c7ee88db88fb475ee0275185b477b40d__{ REL::ID(468958) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c87d990ee709e3868efa4bc47e3f910c__{ REL::ID(360669) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_c940b58bab0630feeb6feb9d3751fdff__{ REL::ID(151569) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ca150dd403904a82a6dbf37155ce2367__{ REL::ID(961706) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ca49331d2cc52b9f965b03489a2f0e95__{ REL::ID(1381199) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_cb6ba69900f6b169d1ff78cedb6e3c0b__{ REL::ID(1580175) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_cd1bdde020ea07c36fdc2ff171544eb5__{ REL::ID(443283) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_cf21a7415e2878270ec9d59d793ad883__{ REL::ID(1547861) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_cf9010abb7164ecb03472e086f8f8daa__{ REL::ID(239217) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_cfe919020b023f99e9e99fd68034caf3__{ REL::ID(1074359) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d238acb2724ab71cef75ebbdb4dd058e__{ REL::ID(799590) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d261d8e3cad3a65f4d97016a06523df4__{ REL::ID(889637) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d269bb3ca57dbb686bb88e6fad76d718__{ REL::ID(1271200) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d3213256c0da41944ac2c7abd30007e5__{ REL::ID(878944) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d33580e7b03fb1257999455455c3c503__{ REL::ID(1494099) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d523c09a64bc0d7353666e113bb249f4__{ REL::ID(499046) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d81cd7ed5ded28e18c4da6f6974c8c46__{ REL::ID(1103087) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d889a3e54755f9eedd94b866b3714090__{ REL::ID(1157309) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_d95749bda0293c08d3cc0b7b0e246d73__{ REL::ID(849400) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_db105bbcf6b344a998e2a712c4aaf918__{ REL::ID(1174208) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_dbe18e55a6256ed6c7cd3a93774ec955__{ REL::ID(1227926) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_dc3cd416a2837e453f35a6b8fbc48ea4__{ REL::ID(516023) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_de09c78a4229023cf45e56cac56fa01c__{ REL::ID(1327646) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_de202769c8cb78fbd5d5b701638899ab__{ REL::ID(356669) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ded7290a27f6f5ce1eadeb656461dcb9__{ REL::ID(974321) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_df72233bb555817fc5d61a5aef375967__{ REL::ID(250107) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e0106635372c160d3c8ac07fe697b203__{ REL::ID(835696) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e0c11438ffc28765d30a3c3302c1bbf2__{ REL::ID(1315856) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e13128af6f1cec873d5fc795c32ab6f7__{ REL::ID(1355100) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e24d17b2ce5946d6143a7c8179e534a9__{ REL::ID(949434) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e2db30165d12b17a4cbee3e6a53da720__{ REL::ID(1457609) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e6f311dd80387ab27f02d6370d74f0fe__{ REL::ID(1215715) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e70861b18baf45189c3e68218d25319f__{ REL::ID(529899) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_e8d4e30e0e52d536051cc32bac3eeaca__{ REL::ID(696163) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ea75c84e5d2afaa7a431055deccf81d1__{ REL::ID(179133) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_eaaf9a1e013254da6429b6dc662caae0__{ REL::ID(1201836) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_eb086da3861952ef5b629e6a82e8ce8f__{ REL::ID(1127181) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_eca8036104a77a1532b8fd022f0d0ee3__{ REL::ID(1253555) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ece9c0d99a1a8c11fc117563cae02c17__{ REL::ID(1397078) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ed07b502b210e8c707dedb26a94ba3a4__{ REL::ID(357473) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_edce4f9930ddee0aee4120368aa010f0__{ REL::ID(303567) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_ef55d7a0aba434f7f25bdb3b01ce777b__{ REL::ID(1549663) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f096702f25223fa3b599c8bf13f939fd__{ REL::ID(403572) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f264e7f2505fd732903c515b362a8149__{ REL::ID(291128) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f2b91fcc51bda1a5cc954202e5edc4a8__{ REL::ID(1033497) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f2db2796f70b19f4c30c278bc3281ece__{ REL::ID(711426) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f393b1d39ec21987fc943edc572c1d9b__{ REL::ID(1141057) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f4e053b2a5fdfe57e54fdfe6a9861709__{ REL::ID(89544) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f5d7b5b7b64384a8f89a3ceaff2862d3__{ REL::ID(51324) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f81463f1c50d4e119d7d72eac2011a9f__{ REL::ID(1068944) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_f8b52b4df4e95fdb8a0b9e38874d6165__{ REL::ID(1284921) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_fb99de7700baf0f89fdf3217d5d971e0__{ REL::ID(1131174) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl__lambda_fffb0ebd51131490b2c1433b88f00147__{ REL::ID(137635) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl_char_{ REL::ID(729349) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl_charconst_{ REL::ID(896439) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CachedErrorMessageImpl_std__function_void__{ REL::ID(1442026) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__CodeTasklet{ REL::ID(1322969) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__IFuncCallQuery{ REL::ID(721871) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__NativeFunctionStub{ REL::ID(1475684) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__RawFuncCallQuery{ REL::ID(1379338) };
+		inline constexpr std::array<REL::ID, 1> BSScript__Internal__ScriptFunction{ REL::ID(509291) };
+		inline constexpr std::array<REL::ID, 4> BSScript__Internal__VirtualMachine{ REL::ID(614600), REL::ID(413974), REL::ID(1464591), REL::ID(1058438) };
+		inline constexpr std::array<REL::ID, 1> BSScript__LinkerProcessor{ REL::ID(1458658) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NF_util__NativeFunctionBase{ REL::ID(985630) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_ActiveEffect_Actor_{ REL::ID(174610) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_ActiveEffect_EffectSetting_{ REL::ID(799822) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_ActiveEffect_void_{ REL::ID(281342) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_Actor_{ REL::ID(252518) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_BSScript__ArrayWrapper_Actor__{ REL::ID(546239) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_TESFaction_{ REL::ID(877631) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_TESNPC_{ REL::ID(62870) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_TESObjectARMO_{ REL::ID(650149) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_TESObjectREFR_{ REL::ID(249502) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_TESPackage_{ REL::ID(770907) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_TESRace_{ REL::ID(1272226) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_bool_{ REL::ID(1253842) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_float_{ REL::ID(1458765) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_int_{ REL::ID(435681) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_unsignedint_{ REL::ID(359347) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_Actor_void_{ REL::ID(1440151) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_AlchemyItem_bool_{ REL::ID(1018405) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSBaseAlias_TESQuest_{ REL::ID(393169) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSBaseAlias_void_{ REL::ID(1350055) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSEncounterZone_void_{ REL::ID(338191) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSListForm_unsignedint_{ REL::ID(890560) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSListForm_void_{ REL::ID(78819) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSLocAlias_BGSLocation_{ REL::ID(894817) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSLocAlias_void_{ REL::ID(1520224) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSLocation_bool_{ REL::ID(625909) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSLocation_void_{ REL::ID(504948) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSMessage_void_{ REL::ID(1392920) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSMusicType_void_{ REL::ID(567803) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSRefAlias_TESObjectREFR_{ REL::ID(339809) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSRefAlias_void_{ REL::ID(1403753) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSRefCollectionAlias_unsignedint_{ REL::ID(1521859) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSRefCollectionAlias_void_{ REL::ID(896410) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSScene_TESQuest_{ REL::ID(482028) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSScene_bool_{ REL::ID(813969) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSScene_void_{ REL::ID(1107323) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSSoundCategorySnapshot_void_{ REL::ID(1354072) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSSoundCategory_void_{ REL::ID(959075) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BGSTerminal_void_{ REL::ID(53967) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSInputEnableLayer_bool_{ REL::ID(945484) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSInputEnableLayer_void_{ REL::ID(1159603) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__Object_bool_{ REL::ID(228758) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__Object_void_{ REL::ID(411955) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_ActorValueInfoconst_{ REL::ID(192179) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_Actor_{ REL::ID(359806) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_BSFixedString_{ REL::ID(1087490) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_BSInputEnableLayer_{ REL::ID(641539) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_BSScript__ArrayWrapper_Actor__{ REL::ID(1316794) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_TESObjectREFR_{ REL::ID(1130304) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_TESWeather_{ REL::ID(489398) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_bool_{ REL::ID(463570) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_float_{ REL::ID(66467) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_int_{ REL::ID(1213224) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_unsignedint_{ REL::ID(36725) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_BSScript__StaticFunctionTag_void_{ REL::ID(1206866) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_EffectSetting_bool_{ REL::ID(1284757) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_EnchantmentItem_bool_{ REL::ID(33937) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_Actor_{ REL::ID(337681) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESFaction_{ REL::ID(27021) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESForm_{ REL::ID(362081) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESNPC_{ REL::ID(1401592) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_TESObjectREFR_{ REL::ID(1503081) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_bool_{ REL::ID(20904) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_GameScript__RefrOrInventoryObj_void_{ REL::ID(645437) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_IngredientItem_bool_{ REL::ID(696710) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_IngredientItem_unsignedint_{ REL::ID(589556) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_IngredientItem_void_{ REL::ID(1546446) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_SpellItem_bool_{ REL::ID(1253126) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESFaction_bool_{ REL::ID(1184295) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESFaction_unsignedint_{ REL::ID(120202) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESFaction_void_{ REL::ID(770143) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESForm_bool_{ REL::ID(48289) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESForm_int_{ REL::ID(341849) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESForm_unsignedint_{ REL::ID(967127) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESForm_void_{ REL::ID(566825) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESFurniture_TESForm_{ REL::ID(819009) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESGlobal_float_{ REL::ID(805410) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESImageSpaceModifier_void_{ REL::ID(1468861) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESLevCharacter_void_{ REL::ID(1268483) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESLevItem_void_{ REL::ID(456367) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESLevSpell_void_{ REL::ID(83726) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_Actor_{ REL::ID(799324) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_BGSListForm_{ REL::ID(1092602) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_TESClass_{ REL::ID(1199790) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_TESRace_{ REL::ID(467169) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_bool_{ REL::ID(174106) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_int_{ REL::ID(574517) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESNPC_unsignedint_{ REL::ID(985413) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectACTI_bool_{ REL::ID(319098) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectCELL_TESFaction_{ REL::ID(637279) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectCELL_TESNPC_{ REL::ID(1262420) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectCELL_bool_{ REL::ID(11360) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectCELL_void_{ REL::ID(1407361) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_BGSEncounterZone_{ REL::ID(214130) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_BGSLocation_{ REL::ID(1212476) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_BGSScene_{ REL::ID(1025542) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_BGSVoiceType_{ REL::ID(833128) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_BSScript__ArrayWrapper_BGSLocationRefType__{ REL::ID(397329) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_TESKey_{ REL::ID(438428) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_TESObjectCELL_{ REL::ID(103925) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_TESWorldSpace_{ REL::ID(646848) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_bool_{ REL::ID(1196950) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_float_{ REL::ID(669724) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_int_{ REL::ID(1398468) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_unsignedint_{ REL::ID(1167933) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectREFR_void_{ REL::ID(861965) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESObjectWEAP_TESAmmo_{ REL::ID(964807) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESPackage_TESPackageconst_{ REL::ID(1296493) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESPackage_TESQuest_{ REL::ID(778537) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESQuest_bool_{ REL::ID(336551) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESQuest_unsignedint_{ REL::ID(1148230) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESQuest_void_{ REL::ID(1255357) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESTopicInfo_TESQuest_{ REL::ID(1155989) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESTopicInfo_bool_{ REL::ID(92007) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESTopic_void_{ REL::ID(199213) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction0_TESWeather_int_{ REL::ID(676329) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction10_TESObjectREFR_bool_BGSKeyword_BGSMessage_BGSLocation_BGSListForm_BGSListForm_bool_bool_bool_bool_bool_{ REL::ID(878956) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction10_TESObjectREFR_unsignedint_BGSKeyword_BGSMessage_BGSLocation_BGSListForm_BGSListForm_bool_bool_bool_bool_bool_{ REL::ID(1211050) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction11_BSInputEnableLayer_void_bool_bool_bool_bool_bool_bool_bool_bool_bool_bool_bool_{ REL::ID(534468) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction11_TESObjectREFR_void_TESObjectREFR_float_float_float_float_float_float_float_float_int_float_{ REL::ID(1087001) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_SpellItem_unsignedint_{ REL::ID(1022813) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_TESObjectWEAP_unsignedint_{ REL::ID(836518) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_Actor_{ REL::ID(792372) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_BGSKeyword_{ REL::ID(190043) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_BGSPerk_{ REL::ID(1123761) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_BSFixedStringconst_{ REL::ID(1362114) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_EffectSetting_{ REL::ID(1310306) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_SpellItem_{ REL::ID(507703) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_TESFaction_{ REL::ID(909968) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_TESForm_{ REL::ID(59818) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_TESIdleForm_{ REL::ID(216013) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_TESObjectREFR_{ REL::ID(1417200) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_bool_bool_{ REL::ID(993818) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_int_Actor_{ REL::ID(647127) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_int_TESFaction_{ REL::ID(981495) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_int_unsignedint_{ REL::ID(463111) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_unsignedint_Actor_{ REL::ID(1500357) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_unsignedint_TESObjectREFR_{ REL::ID(1471255) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_Actor_{ REL::ID(1507936) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_BGSKeyword_{ REL::ID(903865) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_BGSPerk_{ REL::ID(254193) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_BGSTextureSet_{ REL::ID(717741) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_BGSVoiceType_{ REL::ID(848765) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_BSFixedStringconst_{ REL::ID(1504964) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_TESCombatStyle_{ REL::ID(1010686) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_TESFaction_{ REL::ID(1318003) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_TESForm_{ REL::ID(921920) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_TESObjectREFR_{ REL::ID(1408071) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_TESRace_{ REL::ID(1539927) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_bool_{ REL::ID(670036) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_Actor_void_unsignedint_{ REL::ID(1529235) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSInstanceNamingRules_void_BGSInstanceNamingRulesconst_{ REL::ID(144975) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSListForm_TESForm_unsignedint_{ REL::ID(372251) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSListForm_bool_TESForm_{ REL::ID(265331) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSListForm_int_TESForm_{ REL::ID(1436111) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSListForm_void_TESForm_{ REL::ID(479204) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocAlias_void_BGSLocation_{ REL::ID(269599) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocation_BSScript__ArrayWrapper_BGSLocation__BGSKeyword_{ REL::ID(1544594) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocation_bool_BGSLocationRefType_{ REL::ID(438971) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocation_bool_BGSLocation_{ REL::ID(957438) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocation_float_BGSKeyword_{ REL::ID(1357709) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocation_unsignedint_BGSLocationRefType_{ REL::ID(733084) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSLocation_void_bool_{ REL::ID(1023038) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSRefAlias_void_TESObjectREFR_{ REL::ID(446577) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSRefCollectionAlias_TESObjectREFR_unsignedint_{ REL::ID(564762) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSRefCollectionAlias_int_TESObjectREFR_{ REL::ID(46217) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSRefCollectionAlias_void_TESObjectREFR_{ REL::ID(671881) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSReferenceEffect_void_TESObjectREFR_{ REL::ID(948313) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSScene_bool_unsignedint_{ REL::ID(1000153) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSScene_void_bool_{ REL::ID(188862) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSShaderParticleGeometryData_void_float_{ REL::ID(1459) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSSoundCategorySnapshot_void_float_{ REL::ID(397167) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSSoundCategory_void_float_{ REL::ID(772800) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSSoundDescriptorForm_bool_TESObjectREFR_{ REL::ID(53679) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BGSSoundDescriptorForm_unsignedint_TESObjectREFR_{ REL::ID(1117673) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSInputEnableLayer_void_bool_{ REL::ID(1052522) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__Object_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount__BSFixedStringconst_{ REL::ID(522203) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__Object_bool_BSFixedStringconst_{ REL::ID(1479524) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__Object_void_BSFixedStringconst_{ REL::ID(477790) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__Object_void_BSScript__Object_{ REL::ID(902879) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__Object_void_TESForm_{ REL::ID(1188723) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__Object_void_unsignedint_{ REL::ID(270037) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_BSFixedString_BSFixedStringconst_{ REL::ID(546684) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_BSFixedString_float_{ REL::ID(458650) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_BSFixedString_unsignedint_{ REL::ID(1067269) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_TESForm_int_{ REL::ID(587922) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_TESWeather_unsignedint_{ REL::ID(344131) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_bool_BSFixedStringconst_{ REL::ID(1581419) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_bool_float_{ REL::ID(702846) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_bool_unsignedint_{ REL::ID(137868) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_float_BSFixedStringconst_{ REL::ID(919344) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_float_float_{ REL::ID(410312) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_int_BSFixedStringconst_{ REL::ID(733291) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_int_float_{ REL::ID(662982) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_unsignedint_unsignedint_{ REL::ID(1462302) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_Actor_{ REL::ID(115334) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_BSFixedStringconst_{ REL::ID(1020060) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_BSScript__Object_{ REL::ID(583236) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_TESObjectREFR_{ REL::ID(368940) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_TESQuest_{ REL::ID(1208501) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_bool_{ REL::ID(396434) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_float_{ REL::ID(1497736) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_int_{ REL::ID(1561734) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_BSScript__StaticFunctionTag_void_unsignedint_{ REL::ID(1566414) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_bool_BGSKeyword_{ REL::ID(1310012) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_bool_BGSListForm_{ REL::ID(246189) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_bool_bool_{ REL::ID(1377019) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_void_BGSKeywordconst_{ REL::ID(122109) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_void_BGSMod__Attachment__Mod_{ REL::ID(1415499) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_GameScript__RefrOrInventoryObj_void_bool_{ REL::ID(1116085) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_IngredientItem_void_unsignedint_{ REL::ID(1214841) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESEffectShader_void_TESObjectREFR_{ REL::ID(1398060) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESFaction_bool_TESFaction_{ REL::ID(1329310) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESFaction_unsignedint_Actor_{ REL::ID(1516267) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESFaction_void_bool_{ REL::ID(369375) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESFaction_void_unsignedint_{ REL::ID(556154) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESForm_bool_BGSKeyword_{ REL::ID(1298894) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESForm_bool_BGSListForm_{ REL::ID(235077) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESGlobal_void_float_{ REL::ID(1323245) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESImageSpaceModifier_void_float_{ REL::ID(1136830) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESNPC_void_bool_{ REL::ID(692430) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectCELL_void_TESFaction_{ REL::ID(1300505) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectCELL_void_TESNPC_{ REL::ID(343481) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectCELL_void_bool_{ REL::ID(744329) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectCELL_void_float_{ REL::ID(1006933) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectMISC_unsignedint_BGSComponent_{ REL::ID(993085) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__Actor_{ REL::ID(156035) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__BGSKeyword_{ REL::ID(584125) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_TESObjectREFR_BGSKeyword_{ REL::ID(252250) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_Actor_{ REL::ID(1521324) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_BGSKeyword_{ REL::ID(1496974) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_BGSLocationRefType_{ REL::ID(1203275) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_BSFixedStringconst_{ REL::ID(921644) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_TESObjectREFR_{ REL::ID(415398) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_bool_{ REL::ID(88588) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_bool_float_{ REL::ID(115999) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_float_ActorValueInfoconst_{ REL::ID(880351) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_float_BSFixedStringconst_{ REL::ID(548959) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_float_TESObjectREFR_{ REL::ID(400275) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_int_BSFixedStringconst_{ REL::ID(735532) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_unsignedint_TESForm_{ REL::ID(984213) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_unsignedint_unsignedint_{ REL::ID(91580) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_Actor_{ REL::ID(310453) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_BGSLocation_{ REL::ID(159284) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_BGSMessage_{ REL::ID(828716) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_TESForm_{ REL::ID(19533) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_TESObjectREFR_{ REL::ID(1341883) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_bool_{ REL::ID(453567) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_float_{ REL::ID(225022) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESObjectREFR_void_unsignedint_{ REL::ID(1157455) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESQuest_BGSBaseAlias_unsignedint_{ REL::ID(191638) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESQuest_bool_TESGlobal_{ REL::ID(1317930) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESQuest_bool_int_{ REL::ID(309012) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESQuest_bool_unsignedint_{ REL::ID(961721) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESQuest_void_bool_{ REL::ID(934251) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction1_TESWeather_void_bool_{ REL::ID(1301142) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_bool_BGSAction_TESObjectREFR_{ REL::ID(734471) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_bool_BGSAssociationType_Actor_{ REL::ID(460061) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_bool_SpellItem_bool_{ REL::ID(151660) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_bool_TESIdleForm_TESObjectREFR_{ REL::ID(108935) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_bool_TESObjectREFR_float_{ REL::ID(322801) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_Actor_bool_{ REL::ID(1059709) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_Actor_int_{ REL::ID(475693) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_BGSOutfit_bool_{ REL::ID(330543) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_BGSPerk_bool_{ REL::ID(1215797) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_BSFixedStringconst_float_{ REL::ID(1512550) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_SpellItem_TESObjectREFR_{ REL::ID(1464885) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_SpellItem_unsignedint_{ REL::ID(27322) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_TESFaction_int_{ REL::ID(1134533) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_TESForm_int_{ REL::ID(1320972) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_TESObjectREFR_bool_{ REL::ID(78368) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_bool_bool_{ REL::ID(1278267) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_float_bool_{ REL::ID(1024419) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_Actor_void_float_float_{ REL::ID(873164) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BGSEncounterZone_BSScript__ArrayWrapper_Actor__BGSKeyword_BGSKeyword_{ REL::ID(963443) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BGSEncounterZone_int_BGSKeyword_BGSKeyword_{ REL::ID(5909) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BGSLocation_bool_BGSLocation_BGSKeyword_{ REL::ID(1251149) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BGSLocation_void_BGSKeyword_float_{ REL::ID(397838) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BGSLocation_void_BGSLocation_BGSKeyword_{ REL::ID(148750) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_bool_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ REL::ID(1002023) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_bool_BSFixedStringconst_BSScript__Variable_{ REL::ID(250167) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_bool_BSScript__Object_BSFixedStringconst_{ REL::ID(716785) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_bool_TESObjectREFR_BSFixedStringconst_{ REL::ID(41979) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_Actor_TESObjectREFR_{ REL::ID(1251585) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ REL::ID(456147) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_BSFixedStringconst_BSScript__Variable_{ REL::ID(582029) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_BSFixedStringconst_int_{ REL::ID(529960) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_BSScript__Object_BSFixedStringconst_{ REL::ID(1437823) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_BSScript__Object_BSScript__Object_{ REL::ID(447056) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_TESObjectREFR_BSFixedStringconst_{ REL::ID(1338383) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_TESObjectREFR_TESObjectREFR_{ REL::ID(433277) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__Object_void_float_unsignedint_{ REL::ID(395244) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_TESForm_unsignedint_BSFixedStringconst_{ REL::ID(1544822) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_float_float_float_{ REL::ID(914961) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_int_int_int_{ REL::ID(883873) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_ActorValueInfo_unsignedint_{ REL::ID(836967) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BGSCameraShot_TESObjectREFR_{ REL::ID(830880) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_BGSSoundDescriptorForm_{ REL::ID(367527) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSFixedStringconst_{ REL::ID(949676) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSScript__Object_{ REL::ID(1059946) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_bool_{ REL::ID(697882) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_float_{ REL::ID(1374731) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_int_{ REL::ID(211778) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_BSFixedStringconst_unsignedint_{ REL::ID(1046260) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_bool_bool_{ REL::ID(1083052) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_unsignedint_bool_{ REL::ID(740933) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_BSScript__StaticFunctionTag_void_unsignedint_float_{ REL::ID(385430) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_bool_BGSMod__Attachment__Mod_unsignedint_{ REL::ID(1010159) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_Actor_bool_{ REL::ID(16466) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_Actor_float_{ REL::ID(461388) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_BSFixedStringconst_TESForm_{ REL::ID(640571) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_TESFaction_bool_{ REL::ID(120896) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_GameScript__RefrOrInventoryObj_void_TESNPC_bool_{ REL::ID(1080886) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_ScrollItem_bool_TESObjectREFR_TESObjectREFR_{ REL::ID(1162903) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_SpellItem_bool_TESObjectREFR_TESObjectREFR_{ REL::ID(323455) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESEffectShader_void_TESObjectREFR_float_{ REL::ID(879906) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESFaction_bool_bool_bool_{ REL::ID(1288204) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESFaction_void_bool_bool_{ REL::ID(956515) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESFaction_void_int_bool_{ REL::ID(437996) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESImageSpaceModifier_void_TESImageSpaceModifier_float_{ REL::ID(511654) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESLevCharacter_void_TESForm_unsignedint_{ REL::ID(750439) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESLevSpell_void_TESForm_unsignedint_{ REL::ID(1147586) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESNPC_void_BGSOutfit_bool_{ REL::ID(66920) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectCELL_void_float_float_{ REL::ID(49929) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_Actor__BGSKeyword_BGSKeyword_{ REL::ID(855971) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__ActorValueInfoconst_unsignedint_{ REL::ID(1551761) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__BGSKeyword_BGSKeyword_{ REL::ID(528999) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__BGSKeyword_unsignedint_{ REL::ID(770596) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_TESObjectREFR__TESForm_float_{ REL::ID(976612) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_BSScript__ArrayWrapper_float__float_float_{ REL::ID(781387) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_TESObjectREFR_unsignedint_BGSKeyword_{ REL::ID(211042) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_{ REL::ID(25594) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_bool_TESForm_BGSMod__Attachment__Mod_{ REL::ID(1528733) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_bool_TESForm_unsignedint_{ REL::ID(206390) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_bool_TESObjectREFR_bool_{ REL::ID(1479974) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_bool_unsignedint_bool_{ REL::ID(1096136) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_int_BGSKeyword_BGSKeyword_{ REL::ID(1114239) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_unsignedint_BGSKeyword_unsignedint_{ REL::ID(927726) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_ActorValueInfoconst_float_{ REL::ID(1152465) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_Actor_unsignedint_{ REL::ID(1180055) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_BGSKeyword_bool_{ REL::ID(1124925) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_BGSLocation_BGSLocationRefType_{ REL::ID(532306) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_BSFixedStringconst_{ REL::ID(834796) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_bool_{ REL::ID(1571942) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_float_{ REL::ID(1384989) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_BSFixedStringconst_int_{ REL::ID(1198860) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_TESForm_BGSMod__Attachment__Mod_{ REL::ID(351576) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_TESFormconst_unsignedint_{ REL::ID(543115) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_TESObjectREFR_BGSKeyword_{ REL::ID(639353) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_TESObjectREFR_bool_{ REL::ID(275251) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_bool_bool_{ REL::ID(717231) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectREFR_void_float_float_{ REL::ID(363715) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESObjectWEAP_void_TESObjectREFR_TESAmmo_{ REL::ID(446297) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESQuest_void_unsignedint_bool_{ REL::ID(1345326) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction2_TESWeather_void_bool_bool_{ REL::ID(1432485) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_Actor_void_BGSHeadPart_bool_bool_{ REL::ID(708487) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_Actor_void_TESForm_bool_bool_{ REL::ID(1091696) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_Actor_void_bool_bool_bool_{ REL::ID(506350) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BGSReferenceEffect_void_TESObjectREFR_float_TESObjectREFR_{ REL::ID(1573815) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__Object_void_BSScript__Object_BSScript__Object_float_{ REL::ID(1051118) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__StaticFunctionTag_bool_BSFixedStringconst_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ REL::ID(752704) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__StaticFunctionTag_bool_BSFixedStringconst_BSFixedStringconst_unsignedint_{ REL::ID(1298444) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ REL::ID(645665) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_TESObjectREFR_float_float_{ REL::ID(1044776) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_bool_bool_bool_{ REL::ID(788212) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_BSScript__StaticFunctionTag_void_float_float_float_{ REL::ID(419437) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_GameScript__RefrOrInventoryObj_Actor_TESNPC_unsignedint_BGSEncounterZone_{ REL::ID(837828) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_GameScript__RefrOrInventoryObj_bool_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ REL::ID(654629) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_GameScript__RefrOrInventoryObj_bool_float_float_float_{ REL::ID(535333) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_SpellItem_bool_TESObjectREFR_Actor_TESObjectREFR_{ REL::ID(1359776) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESFaction_void_TESFaction_bool_bool_{ REL::ID(37499) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESLevItem_void_TESForm_unsignedint_unsignedint_{ REL::ID(1520894) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_bool_BGSComponent_unsignedint_bool_{ REL::ID(793738) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_bool_BGSKeyword_BGSMessage_BGSLocation_{ REL::ID(547586) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_bool_BSFixedStringconst_TESObjectREFR_BSFixedStringconst_{ REL::ID(689850) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_bool_BSFixedStringconst_bool_float_{ REL::ID(357628) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_bool_GameScript__FormOrInventoryObj_unsignedint_bool_{ REL::ID(668073) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_bool_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ REL::ID(539805) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESObjectREFR_void_float_float_float_{ REL::ID(1451030) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction3_TESQuest_void_unsignedint_bool_bool_{ REL::ID(281502) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_Actor_void_BSFixedStringconst_bool_bool_bool_{ REL::ID(694628) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_BSScript__Object_void_BSScript__Object_BSScript__Object_TESForm_bool_{ REL::ID(225775) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_BSScript__Object_void_TESObjectREFR_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ REL::ID(360010) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_BSScript__StaticFunctionTag_Actor_float_float_float_float_{ REL::ID(535875) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_TESObjectREFR_bool_GameScript__FormOrInventoryObj_int_bool_TESObjectREFR_{ REL::ID(420318) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_TESObjectREFR_bool_TESForm_unsignedint_bool_TESObjectREFR_{ REL::ID(1457063) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_TESObjectREFR_bool_float_float_float_float_{ REL::ID(785821) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_TESObjectREFR_void_BGSKeyword_Actor_bool_TESObjectREFR_{ REL::ID(935677) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_TESObjectREFR_void_TESObjectREFR_float_float_bool_{ REL::ID(695971) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction4_TESObjectREFR_void_TESTopic_Actor_bool_TESObjectREFR_{ REL::ID(417256) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BGSKeyword_bool_BGSLocation_TESObjectREFR_TESObjectREFR_unsignedint_unsignedint_{ REL::ID(1281480) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BGSKeyword_void_BGSLocation_TESObjectREFR_TESObjectREFR_unsignedint_unsignedint_{ REL::ID(324413) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BSScript__StaticFunctionTag_TESObjectREFR_BGSListForm_float_float_float_float_{ REL::ID(110706) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BSScript__StaticFunctionTag_TESObjectREFR_TESForm_float_float_float_float_{ REL::ID(297029) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BSScript__StaticFunctionTag_void_BSFixedStringconst_BSFixedStringconst_BSFixedStringconst_BSFixedStringconst_BSFixedStringconst_{ REL::ID(1520156) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BSScript__StaticFunctionTag_void_TESObjectREFR_unsignedint_TESObjectREFR_TESObjectREFR_TESObjectREFR_{ REL::ID(578702) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_BSScript__StaticFunctionTag_void_bool_bool_float_float_bool_{ REL::ID(922367) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_GameScript__RefrOrInventoryObj_TESObjectREFR_TESForm_unsignedint_bool_bool_bool_{ REL::ID(319505) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_GameScript__RefrOrInventoryObj_bool_GameScript__RefrOrInventoryObj_float_float_float_bool_{ REL::ID(509075) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ REL::ID(502983) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_TESObjectREFR_void_TESObjectREFR_BSFixedStringconst_float_float_float_{ REL::ID(290457) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction5_TESObjectREFR_void_float_float_BGSSoundOutput_bool_bool_{ REL::ID(882017) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction6_BGSMessage_void_BSFixedStringconst_float_float_int_BSFixedStringconst_int_{ REL::ID(1579776) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction6_BSScript__StaticFunctionTag_bool_BSFixedStringconst_bool_bool_bool_bool_bool_{ REL::ID(502090) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction6_TESObjectCELL_void_unsignedint_unsignedint_unsignedint_unsignedint_unsignedint_unsignedint_{ REL::ID(675659) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction6_TESObjectREFR_void_BSFixedStringconst_float_float_float_bool_bool_{ REL::ID(971945) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction6_TESObjectREFR_void_BSFixedStringconst_float_float_float_float_bool_{ REL::ID(239845) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction7_TESObjectREFR_TESObjectREFR_BSFixedStringconst_TESForm_unsignedint_bool_bool_bool_bool_{ REL::ID(212687) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction8_TESObjectREFR_bool_BGSImpactDataSet_BSFixedStringconst_float_float_float_float_bool_bool_{ REL::ID(171539) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction8_TESObjectREFR_void_float_float_float_float_float_float_float_float_{ REL::ID(1061055) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction9_BGSMessage_bool_float_float_float_float_float_float_float_float_float_{ REL::ID(543411) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction9_BSScript__Object_void_BSScript__Object_BSScript__Object_TESForm_TESForm_int_int_int_int_bool_{ REL::ID(598828) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeFunction9_TESObjectREFR_void_float_float_float_float_float_float_float_float_float_{ REL::ID(477054) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction0_Actor_void_{ REL::ID(70754) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction0_EffectSetting_BSFixedStringconst_{ REL::ID(220832) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction0_GameScript__RefrOrInventoryObj_bool_{ REL::ID(435599) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction0_GameScript__RefrOrInventoryObj_void_{ REL::ID(1545738) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction0_TESObjectREFR_void_{ REL::ID(343692) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction0_TESQuest_bool_{ REL::ID(799972) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction10_TESObjectREFR_BGSLocation_BGSKeyword_BGSMessage_BGSLocation_BGSListForm_BGSListForm_bool_bool_bool_bool_bool_{ REL::ID(1397104) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_BGSSoundDescriptorForm_bool_TESObjectREFR_{ REL::ID(572158) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_BSScript__Object_BSScript__Variable_BSFixedStringconst_{ REL::ID(414960) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_BSScript__StaticFunctionTag_BSFixedStringconst_unsignedint_{ REL::ID(656450) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_BSScript__StaticFunctionTag_float_BSFixedStringconst_{ REL::ID(517283) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_BSScript__StaticFunctionTag_void_float_{ REL::ID(324345) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_GameScript__RefrOrInventoryObj_void_bool_{ REL::ID(313234) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_TESObjectREFR_TESObjectREFR_bool_{ REL::ID(831523) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_TESObjectREFR_bool_BSFixedStringconst_{ REL::ID(1392616) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_TESObjectREFR_void_TESObjectREFR_{ REL::ID(165347) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_TESObjectREFR_void_bool_{ REL::ID(606910) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_TESObjectREFR_void_float_{ REL::ID(634497) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction1_TESQuest_bool_int_{ REL::ID(827346) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_Actor_bool_TESObjectREFR_float_{ REL::ID(841149) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_BSScript__Object_BSScript__Variable_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ REL::ID(1520677) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_BSScript__Object_void_BSFixedStringconst_BSScript__Variable_{ REL::ID(768522) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_ScrollItem_void_TESObjectREFR_TESObjectREFR_{ REL::ID(98770) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_SpellItem_void_TESObjectREFR_TESObjectREFR_{ REL::ID(841859) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_TESFaction_void_bool_bool_{ REL::ID(224389) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_TESObjectREFR_TESObjectREFR_TESForm_unsignedint_{ REL::ID(724873) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_{ REL::ID(544527) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction2_TESObjectREFR_void_unsignedint_bool_{ REL::ID(1489485) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_BSScript__StaticFunctionTag_BSScript__Variable_BSFixedStringconst_BSFixedStringconst_BSScript__ArrayWrapper_BSScript__Variable__{ REL::ID(1270754) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_GameScript__RefrOrInventoryObj_void_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ REL::ID(1172575) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_GameScript__RefrOrInventoryObj_void_float_float_float_{ REL::ID(1053410) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_SpellItem_void_TESObjectREFR_Actor_TESObjectREFR_{ REL::ID(295837) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_TESObjectREFR_BGSLocation_BGSKeyword_BGSMessage_BGSLocation_{ REL::ID(1065481) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_TESObjectREFR_void_BGSComponent_unsignedint_bool_{ REL::ID(1311657) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction3_TESObjectREFR_void_GameScript__FormOrInventoryObj_unsignedint_bool_{ REL::ID(1186168) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction4_TESObjectREFR_void_GameScript__FormOrInventoryObj_int_bool_TESObjectREFR_{ REL::ID(938685) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction4_TESObjectREFR_void_TESForm_unsignedint_bool_TESObjectREFR_{ REL::ID(392883) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction4_TESObjectREFR_void_float_float_float_float_{ REL::ID(1303737) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction5_BGSKeyword_bool_BGSLocation_TESObjectREFR_TESObjectREFR_unsignedint_unsignedint_{ REL::ID(217563) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction5_GameScript__RefrOrInventoryObj_void_GameScript__RefrOrInventoryObj_float_float_float_bool_{ REL::ID(1027148) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction5_TESObjectREFR_bool_BSFixedStringconst_BSFixedStringconst_TESObjectREFR_BSFixedStringconst_BSFixedStringconst_{ REL::ID(1021157) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction6_BSScript__StaticFunctionTag_void_BSFixedStringconst_bool_bool_bool_bool_bool_{ REL::ID(1020268) };
+		inline constexpr std::array<REL::ID, 1> BSScript__NativeLatentFunction9_BGSMessage_int_float_float_float_float_float_float_float_float_float_{ REL::ID(1061366) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ObjectBindPolicy{ REL::ID(249280) };
+		inline constexpr std::array<REL::ID, 1> BSScript__ObjectTypeInfo{ REL::ID(517964) };
+		inline constexpr std::array<REL::ID, 1> BSScript__SimpleAllocMemoryPagePolicy{ REL::ID(1188456) };
+		inline constexpr std::array<REL::ID, 1> BSScript__StructTypeInfo{ REL::ID(903325) };
+		inline constexpr std::array<REL::ID, 1> BSScript__UnlinkedTypes__InstructionStream__InstructionFunctor{ REL::ID(1555077) };
+		inline constexpr std::array<REL::ID, 1> BSScript__UnlinkedTypes____BuildInstructionOffsetMapFunctor{ REL::ID(1022720) };
+		inline constexpr std::array<REL::ID, 1> BSScript__UnlinkedTypes____CollectStringsFunctor{ REL::ID(1195706) };
+		inline constexpr std::array<REL::ID, 1> BSScript__UnlinkedTypes____CountInstructionInfo{ REL::ID(850119) };
+		inline constexpr std::array<REL::ID, 1> BSScript__UnlinkedTypes____UnpackInstructionsFunctor{ REL::ID(318148) };
+		inline constexpr std::array<REL::ID, 1> BSScript__UnlinkedTypes____WriteInstructionsFunctor{ REL::ID(145341) };
+		inline constexpr std::array<REL::ID, 1> BSSearchPath{ REL::ID(1374207) };
+		inline constexpr std::array<REL::ID, 1> BSSegmentDataStorage{ REL::ID(925961) };
+		inline constexpr std::array<REL::ID, 1> BSSegmentedTriShape{ REL::ID(533445) };
+		inline constexpr std::array<REL::ID, 2> BSShader{ REL::ID(892808), REL::ID(799662) };
+		inline constexpr std::array<REL::ID, 1> BSShaderAccumulator{ REL::ID(357329) };
+		inline constexpr std::array<REL::ID, 1> BSShaderMaterial{ REL::ID(1373927) };
+		inline constexpr std::array<REL::ID, 1> BSShaderMaterialExtraData{ REL::ID(606075) };
+		inline constexpr std::array<REL::ID, 1> BSShaderProperty{ REL::ID(920439) };
+		inline constexpr std::array<REL::ID, 1> BSShaderProperty__ForEachVisitor{ REL::ID(48799) };
+		inline constexpr std::array<REL::ID, 1> BSShaderResourceManager{ REL::ID(187043) };
+		inline constexpr std::array<REL::ID, 1> BSShaderTextureSet{ REL::ID(279449) };
+		inline constexpr std::array<REL::ID, 1> BSShaderUtil__SetTexturesCanDegrade__2__functor{ REL::ID(1142344) };
+		inline constexpr std::array<REL::ID, 1> BSShadowDirectionalLight{ REL::ID(97945) };
+		inline constexpr std::array<REL::ID, 1> BSShadowFrustumLight{ REL::ID(67506) };
+		inline constexpr std::array<REL::ID, 1> BSShadowLight{ REL::ID(456935) };
+		inline constexpr std::array<REL::ID, 1> BSShadowParabolicLight{ REL::ID(585920) };
+		inline constexpr std::array<REL::ID, 1> BSShapeConstructor{ REL::ID(351933) };
+		inline constexpr std::array<REL::ID, 1> BSSimpleScaleController{ REL::ID(1151340) };
+		inline constexpr std::array<REL::ID, 1> BSSkin__BoneData{ REL::ID(704887) };
+		inline constexpr std::array<REL::ID, 1> BSSkin__Instance{ REL::ID(424506) };
+		inline constexpr std::array<REL::ID, 2> BSSkyShader{ REL::ID(221629), REL::ID(128251) };
+		inline constexpr std::array<REL::ID, 1> BSSkyShaderProperty{ REL::ID(207940) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocator{ REL::ID(138105) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_24___BSPointerAllocatorPageAllocator_BSNonReentrantSpinLock_{ REL::ID(67806) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_32_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(824673) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_40_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(1263442) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_48_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(704342) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_56_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(213258) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_64_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(11908) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_80_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(450827) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__TLockingUserPool_88_BSGraphics__ResourceCacheAllocator_BSNonReentrantSpinLock_{ REL::ID(1062601) };
+		inline constexpr std::array<REL::ID, 1> BSSmallBlockAllocatorUtil__UserPoolBase{ REL::ID(1281631) };
+		inline constexpr std::array<REL::ID, 1> BSSocket{ REL::ID(277587) };
+		inline constexpr std::array<REL::ID, 1> BSSocketServer{ REL::ID(50763) };
+		inline constexpr std::array<REL::ID, 1> BSSpeedSamplerModifier{ REL::ID(1371007) };
+		inline constexpr std::array<REL::ID, 1> BSSphereConstructor{ REL::ID(1402176) };
+		inline constexpr std::array<REL::ID, 1> BSSplatterExtraData{ REL::ID(33342) };
+		inline constexpr std::array<REL::ID, 1> BSStateMachineCallbackSingleton{ REL::ID(337405) };
+		inline constexpr std::array<REL::ID, 1> BSStaticTriShapeDB__Builder{ REL::ID(1421701) };
+		inline constexpr std::array<REL::ID, 1> BSStaticTriShapeDB__CsgStream{ REL::ID(1375047) };
+		inline constexpr std::array<REL::ID, 1> BSStaticTriShapeDB__IBatchRequestIter{ REL::ID(547889) };
+		inline constexpr std::array<REL::ID, 1> BSStaticTriShapeDB__Manager{ REL::ID(717589) };
+		inline constexpr std::array<REL::ID, 2> BSStaticTriShapeDB__QueuedHandles{ REL::ID(245616), REL::ID(544671) };
+		inline constexpr std::array<REL::ID, 1> BSSteamAwardsSystemUtility{ REL::ID(240506) };
+		inline constexpr std::array<REL::ID, 1> BSSteamSystemUtility{ REL::ID(865582) };
+		inline constexpr std::array<REL::ID, 1> BSStorage{ REL::ID(792513) };
+		inline constexpr std::array<REL::ID, 1> BSStream{ REL::ID(605694) };
+		inline constexpr std::array<REL::ID, 1> BSStreamParserData{ REL::ID(680199) };
+		inline constexpr std::array<REL::ID, 1> BSStringPool__IterationCallback{ REL::ID(1076228) };
+		inline constexpr std::array<REL::ID, 1> BSStripPSysData{ REL::ID(331115) };
+		inline constexpr std::array<REL::ID, 1> BSStripParticleSystem{ REL::ID(1286278) };
+		inline constexpr std::array<REL::ID, 1> BSSubBehaviorGraphSingletonData{ REL::ID(323613) };
+		inline constexpr std::array<REL::ID, 1> BSSubBehaviorGraphSingletonDataAddToDeferredDeleterTask{ REL::ID(1280689) };
+		inline constexpr std::array<REL::ID, 1> BSSubIndexTriShape{ REL::ID(248868) };
+		inline constexpr std::array<REL::ID, 1> BSSupportedShapeConstructor_BSRoundedConeSupportFunctor_{ REL::ID(511071) };
+		inline constexpr std::array<REL::ID, 1> BSSysInfoSystemUtility{ REL::ID(1578929) };
+		inline constexpr std::array<REL::ID, 1> BSSystemFileAsyncFunctor{ REL::ID(782981) };
+		inline constexpr std::array<REL::ID, 1> BSSystemFileStorage{ REL::ID(71986) };
+		inline constexpr std::array<REL::ID, 1> BSSystemFileStreamer__Streamer{ REL::ID(1081566) };
+		inline constexpr std::array<REL::ID, 1> BSSystemFileStreamer__Streamer__ControlThread{ REL::ID(1347443) };
+		inline constexpr std::array<REL::ID, 1> BSSystemFileStreamer__Streamer__PhysicalReadThread{ REL::ID(423328) };
+		inline constexpr std::array<REL::ID, 1> BSSystemFileStreamer__Streamer__StreamerThread{ REL::ID(689836) };
+		inline constexpr std::array<REL::ID, 1> BSSystemMonitor__MemOpsThread{ REL::ID(1288298) };
+		inline constexpr std::array<REL::ID, 1> BSSystemMonitor__SocketThread{ REL::ID(630466) };
+		inline constexpr std::array<REL::ID, 1> BSSystemUtilitiesStrings{ REL::ID(1392052) };
+		inline constexpr std::array<REL::ID, 1> BSSystemUtility{ REL::ID(1559894) };
+		inline constexpr std::array<REL::ID, 1> BSTAlignedHeapArrayAllocator_16___AllocatorFunctor{ REL::ID(984119) };
+		inline constexpr std::array<REL::ID, 1> BSTAlignedScrapArrayAllocator_16___AllocatorFunctor{ REL::ID(1198822) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_bool_ActorCCOnStairsChannel_{ REL::ID(1371932) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_bool_ActorCCSuportChannel_{ REL::ID(321878) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorCCNormDotUpChannel_{ REL::ID(55845) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorCopyGraphVariableChannel_{ REL::ID(909946) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorDirectionChannel_{ REL::ID(867459) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorDirectionDegreesChannel_{ REL::ID(1012756) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorLeftWeaponSpeedChannel_{ REL::ID(1558870) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorPitchChannel_{ REL::ID(1040351) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorPitchDeltaChannel_{ REL::ID(947170) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorRollChannel_{ REL::ID(555240) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorSpeedChannel_{ REL::ID(163062) };
+		inline constexpr std::array<REL::ID, 2> BSTAnimationGraphDataChannel_Actor_float_ActorSpeedSmoothedChannel_{ REL::ID(1059477), REL::ID(354677) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorTimeDeltaChannel_{ REL::ID(588159) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorTurnDeltaChannel_{ REL::ID(69797) };
+		inline constexpr std::array<REL::ID, 2> BSTAnimationGraphDataChannel_Actor_float_ActorTurnDeltaSmoothedChannel_{ REL::ID(1106151), REL::ID(401254) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorWardHealthChannel_{ REL::ID(128206) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_ActorWeaponSpeedChannel_{ REL::ID(681639) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_PlayerControllerXRawChannel_{ REL::ID(599057) };
+		inline constexpr std::array<REL::ID, 2> BSTAnimationGraphDataChannel_Actor_float_PlayerControllerXSmoothedChannel_{ REL::ID(1569872), REL::ID(864717) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_PlayerControllerXSumChannel_{ REL::ID(1490448) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_PlayerControllerYRawChannel_{ REL::ID(332891) };
+		inline constexpr std::array<REL::ID, 2> BSTAnimationGraphDataChannel_Actor_float_PlayerControllerYSmoothedChannel_{ REL::ID(958123), REL::ID(253454) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_PlayerControllerYSumChannel_{ REL::ID(1224369) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_float_PlayerDirectionSmoothedChannel_{ REL::ID(706351) };
+		inline constexpr std::array<REL::ID, 2> BSTAnimationGraphDataChannel_Actor_float_PlayerFirstSpeedSmoothedChannel_{ REL::ID(659545), REL::ID(1536920) };
+		inline constexpr std::array<REL::ID, 2> BSTAnimationGraphDataChannel_Actor_float_PlayerPitchDeltaSmoothedChannel_{ REL::ID(94377), REL::ID(971755) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_int_ActorCopyGraphVariableChannel_{ REL::ID(31977) };
+		inline constexpr std::array<REL::ID, 1> BSTAnimationGraphDataChannel_Actor_int_ActorWantBlockChannel_{ REL::ID(853911) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSScrapArrayAllocator_{ REL::ID(928205) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTArrayHeapAllocator_{ REL::ID(1402049) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_1024__{ REL::ID(1097279) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_104__{ REL::ID(294337) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_108__{ REL::ID(1241280) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_112__{ REL::ID(1226342) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_120__{ REL::ID(881438) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_128__{ REL::ID(1391156) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_12__{ REL::ID(832179) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_160__{ REL::ID(1177805) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_168__{ REL::ID(1294305) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_16__{ REL::ID(1048753) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_1760__{ REL::ID(377117) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_176__{ REL::ID(1132105) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_2048__{ REL::ID(1294833) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_24__{ REL::ID(588708) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_256__{ REL::ID(682748) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_26__{ REL::ID(323537) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_280__{ REL::ID(511568) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_2944__{ REL::ID(809167) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_320__{ REL::ID(660379) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_32__{ REL::ID(685361) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_36__{ REL::ID(226899) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_384__{ REL::ID(1209078) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_40__{ REL::ID(741099) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_48__{ REL::ID(464170) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_4__{ REL::ID(810861) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_512__{ REL::ID(1179388) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_576__{ REL::ID(946806) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_64__{ REL::ID(444217) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_672__{ REL::ID(359700) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_80__{ REL::ID(1265816) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_896__{ REL::ID(197698) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_8__{ REL::ID(364892) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_BSTSmallArrayHeapAllocator_96__{ REL::ID(1259108) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayAllocatorFunctor_NVFlex__PinnedArrayAllocator_{ REL::ID(586152) };
+		inline constexpr std::array<REL::ID, 1> BSTArrayBase__IAllocatorFunctor{ REL::ID(1276804) };
+		inline constexpr std::array<REL::ID, 1> BSTCaseInsensitiveStringMap_IDLE_ANIM_ROOT_{ REL::ID(1464997) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonLLMessageQueue_BSScript__Internal__FunctionMessage_{ REL::ID(973524) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonLLMessageQueue_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ REL::ID(473847) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonMessageQueue_BSPackedTask_{ REL::ID(1518115) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonMessageQueue_BSScript__Internal__FunctionMessage_{ REL::ID(801096) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonMessageQueue_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ REL::ID(301052) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonScrapHeapMessageQueue_BSPackedTask_{ REL::ID(108467) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_BGSCombinedCellGeometryDB__ModelDB__DBTraits__StorageType_8192_{ REL::ID(1150613) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_BGSCombinedCellGeometryDB__PreloadTask__PreloadRequest_1024_{ REL::ID(1024443) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_BGSDecalManager__PendingSkinnedDecal_128_{ REL::ID(783422) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_BGSSaveLoadThread__AsyncRequest_8_{ REL::ID(1238070) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_BSFaceGenManager__PendingCustomizationData_128_{ REL::ID(1063882) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_BSScript__Internal__SuspendedStack_128_{ REL::ID(880333) };
+		inline constexpr std::array<REL::ID, 1> BSTCommonStaticMessageQueue_NiPointer_NiAVObject__256_{ REL::ID(639308) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ActionActivateDoneHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1177294) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AddRagdollHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1075579) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AlertStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(137002) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AllowRotationHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(949472) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimatedCameraDeltaStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(951820) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimatedCameraEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1297230) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimatedCameraStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(606438) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationDrivenHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(823437) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationObjectDrawHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(554527) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationObjectLoadHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(209013) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationSpeedInformationDBData_BSAnimationDBData_{ REL::ID(640991) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationStanceDataSingletonDBData_BSAnimationDBData_{ REL::ID(286045) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationStanceData_AnimationBoneTransform__IAnimationStanceData_{ REL::ID(72195) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnimationStanceData_NiPoint3__IAnimationStanceData_{ REL::ID(604240) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AnticipateAttackHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(286563) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ArrowAttachHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1531317) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ArrowDetachHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(75090) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttachReferenceHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(745719) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStateChangeHandler0_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(743405) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStateChangeHandler1_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(869060) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStateChangeHandler2_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(995178) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStateChangeHandler3_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1121402) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStateChangeHandler4_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1247885) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(617127) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(243095) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackWinEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(116922) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AttackWinStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1573326) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AwakeSoundFadeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(358560) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AwakeSoundPauseHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(611111) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AwakeSoundResumeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(737413) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_AwakeSoundStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(484810) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSAIWorldLocationInteriorCell_IAIWorldLocation_{ REL::ID(1098779) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSAIWorldLocationPointRadius_IAIWorldLocation_{ REL::ID(1411080) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSAIWorldLocationPrimitive_IAIWorldLocation_{ REL::ID(786300) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSAIWorldLocationRefRadius_IAIWorldLocation_{ REL::ID(141660) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSAutoWeaponSoundDef_BGSSoundDescriptor_{ REL::ID(545129) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSCompoundSoundDef_BGSSoundDescriptor_{ REL::ID(462001) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSConveyorBelt__ConveyorBelt_InitActionI_{ REL::ID(1563096) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSMotorAction__FanMotor_InitActionI_{ REL::ID(1082762) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSMusicPaletteTrack_BSIMusicTrack_{ REL::ID(1382907) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSMusicSilenceTrack_BSIMusicTrack_{ REL::ID(53018) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSMusicSingleTrack_BSIMusicTrack_{ REL::ID(524773) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataBool_IPackageData_{ REL::ID(71403) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataFloat_IPackageData_{ REL::ID(1135217) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataInt_IPackageData_{ REL::ID(603380) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataLocationWrapper_IPackageData_{ REL::ID(1121426) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataLocation_IPackageData_{ REL::ID(1148950) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataObjectList_IPackageData_{ REL::ID(1047419) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataRefOLD_IPackageData_{ REL::ID(85135) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataRef_IPackageData_{ REL::ID(315143) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataTargetSelector_IPackageData_{ REL::ID(617153) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSPackageDataTopic_IPackageData_{ REL::ID(1272190) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureAcquireExecState_IProcedureTreeExecState_{ REL::ID(777908) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureAcquire_IProcedure_{ REL::ID(1487378) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureActivateExecState_IProcedureTreeExecState_{ REL::ID(245740) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureActivate_IProcedure_{ REL::ID(853398) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureDialogueActivateExecState_IProcedureTreeExecState_{ REL::ID(371744) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureDialogueActivate_IProcedure_{ REL::ID(1009216) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureDialogueExecState_IProcedureTreeExecState_{ REL::ID(278541) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureDialogue_IProcedure_{ REL::ID(1549888) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureDoneExecState_IProcedureTreeExecState_{ REL::ID(1328597) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureDone_IProcedure_{ REL::ID(53003) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureEatExecState_IProcedureTreeExecState_{ REL::ID(1016089) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureEat_IProcedure_{ REL::ID(389415) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureEscortExecState_IProcedureTreeExecState_{ REL::ID(704010) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureEscort_IProcedure_{ REL::ID(1370750) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFindExecState_IProcedureTreeExecState_{ REL::ID(390808) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFind_IProcedure_{ REL::ID(658124) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFleeExecState_IProcedureTreeExecState_{ REL::ID(1441070) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFlee_IProcedure_{ REL::ID(682731) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFlightGrabExecState_IProcedureTreeExecState_{ REL::ID(1347725) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFlightGrab_IProcedure_{ REL::ID(141878) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFollowExecState_IProcedureTreeExecState_{ REL::ID(816028) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFollowTo_IProcedure_{ REL::ID(895660) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureFollow_IProcedure_{ REL::ID(1254925) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureForceGreet_IProcedure_{ REL::ID(1153168) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureGuardArea_IProcedure_{ REL::ID(618305) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureGuardExecState_IProcedureTreeExecState_{ REL::ID(503261) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureGuard_IProcedure_{ REL::ID(711932) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureHeadtrackExecState_IProcedureTreeExecState_{ REL::ID(1553685) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureHeadtrack_IProcedure_{ REL::ID(1460386) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureHoldPositionExecState_IProcedureTreeExecState_{ REL::ID(1460413) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureHoldPosition_IProcedure_{ REL::ID(1095187) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureHoverExecState_IProcedureTreeExecState_{ REL::ID(1147591) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureHover_IProcedure_{ REL::ID(1259644) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureKeepAnEyeOnExecState_IProcedureTreeExecState_{ REL::ID(1054349) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureKeepAnEyeOn_IProcedure_{ REL::ID(1297707) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureLockUnlockExecState_IProcedureTreeExecState_{ REL::ID(961105) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureLock_IProcedure_{ REL::ID(244521) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureOrbitExecState_IProcedureTreeExecState_{ REL::ID(648671) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureOrbit_IProcedure_{ REL::ID(49460) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedurePatrolExecState_IProcedureTreeExecState_{ REL::ID(335912) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedurePatrol_IProcedure_{ REL::ID(1343489) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedurePlayIdleExecState_IProcedureTreeExecState_{ REL::ID(1385933) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedurePlayIdle_IProcedure_{ REL::ID(467135) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedurePursue_IProcedure_{ REL::ID(457510) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureRangeExecState_IProcedureTreeExecState_{ REL::ID(453352) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureRange_IProcedure_{ REL::ID(647937) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSandboxExecState_IProcedureTreeExecState_{ REL::ID(1073449) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSandbox_IProcedure_{ REL::ID(734864) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSayExecState_IProcedureTreeExecState_{ REL::ID(541739) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSay_IProcedure_{ REL::ID(1258228) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSitSleepExecState_IProcedureTreeExecState_{ REL::ID(448010) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSit_IProcedure_{ REL::ID(1568011) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureSleep_IProcedure_{ REL::ID(1035604) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureStayAwayExecState_IProcedureTreeExecState_{ REL::ID(1498878) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureStayAway_IProcedure_{ REL::ID(219832) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTravelExecState_IProcedureTreeExecState_{ REL::ID(966429) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTravel_IProcedure_{ REL::ID(448454) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeProcedure_IProcedureTreeItem_{ REL::ID(1570574) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeRandomExecState_IProcedureTreeExecState_{ REL::ID(1090217) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeRandom_IProcedureTreeItem_{ REL::ID(758811) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeSequenceExecState_IProcedureTreeExecState_{ REL::ID(1104022) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeSequence_IProcedureTreeItem_{ REL::ID(1477372) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeSimultaneousExecState_IProcedureTreeExecState_{ REL::ID(39858) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeSimultaneous_IProcedureTreeItem_{ REL::ID(1071130) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeStackedExecState_IProcedureTreeExecState_{ REL::ID(572205) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureTreeStacked_IProcedureTreeItem_{ REL::ID(1164509) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUnlock_IProcedure_{ REL::ID(151382) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUseIdleMarkerExecState_IProcedureTreeExecState_{ REL::ID(873134) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUseIdleMarker_IProcedure_{ REL::ID(319511) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUseMagicExecState_IProcedureTreeExecState_{ REL::ID(780233) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUseMagic_IProcedure_{ REL::ID(1300920) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUseWeaponExecState_IProcedureTreeExecState_{ REL::ID(248019) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureUseWeapon_IProcedure_{ REL::ID(187630) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureWaitExecState_IProcedureTreeExecState_{ REL::ID(1298185) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureWait_IProcedure_{ REL::ID(1149586) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureWanderExecState_IProcedureTreeExecState_{ REL::ID(985418) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSProcedureWander_IProcedure_{ REL::ID(343221) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGSStandardSoundDef_BGSSoundDescriptor_{ REL::ID(918422) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGShkMatFadeController_BShkNonTransformController_{ REL::ID(1309572) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BGShkPhonemeController_BShkNonTransformController_{ REL::ID(1448487) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BSAudioEffects__BSDelayEffectParams_BSIAudioEffectParameters_{ REL::ID(1293762) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BSAudioEffects__BSOverdriveParams_BSIAudioEffectParameters_{ REL::ID(1261008) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BSAudioEffects__BSStateVariableFilterParams_BSIAudioEffectParameters_{ REL::ID(1386831) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BSPathingRequest_BSPathingRequest_{ REL::ID(471510) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BSPathingSolution_BSPathingSolution_{ REL::ID(526872) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BSXAudio2Audio_BSAudio_{ REL::ID(81535) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BShkVisibilityController_BShkNonTransformController_{ REL::ID(1486631) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BShkbHkxDB__ProjectDBData_BSAnimationDBData_{ REL::ID(257546) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BShkbHkxDB__hkxDBData_BSAnimationDBData_{ REL::ID(789739) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BedEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(665295) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BedFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(917251) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BowDrawnHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1498634) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BowReleaseHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1404867) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BowZoomStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(201304) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_BowZoomStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(327195) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CameraOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1271240) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CameraOverrideStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(34156) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CameraShakeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(444702) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ChairEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(539156) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ChairFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(571957) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CollectionAnimationSpeedContour_AnimationSpeedContour_{ REL::ID(951989) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAcquireSearchDebugData_CombatObjectBase_{ REL::ID(1164876) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAimController_CombatObjectBase_{ REL::ID(208019) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAnimatedPath_CombatObjectBase_{ REL::ID(1040440) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatApproachTargetPathController_CombatObjectBase_{ REL::ID(1389046) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAreaHoldPosition_CombatObjectBase_{ REL::ID(569576) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAreaReference_CombatObjectBase_{ REL::ID(1460845) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAreaShape_CombatObjectBase_{ REL::ID(1115143) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatAreaStandard_CombatObjectBase_{ REL::ID(224108) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatChangePositionPathController_CombatObjectBase_{ REL::ID(1024980) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatChargingSearchData_CombatObjectBase_{ REL::ID(729685) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatCluster_CombatObjectBase_{ REL::ID(790682) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatCoverLocation_CombatObjectBase_{ REL::ID(613157) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatCoverSearchDebugData_CombatObjectBase_{ REL::ID(958536) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatCoverSearchResult_CombatObjectBase_{ REL::ID(267621) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatCoverSearch_CombatObjectBase_{ REL::ID(1504659) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatCoveredPathDebugData_CombatObjectBase_{ REL::ID(907011) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatDisableActionController_CombatObjectBase_{ REL::ID(590144) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatDisableAimController_CombatObjectBase_{ REL::ID(7039) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatEnterCoverPathController_CombatObjectBase_{ REL::ID(1303928) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatFindCoverPathSpeedController_CombatObjectBase_{ REL::ID(734990) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatFlankingSearchData_CombatObjectBase_{ REL::ID(374700) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatFollowTargetPathController_CombatObjectBase_{ REL::ID(152673) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemGrenade_CombatObjectBase_{ REL::ID(1077826) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor__CombatObjectBase_{ REL::ID(272520) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem__CombatObjectBase_{ REL::ID(486386) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon__CombatObjectBase_{ REL::ID(700923) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak__CombatObjectBase_{ REL::ID(1342313) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm__CombatObjectBase_{ REL::ID(1556675) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility__CombatObjectBase_{ REL::ID(914448) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight__CombatObjectBase_{ REL::ID(1128341) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive__CombatObjectBase_{ REL::ID(1044249) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze__CombatObjectBase_{ REL::ID(1212907) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate__CombatObjectBase_{ REL::ID(1426435) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore__CombatObjectBase_{ REL::ID(616424) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript__CombatObjectBase_{ REL::ID(998404) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger__CombatObjectBase_{ REL::ID(188526) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon__CombatObjectBase_{ REL::ID(402129) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect__CombatObjectBase_{ REL::ID(58308) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard__CombatObjectBase_{ REL::ID(830327) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor__CombatObjectBase_{ REL::ID(963365) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem__CombatObjectBase_{ REL::ID(1177467) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon__CombatObjectBase_{ REL::ID(1391216) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak__CombatObjectBase_{ REL::ID(450949) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm__CombatObjectBase_{ REL::ID(665478) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility__CombatObjectBase_{ REL::ID(22770) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight__CombatObjectBase_{ REL::ID(237292) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive__CombatObjectBase_{ REL::ID(153244) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze__CombatObjectBase_{ REL::ID(321305) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate__CombatObjectBase_{ REL::ID(535554) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore__CombatObjectBase_{ REL::ID(1307195) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript__CombatObjectBase_{ REL::ID(107450) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger__CombatObjectBase_{ REL::ID(879165) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon__CombatObjectBase_{ REL::ID(1093276) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect__CombatObjectBase_{ REL::ID(749694) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard__CombatObjectBase_{ REL::ID(1521533) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor__CombatObjectBase_{ REL::ID(1308812) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem__CombatObjectBase_{ REL::ID(1523150) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon__CombatObjectBase_{ REL::ID(154884) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak__CombatObjectBase_{ REL::ID(796995) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm__CombatObjectBase_{ REL::ID(1010597) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility__CombatObjectBase_{ REL::ID(368632) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight__CombatObjectBase_{ REL::ID(582901) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive__CombatObjectBase_{ REL::ID(498484) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze__CombatObjectBase_{ REL::ID(667116) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate__CombatObjectBase_{ REL::ID(880775) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore__CombatObjectBase_{ REL::ID(70664) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript__CombatObjectBase_{ REL::ID(452605) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger__CombatObjectBase_{ REL::ID(1224983) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon__CombatObjectBase_{ REL::ID(1438688) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect__CombatObjectBase_{ REL::ID(1094923) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard__CombatObjectBase_{ REL::ID(284492) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor__CombatObjectBase_{ REL::ID(618034) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem__CombatObjectBase_{ REL::ID(831943) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon__CombatObjectBase_{ REL::ID(1045958) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak__CombatObjectBase_{ REL::ID(105811) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm__CombatObjectBase_{ REL::ID(319701) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility__CombatObjectBase_{ REL::ID(1260060) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight__CombatObjectBase_{ REL::ID(1474253) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive__CombatObjectBase_{ REL::ID(1389582) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze__CombatObjectBase_{ REL::ID(1558308) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate__CombatObjectBase_{ REL::ID(190167) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore__CombatObjectBase_{ REL::ID(961709) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript__CombatObjectBase_{ REL::ID(1343942) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger__CombatObjectBase_{ REL::ID(533931) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon__CombatObjectBase_{ REL::ID(748037) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect__CombatObjectBase_{ REL::ID(403806) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard__CombatObjectBase_{ REL::ID(1175845) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemMelee_CombatObjectBase_{ REL::ID(386861) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemOneHandedBlock_CombatObjectBase_{ REL::ID(532287) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemRanged_CombatObjectBase_{ REL::ID(732767) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemShield_CombatObjectBase_{ REL::ID(186891) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemThrown_CombatObjectBase_{ REL::ID(1423191) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatInventoryItemTorch_CombatObjectBase_{ REL::ID(877536) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterArmor_CombatObjectBase_{ REL::ID(1509496) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterBoundItem_CombatObjectBase_{ REL::ID(140916) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterChameleon_CombatObjectBase_{ REL::ID(354815) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterCloak_CombatObjectBase_{ REL::ID(996779) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterDisarm_CombatObjectBase_{ REL::ID(1211260) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterInvisibility_CombatObjectBase_{ REL::ID(569133) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterLight_CombatObjectBase_{ REL::ID(783198) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterOffensive_CombatObjectBase_{ REL::ID(699293) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterParalyze_CombatObjectBase_{ REL::ID(866943) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterReanimate_CombatObjectBase_{ REL::ID(1081087) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterRestore_CombatObjectBase_{ REL::ID(270913) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterScript_CombatObjectBase_{ REL::ID(653407) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterStagger_CombatObjectBase_{ REL::ID(1424796) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterSummon_CombatObjectBase_{ REL::ID(56720) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterTargetEffect_CombatObjectBase_{ REL::ID(1295049) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMagicCasterWard_CombatObjectBase_{ REL::ID(484780) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMantlePathController_CombatObjectBase_{ REL::ID(67346) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMatchTargetAimController_CombatObjectBase_{ REL::ID(353009) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMeleeAimController_CombatObjectBase_{ REL::ID(898885) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMeleeDebugData_CombatObjectBase_{ REL::ID(829101) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatMovementRequestFollowActor_CombatObjectBase_{ REL::ID(1188200) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathMovementMessageEvent_CombatPathTeleportEvent__MovementMessage_{ REL::ID(843542) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1008408) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(718496) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(863200) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(6708) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(483810) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1014351) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(297410) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1132089) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(179859) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(361494) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(223139) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(491156) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(39771) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(660131) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(5067) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ REL::ID(821436) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(223316) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(955930) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1251258) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(623852) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(505970) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1272116) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1444250) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1298995) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(1428733) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(1574372) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1153743) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(573000) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1283643) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(992950) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(1138377) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(427452) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(137115) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(282313) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(561634) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(663310) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(372561) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(517867) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1244203) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(138295) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(669188) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1534504) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(786909) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1416199) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(15656) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1459860) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(145772) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1276742) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(314375) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1242609) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ REL::ID(475759) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1460046) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(610521) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(905577) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(278224) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(160643) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(926493) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1098873) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(953604) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(1083384) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(1228747) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(808495) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(227489) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(938104) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(647852) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(793185) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(82152) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(1373671) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(1519369) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(117251) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1408846) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(1554510) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(698744) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1174862) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(123235) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(988312) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(240940) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(870461) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1052635) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(913959) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1182316) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(731331) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1350637) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(697097) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ REL::ID(1512630) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(914148) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(64599) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(359684) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1314613) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1197094) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(380756) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(553247) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(407684) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(537853) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(683295) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(262549) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1263930) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(392342) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(101954) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(247209) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1118513) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(828186) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(973198) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1353882) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1063528) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(1209024) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(352656) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(829350) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1359709) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(643271) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1478007) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(525173) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(707615) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(568645) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(836848) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(385381) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor__CombatObjectBase_{ REL::ID(1005180) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(351053) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor__CombatObjectBase_{ REL::ID(1166887) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(568837) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(1301262) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(13870) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(969098) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone__CombatObjectBase_{ REL::ID(851409) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(35051) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone__CombatObjectBase_{ REL::ID(207673) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(62250) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(192503) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(337361) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1499708) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(918283) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor__CombatObjectBase_{ REL::ID(46757) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(1338493) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef__CombatObjectBase_{ REL::ID(1484298) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation__CombatObjectBase_{ REL::ID(773368) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations__CombatObjectBase_{ REL::ID(482586) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs__CombatObjectBase_{ REL::ID(628111) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingDebugData_CombatObjectBase_{ REL::ID(1202001) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestAdapter_BSPathingRequest_{ REL::ID(431070) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestCovered_BSPathingRequest_{ REL::ID(1140049) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(717405) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__BSPathingRequest_{ REL::ID(1247833) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__BSPathingRequest_{ REL::ID(530839) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(1364980) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(412592) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(595011) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(455861) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(724790) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(273174) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__BSPathingRequest_{ REL::ID(893069) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(238841) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(1054456) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(456029) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(1189040) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(1484572) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(856829) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__BSPathingRequest_{ REL::ID(739438) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__BSPathingRequest_{ REL::ID(1505563) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestMultiGoal_BSPathingRequest_{ REL::ID(777113) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingRequestStandard_BSPathingRequest_{ REL::ID(85908) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingSearchArea_CombatObjectBase_{ REL::ID(856327) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPathingTweener_CombatObjectBase_{ REL::ID(497948) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatPositionTracker_CombatObjectBase_{ REL::ID(377294) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatProjectileAimController_CombatObjectBase_{ REL::ID(1244507) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatProjectileDebugData_CombatObjectBase_{ REL::ID(699068) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatSearchLockData_BSPathingLockData_{ REL::ID(291744) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatSuppressiveFireBehavior_CombatObjectBase_{ REL::ID(248177) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetLocationSearchResult_CombatObjectBase_{ REL::ID(110627) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetLocationSearch_CombatObjectBase_{ REL::ID(1347193) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetLocation_CombatObjectBase_{ REL::ID(1001722) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetSelectorFixed_CombatObjectBase_{ REL::ID(496589) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetSelectorPreferred_CombatObjectBase_{ REL::ID(151332) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetSelectorRandom_CombatObjectBase_{ REL::ID(842240) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTargetSelectorStandard_CombatObjectBase_{ REL::ID(1387722) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatThreatExplosion_CombatObjectBase_{ REL::ID(880301) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatThreatLOF_CombatObjectBase_{ REL::ID(1571693) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatThreatMelee_CombatObjectBase_{ REL::ID(334668) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatThreatProjectile_CombatObjectBase_{ REL::ID(1226087) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTrackTargetAimController_CombatObjectBase_{ REL::ID(553599) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatTunnelPathController_CombatObjectBase_{ REL::ID(160423) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatViewControllerGlance_CombatObjectBase_{ REL::ID(903278) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatViewControllerPath_CombatObjectBase_{ REL::ID(1248976) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CombatViewControllerStandard_CombatObjectBase_{ REL::ID(557927) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(221984) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_CullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(912883) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DeathEmoteHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(571281) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DeathStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1051097) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DesyncInteractionHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1452668) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DisableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(941056) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DisableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1245468) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DisableCollisionHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1412488) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DiveBombPathController_CombatObjectBase_{ REL::ID(454171) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_DoNotInterruptAnimationHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(761767) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_EjectShellCasingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(4212) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_EnableCharacterBumperHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(595808) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_EnableCharacterPitchHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(899844) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_EnableCollisionHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1286614) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_EndSummonAnimationHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(579630) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FaceEmotionalIdleHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1343041) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightActionEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(302671) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightActionEntryEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1539647) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightActionGrabHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(428725) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightActionHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1413185) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightActionReleaseHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(555206) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightCrashLandStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(900554) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightCruisingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(656929) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightHoveringHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(783018) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightLandEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1287302) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightLandHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1161195) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightLandingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(908975) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightPerchingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1034928) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_FlightTakeOffHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(530674) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_GetUpEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(436338) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_GetUpStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(310469) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_GunDownStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(389175) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_HeadTrackingOffHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1371894) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_HeadTrackingOnHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1246192) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_HeadTrackingRotationOffHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1510894) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_HeadTrackingRotationOnHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1165172) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_HitFrameHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(379860) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_HolotapeLoadedHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1217384) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_IdleDialogueEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(134675) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_IdleDialogueExitHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(480122) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_IdleFlavorHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(273912) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_IndividualClipAnimationSpeedContour_AnimationSpeedContour_{ REL::ID(433434) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_InterruptCastHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(453109) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_JumpAnimEventHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(8037) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_KillActorHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(404303) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_KillMoveEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(193076) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_KillMoveStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(66676) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_KnockdownHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(257125) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_KnockdownTargetHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(383112) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_LeftHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1312377) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_LeftHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(495198) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_LoopingActivateHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1206575) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MotionDrivenHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(697679) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MountDismountEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(469212) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MountInteraction_RefrInteraction_{ REL::ID(564534) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementAgentActorAvoider_MovementAgent_{ REL::ID(506475) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementAgentActorState_MovementAgent_{ REL::ID(506233) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementAgentPathFollowerFlight_MovementAgent_{ REL::ID(1233442) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementAgentPathFollowerStandard_MovementAgent_{ REL::ID(1241017) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementAgentPathFollowerVirtual_MovementAgent_{ REL::ID(674178) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentAngleGain_MovementAgent_{ REL::ID(86848) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentAnglePassThrough_MovementAgent_{ REL::ID(890231) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentAnimationDriven_MovementAgent_{ REL::ID(1429654) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentDirectControl_MovementAgent_{ REL::ID(495697) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentDirectionPassThrough_MovementAgent_{ REL::ID(610563) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentGraphDrivenAnimationDriven_MovementAgent_{ REL::ID(1149976) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentPlayerControlsActionTrigger_MovementAgent_{ REL::ID(907107) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentPlayerControls_MovementAgent_{ REL::ID(749866) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentSpeedPassThrough_MovementAgent_{ REL::ID(1169943) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentSprintActionTrigger_MovementAgent_{ REL::ID(207823) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentStairsHelper_MovementAgent_{ REL::ID(133498) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentStandard_MovementAgent_{ REL::ID(1029250) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentStorePlannerOutput_MovementAgent_{ REL::ID(1355492) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerAgentStrafing_MovementAgent_{ REL::ID(1474463) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementHandlerArbiter_MovementArbiter_{ REL::ID(954098) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageActivateDoor_MovementMessage_{ REL::ID(1107904) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageActorCollision_MovementMessage_{ REL::ID(558697) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageBlocked_MovementMessage_{ REL::ID(62996) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageFreezeDirection_MovementMessage_{ REL::ID(1044223) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageJump_MovementMessage_{ REL::ID(68487) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageNewPath_MovementMessage_{ REL::ID(204013) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessagePathComplete_MovementMessage_{ REL::ID(549583) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessagePathFailed_MovementMessage_{ REL::ID(894942) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessagePlayIdle_MovementMessage_{ REL::ID(49194) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageSetStaticPath_MovementMessage_{ REL::ID(1445035) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageWarpToLocation_MovementMessage_{ REL::ID(435805) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementMessageWarpToMultiple_MovementMessage_{ REL::ID(249623) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementParametersFixed_IMovementParameters_{ REL::ID(759734) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementParameters_IMovementParameters_{ REL::ID(413785) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPathManagerAgentAvoidBox_MovementAgent_{ REL::ID(728525) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPathManagerAgentLoadedAreaMonitor_MovementAgent_{ REL::ID(98224) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPathManagerAgentStaticAvoider_MovementAgent_{ REL::ID(579106) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPathManagerArbiter_MovementArbiter_{ REL::ID(487037) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPlannerAgentDirectControl_MovementAgent_{ REL::ID(890319) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPlannerAgentNavmeshBounds_MovementAgent_{ REL::ID(835218) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPlannerAgentWarp_MovementAgent_{ REL::ID(895675) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPlannerArbiter_MovementArbiter_{ REL::ID(830549) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementPostUpdateArbiter_MovementArbiter_{ REL::ID(87571) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementStateFollowPath_MovementAgent_{ REL::ID(1130916) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementStateTweener_MovementAgent_{ REL::ID(720220) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementTweenerAgentFixedDelta_MovementAgent_{ REL::ID(896071) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementTweenerAgentNodeFollower_MovementAgent_{ REL::ID(1512771) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementTweenerAgentTargetPosAndVel_MovementAgent_{ REL::ID(804830) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_MovementTweenerArbiter_MovementArbiter_{ REL::ID(611057) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_NPCAttachHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(60470) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_NPCDetachHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(186930) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PairedAttackDialogueHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(863091) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PairedStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(318885) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PassengerInteraction_RefrInteraction_{ REL::ID(1479174) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingCell_BSPathingCell_{ REL::ID(1385187) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingDoor_BSPathingDoor_{ REL::ID(965706) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingLockData_BSPathingLockData_{ REL::ID(1237255) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestClosePoint_BSPathingRequest_{ REL::ID(277129) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestClosestGoal_BSPathingRequest_{ REL::ID(702562) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestCover_BSPathingRequest_{ REL::ID(235970) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFlee_BSPathingRequest_{ REL::ID(49223) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFlyAction_BSPathingRequest_{ REL::ID(1258671) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFlyHover_BSPathingRequest_{ REL::ID(1072011) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFlyLand_BSPathingRequest_{ REL::ID(885581) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFlyOrbit_BSPathingRequest_{ REL::ID(699564) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFlyTakeOff_BSPathingRequest_{ REL::ID(512543) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestFly_BSPathingRequest_{ REL::ID(1445073) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestHide_BSPathingRequest_{ REL::ID(765034) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestLOS_BSPathingRequest_{ REL::ID(578421) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestOptimalLocation_BSPathingRequest_{ REL::ID(391719) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestRotate_BSPathingRequest_{ REL::ID(644255) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestSafeStraightLine_BSPathingRequest_{ REL::ID(457245) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequestStopMoving_BSPathingRequest_{ REL::ID(710295) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PathingRequest_BSPathingRequest_{ REL::ID(1489710) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PerformActivationHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(399853) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PickNewIdleHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(924895) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PipboyBootSequenceHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(871455) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PitchOverrideEndHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(658598) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PitchOverrideStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(312766) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerBedEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1515346) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerChairEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1043372) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerFastEquipSoundHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1107054) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerFurnitureExitHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(58831) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerSightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(271651) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerSneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(860810) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_PlayerTerminalEnterHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1169589) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_QuestPathingRequest_BSPathingRequest_{ REL::ID(1185382) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RagdollAndGetUpHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(343238) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RagdollStartHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1327689) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ReadyStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(263165) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RecoilStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(369140) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ReevaluateGraphStateHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1332319) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RelaxedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1373548) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ReloadCompleteHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1381959) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ReloadStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1036545) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RemoveRagdollHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1201871) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RightHandSpellCastHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(75793) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_RightHandSpellFireHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(840875) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SandManKillHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(130919) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SightedStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1508596) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SneakStateChangeHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(735096) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SpeedSampledAnimationSpeedContour_AnimationSpeedContour_{ REL::ID(1484346) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_StaggeredStopHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(412629) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_StartFloatingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1538966) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_StartPCapVoiceHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1461104) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_StopFloatingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(82759) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_StopMountCameraHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1522975) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SubgraphAndOffsetDBData_BSAnimationDBData_{ REL::ID(611056) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SyncDeferDeathHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(509331) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_SyncEarlyExitHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(635667) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_UncullBoneHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(95714) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_UncullFurnitureBoneHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(567510) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_UncullWeaponsHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1038886) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_UpdateSightedHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(215962) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_UseStealthBoyHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(232712) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_UseStimpakHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(106517) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_VoiceSpellCastHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(421058) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_VoiceSpellFireHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1186412) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponAttachHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1208909) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponBeginDrawHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(547610) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponBeginSheatheHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(673768) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponDetachHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1334606) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponDrawHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1018831) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponFireHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(910605) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponSheatheHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1144987) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_WeaponSwingHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(1446997) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator_ZeroPitchHandler_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(784663) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator___MovementHandlerAgentAngleControllerLoadScrapper_MovementAgent_{ REL::ID(943560) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator___MovementHandlerAgentLargeDeltaLoadScrapper_MovementAgent_{ REL::ID(1289065) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator___MovementHandlerAgentTranslationControllerLoadScrapper_MovementAgent_{ REL::ID(52230) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator___MovementPlannerAgentHorseControlsLoadScrapper_MovementAgent_{ REL::ID(656626) };
+		inline constexpr std::array<REL::ID, 1> BSTDerivedCreator___MovementPlannerAgentKeepOffsetLoadScrapper_MovementAgent_{ REL::ID(1001706) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ActorCPMEvent_{ REL::ID(180709) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ActorEquipManagerEvent__Event_{ REL::ID(755888) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ActorInventoryEvent_{ REL::ID(1389215) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ActorItemEquipped__Event_{ REL::ID(1386018) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ActorKill__Event_{ REL::ID(849963) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ActorValueEvents__ActorValueChangedEvent_{ REL::ID(1413522) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_AnimationDataCleanupEvent_{ REL::ID(724607) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_AnimationDataSetupEvent_{ REL::ID(66189) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ApplyColorUpdateEvent_{ REL::ID(1223178) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_AssaultCrime__Event_{ REL::ID(1439227) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_AttachReference__Event_{ REL::ID(335199) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_AutoLoadDoorRolloverEvent_{ REL::ID(1163700) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSActorCellEvent_{ REL::ID(742135) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSActorDeathEvent_{ REL::ID(458491) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSAppPausedEvent_{ REL::ID(1166177) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSCollisionSoundEvent_{ REL::ID(734019) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSCombatImpactEvent_{ REL::ID(75611) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSEventProcessedEvent_{ REL::ID(598147) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSFootstepEvent_{ REL::ID(999448) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSHotloadCompletedEvent_{ REL::ID(850900) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSInventoryItemEvent__Event_{ REL::ID(1539991) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSInventoryListEvent__Event_{ REL::ID(226275) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSLocationLoadedEvent_{ REL::ID(1385183) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerCompanionDismiss_{ REL::ID(460928) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerCreateRobotEvent_{ REL::ID(1245677) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerEnterVertibirdEvent_{ REL::ID(1119325) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerFallLongDistances_{ REL::ID(195562) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerFireWeaponEvent_{ REL::ID(853359) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerHealTeammateEvent_{ REL::ID(1511770) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerModArmorWeaponEvent_{ REL::ID(587634) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerModRobotEvent_{ REL::ID(321319) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerSwimmingEvent_{ REL::ID(979380) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnPlayerUseWorkBenchEvent_{ REL::ID(55311) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSOnSpeechChallengeAvailable_{ REL::ID(713982) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSRadiationDamageEvent_{ REL::ID(1150862) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BGSSoundCategoryUtils__MenuCategoryVolumeChangedEvent_{ REL::ID(1248650) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSActiveGraphIfInactiveEvent_{ REL::ID(1150131) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSAnimationGraphEvent_{ REL::ID(1290145) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSAudioUtil__MasterVolumeChangedEvent_{ REL::ID(850759) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSCoreMessage__Event_{ REL::ID(1417901) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSMovementDataChangedEvent_{ REL::ID(1329106) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSMusicEvent_{ REL::ID(675368) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSPathEvent_{ REL::ID(930143) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSProceduralGeomEvent_{ REL::ID(1404402) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSResource__Archive2__ClearRegistryEvent_{ REL::ID(1446466) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSResource__Archive2__RegisteredEvent_{ REL::ID(1578764) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSResource__Archive2__StreamOpenedEvent_{ REL::ID(1118365) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSResource__ArchiveRegisteredEvent_{ REL::ID(1203819) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSResource__CacheEvent_{ REL::ID(1370296) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSResource__NameFoundEvent_{ REL::ID(1474745) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSScript__StatsEvent_{ REL::ID(1411575) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSStaticTriShapeDB__PSGRegisteredEvent_{ REL::ID(1312545) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSSubGraphActivationUpdate_{ REL::ID(405027) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTGlobalEvent__KillSDMEvent_{ REL::ID(989971) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_BlockPipboyOpeningEvent__{ REL::ID(344068) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_CanDisplayNextHUDMessage__{ REL::ID(1568822) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_CanDisplayNextHUDObjective__{ REL::ID(14986) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_CompanionMenuEnabled__{ REL::ID(415520) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ConditionBoyEvent__{ REL::ID(320315) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_CurrentRadiationSourceCount__{ REL::ID(1106257) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_CurrentRadsDisplayMagnitude__{ REL::ID(55959) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_CurrentRadsPercentOfLethal__{ REL::ID(1372046) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent__{ REL::ID(313396) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ExperienceMeterDisplayEvent__{ REL::ID(1408629) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ExplosiveIndicatorResultEvent__{ REL::ID(1075484) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_FaderMenuDisplayState__{ REL::ID(461495) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDCommmandModeEvent__{ REL::ID(1149734) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent__{ REL::ID(1132069) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDMessageDisplayDataEvent__{ REL::ID(1387243) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDNotificationDisplayEvent__{ REL::ID(624812) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDObjectiveDisplayEvent__{ REL::ID(1156655) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent__{ REL::ID(1074090) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDQuestVaultBoySwfName__{ REL::ID(890682) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDRolloverIsCrime__{ REL::ID(351727) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDRolloverStateEvent__{ REL::ID(883809) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDSubtitleDisplayEvent__{ REL::ID(826969) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HUDTutorialTextEvent__{ REL::ID(1422409) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_HasHUDMessagesEvent__{ REL::ID(252388) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_IsPipboyActiveEvent__{ REL::ID(1103428) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_MultiActivateUseRolloverEvent__{ REL::ID(742385) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ObjectivesInWayOfXP__{ REL::ID(1331565) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_PlayerActivatePickRefEvent__{ REL::ID(85927) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_PlayerActiveEffectIconsEvent__{ REL::ID(116824) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_PlayerAmmoCountEvent__{ REL::ID(865977) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_PlayerAutoAimActorEvent__{ REL::ID(84434) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_PlayerCommandTypeEvent__{ REL::ID(350195) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_PlayerCrosshairModeEvent__{ REL::ID(617981) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_QuickContainerStateEvent__{ REL::ID(876056) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_RolloverSuppressedEvent__{ REL::ID(610313) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_SaveLoadMessageStringEvent__{ REL::ID(726646) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim__{ REL::ID(1534428) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingExperienceEvent__{ REL::ID(358462) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent__{ REL::ID(1565356) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingLongSubtitleEvent__{ REL::ID(763322) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingPerkVaultBoyState__{ REL::ID(37389) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingVATSCritAnim__{ REL::ID(1536064) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ShowingWideSubtitleEvent__{ REL::ID(497020) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTValueRequestEvent_ViewCasterUpdateEvent__{ REL::ID(145785) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSThreadEvent__ThreadEvent_{ REL::ID(1553618) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSTransformDeltaEvent_{ REL::ID(1033259) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BSXAudio2StreamEvent_{ REL::ID(745234) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BeamProjectileImpactEvent_{ REL::ID(1200751) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BinkMovieStoppedPlayingEvent_{ REL::ID(948615) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Bleedout__Event_{ REL::ID(790148) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BlockPipboyOpeningEvent_{ REL::ID(1528587) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BlurEvent_{ REL::ID(315429) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BobbleheadCollected__Event_{ REL::ID(123092) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_BooksRead__Event_{ REL::ID(443828) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ButtonBarMenuUpdateEvent_{ REL::ID(1434076) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CanDisplayNextHUDMessage_{ REL::ID(1121327) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CanDisplayNextHUDObjective_{ REL::ID(92665) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CellAttachDetachEvent_{ REL::ID(941249) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ChargenCharacterUpdateEvent_{ REL::ID(714128) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ChestLooted__Event_{ REL::ID(178292) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ClearHUDMessagesEvent_{ REL::ID(1176494) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ClearQuickContainerEvent_{ REL::ID(218137) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ColorUpdateEvent_{ REL::ID(600313) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CompanionMenuEnabled_{ REL::ID(631842) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ConditionBoyEvent_{ REL::ID(141077) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ControlsRemappedEvent_{ REL::ID(273158) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CorpseEaten__Event_{ REL::ID(655383) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CriticalHitEvent__Event_{ REL::ID(682994) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CurrentRadiationSourceCount_{ REL::ID(244864) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CurrentRadsDisplayMagnitude_{ REL::ID(615691) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CurrentRadsPercentOfLethal_{ REL::ID(780828) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_CustomMarkerUpdate__Event_{ REL::ID(1133897) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_DaysPassed__Event_{ REL::ID(948555) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_DefaultObjectsReadyEvent__Event_{ REL::ID(1239745) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_DirectionalHitIndicatorResultEvent_{ REL::ID(203713) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_DisarmedEvent__Event_{ REL::ID(416379) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_DisplayFatigueWarningEvent_{ REL::ID(1547253) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_DoBeforeNewOrLoadCompletedEvent_{ REL::ID(334179) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_EndLoadGameEvent_{ REL::ID(1040936) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ExitPowerArmor__Event_{ REL::ID(1434750) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ExperienceMeterDisplayEvent_{ REL::ID(52677) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ExplosiveIndicatorResultEvent_{ REL::ID(562939) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_FaderMenuDisplayState_{ REL::ID(459928) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_FatmanDeaths__Event_{ REL::ID(1480942) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_FavoriteMgr_Events__ComponentFavoriteEvent_{ REL::ID(615870) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_FirstThirdPersonSwitch__Event_{ REL::ID(863814) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_FusionCoreConsumed__Event_{ REL::ID(1242258) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_FusionCoreEjected__Event_{ REL::ID(975956) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDEnemyHealthDisplayEvent_{ REL::ID(1270473) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDExperienceUpdateEvent_{ REL::ID(106437) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDExplosiveAmmoCounterData_{ REL::ID(813396) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDInventoryChangeMessageEvent_{ REL::ID(71295) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDMessageDisplayDataEvent_{ REL::ID(1036454) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDModeEvent_{ REL::ID(1237668) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDNotificationDisplayEvent_{ REL::ID(440228) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDNotificationEvent_{ REL::ID(764748) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDObjectiveDisplayEvent_{ REL::ID(1065633) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDPerkVaultBoyData_{ REL::ID(415763) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDPerkVaultBoySwfDisplayEvent_{ REL::ID(1353673) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDQuestVaultBoySwfName_{ REL::ID(1302468) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDReinitializedEvent_{ REL::ID(1429419) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDRolloverIsCrime_{ REL::ID(653864) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDRolloverStateEvent_{ REL::ID(906047) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDSubtitleDisplayEvent_{ REL::ID(1029011) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HUDTutorialTextEvent_{ REL::ID(315949) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HasHUDMessagesEvent_{ REL::ID(855403) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HolotapeChatterEvent_{ REL::ID(1221667) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HolotapePlayEvent_{ REL::ID(297069) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HolotapeStateChanged__Event_{ REL::ID(881639) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HourPassed__Event_{ REL::ID(336000) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_HoursPassed__Event_{ REL::ID(1214858) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_IdleInputEvent_{ REL::ID(711356) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InputEnableLayerDestroyedEvent_{ REL::ID(487601) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InvInterfaceStateChangeEvent_{ REL::ID(49152) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InventoryInterface__CountChangedEvent_{ REL::ID(1494698) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InventoryInterface__FavoriteChangedEvent_{ REL::ID(223764) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InventoryKill__Event_{ REL::ID(962258) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InventoryUpdateEvent_{ REL::ID(365547) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_InvestmentMade__Event_{ REL::ID(375333) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_IsPipboyActiveEvent_{ REL::ID(1394177) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ItemCrafted__Event_{ REL::ID(669050) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ItemPickpocketed__Event_{ REL::ID(1466955) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ItemSteal__Event_{ REL::ID(934808) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_JunkItemFound__Event_{ REL::ID(1228445) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LevelIncrease__Event_{ REL::ID(602110) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LoadingStatusChanged__Event_{ REL::ID(196355) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocalMapCameraUpdate__Event_{ REL::ID(867754) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocalMapPostRendered__Event_{ REL::ID(879588) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocalMapRendered__Event_{ REL::ID(221648) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocationCleared__Event_{ REL::ID(641562) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocationLinked__Event_{ REL::ID(131742) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocationMarkerArrayUpdate__Event_{ REL::ID(210006) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LocksPicked__Event_{ REL::ID(907361) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_LooksMenuEvent_{ REL::ID(1536493) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MainStatus__StageEvent_{ REL::ID(303110) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MeleeAttackJustReleasedEvent_{ REL::ID(1502300) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MenuModeChangeEvent_{ REL::ID(1407944) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MenuModeCounterChangedEvent_{ REL::ID(856277) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MenuOpenCloseEvent_{ REL::ID(743567) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MineDisarmed__Event_{ REL::ID(1453222) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MovementMessageUpdateRequestImmediate_{ REL::ID(44518) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MultiActivateUseRolloverEvent_{ REL::ID(640247) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MurderCrime__Event_{ REL::ID(1173356) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_MysteriousStrangerVisits__Event_{ REL::ID(1187122) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ObjectiveState__Event_{ REL::ID(430089) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_OnCompanionDisconnected__Event_{ REL::ID(1411450) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_OpenContainerMenuEventData_{ REL::ID(484009) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_OtherEventEnabledEvent_{ REL::ID(928936) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PerkAdded__Event_{ REL::ID(810141) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PerkPointIncreaseEvent_{ REL::ID(1260197) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PerkValueEvents__PerkEntryUpdatedEvent_{ REL::ID(489515) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PerkValueEvents__PerkValueChangedEvent_{ REL::ID(1147670) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PickRefStateChangedEvent_{ REL::ID(113332) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PickRefUpdateEvent_{ REL::ID(84068) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PipboyLightEvent_{ REL::ID(510816) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PipboyValueChangedEvent_{ REL::ID(755456) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerActivatePickRefEvent_{ REL::ID(81935) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerActiveEffectChanged__Event_{ REL::ID(382805) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerActiveEffectIconsEvent_{ REL::ID(456728) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerAddicted__Event_{ REL::ID(710609) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerAmmoCountEvent_{ REL::ID(388183) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerAutoAimActorEvent_{ REL::ID(347772) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerCharacterQuestEvent__Event_{ REL::ID(475748) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerCommandTypeEvent_{ REL::ID(897683) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerCrosshairModeEvent_{ REL::ID(1438417) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerDifficultySettingChanged__Event_{ REL::ID(1273932) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerInDialogueChanged__Event_{ REL::ID(1120112) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerLifeStateChanged__Event_{ REL::ID(461747) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerSetWeaponStateEvent_{ REL::ID(1172507) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerUpdateEvent_{ REL::ID(83817) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PlayerWeaponReloadEvent_{ REL::ID(122255) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PositionPlayerEvent_{ REL::ID(194625) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PowerArmorLightData_{ REL::ID(1327774) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_PreloadPowerArmor__Event_{ REL::ID(777077) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ProjectileBeginUpdateEvent_{ REL::ID(956928) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_QuestStatus__Event_{ REL::ID(696733) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_QueueSurvivalBumpDownMessage_{ REL::ID(68227) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_QuickContainerStateEvent_{ REL::ID(539286) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_QuickContainerStateRequiresUpdate_{ REL::ID(99629) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RadioManager__PipboyFrequencyDetectionEvent_{ REL::ID(70113) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RadioManager__PipboyRadioTuningEvent_{ REL::ID(728467) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RadioManager__PipboyTransmitterDetectionEvent_{ REL::ID(1371391) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RequestHUDModesEvent_{ REL::ID(1289688) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RevertPlayerCharacterEvent_{ REL::ID(1258378) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RicochetHit__Event_{ REL::ID(109372) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_RolloverSuppressedEvent_{ REL::ID(1415670) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_SFRendererInitializedEvent_{ REL::ID(1211996) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_SPECIALMenuEvent__NameChangedEvent_{ REL::ID(993866) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_SandmanKill__Event_{ REL::ID(388984) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_SaveLoadMessageStringEvent_{ REL::ID(510174) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_SaveLoadMessageTypeEvent_{ REL::ID(991999) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowHUDMessageEvent_{ REL::ID(729651) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingDialogueSpeechChallengeAnim_{ REL::ID(276117) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingExperienceEvent_{ REL::ID(799908) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingFeaturedItemVaultBoyEvent_{ REL::ID(770752) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingLongSubtitleEvent_{ REL::ID(1369476) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingPerkVaultBoyState_{ REL::ID(808299) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingVATSCritAnim_{ REL::ID(542372) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ShowingWideSubtitleEvent_{ REL::ID(577897) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_SpeechChallengeSucceeded__Event_{ REL::ID(150713) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESActivateEvent_{ REL::ID(1105619) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESActiveEffectApplyRemoveEvent_{ REL::ID(447252) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESActorLocationChangeEvent_{ REL::ID(181726) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESBookReadEvent_{ REL::ID(839655) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCellAttachDetachEvent_{ REL::ID(1498150) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCellFullyLoadedEvent_{ REL::ID(573779) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCellReadyToApplyDecalsEvent_{ REL::ID(229267) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCombatEvent_{ REL::ID(1231898) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCommandModeCompleteCommandEvent_{ REL::ID(307611) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCommandModeEnterEvent_{ REL::ID(379337) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCommandModeExitEvent_{ REL::ID(1037389) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESCommandModeGiveCommandEvent_{ REL::ID(965700) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESConsciousnessEvent_{ REL::ID(1484380) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESContainerChangedEvent_{ REL::ID(1142129) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESDataHandlerPostBuildFileListEvent_{ REL::ID(279475) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESDeathEvent_{ REL::ID(32427) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESDeferredKillEvent_{ REL::ID(41456) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESDestructionStageChangedEvent_{ REL::ID(397696) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESEnterBleedoutEvent_{ REL::ID(700233) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESEnterSneakingEvent_{ REL::ID(1357634) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESEquipEvent_{ REL::ID(955402) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESEscortWaitStartEvent_{ REL::ID(433471) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESEscortWaitStopEvent_{ REL::ID(1091869) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESExitFurnitureEvent_{ REL::ID(167997) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESFormDeleteEvent_{ REL::ID(1145739) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESFormIDRemapEvent_{ REL::ID(221805) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESFurnitureEvent_{ REL::ID(993090) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESGrabReleaseEvent_{ REL::ID(825960) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESHarvestEvent__ItemHarvested_{ REL::ID(1055866) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESHitEvent_{ REL::ID(1484588) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESInitScriptEvent_{ REL::ID(879709) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESLimbCrippleEvent_{ REL::ID(560021) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESLoadGameEvent_{ REL::ID(725179) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESLocationClearedEvent_{ REL::ID(1526310) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESLockChangedEvent_{ REL::ID(1218312) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESMagicEffectApplyEvent_{ REL::ID(492687) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESObjectLoadedEvent_{ REL::ID(293670) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESObjectREFRTranslationEvent_{ REL::ID(952028) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESOnPCDialogueTargetEvent_{ REL::ID(27485) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESOpenCloseEvent_{ REL::ID(1321762) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESPackageEvent_{ REL::ID(942255) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESPerkEntryRunEvent_{ REL::ID(17768) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESPickNewIdleEvent_{ REL::ID(261707) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESPickpocketFailedEvent_{ REL::ID(686359) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESQuestEvent__Event_{ REL::ID(1399805) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESQuestInitEvent_{ REL::ID(1343958) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESQuestStageEvent_{ REL::ID(676640) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESQuestStageItemDoneEvent_{ REL::ID(935430) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESQuestStartStopEvent_{ REL::ID(763019) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESResetEvent_{ REL::ID(419874) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESResolveNPCTemplatesEvent_{ REL::ID(1538095) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSceneActionEvent_{ REL::ID(1334217) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSceneEvent_{ REL::ID(410130) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESScenePhaseEvent_{ REL::ID(1068330) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSellEvent_{ REL::ID(1078076) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSleepStartEvent_{ REL::ID(99263) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSleepStopEvent_{ REL::ID(757693) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSpellCastEvent_{ REL::ID(829406) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESSwitchRaceCompleteEvent_{ REL::ID(154213) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESTopicInfoEvent_{ REL::ID(144287) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESTrackedStatsEvent_{ REL::ID(349587) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESTrapHitEvent_{ REL::ID(812288) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESTriggerEnterEvent_{ REL::ID(233830) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESTriggerLeaveEvent_{ REL::ID(891894) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESUniqueIDChangeEvent_{ REL::ID(613954) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESWaitStartEvent_{ REL::ID(1415337) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TESWaitStopEvent_{ REL::ID(491292) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TerminalHacked__Event_{ REL::ID(1200978) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TerminalMenuItemRunEvent_{ REL::ID(284143) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TravelMarkerStateChange__Event_{ REL::ID(1007706) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Trespass__Event_{ REL::ID(164444) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_TutorialEvent_{ REL::ID(612329) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_UIAdvanceMenusFunctionCompleteEvent_{ REL::ID(665902) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_UserEventEnabledEvent_{ REL::ID(1035947) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_VATSCommandTargetEvent_{ REL::ID(614037) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_VATSCommand_{ REL::ID(471970) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_VATSEvents__ModeChange_{ REL::ID(1396127) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_VATSForcedEnemyHealthPercentEvent_{ REL::ID(1397945) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_ViewCasterUpdateEvent_{ REL::ID(78240) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_WeaponFiredEvent_{ REL::ID(733486) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_WorkshopNPCTransferEvent_{ REL::ID(13688) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__BuildableAreaEvent_{ REL::ID(111932) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__ItemDestroyedEvent_{ REL::ID(142414) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__ItemGrabbedEvent_{ REL::ID(1204478) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__ItemMovedEvent_{ REL::ID(1470476) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__ItemPlacedEvent_{ REL::ID(136807) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__ItemRepairedEvent_{ REL::ID(546392) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__ItemScrappedEvent_{ REL::ID(402688) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__PlacementStatusEvent_{ REL::ID(770234) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__PowerOffEvent_{ REL::ID(280111) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__PowerOnEvent_{ REL::ID(938199) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_Workshop__WorkshopModeEvent_{ REL::ID(854222) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_bhkCharacterMoveFinishEvent_{ REL::ID(1063236) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_bhkCharacterStateChangeEvent_{ REL::ID(797516) };
+		inline constexpr std::array<REL::ID, 1> BSTEventSink_bhkNonSupportContactEvent_{ REL::ID(139108) };
+		inline constexpr std::array<REL::ID, 1> BSTFreeList_ActorMovementMessageMap_16___RawMessageHandlerWrapperType_{ REL::ID(373896) };
+		inline constexpr std::array<REL::ID, 1> BSTFreeList_BSScript__Internal__FunctionMessage_{ REL::ID(1552458) };
+		inline constexpr std::array<REL::ID, 1> BSTFreeList_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ REL::ID(1271990) };
+		inline constexpr std::array<REL::ID, 1> BSTFunction_ButtonHintBar_{ REL::ID(54079) };
+		inline constexpr std::array<REL::ID, 1> BSTFunction_ButtonHintDataWithClone_{ REL::ID(1266968) };
+		inline constexpr std::array<REL::ID, 1> BSTFunction_FlashHitIndicator_{ REL::ID(505717) };
+		inline constexpr std::array<REL::ID, 1> BSTFunction_HUDActorValueMeterBase_{ REL::ID(262108) };
+		inline constexpr std::array<REL::ID, 1> BSTFunction_HUDPerkVaultBoy_{ REL::ID(775473) };
+		inline constexpr std::array<REL::ID, 1> BSTFunction_VATSMenuPrivate__VatsMenuObj_{ REL::ID(1555219) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent{ REL::ID(670432) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_AnimationDataCleanupEvent_{ REL::ID(1289112) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_AnimationDataSetupEvent_{ REL::ID(631252) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ApplyColorUpdateEvent_{ REL::ID(910369) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_AutoLoadDoorRolloverEvent_{ REL::ID(1027245) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BGSAppPausedEvent_{ REL::ID(982449) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_AutoLoadDoorRolloverEvent__{ REL::ID(510874) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_BlockPipboyOpeningEvent__{ REL::ID(755693) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDMessage__{ REL::ID(271579) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_CanDisplayNextHUDObjective__{ REL::ID(1494063) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_CompanionMenuEnabled__{ REL::ID(244911) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ConditionBoyEvent__{ REL::ID(1342958) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ControlsRemappedEvent__{ REL::ID(1435513) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadiationSourceCount__{ REL::ID(560681) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsDisplayMagnitude__{ REL::ID(821231) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_CurrentRadsPercentOfLethal__{ REL::ID(594322) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_DirectionalHitIndicatorResultEvent__{ REL::ID(1536577) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_DisplayFatigueWarningEvent__{ REL::ID(1094651) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExperienceMeterDisplayEvent__{ REL::ID(211906) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ExplosiveIndicatorResultEvent__{ REL::ID(231005) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_FaderMenuDisplayState__{ REL::ID(951053) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDCommmandModeEvent__{ REL::ID(1295002) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDEnemyHealthDisplayEvent__{ REL::ID(1476328) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDMessageDisplayDataEvent__{ REL::ID(1321536) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDNotificationDisplayEvent__{ REL::ID(1101688) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDObjectiveDisplayEvent__{ REL::ID(443231) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDPerkVaultBoySwfDisplayEvent__{ REL::ID(682415) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDQuestVaultBoySwfName__{ REL::ID(4839) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDReinitializedEvent__{ REL::ID(1434803) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverIsCrime__{ REL::ID(373759) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDRolloverStateEvent__{ REL::ID(626463) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDSubtitleDisplayEvent__{ REL::ID(296672) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HUDTutorialTextEvent__{ REL::ID(1367328) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_HasHUDMessagesEvent__{ REL::ID(1195658) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_InventoryUpdateEvent__{ REL::ID(1561379) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_IsPipboyActiveEvent__{ REL::ID(489330) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_MultiActivateUseRolloverEvent__{ REL::ID(360137) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ObjectivesInWayOfXP__{ REL::ID(1523817) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PickRefStateChangedEvent__{ REL::ID(118685) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PipboyLightEvent__{ REL::ID(1354516) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActivatePickRefEvent__{ REL::ID(559063) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerActiveEffectIconsEvent__{ REL::ID(662887) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAmmoCountEvent__{ REL::ID(94740) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerAutoAimActorEvent__{ REL::ID(432478) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCommandTypeEvent__{ REL::ID(1042815) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerCrosshairModeEvent__{ REL::ID(1144902) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerSetWeaponStateEvent__{ REL::ID(878907) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_PlayerWeaponReloadEvent__{ REL::ID(1410783) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateEvent__{ REL::ID(1043510) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_QuickContainerStateRequiresUpdate__{ REL::ID(637171) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_RolloverSuppressedEvent__{ REL::ID(97276) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_SaveLoadMessageStringEvent__{ REL::ID(26457) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingDialogueSpeechChallengeAnim__{ REL::ID(136216) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingExperienceEvent__{ REL::ID(177693) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingFeaturedItemVaultBoyEvent__{ REL::ID(1055636) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingLongSubtitleEvent__{ REL::ID(903503) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingPerkVaultBoyState__{ REL::ID(947956) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingVATSCritAnim__{ REL::ID(402064) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ShowingWideSubtitleEvent__{ REL::ID(956210) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSCommandTargetEvent__{ REL::ID(166947) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_VATSForcedEnemyHealthPercentEvent__{ REL::ID(292677) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BSTValueRequestEvent_ViewCasterUpdateEvent__{ REL::ID(1481518) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BinkMovieStoppedPlayingEvent_{ REL::ID(1060958) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BlockPipboyOpeningEvent_{ REL::ID(223564) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_BlurEvent_{ REL::ID(708021) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ButtonBarMenuUpdateEvent_{ REL::ID(1566072) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_CanDisplayNextHUDMessage_{ REL::ID(131521) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_CanDisplayNextHUDObjective_{ REL::ID(835646) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ClearHUDMessagesEvent_{ REL::ID(537631) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ClearQuickContainerEvent_{ REL::ID(369219) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ColorUpdateEvent_{ REL::ID(699239) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_CompanionMenuEnabled_{ REL::ID(366724) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ConditionBoyEvent_{ REL::ID(418857) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ControlsRemappedEvent_{ REL::ID(777816) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_CurrentRadiationSourceCount_{ REL::ID(1218953) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_CurrentRadsDisplayMagnitude_{ REL::ID(1479658) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_CurrentRadsPercentOfLethal_{ REL::ID(1252368) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_DirectionalHitIndicatorResultEvent_{ REL::ID(612405) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_DisplayFatigueWarningEvent_{ REL::ID(436250) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_DoBeforeNewOrLoadCompletedEvent_{ REL::ID(964743) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_EndLoadGameEvent_{ REL::ID(682206) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ExperienceMeterDisplayEvent_{ REL::ID(1135811) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ExplosiveIndicatorResultEvent_{ REL::ID(889034) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_FaderMenuDisplayState_{ REL::ID(685353) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDCommmandModeEvent_{ REL::ID(370896) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDEnemyHealthDisplayEvent_{ REL::ID(817987) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDExperienceUpdateEvent_{ REL::ID(51273) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDExplosiveAmmoCounterData_{ REL::ID(360619) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDInventoryChangeMessageEvent_{ REL::ID(1373446) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDMessageDisplayDataEvent_{ REL::ID(663795) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDModeEvent_{ REL::ID(878205) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDNotificationDisplayEvent_{ REL::ID(303514) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDNotificationEvent_{ REL::ID(710018) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDObjectiveDisplayEvent_{ REL::ID(1227891) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDPerkVaultBoyData_{ REL::ID(668442) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDPerkVaultBoySwfDisplayEvent_{ REL::ID(23437) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDQuestVaultBoySwfName_{ REL::ID(929514) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDReinitializedEvent_{ REL::ID(777130) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDRolloverIsCrime_{ REL::ID(1297852) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDRolloverStateEvent_{ REL::ID(1550505) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDSubtitleDisplayEvent_{ REL::ID(955017) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HUDTutorialTextEvent_{ REL::ID(569756) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_HasHUDMessagesEvent_{ REL::ID(789924) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_InventoryUpdateEvent_{ REL::ID(903008) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_IsPipboyActiveEvent_{ REL::ID(1413334) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_MeleeAttackJustReleasedEvent_{ REL::ID(1222427) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_MultiActivateUseRolloverEvent_{ REL::ID(1284387) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ObjectivesInWayOfXP_{ REL::ID(599615) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_OpenContainerMenuEventData_{ REL::ID(363164) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PerkPointIncreaseEvent_{ REL::ID(622830) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PickRefStateChangedEvent_{ REL::ID(602845) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PipboyLightEvent_{ REL::ID(384647) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerActivatePickRefEvent_{ REL::ID(1483374) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerActiveEffectIconsEvent_{ REL::ID(1320645) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerAmmoCountEvent_{ REL::ID(1018746) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerAutoAimActorEvent_{ REL::ID(824949) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerCommandTypeEvent_{ REL::ID(1169024) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerCrosshairModeEvent_{ REL::ID(486791) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerSetWeaponStateEvent_{ REL::ID(220960) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerUpdateEvent_{ REL::ID(200940) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PlayerWeaponReloadEvent_{ REL::ID(753135) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_PowerArmorLightData_{ REL::ID(697003) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_QueueSurvivalBumpDownMessage_{ REL::ID(1356619) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_QuickContainerStateEvent_{ REL::ID(119385) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_QuickContainerStateRequiresUpdate_{ REL::ID(1021306) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_RequestHUDModesEvent_{ REL::ID(38275) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_RevertPlayerCharacterEvent_{ REL::ID(40443) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_RolloverSuppressedEvent_{ REL::ID(1147488) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_SaveLoadMessageStringEvent_{ REL::ID(1077086) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_SaveLoadMessageTypeEvent_{ REL::ID(306573) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowHUDMessageEvent_{ REL::ID(449273) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingDialogueSpeechChallengeAnim_{ REL::ID(1060273) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingExperienceEvent_{ REL::ID(961660) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingFeaturedItemVaultBoyEvent_{ REL::ID(397480) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingLongSubtitleEvent_{ REL::ID(245412) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingPerkVaultBoyState_{ REL::ID(1339876) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingVATSCritAnim_{ REL::ID(1326183) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ShowingWideSubtitleEvent_{ REL::ID(297870) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_UIAdvanceMenusFunctionCompleteEvent_{ REL::ID(1562567) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_VATSCommandTargetEvent_{ REL::ID(1090832) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_VATSForcedEnemyHealthPercentEvent_{ REL::ID(1217295) };
+		inline constexpr std::array<REL::ID, 1> BSTGlobalEvent__EventSource_ViewCasterUpdateEvent_{ REL::ID(557221) };
+		inline constexpr std::array<REL::ID, 1> BSTIOStream__TIStream_BSIOStreamTraits_{ REL::ID(1165280) };
+		inline constexpr std::array<REL::ID, 1> BSTIOStream__TOStream_BSIOStreamTraits_{ REL::ID(460122) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BGSCombinedCellGeometryDB__ModelDB__DBTraits__StorageType_{ REL::ID(1416540) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BGSCombinedCellGeometryDB__PreloadTask__PreloadRequest_{ REL::ID(1290633) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BGSDecalManager__PendingSkinnedDecal_{ REL::ID(1049197) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BGSSaveLoadThread__AsyncRequest_{ REL::ID(1504285) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BSFaceGenManager__PendingCustomizationData_{ REL::ID(1329812) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BSPackedTask_{ REL::ID(201817) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BSScript__Internal__FunctionMessage_{ REL::ID(847508) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BSScript__Internal__SuspendedStack_{ REL::ID(1146380) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__{ REL::ID(567325) };
+		inline constexpr std::array<REL::ID, 1> BSTMessageQueue_NiPointer_NiAVObject__{ REL::ID(905117) };
+		inline constexpr std::array<REL::ID, 2> BSTObjectDictionary_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_ResponseDefinitionMissPolicy_PreloadResponsesInitializationPolicy_{ REL::ID(1402776), REL::ID(259384) };
+		inline constexpr std::array<REL::ID, 2> BSTObjectDictionary_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_HandlerCreationMissPolicy_NoInitializationPolicy_{ REL::ID(1230249), REL::ID(86675) };
+		inline constexpr std::array<REL::ID, 1> BSTStaticFreeList_ActorMovementMessageMap_16___RawMessageHandlerWrapperType_16_{ REL::ID(1471016) };
+		inline constexpr std::array<REL::ID, 1> BSTStaticFreeList_BSScript__Internal__FunctionMessage_1024_{ REL::ID(408687) };
+		inline constexpr std::array<REL::ID, 1> BSTStaticFreeList_BSTSmartPointer_GameScript__DelayFunctor_BSTSmartPointerIntrusiveRefCount__512_{ REL::ID(128414) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_AutoLoadDoorRolloverEvent_{ REL::ID(239524) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_BlockPipboyOpeningEvent_{ REL::ID(604378) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_CanDisplayNextHUDMessage_{ REL::ID(197515) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_CanDisplayNextHUDObjective_{ REL::ID(751023) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_CompanionMenuEnabled_{ REL::ID(1289737) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ConditionBoyEvent_{ REL::ID(799436) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ControlsRemappedEvent_{ REL::ID(931176) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_CurrentRadiationSourceCount_{ REL::ID(902949) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_CurrentRadsDisplayMagnitude_{ REL::ID(1273735) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_CurrentRadsPercentOfLethal_{ REL::ID(1438644) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_DirectionalHitIndicatorResultEvent_{ REL::ID(861587) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_DisplayFatigueWarningEvent_{ REL::ID(623131) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ExperienceMeterDisplayEvent_{ REL::ID(711388) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ExplosiveIndicatorResultEvent_{ REL::ID(1221209) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_FaderMenuDisplayState_{ REL::ID(1118324) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDEnemyHealthDisplayEvent_{ REL::ID(346131) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDMessageDisplayDataEvent_{ REL::ID(112434) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDNotificationDisplayEvent_{ REL::ID(1098675) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDObjectiveDisplayEvent_{ REL::ID(141551) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDPerkVaultBoySwfDisplayEvent_{ REL::ID(429515) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDQuestVaultBoySwfName_{ REL::ID(378436) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDReinitializedEvent_{ REL::ID(505508) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDRolloverIsCrime_{ REL::ID(1311587) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDRolloverStateEvent_{ REL::ID(1564448) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDSubtitleDisplayEvent_{ REL::ID(105062) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HUDTutorialTextEvent_{ REL::ID(973915) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_HasHUDMessagesEvent_{ REL::ID(1513858) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_InventoryUpdateEvent_{ REL::ID(1023600) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_IsPipboyActiveEvent_{ REL::ID(470079) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_MultiActivateUseRolloverEvent_{ REL::ID(1298071) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PickRefStateChangedEvent_{ REL::ID(771699) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PipboyLightEvent_{ REL::ID(1168972) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerActivatePickRefEvent_{ REL::ID(740332) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerActiveEffectIconsEvent_{ REL::ID(1115090) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerAmmoCountEvent_{ REL::ID(1046382) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerAutoAimActorEvent_{ REL::ID(1005862) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerCommandTypeEvent_{ REL::ID(1555916) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerCrosshairModeEvent_{ REL::ID(514389) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerSetWeaponStateEvent_{ REL::ID(248429) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_PlayerWeaponReloadEvent_{ REL::ID(780616) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_QuickContainerStateEvent_{ REL::ID(1197344) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_QuickContainerStateRequiresUpdate_{ REL::ID(758023) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_RolloverSuppressedEvent_{ REL::ID(491618) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_SaveLoadMessageStringEvent_{ REL::ID(1168321) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingDialogueSpeechChallengeAnim_{ REL::ID(934187) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingExperienceEvent_{ REL::ID(1457924) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingFeaturedItemVaultBoyEvent_{ REL::ID(1428518) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingLongSubtitleEvent_{ REL::ID(445305) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingPerkVaultBoyState_{ REL::ID(1466353) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingVATSCritAnim_{ REL::ID(1200366) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ShowingWideSubtitleEvent_{ REL::ID(1236072) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_VATSCommandTargetEvent_{ REL::ID(1272077) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_VATSForcedEnemyHealthPercentEvent_{ REL::ID(473959) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSink_ViewCasterUpdateEvent_{ REL::ID(736650) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_BlockPipboyOpeningEvent_{ REL::ID(1002158) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_CanDisplayNextHUDMessage_{ REL::ID(644677) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_CanDisplayNextHUDObjective_{ REL::ID(673912) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_CompanionMenuEnabled_{ REL::ID(1073820) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ConditionBoyEvent_{ REL::ID(978383) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_CurrentRadiationSourceCount_{ REL::ID(182355) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_CurrentRadsDisplayMagnitude_{ REL::ID(714611) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_CurrentRadsPercentOfLethal_{ REL::ID(447910) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_DirectionalHitIndicatorResultEvent_{ REL::ID(971411) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ExperienceMeterDisplayEvent_{ REL::ID(484725) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ExplosiveIndicatorResultEvent_{ REL::ID(151525) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_FaderMenuDisplayState_{ REL::ID(1119887) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDCommmandModeEvent_{ REL::ID(225889) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDEnemyHealthDisplayEvent_{ REL::ID(208196) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDMessageDisplayDataEvent_{ REL::ID(462984) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDNotificationDisplayEvent_{ REL::ID(1282721) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDObjectiveDisplayEvent_{ REL::ID(232613) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDPerkVaultBoySwfDisplayEvent_{ REL::ID(150091) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDQuestVaultBoySwfName_{ REL::ID(1548888) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDRolloverIsCrime_{ REL::ID(1009835) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDRolloverStateEvent_{ REL::ID(1542085) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDSubtitleDisplayEvent_{ REL::ID(1485419) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HUDTutorialTextEvent_{ REL::ID(498433) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_HasHUDMessagesEvent_{ REL::ID(910519) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_IsPipboyActiveEvent_{ REL::ID(179520) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_MultiActivateUseRolloverEvent_{ REL::ID(1400082) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ObjectivesInWayOfXP_{ REL::ID(407464) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_PlayerActivatePickRefEvent_{ REL::ID(744234) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_PlayerActiveEffectIconsEvent_{ REL::ID(775257) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_PlayerAmmoCountEvent_{ REL::ID(1524495) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_PlayerAutoAimActorEvent_{ REL::ID(742747) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_PlayerCommandTypeEvent_{ REL::ID(1008332) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_PlayerCrosshairModeEvent_{ REL::ID(1276027) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_QuickContainerStateEvent_{ REL::ID(1534484) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_RolloverSuppressedEvent_{ REL::ID(1268386) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_SaveLoadMessageStringEvent_{ REL::ID(1384214) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingDialogueSpeechChallengeAnim_{ REL::ID(610258) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingExperienceEvent_{ REL::ID(1016660) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingFeaturedItemVaultBoyEvent_{ REL::ID(641183) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingLongSubtitleEvent_{ REL::ID(1420984) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingPerkVaultBoyState_{ REL::ID(696118) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingVATSCritAnim_{ REL::ID(611915) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ShowingWideSubtitleEvent_{ REL::ID(1155215) };
+		inline constexpr std::array<REL::ID, 1> BSTValueEventSource_ViewCasterUpdateEvent_{ REL::ID(804119) };
+		inline constexpr std::array<REL::ID, 1> BSTableCurve{ REL::ID(1148576) };
+		inline constexpr std::array<REL::ID, 1> BSTaskJobber{ REL::ID(995845) };
+		inline constexpr std::array<REL::ID, 1> BSTaskJobber__Task{ REL::ID(337878) };
+		inline constexpr std::array<REL::ID, 1> BSTaskThread{ REL::ID(1119914) };
+		inline constexpr std::array<REL::ID, 1> BSTasklet{ REL::ID(591343) };
+		inline constexpr std::array<REL::ID, 1> BSTaskletData{ REL::ID(1029733) };
+		inline constexpr std::array<REL::ID, 1> BSTaskletGroupData{ REL::ID(857109) };
+		inline constexpr std::array<REL::ID, 1> BSTaskletManager{ REL::ID(1482701) };
+		inline constexpr std::array<REL::ID, 1> BSTaskletManagerCallback{ REL::ID(199191) };
+		inline constexpr std::array<REL::ID, 1> BSTempEffect{ REL::ID(970086) };
+		inline constexpr std::array<REL::ID, 1> BSTempEffectDebris{ REL::ID(835718) };
+		inline constexpr std::array<REL::ID, 1> BSTempEffectGeometryDecal{ REL::ID(1513225) };
+		inline constexpr std::array<REL::ID, 1> BSTempEffectParticle{ REL::ID(1032799) };
+		inline constexpr std::array<REL::ID, 1> BSTempEffectSPG{ REL::ID(1430197) };
+		inline constexpr std::array<REL::ID, 1> BSTempEffectWeaponBlood{ REL::ID(1230230) };
+		inline constexpr std::array<REL::ID, 2> BSTerrainEffect{ REL::ID(922769), REL::ID(1427125) };
+		inline constexpr std::array<REL::ID, 1> BSTextureArray__MasterTexture{ REL::ID(1352462) };
+		inline constexpr std::array<REL::ID, 1> BSTextureArray__StaticTexture{ REL::ID(1034577) };
+		inline constexpr std::array<REL::ID, 1> BSTextureArray__StaticTextureIndexed{ REL::ID(1193773) };
+		inline constexpr std::array<REL::ID, 1> BSTextureArray__Texture{ REL::ID(703422) };
+		inline constexpr std::array<REL::ID, 2> BSTextureDB__QueuedHandles{ REL::ID(283715), REL::ID(582820) };
+		inline constexpr std::array<REL::ID, 2> BSTextureDB__QueuedHandlesWithCallback{ REL::ID(1124384), REL::ID(1423177) };
+		inline constexpr std::array<REL::ID, 1> BSTextureDB____NiTextureDBForwarded{ REL::ID(1460270) };
+		inline constexpr std::array<REL::ID, 1> BSTextureSet{ REL::ID(1264073) };
+		inline constexpr std::array<REL::ID, 4> BSTextureStreamer__Manager{ REL::ID(782435), REL::ID(1440209), REL::ID(516178), REL::ID(1174352) };
+		inline constexpr std::array<REL::ID, 1> BSTextureStreamer__StreamDetailI{ REL::ID(530063) };
+		inline constexpr std::array<REL::ID, 1> BSTextureStreamer__TextureModifyBatch{ REL::ID(1234839) };
+		inline constexpr std::array<REL::ID, 1> BSTextureStreamer__TextureModifyBatchNoLimit{ REL::ID(908372) };
+		inline constexpr std::array<REL::ID, 1> BSTextureStreamer__zlibStreamDetail{ REL::ID(436461) };
+		inline constexpr std::array<REL::ID, 1> BSThread{ REL::ID(1257245) };
+		inline constexpr std::array<REL::ID, 1> BSThreadEvent____Source{ REL::ID(44757) };
+		inline constexpr std::array<REL::ID, 1> BSTimerModifier{ REL::ID(479932) };
+		inline constexpr std::array<REL::ID, 1> BSTransformExtra{ REL::ID(899310) };
+		inline constexpr std::array<REL::ID, 1> BSTreadTransfInterpolator{ REL::ID(1315054) };
+		inline constexpr std::array<REL::ID, 1> BSTreeManager__IQueryCullingCamera{ REL::ID(1578413) };
+		inline constexpr std::array<REL::ID, 1> BSTreeNode{ REL::ID(888571) };
+		inline constexpr std::array<REL::ID, 1> BSTriShape{ REL::ID(183326) };
+		inline constexpr std::array<REL::ID, 1> BSTweenerModifier{ REL::ID(732593) };
+		inline constexpr std::array<REL::ID, 1> BSUIMessageData{ REL::ID(467529) };
+		inline constexpr std::array<REL::ID, 1> BSUIScaleformData{ REL::ID(247338) };
+		inline constexpr std::array<REL::ID, 2> BSUtilityShader{ REL::ID(417167), REL::ID(324036) };
+		inline constexpr std::array<REL::ID, 1> BSVMLoadTask{ REL::ID(652629) };
+		inline constexpr std::array<REL::ID, 1> BSValueNode{ REL::ID(384627) };
+		inline constexpr std::array<REL::ID, 1> BSVirtualKeyboardDevice{ REL::ID(116875) };
+		inline constexpr std::array<REL::ID, 1> BSWArray{ REL::ID(137329) };
+		inline constexpr std::array<REL::ID, 2> BSWaterShader{ REL::ID(149827), REL::ID(56422) };
+		inline constexpr std::array<REL::ID, 1> BSWaterShaderMaterial{ REL::ID(443019) };
+		inline constexpr std::array<REL::ID, 1> BSWaterShaderProperty{ REL::ID(1567010) };
+		inline constexpr std::array<REL::ID, 1> BSWin32GameDataSystemUtility{ REL::ID(495536) };
+		inline constexpr std::array<REL::ID, 1> BSWin32TaskletGroupData{ REL::ID(544740) };
+		inline constexpr std::array<REL::ID, 1> BSWin32TaskletManager{ REL::ID(950374) };
+		inline constexpr std::array<REL::ID, 1> BSWindModifier{ REL::ID(422809) };
+		inline constexpr std::array<REL::ID, 1> BSXAudio2Audio{ REL::ID(1425038) };
+		inline constexpr std::array<REL::ID, 1> BSXAudio2AudioListener{ REL::ID(366547) };
+		inline constexpr std::array<REL::ID, 1> BSXAudio2DataSrc{ REL::ID(712585) };
+		inline constexpr std::array<REL::ID, 3> BSXAudio2GameSound{ REL::ID(40050), REL::ID(292295), REL::ID(464952) };
+		inline constexpr std::array<REL::ID, 1> BSXFlags{ REL::ID(930437) };
+		inline constexpr std::array<REL::ID, 1> BShkFloatController{ REL::ID(1541759) };
+		inline constexpr std::array<REL::ID, 1> BShkNonTransformController{ REL::ID(444517) };
+		inline constexpr std::array<REL::ID, 1> BShkVisibilityController{ REL::ID(389342) };
+		inline constexpr std::array<REL::ID, 1> BShkbAnimationGraph{ REL::ID(742655) };
+		inline constexpr std::array<REL::ID, 1> BShkbGlobalTransitionData{ REL::ID(705128) };
+		inline constexpr std::array<REL::ID, 2> BShkbHkxDB__ProjectDBData{ REL::ID(471283), REL::ID(378244) };
+		inline constexpr std::array<REL::ID, 2> BShkbHkxDB__QueuedHandles{ REL::ID(1069185), REL::ID(1367860) };
+		inline constexpr std::array<REL::ID, 1> BShkbHkxDB__StreamAdaptor{ REL::ID(1307665) };
+		inline constexpr std::array<REL::ID, 2> BShkbHkxDB__hkxDBData{ REL::ID(1096841), REL::ID(1003357) };
+		inline constexpr std::array<REL::ID, 1> BShkbUtils__GraphInspectionFunctor{ REL::ID(736766) };
+		inline constexpr std::array<REL::ID, 1> BShkbUtils__SearchAllStateMachineChildrenFunctor{ REL::ID(831238) };
+		inline constexpr std::array<REL::ID, 1> BSiStateTaggingGenerator{ REL::ID(1411935) };
+		inline constexpr std::array<REL::ID, 1> BSiStateTaggingListenerSingleton{ REL::ID(1302714) };
+		inline constexpr std::array<REL::ID, 1> BSiStateTaggingStateListener{ REL::ID(520974) };
+		inline constexpr std::array<REL::ID, 1> BackgroundProcessThread{ REL::ID(770793) };
+		inline constexpr std::array<REL::ID, 1> BanishEffect{ REL::ID(709252) };
+		inline constexpr std::array<REL::ID, 8> BarrierProjectile{ REL::ID(212225), REL::ID(1133101), REL::ID(209230), REL::ID(866968), REL::ID(1525515), REL::ID(820580), REL::ID(414471), REL::ID(1511786) };
+		inline constexpr std::array<REL::ID, 4> BarterMenu{ REL::ID(910737), REL::ID(457896), REL::ID(1069590), REL::ID(145531) };
+		inline constexpr std::array<REL::ID, 1> BaseFormComponent{ REL::ID(342760) };
+		inline constexpr std::array<REL::ID, 1> BasicArrayImplementation_char_{ REL::ID(371408) };
+		inline constexpr std::array<REL::ID, 1> BasicArrayImplementation_float_{ REL::ID(1518209) };
+		inline constexpr std::array<REL::ID, 1> BasicArrayImplementation_hkDataArrayImpl_{ REL::ID(516679) };
+		inline constexpr std::array<REL::ID, 1> BasicArrayImplementation_hkDataObjectImpl_{ REL::ID(226359) };
+		inline constexpr std::array<REL::ID, 1> BasicArrayImplementation_unsignedchar_{ REL::ID(1227672) };
+		inline constexpr std::array<REL::ID, 9> BeamProjectile{ REL::ID(700255), REL::ID(38423), REL::ID(697171), REL::ID(1354653), REL::ID(430500), REL::ID(1308131), REL::ID(902374), REL::ID(416783), REL::ID(1467380) };
+		inline constexpr std::array<REL::ID, 1> BedEnterHandler{ REL::ID(48761) };
+		inline constexpr std::array<REL::ID, 1> BedFurnitureExitHandler{ REL::ID(440800) };
+		inline constexpr std::array<REL::ID, 1> BleedoutCameraState{ REL::ID(1310826) };
+		inline constexpr std::array<REL::ID, 4> BookMenu{ REL::ID(1397903), REL::ID(1477925), REL::ID(506861), REL::ID(320267) };
+		inline constexpr std::array<REL::ID, 1> BowDrawnHandler{ REL::ID(945472) };
+		inline constexpr std::array<REL::ID, 1> BowReleaseHandler{ REL::ID(20931) };
+		inline constexpr std::array<REL::ID, 1> BowZoomStartHandler{ REL::ID(413313) };
+		inline constexpr std::array<REL::ID, 1> BowZoomStopHandler{ REL::ID(1071573) };
+		inline constexpr std::array<REL::ID, 2> BuildABot__InputHandler{ REL::ID(1379287), REL::ID(236152) };
+		inline constexpr std::array<REL::ID, 3> ButtonBarMenu{ REL::ID(244181), REL::ID(323579), REL::ID(935124) };
+		inline constexpr std::array<REL::ID, 1> ButtonEvent{ REL::ID(1072871) };
+		inline constexpr std::array<REL::ID, 2> ButtonHintBar{ REL::ID(1024780), REL::ID(100822) };
+		inline constexpr std::array<REL::ID, 1> ByteArrayImplementation{ REL::ID(509001) };
+		inline constexpr std::array<REL::ID, 1> bhkBipedOrientationController{ REL::ID(650623) };
+		inline constexpr std::array<REL::ID, 1> bhkBlockStreamAllocator_2048_{ REL::ID(1099543) };
+		inline constexpr std::array<REL::ID, 2> bhkCharProxyController{ REL::ID(248334), REL::ID(155202) };
+		inline constexpr std::array<REL::ID, 1> bhkCharProxyControllerCinfo{ REL::ID(75622) };
+		inline constexpr std::array<REL::ID, 1> bhkCharProxyManager{ REL::ID(809138) };
+		inline constexpr std::array<REL::ID, 2> bhkCharRigidBodyController{ REL::ID(152147), REL::ID(1440635) };
+		inline constexpr std::array<REL::ID, 1> bhkCharRigidBodyControllerCinfo{ REL::ID(1561769) };
+		inline constexpr std::array<REL::ID, 1> bhkCharRigidBodyManager{ REL::ID(277003) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterCollisionHandler{ REL::ID(1310512) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterController{ REL::ID(1186913) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterControllerCinfo{ REL::ID(1013985) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterPointCollector{ REL::ID(597267) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterProxy{ REL::ID(355156) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterRigidBody{ REL::ID(258992) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterRigidBodyCinfo{ REL::ID(525032) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterState{ REL::ID(1200765) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateClimbing{ REL::ID(1239011) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateFloating{ REL::ID(1027939) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateFlying{ REL::ID(707318) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateInAir{ REL::ID(43467) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateJumping{ REL::ID(1519082) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateOnGround{ REL::ID(534515) };
+		inline constexpr std::array<REL::ID, 1> bhkCharacterStateSwimming{ REL::ID(600232) };
+		inline constexpr std::array<REL::ID, 1> bhkCollisionFilter{ REL::ID(599770) };
+		inline constexpr std::array<REL::ID, 1> bhkIAddToWorld{ REL::ID(1316143) };
+		inline constexpr std::array<REL::ID, 1> bhkICharOrientationController{ REL::ID(893430) };
+		inline constexpr std::array<REL::ID, 1> bhkIWorldStepListener{ REL::ID(1274460) };
+		inline constexpr std::array<REL::ID, 1> bhkMemorySystem{ REL::ID(902689) };
+		inline constexpr std::array<REL::ID, 1> bhkNPCollisionObject{ REL::ID(844205) };
+		inline constexpr std::array<REL::ID, 1> bhkNPCollisionObjectBase{ REL::ID(246497) };
+		inline constexpr std::array<REL::ID, 1> bhkNPCollisionObjectUnlinked{ REL::ID(1334686) };
+		inline constexpr std::array<REL::ID, 1> bhkNPCollisionObjectUnlinked__LinkExtraData{ REL::ID(737497) };
+		inline constexpr std::array<REL::ID, 1> bhkNPCollisionProxyObject{ REL::ID(1228040) };
+		inline constexpr std::array<REL::ID, 1> bhkPhysicsSystem{ REL::ID(150259) };
+		inline constexpr std::array<REL::ID, 1> bhkQuadOrientationController{ REL::ID(54220) };
+		inline constexpr std::array<REL::ID, 1> bhkRagdollPenetrationUtil{ REL::ID(17760) };
+		inline constexpr std::array<REL::ID, 1> bhkRagdollSystem{ REL::ID(309115) };
+		inline constexpr std::array<REL::ID, 1> bhkTTNode_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___{ REL::ID(1080578) };
+		inline constexpr std::array<REL::ID, 2> bhkThreadMemorySource{ REL::ID(594246), REL::ID(500704) };
+		inline constexpr std::array<REL::ID, 1> bhkThreadPool{ REL::ID(223961) };
+		inline constexpr std::array<REL::ID, 1> bhkTrapListener{ REL::ID(655256) };
+		inline constexpr std::array<REL::ID, 1> bhkWorld{ REL::ID(356317) };
+		inline constexpr std::array<REL::ID, 1> bhkWorldM{ REL::ID(1488354) };
+		inline constexpr std::array<REL::ID, 1> bnet__AcceptLegalDocumentsRequest{ REL::ID(1448767) };
+		inline constexpr std::array<REL::ID, 1> bnet__AccountDeletionRequest{ REL::ID(1946) };
+		inline constexpr std::array<REL::ID, 1> bnet__AccountInfoRequest{ REL::ID(1382939) };
+		inline constexpr std::array<REL::ID, 1> bnet__AccountLinkingRequest{ REL::ID(1417898) };
+		inline constexpr std::array<REL::ID, 3> bnet__AccountQuickCreateFlow{ REL::ID(1242521), REL::ID(271718), REL::ID(710864) };
+		inline constexpr std::array<REL::ID, 1> bnet__AccountUnlinkingRequest{ REL::ID(1505395) };
+		inline constexpr std::array<REL::ID, 1> bnet__AccountUpgradeAnonymousToQuickRequest{ REL::ID(1111106) };
+		inline constexpr std::array<REL::ID, 1> bnet__AcquirableFreeLessHeap{ REL::ID(1079353) };
+		inline constexpr std::array<REL::ID, 1> bnet__AddFingerprintRequest{ REL::ID(1118468) };
+		inline constexpr std::array<REL::ID, 1> bnet__AnonymousAuthRequest{ REL::ID(274385) };
+		inline constexpr std::array<REL::ID, 3> bnet__AnonymousAuthenticationFlow{ REL::ID(948804), REL::ID(1560571), REL::ID(416631) };
+		inline constexpr std::array<REL::ID, 3> bnet__AuthenticationFlow{ REL::ID(1127219), REL::ID(156764), REL::ID(595579) };
+		inline constexpr std::array<REL::ID, 1> bnet__BaseCallback{ REL::ID(707406) };
+		inline constexpr std::array<REL::ID, 2> bnet__BaseCallbackJob_bnet__Sequence_bnet__ta__ThreadSafe_bnet__ta__ErrorPropagation__bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__bnet__ta__ThreadSafe_{ REL::ID(982430), REL::ID(231374) };
+		inline constexpr std::array<REL::ID, 4> bnet__BaseFileDownloader{ REL::ID(529501), REL::ID(1579757), REL::ID(435893), REL::ID(1313564) };
+		inline constexpr std::array<REL::ID, 1> bnet__BaseHttpRequest{ REL::ID(604394) };
+		inline constexpr std::array<REL::ID, 1> bnet__BeamAuthenticationRequest{ REL::ID(1107964) };
+		inline constexpr std::array<REL::ID, 1> bnet__BeamExternalAuthenticationRequest{ REL::ID(18634) };
+		inline constexpr std::array<REL::ID, 1> bnet__BeamQuickCreationRequest{ REL::ID(115312) };
+		inline constexpr std::array<REL::ID, 1> bnet__BeamUserCredentialsAuthenticationRequest{ REL::ID(471332) };
+		inline constexpr std::array<REL::ID, 1> bnet__CMS__ListMessagesRequest{ REL::ID(434227) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__AnonymousAuthenticationFlow_{ REL::ID(1294274) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__ExternalAuthenticationFlow_{ REL::ID(1013738) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountExternalAuthenticationFlow_{ REL::ID(680499) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountExternalLinkConflictResolveFlow_{ REL::ID(1201468) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountExternalLinkFlow_{ REL::ID(1530224) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountGameCodeAuthenticationFlow_{ REL::ID(625180) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountLinkConflictResolveFlow_{ REL::ID(524111) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountLinkFlow_{ REL::ID(1428904) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameAccountUserCredentialsAuthenticationFlow_{ REL::ID(236043) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__GameCodeAuthenticationFlow_{ REL::ID(62211) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__SessionAnonymousCreateFlow_{ REL::ID(389243) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__SessionQuickCreateFlow_{ REL::ID(1066464) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__SessionResumeFlow_{ REL::ID(1302137) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__bnet__UserCredentialsAuthenticationFlow_{ REL::ID(18238) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__AccountLinkingResult__bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ REL::ID(904170) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__AccountResult__bnet__AccountAuthenticationStatus__BSPlatform__BSBNetAccountManager_{ REL::ID(133604) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__bnet__ExternalAuthenticationFlow_{ REL::ID(1060429) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__bnet__GameAccountUserCredentialsAuthenticationFlow_{ REL::ID(282493) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__bnet__UserCredentialsAuthenticationFlow_{ REL::ID(65290) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__BeamUserData__bnet__HttpResponseInfo__bnet__AccountQuickCreateFlow_{ REL::ID(4992) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__CdpAuthenticationResult__bnet__HttpResponseInfo__bnet__AuthenticationFlow_{ REL::ID(1426022) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__CdpFileInfoResult__bnet__HttpResponseInfo__bnet__DownloadFlow_{ REL::ID(1442142) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__CdpKeyResult__bnet__HttpResponseInfo__bnet__DownloadFlow_{ REL::ID(1348715) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__bnet__RetrieveExternalAccountJob_{ REL::ID(1360727) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(493695) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo__bnet__DownloadFlow_{ REL::ID(1302166) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo__bnet__LegalDocument_{ REL::ID(447535) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__Status__ExtServerStatusResult__bnet__HttpResponseInfo__BSPlatform__BSCoreServicesManager_{ REL::ID(954033) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcChunkUploadResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(853074) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(1346653) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(554441) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(68912) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(1006597) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(1226269) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(153904) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(1365648) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(918781) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__UpgradeTokenResult__bnet__HttpResponseInfo__bnet__UnlinkAccountFlow_{ REL::ID(931313) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Catalog__Item__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(381375) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__Balance__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(894408) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(110101) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo__bnet__UgcMtxPurchaseFlow_{ REL::ID(125671) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__CMS__Message_5_1_bnet___impl__StdAllocator_bnet__CMS__Message____bnet__HttpResponseInfo__BSPlatform__BSCoreServicesManager_{ REL::ID(389047) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ REL::ID(624547) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__bnet__AccountQuickCreateFlow_{ REL::ID(397626) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__bnet__AuthenticationFlow_{ REL::ID(1379364) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__bnet__ListLegalDocumentsFlow_{ REL::ID(1286674) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(176064) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(512971) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char____const__bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(1376472) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet__UniquePtr_bnet___impl__Vector_bnet__Entitlements__Item___bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ REL::ID(1315269) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet___impl__FixedString_40_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo__bnet__AuthenticationFlow_{ REL::ID(1332782) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ REL::ID(152943) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__BSPlatform__BSCreationClubManager_{ REL::ID(581878) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__BSPlatform__BSModsManager_{ REL::ID(1571879) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__ChunkedUploadFlow_{ REL::ID(29981) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__DownloadFlow_{ REL::ID(1255720) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__ExternalAuthenticationFlow_{ REL::ID(967183) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__GameAccountExternalAuthenticationFlow_{ REL::ID(633601) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__ListLegalDocumentsFlow_{ REL::ID(1240234) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__NewGameSessionFlow_{ REL::ID(1367724) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__UgcMtxPurchaseFlow_{ REL::ID(79054) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__bnet__UnlinkAccountFlow_{ REL::ID(884713) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_bool_bnet__HttpResponseInfo__BSPlatform__BSBNetAccountManager_{ REL::ID(1483109) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackBind_bnet__Callback_unsigned__int64_bnet__HttpResponseInfo__bnet__ChunkedUploadFlow_{ REL::ID(77013) };
+		inline constexpr std::array<REL::ID, 2> bnet__CallbackSequence_bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__bnet__ta__ThreadSafe_bnet__ta__ErrorPropagation_{ REL::ID(889402), REL::ID(137943) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet__BNetErrorResult_bnet__EmptyStatus__void___unsigned__int64_bnet__BNetErrorResult_bnet__BNetError_bnet__EmptyStatusconst__{ REL::ID(147480) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo___lambda_2a3d09749ab1a7a2d04ec09309520633__{ REL::ID(317578) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo___lambda_588386b9a62f46a0d077492bf9f69e10__{ REL::ID(919621) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_4a6a5efa89cc01e0bddd7eed4a328cc4__{ REL::ID(271053) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_52f202907a4771e1bca18533ce859533__{ REL::ID(1116412) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_761a956714b46e17e88dcfef586f7e7e__{ REL::ID(908589) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_934f5db8ee421f65975536d028146cb7__{ REL::ID(224483) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_9399aef1f3d23d97f9f1ddcffcd7a809__{ REL::ID(452520) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_b03e91aa70ad18dc8c2bb34f59e295dc__{ REL::ID(1267867) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_bcae189c2ac764aa6f3e67710cd5d9f3__{ REL::ID(1524460) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_bfa368bfcee47d43a2050e26590ced32__{ REL::ID(1286390) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_c211967adeece705f7f006a03cf00ecb__{ REL::ID(1571163) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_cb01a8382207de35475da81539317ca7__{ REL::ID(16825) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_d7c73fab7dc6a0b97bfa0a1cf0071488__{ REL::ID(499317) };
+		inline constexpr std::array<REL::ID, 1> bnet__CallbackWrapper_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo___lambda_ede56f28efebb3c2d40cf8b19f53b40e__{ REL::ID(109639) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__BNetErrorResult_bnet__EmptyStatus_{ REL::ID(194365) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__BNetError_bnet__HttpResponseInfo_{ REL::ID(1430602) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo_{ REL::ID(364063) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__AccountLinkingResult__bnet__HttpResponseInfo_{ REL::ID(950784) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__AccountResult__bnet__AccountAuthenticationStatus_{ REL::ID(180482) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo_{ REL::ID(1129161) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__BeamUserData__bnet__HttpResponseInfo_{ REL::ID(1288967) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__CdpAuthenticationResult__bnet__HttpResponseInfo_{ REL::ID(1473112) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__CdpFileInfoResult__bnet__HttpResponseInfo_{ REL::ID(1489119) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__CdpKeyResult__bnet__HttpResponseInfo_{ REL::ID(1395320) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo_{ REL::ID(810074) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__FileChunk__bnet__HttpResponseInfo_{ REL::ID(540666) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__Status__ExtServerStatusResult__bnet__HttpResponseInfo_{ REL::ID(1000459) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__UgcChunkUploadResult__bnet__HttpResponseInfo_{ REL::ID(899755) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo_{ REL::ID(601019) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo_{ REL::ID(1053349) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo_{ REL::ID(200524) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo_{ REL::ID(965415) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__UpgradeTokenResult__bnet__HttpResponseInfo_{ REL::ID(977832) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__VCCS__Catalog__Item__bnet__HttpResponseInfo_{ REL::ID(427889) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__Balance__bnet__HttpResponseInfo_{ REL::ID(940924) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo_{ REL::ID(156877) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__CMS__Message_5_1_bnet___impl__StdAllocator_bnet__CMS__Message____bnet__HttpResponseInfo_{ REL::ID(435477) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo_{ REL::ID(671276) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo_{ REL::ID(559747) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char____const__bnet__HttpResponseInfo_{ REL::ID(1423127) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet__UniquePtr_bnet___impl__Vector_bnet__Entitlements__Item___bnet__HttpResponseInfo_{ REL::ID(1361749) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet___impl__FixedString_40_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo_{ REL::ID(1174032) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo_{ REL::ID(35700) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_bool_bnet__HttpResponseInfo_{ REL::ID(1529555) };
+		inline constexpr std::array<REL::ID, 1> bnet__Callback_unsigned__int64_bnet__HttpResponseInfo_{ REL::ID(123613) };
+		inline constexpr std::array<REL::ID, 1> bnet__Caller_void___bnet__InternalBNet__bnet__InternalBNet_{ REL::ID(62919) };
+		inline constexpr std::array<REL::ID, 1> bnet__Caller_void___bnet__NetworkLoop__bnet__NetworkLoop_{ REL::ID(425115) };
+		inline constexpr std::array<REL::ID, 1> bnet__CdpAuthenticationRequest{ REL::ID(285433) };
+		inline constexpr std::array<REL::ID, 1> bnet__CdpFileInfoRequest{ REL::ID(719373) };
+		inline constexpr std::array<REL::ID, 1> bnet__CdpKeyRequest{ REL::ID(38452) };
+		inline constexpr std::array<REL::ID, 1> bnet__CheckEmailRequest{ REL::ID(83773) };
+		inline constexpr std::array<REL::ID, 4> bnet__ChunkedUploadFlow{ REL::ID(702676), REL::ID(1313634), REL::ID(170473), REL::ID(1047739) };
+		inline constexpr std::array<REL::ID, 2> bnet__Composite_bnet__ta__NonThreadSafe_{ REL::ID(101228), REL::ID(713170) };
+		inline constexpr std::array<REL::ID, 2> bnet__Composite_bnet__ta__ThreadSafe_{ REL::ID(90510), REL::ID(702445) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntry{ REL::ID(728250) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryBoolean{ REL::ID(368548) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryFloat{ REL::ID(886863) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryInteger{ REL::ID(1418650) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryLong{ REL::ID(354729) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryPool_bnet__ConfigurationEntryBoolean_bool_{ REL::ID(780095) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryPool_bnet__ConfigurationEntryFloat_float_{ REL::ID(121770) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryPool_bnet__ConfigurationEntryInteger_int_{ REL::ID(387694) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryPool_bnet__ConfigurationEntryLong___int64_{ REL::ID(1045866) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryPool_bnet__ConfigurationEntryString_charconst_{ REL::ID(952657) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationEntryString{ REL::ID(1404973) };
+		inline constexpr std::array<REL::ID, 1> bnet__ConfigurationVariable_int_{ REL::ID(27374) };
+		inline constexpr std::array<REL::ID, 4> bnet__DownloadFlow{ REL::ID(485150), REL::ID(1096736), REL::ID(1535571), REL::ID(830698) };
+		inline constexpr std::array<REL::ID, 1> bnet__EmptyTerminationCB{ REL::ID(829081) };
+		inline constexpr std::array<REL::ID, 1> bnet__Entitlements__ConsumeRequest{ REL::ID(1444429) };
+		inline constexpr std::array<REL::ID, 1> bnet__Entitlements__ListRequest{ REL::ID(1219980) };
+		inline constexpr std::array<REL::ID, 1> bnet__Entitlements__SearchRequest{ REL::ID(20748) };
+		inline constexpr std::array<REL::ID, 1> bnet__EventLog__LogEventRequest{ REL::ID(1030059) };
+		inline constexpr std::array<REL::ID, 1> bnet__EventLog____CollectErrorRequest{ REL::ID(590791) };
+		inline constexpr std::array<REL::ID, 1> bnet__EventLog____CollectLogBatchRequest{ REL::ID(1454422) };
+		inline constexpr std::array<REL::ID, 1> bnet__EventLog____CollectLogRequest{ REL::ID(231415) };
+		inline constexpr std::array<REL::ID, 1> bnet__ExternalAuthInfo{ REL::ID(6951) };
+		inline constexpr std::array<REL::ID, 3> bnet__ExternalAuthenticationFlow{ REL::ID(715437), REL::ID(1326341), REL::ID(183202) };
+		inline constexpr std::array<REL::ID, 1> bnet__ExternalServiceRetrieveAccountRequest{ REL::ID(807055) };
+		inline constexpr std::array<REL::ID, 4> bnet__FileDownloader{ REL::ID(602991), REL::ID(71016), REL::ID(509661), REL::ID(1386943) };
+		inline constexpr std::array<REL::ID, 1> bnet__FreeLessHeap{ REL::ID(202061) };
+		inline constexpr std::array<REL::ID, 1> bnet__GameAccountAuthenticationRequest{ REL::ID(662959) };
+		inline constexpr std::array<REL::ID, 1> bnet__GameAccountExternalAuthRequest{ REL::ID(210359) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountExternalAuthenticationFlow{ REL::ID(334550), REL::ID(945986), REL::ID(1384614) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountExternalLinkConflictResolveFlow{ REL::ID(855794), REL::ID(1467451), REL::ID(323728) };
+		inline constexpr std::array<REL::ID, 1> bnet__GameAccountExternalLinkConflictResolveRequest{ REL::ID(1115180) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountExternalLinkFlow{ REL::ID(1184569), REL::ID(213952), REL::ID(652757) };
+		inline constexpr std::array<REL::ID, 1> bnet__GameAccountExternalLinkRequest{ REL::ID(1339742) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountGameCodeAuthenticationFlow{ REL::ID(279473), REL::ID(891067), REL::ID(1329600) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountLinkConflictResolveFlow{ REL::ID(178764), REL::ID(790299), REL::ID(1228935) };
+		inline constexpr std::array<REL::ID, 1> bnet__GameAccountLinkConflictResolveRequest{ REL::ID(251578) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountLinkFlow{ REL::ID(1083548), REL::ID(112831), REL::ID(551846) };
+		inline constexpr std::array<REL::ID, 1> bnet__GameAccountLinkRequest{ REL::ID(1408490) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameAccountUserCredentialsAuthenticationFlow{ REL::ID(1519549), REL::ID(548783), REL::ID(987072) };
+		inline constexpr std::array<REL::ID, 3> bnet__GameCodeAuthenticationFlow{ REL::ID(1298944), REL::ID(328214), REL::ID(767187) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__Entitlements__ConsumeResponse_bnet__HttpResponseInfo__{ REL::ID(1099043) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__SessionAuthResult_bnet__HttpResponseInfo__{ REL::ID(1160971) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UgcReleaseNote_bnet__HttpResponseInfo__{ REL::ID(904340) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UgcType__UploadStatus_bnet__HttpResponseInfo__{ REL::ID(1553999) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__AccountInfoResult__bnet__HttpResponseInfo__{ REL::ID(1037532) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__AccountLinkingResult__bnet__HttpResponseInfo__{ REL::ID(1072591) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__BeamAuthResult__bnet__HttpResponseInfo__{ REL::ID(126105) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__BeamUserData__bnet__HttpResponseInfo__{ REL::ID(1351853) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__CdpAuthenticationResult__bnet__HttpResponseInfo__{ REL::ID(1522509) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__CdpFileInfoResult__bnet__HttpResponseInfo__{ REL::ID(373410) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__CdpKeyResult__bnet__HttpResponseInfo__{ REL::ID(1275452) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__ExternalAccountInfo__bnet__HttpResponseInfo__{ REL::ID(638445) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__SessionValidateResult__bnet__HttpResponseInfo__{ REL::ID(1331021) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__Status__ExtServerStatusResult__bnet__HttpResponseInfo__{ REL::ID(818340) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__TwitchAccountInfoResult__bnet__HttpResponseInfo__{ REL::ID(895485) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcContent__bnet__HttpResponseInfo__{ REL::ID(248359) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcCreationResult__bnet__HttpResponseInfo__{ REL::ID(511265) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcListCategoriesResult__bnet__HttpResponseInfo__{ REL::ID(294036) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcPagedContentListResult__bnet__HttpResponseInfo__{ REL::ID(361229) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UgcUploadDetails__bnet__HttpResponseInfo__{ REL::ID(300156) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__UpgradeTokenResult__bnet__HttpResponseInfo__{ REL::ID(402644) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Catalog__Item__bnet__HttpResponseInfo__{ REL::ID(215997) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__Balance__bnet__HttpResponseInfo__{ REL::ID(170179) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet__VCCS__Wallet__PurchaseResult__bnet__HttpResponseInfo__{ REL::ID(1444888) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__CMS__Message_5_1_bnet___impl__StdAllocator_bnet__CMS__Message____bnet__HttpResponseInfo__{ REL::ID(89067) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__Count_bnet___impl__FixedString_64_1_1_bnet___impl__StdAllocator_char____40_1_bnet___impl__StdAllocator_bnet__Count_bnet___impl__FixedString_64_1_1_bnet___impl__StdAllocator_char_______bnet__HttpResponseInfo__{ REL::ID(718005) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__ExternalIdAccountInfo_4_1_bnet___impl__StdAllocator_bnet__ExternalIdAccountInfo____bnet__HttpResponseInfo__{ REL::ID(461015) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__LegalDocument_5_1_bnet___impl__StdAllocator_bnet__LegalDocument____bnet__HttpResponseInfo__{ REL::ID(546666) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__Platform_10_1_bnet___impl__StdAllocator_bnet__Platform____bnet__HttpResponseInfo__{ REL::ID(1061644) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcAuthor_20_1_bnet___impl__StdAllocator_bnet__UgcAuthor____bnet__HttpResponseInfo__{ REL::ID(1484015) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcContent_25_1_bnet___impl__StdAllocator_bnet__UgcContent____bnet__HttpResponseInfo__{ REL::ID(1133432) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet__UgcNotification_20_1_bnet___impl__StdAllocator_bnet__UgcNotification____bnet__HttpResponseInfo__{ REL::ID(1362590) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_10_1_1_bnet___impl__StdAllocator_char____const__bnet__HttpResponseInfo__{ REL::ID(683025) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_128_1_1_bnet___impl__StdAllocator_char___8_1_bnet___impl__StdAllocator_bnet___impl__FixedString_128_1_1_bnet___impl__StdAllocator_char______bnet__HttpResponseInfo__{ REL::ID(820233) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__FixedVector_bnet___impl__FixedString_32_1_1_bnet___impl__StdAllocator_char___16_1_bnet___impl__StdAllocator_bnet___impl__FixedString_32_1_1_bnet___impl__StdAllocator_char______bnet__HttpResponseInfo__{ REL::ID(411782) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__UniquePtr_bnet___impl__Vector_bnet__Entitlements__Item___bnet__HttpResponseInfo__{ REL::ID(874109) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet__VCCS__Catalog__ListItemsResult_bnet__HttpResponseInfo__{ REL::ID(1460426) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet___impl__FixedString_2000_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo__{ REL::ID(765827) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet___impl__FixedString_40_1_1_bnet___impl__StdAllocator_char___bnet__HttpResponseInfo__{ REL::ID(1481344) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bnet_std__void_t_bnet__HttpResponseInfo__{ REL::ID(245105) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_bool_bnet__HttpResponseInfo__{ REL::ID(1103192) };
+		inline constexpr std::array<REL::ID, 1> bnet__HttpRequest_bnet__Callback_unsigned__int64_bnet__HttpResponseInfo__{ REL::ID(656505) };
+		inline constexpr std::array<REL::ID, 2> bnet__HttpTransport{ REL::ID(1043133), REL::ID(996392) };
+		inline constexpr std::array<REL::ID, 1> bnet__IDispenser_bnet__Job_{ REL::ID(1171282) };
+		inline constexpr std::array<REL::ID, 1> bnet__IDownloader{ REL::ID(1189937) };
+		inline constexpr std::array<REL::ID, 1> bnet__IDynamicVariableDeleter{ REL::ID(1292726) };
+		inline constexpr std::array<REL::ID, 1> bnet__IHeap{ REL::ID(480219) };
+		inline constexpr std::array<REL::ID, 1> bnet__IHttpConnectionProvider{ REL::ID(1357536) };
+		inline constexpr std::array<REL::ID, 1> bnet__IJobCollection{ REL::ID(864561) };
+		inline constexpr std::array<REL::ID, 1> bnet__IProducerConsumerQueue_bnet__UniquePtr_bnet__BaseCallback__{ REL::ID(1311068) };
+		inline constexpr std::array<REL::ID, 1> bnet__IProducerConsumerQueue_bnet__UniquePtr_bnet__Job__{ REL::ID(875576) };
+		inline constexpr std::array<REL::ID, 1> bnet__IUgcUploader{ REL::ID(356553) };
+		inline constexpr std::array<REL::ID, 1> bnet__IsAccountLinkableRequest{ REL::ID(386226) };
+		inline constexpr std::array<REL::ID, 1> bnet__Job{ REL::ID(1093151) };
+		inline constexpr std::array<REL::ID, 2> bnet__JobProcessorCollection{ REL::ID(1126873), REL::ID(156377) };
+		inline constexpr std::array<REL::ID, 3> bnet__ListLegalDocumentsFlow{ REL::ID(941121), REL::ID(1552808), REL::ID(408976) };
+		inline constexpr std::array<REL::ID, 1> bnet__ListRequiredLegalDocumentsRequest{ REL::ID(891991) };
+		inline constexpr std::array<REL::ID, 3> bnet__LogoutFlow{ REL::ID(771180), REL::ID(1382295), REL::ID(239010) };
+		inline constexpr std::array<REL::ID, 3> bnet__Network{ REL::ID(686259), REL::ID(1124534), REL::ID(1077969) };
+		inline constexpr std::array<REL::ID, 3> bnet__NetworkLoop{ REL::ID(418093), REL::ID(1029624), REL::ID(1468680) };
+		inline constexpr std::array<REL::ID, 3> bnet__NewGameSessionFlow{ REL::ID(1022346), REL::ID(51634), REL::ID(490382) };
+		inline constexpr std::array<REL::ID, 2> bnet__Parallel_bnet__ta__NonThreadSafe_bnet__ta__ErrorPropagation_{ REL::ID(1061340), REL::ID(90673) };
+		inline constexpr std::array<REL::ID, 2> bnet__Parallel_bnet__ta__ThreadSafe_bnet__ta__NoErrorPropagation_{ REL::ID(1140727), REL::ID(170252) };
+		inline constexpr std::array<REL::ID, 1> bnet__ProducerConsumerQueue_bnet__UniquePtr_bnet__BaseCallback__bnet__ta__ThreadSafe_{ REL::ID(1264617) };
+		inline constexpr std::array<REL::ID, 1> bnet__ProducerConsumerQueue_bnet__UniquePtr_bnet__Job__bnet__ta__NonThreadSafe_{ REL::ID(1510988) };
+		inline constexpr std::array<REL::ID, 1> bnet__ProducerConsumerQueue_bnet__UniquePtr_bnet__Job__bnet__ta__ThreadSafe_{ REL::ID(1218203) };
+		inline constexpr std::array<REL::ID, 1> bnet__RecoverPasswordRequest{ REL::ID(149504) };
+		inline constexpr std::array<REL::ID, 1> bnet__RecoverUsernameRequest{ REL::ID(494780) };
+		inline constexpr std::array<REL::ID, 1> bnet__ResendVerificationRequest{ REL::ID(654240) };
+		inline constexpr std::array<REL::ID, 3> bnet__ResumeFlow{ REL::ID(18278), REL::ID(630454), REL::ID(1068844) };
+		inline constexpr std::array<REL::ID, 3> bnet__RetrieveExternalAccountJob{ REL::ID(796416), REL::ID(44612), REL::ID(483475) };
+		inline constexpr std::array<REL::ID, 1> bnet__RetrieveExternalAccountRequest{ REL::ID(983532) };
+		inline constexpr std::array<REL::ID, 2> bnet__Sequence_bnet__ta__NonThreadSafe_bnet__ta__ErrorPropagation_{ REL::ID(1151420), REL::ID(180941) };
+		inline constexpr std::array<REL::ID, 2> bnet__Sequence_bnet__ta__ThreadSafe_bnet__ta__ErrorPropagation_{ REL::ID(1234338), REL::ID(263514) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionAnonymousAccountCreateRequest{ REL::ID(699827) };
+		inline constexpr std::array<REL::ID, 3> bnet__SessionAnonymousCreateFlow{ REL::ID(43701), REL::ID(655637), REL::ID(1094079) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionAuthRequest{ REL::ID(937753) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionExternalAuthRequest{ REL::ID(1148716) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionLogoutRequest{ REL::ID(179442) };
+		inline constexpr std::array<REL::ID, 3> bnet__SessionQuickCreateFlow{ REL::ID(721497), REL::ID(1332385), REL::ID(189374) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionQuickCreateRequest{ REL::ID(246871) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionRefreshRequest{ REL::ID(1506769) };
+		inline constexpr std::array<REL::ID, 3> bnet__SessionResumeFlow{ REL::ID(956789), REL::ID(1568503), REL::ID(424609) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionResumeRequest{ REL::ID(1053904) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionResumeTokenRequest{ REL::ID(244272) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionTokenRequest{ REL::ID(274819) };
+		inline constexpr std::array<REL::ID, 1> bnet__SessionValidateRequest{ REL::ID(94411) };
+		inline constexpr std::array<REL::ID, 1> bnet__Session__GameAccountGameCodeAuthRequest{ REL::ID(887456) };
+		inline constexpr std::array<REL::ID, 1> bnet__Session__GameCodeAuthRequest{ REL::ID(696688) };
+		inline constexpr std::array<REL::ID, 1> bnet__Status__GetExtServerStatusRequest{ REL::ID(1163820) };
+		inline constexpr std::array<REL::ID, 1> bnet__SteamExternalAuthInfo{ REL::ID(665868) };
+		inline constexpr std::array<REL::ID, 3> bnet__SuspendFlow{ REL::ID(1497318), REL::ID(526278), REL::ID(964930) };
+		inline constexpr std::array<REL::ID, 1> bnet__TokenUpgradeRequest{ REL::ID(748575) };
+		inline constexpr std::array<REL::ID, 1> bnet__TwitchAccountInfoRequest{ REL::ID(1241145) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcAddReleaseNoteRequest{ REL::ID(1250008) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcAddVideoRequest{ REL::ID(368985) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcArgLessRequest{ REL::ID(772856) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcBrowseRequest{ REL::ID(707340) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcCancelUploadRequest{ REL::ID(165628) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcCategoryCountRequest{ REL::ID(1063043) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcChunkUploadRequest{ REL::ID(894799) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcChunkedUploadCompletionRequest{ REL::ID(151865) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcChunkedUploadInitiationRequest{ REL::ID(1001568) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcContentRequest{ REL::ID(594035) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcContentUploadDetailsRequest{ REL::ID(646009) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcContentUploadRequest{ REL::ID(662811) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcCreationRequest{ REL::ID(856779) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcEditRequest{ REL::ID(124547) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcFlagRequest{ REL::ID(1333548) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcImageUploadRequest{ REL::ID(1260420) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListBlacklistedRequest{ REL::ID(1027944) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListByEntitlementIdsRequest{ REL::ID(95572) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListCategoriesRequest{ REL::ID(639947) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListContentRequest{ REL::ID(1479339) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListDlcRequest{ REL::ID(757733) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListFeaturedContentRequest{ REL::ID(123126) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListFollowedAuthorRequest{ REL::ID(246939) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcListNotificationRequest{ REL::ID(126174) };
+		inline constexpr std::array<REL::ID, 3> bnet__UgcMtxPurchaseFlow{ REL::ID(1362098), REL::ID(391541), REL::ID(830407) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcNotificationAcknowledgeRequest{ REL::ID(81873) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcPreviewUploadRequest{ REL::ID(427175) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcQueryRequest{ REL::ID(1557253) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcRateRequest{ REL::ID(1104557) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcRemoveReleaseNoteRequest{ REL::ID(1394839) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcUpdateReleaseNoteRequest{ REL::ID(969945) };
+		inline constexpr std::array<REL::ID, 1> bnet__UgcUploadRequest_bnet__Callback_bnet__UgcType__UploadStatus_bnet__HttpResponseInfo__{ REL::ID(317062) };
+		inline constexpr std::array<REL::ID, 1> bnet__Ugc__ListPlatformsRequest{ REL::ID(1406999) };
+		inline constexpr std::array<REL::ID, 1> bnet__Ugc__ListProductsRequest{ REL::ID(1165701) };
+		inline constexpr std::array<REL::ID, 1> bnet__Ugc__RefreshEntitlementRequest{ REL::ID(1381087) };
+		inline constexpr std::array<REL::ID, 3> bnet__UnlinkAccountFlow{ REL::ID(632679), REL::ID(1244150), REL::ID(100503) };
+		inline constexpr std::array<REL::ID, 3> bnet__UserCredentialsAuthenticationFlow{ REL::ID(1301911), REL::ID(331295), REL::ID(770190) };
+		inline constexpr std::array<REL::ID, 2> bnet__UserProcessor{ REL::ID(1451825), REL::ID(480906) };
+		inline constexpr std::array<REL::ID, 2> bnet__UserProcessorCollection{ REL::ID(76793), REL::ID(688527) };
+		inline constexpr std::array<REL::ID, 2> bnet__UserQueue{ REL::ID(608855), REL::ID(1220491) };
+		inline constexpr std::array<REL::ID, 1> bnet__UsernameValidationRequest{ REL::ID(1402845) };
+		inline constexpr std::array<REL::ID, 1> bnet__VCCS__Catalog__GetItemRequest{ REL::ID(561486) };
+		inline constexpr std::array<REL::ID, 1> bnet__VCCS__Catalog__ListItemsRequest{ REL::ID(223686) };
+		inline constexpr std::array<REL::ID, 1> bnet__VCCS__Fulfillment__UpdateFirstPartyEntitlementRequest{ REL::ID(989083) };
+		inline constexpr std::array<REL::ID, 1> bnet__VCCS__Wallet__BalanceRequest{ REL::ID(515406) };
+		inline constexpr std::array<REL::ID, 1> bnet__VCCS__Wallet__PurchaseRequest{ REL::ID(208316) };
+		inline constexpr std::array<REL::ID, 1> bnet__VerifyFingerprintRequest{ REL::ID(152631) };
+		inline constexpr std::array<REL::ID, 1> bnet__VerifyLinkRequest{ REL::ID(1188990) };
+		inline constexpr std::array<REL::ID, 2> bnet__WinHttpTransport{ REL::ID(291638), REL::ID(245274) };
+		inline constexpr std::array<REL::ID, 2> bnet___detail__Composite{ REL::ID(1523066), REL::ID(552364) };
+		inline constexpr std::array<REL::ID, 2> bnet___detail__implComposite_bnet__ta__NonThreadSafe_{ REL::ID(460113), REL::ID(1071905) };
+		inline constexpr std::array<REL::ID, 2> bnet___detail__implComposite_bnet__ta__ThreadSafe_{ REL::ID(622590), REL::ID(1234109) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__AsyncOperation{ REL::ID(945803) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__FixedPool_152_50_{ REL::ID(873003) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__FixedPool_163840_3_{ REL::ID(214600) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__FixedPool_432_50_{ REL::ID(1437915) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__IPool{ REL::ID(196141) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__Observable_bnet___impl__AsyncOperation_bnet__BNetError_{ REL::ID(619618) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__OneToManyObservable_bnet__ConfigurationEntry_{ REL::ID(69869) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__OneToManyObserver_bnet__ConfigurationEntry_{ REL::ID(1404279) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__RefCount{ REL::ID(774746) };
+		inline constexpr std::array<REL::ID, 1> bnet___impl__SharedMutex{ REL::ID(1213519) };
+	}
+}
@@ -0,0 +1,1256 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> CCallResult_BSSteamSystemUtility_EncryptedAppTicketResponse_t_{ REL::ID(1397550) };
+		inline constexpr std::array<REL::ID, 1> CCallbackBase{ REL::ID(1570756) };
+		inline constexpr std::array<REL::ID, 1> CCallback_BSSteamSystemUtility_DlcInstalled_t_0_{ REL::ID(520292) };
+		inline constexpr std::array<REL::ID, 1> CCallback_BSSteamSystemUtility_GameOverlayActivated_t_0_{ REL::ID(1225210) };
+		inline constexpr std::array<REL::ID, 1> CachedRaycastData{ REL::ID(841533) };
+		inline constexpr std::array<REL::ID, 1> CalcContainerWeight{ REL::ID(801180) };
+		inline constexpr std::array<REL::ID, 1> CalmEffect{ REL::ID(695351) };
+		inline constexpr std::array<REL::ID, 1> CameraOverrideStartHandler{ REL::ID(1112891) };
+		inline constexpr std::array<REL::ID, 1> CameraOverrideStopHandler{ REL::ID(189076) };
+		inline constexpr std::array<REL::ID, 1> CameraShakeHandler{ REL::ID(665996) };
+		inline constexpr std::array<REL::ID, 1> CameraZoomHandler{ REL::ID(39218) };
+		inline constexpr std::array<REL::ID, 1> CellHfCollision{ REL::ID(224587) };
+		inline constexpr std::array<REL::ID, 1> CellLoaderTask{ REL::ID(1078181) };
+		inline constexpr std::array<REL::ID, 9> ChainExplosion{ REL::ID(276490), REL::ID(287041), REL::ID(945283), REL::ID(20750), REL::ID(679793), REL::ID(1337209), REL::ID(931547), REL::ID(445915), REL::ID(1496800) };
+		inline constexpr std::array<REL::ID, 1> ChairEnterHandler{ REL::ID(1239177) };
+		inline constexpr std::array<REL::ID, 1> ChairFurnitureExitHandler{ REL::ID(1364835) };
+		inline constexpr std::array<REL::ID, 1> CharacterCollisionHandler{ REL::ID(386412) };
+		inline constexpr std::array<REL::ID, 1> CharacterCollisionMessagePlayerAdapter{ REL::ID(1275710) };
+		inline constexpr std::array<REL::ID, 1> CharacterEvent{ REL::ID(1406176) };
+		inline constexpr std::array<REL::ID, 1> CheckFastTravelCommand{ REL::ID(647450) };
+		inline constexpr std::array<REL::ID, 1> CheckGoalReachedFunctor{ REL::ID(1515503) };
+		inline constexpr std::array<REL::ID, 1> CheckHardcoreFastTravelCommand{ REL::ID(479824) };
+		inline constexpr std::array<REL::ID, 1> CheckLineOfSightFilterMisc{ REL::ID(1490985) };
+		inline constexpr std::array<REL::ID, 1> CheckParameterReachedFunctor{ REL::ID(418192) };
+		inline constexpr std::array<REL::ID, 1> CheckStoppedMovingFunctor{ REL::ID(1029720) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___Actor3DQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(881846) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___AnimationQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(1068315) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___BSSubBehaviorGraphSingletonDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(1107900) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___BaseObjectQueuePolicy_A0x488c7b61__FormPointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(1241365) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___BehaviorGraphQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(1359908) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___BipedAnimQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(1054618) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___CloneReserverQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(867940) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___GlobalTransitionDataQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(658770) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___MovieResourceQueuePolicy_A0x488c7b61__MovieResourceCleanupPolicy_DoNothingProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy_{ REL::ID(1213955) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___MuzzleFlashQueuePolicy_A0x488c7b61__PointerCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(1040851) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___QueuedFileQueuePolicy_DoNothingCleanupPolicy_DoNothingProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(695790) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___ReferenceQueuePolicy_A0x488c7b61__ReferenceHandleCleanupPolicy_A0x488c7b61__ReferenceHandleProcessPolicy_A0x488c7b61__QueuePostCleanupPolicy_{ REL::ID(709688) };
+		inline constexpr std::array<REL::ID, 1> CleanupQueue___TempEffectQueuePolicy_DoNothingCleanupPolicy_A0x488c7b61__TempEffectProcessPolicy_DoNothingPostCleanupPolicy_{ REL::ID(522721) };
+		inline constexpr std::array<REL::ID, 1> ClearIdleCommand{ REL::ID(162026) };
+		inline constexpr std::array<REL::ID, 1> ClickHandler{ REL::ID(1009997) };
+		inline constexpr std::array<REL::ID, 1> CloakEffect{ REL::ID(492709) };
+		inline constexpr std::array<REL::ID, 1> Clouds{ REL::ID(800360) };
+		inline constexpr std::array<REL::ID, 1> CollectionAnimationSpeedContour{ REL::ID(1544492) };
+		inline constexpr std::array<REL::ID, 1> CombatAcquireSearchDebugData{ REL::ID(221664) };
+		inline constexpr std::array<REL::ID, 1> CombatAimController{ REL::ID(702092) };
+		inline constexpr std::array<REL::ID, 1> CombatAimControllerBase{ REL::ID(967565) };
+		inline constexpr std::array<REL::ID, 1> CombatAnimatedPath{ REL::ID(130136) };
+		inline constexpr std::array<REL::ID, 1> CombatApproachTargetPathController{ REL::ID(540690) };
+		inline constexpr std::array<REL::ID, 1> CombatArea{ REL::ID(312226) };
+		inline constexpr std::array<REL::ID, 1> CombatAreaHoldPosition{ REL::ID(470605) };
+		inline constexpr std::array<REL::ID, 1> CombatAreaReference{ REL::ID(1189376) };
+		inline constexpr std::array<REL::ID, 1> CombatAreaShape{ REL::ID(658055) };
+		inline constexpr std::array<REL::ID, 1> CombatAreaStandard{ REL::ID(830101) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorMoveInCover{ REL::ID(934890) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorResource{ REL::ID(284923) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTree{ REL::ID(1167882) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeAcquireObject{ REL::ID(1491557) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeAction{ REL::ID(191352) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeActionEquipmentSelector{ REL::ID(756200) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeAvoidThreat{ REL::ID(119181) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeBlock{ REL::ID(543791) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeBow{ REL::ID(1463818) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeChargingCloseMovement{ REL::ID(318130) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeChargingMovement{ REL::ID(532274) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCheckUnreachableTarget{ REL::ID(135068) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCloseMovement{ REL::ID(400443) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCombat{ REL::ID(668954) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpEquals___{ REL::ID(191086) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_float_CombatBehaviorContextCover____void___float_OpLessThan___{ REL::ID(1197325) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextSearch_unsignedint_CombatBehaviorContextSearch____void___unsignedint_OpGreaterThan___{ REL::ID(1157368) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatState_unsignedint_CombatState____void___int_OpGreaterThan___{ REL::ID(943036) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ REL::ID(877749) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc1_float___Actor__CombatBehaviorTree__CombatBehaviorAttacker_____{ REL::ID(819862) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection______{ REL::ID(569994) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc2_float___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget_____{ REL::ID(913489) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorFunc_float___void______{ REL::ID(911494) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextChargingMovement_float_CombatBehaviorContextChargingMovement____bool__bool_____{ REL::ID(1564476) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_float_CombatBehaviorContextChargingMovement____void______{ REL::ID(1045942) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextGrenade_float_CombatBehaviorContextGrenade____void______{ REL::ID(1409596) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextMagic_float_CombatBehaviorContextMagic____void______{ REL::ID(637401) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorFunc1_bool___float__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextThrow_float_CombatBehaviorContextThrow____void______{ REL::ID(685611) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBlackboard_bool_CombatBlackboard____CombatBlackboardFlagconst__CombatBlackboardFlag___{ REL::ID(1572131) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_AIProcess_bool_AIProcess____void____{ REL::ID(78736) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_ActorState____void____{ REL::ID(107150) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void____{ REL::ID(1088054) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_bool_CombatBehaviorContextAcquireObject____void____{ REL::ID(610809) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAvoidThreat_bool_CombatBehaviorContextAvoidThreat____void____{ REL::ID(1023388) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCloseMovement_bool_CombatBehaviorContextCloseMovement____void____{ REL::ID(831025) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void____{ REL::ID(133149) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextFlankingMovement_bool_CombatBehaviorContextFlankingMovement____void____{ REL::ID(1259329) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextFlee_bool_CombatBehaviorContextFlee____void____{ REL::ID(37627) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextGun_bool_CombatBehaviorContextGun____void____{ REL::ID(287615) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextRangedMovement_bool_CombatBehaviorContextRangedMovement____void____{ REL::ID(747768) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_bool_CombatBehaviorEquipContext____void____{ REL::ID(818720) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorFunc2_bool___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget__OpNot___{ REL::ID(723168) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc1_CombatGroup_bool_CombatGroup____Actor__CombatBehaviorTree__CombatBehaviorTarget__OpNot___{ REL::ID(639252) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeConditionalNode_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void___OpNot___{ REL::ID(146987) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextBow_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ REL::ID(1057681) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextGrenade_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ REL::ID(387083) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextGun_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ REL::ID(1448136) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextMagic_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ REL::ID(160397) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextThrow_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ REL::ID(699526) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorContextUsePotion_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____{ REL::ID(344048) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode1_CombatBehaviorEquipContext_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorThread_unsignedint_CombatBehaviorThread____void____{ REL::ID(887400) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode2_CombatBehaviorContextBlock_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____CombatBehaviorContextMelee__ATTACK_TYPE_{ REL::ID(968449) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode2_CombatBehaviorContextMelee_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void____CombatBehaviorContextMelee__ATTACK_TYPE_{ REL::ID(1286976) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNodeBase{ REL::ID(107209) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextAcquireObject_{ REL::ID(1197866) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextAvoidThreat_{ REL::ID(560476) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextBlock_{ REL::ID(1500970) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextBow_{ REL::ID(6968) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextChargingMovement_{ REL::ID(654803) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextCloseMovement_{ REL::ID(1404109) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextCover_{ REL::ID(830253) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextFindAttackLocation_{ REL::ID(690713) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextFlankingMovement_{ REL::ID(264056) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextFlee_{ REL::ID(1225843) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextGrenade_{ REL::ID(919032) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextGun_{ REL::ID(397731) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextHide_{ REL::ID(1129242) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextMagic_{ REL::ID(692580) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextMelee_{ REL::ID(236801) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextMovementRequest_{ REL::ID(1346953) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextRangedMovement_{ REL::ID(1348076) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextSearch_{ REL::ID(1426140) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextThrow_{ REL::ID(1231155) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorContextUsePotion_{ REL::ID(876035) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeCreateContextNode_CombatBehaviorEquipContext_{ REL::ID(1419198) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeFindAttackLocation{ REL::ID(893758) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeFindValidLocation{ REL::ID(1349435) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeFlankingMovement{ REL::ID(122504) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeFlee{ REL::ID(738255) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeFlight{ REL::ID(1093462) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeGrenade{ REL::ID(1058907) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeGun{ REL::ID(238861) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeHide{ REL::ID(104331) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeLinkNode{ REL::ID(336974) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeLowCombat{ REL::ID(1260242) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeMagic{ REL::ID(1504366) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeMelee{ REL::ID(1174609) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeMovement{ REL::ID(402538) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeMovementRequest{ REL::ID(1533805) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNode{ REL::ID(641447) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeCondition_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpEquals___{ REL::ID(404681) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void____{ REL::ID(1293421) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextFlee_bool_CombatBehaviorContextFlee____void____{ REL::ID(1212160) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextMovementRequest_bool_CombatBehaviorContextMovementRequest____void____{ REL::ID(1333182) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_bool_CombatBehaviorEquipContext____void____{ REL::ID(1364061) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void____{ REL::ID(79181) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAvoidThreat_bool_CombatBehaviorContextAvoidThreat____void___OpNot___{ REL::ID(546825) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeEvaluateFunction_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___OpNot___{ REL::ID(638828) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeExecuteFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextChargingMovement_void_CombatBehaviorContextChargingMovement____float__float___{ REL::ID(1010583) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeExecuteFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextSearch_void_CombatBehaviorContextSearch____CombatCoverLocation__std__nullptr_t___{ REL::ID(825638) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeExecuteFunction_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_void_CombatBehaviorContextChargingMovement____void____{ REL::ID(1570507) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorAcquireFurniture_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_CombatAcquireObjectconst_CombatBehaviorContextAcquireObject____void____{ REL::ID(1156436) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorAcquireItem_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_CombatAcquireObjectconst_CombatBehaviorContextAcquireObject____void____{ REL::ID(638374) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorCastConcentrationSpell_bool_{ REL::ID(1183048) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorCastImmediateSpell_bool_{ REL::ID(1196864) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorChargePast_bool_{ REL::ID(423539) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorCheckRangedTarget__CombatBehaviorExpression_CombatBehaviorFunc1_float___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ REL::ID(229347) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorTrackTarget__float_{ REL::ID(1378557) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorDynamicSelector_ConditionalChildSelector__float_{ REL::ID(437212) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorEnableBlackboardFlag_CombatBlackboardFlag_{ REL::ID(65389) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorFindCover_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ REL::ID(679380) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorFlee_float_{ REL::ID(1170622) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorFollowPath_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_NiPointer_CombatPath__CombatBehaviorContextAcquireObject____void____{ REL::ID(119894) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorIdle_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ REL::ID(342202) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorIdle_CombatBehaviorExpression_CombatBehaviorFunc2_float___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget___{ REL::ID(894427) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorIdle_float_{ REL::ID(396135) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorLandNearby_float_{ REL::ID(1441214) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorLand_float_{ REL::ID(922939) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorMovementIdle_float_{ REL::ID(312700) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorRepeat_CombatBehaviorRepeat__FLAGS_{ REL::ID(936750) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorRepeat_float_{ REL::ID(147501) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorResetResource_BSFixedString_{ REL::ID(1555717) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorSearchCenter_CombatSearchLocation__PRIORITY_{ REL::ID(321025) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorSearchInvestigateFromCover_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ REL::ID(839359) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorSearchLocation_CombatSearchLocation__PRIORITY_{ REL::ID(348444) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorSearchWander_CombatSearchLocation__PRIORITY_{ REL::ID(1384899) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorSearch_CombatSearchLocation__PRIORITY_{ REL::ID(866663) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorWaitBehindCover_CombatBehaviorExpression_CombatBehaviorFunc1_float___SettingT_GameSettingCollection___SettingT_GameSettingCollection____{ REL::ID(270854) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject1_CombatBehaviorWatchTarget_float_{ REL::ID(209154) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorAcquireResource_BSFixedString_CombatBehaviorResource__PRIORITY_{ REL::ID(708607) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorChangeResourcePriority_BSFixedString_CombatBehaviorResource__PRIORITY_{ REL::ID(775237) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorFaceAngle_float_bool_{ REL::ID(92895) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorMoveToReference_CombatBehaviorExpression_CombatBehaviorFunc_TESObjectREFR___void____float_{ REL::ID(583800) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorSetBlackboardData_CombatBlackboardKey_AITimeStamp__CombatBehaviorExpression_CombatBehaviorFunc_float___void____{ REL::ID(117056) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorSetBlackboardFlag_CombatBlackboardFlag_bool_{ REL::ID(520047) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorSpawnParallel_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatInventory_unsignedint_CombatInventory____void____CombatBehaviorParallel__FLAGS_{ REL::ID(369072) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject2_CombatBehaviorWithdraw_CombatPath__SPEED_CombatPath__SPEED_{ REL::ID(1515507) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject3_CombatBehaviorAcquireResource_BSFixedString_CombatBehaviorResource__PRIORITY_CombatBehaviorAcquireResource__FLAGS_{ REL::ID(1183997) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject3_CombatBehaviorAnimate_CombatAnimation__ANIM_int_bool_{ REL::ID(1156) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject3_CombatBehaviorWithdraw_CombatPath__SPEED_CombatPath__SPEED_bool_{ REL::ID(1501862) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAOEAttack_{ REL::ID(1556663) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireFurniture_{ REL::ID(106233) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireItem_{ REL::ID(1170186) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireOptimalRange_{ REL::ID(1334286) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAcquireResource_{ REL::ID(1240333) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAdjustRange_{ REL::ID(789024) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAdvance_{ REL::ID(1474236) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAnimate_{ REL::ID(533918) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAttackFromCover_{ REL::ID(257025) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAttackLow_{ REL::ID(681974) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAttack_{ REL::ID(1273277) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAvoidThreatCover_{ REL::ID(1051034) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorAvoidThreat_{ REL::ID(1569533) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBackoff_{ REL::ID(354799) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBash_{ REL::ID(954805) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlindFireFromCover_{ REL::ID(775451) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlockAttack_{ REL::ID(436263) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlockThreat_{ REL::ID(408856) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBlock_{ REL::ID(1473261) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorBowAttack_{ REL::ID(525827) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCastConcentrationSpell_{ REL::ID(132692) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCastImmediateSpell_{ REL::ID(146513) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeCoverDirection_{ REL::ID(1279735) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeCoverPosition_{ REL::ID(160843) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeCoverStance_{ REL::ID(1224910) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChangeResourcePriority_{ REL::ID(1306899) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChargePast_{ REL::ID(478643) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChase_{ REL::ID(1286743) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCheckUnreachableTarget_{ REL::ID(997880) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_ConditionalChildSelector__{ REL::ID(872102) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_IndexChildSelector__{ REL::ID(916025) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_RandomChanceChildSelector__{ REL::ID(382374) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_RandomChoiceChildSelector__{ REL::ID(1320836) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorChildSelector_ValueChildSelector__{ REL::ID(873538) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCircleDistant_{ REL::ID(326433) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCircle_{ REL::ID(1418732) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorComposite_CombatBehaviorCrouch_CombatBehaviorCheckRangedTarget__{ REL::ID(242990) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorCheckRangedTarget__{ REL::ID(761448) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorComposite_CombatBehaviorMovementIdle_CombatBehaviorTrackTarget__{ REL::ID(328536) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverAdvance_{ REL::ID(188456) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverFlank_{ REL::ID(1252346) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverPairedRush_{ REL::ID(734311) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorCoverRush_{ REL::ID(706908) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorDistract_{ REL::ID(250298) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorDiveBomb_{ REL::ID(964247) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorDodgeThreat_{ REL::ID(532953) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorDynamicConditionalNode_{ REL::ID(355261) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorDynamicSelector_ConditionalChildSelector__{ REL::ID(969350) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorEnableBlackboardFlag_{ REL::ID(597578) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorEquipObject_{ REL::ID(1391666) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorEquipRangedWeapon_{ REL::ID(327865) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorEquipSpell_{ REL::ID(846107) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorEvadeThreat_{ REL::ID(14105) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFaceAngle_{ REL::ID(625049) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackSelector_NextChildSelector__{ REL::ID(640998) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackSelector_RandomChanceChildSelector__{ REL::ID(215870) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackSelector_WeightedRandomChildSelector__{ REL::ID(991538) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallbackToRanged_{ REL::ID(1390255) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFallback_{ REL::ID(900724) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindAllyAttackLocation_{ REL::ID(130857) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindAttackLocation_{ REL::ID(676980) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindCover_{ REL::ID(298088) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindHoldPositionAttackLocation_{ REL::ID(1194962) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindLateralAttackLocation_{ REL::ID(158542) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindObject_{ REL::ID(665925) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindValidLocationLargeActor_{ REL::ID(1489171) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindValidLocationOnNavmesh_{ REL::ID(424702) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFindValidLocation_{ REL::ID(970479) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlankDistant_{ REL::ID(222892) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlank_{ REL::ID(768667) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFleeThroughDoor_{ REL::ID(1198328) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFleeToAlly_{ REL::ID(680352) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFleeToCover_{ REL::ID(134098) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlee_{ REL::ID(652605) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlipDynamicObject_{ REL::ID(1038120) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFlyingAttack_{ REL::ID(418392) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorFollowPath_{ REL::ID(652116) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorForceFail_{ REL::ID(1488002) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorForceSuccess_{ REL::ID(51515) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGrenadeFlushTarget_{ REL::ID(373325) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGrenadeThrowAtGroup_{ REL::ID(891671) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGrenadeThrow_{ REL::ID(1437248) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGroundAttack_{ REL::ID(1510341) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunBurstFire_{ REL::ID(1406614) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunFireCharge_{ REL::ID(860998) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunFire_{ REL::ID(370242) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunReloadBehindCover_{ REL::ID(315291) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunReload_{ REL::ID(833577) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunSuppressiveBurstFire_{ REL::ID(342720) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunSuppressiveFireCharge_{ REL::ID(1379073) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorGunSuppressiveFire_{ REL::ID(888558) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorHide_{ REL::ID(1143059) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorHover_{ REL::ID(445774) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorIdle_{ REL::ID(928161) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorIgnoreFailure_{ REL::ID(761658) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorImmediateFallbackSelector_NextChildSelector__{ REL::ID(27911) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorLandNearby_{ REL::ID(390943) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorLand_{ REL::ID(1455142) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorLoopFallbackSelector_NextChildSelector__{ REL::ID(1434111) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorLoop_{ REL::ID(816593) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorMaintainOptimalRange_{ REL::ID(816359) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorMoveToReference_{ REL::ID(1115544) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorMovementIdle_{ REL::ID(844737) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorMovementRequest_{ REL::ID(176362) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorOrbitDistant_{ REL::ID(1537700) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorOrbit_{ REL::ID(473445) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorPanic_{ REL::ID(694014) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorParallel_{ REL::ID(1280252) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorParry_{ REL::ID(927197) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorPause_{ REL::ID(832388) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorPerchAttack_{ REL::ID(1482900) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorPrepareDualCast_{ REL::ID(1210739) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorPursueTarget_{ REL::ID(1199929) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorRepeat_{ REL::ID(122525) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorReposition_{ REL::ID(1446461) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorResetResource_{ REL::ID(505299) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorRetargetAttack_{ REL::ID(209373) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorReturnToCombatArea_{ REL::ID(452079) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchCenter_{ REL::ID(853057) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchInvestigateDoor_{ REL::ID(307292) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchInvestigateFromCover_{ REL::ID(1371093) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchLocation_{ REL::ID(880491) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchTakeCover_{ REL::ID(362226) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearchWander_{ REL::ID(334862) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSearch_{ REL::ID(1398606) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSequence_{ REL::ID(1159045) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSetBlackboardData_{ REL::ID(649305) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSetBlackboardFlag_{ REL::ID(1051991) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSideswipe_{ REL::ID(983020) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSpawnParallel_{ REL::ID(901162) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSpecialAttack_{ REL::ID(755247) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSprintAway_{ REL::ID(996763) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorStalk_{ REL::ID(1314171) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorStrafe_{ REL::ID(270627) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorSurround_{ REL::ID(409776) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorTakeoff_{ REL::ID(1019222) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorThrow_{ REL::ID(167251) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorTrackTarget_{ REL::ID(106684) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorUsePotion_{ REL::ID(1394158) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorUseTurret_{ REL::ID(624617) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitBehindCover_{ REL::ID(1334513) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForCondition_{ REL::ID(1392309) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForEvent_CombatNewThreatEvent__{ REL::ID(41892) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForEvent_CombatUnreachableTargetAddedEventconst__{ REL::ID(1516589) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWaitForMovementRequest_{ REL::ID(815254) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWatchTarget_{ REL::ID(741282) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObjectBase_CombatBehaviorWithdraw_{ REL::ID(492342) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAOEAttack_{ REL::ID(1024325) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAcquireOptimalRange_{ REL::ID(802708) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAdjustRange_{ REL::ID(256805) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAdvance_{ REL::ID(941918) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAttackFromCover_{ REL::ID(1307125) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAttackLow_{ REL::ID(149594) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAttack_{ REL::ID(741498) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAvoidThreatCover_{ REL::ID(519092) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorAvoidThreat_{ REL::ID(1037170) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBackoff_{ REL::ID(1405035) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBash_{ REL::ID(422636) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBlindFireFromCover_{ REL::ID(243213) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBlockAttack_{ REL::ID(1487070) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBlockThreat_{ REL::ID(1459358) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBlock_{ REL::ID(940979) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorBowAttack_{ REL::ID(1576227) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCastConcentrationSpell_{ REL::ID(651206) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCastImmediateSpell_{ REL::ID(664963) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChangeCoverDirection_{ REL::ID(747973) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChangeCoverPosition_{ REL::ID(1211196) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChangeCoverStance_{ REL::ID(693021) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChargePast_{ REL::ID(1529142) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChase_{ REL::ID(755021) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCheckUnreachableTarget_{ REL::ID(465833) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_ConditionalChildSelector__{ REL::ID(340187) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_IndexChildSelector__{ REL::ID(383991) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_RandomChanceChildSelector__{ REL::ID(1432451) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_RandomChoiceChildSelector__{ REL::ID(789231) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorChildSelector_ValueChildSelector__{ REL::ID(341563) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCircleDistant_{ REL::ID(1376491) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCircle_{ REL::ID(886938) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorComposite_CombatBehaviorCrouch_CombatBehaviorCheckRangedTarget__{ REL::ID(1293210) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCoverAdvance_{ REL::ID(1238596) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCoverFlank_{ REL::ID(720629) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCoverPairedRush_{ REL::ID(202117) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorCoverRush_{ REL::ID(174677) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorDistract_{ REL::ID(1300413) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorDiveBomb_{ REL::ID(432012) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorDodgeThreat_{ REL::ID(213) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorDynamicConditionalNode_{ REL::ID(1405468) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorEquipObject_{ REL::ID(859828) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorEquipRangedWeapon_{ REL::ID(1377912) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorEquipSpell_{ REL::ID(314154) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorEvadeThreat_{ REL::ID(1064722) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFallbackSelector_NextChildSelector__{ REL::ID(108821) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFallbackSelector_RandomChanceChildSelector__{ REL::ID(1266027) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFallbackSelector_WeightedRandomChildSelector__{ REL::ID(459506) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFallbackToRanged_{ REL::ID(858448) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFallback_{ REL::ID(368617) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindAllyAttackLocation_{ REL::ID(1181165) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindAttackLocation_{ REL::ID(144607) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindCover_{ REL::ID(1348296) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindHoldPositionAttackLocation_{ REL::ID(663121) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindLateralAttackLocation_{ REL::ID(1208841) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindObject_{ REL::ID(133655) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindValidLocationLargeActor_{ REL::ID(956856) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindValidLocationOnNavmesh_{ REL::ID(1475378) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFindValidLocation_{ REL::ID(438339) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFlankDistant_{ REL::ID(1273034) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFlank_{ REL::ID(236596) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFleeThroughDoor_{ REL::ID(666363) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFleeToAlly_{ REL::ID(147936) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFleeToCover_{ REL::ID(1184430) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFlee_{ REL::ID(120344) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFlipDynamicObject_{ REL::ID(506238) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorFlyingAttack_{ REL::ID(1468977) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorForceFail_{ REL::ID(955742) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorForceSuccess_{ REL::ID(1101929) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGrenadeFlushTarget_{ REL::ID(1423431) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGrenadeThrowAtGroup_{ REL::ID(359472) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGrenadeThrow_{ REL::ID(905369) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGroundAttack_{ REL::ID(977912) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunBurstFire_{ REL::ID(874692) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunFireCharge_{ REL::ID(329046) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunFire_{ REL::ID(1420319) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunReloadBehindCover_{ REL::ID(1365245) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunReload_{ REL::ID(301401) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunSuppressiveBurstFire_{ REL::ID(1392801) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunSuppressiveFireCharge_{ REL::ID(847220) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorGunSuppressiveFire_{ REL::ID(356415) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorHide_{ REL::ID(611252) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorHover_{ REL::ID(1496662) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorIgnoreFailure_{ REL::ID(229567) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorImmediateFallbackSelector_NextChildSelector__{ REL::ID(1078523) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorLand_{ REL::ID(909360) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorLoopFallbackSelector_NextChildSelector__{ REL::ID(902326) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorLoop_{ REL::ID(284420) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorMaintainOptimalRange_{ REL::ID(284204) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorMovementRequest_{ REL::ID(1226556) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorOrbitDistant_{ REL::ID(1005402) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorOrbit_{ REL::ID(1524050) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorPanic_{ REL::ID(161796) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorParallel_{ REL::ID(748514) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorParry_{ REL::ID(395160) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorPause_{ REL::ID(300248) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorPerchAttack_{ REL::ID(950568) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorPrepareDualCast_{ REL::ID(678928) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorPursueTarget_{ REL::ID(667968) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorRepeat_{ REL::ID(1172775) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorReposition_{ REL::ID(914435) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorRetargetAttack_{ REL::ID(1259557) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorReturnToCombatArea_{ REL::ID(1502998) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSearchInvestigateDoor_{ REL::ID(1357328) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSearchTakeCover_{ REL::ID(1412388) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSequence_{ REL::ID(627224) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSideswipe_{ REL::ID(450931) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSpecialAttack_{ REL::ID(223103) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSprintAway_{ REL::ID(464664) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorStalk_{ REL::ID(782473) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorStrafe_{ REL::ID(1320627) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorSurround_{ REL::ID(1460341) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorTakeoff_{ REL::ID(487229) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorThrow_{ REL::ID(1217580) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorTrackTarget_{ REL::ID(1156910) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorUsePotion_{ REL::ID(862314) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorUseTurret_{ REL::ID(92464) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorWaitBehindCover_{ REL::ID(802931) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorWaitForCondition_{ REL::ID(860486) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorWaitForEvent_CombatNewThreatEvent__{ REL::ID(1092302) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorWaitForEvent_CombatUnreachableTargetAddedEventconst__{ REL::ID(984131) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorWaitForMovementRequest_{ REL::ID(283091) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeObject_CombatBehaviorWithdraw_{ REL::ID(1542841) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeNodeUpdateFunction_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextSearch_bool_CombatBehaviorContextSearch____void___OpNot___{ REL::ID(293357) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeRangedMovement{ REL::ID(983428) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeReturnToCombatArea{ REL::ID(653619) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeRootNode{ REL::ID(868767) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeSearch{ REL::ID(453705) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeThrow{ REL::ID(1543771) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeUseCover{ REL::ID(290375) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeUsePotion{ REL::ID(1015975) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_float_CombatBehaviorExpression_CombatBehaviorFunc1_float___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ REL::ID(1443407) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_float_CombatBehaviorExpression_CombatBehaviorFunc2_float___Actor_Actor__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget___{ REL::ID(215651) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_float_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_float_CombatBehaviorContextCover____void____{ REL::ID(665405) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_COMBAT_WEAPON_TYPE_{ REL::ID(272961) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpEquals___{ REL::ID(1241234) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void___CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_Actor_FLY_STATE_ActorState____void___FLY_STATE_OpNotEquals___OpOr___{ REL::ID(1364723) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAcquireObject_bool_CombatBehaviorContextAcquireObject____void___bool_OpEquals___{ REL::ID(1142608) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatInventory_float_CombatInventory____void___float_OpGreaterThan___{ REL::ID(1351061) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void____OpOr___{ REL::ID(300903) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___OpNot__CombatBehaviorExpression_CombatBehaviorBinaryExpression_CombatBehaviorFunc2_float___TESObjectREFRconst_TESObjectREFRconst__CombatBehaviorTree__CombatBehaviorAttacker_CombatBehaviorTree__CombatBehaviorTarget__float_OpLessThan___OpAnd___{ REL::ID(654327) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorFunc1_COMBAT_WEAPON_TYPE___CombatInventoryItemconst__CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_NiPointer_CombatInventoryItem_const_CombatBehaviorEquipContext____void______{ REL::ID(805090) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorFunc1_bool___Actor__CombatBehaviorTree__CombatBehaviorAttacker___{ REL::ID(833040) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc1_CombatBehaviorContextChargingMovement_bool_CombatBehaviorContextChargingMovement____bool__bool___{ REL::ID(406805) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_ActorState____void____{ REL::ID(709554) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void____{ REL::ID(1254827) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextAvoidThreat_bool_CombatBehaviorContextAvoidThreat____void____{ REL::ID(491399) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextBlock_bool_CombatBehaviorContextBlock____void____{ REL::ID(1445499) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_bool_CombatBehaviorContextChargingMovement____void____{ REL::ID(1457253) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextChargingMovement_bool_CombatBehaviorContextCloseMovement____void____{ REL::ID(925066) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCloseMovement_bool_CombatBehaviorContextCloseMovement____void____{ REL::ID(1362675) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextCover_bool_CombatBehaviorContextCover____void____{ REL::ID(1183478) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextGun_CombatBehaviorContextGun__ATTACK_TYPE_CombatBehaviorContextGun____void____{ REL::ID(1351553) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorContextMagic_MagicSystem__CastingType_CombatBehaviorContextMagic____void____{ REL::ID(118923) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_CombatInventoryItem__TYPE_CombatBehaviorEquipContext____void____{ REL::ID(286489) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatGroup_bool_CombatGroup____void____{ REL::ID(1172257) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void____{ REL::ID(135743) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorFunc1_bool___Actor__CombatBehaviorTree__CombatBehaviorAttacker__OpNot___{ REL::ID(846737) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc1_CombatController_bool_CombatController____Actor__CombatBehaviorTree__CombatBehaviorAttacker__OpNot___{ REL::ID(1186097) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_Actor_bool_ActorState____void___OpNot___{ REL::ID(1279524) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_Actor_bool_Actor____void___OpNot___{ REL::ID(314813) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatBehaviorEquipContext_bool_CombatBehaviorEquipContext____void___OpNot___{ REL::ID(1350429) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatBehaviorExpression_CombatBehaviorUnaryExpression_CombatBehaviorMemberFunc_CombatState_bool_CombatState____void___OpNot___{ REL::ID(122025) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_CombatInventoryItem__TYPE_{ REL::ID(1336634) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_MagicSystem__CastingType_{ REL::ID(1169256) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNodeT_unsignedint_int_{ REL::ID(500077) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNode_float_{ REL::ID(393070) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeValueNode_unsignedint_{ REL::ID(1032030) };
+		inline constexpr std::array<REL::ID, 1> CombatBehaviorTreeWrapperNode{ REL::ID(639313) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_AITimeStamp_{ REL::ID(1371359) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_AITimer_{ REL::ID(472718) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_BSTSet_BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ REL::ID(444665) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_BSTSet_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ REL::ID(1427601) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_BSTTuple_TESObjectREFR_AITimeStamp__{ REL::ID(1269989) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_CombatSuppressiveFireBehavior_{ REL::ID(780391) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardKey_NiPointer_CombatCoverLocation__{ REL::ID(889775) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMemberBase{ REL::ID(1573296) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_AITimeStamp_{ REL::ID(760346) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_AITimer_{ REL::ID(1443607) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_BSTSet_BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ REL::ID(1415482) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_BSTSet_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSTScatterTableDefaultHashPolicy__{ REL::ID(816435) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_BSTTuple_TESObjectREFR_AITimeStamp__{ REL::ID(658755) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_CombatSuppressiveFireBehavior_{ REL::ID(168858) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatBlackboardMemberBase_NiPointer_CombatCoverLocation__{ REL::ID(278288) };
+		inline constexpr std::array<REL::ID, 1> CombatBlackboardMember_CombatStaticBlackboardMemberBase_AITimer_{ REL::ID(1300634) };
+		inline constexpr std::array<REL::ID, 1> CombatChangePositionPathController{ REL::ID(459914) };
+		inline constexpr std::array<REL::ID, 1> CombatChargingSearchData{ REL::ID(1041903) };
+		inline constexpr std::array<REL::ID, 1> CombatCluster{ REL::ID(1023422) };
+		inline constexpr std::array<REL::ID, 1> CombatCoverLocation{ REL::ID(294890) };
+		inline constexpr std::array<REL::ID, 1> CombatCoverSearch{ REL::ID(1093051) };
+		inline constexpr std::array<REL::ID, 1> CombatCoverSearchDebugData{ REL::ID(892884) };
+		inline constexpr std::array<REL::ID, 1> CombatCoverSearchResult{ REL::ID(1485564) };
+		inline constexpr std::array<REL::ID, 1> CombatCoveredPath{ REL::ID(1480615) };
+		inline constexpr std::array<REL::ID, 1> CombatCoveredPathDebugData{ REL::ID(136466) };
+		inline constexpr std::array<REL::ID, 1> CombatDisableActionController{ REL::ID(1105798) };
+		inline constexpr std::array<REL::ID, 1> CombatDisableAimController{ REL::ID(1019522) };
+		inline constexpr std::array<REL::ID, 1> CombatEnterCoverPathController{ REL::ID(201958) };
+		inline constexpr std::array<REL::ID, 1> CombatFindCoverPathSpeedController{ REL::ID(170038) };
+		inline constexpr std::array<REL::ID, 1> CombatFlankingSearchData{ REL::ID(1565144) };
+		inline constexpr std::array<REL::ID, 1> CombatFollowTargetPathController{ REL::ID(614979) };
+		inline constexpr std::array<REL::ID, 1> CombatFormObject{ REL::ID(749462) };
+		inline constexpr std::array<REL::ID, 1> CombatGroupDetectionListener{ REL::ID(1070127) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItem{ REL::ID(483149) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemComposite{ REL::ID(562819) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemGrenade{ REL::ID(348511) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagic{ REL::ID(1451015) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterArmor_{ REL::ID(903989) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterBoundItem_{ REL::ID(413039) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterChameleon_{ REL::ID(1505107) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterCloak_{ REL::ID(32142) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterDisarm_{ REL::ID(1123914) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterInvisibility_{ REL::ID(1013872) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterLight_{ REL::ID(523328) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterOffensive_{ REL::ID(252652) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterParalyze_{ REL::ID(794159) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterReanimate_{ REL::ID(303086) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterRestore_{ REL::ID(1234200) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterScript_{ REL::ID(1284667) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterStagger_{ REL::ID(633495) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterSummon_{ REL::ID(142548) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterTargetEffect_{ REL::ID(1394453) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemMagic_CombatMagicCasterWard_{ REL::ID(743594) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterArmor_{ REL::ID(358038) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterBoundItem_{ REL::ID(1449808) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterChameleon_{ REL::ID(958979) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterCloak_{ REL::ID(1068922) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterDisarm_{ REL::ID(578402) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterInvisibility_{ REL::ID(468049) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterLight_{ REL::ID(1559967) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterOffensive_{ REL::ID(1289087) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterParalyze_{ REL::ID(248194) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterReanimate_{ REL::ID(1339455) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterRestore_{ REL::ID(688623) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterScript_{ REL::ID(739245) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterStagger_{ REL::ID(87592) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterSummon_{ REL::ID(1179074) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterTargetEffect_{ REL::ID(848909) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemPotion_CombatMagicCasterWard_{ REL::ID(197778) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterArmor_{ REL::ID(876316) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterBoundItem_{ REL::ID(385641) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterChameleon_{ REL::ID(1477543) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterCloak_{ REL::ID(4405) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterDisarm_{ REL::ID(1096594) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterInvisibility_{ REL::ID(986280) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterLight_{ REL::ID(495614) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterOffensive_{ REL::ID(225240) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterParalyze_{ REL::ID(766634) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterReanimate_{ REL::ID(275705) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterRestore_{ REL::ID(1206777) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterScript_{ REL::ID(1257211) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterStagger_{ REL::ID(605908) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterSummon_{ REL::ID(114984) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterTargetEffect_{ REL::ID(1366901) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemScroll_CombatMagicCasterWard_{ REL::ID(716244) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterArmor_{ REL::ID(1422006) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterBoundItem_{ REL::ID(931439) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterChameleon_{ REL::ID(440504) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterCloak_{ REL::ID(551045) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterDisarm_{ REL::ID(59966) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterInvisibility_{ REL::ID(1532366) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterLight_{ REL::ID(1041444) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterOffensive_{ REL::ID(771047) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterParalyze_{ REL::ID(1312084) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterReanimate_{ REL::ID(821493) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterRestore_{ REL::ID(170339) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterScript_{ REL::ID(220753) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterStagger_{ REL::ID(1151502) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterSummon_{ REL::ID(661096) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterTargetEffect_{ REL::ID(330698) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMagicT_CombatInventoryItemStaff_CombatMagicCasterWard_{ REL::ID(1261676) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemMelee{ REL::ID(642400) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemOneHandedBlock{ REL::ID(680870) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemPotion{ REL::ID(318153) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemRanged{ REL::ID(16445) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemScroll{ REL::ID(131568) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemShield{ REL::ID(1305573) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemStaff{ REL::ID(504639) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemThrown{ REL::ID(973741) };
+		inline constexpr std::array<REL::ID, 1> CombatInventoryItemTorch{ REL::ID(493754) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCaster{ REL::ID(1261468) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterArmor{ REL::ID(208255) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterBoundItem{ REL::ID(567473) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterChameleon{ REL::ID(926508) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterCloak{ REL::ID(1299552) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterDisarm{ REL::ID(515336) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterInvisibility{ REL::ID(1285868) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterLight{ REL::ID(501547) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterOffensive{ REL::ID(24180) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterParalyze{ REL::ID(273876) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterReanimate{ REL::ID(633276) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterRestore{ REL::ID(449330) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterScript{ REL::ID(1497190) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterStagger{ REL::ID(874487) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterSummon{ REL::ID(90370) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterTargetEffect{ REL::ID(992061) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicCasterWard{ REL::ID(1247851) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicItemData{ REL::ID(1527547) };
+		inline constexpr std::array<REL::ID, 1> CombatMagicItemSkillChecker{ REL::ID(603326) };
+		inline constexpr std::array<REL::ID, 1> CombatMantlePathController{ REL::ID(547571) };
+		inline constexpr std::array<REL::ID, 1> CombatMatchTargetAimController{ REL::ID(1099200) };
+		inline constexpr std::array<REL::ID, 1> CombatMeleeAimController{ REL::ID(860555) };
+		inline constexpr std::array<REL::ID, 1> CombatMeleeDebugData{ REL::ID(922244) };
+		inline constexpr std::array<REL::ID, 1> CombatMovementRequest{ REL::ID(1374433) };
+		inline constexpr std::array<REL::ID, 1> CombatMovementRequestFollowActor{ REL::ID(403787) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearch{ REL::ID(1139075) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ REL::ID(132244) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(1182582) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ REL::ID(1336169) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyCharge__{ REL::ID(804596) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyCovered_{ REL::ID(720910) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyStandard_{ REL::ID(996971) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(464904) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ REL::ID(1218258) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyDistract__{ REL::ID(686313) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1339895) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(808317) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ REL::ID(209640) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(1259834) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ REL::ID(824223) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(291964) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1489896) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(957566) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ REL::ID(743098) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(210960) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ REL::ID(1231846) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(700193) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ REL::ID(1245621) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyFlank__{ REL::ID(713931) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ REL::ID(729200) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(197070) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ REL::ID(100068) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(1150174) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1115982) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(584263) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyStandard_{ REL::ID(137785) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(1188142) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ REL::ID(1294143) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(762417) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ REL::ID(756851) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(224736) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ REL::ID(1129692) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(598019) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ REL::ID(1143511) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(611704) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyStandard_{ REL::ID(1010803) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyStandard__{ REL::ID(478857) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyTunnel_CombatPathingSearchPolicyWithdraw__{ REL::ID(790887) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchT_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ REL::ID(1322498) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ REL::ID(650740) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ REL::ID(272504) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyStandard_{ REL::ID(1515731) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ REL::ID(154153) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ REL::ID(276134) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ REL::ID(728103) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ REL::ID(1342248) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ REL::ID(425397) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1261175) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ REL::ID(167950) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ REL::ID(181672) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ REL::ID(1247306) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ REL::ID(618408) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ REL::ID(51950) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyStandard_{ REL::ID(656369) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ REL::ID(230309) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ REL::ID(1274884) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ REL::ID(65826) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ REL::ID(79620) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyStandard_{ REL::ID(1529369) };
+		inline constexpr std::array<REL::ID, 1> CombatNavmeshSearchTunnel_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ REL::ID(258649) };
+		inline constexpr std::array<REL::ID, 1> CombatObject{ REL::ID(1231633) };
+		inline constexpr std::array<REL::ID, 1> CombatObjectBase{ REL::ID(620137) };
+		inline constexpr std::array<REL::ID, 1> CombatObjectT_CombatFormObject_CombatObjectSaveLoadManager_BGSSaveFormBuffer_BGSLoadFormBuffer_{ REL::ID(1015115) };
+		inline constexpr std::array<REL::ID, 1> CombatObjectT_CombatObject_CombatObjectSaveLoadManager_BGSSaveGameBuffer_BGSLoadGameBuffer_{ REL::ID(1497890) };
+		inline constexpr std::array<REL::ID, 1> CombatObjectT_CombatSharedObject_CombatObjectSharedSaveLoadManager_BGSSaveGameBuffer_BGSLoadGameBuffer_{ REL::ID(105102) };
+		inline constexpr std::array<REL::ID, 1> CombatPath{ REL::ID(1184940) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilder{ REL::ID(621034) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderCovered{ REL::ID(1546131) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderOpen{ REL::ID(966302) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderStandard{ REL::ID(793880) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ REL::ID(1541892) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyCovered_CombatPathingSearchPolicyStandard_{ REL::ID(347311) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ REL::ID(1072673) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1167388) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ REL::ID(36488) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ REL::ID(651641) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ REL::ID(584041) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ REL::ID(899984) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ REL::ID(556283) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ REL::ID(970691) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyMultiGoal_CombatPathingSearchPolicyStandard_{ REL::ID(1547443) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ REL::ID(1121340) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ REL::ID(410905) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ REL::ID(798305) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ REL::ID(625508) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderOpen_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ REL::ID(552426) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ REL::ID(379365) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1316718) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ REL::ID(727622) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ REL::ID(1509865) };
+		inline constexpr std::array<REL::ID, 1> CombatPathBuilderT_CombatPathBuilderStandard_CombatPathingGoalPolicyStandard_CombatPathingSearchPolicyStandard_{ REL::ID(174960) };
+		inline constexpr std::array<REL::ID, 1> CombatPathController{ REL::ID(752900) };
+		inline constexpr std::array<REL::ID, 1> CombatPathDestinationActor{ REL::ID(466123) };
+		inline constexpr std::array<REL::ID, 1> CombatPathDestinationFollowActor{ REL::ID(1054227) };
+		inline constexpr std::array<REL::ID, 1> CombatPathDestinationRef{ REL::ID(1390276) };
+		inline constexpr std::array<REL::ID, 1> CombatPathDestinationRefs{ REL::ID(1146744) };
+		inline constexpr std::array<REL::ID, 1> CombatPathMovementMessage{ REL::ID(607271) };
+		inline constexpr std::array<REL::ID, 1> CombatPathMovementMessageEvent_CombatPathTeleportEvent_{ REL::ID(513875) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestCovered_CombatPathDestinationNone_{ REL::ID(1211468) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationActor_{ REL::ID(309371), REL::ID(781251) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationLocation_{ REL::ID(498854) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestFlight_CombatPathDestinationRef_{ REL::ID(537333), REL::ID(1008619) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ REL::ID(23148) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1133517) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ REL::ID(778505), REL::ID(1250110) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ REL::ID(39072), REL::ID(510889) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(199871) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1128122) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(339423) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ REL::ID(1092081), REL::ID(1564012) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(507339) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(360155) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ REL::ID(1385843), REL::ID(275427) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(735232) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ REL::ID(1284825), REL::ID(174439) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(935595) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(989690) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(1267211) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(113116) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(872794) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ REL::ID(1134438) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestHover_CombatPathDestinationNone_{ REL::ID(423965) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestLanding_CombatPathDestinationLocation_{ REL::ID(824675) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ REL::ID(974119) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ REL::ID(1012362), REL::ID(1484533) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestOrbit_CombatPathDestinationLocation_{ REL::ID(1225339) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestRotatePath_CombatPathDestinationLocation_{ REL::ID(899486) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationActor_{ REL::ID(58477), REL::ID(530319) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationLocation_{ REL::ID(248117) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestStandard_CombatPathDestinationRef_{ REL::ID(286220), REL::ID(758232) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestStraightPath_CombatPathDestinationLocation_{ REL::ID(1299920) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ REL::ID(345885) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatCoveredPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ REL::ID(384162), REL::ID(855852) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestCovered_CombatPathDestinationNone_{ REL::ID(188736) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationActor_{ REL::ID(762113), REL::ID(1233604) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationLocation_{ REL::ID(1389952) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestFlight_CombatPathDestinationRef_{ REL::ID(989383), REL::ID(1461443) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ REL::ID(914816) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(442350) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ REL::ID(1230932), REL::ID(120141) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ REL::ID(491632), REL::ID(963331) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(1090851) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(437022) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1230865) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ REL::ID(1544737), REL::ID(433698) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1398391) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(1251718) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ REL::ID(256358), REL::ID(728302) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(43780) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ REL::ID(155242), REL::ID(626897) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(244664) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(789938) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(576244) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1004192) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(182106) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ REL::ID(443272) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestHover_CombatPathDestinationNone_{ REL::ID(1315253) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestLanding_CombatPathDestinationLocation_{ REL::ID(133579) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ REL::ID(283267) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ REL::ID(1465175), REL::ID(354295) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation_{ REL::ID(534321) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation_{ REL::ID(208655) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationActor_{ REL::ID(511076), REL::ID(982483) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationLocation_{ REL::ID(1139289) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestStandard_CombatPathDestinationRef_{ REL::ID(739172), REL::ID(1210702) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation_{ REL::ID(609088) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ REL::ID(1237401) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ REL::ID(836811), REL::ID(1308246) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestCovered_CombatPathDestinationNone_{ REL::ID(520268) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationActor_{ REL::ID(986419), REL::ID(1458354) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationLocation_{ REL::ID(298542) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlight_CombatPathDestinationRef_{ REL::ID(1214686), REL::ID(103808) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ REL::ID(1405408) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(933267) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ REL::ID(1255323), REL::ID(144625) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ REL::ID(716926), REL::ID(1188179) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(1581813) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(927947) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(139199) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ REL::ID(187349), REL::ID(659008) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(307037) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(160173) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ REL::ID(480997), REL::ID(952704) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(534821) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ REL::ID(379728), REL::ID(851376) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(735689) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(298837) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(1066776) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1495495) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(672954) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ REL::ID(934219) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestHover_CombatPathDestinationNone_{ REL::ID(224001) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestLanding_CombatPathDestinationLocation_{ REL::ID(624531) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ REL::ID(774290) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ REL::ID(107587), REL::ID(579283) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestOrbit_CombatPathDestinationLocation_{ REL::ID(1024722) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestRotatePath_CombatPathDestinationLocation_{ REL::ID(699702) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationActor_{ REL::ID(736140), REL::ID(1207641) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationLocation_{ REL::ID(47653) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStandard_CombatPathDestinationRef_{ REL::ID(963504), REL::ID(1435007) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestStraightPath_CombatPathDestinationLocation_{ REL::ID(1099811) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ REL::ID(145746) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatCoveredPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ REL::ID(1061446), REL::ID(1533239) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestCovered_CombatPathDestinationNone_{ REL::ID(319897) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationActor_{ REL::ID(1439036), REL::ID(328495) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationLocation_{ REL::ID(1189957) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlight_CombatPathDestinationRef_{ REL::ID(84732), REL::ID(556478) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ REL::ID(715031) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(242354) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge__CombatPathDestinationActor_{ REL::ID(1016693), REL::ID(1488706) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract__CombatPathDestinationActor_{ REL::ID(1169039), REL::ID(58270) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(890696) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(237077) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1030342) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationActor_{ REL::ID(639810), REL::ID(1111218) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1198547) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(1051253) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank__CombatPathDestinationActor_{ REL::ID(933489), REL::ID(1405019) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1425718) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard__CombatPathDestinationFollowActor_{ REL::ID(832304), REL::ID(1303843) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(44211) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(98678) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard__CombatPathDestinationLocation_{ REL::ID(375900) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(804319) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard__CombatPathDestinationNone_{ REL::ID(1564190) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw__CombatPathDestinationLocation_{ REL::ID(243267) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestHover_CombatPathDestinationNone_{ REL::ID(1115043) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestLanding_CombatPathDestinationLocation_{ REL::ID(1515898) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ REL::ID(83128) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ REL::ID(560169), REL::ID(1031500) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestOrbit_CombatPathDestinationLocation_{ REL::ID(333907) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestRotatePath_CombatPathDestinationLocation_{ REL::ID(7665) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationActor_{ REL::ID(1188360), REL::ID(77756) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationLocation_{ REL::ID(939048) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStandard_CombatPathDestinationRef_{ REL::ID(1415861), REL::ID(305401) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestStraightPath_CombatPathDestinationLocation_{ REL::ID(408589) };
+		inline constexpr std::array<REL::ID, 1> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ REL::ID(1036878) };
+		inline constexpr std::array<REL::ID, 2> CombatPathT_CombatSharedPathT_CombatPath__CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ REL::ID(1514291), REL::ID(403239) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingDebugData{ REL::ID(1276008) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequest{ REL::ID(299734) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestAdapter{ REL::ID(458554) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestCovered{ REL::ID(1027594) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyAvoidThreat_CombatPathingSearchPolicyStandard_{ REL::ID(802029) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyCharge_CombatPathingSearchPolicyCharge_{ REL::ID(7257) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyDistract_CombatPathingSearchPolicyDistract_{ REL::ID(850966) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFindAttackLocation_CombatPathingSearchPolicyStandard_{ REL::ID(1450252) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFindCover_CombatPathingSearchPolicyStandard_{ REL::ID(796786) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFindFlankCover_CombatPathingSearchPolicyStandard_{ REL::ID(7192) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFindTargetLocation_CombatPathingSearchPolicyStandard_{ REL::ID(321548) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFindValidLocation_CombatPathingSearchPolicyStandard_{ REL::ID(175857) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFlankDistant_CombatPathingSearchPolicyStandard_{ REL::ID(28159) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFlank_CombatPathingSearchPolicyFlank_{ REL::ID(615708) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFlee_CombatPathingSearchPolicyStandard_{ REL::ID(403033) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyFollow_CombatPathingSearchPolicyStandard_{ REL::ID(514340) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyInvestigateLocation_CombatPathingSearchPolicyStandard_{ REL::ID(603983) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyRetreat_CombatPathingSearchPolicyStandard_{ REL::ID(1481052) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyReturnToCombatArea_CombatPathingSearchPolicyStandard_{ REL::ID(935372) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicySearchWander_CombatPathingSearchPolicyStandard_{ REL::ID(1363310) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicySearch_CombatPathingSearchPolicyStandard_{ REL::ID(541376) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestGeneric_CombatPathingGoalPolicyWithdraw_CombatPathingSearchPolicyWithdraw_{ REL::ID(802981) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestMultiGoal{ REL::ID(976948) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingRequestStandard{ REL::ID(1523080) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingSearchArea{ REL::ID(1527064) };
+		inline constexpr std::array<REL::ID, 1> CombatPathingTweener{ REL::ID(960309) };
+		inline constexpr std::array<REL::ID, 1> CombatPositionTracker{ REL::ID(470340) };
+		inline constexpr std::array<REL::ID, 1> CombatProjectileAimController{ REL::ID(940052) };
+		inline constexpr std::array<REL::ID, 1> CombatProjectileDebugData{ REL::ID(1178639) };
+		inline constexpr std::array<REL::ID, 1> CombatQueuedEvent{ REL::ID(319564) };
+		inline constexpr std::array<REL::ID, 1> CombatQueuedEventT_CombatAnimationEvent_{ REL::ID(1457119) };
+		inline constexpr std::array<REL::ID, 1> CombatSearchLockData{ REL::ID(823975) };
+		inline constexpr std::array<REL::ID, 1> CombatSharedObject{ REL::ID(1421014) };
+		inline constexpr std::array<REL::ID, 1> CombatSharedPathT_CombatCoveredPath_{ REL::ID(564445) };
+		inline constexpr std::array<REL::ID, 1> CombatSharedPathT_CombatPath_{ REL::ID(325770) };
+		inline constexpr std::array<REL::ID, 1> CombatStaticBlackboardMemberBase{ REL::ID(530351) };
+		inline constexpr std::array<REL::ID, 1> CombatStaticBlackboardMember_CombatBehaviorStaticBlackboardBase_CombatBehaviorContextMelee_CombatBehaviorContextBase__AITimer_{ REL::ID(329977) };
+		inline constexpr std::array<REL::ID, 1> CombatStaticBlackboardMember_CombatBehaviorStaticBlackboardBase_CombatBehaviorContextRangedMovement_CombatBehaviorContextBase__AITimer_{ REL::ID(125306) };
+		inline constexpr std::array<REL::ID, 1> CombatSuppressiveFireBehavior{ REL::ID(919947) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetLocation{ REL::ID(1501413) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetLocationSearch{ REL::ID(310868) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetLocationSearchResult{ REL::ID(922281) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetSelector{ REL::ID(1462216) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetSelectorFixed{ REL::ID(477479) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetSelectorPreferred{ REL::ID(132019) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetSelectorRandom{ REL::ID(384241) };
+		inline constexpr std::array<REL::ID, 1> CombatTargetSelectorStandard{ REL::ID(1368546) };
+		inline constexpr std::array<REL::ID, 1> CombatThreat{ REL::ID(1393070) };
+		inline constexpr std::array<REL::ID, 1> CombatThreatExplosion{ REL::ID(861217) };
+		inline constexpr std::array<REL::ID, 1> CombatThreatLOF{ REL::ID(1552420) };
+		inline constexpr std::array<REL::ID, 1> CombatThreatMelee{ REL::ID(1459139) };
+		inline constexpr std::array<REL::ID, 1> CombatThreatProjectile{ REL::ID(1207005) };
+		inline constexpr std::array<REL::ID, 1> CombatTrackTargetAimController{ REL::ID(781372) };
+		inline constexpr std::array<REL::ID, 1> CombatTunnelPathController{ REL::ID(220736) };
+		inline constexpr std::array<REL::ID, 1> CombatViewController{ REL::ID(6028) };
+		inline constexpr std::array<REL::ID, 1> CombatViewControllerGlance{ REL::ID(963562) };
+		inline constexpr std::array<REL::ID, 1> CombatViewControllerPath{ REL::ID(870187) };
+		inline constexpr std::array<REL::ID, 1> CombatViewControllerStandard{ REL::ID(1056774) };
+		inline constexpr std::array<REL::ID, 1> CommandEffect{ REL::ID(1342680) };
+		inline constexpr std::array<REL::ID, 1> CommandSummonedEffect{ REL::ID(1142528) };
+		inline constexpr std::array<REL::ID, 1> CompactingStore__MoveCallback{ REL::ID(977267) };
+		inline constexpr std::array<REL::ID, 1> CompactingStore__NoopMoveCallback{ REL::ID(1150056) };
+		inline constexpr std::array<REL::ID, 1> CompactingStore__Store{ REL::ID(53221) };
+		inline constexpr std::array<REL::ID, 1> CompanionListener{ REL::ID(149815) };
+		inline constexpr std::array<REL::ID, 1> CompressedArchiveFile{ REL::ID(477733) };
+		inline constexpr std::array<REL::ID, 1> ConcreteBoundObjectFormFactory_TESFurniture_42_22_3_{ REL::ID(1324937) };
+		inline constexpr std::array<REL::ID, 1> ConcreteBoundObjectFormFactory_TESNPC_45_13_0_{ REL::ID(298332) };
+		inline constexpr std::array<REL::ID, 1> ConcreteBoundObjectFormFactory_TESObjectARMO_29_1_1_{ REL::ID(148338) };
+		inline constexpr std::array<REL::ID, 1> ConcreteBoundObjectFormFactory_TESObjectWEAP_43_12_1_{ REL::ID(951213) };
+		inline constexpr std::array<REL::ID, 1> ConcreteExplosionFactory_ChainExplosion_1_{ REL::ID(572474) };
+		inline constexpr std::array<REL::ID, 1> ConcreteExplosionFactory_Explosion_0_{ REL::ID(781125) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_ActorValueInfo_98_{ REL::ID(703786) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_AlchemyItem_48_{ REL::ID(1183800) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAcousticSpace_19_{ REL::ID(462170) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAction_6_{ REL::ID(515060) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAddonNode_97_{ REL::ID(1234597) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAimModel_141_{ REL::ID(1459312) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSArtObject_129_{ REL::ID(1204145) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAssociationType_127_{ REL::ID(1444562) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAttractionRule_151_{ REL::ID(1206957) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSAudioEffectChain_149_{ REL::ID(745382) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSBendableSpline_53_{ REL::ID(882859) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSBodyPartData_96_{ REL::ID(1282513) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSCameraPath_100_{ REL::ID(421095) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSCameraShot_99_{ REL::ID(525247) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSCollisionLayer_136_{ REL::ID(656984) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSColorForm_137_{ REL::ID(615593) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSComponent_8_{ REL::ID(914841) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSConstructibleObject_143_{ REL::ID(1439296) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSDamageType_12_{ REL::ID(687409) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSDebris_91_{ REL::ID(852310) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSDialogueBranch_119_{ REL::ID(363663) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSDualCastData_133_{ REL::ID(783457) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSEncounterZone_106_{ REL::ID(92116) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSEquipSlot_124_{ REL::ID(299535) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSExplosion_90_{ REL::ID(1049596) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSFootstepSet_115_{ REL::ID(1074214) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSFootstep_114_{ REL::ID(144710) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSGodRays_157_{ REL::ID(316805) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSHazard_52_{ REL::ID(635551) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSHeadPart_15_{ REL::ID(1215689) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSIdleMarker_49_{ REL::ID(973710) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSImpactDataSet_104_{ REL::ID(286808) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSImpactData_103_{ REL::ID(328188) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSInstanceNamingRules_147_{ REL::ID(352177) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSKeyword_4_{ REL::ID(760109) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSLensFlare_155_{ REL::ID(155461) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSLightingTemplate_112_{ REL::ID(621189) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSListForm_94_{ REL::ID(73019) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSLocationRefType_5_{ REL::ID(245075) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSLocation_107_{ REL::ID(1084234) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMaterialObject_130_{ REL::ID(1347748) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMaterialSwap_145_{ REL::ID(577120) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMaterialType_102_{ REL::ID(695532) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMenuIcon_10_{ REL::ID(1092624) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMessage_108_{ REL::ID(519432) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMod__Attachment__Mod_144_{ REL::ID(242510) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMovableStatic_38_{ REL::ID(431746) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMovementType_131_{ REL::ID(625550) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMusicTrackFormWrapper_120_{ REL::ID(1114051) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSMusicType_113_{ REL::ID(102094) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSNote_50_{ REL::ID(183780) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSOutfit_128_{ REL::ID(1410273) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSPackIn_139_{ REL::ID(318995) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSPerk_95_{ REL::ID(273844) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSProjectile_51_{ REL::ID(1473448) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSReferenceEffect_60_{ REL::ID(1174533) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSReferenceGroup_140_{ REL::ID(521781) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSRelationship_125_{ REL::ID(1041165) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSReverbParameters_138_{ REL::ID(1549909) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSScene_126_{ REL::ID(108804) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSShaderParticleGeometryData_59_{ REL::ID(1091958) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSSoundCategorySnapshot_152_{ REL::ID(1506881) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSSoundCategory_134_{ REL::ID(1401391) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSSoundDescriptorForm_132_{ REL::ID(482730) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSSoundKeywordMapping_148_{ REL::ID(149085) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSSoundOutput_135_{ REL::ID(1039143) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSSoundTagSet_153_{ REL::ID(1078477) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSStaticCollection_37_{ REL::ID(74469) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSStoryManagerBranchNode_116_{ REL::ID(340693) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSStoryManagerEventNode_118_{ REL::ID(1536392) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSStoryManagerQuestNode_117_{ REL::ID(1481560) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSTalkingActivator_28_{ REL::ID(109645) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSTerminal_55_{ REL::ID(625001) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSTextureSet_9_{ REL::ID(556391) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSTransform_7_{ REL::ID(425583) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSVoiceType_101_{ REL::ID(302822) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_BGSZoomData_146_{ REL::ID(1554498) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_EffectSetting_21_{ REL::ID(1443639) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_EnchantmentItem_24_{ REL::ID(670420) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_IngredientItem_33_{ REL::ID(1185455) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_NavMesh_76_{ REL::ID(228956) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_Script_22_{ REL::ID(166808) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_ScrollItem_26_{ REL::ID(1187034) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_SpellItem_25_{ REL::ID(1263542) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESAmmo_44_{ REL::ID(1364451) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESClass_13_{ REL::ID(140880) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESClimate_58_{ REL::ID(674996) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESCombatStyle_83_{ REL::ID(1268572) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESEffectShader_88_{ REL::ID(602112) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESEyes_16_{ REL::ID(711624) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESFaction_14_{ REL::ID(390037) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESFlora_41_{ REL::ID(505692) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESFurniture_42_{ REL::ID(102171) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESGlobal_11_{ REL::ID(10123) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESGrass_39_{ REL::ID(1574562) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESIdleForm_81_{ REL::ID(176342) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESImageSpaceModifier_93_{ REL::ID(1003211) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESImageSpace_92_{ REL::ID(1337949) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESKey_47_{ REL::ID(1226009) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESLandTexture_23_{ REL::ID(759096) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESLevCharacter_46_{ REL::ID(1343374) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESLevItem_56_{ REL::ID(1288504) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESLevSpell_85_{ REL::ID(1220025) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESLoadScreen_84_{ REL::ID(660685) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESNPC_45_{ REL::ID(658033) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectACTI_27_{ REL::ID(1380141) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectANIO_86_{ REL::ID(1246042) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectARMA_105_{ REL::ID(299446) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectARMO_29_{ REL::ID(507497) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectBOOK_30_{ REL::ID(224907) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectCELL_63_{ REL::ID(1432799) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectCONT_31_{ REL::ID(1351237) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectDOOR_32_{ REL::ID(1041084) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectLAND_75_{ REL::ID(1280131) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectLIGH_34_{ REL::ID(829991) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectMISC_35_{ REL::ID(333401) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectSTAT_36_{ REL::ID(185384) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectTREE_40_{ REL::ID(1180364) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESObjectWEAP_43_{ REL::ID(1310327) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESQuest_80_{ REL::ID(399326) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESRace_17_{ REL::ID(1377637) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESRegion_61_{ REL::ID(532691) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESShout_123_{ REL::ID(904897) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESSoulGem_54_{ REL::ID(1279924) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESSound_18_{ REL::ID(1209331) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESTopicInfo_79_{ REL::ID(449727) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESTopic_78_{ REL::ID(877968) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESWaterForm_87_{ REL::ID(482263) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESWeather_57_{ REL::ID(1052551) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESWordOfPower_122_{ REL::ID(1167889) };
+		inline constexpr std::array<REL::ID, 1> ConcreteFormFactory_TESWorldSpace_74_{ REL::ID(186043) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_ActorValueInfo_98_119_4_{ REL::ID(1314736) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_AlchemyItem_48_17_2_{ REL::ID(213124) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAcousticSpace_19_64_8_{ REL::ID(1073995) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAction_6_76_0_{ REL::ID(1126479) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAddonNode_97_41_6_{ REL::ID(263773) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAimModel_141_108_4_{ REL::ID(488355) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSArtObject_129_84_4_{ REL::ID(233302) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAssociationType_127_82_5_{ REL::ID(473722) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAttractionRule_151_120_4_{ REL::ID(236118) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSAudioEffectChain_149_117_8_{ REL::ID(1356370) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSBendableSpline_53_105_4_{ REL::ID(1494767) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSBodyPartData_96_40_0_{ REL::ID(311760) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSCameraShot_99_43_6_{ REL::ID(1136624) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSCollisionLayer_136_99_4_{ REL::ID(1268275) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSColorForm_137_101_4_{ REL::ID(1227142) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSComponent_8_109_4_{ REL::ID(1526553) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSConstructibleObject_143_63_1_{ REL::ID(468438) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSDamageType_12_118_4_{ REL::ID(1298540) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSDebris_91_36_6_{ REL::ID(1464033) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSDualCastData_133_95_2_{ REL::ID(1394482) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSEncounterZone_106_61_7_{ REL::ID(704069) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSEquipSlot_124_81_5_{ REL::ID(911262) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSExplosion_90_34_6_{ REL::ID(78923) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSFootstepSet_115_74_6_{ REL::ID(103529) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSFootstep_114_73_6_{ REL::ID(756516) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSGodRays_157_125_6_{ REL::ID(928286) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSHazard_52_92_6_{ REL::ID(1247030) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSHeadPart_15_52_5_{ REL::ID(244700) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSIdleMarker_49_30_4_{ REL::ID(2500) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSImpactDataSet_104_45_6_{ REL::ID(898506) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSImpactData_103_44_6_{ REL::ID(939672) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSInstanceNamingRules_147_114_4_{ REL::ID(963751) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSKeyword_4_70_4_{ REL::ID(1371122) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSLensFlare_155_123_6_{ REL::ID(766992) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSLightingTemplate_112_87_7_{ REL::ID(1232679) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSListForm_94_38_4_{ REL::ID(684769) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSLocationRefType_5_72_7_{ REL::ID(856506) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSLocation_107_71_7_{ REL::ID(113474) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMaterialObject_130_85_4_{ REL::ID(377154) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMaterialSwap_145_111_4_{ REL::ID(1188589) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMaterialType_102_75_6_{ REL::ID(1306585) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMenuIcon_10_37_9_{ REL::ID(121923) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMessage_108_62_4_{ REL::ID(1130789) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMod__Attachment__Mod_144_110_1_{ REL::ID(853986) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMovableStatic_38_42_3_{ REL::ID(1043483) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMovementType_131_91_5_{ REL::ID(1236996) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMusicTrackFormWrapper_120_77_8_{ REL::ID(143306) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSMusicType_113_68_8_{ REL::ID(714038) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSNote_50_54_1_{ REL::ID(795327) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSOutfit_128_83_1_{ REL::ID(439487) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSPackIn_139_103_4_{ REL::ID(930426) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSPerk_95_39_0_{ REL::ID(885292) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSProjectile_51_32_6_{ REL::ID(502404) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSReferenceEffect_60_89_7_{ REL::ID(203920) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSReferenceGroup_140_104_9_{ REL::ID(1133177) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSRelationship_125_80_5_{ REL::ID(70627) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSReverbParameters_138_102_8_{ REL::ID(579207) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSShaderParticleGeometryData_59_88_7_{ REL::ID(121212) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSSoundCategorySnapshot_152_121_8_{ REL::ID(535968) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSSoundCategory_134_96_8_{ REL::ID(430530) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSSoundDescriptorForm_132_94_8_{ REL::ID(1094283) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSSoundKeywordMapping_148_115_8_{ REL::ID(760746) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSSoundOutput_135_98_8_{ REL::ID(68579) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSSoundTagSet_153_122_8_{ REL::ID(107822) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSStaticCollection_37_69_9_{ REL::ID(686263) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSStoryManagerEventNode_118_93_5_{ REL::ID(565648) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSTalkingActivator_28_33_0_{ REL::ID(721544) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSTerminal_55_116_3_{ REL::ID(1236473) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSTextureSet_9_35_4_{ REL::ID(1167724) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSTransform_7_112_4_{ REL::ID(1037116) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSVoiceType_101_48_5_{ REL::ID(914412) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_BGSZoomData_146_113_4_{ REL::ID(583759) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_EffectSetting_21_67_2_{ REL::ID(472758) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_EnchantmentItem_24_16_2_{ REL::ID(1281624) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_IngredientItem_33_5_1_{ REL::ID(214801) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_Script_22_66_9_{ REL::ID(778356) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_ScrollItem_26_100_9_{ REL::ID(216359) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_SpellItem_25_15_2_{ REL::ID(292498) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESAmmo_44_20_1_{ REL::ID(393917) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESClass_13_49_5_{ REL::ID(752654) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESClimate_58_56_7_{ REL::ID(1286211) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESCombatStyle_83_25_4_{ REL::ID(297585) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESEffectShader_88_31_6_{ REL::ID(1213777) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESEyes_16_51_9_{ REL::ID(1322481) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESFaction_14_53_5_{ REL::ID(1001478) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESFlora_41_21_3_{ REL::ID(1117117) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESFurniture_42_22_3_{ REL::ID(714097) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESGlobal_11_58_4_{ REL::ID(622271) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESGrass_39_9_3_{ REL::ID(603687) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESImageSpaceModifier_93_60_6_{ REL::ID(32270) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESImageSpace_92_59_6_{ REL::ID(367320) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESKey_47_19_1_{ REL::ID(255144) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESLandTexture_23_24_4_{ REL::ID(1370086) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESLevCharacter_46_14_0_{ REL::ID(372775) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESLevItem_56_18_1_{ REL::ID(317790) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESLevSpell_85_27_2_{ REL::ID(249079) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESLoadScreen_84_26_4_{ REL::ID(1271945) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESNPC_45_13_0_{ REL::ID(1269287) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectACTI_27_0_3_{ REL::ID(409449) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectANIO_86_28_4_{ REL::ID(275124) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectARMA_105_57_1_{ REL::ID(911175) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectARMO_29_1_1_{ REL::ID(1118969) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectBOOK_30_2_1_{ REL::ID(836307) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectCONT_31_3_3_{ REL::ID(380651) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectDOOR_32_4_3_{ REL::ID(70536) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectLIGH_34_6_3_{ REL::ID(1441402) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectMISC_35_7_1_{ REL::ID(944842) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectSTAT_36_8_3_{ REL::ID(796889) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectTREE_40_10_3_{ REL::ID(209748) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESObjectWEAP_43_12_1_{ REL::ID(339609) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESQuest_80_46_5_{ REL::ID(1010791) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESRace_17_50_5_{ REL::ID(407010) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESShout_123_79_9_{ REL::ID(1516625) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESSoulGem_54_97_9_{ REL::ID(309107) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESSound_18_23_8_{ REL::ID(238416) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESWaterForm_87_29_7_{ REL::ID(1093829) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESWeather_57_55_7_{ REL::ID(81839) };
+		inline constexpr std::array<REL::ID, 1> ConcreteObjectFormFactory_TESWordOfPower_122_78_9_{ REL::ID(197324) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTempEffectGeometryDecal_3_{ REL::ID(1046687) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTempEffectSPG_6_{ REL::ID(572162) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTempEffect_1_{ REL::ID(770107) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTempEffect_4_{ REL::ID(1427866) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTempEffect_5_{ REL::ID(503945) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTempEffect_7_{ REL::ID(111813) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_BSTerrainEffect_0_{ REL::ID(1380520) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_ModelReferenceEffect_9_{ REL::ID(839313) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_ReferenceEffect_8_{ REL::ID(314983) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_ShaderReferenceEffect_10_{ REL::ID(690624) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory_SummonPlacementEffect_11_{ REL::ID(1482597) };
+		inline constexpr std::array<REL::ID, 1> ConcreteTempEffectFactory___BSTempEffectScreenSpaceDecal_2_{ REL::ID(873304) };
+		inline constexpr std::array<REL::ID, 8> ConeProjectile{ REL::ID(482698), REL::ID(1403699), REL::ID(479652), REL::ID(1137775), REL::ID(213891), REL::ID(1091145), REL::ID(685668), REL::ID(200154) };
+		inline constexpr std::array<REL::ID, 2> Console{ REL::ID(1581729), REL::ID(78890) };
+		inline constexpr std::array<REL::ID, 1> ConsoleData{ REL::ID(232715) };
+		inline constexpr std::array<REL::ID, 2> ConsoleNativeUIMenu{ REL::ID(248606), REL::ID(328019) };
+		inline constexpr std::array<REL::ID, 4> ContainerMenu{ REL::ID(1098621), REL::ID(646257), REL::ID(1257626), REL::ID(333414) };
+		inline constexpr std::array<REL::ID, 4> ContainerMenuBase{ REL::ID(441140), REL::ID(1571411), REL::ID(600540), REL::ID(1258602) };
+		inline constexpr std::array<REL::ID, 2> ContainerMenuBase__FXQuantityMenu{ REL::ID(707848), REL::ID(1365207) };
+		inline constexpr std::array<REL::ID, 1> ContainerMenuBase__IValidFunc{ REL::ID(957310) };
+		inline constexpr std::array<REL::ID, 2> CookingMenu{ REL::ID(1395125), REL::ID(1367561) };
+		inline constexpr std::array<REL::ID, 3> CreationClubMenu{ REL::ID(123650), REL::ID(203266), REL::ID(814745) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__AsyncModRequest{ REL::ID(713420) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__BundleChildrenRequest{ REL::ID(7680) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__CategorySearchRequest{ REL::ID(446664) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__CreationChanged_ConfirmResetCallback{ REL::ID(353633) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__CreationListRequest{ REL::ID(1151675) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__DownloadCreationRequest{ REL::ID(1497583) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__DownloadImageRequest{ REL::ID(181181) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__GetCreationRequest{ REL::ID(885735) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__GetIntRequest{ REL::ID(1324290) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__SavedGFxValueRequest{ REL::ID(1058355) };
+		inline constexpr std::array<REL::ID, 1> CreationClub__StringStringRequest{ REL::ID(619853) };
+		inline constexpr std::array<REL::ID, 2> CreditsMenu{ REL::ID(352393), REL::ID(431721) };
+		inline constexpr std::array<REL::ID, 1> CstringArrayImplementation{ REL::ID(1235358) };
+		inline constexpr std::array<REL::ID, 1> CullFurnitureBoneHandler{ REL::ID(470645) };
+		inline constexpr std::array<REL::ID, 1> CullWeaponsHandler{ REL::ID(205031) };
+		inline constexpr std::array<REL::ID, 1> CureEffect{ REL::ID(942278) };
+		inline constexpr std::array<REL::ID, 2> CursorMenu{ REL::ID(245579), REL::ID(324946) };
+		inline constexpr std::array<REL::ID, 1> CursorMoveEvent{ REL::ID(1233715) };
+		inline constexpr std::array<REL::ID, 1> CustomActorPackageData{ REL::ID(1237526) };
+		inline constexpr std::array<REL::ID, 1> CustomUtils__HasForceGreetVisitor{ REL::ID(164615) };
+	}
+}
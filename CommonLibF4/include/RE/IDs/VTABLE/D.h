@@ -0,0 +1,43 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> DamageEffect{ REL::ID(742358) };
+		inline constexpr std::array<REL::ID, 1> DarknessEffect{ REL::ID(715015) };
+		inline constexpr std::array<REL::ID, 1> DeathEmoteHandler{ REL::ID(1057785) };
+		inline constexpr std::array<REL::ID, 1> DeathStopHandler{ REL::ID(1197939) };
+		inline constexpr std::array<REL::ID, 1> DebugText{ REL::ID(1195031) };
+		inline constexpr std::array<REL::ID, 1> DefaultMessageBoxCallback{ REL::ID(543879) };
+		inline constexpr std::array<REL::ID, 1> DemoralizeEffect{ REL::ID(736582) };
+		inline constexpr std::array<REL::ID, 1> DesyncInteractionHandler{ REL::ID(835510) };
+		inline constexpr std::array<REL::ID, 1> DetectLifeEffect{ REL::ID(687376) };
+		inline constexpr std::array<REL::ID, 1> DetectionCollector{ REL::ID(1535717) };
+		inline constexpr std::array<REL::ID, 1> DetectionListener{ REL::ID(405963) };
+		inline constexpr std::array<REL::ID, 1> DetectionState{ REL::ID(331693) };
+		inline constexpr std::array<REL::ID, 1> DeviceConnectEvent{ REL::ID(702084) };
+		inline constexpr std::array<REL::ID, 1> DialogueCameraState{ REL::ID(1246139) };
+		inline constexpr std::array<REL::ID, 2> DialogueMenu{ REL::ID(1268320), REL::ID(1347567) };
+		inline constexpr std::array<REL::ID, 1> DialogueMenuUtils__DialogueMessageData{ REL::ID(334570) };
+		inline constexpr std::array<REL::ID, 1> DialoguePackage{ REL::ID(499201) };
+		inline constexpr std::array<REL::ID, 2> DirectionalHitIndicators{ REL::ID(157099), REL::ID(768595) };
+		inline constexpr std::array<REL::ID, 1> DisableCharacterBumperHandler{ REL::ID(778354) };
+		inline constexpr std::array<REL::ID, 1> DisableCharacterPitchHandler{ REL::ID(1296283) };
+		inline constexpr std::array<REL::ID, 1> DisableCollisionHandler{ REL::ID(512119) };
+		inline constexpr std::array<REL::ID, 1> DisarmEffect{ REL::ID(486726) };
+		inline constexpr std::array<REL::ID, 1> DisconnectHandler{ REL::ID(398560) };
+		inline constexpr std::array<REL::ID, 1> DisguiseEffect{ REL::ID(458991) };
+		inline constexpr std::array<REL::ID, 1> DisguiseEffect__DetectionChecker{ REL::ID(286412) };
+		inline constexpr std::array<REL::ID, 1> DispelEffect{ REL::ID(259013) };
+		inline constexpr std::array<REL::ID, 1> DiveBombPathController{ REL::ID(328308) };
+		inline constexpr std::array<REL::ID, 1> DoNotInterruptAnimationHandler{ REL::ID(539829) };
+		inline constexpr std::array<REL::ID, 1> DoNothingUnhandledPolicy_BSFixedString_{ REL::ID(1419936) };
+		inline constexpr std::array<REL::ID, 1> DoorObstacleAdapter{ REL::ID(1574744) };
+		inline constexpr std::array<REL::ID, 1> DropItemCommand{ REL::ID(1245168) };
+		inline constexpr std::array<REL::ID, 1> DualValueModifierEffect{ REL::ID(58687) };
+		inline constexpr std::array<REL::ID, 1> DynamicAnimationTaggingGenerator{ REL::ID(705208) };
+		inline constexpr std::array<REL::ID, 2> DynamicIdleDataSingletonHelper{ REL::ID(776483), REL::ID(1434154) };
+		inline constexpr std::array<REL::ID, 1> DynamicNavmesh__BuildThread{ REL::ID(337200) };
+	}
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> EffectArchetypes__MainStatusHandler{ REL::ID(961280) };
+		inline constexpr std::array<REL::ID, 5> EffectSetting{ REL::ID(1046202), REL::ID(313931), REL::ID(925338), REL::ID(1537090), REL::ID(346664) };
+		inline constexpr std::array<REL::ID, 1> EjectShellCasingHandler{ REL::ID(975200) };
+		inline constexpr std::array<REL::ID, 1> EnableCharacterBumperHandler{ REL::ID(119962) };
+		inline constexpr std::array<REL::ID, 1> EnableCharacterPitchHandler{ REL::ID(638447) };
+		inline constexpr std::array<REL::ID, 1> EnableCollisionHandler{ REL::ID(1436094) };
+		inline constexpr std::array<REL::ID, 4> EnchantmentItem{ REL::ID(818524), REL::ID(152056), REL::ID(763633), REL::ID(1155506) };
+		inline constexpr std::array<REL::ID, 1> EndSummonAnimationHandler{ REL::ID(805857) };
+		inline constexpr std::array<REL::ID, 2> EnhanceWeaponEffect{ REL::ID(685015), REL::ID(890366) };
+		inline constexpr std::array<REL::ID, 1> EquipActorOutfitItemsFunctor{ REL::ID(480866) };
+		inline constexpr std::array<REL::ID, 1> EquippedItemData{ REL::ID(211322) };
+		inline constexpr std::array<REL::ID, 1> EquippedWeaponData{ REL::ID(1527616) };
+		inline constexpr std::array<REL::ID, 1> ErrorCommandDispatcher{ REL::ID(1158553) };
+		inline constexpr std::array<REL::ID, 1> EscortActorPackageData{ REL::ID(850601) };
+		inline constexpr std::array<REL::ID, 1> EtherealizationEffect{ REL::ID(469766) };
+		inline constexpr std::array<REL::ID, 2> ExamineConfirmMenu{ REL::ID(289899), REL::ID(369508) };
+		inline constexpr std::array<REL::ID, 1> ExamineConfirmMenu__ICallback{ REL::ID(237942) };
+		inline constexpr std::array<REL::ID, 1> ExamineConfirmMenu__InitData{ REL::ID(1480578) };
+		inline constexpr std::array<REL::ID, 1> ExamineConfirmMenu__InitDataBuild{ REL::ID(336714) };
+		inline constexpr std::array<REL::ID, 1> ExamineConfirmMenu__InitDataRepairFailure{ REL::ID(1214487) };
+		inline constexpr std::array<REL::ID, 1> ExamineConfirmMenu__InitDataScrap{ REL::ID(775704) };
+		inline constexpr std::array<REL::ID, 2> ExamineMenu{ REL::ID(1032946), REL::ID(1005382) };
+		inline constexpr std::array<REL::ID, 2> ExamineMenu__FXExamineMenu{ REL::ID(1299016), REL::ID(374914) };
+		inline constexpr std::array<REL::ID, 2> ExamineMenu__FXExamineMenu__FXExamineSubMenu{ REL::ID(248890), REL::ID(906977) };
+		inline constexpr std::array<REL::ID, 8> Explosion{ REL::ID(1408942), REL::ID(1419675), REL::ID(495653), REL::ID(1153845), REL::ID(229897), REL::ID(887923), REL::ID(481971), REL::ID(1579038) };
+		inline constexpr std::array<REL::ID, 1> ExplosionClosestHitCollector{ REL::ID(953700) };
+		inline constexpr std::array<REL::ID, 2> ExplosiveIndicators{ REL::ID(516145), REL::ID(1127525) };
+		inline constexpr std::array<REL::ID, 1> ExtraAcousticParent{ REL::ID(607112) };
+		inline constexpr std::array<REL::ID, 1> ExtraAction{ REL::ID(1007366) };
+		inline constexpr std::array<REL::ID, 1> ExtraActivateLoopSound{ REL::ID(1457037) };
+		inline constexpr std::array<REL::ID, 1> ExtraActivateRef{ REL::ID(966135) };
+		inline constexpr std::array<REL::ID, 1> ExtraActivateRefChildren{ REL::ID(261447) };
+		inline constexpr std::array<REL::ID, 1> ExtraActivateText{ REL::ID(539105) };
+		inline constexpr std::array<REL::ID, 1> ExtraActorCause{ REL::ID(61879) };
+		inline constexpr std::array<REL::ID, 1> ExtraActorValueStorage{ REL::ID(884348) };
+		inline constexpr std::array<REL::ID, 1> ExtraAliasInstanceArray{ REL::ID(738758) };
+		inline constexpr std::array<REL::ID, 1> ExtraAlphaCutoff{ REL::ID(207305) };
+		inline constexpr std::array<REL::ID, 1> ExtraAmmo{ REL::ID(939371) };
+		inline constexpr std::array<REL::ID, 1> ExtraAnimGraphManager{ REL::ID(489143) };
+		inline constexpr std::array<REL::ID, 2> ExtraAnimGraphPreload{ REL::ID(697626), REL::ID(211947) };
+		inline constexpr std::array<REL::ID, 1> ExtraAnimSounds{ REL::ID(6300) };
+		inline constexpr std::array<REL::ID, 1> ExtraAnimationSequencer{ REL::ID(911288) };
+		inline constexpr std::array<REL::ID, 1> ExtraAshPileRef{ REL::ID(1325250) };
+		inline constexpr std::array<REL::ID, 1> ExtraAttachRef{ REL::ID(262148) };
+		inline constexpr std::array<REL::ID, 1> ExtraAttachRefChildren{ REL::ID(1139598) };
+		inline constexpr std::array<REL::ID, 1> ExtraAttachedArrows3D{ REL::ID(911940) };
+		inline constexpr std::array<REL::ID, 1> ExtraBadPosition{ REL::ID(393532) };
+		inline constexpr std::array<REL::ID, 1> ExtraBendableSplineParams{ REL::ID(883625) };
+		inline constexpr std::array<REL::ID, 1> ExtraBiped{ REL::ID(662233) };
+		inline constexpr std::array<REL::ID, 1> ExtraBoneScaleMap{ REL::ID(1402499) };
+		inline constexpr std::array<REL::ID, 1> ExtraCachedScale{ REL::ID(448428) };
+		inline constexpr std::array<REL::ID, 1> ExtraCanTalkToPlayer{ REL::ID(752466) };
+		inline constexpr std::array<REL::ID, 1> ExtraCannotWear{ REL::ID(1352778) };
+		inline constexpr std::array<REL::ID, 1> ExtraCell3D{ REL::ID(451426) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellAcousticSpace{ REL::ID(92488) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellGodRays{ REL::ID(1488491) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellGrassData{ REL::ID(379158) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellImageSpace{ REL::ID(265264) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellMusicType{ REL::ID(797443) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellSkyRegion{ REL::ID(969821) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellWaterEnvMap{ REL::ID(725760) };
+		inline constexpr std::array<REL::ID, 1> ExtraCellWaterType{ REL::ID(1142633) };
+		inline constexpr std::array<REL::ID, 1> ExtraCharge{ REL::ID(275958) };
+		inline constexpr std::array<REL::ID, 1> ExtraCollisionData{ REL::ID(47999) };
+		inline constexpr std::array<REL::ID, 1> ExtraCombatStyle{ REL::ID(1112158) };
+		inline constexpr std::array<REL::ID, 1> ExtraCombinedRefs{ REL::ID(130663) };
+		inline constexpr std::array<REL::ID, 1> ExtraCount{ REL::ID(808121) };
+		inline constexpr std::array<REL::ID, 1> ExtraCreatureAwakeSound{ REL::ID(421013) };
+		inline constexpr std::array<REL::ID, 1> ExtraCreatureMovementSound{ REL::ID(579585) };
+		inline constexpr std::array<REL::ID, 1> ExtraCulledBone{ REL::ID(1353507) };
+		inline constexpr std::array<REL::ID, 1> ExtraDecalGroup{ REL::ID(1083921) };
+		inline constexpr std::array<REL::ID, 1> ExtraDetachTime{ REL::ID(610827) };
+		inline constexpr std::array<REL::ID, 1> ExtraDirectAtTarget{ REL::ID(524475) };
+		inline constexpr std::array<REL::ID, 1> ExtraDismemberedLimbs{ REL::ID(1366445) };
+		inline constexpr std::array<REL::ID, 1> ExtraDistantData{ REL::ID(979777) };
+		inline constexpr std::array<REL::ID, 1> ExtraDroppedItemList{ REL::ID(593426) };
+		inline constexpr std::array<REL::ID, 1> ExtraEditorID{ REL::ID(303327) };
+		inline constexpr std::array<REL::ID, 1> ExtraEditorRef3DData{ REL::ID(1111468) };
+		inline constexpr std::array<REL::ID, 1> ExtraEditorRefMoveData{ REL::ID(406587) };
+		inline constexpr std::array<REL::ID, 1> ExtraEmittanceSource{ REL::ID(1484847) };
+		inline constexpr std::array<REL::ID, 1> ExtraEnableStateChildren{ REL::ID(1152664) };
+		inline constexpr std::array<REL::ID, 1> ExtraEnableStateParent{ REL::ID(275226) };
+		inline constexpr std::array<REL::ID, 1> ExtraEnchantment{ REL::ID(953217) };
+		inline constexpr std::array<REL::ID, 1> ExtraEncounterZone{ REL::ID(634682) };
+		inline constexpr std::array<REL::ID, 1> ExtraEssentialProtected{ REL::ID(1575591) };
+		inline constexpr std::array<REL::ID, 1> ExtraFXPickNodes{ REL::ID(698340) };
+		inline constexpr std::array<REL::ID, 1> ExtraFactionChanges{ REL::ID(47280) };
+		inline constexpr std::array<REL::ID, 1> ExtraFavorCost{ REL::ID(566554) };
+		inline constexpr std::array<REL::ID, 1> ExtraFavorite{ REL::ID(1325994) };
+		inline constexpr std::array<REL::ID, 1> ExtraFlags{ REL::ID(1429946) };
+		inline constexpr std::array<REL::ID, 1> ExtraFollower{ REL::ID(649109) };
+		inline constexpr std::array<REL::ID, 1> ExtraFollowerSwimBreadcrumbs{ REL::ID(1443180) };
+		inline constexpr std::array<REL::ID, 1> ExtraForcedLandingMarker{ REL::ID(1257481) };
+		inline constexpr std::array<REL::ID, 1> ExtraForcedTarget{ REL::ID(379819) };
+		inline constexpr std::array<REL::ID, 1> ExtraFriendHits{ REL::ID(61158) };
+		inline constexpr std::array<REL::ID, 1> ExtraFromAlias{ REL::ID(821721) };
+		inline constexpr std::array<REL::ID, 1> ExtraFurnitureEntryData{ REL::ID(24866) };
+		inline constexpr std::array<REL::ID, 1> ExtraGIDBuffer{ REL::ID(476087) };
+		inline constexpr std::array<REL::ID, 1> ExtraGhost{ REL::ID(1180237) };
+		inline constexpr std::array<REL::ID, 1> ExtraGlobal{ REL::ID(635394) };
+		inline constexpr std::array<REL::ID, 1> ExtraGroupConstraint{ REL::ID(1429259) };
+		inline constexpr std::array<REL::ID, 1> ExtraGuardedRefData{ REL::ID(1097780) };
+		inline constexpr std::array<REL::ID, 1> ExtraHasNoRumors{ REL::ID(1125836) };
+		inline constexpr std::array<REL::ID, 1> ExtraHavok{ REL::ID(1329017) };
+		inline constexpr std::array<REL::ID, 1> ExtraHeadTrackingWeight{ REL::ID(1271186) };
+		inline constexpr std::array<REL::ID, 1> ExtraHeadingTarget{ REL::ID(248472) };
+		inline constexpr std::array<REL::ID, 1> ExtraHealth{ REL::ID(103211) };
+		inline constexpr std::array<REL::ID, 1> ExtraHorse{ REL::ID(1084595) };
+		inline constexpr std::array<REL::ID, 1> ExtraIgnoredAttractKeywords{ REL::ID(1229980) };
+		inline constexpr std::array<REL::ID, 1> ExtraIgnoredBySandbox{ REL::ID(565859) };
+		inline constexpr std::array<REL::ID, 1> ExtraInitActions{ REL::ID(748986) };
+		inline constexpr std::array<REL::ID, 1> ExtraInputEnableLayer{ REL::ID(1229311) };
+		inline constexpr std::array<REL::ID, 1> ExtraInstanceData{ REL::ID(179124) };
+		inline constexpr std::array<REL::ID, 1> ExtraInteraction{ REL::ID(1256773) };
+		inline constexpr std::array<REL::ID, 1> ExtraInteriorLODWorldspace{ REL::ID(525161) };
+		inline constexpr std::array<REL::ID, 1> ExtraInvestedGold{ REL::ID(870447) };
+		inline constexpr std::array<REL::ID, 1> ExtraItemDropper{ REL::ID(1297891) };
+		inline constexpr std::array<REL::ID, 1> ExtraKeywords{ REL::ID(898195) };
+		inline constexpr std::array<REL::ID, 1> ExtraLargeRefOwnerCells{ REL::ID(925569) };
+		inline constexpr std::array<REL::ID, 1> ExtraLastFinishedSequence{ REL::ID(433938) };
+		inline constexpr std::array<REL::ID, 1> ExtraLevCreaModifier{ REL::ID(1138924) };
+		inline constexpr std::array<REL::ID, 1> ExtraLeveledCreature{ REL::ID(834766) };
+		inline constexpr std::array<REL::ID, 1> ExtraLeveledItem{ REL::ID(89447) };
+		inline constexpr std::array<REL::ID, 1> ExtraLeveledItemBase{ REL::ID(1498584) };
+		inline constexpr std::array<REL::ID, 1> ExtraLight{ REL::ID(1539601) };
+		inline constexpr std::array<REL::ID, 1> ExtraLightData{ REL::ID(220992) };
+		inline constexpr std::array<REL::ID, 1> ExtraLinkedRef{ REL::ID(793708) };
+		inline constexpr std::array<REL::ID, 1> ExtraLinkedRefChildren{ REL::ID(88778) };
+		inline constexpr std::array<REL::ID, 1> ExtraLitWaterRefs{ REL::ID(780654) };
+		inline constexpr std::array<REL::ID, 1> ExtraLocation{ REL::ID(1499319) };
+		inline constexpr std::array<REL::ID, 1> ExtraLocationRefType{ REL::ID(620859) };
+		inline constexpr std::array<REL::ID, 1> ExtraLock{ REL::ID(1526621) };
+		inline constexpr std::array<REL::ID, 1> ExtraLockList{ REL::ID(302621) };
+		inline constexpr std::array<REL::ID, 2> ExtraMagicCaster{ REL::ID(897485), REL::ID(411885) };
+		inline constexpr std::array<REL::ID, 1> ExtraMapMarker{ REL::ID(129968) };
+		inline constexpr std::array<REL::ID, 1> ExtraMasterFileCell{ REL::ID(116178) };
+		inline constexpr std::array<REL::ID, 1> ExtraMasterLocation{ REL::ID(993468) };
+		inline constexpr std::array<REL::ID, 1> ExtraMaterialSwap{ REL::ID(193699) };
+		inline constexpr std::array<REL::ID, 1> ExtraMissingRefIDs{ REL::ID(1443858) };
+		inline constexpr std::array<REL::ID, 1> ExtraModRank{ REL::ID(739495) };
+		inline constexpr std::array<REL::ID, 1> ExtraModelSwap{ REL::ID(1471652) };
+		inline constexpr std::array<REL::ID, 1> ExtraMultiBound{ REL::ID(952492) };
+		inline constexpr std::array<REL::ID, 1> ExtraMultiBoundData{ REL::ID(779937) };
+		inline constexpr std::array<REL::ID, 1> ExtraMultiBoundRef{ REL::ID(75028) };
+		inline constexpr std::array<REL::ID, 1> ExtraNavMeshPortal{ REL::ID(594144) };
+		inline constexpr std::array<REL::ID, 1> ExtraNorthRotation{ REL::ID(1315345) };
+		inline constexpr std::array<REL::ID, 1> ExtraObjectBreakable{ REL::ID(179844) };
+		inline constexpr std::array<REL::ID, 1> ExtraObjectHealth{ REL::ID(1298613) };
+		inline constexpr std::array<REL::ID, 1> ExtraObjectSavedDynamicIdles{ REL::ID(1057026) };
+		inline constexpr std::array<REL::ID, 1> ExtraObjectSavedUnrecoverableSubgraphs{ REL::ID(352248) };
+		inline constexpr std::array<REL::ID, 1> ExtraOcclusionPlaneRefData{ REL::ID(580294) };
+		inline constexpr std::array<REL::ID, 1> ExtraOcclusionShape{ REL::ID(420294) };
+		inline constexpr std::array<REL::ID, 1> ExtraOpenCloseActivateRef{ REL::ID(116868) };
+		inline constexpr std::array<REL::ID, 1> ExtraOriginalReference{ REL::ID(462080) };
+		inline constexpr std::array<REL::ID, 1> ExtraOutfitItem{ REL::ID(966833) };
+		inline constexpr std::array<REL::ID, 1> ExtraOwnership{ REL::ID(1339698) };
+		inline constexpr std::array<REL::ID, 1> ExtraPackage{ REL::ID(288787) };
+		inline constexpr std::array<REL::ID, 1> ExtraPackageData{ REL::ID(753175) };
+		inline constexpr std::array<REL::ID, 1> ExtraPackageStartLocation{ REL::ID(821030) };
+		inline constexpr std::array<REL::ID, 1> ExtraPatrolRefData{ REL::ID(1284913) };
+		inline constexpr std::array<REL::ID, 1> ExtraPatrolRefInUseData{ REL::ID(924848) };
+		inline constexpr std::array<REL::ID, 1> ExtraPersistentCell{ REL::ID(461364) };
+		inline constexpr std::array<REL::ID, 1> ExtraPlayerCrimeList{ REL::ID(1166526) };
+		inline constexpr std::array<REL::ID, 1> ExtraPoison{ REL::ID(75750) };
+		inline constexpr std::array<REL::ID, 1> ExtraPortal{ REL::ID(247721) };
+		inline constexpr std::array<REL::ID, 1> ExtraPortalRefData{ REL::ID(1457733) };
+		inline constexpr std::array<REL::ID, 1> ExtraPowerArmor{ REL::ID(1056382) };
+		inline constexpr std::array<REL::ID, 1> ExtraPowerArmorPreload{ REL::ID(351551) };
+		inline constexpr std::array<REL::ID, 1> ExtraPowerLinks{ REL::ID(434636) };
+		inline constexpr std::array<REL::ID, 1> ExtraPreVisRefs{ REL::ID(1008048) };
+		inline constexpr std::array<REL::ID, 1> ExtraPrimitive{ REL::ID(407287) };
+		inline constexpr std::array<REL::ID, 1> ExtraProcessMiddleLow{ REL::ID(1502339) };
+		inline constexpr std::array<REL::ID, 1> ExtraProjectedDecalData{ REL::ID(1070827) };
+		inline constexpr std::array<REL::ID, 1> ExtraPromotedRef{ REL::ID(33387) };
+		inline constexpr std::array<REL::ID, 1> ExtraRaceData{ REL::ID(19508) };
+		inline constexpr std::array<REL::ID, 1> ExtraRadioData{ REL::ID(234807) };
+		inline constexpr std::array<REL::ID, 1> ExtraRadioReceiver{ REL::ID(1416190) };
+		inline constexpr std::array<REL::ID, 1> ExtraRadioRepeater{ REL::ID(712117) };
+		inline constexpr std::array<REL::ID, 1> ExtraRadius{ REL::ID(766849) };
+		inline constexpr std::array<REL::ID, 1> ExtraRagDollData{ REL::ID(1339012) };
+		inline constexpr std::array<REL::ID, 1> ExtraRandomTeleportMarker{ REL::ID(447718) };
+		inline constexpr std::array<REL::ID, 1> ExtraRangedDistOverride{ REL::ID(366063) };
+		inline constexpr std::array<REL::ID, 1> ExtraRank{ REL::ID(1512944) };
+		inline constexpr std::array<REL::ID, 1> ExtraRefWeaponSounds{ REL::ID(1401786) };
+		inline constexpr std::array<REL::ID, 1> ExtraReferenceHandles{ REL::ID(621542) };
+		inline constexpr std::array<REL::ID, 1> ExtraReflectedRefs{ REL::ID(1312334) };
+		inline constexpr std::array<REL::ID, 1> ExtraReflectorRefs{ REL::ID(607773) };
+		inline constexpr std::array<REL::ID, 1> ExtraRefrPath{ REL::ID(206610) };
+		inline constexpr std::array<REL::ID, 1> ExtraRefractionProperty{ REL::ID(938658) };
+		inline constexpr std::array<REL::ID, 1> ExtraRegionList{ REL::ID(624641) };
+		inline constexpr std::array<REL::ID, 1> ExtraReservedMarkers{ REL::ID(807410) };
+		inline constexpr std::array<REL::ID, 1> ExtraRoom{ REL::ID(1125123) };
+		inline constexpr std::array<REL::ID, 1> ExtraRoomRefData{ REL::ID(220272) };
+		inline constexpr std::array<REL::ID, 1> ExtraRunOncePacks{ REL::ID(102497) };
+		inline constexpr std::array<REL::ID, 1> ExtraSavedAnimation{ REL::ID(1470930) };
+		inline constexpr std::array<REL::ID, 1> ExtraSavedHavokData{ REL::ID(766187) };
+		inline constexpr std::array<REL::ID, 1> ExtraSayToTopicInfo{ REL::ID(1270507) };
+		inline constexpr std::array<REL::ID, 1> ExtraSayTopicInfoOnceADay{ REL::ID(392853) };
+		inline constexpr std::array<REL::ID, 1> ExtraScale{ REL::ID(1153354) };
+		inline constexpr std::array<REL::ID, 1> ExtraSceneData{ REL::ID(1098484) };
+		inline constexpr std::array<REL::ID, 1> ExtraScriptedAnimDependence{ REL::ID(725054) };
+		inline constexpr std::array<REL::ID, 1> ExtraSeed{ REL::ID(1525942) };
+		inline constexpr std::array<REL::ID, 1> ExtraSeenData{ REL::ID(437695) };
+		inline constexpr std::array<REL::ID, 1> ExtraShouldWear{ REL::ID(475399) };
+		inline constexpr std::array<REL::ID, 1> ExtraSoul{ REL::ID(648393) };
+		inline constexpr std::array<REL::ID, 1> ExtraSound{ REL::ID(1284200) };
+		inline constexpr std::array<REL::ID, 1> ExtraSoundOutputOverride{ REL::ID(1243814) };
+		inline constexpr std::array<REL::ID, 1> ExtraSpawnContainer{ REL::ID(1311631) };
+		inline constexpr std::array<REL::ID, 1> ExtraStartingPosition{ REL::ID(1167206) };
+		inline constexpr std::array<REL::ID, 1> ExtraStartingWorldOrCell{ REL::ID(234076) };
+		inline constexpr std::array<REL::ID, 1> ExtraTeleport{ REL::ID(994213) };
+		inline constexpr std::array<REL::ID, 1> ExtraTeleportName{ REL::ID(289482) };
+		inline constexpr std::array<REL::ID, 1> ExtraTextDisplayData{ REL::ID(34112) };
+		inline constexpr std::array<REL::ID, 1> ExtraTimeLeft{ REL::ID(980467) };
+		inline constexpr std::array<REL::ID, 1> ExtraTransitionCellCount{ REL::ID(1180963) };
+		inline constexpr std::array<REL::ID, 1> ExtraTresPassPackage{ REL::ID(794407) };
+		inline constexpr std::array<REL::ID, 1> ExtraUniqueID{ REL::ID(552870) };
+		inline constexpr std::array<REL::ID, 1> ExtraUsedMarkers{ REL::ID(1512231) };
+		inline constexpr std::array<REL::ID, 1> ExtraVoiceType{ REL::ID(166043) };
+		inline constexpr std::array<REL::ID, 1> ExtraWaterCurrentZoneData{ REL::ID(20193) };
+		inline constexpr std::array<REL::ID, 1> ExtraWaterData{ REL::ID(552209) };
+		inline constexpr std::array<REL::ID, 1> ExtraWaterLightRefs{ REL::ID(1485545) };
+	}
+}
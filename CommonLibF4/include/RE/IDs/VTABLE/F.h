@@ -0,0 +1,54 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> FOCollisionListener{ REL::ID(488150) };
+		inline constexpr std::array<REL::ID, 1> FaceEmotionalIdleHandler{ REL::ID(988852) };
+		inline constexpr std::array<REL::ID, 1> FaderData{ REL::ID(1571576) };
+		inline constexpr std::array<REL::ID, 2> FaderMenu{ REL::ID(415025), REL::ID(494575) };
+		inline constexpr std::array<REL::ID, 1> FastTravelCommand{ REL::ID(965207) };
+		inline constexpr std::array<REL::ID, 1> FastTravelCommandResult{ REL::ID(652872) };
+		inline constexpr std::array<REL::ID, 4> FavoritesManager{ REL::ID(453195), REL::ID(892289), REL::ID(1504062), REL::ID(579715) };
+		inline constexpr std::array<REL::ID, 2> FavoritesMenu{ REL::ID(1237853), REL::ID(1317087) };
+		inline constexpr std::array<REL::ID, 1> FindEffectKeywordOnTargetFunctor{ REL::ID(249992) };
+		inline constexpr std::array<REL::ID, 1> FindEqualsFunctor{ REL::ID(1360164) };
+		inline constexpr std::array<REL::ID, 1> FindNonExcludedDeliveryFunctor{ REL::ID(310208) };
+		inline constexpr std::array<REL::ID, 1> FindTriangleForLocationFilter{ REL::ID(1079505) };
+		inline constexpr std::array<REL::ID, 1> FindTriangleForLocationFilterCheckDeltaZ{ REL::ID(155572) };
+		inline constexpr std::array<REL::ID, 1> FindTriangleForLocationTraversableFilter{ REL::ID(741090) };
+		inline constexpr std::array<REL::ID, 1> FindTriangleForLocationWaterFilter{ REL::ID(1398663) };
+		inline constexpr std::array<REL::ID, 1> FirstPersonState{ REL::ID(246953) };
+		inline constexpr std::array<REL::ID, 8> FlameProjectile{ REL::ID(407784), REL::ID(1328806), REL::ID(404761), REL::ID(1062956), REL::ID(138829), REL::ID(1016281), REL::ID(610623), REL::ID(125156) };
+		inline constexpr std::array<REL::ID, 2> FlashDirectionalHitIndicators{ REL::ID(958221), REL::ID(1569974) };
+		inline constexpr std::array<REL::ID, 2> FlashDirectionalHitIndicators__SingleDirectionalHitIndicator{ REL::ID(1004680), REL::ID(80775) };
+		inline constexpr std::array<REL::ID, 2> FlashExplosiveIndicators{ REL::ID(1317364), REL::ID(346588) };
+		inline constexpr std::array<REL::ID, 2> FlashExplosiveIndicators__SingleExplosiveIndicator{ REL::ID(1363774), REL::ID(439740) };
+		inline constexpr std::array<REL::ID, 2> FlashHitIndicator{ REL::ID(640466), REL::ID(1251927) };
+		inline constexpr std::array<REL::ID, 2> FlashLocationText{ REL::ID(453465), REL::ID(1065162) };
+		inline constexpr std::array<REL::ID, 2> FlashStealth{ REL::ID(547274), REL::ID(1158528) };
+		inline constexpr std::array<REL::ID, 2> FlashVaultBoyCondition{ REL::ID(94479), REL::ID(706448) };
+		inline constexpr std::array<REL::ID, 1> FlatScreenModel{ REL::ID(1323603) };
+		inline constexpr std::array<REL::ID, 1> FleePackage{ REL::ID(743873) };
+		inline constexpr std::array<REL::ID, 1> FlightActionEndHandler{ REL::ID(1477842) };
+		inline constexpr std::array<REL::ID, 1> FlightActionEntryEndHandler{ REL::ID(819470) };
+		inline constexpr std::array<REL::ID, 1> FlightActionGrabHandler{ REL::ID(553635) };
+		inline constexpr std::array<REL::ID, 1> FlightActionHandler{ REL::ID(161432) };
+		inline constexpr std::array<REL::ID, 1> FlightActionReleaseHandler{ REL::ID(1211778) };
+		inline constexpr std::array<REL::ID, 1> FlightCrashLandStartHandler{ REL::ID(287210) };
+		inline constexpr std::array<REL::ID, 1> FlightCruisingHandler{ REL::ID(959274) };
+		inline constexpr std::array<REL::ID, 1> FlightHoveringHandler{ REL::ID(34874) };
+		inline constexpr std::array<REL::ID, 1> FlightLandEndHandler{ REL::ID(1085338) };
+		inline constexpr std::array<REL::ID, 1> FlightLandHandler{ REL::ID(427108) };
+		inline constexpr std::array<REL::ID, 1> FlightLandingHandler{ REL::ID(693631) };
+		inline constexpr std::array<REL::ID, 1> FlightPerchingHandler{ REL::ID(1351172) };
+		inline constexpr std::array<REL::ID, 1> FlightTakeOffHandler{ REL::ID(301007) };
+		inline constexpr std::array<REL::ID, 1> ForEachFunctorAdapter_SpellItem_Actor__ForEachSpellVisitor__lambda_74d47e067d27bfae8c7df29fba23a31e__{ REL::ID(1561198) };
+		inline constexpr std::array<REL::ID, 1> ForEachFunctorAdapter_SpellItem_Actor__ForEachSpellVisitor__lambda_7f2e9e9062ce8d44ebd94a5be87bcf37__{ REL::ID(637009) };
+		inline constexpr std::array<REL::ID, 1> FreeCameraState{ REL::ID(21725) };
+		inline constexpr std::array<REL::ID, 1> FrenzyEffect{ REL::ID(681677) };
+		inline constexpr std::array<REL::ID, 1> FurnitureCameraState{ REL::ID(7892) };
+		inline constexpr std::array<REL::ID, 1> FutBinaryFileC{ REL::ID(1544093) };
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> GFxConvertHandler{ REL::ID(1369172) };
+		inline constexpr std::array<REL::ID, 2> GameMenuBase{ REL::ID(961208), REL::ID(1040696) };
+		inline constexpr std::array<REL::ID, 1> GameScript__BaseHandleReaderWriter{ REL::ID(1565513) };
+		inline constexpr std::array<REL::ID, 62> GameScript__BasicEventHandler{ REL::ID(672533), REL::ID(1330213), REL::ID(406129), REL::ID(1064294), REL::ID(140221), REL::ID(798587), REL::ID(1456609), REL::ID(532538), REL::ID(1190537), REL::ID(266460), REL::ID(924390), REL::ID(1582797), REL::ID(658803), REL::ID(1316516), REL::ID(392433), REL::ID(1050615), REL::ID(126533), REL::ID(784855), REL::ID(1442729), REL::ID(518665), REL::ID(1176784), REL::ID(252670), REL::ID(910806), REL::ID(1569122), REL::ID(644967), REL::ID(1302757), REL::ID(378706), REL::ID(1036741), REL::ID(112735), REL::ID(771067), REL::ID(1428815), REL::ID(504871), REL::ID(1163061), REL::ID(238891), REL::ID(897062), REL::ID(1555315), REL::ID(631246), REL::ID(1289104), REL::ID(364883), REL::ID(1022969), REL::ID(98945), REL::ID(757389), REL::ID(1415015), REL::ID(490960), REL::ID(1149123), REL::ID(225256), REL::ID(883187), REL::ID(1541464), REL::ID(617337), REL::ID(1275407), REL::ID(351102), REL::ID(1009177), REL::ID(85294), REL::ID(743608), REL::ID(1401339), REL::ID(477266), REL::ID(1135388), REL::ID(211495), REL::ID(869261), REL::ID(1527771), REL::ID(603561), REL::ID(1261698) };
+		inline constexpr std::array<REL::ID, 3> GameScript__CombatEventHandler{ REL::ID(226990), REL::ID(884977), REL::ID(1543190) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____AddItemFunctor_19_{ REL::ID(154248) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____ApplyHavokImpulseFunctor_16_{ REL::ID(987017) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____AttachAshPileFunctor_13_{ REL::ID(1010456) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____CastFunctor_21_{ REL::ID(150942) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____ClearDestructionFunctor_27_{ REL::ID(427572) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____DamageObjectFunctor_2_{ REL::ID(1481358) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____DeleteFunctor_5_{ REL::ID(762741) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____DisableFunctor_4_{ REL::ID(1294434) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____DropObjectFunctor_12_{ REL::ID(389410) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____DropRefFunctor_30_{ REL::ID(551793) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____EnableFunctor_3_{ REL::ID(244301) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____ForceAddRemoveRagdollFunctor_15_{ REL::ID(907804) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToFunctor_0_{ REL::ID(1368376) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToNearestNavmeshLocFunctor_26_{ REL::ID(916090) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToOwnEditorLocFunctor_1_{ REL::ID(1009212) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____MoveToPackLocFunctor_10_{ REL::ID(1073263) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____NonLatentDeleteFunctor_9_{ REL::ID(1107987) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____PlayBinkFunctor_25_{ REL::ID(6121) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____RemoveComponentFunctor_29_{ REL::ID(738351) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____RemoveItemFunctor_23_{ REL::ID(752039) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____ResetFunctor_17_{ REL::ID(1146169) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____ResurrectFunctor_20_{ REL::ID(1529018) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____ScrollCastFunctor_22_{ REL::ID(205919) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____SendPlayerToJailFunctor_18_{ REL::ID(931955) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____SetAngleFunctor_7_{ REL::ID(702586) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____SetMotionTypeFunctor_8_{ REL::ID(1222282) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____SetPositionFunctor_6_{ REL::ID(795635) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____SetScaleFunctor_11_{ REL::ID(498079) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____WaitFor3DFunctor_24_{ REL::ID(1492078) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ConcreteDelayFunctorFactory_GameScript____WaitForResourceRecalcFunctor_28_{ REL::ID(959720) };
+		inline constexpr std::array<REL::ID, 1> GameScript__CustomEventHandler{ REL::ID(248338) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DataFileHandleReaderWriter{ REL::ID(155882) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DelayFunctor{ REL::ID(1499905) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DelayFunctorFactory{ REL::ID(90036) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DispatchAndClean_GameScript__Internal__HitRegistrationList_{ REL::ID(292383) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DispatchAndClean_GameScript__Internal__MagicEffectApplyRegistrationList_{ REL::ID(950740) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DispatchAndClean_GameScript__Internal__RadiationDamageRegistrationList_{ REL::ID(26132) };
+		inline constexpr std::array<REL::ID, 1> GameScript__DistanceEventHandler{ REL::ID(1200658) };
+		inline constexpr std::array<REL::ID, 8> GameScript__FragmentEventHandler{ REL::ID(802633), REL::ID(1460705), REL::ID(536634), REL::ID(1194647), REL::ID(270564), REL::ID(928517), REL::ID(3816), REL::ID(662795) };
+		inline constexpr std::array<REL::ID, 1> GameScript__HandlePolicy{ REL::ID(62648) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Internal__AnimationCallbacks{ REL::ID(1386923) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Internal__IProfileCallQuery{ REL::ID(1541792) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Internal__LOSDetectionEventData{ REL::ID(979674) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Internal__LOSDirectEventData{ REL::ID(8532) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Internal__LOSEventData{ REL::ID(368285) };
+		inline constexpr std::array<REL::ID, 4> GameScript__InventoryEventHandler{ REL::ID(30855), REL::ID(689703), REL::ID(1347307), REL::ID(423199) };
+		inline constexpr std::array<REL::ID, 1> GameScript__LOSEventHandler{ REL::ID(634565) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Logger{ REL::ID(1317532) };
+		inline constexpr std::array<REL::ID, 3> GameScript__MenuEventHandler{ REL::ID(1270386), REL::ID(346059), REL::ID(1004128) };
+		inline constexpr std::array<REL::ID, 1> GameScript__ObjectBindPolicy{ REL::ID(846882) };
+		inline constexpr std::array<REL::ID, 1> GameScript__PathingCallbackMgr{ REL::ID(5444) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Profiler{ REL::ID(1056252) };
+		inline constexpr std::array<REL::ID, 3> GameScript__QuestCallbackMgr{ REL::ID(1420673), REL::ID(496701), REL::ID(1154895) };
+		inline constexpr std::array<REL::ID, 1> GameScript__SaveFileHandleReaderWriter{ REL::ID(328469) };
+		inline constexpr std::array<REL::ID, 1> GameScript__SavePatcher{ REL::ID(1108275) };
+		inline constexpr std::array<REL::ID, 2> GameScript__SleepEventHandler{ REL::ID(1533444), REL::ID(609271) };
+		inline constexpr std::array<REL::ID, 1> GameScript__SoundCallbackMgr{ REL::ID(1300107) };
+		inline constexpr std::array<REL::ID, 1> GameScript__Store{ REL::ID(189841) };
+		inline constexpr std::array<REL::ID, 1> GameScript__TeleportEventHandler{ REL::ID(699553) };
+		inline constexpr std::array<REL::ID, 1> GameScript__TimerEventHandler{ REL::ID(592278) };
+		inline constexpr std::array<REL::ID, 1> GameScript__TrackedStatsEventHandler{ REL::ID(1041462) };
+		inline constexpr std::array<REL::ID, 2> GameScript__WaitEventHandler{ REL::ID(95246), REL::ID(753692) };
+		inline constexpr std::array<REL::ID, 1> GameScript____AddItemFunctor{ REL::ID(1563821) };
+		inline constexpr std::array<REL::ID, 2> GameScript____AddUniqueIDVisitor{ REL::ID(501170), REL::ID(1159418) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ApplyHavokImpulseFunctor{ REL::ID(814622) };
+		inline constexpr std::array<REL::ID, 1> GameScript____AttachAshPileFunctor{ REL::ID(837906) };
+		inline constexpr std::array<REL::ID, 1> GameScript____CastFunctor{ REL::ID(1560521) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ClearDestructionFunctor{ REL::ID(255052) };
+		inline constexpr std::array<REL::ID, 1> GameScript____DamageObjectFunctor{ REL::ID(1308149) };
+		inline constexpr std::array<REL::ID, 1> GameScript____DeleteFunctor{ REL::ID(589997) };
+		inline constexpr std::array<REL::ID, 1> GameScript____DisableFunctor{ REL::ID(1121660) };
+		inline constexpr std::array<REL::ID, 1> GameScript____DropObjectFunctor{ REL::ID(216860) };
+		inline constexpr std::array<REL::ID, 1> GameScript____DropRefFunctor{ REL::ID(378741) };
+		inline constexpr std::array<REL::ID, 1> GameScript____EnableFunctor{ REL::ID(71584) };
+		inline constexpr std::array<REL::ID, 1> GameScript____FadeThenMainMenuCallback{ REL::ID(72526) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ForceAddRemoveRagdollFunctor{ REL::ID(735318) };
+		inline constexpr std::array<REL::ID, 1> GameScript____LatentPlayerMover{ REL::ID(1170051) };
+		inline constexpr std::array<REL::ID, 1> GameScript____LinkParentFunctor__lambda_10580ac741bfa706def9f15af95ca75d__{ REL::ID(1066375) };
+		inline constexpr std::array<REL::ID, 1> GameScript____LinkParentFunctor__lambda_3bab0297006047a3c95f5ff9fb7db710__{ REL::ID(674684) };
+		inline constexpr std::array<REL::ID, 1> GameScript____LinkParentFunctor__lambda_c273be970791f0519c5d877440ad9e75__{ REL::ID(1332304) };
+		inline constexpr std::array<REL::ID, 1> GameScript____LinkParentFunctor__lambda_e776a4297db3f3762fd98c1aa8429394__{ REL::ID(142328) };
+		inline constexpr std::array<REL::ID, 1> GameScript____MoveToBaseFunctor{ REL::ID(1335540) };
+		inline constexpr std::array<REL::ID, 1> GameScript____MoveToFunctor{ REL::ID(976370) };
+		inline constexpr std::array<REL::ID, 1> GameScript____MoveToNearestNavmeshLocFunctor{ REL::ID(524067) };
+		inline constexpr std::array<REL::ID, 1> GameScript____MoveToOwnEditorLocFunctor{ REL::ID(617371) };
+		inline constexpr std::array<REL::ID, 1> GameScript____MoveToPackLocFunctor{ REL::ID(900593) };
+		inline constexpr std::array<REL::ID, 1> GameScript____NonLatentDeleteFunctor{ REL::ID(935232) };
+		inline constexpr std::array<REL::ID, 1> GameScript____PlayBinkFunctor{ REL::ID(1416023) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ProfileCallQueryTranslator{ REL::ID(962983) };
+		inline constexpr std::array<REL::ID, 1> GameScript____RawProfileCallQuery{ REL::ID(1009518) };
+		inline constexpr std::array<REL::ID, 1> GameScript____RemoveComponentFunctor{ REL::ID(565466) };
+		inline constexpr std::array<REL::ID, 1> GameScript____RemoveItemFunctor{ REL::ID(579181) };
+		inline constexpr std::array<REL::ID, 1> GameScript____RemoveUniqueIDAndRefrFunctor{ REL::ID(856763) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ResetFunctor{ REL::ID(973328) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ResurrectFunctor{ REL::ID(1355845) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ScriptMessageBoxCallback{ REL::ID(636600) };
+		inline constexpr std::array<REL::ID, 1> GameScript____ScrollCastFunctor{ REL::ID(32711) };
+		inline constexpr std::array<REL::ID, 1> GameScript____SendPlayerToJailFunctor{ REL::ID(759496) };
+		inline constexpr std::array<REL::ID, 1> GameScript____SetAngleFunctor{ REL::ID(309999) };
+		inline constexpr std::array<REL::ID, 1> GameScript____SetMotionTypeFunctor{ REL::ID(1189169) };
+		inline constexpr std::array<REL::ID, 1> GameScript____SetPositionFunctor{ REL::ID(403119) };
+		inline constexpr std::array<REL::ID, 1> GameScript____SetScaleFunctor{ REL::ID(1030010) };
+		inline constexpr std::array<REL::ID, 1> GameScript____UniqueIDCompareFunctor{ REL::ID(198848) };
+		inline constexpr std::array<REL::ID, 1> GameScript____WaitFor3DFunctor{ REL::ID(1318881) };
+		inline constexpr std::array<REL::ID, 1> GameScript____WaitForResourceRecalcFunctor{ REL::ID(787235) };
+		inline constexpr std::array<REL::ID, 1> GameScript____WriteStackWrapper{ REL::ID(1484420) };
+		inline constexpr std::array<REL::ID, 1> GameSettingCollection{ REL::ID(618060) };
+		inline constexpr std::array<REL::ID, 5> GameUIModel{ REL::ID(194582), REL::ID(852335), REL::ID(1510819), REL::ID(586609), REL::ID(1244676) };
+		inline constexpr std::array<REL::ID, 10> GameVM{ REL::ID(646911), REL::ID(1524406), REL::ID(819520), REL::ID(1477891), REL::ID(553681), REL::ID(1211827), REL::ID(287261), REL::ID(945514), REL::ID(20986), REL::ID(680040) };
+		inline constexpr std::array<REL::ID, 2> GenericMenu{ REL::ID(933707), REL::ID(1013101) };
+		inline constexpr std::array<REL::ID, 1> GetBestAmmoFunctor{ REL::ID(1193200) };
+		inline constexpr std::array<REL::ID, 1> GetBestArmorFunctor{ REL::ID(269141) };
+		inline constexpr std::array<REL::ID, 1> GetBestLightFunctor{ REL::ID(927075) };
+		inline constexpr std::array<REL::ID, 1> GetBestWeaponFunctor{ REL::ID(535193) };
+		inline constexpr std::array<REL::ID, 1> GetCostliestEffectFunctor{ REL::ID(656019) };
+		inline constexpr std::array<REL::ID, 1> GetMagicItemDescriptionFunctor{ REL::ID(26994) };
+		inline constexpr std::array<REL::ID, 1> GetUpEndHandler{ REL::ID(1576330) };
+		inline constexpr std::array<REL::ID, 1> GetUpStartHandler{ REL::ID(917954) };
+		inline constexpr std::array<REL::ID, 1> GrabRotationHandler{ REL::ID(642919) };
+		inline constexpr std::array<REL::ID, 8> GrenadeProjectile{ REL::ID(17672), REL::ID(939159), REL::ID(14592), REL::ID(673488), REL::ID(1331174), REL::ID(626773), REL::ID(220787), REL::ID(1317444) };
+		inline constexpr std::array<REL::ID, 1> GridArray{ REL::ID(311744) };
+		inline constexpr std::array<REL::ID, 1> GridCellArray{ REL::ID(470561) };
+		inline constexpr std::array<REL::ID, 1> GroundPathPathingNodeGenerator{ REL::ID(714162) };
+		inline constexpr std::array<REL::ID, 1> GroundPathRayValidator{ REL::ID(1026162) };
+		inline constexpr std::array<REL::ID, 1> GuardActorPackageData{ REL::ID(1486929) };
+		inline constexpr std::array<REL::ID, 1> GuardPackageData{ REL::ID(1313773) };
+		inline constexpr std::array<REL::ID, 1> GuideEffect{ REL::ID(269865) };
+		inline constexpr std::array<REL::ID, 1> GunDownStateChangeHandler{ REL::ID(1268926) };
+	}
+}
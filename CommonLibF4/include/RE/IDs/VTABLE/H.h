@@ -0,0 +1,1016 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> HUDActionPointData{ REL::ID(620299) };
+		inline constexpr std::array<REL::ID, 3> HUDActionPointMeter{ REL::ID(531327), REL::ID(1096069), REL::ID(172171) };
+		inline constexpr std::array<REL::ID, 2> HUDActiveEffectsDisplay{ REL::ID(410206), REL::ID(1021775) };
+		inline constexpr std::array<REL::ID, 2> HUDActiveEffectsModel{ REL::ID(1432895), REL::ID(509006) };
+		inline constexpr std::array<REL::ID, 2> HUDActorValueMeterBase{ REL::ID(1325944), REL::ID(308722) };
+		inline constexpr std::array<REL::ID, 2> HUDAmmoCounter{ REL::ID(1125794), REL::ID(155289) };
+		inline constexpr std::array<REL::ID, 2> HUDCompass{ REL::ID(1322923), REL::ID(352207) };
+		inline constexpr std::array<REL::ID, 2> HUDCompassBase{ REL::ID(100128), REL::ID(712076) };
+		inline constexpr std::array<REL::ID, 2> HUDCompassDirectionMarker{ REL::ID(577155), REL::ID(530582) };
+		inline constexpr std::array<REL::ID, 2> HUDCompassMarker{ REL::ID(1188617), REL::ID(1141927) };
+		inline constexpr std::array<REL::ID, 2> HUDCompassMarkerBase{ REL::ID(1547951), REL::ID(1501607) };
+		inline constexpr std::array<REL::ID, 2> HUDComponentBase{ REL::ID(722718), REL::ID(1333623) };
+		inline constexpr std::array<REL::ID, 2> HUDCriticalMeter{ REL::ID(681516), REL::ID(368376) };
+		inline constexpr std::array<REL::ID, 2> HUDCrosshair{ REL::ID(387513), REL::ID(998829) };
+		inline constexpr std::array<REL::ID, 2> HUDCrosshair__FXCrosshairBase{ REL::ID(919451), REL::ID(1577824) };
+		inline constexpr std::array<REL::ID, 2> HUDCrosshair__FXCrosshairBase__FXCrosshairTicks{ REL::ID(1185631), REL::ID(261408) };
+		inline constexpr std::array<REL::ID, 1> HUDData{ REL::ID(820513) };
+		inline constexpr std::array<REL::ID, 1> HUDDataBase{ REL::ID(1525421) };
+		inline constexpr std::array<REL::ID, 1> HUDDataModel{ REL::ID(54303) };
+		inline constexpr std::array<REL::ID, 2> HUDDirectionalHitIndicatorDataModel{ REL::ID(47243), REL::ID(705996) };
+		inline constexpr std::array<REL::ID, 2> HUDEnemyHealthMeter{ REL::ID(1224018), REL::ID(911244) };
+		inline constexpr std::array<REL::ID, 2> HUDExperienceMeter{ REL::ID(1368774), REL::ID(398175) };
+		inline constexpr std::array<REL::ID, 3> HUDExplosiveAmmoCounter{ REL::ID(1471613), REL::ID(500540), REL::ID(1158777) };
+		inline constexpr std::array<REL::ID, 1> HUDExplosivesDataModel{ REL::ID(809683) };
+		inline constexpr std::array<REL::ID, 2> HUDFatigueWarning{ REL::ID(1500956), REL::ID(529856) };
+		inline constexpr std::array<REL::ID, 2> HUDFlashLightWidget{ REL::ID(63640), REL::ID(675507) };
+		inline constexpr std::array<REL::ID, 2> HUDFloatingQuestMarkers{ REL::ID(1473247), REL::ID(502214) };
+		inline constexpr std::array<REL::ID, 2> HUDFloatingQuestMarkers__QuestMarker{ REL::ID(156916), REL::ID(815000) };
+		inline constexpr std::array<REL::ID, 2> HUDLocationText{ REL::ID(875306), REL::ID(1487232) };
+		inline constexpr std::array<REL::ID, 4> HUDMenu{ REL::ID(585176), REL::ID(664675), REL::ID(1275975), REL::ID(351675) };
+		inline constexpr std::array<REL::ID, 3> HUDMessages{ REL::ID(724321), REL::ID(1335209), REL::ID(411155) };
+		inline constexpr std::array<REL::ID, 4> HUDMessagesModel{ REL::ID(589676), REL::ID(1247790), REL::ID(323352), REL::ID(981355) };
+		inline constexpr std::array<REL::ID, 2> HUDMeter{ REL::ID(1014310), REL::ID(702255) };
+		inline constexpr std::array<REL::ID, 2> HUDMeterBase{ REL::ID(1107646), REL::ID(136904) };
+		inline constexpr std::array<REL::ID, 3> HUDNotificationsModel{ REL::ID(1142816), REL::ID(218821), REL::ID(876733) };
+		inline constexpr std::array<REL::ID, 2> HUDObjectiveUpdates{ REL::ID(753377), REL::ID(1364252) };
+		inline constexpr std::array<REL::ID, 2> HUDPerkVaultBoy{ REL::ID(1087814), REL::ID(117042) };
+		inline constexpr std::array<REL::ID, 1> HUDPerkVaultBoyModel{ REL::ID(9558) };
+		inline constexpr std::array<REL::ID, 2> HUDPlayerHealthMeter{ REL::ID(514595), REL::ID(1079422) };
+		inline constexpr std::array<REL::ID, 3> HUDPowerArmorLowBatterWarningText{ REL::ID(623296), REL::ID(1234808), REL::ID(310568) };
+		inline constexpr std::array<REL::ID, 2> HUDQuestUpdates{ REL::ID(393725), REL::ID(1005158) };
+		inline constexpr std::array<REL::ID, 2> HUDQuestVaultBoy{ REL::ID(328065), REL::ID(939556) };
+		inline constexpr std::array<REL::ID, 2> HUDQuickContainer{ REL::ID(6492), REL::ID(618673) };
+		inline constexpr std::array<REL::ID, 7> HUDQuickContainerDataModel{ REL::ID(1347621), REL::ID(377029), REL::ID(1035055), REL::ID(111043), REL::ID(769360), REL::ID(1427058), REL::ID(503147) };
+		inline constexpr std::array<REL::ID, 2> HUDRadiationMeter{ REL::ID(349393), REL::ID(961000) };
+		inline constexpr std::array<REL::ID, 2> HUDRadiationModel{ REL::ID(840301), REL::ID(1498783) };
+		inline constexpr std::array<REL::ID, 2> HUDRollover{ REL::ID(373991), REL::ID(985319) };
+		inline constexpr std::array<REL::ID, 3> HUDRolloverModel{ REL::ID(1401979), REL::ID(477916), REL::ID(1355259) };
+		inline constexpr std::array<REL::ID, 1> HUDScreenModel{ REL::ID(857544) };
+		inline constexpr std::array<REL::ID, 2> HUDStealthMeter{ REL::ID(968609), REL::ID(1580300) };
+		inline constexpr std::array<REL::ID, 2> HUDSubtitleText{ REL::ID(450198), REL::ID(1061946) };
+		inline constexpr std::array<REL::ID, 2> HUDTutorialText{ REL::ID(49834), REL::ID(661711) };
+		inline constexpr std::array<REL::ID, 1> HandlerCreationMissPolicy_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ REL::ID(352536) };
+		inline constexpr std::array<REL::ID, 1> HasSpellVisitor{ REL::ID(1533660) };
+		inline constexpr std::array<REL::ID, 1> HavokError{ REL::ID(1017128) };
+		inline constexpr std::array<REL::ID, 1> HavokFileStreambufReader{ REL::ID(778959) };
+		inline constexpr std::array<REL::ID, 1> HavokFileStreambufWriter{ REL::ID(685821) };
+		inline constexpr std::array<REL::ID, 1> HavokStreambufFactory{ REL::ID(1549331) };
+		inline constexpr std::array<REL::ID, 8> Hazard{ REL::ID(67114), REL::ID(1001755), REL::ID(77866), REL::ID(736247), REL::ID(1393811), REL::ID(689620), REL::ID(283374), REL::ID(1380035) };
+		inline constexpr std::array<REL::ID, 1> HeadTrackingOffHandler{ REL::ID(1491625) };
+		inline constexpr std::array<REL::ID, 1> HeadTrackingOnHandler{ REL::ID(833154) };
+		inline constexpr std::array<REL::ID, 1> HeadTrackingRotationOffHandler{ REL::ID(1225471) };
+		inline constexpr std::array<REL::ID, 1> HeadTrackingRotationOnHandler{ REL::ID(567286) };
+		inline constexpr std::array<REL::ID, 1> HealthDamageFunctor{ REL::ID(1530385) };
+		inline constexpr std::array<REL::ID, 1> HeldStateHandler{ REL::ID(141190) };
+		inline constexpr std::array<REL::ID, 2> HelpMessageManager{ REL::ID(1312198), REL::ID(168976) };
+		inline constexpr std::array<REL::ID, 1> HighActorCuller{ REL::ID(325846) };
+		inline constexpr std::array<REL::ID, 1> HitFrameHandler{ REL::ID(846835) };
+		inline constexpr std::array<REL::ID, 1> HolotapeDataManager{ REL::ID(1056950) };
+		inline constexpr std::array<REL::ID, 1> HolotapeLoadedHandler{ REL::ID(1381022) };
+		inline constexpr std::array<REL::ID, 3> HolotapeMenu{ REL::ID(132900), REL::ID(651407), REL::ID(1262769) };
+		inline constexpr std::array<REL::ID, 1> HorseCameraState{ REL::ID(1580082) };
+		inline constexpr std::array<REL::ID, 1> hclAction{ REL::ID(573456) };
+		inline constexpr std::array<REL::ID, 1> hclAntiPinchConstraintInstanceData{ REL::ID(556649) };
+		inline constexpr std::array<REL::ID, 1> hclAntiPinchConstraintSet{ REL::ID(120315) };
+		inline constexpr std::array<REL::ID, 1> hclBSClothParameterizedWindAction{ REL::ID(184415) };
+		inline constexpr std::array<REL::ID, 1> hclBSWorld{ REL::ID(1327063) };
+		inline constexpr std::array<REL::ID, 1> hclBendLinkConstraintSet{ REL::ID(1035969) };
+		inline constexpr std::array<REL::ID, 1> hclBendLinkConstraintSetMx{ REL::ID(808504) };
+		inline constexpr std::array<REL::ID, 1> hclBendStiffnessConstraintSet{ REL::ID(62260) };
+		inline constexpr std::array<REL::ID, 1> hclBendStiffnessConstraintSetMx{ REL::ID(1389053) };
+		inline constexpr std::array<REL::ID, 1> hclBlendSomeVerticesOperator{ REL::ID(111247) };
+		inline constexpr std::array<REL::ID, 1> hclBonePlanesConstraintSet{ REL::ID(881664) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceMeshMeshDeformOperator{ REL::ID(867779) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceMeshMeshDeformPNOperator{ REL::ID(774992) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceMeshMeshDeformPNTBOperator{ REL::ID(56170) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceMeshMeshDeformPNTOperator{ REL::ID(919901) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceMeshMeshDeformPOperator{ REL::ID(1344803) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceSkinOperator{ REL::ID(892581) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceSkinPNOperator{ REL::ID(799425) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceSkinPNTBOperator{ REL::ID(1490538) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceSkinPNTOperator{ REL::ID(599150) };
+		inline constexpr std::array<REL::ID, 1> hclBoneSpaceSkinPOperator{ REL::ID(1289961) };
+		inline constexpr std::array<REL::ID, 1> hclBuffer{ REL::ID(1342882) };
+		inline constexpr std::array<REL::ID, 1> hclBufferDefinition{ REL::ID(450414) };
+		inline constexpr std::array<REL::ID, 1> hclCapsuleShape{ REL::ID(157344) };
+		inline constexpr std::array<REL::ID, 1> hclClothContainer{ REL::ID(1483257) };
+		inline constexpr std::array<REL::ID, 1> hclClothData{ REL::ID(1418196) };
+		inline constexpr std::array<REL::ID, 1> hclClothInstance{ REL::ID(101647) };
+		inline constexpr std::array<REL::ID, 1> hclClothState{ REL::ID(779640) };
+		inline constexpr std::array<REL::ID, 1> hclCollidable{ REL::ID(208834) };
+		inline constexpr std::array<REL::ID, 1> hclCompressibleLinkConstraintSet{ REL::ID(990097) };
+		inline constexpr std::array<REL::ID, 1> hclCompressibleLinkConstraintSetMx{ REL::ID(1121783) };
+		inline constexpr std::array<REL::ID, 1> hclConstraintSet{ REL::ID(652577) };
+		inline constexpr std::array<REL::ID, 1> hclConvexGeometryShape{ REL::ID(628346) };
+		inline constexpr std::array<REL::ID, 1> hclConvexHeightFieldShape{ REL::ID(1212359) };
+		inline constexpr std::array<REL::ID, 1> hclConvexPlanesShape{ REL::ID(746079) };
+		inline constexpr std::array<REL::ID, 1> hclCopyVerticesOperator{ REL::ID(904839) };
+		inline constexpr std::array<REL::ID, 1> hclGatherAllVerticesOperator{ REL::ID(1063732) };
+		inline constexpr std::array<REL::ID, 1> hclGatherSomeVerticesOperator{ REL::ID(518108) };
+		inline constexpr std::array<REL::ID, 1> hclInputConvertOperator{ REL::ID(677392) };
+		inline constexpr std::array<REL::ID, 1> hclInstantiationUtil{ REL::ID(478994) };
+		inline constexpr std::array<REL::ID, 1> hclLocalRangeConstraintSet{ REL::ID(1527232) };
+		inline constexpr std::array<REL::ID, 1> hclMeshBoneDeformOperator{ REL::ID(355892) };
+		inline constexpr std::array<REL::ID, 1> hclMeshMeshDeformOperator{ REL::ID(767474) };
+		inline constexpr std::array<REL::ID, 1> hclMoveParticlesOperator{ REL::ID(128228) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceMeshMeshDeformOperator{ REL::ID(1258116) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceMeshMeshDeformPNOperator{ REL::ID(1164826) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceMeshMeshDeformPNTBOperator{ REL::ID(712718) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceMeshMeshDeformPNTOperator{ REL::ID(698986) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceMeshMeshDeformPOperator{ REL::ID(685084) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceSkinOperator{ REL::ID(232328) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceSkinPNOperator{ REL::ID(138957) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceSkinPNTBOperator{ REL::ID(734076) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceSkinPNTOperator{ REL::ID(1424490) };
+		inline constexpr std::array<REL::ID, 1> hclObjectSpaceSkinPOperator{ REL::ID(533610) };
+		inline constexpr std::array<REL::ID, 1> hclOperator{ REL::ID(204673) };
+		inline constexpr std::array<REL::ID, 1> hclOutputConvertOperator{ REL::ID(958446) };
+		inline constexpr std::array<REL::ID, 1> hclPlaneShape{ REL::ID(1463091) };
+		inline constexpr std::array<REL::ID, 1> hclPointContactPlanesShape{ REL::ID(1566701) };
+		inline constexpr std::array<REL::ID, 1> hclScratchBuffer{ REL::ID(828762) };
+		inline constexpr std::array<REL::ID, 1> hclScratchBufferDefinition{ REL::ID(950045) };
+		inline constexpr std::array<REL::ID, 1> hclShadowBuffer{ REL::ID(987500) };
+		inline constexpr std::array<REL::ID, 1> hclShadowBufferDefinition{ REL::ID(1328245) };
+		inline constexpr std::array<REL::ID, 1> hclShape{ REL::ID(1566986) };
+		inline constexpr std::array<REL::ID, 1> hclSimClothData{ REL::ID(617710) };
+		inline constexpr std::array<REL::ID, 1> hclSimClothInstance{ REL::ID(1305439) };
+		inline constexpr std::array<REL::ID, 1> hclSimClothPose{ REL::ID(1187895) };
+		inline constexpr std::array<REL::ID, 1> hclSimpleMeshBoneDeformOperator{ REL::ID(176053) };
+		inline constexpr std::array<REL::ID, 1> hclSimpleWindAction{ REL::ID(746307) };
+		inline constexpr std::array<REL::ID, 1> hclSimulateOperator{ REL::ID(200491) };
+		inline constexpr std::array<REL::ID, 1> hclSkinOperator{ REL::ID(1461659) };
+		inline constexpr std::array<REL::ID, 1> hclSphereShape{ REL::ID(822581) };
+		inline constexpr std::array<REL::ID, 1> hclStandardLinkConstraintSet{ REL::ID(263029) };
+		inline constexpr std::array<REL::ID, 1> hclStandardLinkConstraintSetMx{ REL::ID(1458573) };
+		inline constexpr std::array<REL::ID, 1> hclStaticShadowBuffer{ REL::ID(1146670) };
+		inline constexpr std::array<REL::ID, 1> hclStaticShadowBufferDefinition{ REL::ID(31809) };
+		inline constexpr std::array<REL::ID, 1> hclStretchLinkConstraintSet{ REL::ID(495295) };
+		inline constexpr std::array<REL::ID, 1> hclStretchLinkConstraintSetMx{ REL::ID(706883) };
+		inline constexpr std::array<REL::ID, 1> hclTaperedCapsuleShape{ REL::ID(1249372) };
+		inline constexpr std::array<REL::ID, 1> hclTransformSet{ REL::ID(385765) };
+		inline constexpr std::array<REL::ID, 1> hclTransformSetDefinition{ REL::ID(955655) };
+		inline constexpr std::array<REL::ID, 1> hclTransitionConstraintInstanceData{ REL::ID(1580934) };
+		inline constexpr std::array<REL::ID, 1> hclTransitionConstraintSet{ REL::ID(1539757) };
+		inline constexpr std::array<REL::ID, 1> hclUpdateAllVertexFramesOperator{ REL::ID(527703) };
+		inline constexpr std::array<REL::ID, 1> hclUpdateSomeVertexFramesOperator{ REL::ID(472412) };
+		inline constexpr std::array<REL::ID, 1> hclVolumeConstraint{ REL::ID(179279) };
+		inline constexpr std::array<REL::ID, 1> hclVolumeConstraintInstanceData{ REL::ID(1474073) };
+		inline constexpr std::array<REL::ID, 1> hclVolumeConstraintMx{ REL::ID(735893) };
+		inline constexpr std::array<REL::ID, 1> hclVolumeConstraintMxInstanceData{ REL::ID(928003) };
+		inline constexpr std::array<REL::ID, 1> hclWorld{ REL::ID(401046) };
+		inline constexpr std::array<REL::ID, 1> hclWorldListener{ REL::ID(135212) };
+		inline constexpr std::array<REL::ID, 1> hkArrayStreamWriter{ REL::ID(1441227) };
+		inline constexpr std::array<REL::ID, 1> hkBaseObject{ REL::ID(146345) };
+		inline constexpr std::array<REL::ID, 1> hkBinaryPackfileWriter{ REL::ID(1522887) };
+		inline constexpr std::array<REL::ID, 1> hkBinaryTagfileReader{ REL::ID(1210260) };
+		inline constexpr std::array<REL::ID, 1> hkBinaryTagfileWriter{ REL::ID(1089238) };
+		inline constexpr std::array<REL::ID, 1> hkBlockStreamAllocator{ REL::ID(463127) };
+		inline constexpr std::array<REL::ID, 1> hkBlockStreamCommandWriter{ REL::ID(1205336) };
+		inline constexpr std::array<REL::ID, 1> hkBsdSocket{ REL::ID(1512049) };
+		inline constexpr std::array<REL::ID, 1> hkBufferedStreamReader{ REL::ID(687888) };
+		inline constexpr std::array<REL::ID, 1> hkBufferedStreamWriter{ REL::ID(714607) };
+		inline constexpr std::array<REL::ID, 1> hkBuiltinTypeRegistry{ REL::ID(581958) };
+		inline constexpr std::array<REL::ID, 1> hkClassNameRegistry{ REL::ID(1193337) };
+		inline constexpr std::array<REL::ID, 1> hkCommandRouter{ REL::ID(1326750) };
+		inline constexpr std::array<REL::ID, 1> hkContainerDebugAllocator__Allocator{ REL::ID(236398) };
+		inline constexpr std::array<REL::ID, 1> hkContainerHeapAllocator__Allocator{ REL::ID(329553) };
+		inline constexpr std::array<REL::ID, 1> hkContainerResourceMap{ REL::ID(49980) };
+		inline constexpr std::array<REL::ID, 1> hkContainerTempAllocator__Allocator{ REL::ID(422650) };
+		inline constexpr std::array<REL::ID, 1> hkCrc32StreamWriter{ REL::ID(80365) };
+		inline constexpr std::array<REL::ID, 1> hkCrcStreamWriter_unsignedint_3988292384_{ REL::ID(612428) };
+		inline constexpr std::array<REL::ID, 1> hkDataArrayImpl{ REL::ID(180511) };
+		inline constexpr std::array<REL::ID, 1> hkDataArrayNative{ REL::ID(1218709) };
+		inline constexpr std::array<REL::ID, 1> hkDataClassDict{ REL::ID(125318) };
+		inline constexpr std::array<REL::ID, 1> hkDataClassImpl{ REL::ID(1043965) };
+		inline constexpr std::array<REL::ID, 1> hkDataClassNative{ REL::ID(1577818) };
+		inline constexpr std::array<REL::ID, 1> hkDataObjectDict{ REL::ID(470552) };
+		inline constexpr std::array<REL::ID, 1> hkDataObjectImpl{ REL::ID(950825) };
+		inline constexpr std::array<REL::ID, 1> hkDataObjectNative{ REL::ID(499819) };
+		inline constexpr std::array<REL::ID, 1> hkDataRefCounted{ REL::ID(1104395) };
+		inline constexpr std::array<REL::ID, 1> hkDataWorld{ REL::ID(59455) };
+		inline constexpr std::array<REL::ID, 1> hkDataWorldDict{ REL::ID(1016448) };
+		inline constexpr std::array<REL::ID, 1> hkDataWorldNative{ REL::ID(182121) };
+		inline constexpr std::array<REL::ID, 1> hkDebugCommandProcessor{ REL::ID(1096101) };
+		inline constexpr std::array<REL::ID, 1> hkDebugDisplay{ REL::ID(1203880) };
+		inline constexpr std::array<REL::ID, 1> hkDebugDisplayHandler{ REL::ID(844463) };
+		inline constexpr std::array<REL::ID, 3> hkDebugDisplayProcess{ REL::ID(79363), REL::ID(1176232), REL::ID(205580) };
+		inline constexpr std::array<REL::ID, 1> hkDefaultBuiltinTypeRegistry{ REL::ID(208960) };
+		inline constexpr std::array<REL::ID, 1> hkDefaultClassNameRegistry{ REL::ID(1272833) };
+		inline constexpr std::array<REL::ID, 1> hkDefaultClassWrapper{ REL::ID(889027) };
+		inline constexpr std::array<REL::ID, 1> hkDefaultError{ REL::ID(171406) };
+		inline constexpr std::array<REL::ID, 1> hkDefaultImage{ REL::ID(1103354) };
+		inline constexpr std::array<REL::ID, 1> hkDefaultMemoryTracker{ REL::ID(87629) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayAABB{ REL::ID(1394625) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayBox{ REL::ID(42196) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayCapsule{ REL::ID(1488412) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayCone{ REL::ID(1353077) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayConvex{ REL::ID(1441422) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayCylinder{ REL::ID(687060) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayGeometry{ REL::ID(451353) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayMesh{ REL::ID(322061) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayPlane{ REL::ID(368656) };
+		inline constexpr std::array<REL::ID, 1> hkDisplaySemiCircle{ REL::ID(1306531) };
+		inline constexpr std::array<REL::ID, 1> hkDisplaySerializeIStream{ REL::ID(790714) };
+		inline constexpr std::array<REL::ID, 1> hkDisplaySerializeOStream{ REL::ID(486212) };
+		inline constexpr std::array<REL::ID, 1> hkDisplaySphere{ REL::ID(404886) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayTaperedCapsule{ REL::ID(1550590) };
+		inline constexpr std::array<REL::ID, 1> hkDisplayWireframe{ REL::ID(1348054) };
+		inline constexpr std::array<REL::ID, 1> hkDummyMemoryTrackerImpl{ REL::ID(1006173) };
+		inline constexpr std::array<REL::ID, 1> hkDummySingleton{ REL::ID(1526115) };
+		inline constexpr std::array<REL::ID, 1> hkDynamicClassNameRegistry{ REL::ID(1365709) };
+		inline constexpr std::array<REL::ID, 1> hkErrStream{ REL::ID(749675) };
+		inline constexpr std::array<REL::ID, 1> hkError{ REL::ID(446689) };
+		inline constexpr std::array<REL::ID, 1> hkFileSystem{ REL::ID(1310634) };
+		inline constexpr std::array<REL::ID, 1> hkFileSystem__Iterator__Impl{ REL::ID(1281370) };
+		inline constexpr std::array<REL::ID, 1> hkFixedBlockStreamAllocator{ REL::ID(1514011) };
+		inline constexpr std::array<REL::ID, 1> hkGeometry{ REL::ID(996943) };
+		inline constexpr std::array<REL::ID, 1> hkGeometryProcessing__ConstFunction_hkGeometryProcessing__IFunction_hkVector4f_float__{ REL::ID(350802) };
+		inline constexpr std::array<REL::ID, 1> hkGeometryProcessing__IFunction_hkVector4f_float_{ REL::ID(1275109) };
+		inline constexpr std::array<REL::ID, 1> hkGeometryUtils__IVertices{ REL::ID(841773) };
+		inline constexpr std::array<REL::ID, 1> hkHardwareInfo{ REL::ID(1128283) };
+		inline constexpr std::array<REL::ID, 1> hkIArchive{ REL::ID(369944) };
+		inline constexpr std::array<REL::ID, 1> hkImage{ REL::ID(1149841) };
+		inline constexpr std::array<REL::ID, 1> hkIndexedTransformSet{ REL::ID(809998) };
+		inline constexpr std::array<REL::ID, 2> hkInspectProcess{ REL::ID(1451745), REL::ID(966168) };
+		inline constexpr std::array<REL::ID, 1> hkIstream{ REL::ID(931633) };
+		inline constexpr std::array<REL::ID, 1> hkLifoAllocator{ REL::ID(115489) };
+		inline constexpr std::array<REL::ID, 1> hkLoader{ REL::ID(1017177) };
+		inline constexpr std::array<REL::ID, 1> hkLocalFrame{ REL::ID(650161) };
+		inline constexpr std::array<REL::ID, 1> hkLocalFrameCollector{ REL::ID(1064602) };
+		inline constexpr std::array<REL::ID, 1> hkLocalFrameGroup{ REL::ID(1215107) };
+		inline constexpr std::array<REL::ID, 1> hkMallocAllocator{ REL::ID(1384915) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryAllocator{ REL::ID(516009) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryMeshBody{ REL::ID(1020005) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryMeshMaterial{ REL::ID(1271741) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryMeshShape{ REL::ID(1510475) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryMeshTexture{ REL::ID(453962) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryMeshTexture__Sampler{ REL::ID(352827) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryMeshVertexBuffer{ REL::ID(871028) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryResourceContainer{ REL::ID(848064) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryResourceHandle{ REL::ID(502584) };
+		inline constexpr std::array<REL::ID, 2> hkMemorySnapshotProcess{ REL::ID(433972), REL::ID(168477) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryStreamReader{ REL::ID(60351) };
+		inline constexpr std::array<REL::ID, 1> hkMemorySystem{ REL::ID(459795) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryTrackStreamReader{ REL::ID(781985) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryTrackStreamWriter{ REL::ID(1534730) };
+		inline constexpr std::array<REL::ID, 1> hkMemoryTracker{ REL::ID(1099672) };
+		inline constexpr std::array<REL::ID, 1> hkMeshBody{ REL::ID(940556) };
+		inline constexpr std::array<REL::ID, 1> hkMeshMaterial{ REL::ID(753767) };
+		inline constexpr std::array<REL::ID, 1> hkMeshShape{ REL::ID(898737) };
+		inline constexpr std::array<REL::ID, 1> hkMeshTexture{ REL::ID(374714) };
+		inline constexpr std::array<REL::ID, 1> hkMeshTexture__Sampler{ REL::ID(1301872) };
+		inline constexpr std::array<REL::ID, 1> hkMeshVertexBuffer{ REL::ID(525735) };
+		inline constexpr std::array<REL::ID, 1> hkMonitorStreamColorTable{ REL::ID(1287510) };
+		inline constexpr std::array<REL::ID, 1> hkMultipleVertexBuffer{ REL::ID(484389) };
+		inline constexpr std::array<REL::ID, 1> hkOArchive{ REL::ID(1285580) };
+		inline constexpr std::array<REL::ID, 1> hkObjectCopier{ REL::ID(736080) };
+		inline constexpr std::array<REL::ID, 1> hkObjectResource{ REL::ID(1190199) };
+		inline constexpr std::array<REL::ID, 1> hkObjectWriter{ REL::ID(1327547) };
+		inline constexpr std::array<REL::ID, 1> hkOffsetOnlyStreamWriter{ REL::ID(277493) };
+		inline constexpr std::array<REL::ID, 1> hkOstream{ REL::ID(218380) };
+		inline constexpr std::array<REL::ID, 1> hkPackfileData{ REL::ID(578779) };
+		inline constexpr std::array<REL::ID, 1> hkPackfileWriter{ REL::ID(740134) };
+		inline constexpr std::array<REL::ID, 1> hkPackfileWriter__AddObjectListener{ REL::ID(1486971) };
+		inline constexpr std::array<REL::ID, 1> hkParserBuffer{ REL::ID(935318) };
+		inline constexpr std::array<REL::ID, 1> hkPlatformObjectWriter{ REL::ID(795993) };
+		inline constexpr std::array<REL::ID, 1> hkPlatformObjectWriter__Cache{ REL::ID(1281106) };
+		inline constexpr std::array<REL::ID, 1> hkProcess{ REL::ID(1269483) };
+		inline constexpr std::array<REL::ID, 1> hkProcessFactory{ REL::ID(1380835) };
+		inline constexpr std::array<REL::ID, 1> hkProcessHandler{ REL::ID(1060838) };
+		inline constexpr std::array<REL::ID, 1> hkReferencedObject{ REL::ID(1408932) };
+		inline constexpr std::array<REL::ID, 1> hkReferencedObjectLock{ REL::ID(1529624) };
+		inline constexpr std::array<REL::ID, 1> hkRemoteObjectClientSideListener{ REL::ID(441287) };
+		inline constexpr std::array<REL::ID, 2> hkRemoteObjectProcess{ REL::ID(1218809), REL::ID(952541) };
+		inline constexpr std::array<REL::ID, 1> hkReplayStreamReader{ REL::ID(220311) };
+		inline constexpr std::array<REL::ID, 1> hkResource{ REL::ID(155742) };
+		inline constexpr std::array<REL::ID, 1> hkResourceBase{ REL::ID(1487423) };
+		inline constexpr std::array<REL::ID, 1> hkResourceContainer{ REL::ID(422959) };
+		inline constexpr std::array<REL::ID, 1> hkResourceHandle{ REL::ID(77692) };
+		inline constexpr std::array<REL::ID, 1> hkResourceMap{ REL::ID(1207582) };
+		inline constexpr std::array<REL::ID, 1> hkSecondaryCommandDispatcher{ REL::ID(1142622) };
+		inline constexpr std::array<REL::ID, 1> hkSeekableStreamReader{ REL::ID(1219854) };
+		inline constexpr std::array<REL::ID, 1> hkSerializeDeprecated{ REL::ID(694492) };
+		inline constexpr std::array<REL::ID, 3> hkServerDebugDisplayHandler{ REL::ID(1224102), REL::ID(738797), REL::ID(1349759) };
+		inline constexpr std::array<REL::ID, 3> hkServerProcessHandler{ REL::ID(90189), REL::ID(1406216), REL::ID(435378) };
+		inline constexpr std::array<REL::ID, 1> hkSignal0__MemberSlot_hknpShapeManager__MutableShapeInfo_void_hknpShapeManager__MutableShapeInfo____void__{ REL::ID(303065) };
+		inline constexpr std::array<REL::ID, 1> hkSignal0__Slot{ REL::ID(177257) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpBodyQualityId___MemberSlot_hknpWorldEx_void_hknpWorldEx____hknpBodyQualityId__{ REL::ID(478436) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpBodyQualityId___Slot{ REL::ID(132970) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpMaterialId___MemberSlot_hknpWorldEx_void_hknpWorldEx____hknpMaterialId__{ REL::ID(1183311) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpMaterialId___Slot{ REL::ID(1010339) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpWorld___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld__{ REL::ID(511375) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpWorld___MemberSlot_hknpBSCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld__{ REL::ID(1433037) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpWorld___MemberSlot_hknpCharacterProxy_void_hknpCharacterProxy____hknpWorld__{ REL::ID(868829) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpWorld___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld__{ REL::ID(1247647) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_hknpWorld___Slot{ REL::ID(1216371) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_unsignedchar___MemberSlot_hknpShapeManager__MutableShapeInfo_void_hknpShapeManager__MutableShapeInfo____unsignedchar__{ REL::ID(1007771) };
+		inline constexpr std::array<REL::ID, 1> hkSignal1_unsignedchar___Slot{ REL::ID(130400) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___GlobalSlot_void___hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(1226211) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_BGSWaterCollisionManager__AutoWater_void_BGSWaterCollisionManager__BGSWaterUpdateI____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(1279356) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_BGSWaterCollisionManager__bhkPlaceableWater_void_BGSWaterCollisionManager__BGSWaterUpdateI____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(1106554) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_BGSWaterCollisionManager__bhkWaterfall_void_BGSWaterCollisionManager__BGSWaterUpdateI____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(401652) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_FOCollisionListener_void_FOCollisionListener____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(734023) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_NavMeshObstacleManager_void_NavMeshObstacleManager____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(1075800) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_bhkCharRigidBodyController_void_bhkCharRigidBodyController____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(815619) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpBSCharacterRigidBody_void_hknpCharacterRigidBody____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(1260621) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(901939) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpProjectileGun_void_hknpProjectileGun____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(931070) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___MemberSlot_hknpWorldEx_void_hknpWorldEx____hknpEventHandlerInputconst_hknpEventconst__{ REL::ID(305686) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpEventHandlerInputconst_hknpEventconst___Slot{ REL::ID(1562471) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hkbnpPhysicsInterface_void_hkbnpPhysicsInterface____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ REL::ID(253552) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ REL::ID(997578) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpConstraintCollisionFilter_void_hknpConstraintCollisionFilter____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ REL::ID(1570008) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpSafeEaseConstraintsAction_void_hknpSafeEaseConstraintsAction____hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ REL::ID(848297) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____Slot{ REL::ID(692593) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkVector4fconst___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld_hkVector4fconst__{ REL::ID(684469) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hkVector4fconst___Slot{ REL::ID(1388660) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___GlobalSlot_void___hknpWorld_hknpBodyId__{ REL::ID(1258840) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___MemberSlot_NavMeshObstacleManager_void_NavMeshObstacleManager____hknpWorld_hknpBodyId__{ REL::ID(198510) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld_hknpBodyId__{ REL::ID(338552) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___MemberSlot_bhkTrapListener_void_bhkTrapListener____hknpWorld_hknpBodyId__{ REL::ID(292849) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___MemberSlot_hkbnpPhysicsInterface_void_hkbnpPhysicsInterface____hknpWorld_hknpBodyId__{ REL::ID(958216) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hknpBodyId__{ REL::ID(1529995) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___MemberSlot_hknpUniqueBodyIdHitCollector_void_hknpUniqueBodyIdHitCollector____hknpWorld_hknpBodyId__{ REL::ID(172078) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyId___Slot{ REL::ID(381177) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyManager___GlobalSlot_void___hknpWorld_hknpBodyManager__{ REL::ID(1011410) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpBodyManager___Slot{ REL::ID(134027) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpConstraintManager___GlobalSlot_void___hknpWorld_hknpConstraintManager__{ REL::ID(1356784) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpConstraintManager___Slot{ REL::ID(479494) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpMotionManager___GlobalSlot_void___hknpWorld_hknpMotionManager__{ REL::ID(1184357) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpMotionManager___Slot{ REL::ID(306745) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpSolverData___MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hknpSolverData__{ REL::ID(652527) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpSolverData___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld_hknpSolverData__{ REL::ID(369842) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpSolverData___Slot{ REL::ID(197385) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpStepInputconst___MemberSlot___hknpActionManagerEx_void_A0xf0a6284e__hknpActionManagerEx____hknpWorld_hknpStepInputconst__{ REL::ID(1043314) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpStepInputconst___MemberSlot_hknpBSCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld_hknpStepInputconst__{ REL::ID(555967) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpStepInputconst___MemberSlot_hknpCharacterRigidBody_void_hknpCharacterRigidBody____hknpWorld_hknpStepInputconst__{ REL::ID(1074625) };
+		inline constexpr std::array<REL::ID, 1> hkSignal2_hknpWorld_hknpStepInputconst___Slot{ REL::ID(166030) };
+		inline constexpr std::array<REL::ID, 1> hkSignal3_hknpWorld_hknpBodyCinfoconst_hknpBodyId___MemberSlot_hkbnpPhysicsInterface_void_hkbnpPhysicsInterface____hknpWorld_hknpBodyCinfoconst_hknpBodyId__{ REL::ID(1130877) };
+		inline constexpr std::array<REL::ID, 1> hkSignal3_hknpWorld_hknpBodyCinfoconst_hknpBodyId___Slot{ REL::ID(80767) };
+		inline constexpr std::array<REL::ID, 1> hkSignal3_hknpWorld_hknpConstraintCinfoconst_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____MemberSlot_hknpBSWorld_void_hknpBSWorld____hknpWorld_hknpConstraintCinfoconst_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant___{ REL::ID(120262) };
+		inline constexpr std::array<REL::ID, 1> hkSignal3_hknpWorld_hknpConstraintCinfoconst_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant____Slot{ REL::ID(825122) };
+		inline constexpr std::array<REL::ID, 1> hkSimpleLocalFrame{ REL::ID(194299) };
+		inline constexpr std::array<REL::ID, 1> hkSkinBinding{ REL::ID(1002524) };
+		inline constexpr std::array<REL::ID, 1> hkSkinnedMeshShape{ REL::ID(169694) };
+		inline constexpr std::array<REL::ID, 1> hkSkinnedRefMeshShape{ REL::ID(1334196) };
+		inline constexpr std::array<REL::ID, 1> hkSlot{ REL::ID(904103) };
+		inline constexpr std::array<REL::ID, 1> hkSocket{ REL::ID(330133) };
+		inline constexpr std::array<REL::ID, 1> hkSocket__ReaderAdapter{ REL::ID(250693) };
+		inline constexpr std::array<REL::ID, 1> hkSocket__WriterAdapter{ REL::ID(862038) };
+		inline constexpr std::array<REL::ID, 1> hkSolverAllocator{ REL::ID(687585) };
+		inline constexpr std::array<REL::ID, 1> hkStackTracer{ REL::ID(847422) };
+		inline constexpr std::array<REL::ID, 1> hkStaticClassNameRegistry{ REL::ID(148394) };
+		inline constexpr std::array<REL::ID, 2> hkStatisticsProcess{ REL::ID(812771), REL::ID(327191) };
+		inline constexpr std::array<REL::ID, 1> hkStdioStreamReader{ REL::ID(1339179) };
+		inline constexpr std::array<REL::ID, 1> hkStorageSkinnedMeshShape{ REL::ID(953761) };
+		inline constexpr std::array<REL::ID, 1> hkStreamReader{ REL::ID(699738) };
+		inline constexpr std::array<REL::ID, 1> hkStreamWriter{ REL::ID(978876) };
+		inline constexpr std::array<REL::ID, 1> hkStringObject{ REL::ID(1498870) };
+		inline constexpr std::array<REL::ID, 1> hkSubStreamWriter{ REL::ID(472229) };
+		inline constexpr std::array<REL::ID, 1> hkTagfileReader{ REL::ID(1355081) };
+		inline constexpr std::array<REL::ID, 1> hkTagfileWriter{ REL::ID(790663) };
+		inline constexpr std::array<REL::ID, 1> hkTagfileWriter__AddDataObjectListener{ REL::ID(1056374) };
+		inline constexpr std::array<REL::ID, 1> hkTask{ REL::ID(983480) };
+		inline constexpr std::array<REL::ID, 1> hkTaskQueue{ REL::ID(1013134) };
+		inline constexpr std::array<REL::ID, 1> hkTaskQueue__EmptyTask{ REL::ID(840571) };
+		inline constexpr std::array<REL::ID, 1> hkThreadMemory{ REL::ID(995702) };
+		inline constexpr std::array<REL::ID, 1> hkThreadPool{ REL::ID(317030) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerArrayLayoutHandler{ REL::ID(1338583) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerEnumLayoutHandler{ REL::ID(825974) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerFlagsLayoutHandler{ REL::ID(872406) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerJobQueueDynamicDataLayoutHandler{ REL::ID(965718) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerJobQueueLayoutHandler{ REL::ID(1012240) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerLayoutCalculator{ REL::ID(241958) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerLayoutHandler{ REL::ID(288369) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerPadSpuLayoutHandler{ REL::ID(1058954) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerPointerMapLayoutHandler{ REL::ID(1105632) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerQueueLayoutHandler{ REL::ID(1152225) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerRefPtrLayoutHandler{ REL::ID(1292154) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerScanSnapshot{ REL::ID(162547) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerSetLayoutHandler{ REL::ID(919077) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerStringMapLayoutHandler{ REL::ID(1245689) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerStringPtrLayoutHandler{ REL::ID(1199094) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerTypeLayout{ REL::ID(774171) };
+		inline constexpr std::array<REL::ID, 1> hkTrackerTypeTreeCache{ REL::ID(1259394) };
+		inline constexpr std::array<REL::ID, 1> hkTypeInfoRegistry{ REL::ID(744053) };
+		inline constexpr std::array<REL::ID, 1> hkTypeManager{ REL::ID(1110683) };
+		inline constexpr std::array<REL::ID, 1> hkUuidPseudoRandomGenerator{ REL::ID(1141595) };
+		inline constexpr std::array<REL::ID, 1> hkVdbCommandWriter{ REL::ID(56745) };
+		inline constexpr std::array<REL::ID, 1> hkVersionPatchManager{ REL::ID(1374157) };
+		inline constexpr std::array<REL::ID, 1> hkVersionPatchManager__ClassWrapper{ REL::ID(58049) };
+		inline constexpr std::array<REL::ID, 1> hkVisualDebugger{ REL::ID(49078) };
+		inline constexpr std::array<REL::ID, 1> hkVtableClassRegistry{ REL::ID(1179519) };
+		inline constexpr std::array<REL::ID, 1> hkWin32FileSystem{ REL::ID(498900) };
+		inline constexpr std::array<REL::ID, 1> hkWin32StreamWriter{ REL::ID(1246330) };
+		inline constexpr std::array<REL::ID, 1> hkXmlLexAnalyzer{ REL::ID(911806) };
+		inline constexpr std::array<REL::ID, 1> hkXmlParser{ REL::ID(296173) };
+		inline constexpr std::array<REL::ID, 1> hkXmlParser__Characters{ REL::ID(781945) };
+		inline constexpr std::array<REL::ID, 1> hkXmlParser__EndElement{ REL::ID(1267156) };
+		inline constexpr std::array<REL::ID, 1> hkXmlParser__Node{ REL::ID(655900) };
+		inline constexpr std::array<REL::ID, 1> hkXmlParser__StartElement{ REL::ID(170472) };
+		inline constexpr std::array<REL::ID, 1> hkXmlStreamParser{ REL::ID(449681) };
+		inline constexpr std::array<REL::ID, 1> hkXmlTagfileReader{ REL::ID(823367) };
+		inline constexpr std::array<REL::ID, 1> hkXmlTagfileWriter{ REL::ID(557483) };
+		inline constexpr std::array<REL::ID, 1> hkaAngularReferenceFrame{ REL::ID(1111535) };
+		inline constexpr std::array<REL::ID, 1> hkaAnimatedReferenceFrame{ REL::ID(414773) };
+		inline constexpr std::array<REL::ID, 1> hkaAnimation{ REL::ID(752337) };
+		inline constexpr std::array<REL::ID, 1> hkaAnimationBinding{ REL::ID(749631) };
+		inline constexpr std::array<REL::ID, 1> hkaAnimationContainer{ REL::ID(812208) };
+		inline constexpr std::array<REL::ID, 1> hkaAnimationControl{ REL::ID(233970) };
+		inline constexpr std::array<REL::ID, 1> hkaAnimationPreviewColorContainer{ REL::ID(648268) };
+		inline constexpr std::array<REL::ID, 1> hkaBoneAttachment{ REL::ID(1093212) };
+		inline constexpr std::array<REL::ID, 1> hkaDefaultAnimatedReferenceFrame{ REL::ID(587967) };
+		inline constexpr std::array<REL::ID, 1> hkaDefaultAnimationControl{ REL::ID(1070511) };
+		inline constexpr std::array<REL::ID, 1> hkaDefaultAnimationControlMapperData{ REL::ID(491814) };
+		inline constexpr std::array<REL::ID, 1> hkaDirectionalReferenceFrame{ REL::ID(1443258) };
+		inline constexpr std::array<REL::ID, 1> hkaFootPlacementIkSolver{ REL::ID(274072) };
+		inline constexpr std::array<REL::ID, 1> hkaFootstepAnalysisInfo{ REL::ID(472345) };
+		inline constexpr std::array<REL::ID, 1> hkaFootstepAnalysisInfoContainer{ REL::ID(672890) };
+		inline constexpr std::array<REL::ID, 1> hkaInterleavedUncompressedAnimation{ REL::ID(123) };
+		inline constexpr std::array<REL::ID, 1> hkaLosslessCompressedAnimation{ REL::ID(1354985) };
+		inline constexpr std::array<REL::ID, 1> hkaMeshBinding{ REL::ID(1267303) };
+		inline constexpr std::array<REL::ID, 1> hkaMirroredSkeleton{ REL::ID(487384) };
+		inline constexpr std::array<REL::ID, 1> hkaNpRagdollPenetrationDetector{ REL::ID(862942) };
+		inline constexpr std::array<REL::ID, 1> hkaNpRagdollRaycastInterface{ REL::ID(942249) };
+		inline constexpr std::array<REL::ID, 1> hkaParameterizedAnimationReferenceFrame{ REL::ID(449894) };
+		inline constexpr std::array<REL::ID, 1> hkaParameterizedReferenceFrame{ REL::ID(499935) };
+		inline constexpr std::array<REL::ID, 1> hkaPredictiveCompressedAnimation{ REL::ID(818097) };
+		inline constexpr std::array<REL::ID, 1> hkaQuantizedAnimation{ REL::ID(499057) };
+		inline constexpr std::array<REL::ID, 1> hkaRaycastInterface{ REL::ID(103892) };
+		inline constexpr std::array<REL::ID, 1> hkaReferencePoseAnimation{ REL::ID(831619) };
+		inline constexpr std::array<REL::ID, 1> hkaSkeleton{ REL::ID(676994) };
+		inline constexpr std::array<REL::ID, 1> hkaSkeletonMapper{ REL::ID(569749) };
+		inline constexpr std::array<REL::ID, 1> hkaSplineCompressedAnimation{ REL::ID(4753) };
+		inline constexpr std::array<REL::ID, 1> hkbAiControlCancelPathCommand{ REL::ID(1510207) };
+		inline constexpr std::array<REL::ID, 1> hkbAiControlPathToCommand{ REL::ID(412832) };
+		inline constexpr std::array<REL::ID, 1> hkbAlignBoneModifier{ REL::ID(921463) };
+		inline constexpr std::array<REL::ID, 1> hkbAnimatedSkeletonGenerator{ REL::ID(1173836) };
+		inline constexpr std::array<REL::ID, 1> hkbAnimationBindingSet{ REL::ID(802975) };
+		inline constexpr std::array<REL::ID, 1> hkbAnimationBindingWithTriggers{ REL::ID(1419384) };
+		inline constexpr std::array<REL::ID, 1> hkbAssetBundle{ REL::ID(403447) };
+		inline constexpr std::array<REL::ID, 1> hkbAssetLoader{ REL::ID(710962) };
+		inline constexpr std::array<REL::ID, 1> hkbAttachmentFixupSceneModifier{ REL::ID(516123) };
+		inline constexpr std::array<REL::ID, 1> hkbAttachmentModifier{ REL::ID(260834) };
+		inline constexpr std::array<REL::ID, 1> hkbAttachmentSceneModifier{ REL::ID(782384) };
+		inline constexpr std::array<REL::ID, 1> hkbAttachmentSetup{ REL::ID(728184) };
+		inline constexpr std::array<REL::ID, 1> hkbAttributeModifier{ REL::ID(858586) };
+		inline constexpr std::array<REL::ID, 1> hkbAuxiliaryNodeInfo{ REL::ID(1402750) };
+		inline constexpr std::array<REL::ID, 2> hkbBehaviorClient{ REL::ID(614443), REL::ID(128901) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorEventsInfo{ REL::ID(180093) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorGraph{ REL::ID(476513) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorGraphData{ REL::ID(206491) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorGraphInternalState{ REL::ID(121720) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorGraphInternalStateInfo{ REL::ID(917445) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorGraphStringData{ REL::ID(1431695) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorGraph__GlobalTransitionData{ REL::ID(107426) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorInfo{ REL::ID(665489) };
+		inline constexpr std::array<REL::ID, 1> hkbBehaviorReferenceGenerator{ REL::ID(1468013) };
+		inline constexpr std::array<REL::ID, 1> hkbBindable{ REL::ID(168611) };
+		inline constexpr std::array<REL::ID, 1> hkbBindableCollector{ REL::ID(361732) };
+		inline constexpr std::array<REL::ID, 1> hkbBindable__CacheBindablesCollector{ REL::ID(1019926) };
+		inline constexpr std::array<REL::ID, 1> hkbBlenderGenerator{ REL::ID(1573667) };
+		inline constexpr std::array<REL::ID, 1> hkbBlenderGeneratorChild{ REL::ID(1400562) };
+		inline constexpr std::array<REL::ID, 1> hkbBlenderGeneratorInternalState{ REL::ID(1539025) };
+		inline constexpr std::array<REL::ID, 1> hkbBlendingTransitionEffect{ REL::ID(405990) };
+		inline constexpr std::array<REL::ID, 1> hkbBlendingTransitionEffectInternalState{ REL::ID(1075622) };
+		inline constexpr std::array<REL::ID, 1> hkbBoneIndexArray{ REL::ID(623257) };
+		inline constexpr std::array<REL::ID, 1> hkbBoneWeightArray{ REL::ID(1228088) };
+		inline constexpr std::array<REL::ID, 1> hkbBoolVariableSequencedData{ REL::ID(1238997) };
+		inline constexpr std::array<REL::ID, 1> hkbCameraShakeEventPayload{ REL::ID(519367) };
+		inline constexpr std::array<REL::ID, 1> hkbCameraVariablesChangedCommand{ REL::ID(898429) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacter{ REL::ID(1139764) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterAddedInfo{ REL::ID(1024352) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterControlCommand{ REL::ID(34359) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterController{ REL::ID(863541) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterControllerDriver{ REL::ID(759120) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterControllerModifier{ REL::ID(126382) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterControllerModifierInternalState{ REL::ID(1178928) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterControllerSceneModifier{ REL::ID(1566705) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterData{ REL::ID(1356330) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterInfo{ REL::ID(539344) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterSelectedInfo{ REL::ID(431836) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterSetup{ REL::ID(934181) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterSkinInfo{ REL::ID(1150515) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterSteppedInfo{ REL::ID(53675) };
+		inline constexpr std::array<REL::ID, 1> hkbCharacterStringData{ REL::ID(931110) };
+		inline constexpr std::array<REL::ID, 1> hkbClientCharacterState{ REL::ID(1099745) };
+		inline constexpr std::array<REL::ID, 1> hkbClipGenerator{ REL::ID(1360555) };
+		inline constexpr std::array<REL::ID, 1> hkbClipGeneratorInternalState{ REL::ID(1237594) };
+		inline constexpr std::array<REL::ID, 1> hkbClipTriggerArray{ REL::ID(264032) };
+		inline constexpr std::array<REL::ID, 1> hkbClosestLocalFrameCollector{ REL::ID(798895) };
+		inline constexpr std::array<REL::ID, 1> hkbCombineTransformsModifier{ REL::ID(817432) };
+		inline constexpr std::array<REL::ID, 1> hkbCombineTransformsModifierInternalState{ REL::ID(1340019) };
+		inline constexpr std::array<REL::ID, 1> hkbCompiledExpressionSet{ REL::ID(1045501) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeDirectionModifier{ REL::ID(631124) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeDirectionModifierInternalState{ REL::ID(280867) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeRotationFromAxisAngleModifier{ REL::ID(444069) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeRotationFromAxisAngleModifierInternalState{ REL::ID(771830) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeRotationToTargetModifier{ REL::ID(257861) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeRotationToTargetModifierInternalState{ REL::ID(875491) };
+		inline constexpr std::array<REL::ID, 1> hkbComputeWorldFromModelModifier{ REL::ID(1039166) };
+		inline constexpr std::array<REL::ID, 1> hkbCondition{ REL::ID(1303096) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomIdSelector{ REL::ID(1246955) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGenerator{ REL::ID(942939) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorAnnotatedTypes{ REL::ID(252080) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorBoneTypes{ REL::ID(1143185) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorComplexTypes{ REL::ID(652749) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorHiddenTypes{ REL::ID(852725) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorNestedTypes{ REL::ID(451986) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorNestedTypesBase{ REL::ID(1343326) };
+		inline constexpr std::array<REL::ID, 1> hkbCustomTestGeneratorSimpleTypes{ REL::ID(1543885) };
+		inline constexpr std::array<REL::ID, 1> hkbDampingModifier{ REL::ID(71441) };
+		inline constexpr std::array<REL::ID, 1> hkbDampingModifierInternalState{ REL::ID(1349329) };
+		inline constexpr std::array<REL::ID, 1> hkbDelayedModifier{ REL::ID(1467229) };
+		inline constexpr std::array<REL::ID, 1> hkbDelayedModifierInternalState{ REL::ID(697220) };
+		inline constexpr std::array<REL::ID, 1> hkbDetectCloseToGroundModifier{ REL::ID(1280581) };
+		inline constexpr std::array<REL::ID, 1> hkbDetectCloseToGroundModifierInternalState{ REL::ID(1286186) };
+		inline constexpr std::array<REL::ID, 1> hkbDockingDriver{ REL::ID(42808) };
+		inline constexpr std::array<REL::ID, 1> hkbDockingGenerator{ REL::ID(735145) };
+		inline constexpr std::array<REL::ID, 1> hkbDockingGeneratorInternalState{ REL::ID(970362) };
+		inline constexpr std::array<REL::ID, 1> hkbDockingSceneModifier{ REL::ID(890900) };
+		inline constexpr std::array<REL::ID, 1> hkbDockingTarget{ REL::ID(1057778) };
+		inline constexpr std::array<REL::ID, 1> hkbEvaluateExpressionModifier{ REL::ID(189366) };
+		inline constexpr std::array<REL::ID, 1> hkbEvaluateExpressionModifierInternalState{ REL::ID(855063) };
+		inline constexpr std::array<REL::ID, 1> hkbEvaluateHandleModifier{ REL::ID(254884) };
+		inline constexpr std::array<REL::ID, 1> hkbEventDrivenModifier{ REL::ID(68384) };
+		inline constexpr std::array<REL::ID, 1> hkbEventDrivenModifierInternalState{ REL::ID(53962) };
+		inline constexpr std::array<REL::ID, 1> hkbEventPayload{ REL::ID(191593) };
+		inline constexpr std::array<REL::ID, 1> hkbEventPayloadList{ REL::ID(1054932) };
+		inline constexpr std::array<REL::ID, 1> hkbEventRaisedInfo{ REL::ID(1276793) };
+		inline constexpr std::array<REL::ID, 1> hkbEventRangeDataArray{ REL::ID(662756) };
+		inline constexpr std::array<REL::ID, 1> hkbEventSequencedData{ REL::ID(188873) };
+		inline constexpr std::array<REL::ID, 1> hkbEventsFromRangeModifier{ REL::ID(745777) };
+		inline constexpr std::array<REL::ID, 1> hkbEventsFromRangeModifierInternalState{ REL::ID(914748) };
+		inline constexpr std::array<REL::ID, 1> hkbExpressionCondition{ REL::ID(1256650) };
+		inline constexpr std::array<REL::ID, 1> hkbExpressionDataArray{ REL::ID(1307516) };
+		inline constexpr std::array<REL::ID, 1> hkbExtractRagdollPoseModifier{ REL::ID(199999) };
+		inline constexpr std::array<REL::ID, 1> hkbExtrapolatingTransitionEffect{ REL::ID(239879) };
+		inline constexpr std::array<REL::ID, 1> hkbExtrapolatingTransitionEffectInternalState{ REL::ID(1561729) };
+		inline constexpr std::array<REL::ID, 1> hkbFootIkControlsModifier{ REL::ID(1063471) };
+		inline constexpr std::array<REL::ID, 1> hkbFootIkDriver{ REL::ID(792502) };
+		inline constexpr std::array<REL::ID, 1> hkbFootIkDriverInfo{ REL::ID(906677) };
+		inline constexpr std::array<REL::ID, 1> hkbFootIkModifier{ REL::ID(172529) };
+		inline constexpr std::array<REL::ID, 1> hkbFootIkSceneModifier{ REL::ID(106659) };
+		inline constexpr std::array<REL::ID, 1> hkbGenerator{ REL::ID(109700) };
+		inline constexpr std::array<REL::ID, 1> hkbGeneratorOutputListener{ REL::ID(1082261) };
+		inline constexpr std::array<REL::ID, 1> hkbGeneratorTransitionEffect{ REL::ID(914623) };
+		inline constexpr std::array<REL::ID, 1> hkbGeneratorTransitionEffectInternalState{ REL::ID(883044) };
+		inline constexpr std::array<REL::ID, 1> hkbGetHandleOnBoneModifier{ REL::ID(1035900) };
+		inline constexpr std::array<REL::ID, 1> hkbGetUpModifier{ REL::ID(1022124) };
+		inline constexpr std::array<REL::ID, 1> hkbGetUpModifierInternalState{ REL::ID(12562) };
+		inline constexpr std::array<REL::ID, 1> hkbGetWorldFromModelModifier{ REL::ID(1447305) };
+		inline constexpr std::array<REL::ID, 1> hkbGetWorldFromModelModifierInternalState{ REL::ID(1082332) };
+		inline constexpr std::array<REL::ID, 1> hkbGravityModifier{ REL::ID(51629) };
+		inline constexpr std::array<REL::ID, 1> hkbHandIkControlsModifier{ REL::ID(1260844) };
+		inline constexpr std::array<REL::ID, 1> hkbHandIkDriver{ REL::ID(1233177) };
+		inline constexpr std::array<REL::ID, 1> hkbHandIkDriverInfo{ REL::ID(1163636) };
+		inline constexpr std::array<REL::ID, 1> hkbHandIkFixupSceneModifier{ REL::ID(1156888) };
+		inline constexpr std::array<REL::ID, 1> hkbHandIkModifier{ REL::ID(1153675) };
+		inline constexpr std::array<REL::ID, 1> hkbHandIkSceneModifier{ REL::ID(1422616) };
+		inline constexpr std::array<REL::ID, 1> hkbHandle{ REL::ID(136212) };
+		inline constexpr std::array<REL::ID, 1> hkbHoldFromBlendingTransitionEffect{ REL::ID(953888) };
+		inline constexpr std::array<REL::ID, 1> hkbIntEventPayload{ REL::ID(122892) };
+		inline constexpr std::array<REL::ID, 1> hkbIntVariableSequencedData{ REL::ID(972668) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__LuaPlus__LuaStateOutFile{ REL::ID(400561) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__ChunkVisitor{ REL::ID(42241) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__CodeGenerator{ REL::ID(1000616) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__CompilerParseAcceptor{ REL::ID(1321651) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__CompilerStateInterface{ REL::ID(680234) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__FrequencyProfiler{ REL::ID(1295810) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__GettableProfiler{ REL::ID(1468871) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__HeapVisualizer{ REL::ID(1062063) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__IProfiler{ REL::ID(1562208) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__MemoryAllocationsByType{ REL::ID(447306) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__Preprocessor{ REL::ID(227403) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__Preprocessor__PreprocessorStateProxy{ REL::ID(759511) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__ReachableChunksAreValid{ REL::ID(332884) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__SimpleCompilerState{ REL::ID(1291279) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__Visitor{ REL::ID(1333960) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__netTransport{ REL::ID(979214) };
+		inline constexpr std::array<REL::ID, 1> hkbInternal__hks__netTransportTCPIP{ REL::ID(8064) };
+		inline constexpr std::array<REL::ID, 1> hkbJigglerGroup{ REL::ID(938717) };
+		inline constexpr std::array<REL::ID, 1> hkbJigglerModifier{ REL::ID(169459) };
+		inline constexpr std::array<REL::ID, 1> hkbJigglerModifierInternalState{ REL::ID(897545) };
+		inline constexpr std::array<REL::ID, 1> hkbKeyframeBonesModifier{ REL::ID(155646) };
+		inline constexpr std::array<REL::ID, 1> hkbLayer{ REL::ID(1285242) };
+		inline constexpr std::array<REL::ID, 1> hkbLayerGenerator{ REL::ID(1458068) };
+		inline constexpr std::array<REL::ID, 1> hkbLayerGeneratorInternalState{ REL::ID(312776) };
+		inline constexpr std::array<REL::ID, 1> hkbLineDockingTarget{ REL::ID(792101) };
+		inline constexpr std::array<REL::ID, 1> hkbLinkedSymbolInfo{ REL::ID(305928) };
+		inline constexpr std::array<REL::ID, 1> hkbLookAtModifier{ REL::ID(646445) };
+		inline constexpr std::array<REL::ID, 1> hkbLookAtModifierInternalState{ REL::ID(133959) };
+		inline constexpr std::array<REL::ID, 1> hkbManualSelectorGenerator{ REL::ID(1071171) };
+		inline constexpr std::array<REL::ID, 1> hkbManualSelectorGeneratorInternalState{ REL::ID(1381257) };
+		inline constexpr std::array<REL::ID, 1> hkbManualSelectorTransitionEffect{ REL::ID(525513) };
+		inline constexpr std::array<REL::ID, 1> hkbManualSelectorTransitionEffectInternalState{ REL::ID(1153632) };
+		inline constexpr std::array<REL::ID, 1> hkbMirrorModifier{ REL::ID(152624) };
+		inline constexpr std::array<REL::ID, 1> hkbMirroredSkeletonInfo{ REL::ID(1495662) };
+		inline constexpr std::array<REL::ID, 1> hkbModifier{ REL::ID(1197756) };
+		inline constexpr std::array<REL::ID, 1> hkbModifierGenerator{ REL::ID(404595) };
+		inline constexpr std::array<REL::ID, 1> hkbModifierList{ REL::ID(297536) };
+		inline constexpr std::array<REL::ID, 1> hkbModifierWrapper{ REL::ID(547833) };
+		inline constexpr std::array<REL::ID, 1> hkbMoveBoneAttachmentModifier{ REL::ID(1161505) };
+		inline constexpr std::array<REL::ID, 1> hkbMoveCharacterModifier{ REL::ID(1320311) };
+		inline constexpr std::array<REL::ID, 1> hkbMoveCharacterModifierInternalState{ REL::ID(1323242) };
+		inline constexpr std::array<REL::ID, 1> hkbNamedEventPayload{ REL::ID(1220015) };
+		inline constexpr std::array<REL::ID, 1> hkbNamedIntEventPayload{ REL::ID(249069) };
+		inline constexpr std::array<REL::ID, 1> hkbNamedRealEventPayload{ REL::ID(734731) };
+		inline constexpr std::array<REL::ID, 1> hkbNamedStringEventPayload{ REL::ID(1345682) };
+		inline constexpr std::array<REL::ID, 1> hkbNode{ REL::ID(1173709) };
+		inline constexpr std::array<REL::ID, 1> hkbNodeInternalStateInfo{ REL::ID(948209) };
+		inline constexpr std::array<REL::ID, 1> hkbNode__BoundVariablesCollector{ REL::ID(95860) };
+		inline constexpr std::array<REL::ID, 2> hkbNullPhysicsInterface{ REL::ID(1551722), REL::ID(440732) };
+		inline constexpr std::array<REL::ID, 1> hkbParametricMotionGenerator{ REL::ID(538288) };
+		inline constexpr std::array<REL::ID, 1> hkbParticleSystemEventPayload{ REL::ID(1403198) };
+		inline constexpr std::array<REL::ID, 2> hkbPhysicsInterface{ REL::ID(1498990), REL::ID(387939) };
+		inline constexpr std::array<REL::ID, 1> hkbPinBonesGenerator{ REL::ID(303905) };
+		inline constexpr std::array<REL::ID, 1> hkbPlaneDockingTarget{ REL::ID(525928) };
+		inline constexpr std::array<REL::ID, 1> hkbPoseMatchingGenerator{ REL::ID(251210) };
+		inline constexpr std::array<REL::ID, 1> hkbPoseMatchingGeneratorInternalState{ REL::ID(1137706) };
+		inline constexpr std::array<REL::ID, 1> hkbPoseStoringGeneratorOutputListener{ REL::ID(330924) };
+		inline constexpr std::array<REL::ID, 1> hkbPoseStoringGeneratorOutputListener__StoredPose{ REL::ID(816406) };
+		inline constexpr std::array<REL::ID, 1> hkbPoweredRagdollControlsModifier{ REL::ID(1133856) };
+		inline constexpr std::array<REL::ID, 1> hkbProceduralBlenderGenerator{ REL::ID(1522742) };
+		inline constexpr std::array<REL::ID, 1> hkbProjectAssetManager{ REL::ID(1090525) };
+		inline constexpr std::array<REL::ID, 1> hkbProjectData{ REL::ID(697324) };
+		inline constexpr std::array<REL::ID, 1> hkbProjectStringData{ REL::ID(1448340) };
+		inline constexpr std::array<REL::ID, 1> hkbRadialSelectorGenerator{ REL::ID(1340268) };
+		inline constexpr std::array<REL::ID, 1> hkbRagdollController{ REL::ID(216700) };
+		inline constexpr std::array<REL::ID, 1> hkbRagdollDriver{ REL::ID(817535) };
+		inline constexpr std::array<REL::ID, 1> hkbRagdollInterface{ REL::ID(1516402) };
+		inline constexpr std::array<REL::ID, 1> hkbRagdollSceneModifier{ REL::ID(250219) };
+		inline constexpr std::array<REL::ID, 1> hkbRaiseEventCommand{ REL::ID(1131391) };
+		inline constexpr std::array<REL::ID, 1> hkbRealEventPayload{ REL::ID(608353) };
+		inline constexpr std::array<REL::ID, 1> hkbRealVariableSequencedData{ REL::ID(1505217) };
+		inline constexpr std::array<REL::ID, 1> hkbRebuildScriptsCommand{ REL::ID(1383560) };
+		inline constexpr std::array<REL::ID, 1> hkbReferencePoseGenerator{ REL::ID(365540) };
+		inline constexpr std::array<REL::ID, 1> hkbReferencedGeneratorSyncInfo{ REL::ID(754300) };
+		inline constexpr std::array<REL::ID, 1> hkbRigidBodyRagdollControlsModifier{ REL::ID(1199836) };
+		inline constexpr std::array<REL::ID, 1> hkbRotateCharacterModifier{ REL::ID(1013028) };
+		inline constexpr std::array<REL::ID, 1> hkbRotateCharacterModifierInternalState{ REL::ID(1182909) };
+		inline constexpr std::array<REL::ID, 1> hkbSceneModifier{ REL::ID(372569) };
+		inline constexpr std::array<REL::ID, 1> hkbScriptAssetLoader{ REL::ID(671156) };
+		inline constexpr std::array<REL::ID, 1> hkbScriptCondition{ REL::ID(245008) };
+		inline constexpr std::array<REL::ID, 1> hkbScriptGenerator{ REL::ID(280883) };
+		inline constexpr std::array<REL::ID, 1> hkbSenseHandleModifier{ REL::ID(971780) };
+		inline constexpr std::array<REL::ID, 1> hkbSequence{ REL::ID(1010916) };
+		inline constexpr std::array<REL::ID, 1> hkbSequenceInternalState{ REL::ID(814160) };
+		inline constexpr std::array<REL::ID, 1> hkbSequenceStringData{ REL::ID(147375) };
+		inline constexpr std::array<REL::ID, 1> hkbSequencedData{ REL::ID(454312) };
+		inline constexpr std::array<REL::ID, 1> hkbSetBehaviorCommand{ REL::ID(772495) };
+		inline constexpr std::array<REL::ID, 1> hkbSetLocalTimeOfClipGeneratorCommand{ REL::ID(1257734) };
+		inline constexpr std::array<REL::ID, 1> hkbSetNodePropertyCommand{ REL::ID(286751) };
+		inline constexpr std::array<REL::ID, 1> hkbSetSelectedCharacterCommand{ REL::ID(646362) };
+		inline constexpr std::array<REL::ID, 1> hkbSetWordVariableCommand{ REL::ID(160926) };
+		inline constexpr std::array<REL::ID, 1> hkbSetWorldFromModelModifier{ REL::ID(1382932) };
+		inline constexpr std::array<REL::ID, 1> hkbSimulationControlCommand{ REL::ID(520069) };
+		inline constexpr std::array<REL::ID, 1> hkbSimulationStateInfo{ REL::ID(791596) };
+		inline constexpr std::array<REL::ID, 1> hkbSpatialQueryInterface{ REL::ID(1154050) };
+		inline constexpr std::array<REL::ID, 1> hkbStateChooserWrapper{ REL::ID(1200283) };
+		inline constexpr std::array<REL::ID, 1> hkbStateDependentModifier{ REL::ID(355819) };
+		inline constexpr std::array<REL::ID, 1> hkbStateListener{ REL::ID(800839) };
+		inline constexpr std::array<REL::ID, 1> hkbStateMachine{ REL::ID(1125318) };
+		inline constexpr std::array<REL::ID, 1> hkbStateMachineInternalState{ REL::ID(1100729) };
+		inline constexpr std::array<REL::ID, 1> hkbStateMachine__EventPropertyArray{ REL::ID(1437951) };
+		inline constexpr std::array<REL::ID, 1> hkbStateMachine__StateInfo{ REL::ID(952683) };
+		inline constexpr std::array<REL::ID, 1> hkbStateMachine__TransitionInfoArray{ REL::ID(341098) };
+		inline constexpr std::array<REL::ID, 1> hkbStringCondition{ REL::ID(561016) };
+		inline constexpr std::array<REL::ID, 1> hkbStringEventPayload{ REL::ID(1288131) };
+		inline constexpr std::array<REL::ID, 1> hkbSymbolIdMap{ REL::ID(154171) };
+		inline constexpr std::array<REL::ID, 1> hkbTestIdSelector{ REL::ID(818729) };
+		inline constexpr std::array<REL::ID, 1> hkbTimerModifier{ REL::ID(1196764) };
+		inline constexpr std::array<REL::ID, 1> hkbTimerModifierInternalState{ REL::ID(426174) };
+		inline constexpr std::array<REL::ID, 1> hkbTransformVectorModifier{ REL::ID(1009979) };
+		inline constexpr std::array<REL::ID, 1> hkbTransformVectorModifierInternalState{ REL::ID(88582) };
+		inline constexpr std::array<REL::ID, 1> hkbTransitionEffect{ REL::ID(928349) };
+		inline constexpr std::array<REL::ID, 1> hkbTwistModifier{ REL::ID(823710) };
+		inline constexpr std::array<REL::ID, 1> hkbVariableBindingSet{ REL::ID(796182) };
+		inline constexpr std::array<REL::ID, 1> hkbVariableValueSet{ REL::ID(961917) };
+		inline constexpr std::array<REL::ID, 1> hkbWorld{ REL::ID(638804) };
+		inline constexpr std::array<REL::ID, 1> hkbnpCharacterController{ REL::ID(770612) };
+		inline constexpr std::array<REL::ID, 1> hkbnpCharacterProxyController{ REL::ID(1327049) };
+		inline constexpr std::array<REL::ID, 1> hkbnpCharacterRigidBodyController{ REL::ID(90473) };
+		inline constexpr std::array<REL::ID, 2> hkbnpPhysicsInterface{ REL::ID(341300), REL::ID(1471345) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRagdollInterface{ REL::ID(1488961) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRagdollPoweredConstraintController{ REL::ID(1532954) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRagdollRigidBodyController{ REL::ID(1266898) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRagdollScaledSkeleton{ REL::ID(484996) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRagdollSkeletonRemapData{ REL::ID(970256) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRefCountedId_hkHandle_unsignedint_2147483647_hknpConstraintIdDiscriminant__{ REL::ID(925251) };
+		inline constexpr std::array<REL::ID, 1> hkbnpRefCountedId_hknpBodyId_{ REL::ID(1410512) };
+		inline constexpr std::array<REL::ID, 1> hkbnpSerializedRagdollInterface{ REL::ID(451859) };
+		inline constexpr std::array<REL::ID, 1> hkcdConvexCellsCollection{ REL::ID(681187) };
+		inline constexpr std::array<REL::ID, 1> hkcdConvexCellsTree2D{ REL::ID(552498) };
+		inline constexpr std::array<REL::ID, 1> hkcdConvexCellsTree3D{ REL::ID(660910) };
+		inline constexpr std::array<REL::ID, 1> hkcdConvexCellsTree_hkcdConvexCellsCollection__Cell_hkHandle_unsignedint_0_hkcdConvexCellsCollection__CellIdDiscriminant__hkcdConvexCellsCollection_{ REL::ID(926573) };
+		inline constexpr std::array<REL::ID, 1> hkcdConvexCellsTree_hkcdPlanarGeometryPolygonCollection__Polygon_hkHandle_unsignedint_0_hkcdPlanarGeometryPolygonCollection__PolygonIdDiscriminant__hkcdPlanarGeometry_{ REL::ID(818334) };
+		inline constexpr std::array<REL::ID, 1> hkcdDynamicAabbTree{ REL::ID(323722) };
+		inline constexpr std::array<REL::ID, 1> hkcdGskBase__RayCastShapeInterface_hkcdGsk_Vector4Shape_{ REL::ID(666871) };
+		inline constexpr std::array<REL::ID, 1> hkcdGskBase__ShapeInterface{ REL::ID(713723) };
+		inline constexpr std::array<REL::ID, 1> hkcdGsk_Vector4ShapeInterface{ REL::ID(1371137) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarCsgOperand{ REL::ID(195644) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarEntity{ REL::ID(533712) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarGeometry{ REL::ID(1437364) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarGeometryPlanesCollection{ REL::ID(46935) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarGeometryPolygonCollection{ REL::ID(378788) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarGeometryPrimitives__Collection_28_{ REL::ID(47302) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarGeometry__VertexStorage{ REL::ID(340536) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarSolid{ REL::ID(976422) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarSolid__ArrayMgr{ REL::ID(1166157) };
+		inline constexpr std::array<REL::ID, 1> hkcdPlanarSolid__NodeStorage{ REL::ID(1034236) };
+		inline constexpr std::array<REL::ID, 1> hkcdShape{ REL::ID(1009262) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTree{ REL::ID(1014343) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__EmptyRunnable{ REL::ID(133853) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__IRefit{ REL::ID(792229) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromAabbs16_{ REL::ID(166940) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromAabbs_{ REL::ID(871358) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromICustomRefit_{ REL::ID(339437) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__RefitT_hkcdSimdTreeUtils__Build__GetLeafAabbFromSpheres_{ REL::ID(1044185) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTreeUtils__Build__Task{ REL::ID(87312) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTree__BuildContext{ REL::ID(1520827) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTree__IParallelBuild__IRunnable{ REL::ID(1057914) };
+		inline constexpr std::array<REL::ID, 1> hkcdSimdTree__LeafCollector{ REL::ID(356180) };
+		inline constexpr std::array<REL::ID, 1> hkcdStaticAabbTree{ REL::ID(1187597) };
+		inline constexpr std::array<REL::ID, 1> hkcdStaticMeshTree_hkcdStaticMeshTreeCommonConfig_unsignedint_unsigned__int64_11_21__hknpCompressedMeshShapeTreeDataRun___BuildGeometryProvider_hknpCompressedMeshShapeInternals__GeometryProvider_{ REL::ID(328804) };
+		inline constexpr std::array<REL::ID, 1> hkcdStaticMeshTree_hkcdStaticMeshTreeCommonConfig_unsignedint_unsigned__int64_11_21__hknpCompressedMeshShapeTreeDataRun___CustomGeometryConverter{ REL::ID(1220336) };
+		inline constexpr std::array<REL::ID, 1> hkcdVertexGeometry{ REL::ID(713091) };
+		inline constexpr std::array<REL::ID, 1> hkcdVertexGeometry__VPolygonCollection{ REL::ID(1198187) };
+		inline constexpr std::array<REL::ID, 1> hkcdVertexGeometry__VPolygonCollectionBase{ REL::ID(101159) };
+		inline constexpr std::array<REL::ID, 1> hkgpAbstractMesh_hkgpConvexHullImpl__Edge_hkgpConvexHullImpl__Vertex_hkgpConvexHullImpl__Triangle_hkContainerHeapAllocator_{ REL::ID(71290) };
+		inline constexpr std::array<REL::ID, 1> hkgpAbstractMesh_hkgpIndexedMeshDefinitions__Edge_hkgpIndexedMeshDefinitions__Vertex_hkgpIndexedMeshDefinitions__Triangle_hkContainerHeapAllocator_{ REL::ID(1541165) };
+		inline constexpr std::array<REL::ID, 1> hkgpAbstractMesh_hkgpMeshBase__Edge_hkgpMeshBase__Vertex_hkgpMeshBase__Triangle_hkContainerHeapAllocator_{ REL::ID(68643) };
+		inline constexpr std::array<REL::ID, 1> hkgpAbstractMesh_hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0___Edge_hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0___Vertex_hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0___Triangle_hkContainerHeapAllocator_{ REL::ID(181150) };
+		inline constexpr std::array<REL::ID, 1> hkgpCgoInternal__ICollapse{ REL::ID(420159) };
+		inline constexpr std::array<REL::ID, 1> hkgpConvexHull{ REL::ID(556751) };
+		inline constexpr std::array<REL::ID, 1> hkgpIndexedMesh{ REL::ID(737720) };
+		inline constexpr std::array<REL::ID, 1> hkgpIndexedMeshInternals__DefaultEdgeCollapseInterface{ REL::ID(471184) };
+		inline constexpr std::array<REL::ID, 1> hkgpIndexedMesh__EdgeBarrier{ REL::ID(1344275) };
+		inline constexpr std::array<REL::ID, 1> hkgpIndexedMesh__IEdgeCollapse{ REL::ID(1003237) };
+		inline constexpr std::array<REL::ID, 1> hkgpIndexedMesh__ITriangleRemoval{ REL::ID(125952) };
+		inline constexpr std::array<REL::ID, 1> hkgpIndexedMesh__IVertexRemoval{ REL::ID(1050014) };
+		inline constexpr std::array<REL::ID, 1> hkgpJobQueue__Box_hkgpCgoInternal__UpdateJob_{ REL::ID(406455) };
+		inline constexpr std::array<REL::ID, 1> hkgpJobQueue__Box_hkgpMeshInternals__ConcaveEdgeJob__Handle_{ REL::ID(1110414) };
+		inline constexpr std::array<REL::ID, 1> hkgpJobQueue__IJob{ REL::ID(1105038) };
+		inline constexpr std::array<REL::ID, 1> hkgpMesh{ REL::ID(806399) };
+		inline constexpr std::array<REL::ID, 1> hkgpMesh__ExternShape{ REL::ID(1291554) };
+		inline constexpr std::array<REL::ID, 1> hkgpMesh__IConvexOverlap{ REL::ID(899471) };
+		inline constexpr std::array<REL::ID, 1> hkgpMesh__IConvexOverlap__IConvexShape{ REL::ID(1384639) };
+		inline constexpr std::array<REL::ID, 1> hkgpMesh__TriangleShape{ REL::ID(194993) };
+		inline constexpr std::array<REL::ID, 1> hkgpTriangulatorBase{ REL::ID(7644) };
+		inline constexpr std::array<REL::ID, 1> hkgpTriangulatorType_hkContainerHeapAllocator_hkgpTriangulatorBase__VertexBase_hkgpTriangulatorBase__TriangleBase_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkgpTriangulatorBase__SparseEdgeDataPolicy_hkgpTriangulatorBase__DefaultEdgeData_hkContainerHeapAllocator__hkContainerHeapAllocator__1_4_15_0_{ REL::ID(1497551) };
+		inline constexpr std::array<REL::ID, 1> hknpAction{ REL::ID(923691) };
+		inline constexpr std::array<REL::ID, 1> hknpActionManager{ REL::ID(1355728) };
+		inline constexpr std::array<REL::ID, 1> hknpAllHitsCollector{ REL::ID(416065) };
+		inline constexpr std::array<REL::ID, 1> hknpAnyHitCollector{ REL::ID(363868) };
+		inline constexpr std::array<REL::ID, 1> hknpApiCommandProcessor{ REL::ID(1567969) };
+		inline constexpr std::array<REL::ID, 1> hknpArrayAction{ REL::ID(520004) };
+		inline constexpr std::array<REL::ID, 1> hknpBSBroadPhaseConfig{ REL::ID(110737) };
+		inline constexpr std::array<REL::ID, 1> hknpBSCharacterProxy{ REL::ID(536876) };
+		inline constexpr std::array<REL::ID, 1> hknpBSCharacterRigidBody{ REL::ID(476189) };
+		inline constexpr std::array<REL::ID, 1> hknpBSCustomCollisionFilter{ REL::ID(1200668) };
+		inline constexpr std::array<REL::ID, 1> hknpBSMaterial{ REL::ID(429883) };
+		inline constexpr std::array<REL::ID, 1> hknpBSMaterialProperties{ REL::ID(668825) };
+		inline constexpr std::array<REL::ID, 1> hknpBSMouseSpringAction{ REL::ID(994081) };
+		inline constexpr std::array<REL::ID, 1> hknpBSMoveLimitModifier{ REL::ID(668832) };
+		inline constexpr std::array<REL::ID, 1> hknpBSShapeCodec{ REL::ID(641841) };
+		inline constexpr std::array<REL::ID, 1> hknpBSWorld{ REL::ID(841923) };
+		inline constexpr std::array<REL::ID, 1> hknpBackfaceCollisionModifier{ REL::ID(515454) };
+		inline constexpr std::array<REL::ID, 1> hknpBallGun{ REL::ID(1490941) };
+		inline constexpr std::array<REL::ID, 1> hknpBodyQualityLibrary{ REL::ID(1556172) };
+		inline constexpr std::array<REL::ID, 1> hknpBodyReference{ REL::ID(670810) };
+		inline constexpr std::array<REL::ID, 1> hknpBreakableConstraintData{ REL::ID(1257150) };
+		inline constexpr std::array<REL::ID, 1> hknpBroadPhase{ REL::ID(603751) };
+		inline constexpr std::array<REL::ID, 1> hknpBroadPhaseConfig{ REL::ID(1065197) };
+		inline constexpr std::array<REL::ID, 1> hknpBuildConstraintJacobiansTask{ REL::ID(375148) };
+		inline constexpr std::array<REL::ID, 1> hknpCapsuleShape{ REL::ID(1348320) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterContext{ REL::ID(692356) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterProxy{ REL::ID(224835) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterProxyCinfo{ REL::ID(1284611) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterProxyInternals__QueryCollector{ REL::ID(1541025) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterProxyListener{ REL::ID(448296) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterRigidBody{ REL::ID(383588) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterRigidBodyCinfo{ REL::ID(799431) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterRigidBodyListener{ REL::ID(352121) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterState{ REL::ID(589367) };
+		inline constexpr std::array<REL::ID, 1> hknpCharacterStateManager{ REL::ID(1543766) };
+		inline constexpr std::array<REL::ID, 1> hknpCircularSurfaceVelocity{ REL::ID(1171987) };
+		inline constexpr std::array<REL::ID, 1> hknpClosestHitCollector{ REL::ID(977037) };
+		inline constexpr std::array<REL::ID, 1> hknpClosestUniqueBodyIdHitCollector{ REL::ID(1581452) };
+		inline constexpr std::array<REL::ID, 1> hknpCollisionDetector{ REL::ID(1049437) };
+		inline constexpr std::array<REL::ID, 1> hknpCollisionFilter{ REL::ID(589287) };
+		inline constexpr std::array<REL::ID, 1> hknpCollisionQueryCollector{ REL::ID(804646) };
+		inline constexpr std::array<REL::ID, 1> hknpCompositeCollisionDetector{ REL::ID(783672) };
+		inline constexpr std::array<REL::ID, 1> hknpCompositeCompositeCollisionDetector{ REL::ID(1419212) };
+		inline constexpr std::array<REL::ID, 1> hknpCompositeShape{ REL::ID(1558772) };
+		inline constexpr std::array<REL::ID, 1> hknpCompoundShape{ REL::ID(152497) };
+		inline constexpr std::array<REL::ID, 1> hknpCompoundShapeInternalsKeyMask{ REL::ID(98693) };
+		inline constexpr std::array<REL::ID, 1> hknpCompoundShapeInternals_hknpDynamicCompoundShapeInternals___ScaleAndTransformCollector{ REL::ID(1269775) };
+		inline constexpr std::array<REL::ID, 1> hknpCompoundShapeInternals_hknpStaticCompoundShapeInternals___ScaleAndTransformCollector{ REL::ID(443956) };
+		inline constexpr std::array<REL::ID, 1> hknpCompoundShapeKeyMask{ REL::ID(192329) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedHeightFieldShape{ REL::ID(892138) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedMeshShape{ REL::ID(378366) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedMeshShapeCinfo{ REL::ID(789616) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedMeshShapeData{ REL::ID(309695) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedMeshShapeInternals__AabbOverlaps_hkArray_unsignedint_hkContainerHeapAllocator__{ REL::ID(1359703) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedMeshShapeInternals__AabbOverlaps_hknpCollisionQueryCollector_{ REL::ID(435552) };
+		inline constexpr std::array<REL::ID, 1> hknpCompressedMeshShapeInternals__KeyMask{ REL::ID(1406379) };
+		inline constexpr std::array<REL::ID, 1> hknpConstraintAtomSolver{ REL::ID(1485537) };
+		inline constexpr std::array<REL::ID, 1> hknpConstraintCollisionFilter{ REL::ID(785753) };
+		inline constexpr std::array<REL::ID, 1> hknpConstraintForceEventCreator{ REL::ID(1499309) };
+		inline constexpr std::array<REL::ID, 1> hknpConstraintForceExceededEventCreator{ REL::ID(262138) };
+		inline constexpr std::array<REL::ID, 1> hknpConstraintSolver{ REL::ID(1156453) };
+		inline constexpr std::array<REL::ID, 1> hknpContactConstraintSolver{ REL::ID(1329007) };
+		inline constexpr std::array<REL::ID, 1> hknpContactImpulseClippedEventCreator{ REL::ID(503673) };
+		inline constexpr std::array<REL::ID, 1> hknpContactImpulseEventCreator{ REL::ID(849143) };
+		inline constexpr std::array<REL::ID, 1> hknpConvexCompositeCollisionDetector{ REL::ID(1512937) };
+		inline constexpr std::array<REL::ID, 1> hknpConvexConvexCollisionDetector{ REL::ID(103202) };
+		inline constexpr std::array<REL::ID, 1> hknpConvexConvexShapeBaseInterface{ REL::ID(413196) };
+		inline constexpr std::array<REL::ID, 1> hknpConvexPolytopeShape{ REL::ID(657806) };
+		inline constexpr std::array<REL::ID, 1> hknpConvexShape{ REL::ID(1048504) };
+		inline constexpr std::array<REL::ID, 1> hknpDecoratorShape{ REL::ID(1059575) };
+		inline constexpr std::array<REL::ID, 1> hknpDefaultBroadPhaseConfig{ REL::ID(1238159) };
+		inline constexpr std::array<REL::ID, 1> hknpDefaultCompressedMeshShapeCinfo{ REL::ID(1400752) };
+		inline constexpr std::array<REL::ID, 1> hknpDefaultExternMeshShapeGeometry{ REL::ID(1398806) };
+		inline constexpr std::array<REL::ID, 1> hknpDefaultModifierSet{ REL::ID(388217) };
+		inline constexpr std::array<REL::ID, 1> hknpDestructionShapeProperties{ REL::ID(1100907) };
+		inline constexpr std::array<REL::ID, 1> hknpDisableCollisionFilter{ REL::ID(853245) };
+		inline constexpr std::array<REL::ID, 1> hknpDummyShape{ REL::ID(1523737) };
+		inline constexpr std::array<REL::ID, 1> hknpDynamicCompoundShape{ REL::ID(1282057) };
+		inline constexpr std::array<REL::ID, 1> hknpDynamicCompoundShapeData{ REL::ID(1456352) };
+		inline constexpr std::array<REL::ID, 1> hknpDynamicSpaceSplitter{ REL::ID(335341) };
+		inline constexpr std::array<REL::ID, 1> hknpEaseConstraintsAction{ REL::ID(1570460) };
+		inline constexpr std::array<REL::ID, 1> hknpEventDispatcher{ REL::ID(63921) };
+		inline constexpr std::array<REL::ID, 1> hknpEventMergeAndDispatcher{ REL::ID(236813) };
+		inline constexpr std::array<REL::ID, 1> hknpExternMeshShape{ REL::ID(1323071) };
+		inline constexpr std::array<REL::ID, 1> hknpExternMeshShapeBuildContext{ REL::ID(596675) };
+		inline constexpr std::array<REL::ID, 1> hknpExternMeshShapeData{ REL::ID(1254627) };
+		inline constexpr std::array<REL::ID, 1> hknpExternMeshShapeGeometry{ REL::ID(787794) };
+		inline constexpr std::array<REL::ID, 1> hknpFirstPersonGun{ REL::ID(958590) };
+		inline constexpr std::array<REL::ID, 1> hknpFixedClosestHitCollector{ REL::ID(1180834) };
+		inline constexpr std::array<REL::ID, 1> hknpFlippedGetClosestPointsQueryCollector{ REL::ID(229884) };
+		inline constexpr std::array<REL::ID, 1> hknpFlippedShapeCastQueryCollector{ REL::ID(536950) };
+		inline constexpr std::array<REL::ID, 1> hknpGlobals{ REL::ID(1316237) };
+		inline constexpr std::array<REL::ID, 1> hknpGridSpaceSplitter{ REL::ID(1039985) };
+		inline constexpr std::array<REL::ID, 1> hknpGroupCollisionFilter{ REL::ID(673407) };
+		inline constexpr std::array<REL::ID, 1> hknpGroupCollisionFilterBase_hknpGroupCollisionFilterTypes__Config_5_5_5_16__{ REL::ID(61576) };
+		inline constexpr std::array<REL::ID, 1> hknpGunProjectile{ REL::ID(412665) };
+		inline constexpr std::array<REL::ID, 1> hknpHBPFinishUpdateTask{ REL::ID(997148) };
+		inline constexpr std::array<REL::ID, 1> hknpHBPTreeVsTreeTask{ REL::ID(652059) };
+		inline constexpr std::array<REL::ID, 1> hknpHBPUpdateDirtyBodiesTask{ REL::ID(1277158) };
+		inline constexpr std::array<REL::ID, 1> hknpHBPUpdateTreeTask{ REL::ID(1183942) };
+		inline constexpr std::array<REL::ID, 1> hknpHeightFieldShape{ REL::ID(905854) };
+		inline constexpr std::array<REL::ID, 1> hknpHybridBroadPhase{ REL::ID(1387702) };
+		inline constexpr std::array<REL::ID, 1> hknpInternalCommandProcessor{ REL::ID(1521291) };
+		inline constexpr std::array<REL::ID, 1> hknpLinearSurfaceVelocity{ REL::ID(917897) };
+		inline constexpr std::array<REL::ID, 1> hknpLodShape{ REL::ID(1526011) };
+		inline constexpr std::array<REL::ID, 1> hknpMalleableConstraintData{ REL::ID(634760) };
+		inline constexpr std::array<REL::ID, 1> hknpManifoldEventCreator{ REL::ID(994204) };
+		inline constexpr std::array<REL::ID, 1> hknpMaskedShape{ REL::ID(350726) };
+		inline constexpr std::array<REL::ID, 1> hknpMaskedShape__MaskWrapper{ REL::ID(397398) };
+		inline constexpr std::array<REL::ID, 1> hknpMassChangerModifier{ REL::ID(1194754) };
+		inline constexpr std::array<REL::ID, 1> hknpMaterialLibrary{ REL::ID(1285619) };
+		inline constexpr std::array<REL::ID, 1> hknpMaterialPalette{ REL::ID(1549055) };
+		inline constexpr std::array<REL::ID, 1> hknpModifier{ REL::ID(353648) };
+		inline constexpr std::array<REL::ID, 1> hknpMotionPropertiesLibrary{ REL::ID(1166042) };
+		inline constexpr std::array<REL::ID, 1> hknpMotionWeldingModifier{ REL::ID(854540) };
+		inline constexpr std::array<REL::ID, 1> hknpMultithreadedSimulation{ REL::ID(461111) };
+		inline constexpr std::array<REL::ID, 1> hknpMxContactSolver{ REL::ID(75737) };
+		inline constexpr std::array<REL::ID, 1> hknpNarrowPhaseTask{ REL::ID(288538) };
+		inline constexpr std::array<REL::ID, 1> hknpNeighborWeldingModifier{ REL::ID(196651) };
+		inline constexpr std::array<REL::ID, 1> hknpNullShapeTagCodec{ REL::ID(612875) };
+		inline constexpr std::array<REL::ID, 1> hknpPairCollisionFilter{ REL::ID(1069101) };
+		inline constexpr std::array<REL::ID, 1> hknpPhysicsSceneData{ REL::ID(447788) };
+		inline constexpr std::array<REL::ID, 1> hknpPhysicsSystem{ REL::ID(288776) };
+		inline constexpr std::array<REL::ID, 1> hknpPhysicsSystemData{ REL::ID(490308) };
+		inline constexpr std::array<REL::ID, 1> hknpPostCollideTask{ REL::ID(1457724) };
+		inline constexpr std::array<REL::ID, 1> hknpPostSolveTask{ REL::ID(486817) };
+		inline constexpr std::array<REL::ID, 1> hknpPrepare2ndRoundNarrowPhaseTask{ REL::ID(216290) };
+		inline constexpr std::array<REL::ID, 1> hknpPrepareConstraintsTask{ REL::ID(202570) };
+		inline constexpr std::array<REL::ID, 1> hknpPrepareNarrowPhaseTask{ REL::ID(1373181) };
+		inline constexpr std::array<REL::ID, 1> hknpProjectileGun{ REL::ID(585833) };
+		inline constexpr std::array<REL::ID, 1> hknpRagdoll{ REL::ID(160377) };
+		inline constexpr std::array<REL::ID, 1> hknpRagdollController{ REL::ID(276685) };
+		inline constexpr std::array<REL::ID, 1> hknpRagdollData{ REL::ID(426068) };
+		inline constexpr std::array<REL::ID, 1> hknpRagdollKeyFrameHierarchyController{ REL::ID(10114) };
+		inline constexpr std::array<REL::ID, 1> hknpRagdollMotorController{ REL::ID(542885) };
+		inline constexpr std::array<REL::ID, 1> hknpRefMaterial{ REL::ID(189017) };
+		inline constexpr std::array<REL::ID, 1> hknpRefWorldCinfo{ REL::ID(994590) };
+		inline constexpr std::array<REL::ID, 1> hknpRestitutionModifier{ REL::ID(303321) };
+		inline constexpr std::array<REL::ID, 1> hknpSafeEaseConstraintsAction{ REL::ID(722623) };
+		inline constexpr std::array<REL::ID, 1> hknpScaledConvexShape{ REL::ID(1273047) };
+		inline constexpr std::array<REL::ID, 1> hknpScaledConvexShapeBase{ REL::ID(582184) };
+		inline constexpr std::array<REL::ID, 1> hknpSetShapeKeyACdDetector{ REL::ID(956234) };
+		inline constexpr std::array<REL::ID, 1> hknpShape{ REL::ID(357353) };
+		inline constexpr std::array<REL::ID, 1> hknpShapeKeyArrayCacheCdDetector{ REL::ID(470588) };
+		inline constexpr std::array<REL::ID, 1> hknpShapeKeyMask{ REL::ID(18805) };
+		inline constexpr std::array<REL::ID, 1> hknpShapeMassProperties{ REL::ID(695218) };
+		inline constexpr std::array<REL::ID, 1> hknpShapeTagCodec{ REL::ID(659682) };
+		inline constexpr std::array<REL::ID, 1> hknpSignedDistanceFieldCollisionDetector{ REL::ID(9378) };
+		inline constexpr std::array<REL::ID, 1> hknpSimulation{ REL::ID(1474739) };
+		inline constexpr std::array<REL::ID, 1> hknpSingleCellSpaceSplitter{ REL::ID(162715) };
+		inline constexpr std::array<REL::ID, 1> hknpSingleThreadedSimulation{ REL::ID(988791) };
+		inline constexpr std::array<REL::ID, 1> hknpSingleThreadedSolverData{ REL::ID(981101) };
+		inline constexpr std::array<REL::ID, 1> hknpSoftContactModifier{ REL::ID(649099) };
+		inline constexpr std::array<REL::ID, 1> hknpSolverData{ REL::ID(1027768) };
+		inline constexpr std::array<REL::ID, 1> hknpSolverSchedulerTask{ REL::ID(1246713) };
+		inline constexpr std::array<REL::ID, 1> hknpSolverTask{ REL::ID(1052387) };
+		inline constexpr std::array<REL::ID, 1> hknpSpaceSplitter{ REL::ID(867136) };
+		inline constexpr std::array<REL::ID, 1> hknpSphereShape{ REL::ID(157397) };
+		inline constexpr std::array<REL::ID, 1> hknpStaticCompoundShape{ REL::ID(1069298) };
+		inline constexpr std::array<REL::ID, 1> hknpStaticCompoundShapeData{ REL::ID(364635) };
+		inline constexpr std::array<REL::ID, 1> hknpStaticCompoundShapeInternals{ REL::ID(286402) };
+		inline constexpr std::array<REL::ID, 1> hknpStaticCompoundShapeKeyMask{ REL::ID(271607) };
+		inline constexpr std::array<REL::ID, 1> hknpStreamContactSolver{ REL::ID(1377929) };
+		inline constexpr std::array<REL::ID, 1> hknpStreamContactSolverBase{ REL::ID(1298601) };
+		inline constexpr std::array<REL::ID, 1> hknpSurfaceVelocity{ REL::ID(1184011) };
+		inline constexpr std::array<REL::ID, 1> hknpSurfaceVelocityModifier{ REL::ID(579329) };
+		inline constexpr std::array<REL::ID, 1> hknpTriangleShape{ REL::ID(620130) };
+		inline constexpr std::array<REL::ID, 1> hknpTriangleWeldingModifier{ REL::ID(1120439) };
+		inline constexpr std::array<REL::ID, 1> hknpTriggerCollisionDetector{ REL::ID(182848) };
+		inline constexpr std::array<REL::ID, 1> hknpTriggerModifier{ REL::ID(1540307) };
+		inline constexpr std::array<REL::ID, 1> hknpTyremarksInfo{ REL::ID(1570649) };
+		inline constexpr std::array<REL::ID, 1> hknpTyremarksWheel{ REL::ID(473380) };
+		inline constexpr std::array<REL::ID, 1> hknpUnaryAction{ REL::ID(391722) };
+		inline constexpr std::array<REL::ID, 1> hknpUniqueBodyIdHitCollector{ REL::ID(191571) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleAerodynamics{ REL::ID(3591) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleBrake{ REL::ID(1344769) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleData{ REL::ID(377218) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultAerodynamics{ REL::ID(1539979) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultAnalogDriverInput{ REL::ID(9035) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultBrake{ REL::ID(1078910) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultEngine{ REL::ID(1037551) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultSteering{ REL::ID(1415842) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultSuspension{ REL::ID(1390642) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultTransmission{ REL::ID(784970) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDefaultVelocityDamper{ REL::ID(678108) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDriverInput{ REL::ID(322167) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDriverInputAnalogStatus{ REL::ID(56132) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleDriverInputStatus{ REL::ID(588439) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleEngine{ REL::ID(1303581) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleInstance{ REL::ID(21479) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleLinearCastWheelCollide{ REL::ID(512657) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleRayCastWheelCollide{ REL::ID(937591) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleSteering{ REL::ID(99825) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleSuspension{ REL::ID(74681) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleTransmission{ REL::ID(831396) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleVelocityDamper{ REL::ID(943706) };
+		inline constexpr std::array<REL::ID, 1> hknpVehicleWheelCollide{ REL::ID(1044595) };
+		inline constexpr std::array<REL::ID, 1> hknpWeldingModifier{ REL::ID(969813) };
+		inline constexpr std::array<REL::ID, 1> hknpWorld{ REL::ID(45661) };
+		inline constexpr std::array<REL::ID, 1> hknpWorldSnapshot{ REL::ID(1220930) };
+		inline constexpr std::array<REL::ID, 1> hkpBallAndSocketConstraintData{ REL::ID(1388595) };
+		inline constexpr std::array<REL::ID, 1> hkpCallbackConstraintMotor{ REL::ID(1231360) };
+		inline constexpr std::array<REL::ID, 1> hkpCogWheelConstraintData{ REL::ID(1480816) };
+		inline constexpr std::array<REL::ID, 1> hkpConstraintData{ REL::ID(583328) };
+		inline constexpr std::array<REL::ID, 1> hkpConstraintMotor{ REL::ID(649195) };
+		inline constexpr std::array<REL::ID, 1> hkpDeformableFixedConstraintData{ REL::ID(434555) };
+		inline constexpr std::array<REL::ID, 1> hkpFixedConstraintData{ REL::ID(196591) };
+		inline constexpr std::array<REL::ID, 1> hkpHingeConstraintData{ REL::ID(283484) };
+		inline constexpr std::array<REL::ID, 1> hkpHingeLimitsData{ REL::ID(911868) };
+		inline constexpr std::array<REL::ID, 1> hkpLimitedForceConstraintMotor{ REL::ID(382924) };
+		inline constexpr std::array<REL::ID, 1> hkpLimitedHingeConstraintData{ REL::ID(1540231) };
+		inline constexpr std::array<REL::ID, 1> hkpLinearClearanceConstraintData{ REL::ID(207256) };
+		inline constexpr std::array<REL::ID, 1> hkpLinearParametricCurve{ REL::ID(1103033) };
+		inline constexpr std::array<REL::ID, 1> hkpParametricCurve{ REL::ID(757798) };
+		inline constexpr std::array<REL::ID, 1> hkpPointToPathConstraintData{ REL::ID(1476289) };
+		inline constexpr std::array<REL::ID, 1> hkpPointToPlaneConstraintData{ REL::ID(998793) };
+		inline constexpr std::array<REL::ID, 1> hkpPositionConstraintMotor{ REL::ID(116961) };
+		inline constexpr std::array<REL::ID, 1> hkpPrismaticConstraintData{ REL::ID(522052) };
+		inline constexpr std::array<REL::ID, 1> hkpPulleyConstraintData{ REL::ID(1237630) };
+		inline constexpr std::array<REL::ID, 1> hkpRackAndPinionConstraintData{ REL::ID(337160) };
+		inline constexpr std::array<REL::ID, 1> hkpRagdollConstraintData{ REL::ID(760737) };
+		inline constexpr std::array<REL::ID, 1> hkpRagdollLimitsData{ REL::ID(673618) };
+		inline constexpr std::array<REL::ID, 1> hkpRotationalConstraintData{ REL::ID(693760) };
+		inline constexpr std::array<REL::ID, 1> hkpSpringDamperConstraintMotor{ REL::ID(950689) };
+		inline constexpr std::array<REL::ID, 1> hkpStiffSpringConstraintData{ REL::ID(1150192) };
+		inline constexpr std::array<REL::ID, 1> hkpVehicleFrictionDescription{ REL::ID(1545611) };
+		inline constexpr std::array<REL::ID, 1> hkpVelocityConstraintMotor{ REL::ID(1129562) };
+		inline constexpr std::array<REL::ID, 1> hkpWheelConstraintData{ REL::ID(44883) };
+		inline constexpr std::array<REL::ID, 1> hkpWheelFrictionConstraintData{ REL::ID(767011) };
+		inline constexpr std::array<REL::ID, 1> hkpWrappedConstraintData{ REL::ID(922160) };
+		inline constexpr std::array<REL::ID, 1> hkxAnimatedFloat{ REL::ID(596018) };
+		inline constexpr std::array<REL::ID, 1> hkxAnimatedMatrix{ REL::ID(628906) };
+		inline constexpr std::array<REL::ID, 1> hkxAnimatedQuaternion{ REL::ID(455666) };
+		inline constexpr std::array<REL::ID, 1> hkxAnimatedVector{ REL::ID(768737) };
+		inline constexpr std::array<REL::ID, 1> hkxAttributeHolder{ REL::ID(921654) };
+		inline constexpr std::array<REL::ID, 1> hkxEnum{ REL::ID(390099) };
+		inline constexpr std::array<REL::ID, 1> hkxIndexBuffer{ REL::ID(1316316) };
+		inline constexpr std::array<REL::ID, 1> hkxMaterial{ REL::ID(1272162) };
+		inline constexpr std::array<REL::ID, 1> hkxMesh{ REL::ID(837846) };
+		inline constexpr std::array<REL::ID, 1> hkxMeshSection{ REL::ID(884389) };
+		inline constexpr std::array<REL::ID, 1> hkxMesh__UserChannelInfo{ REL::ID(436111) };
+		inline constexpr std::array<REL::ID, 1> hkxSparselyAnimatedBool{ REL::ID(935900) };
+		inline constexpr std::array<REL::ID, 1> hkxSparselyAnimatedEnum{ REL::ID(1487351) };
+		inline constexpr std::array<REL::ID, 1> hkxSparselyAnimatedInt{ REL::ID(576783) };
+		inline constexpr std::array<REL::ID, 1> hkxSparselyAnimatedString{ REL::ID(203836) };
+		inline constexpr std::array<REL::ID, 1> hkxVertexAnimation{ REL::ID(21147) };
+		inline constexpr std::array<REL::ID, 1> hkxVertexBuffer{ REL::ID(1295075) };
+	}
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 2> IAITarget{ REL::ID(1506318), REL::ID(1412508) };
+		inline constexpr std::array<REL::ID, 1> IAIWorldLocation{ REL::ID(1082533) };
+		inline constexpr std::array<REL::ID, 1> IAIWorldLocationHandle{ REL::ID(987494) };
+		inline constexpr std::array<REL::ID, 1> IAnimationClipLoaderSingleton{ REL::ID(645618) };
+		inline constexpr std::array<REL::ID, 1> IAnimationEventDataForEachFunctor{ REL::ID(332135) };
+		inline constexpr std::array<REL::ID, 1> IAnimationGraphManagerHolder{ REL::ID(991808) };
+		inline constexpr std::array<REL::ID, 2> IAnimationGraphManagerLoadingTask{ REL::ID(805802), REL::ID(1543300) };
+		inline constexpr std::array<REL::ID, 1> IAnimationStanceData{ REL::ID(398424) };
+		inline constexpr std::array<REL::ID, 1> IAnimationStreamRead{ REL::ID(540572) };
+		inline constexpr std::array<REL::ID, 1> IAnimationStreamWrite{ REL::ID(1324423) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_AnimationSpeedContour_{ REL::ID(1138435) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BGSSoundDescriptor_{ REL::ID(1249852) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSAnimationDBData_{ REL::ID(1494602) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSAudio_{ REL::ID(786489) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSIAudioEffectParameters_{ REL::ID(383326) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSIMusicTrack_{ REL::ID(505627) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSPathingCell_{ REL::ID(507873) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSPathingDoor_{ REL::ID(88336) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSPathingLockData_{ REL::ID(359505) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSPathingRequest_{ REL::ID(307768) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BSPathingSolution_{ REL::ID(1231629) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_BShkNonTransformController_{ REL::ID(571099) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_CombatObjectBase_{ REL::ID(1433894) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IAIWorldLocation_{ REL::ID(846392) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IAnimationStanceData_{ REL::ID(1308789) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IHandlerFunctor_Actor_BSFixedString__{ REL::ID(569617) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IMovementParameters_{ REL::ID(1118660) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IPackageData_{ REL::ID(271675) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IProcedureTreeExecState_{ REL::ID(226703) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IProcedureTreeItem_{ REL::ID(693147) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_IProcedure_{ REL::ID(582922) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_InitActionI_{ REL::ID(685654) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_MovementAgent_{ REL::ID(552593) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_MovementArbiter_{ REL::ID(76632) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_MovementMessage_{ REL::ID(1263372) };
+		inline constexpr std::array<REL::ID, 1> IBSTCreator_RefrInteraction_{ REL::ID(601488) };
+		inline constexpr std::array<REL::ID, 1> IBehaviorGraphSwapSingleton{ REL::ID(1204438) };
+		inline constexpr std::array<REL::ID, 1> IBehaviorGraphSymbolSwapSingleton{ REL::ID(499384) };
+		inline constexpr std::array<REL::ID, 1> ICheckEndReachedFunctor{ REL::ID(47028) };
+		inline constexpr std::array<REL::ID, 1> ICheckEndReachedFunctorMapper{ REL::ID(1122964) };
+		inline constexpr std::array<REL::ID, 1> IConvexOverlapImpl{ REL::ID(87727) };
+		inline constexpr std::array<REL::ID, 1> IConvexOverlapImpl__ShapeInterface{ REL::ID(1011633) };
+		inline constexpr std::array<REL::ID, 1> IDDQueueCollection{ REL::ID(31533) };
+		inline constexpr std::array<REL::ID, 1> IDEvent{ REL::ID(195715) };
+		inline constexpr std::array<REL::ID, 1> IDebugText{ REL::ID(410518) };
+		inline constexpr std::array<REL::ID, 1> IExplosionFactory{ REL::ID(542729) };
+		inline constexpr std::array<REL::ID, 1> IFadeDoneCallback{ REL::ID(1521411) };
+		inline constexpr std::array<REL::ID, 1> IForEachDynamicIdleInDir{ REL::ID(1574455) };
+		inline constexpr std::array<REL::ID, 1> IFormFactory{ REL::ID(136509) };
+		inline constexpr std::array<REL::ID, 1> IFormFactory__IFactoryVisitor{ REL::ID(1085768) };
+		inline constexpr std::array<REL::ID, 1> IGCQueue{ REL::ID(1441365) };
+		inline constexpr std::array<REL::ID, 1> IGamebryoSequenceGeneratorHolderSingleton{ REL::ID(967551) };
+		inline constexpr std::array<REL::ID, 1> IHandlerFunctor_Actor_BSFixedString_{ REL::ID(76462) };
+		inline constexpr std::array<REL::ID, 1> IKeywordFormBase{ REL::ID(1253953) };
+		inline constexpr std::array<REL::ID, 1> IMemoryHeap{ REL::ID(1216172) };
+		inline constexpr std::array<REL::ID, 1> IMemoryManagerFile{ REL::ID(16277) };
+		inline constexpr std::array<REL::ID, 1> IMemoryManagerFileFactory{ REL::ID(1332823) };
+		inline constexpr std::array<REL::ID, 1> IMemoryStore{ REL::ID(217723) };
+		inline constexpr std::array<REL::ID, 1> IMemoryStoreBase{ REL::ID(483627) };
+		inline constexpr std::array<REL::ID, 2> IMenu{ REL::ID(1345832), REL::ID(986550) };
+		inline constexpr std::array<REL::ID, 1> IMessageBoxCallback{ REL::ID(896045) };
+		inline constexpr std::array<REL::ID, 1> IMovementAgentDataTracker_IMovementHandlerAgent_MovementHandlerOutputDataSmallDelta_{ REL::ID(1033484) };
+		inline constexpr std::array<REL::ID, 1> IMovementAgentDataTracker_IMovementHandlerAgent_MovementHandlerUpdateDataSmallDelta_{ REL::ID(1299535) };
+		inline constexpr std::array<REL::ID, 1> IMovementAgentDataTracker_IMovementPathManagerAgent_MovementPathManagerAgentReturnData__AGENT_RESULT_{ REL::ID(188508) };
+		inline constexpr std::array<REL::ID, 1> IMovementAgentDataTracker_IMovementPlannerAgent_MovementPlannerAgentReturnDataSmallDelta_{ REL::ID(1176073) };
+		inline constexpr std::array<REL::ID, 1> IMovementAgentDataTracker_IMovementTweenerAgent_MovementTweenerAgentOutputData_{ REL::ID(956444) };
+		inline constexpr std::array<REL::ID, 1> IMovementAvoidanceManager{ REL::ID(1030697) };
+		inline constexpr std::array<REL::ID, 1> IMovementControllerDataTracker{ REL::ID(879837) };
+		inline constexpr std::array<REL::ID, 1> IMovementControllerNPCFunctor{ REL::ID(654464) };
+		inline constexpr std::array<REL::ID, 1> IMovementControllerRegisterInterface{ REL::ID(15700) };
+		inline constexpr std::array<REL::ID, 1> IMovementDeltaStore{ REL::ID(978660) };
+		inline constexpr std::array<REL::ID, 1> IMovementDirectControl{ REL::ID(830646) };
+		inline constexpr std::array<REL::ID, 1> IMovementFormIDManager{ REL::ID(118078) };
+		inline constexpr std::array<REL::ID, 1> IMovementHandlerAgent{ REL::ID(482400) };
+		inline constexpr std::array<REL::ID, 1> IMovementInterface{ REL::ID(916901) };
+		inline constexpr std::array<REL::ID, 1> IMovementMessageInterface{ REL::ID(1315894) };
+		inline constexpr std::array<REL::ID, 1> IMovementMotionDrivenControl{ REL::ID(644300) };
+		inline constexpr std::array<REL::ID, 1> IMovementParameters{ REL::ID(1136103) };
+		inline constexpr std::array<REL::ID, 1> IMovementPathManagerAgent{ REL::ID(56703) };
+		inline constexpr std::array<REL::ID, 1> IMovementPathManagerDataTracker{ REL::ID(846324) };
+		inline constexpr std::array<REL::ID, 1> IMovementPlannerAgent{ REL::ID(1402723) };
+		inline constexpr std::array<REL::ID, 1> IMovementPlannerDirectControl{ REL::ID(1442069) };
+		inline constexpr std::array<REL::ID, 1> IMovementPlannerSetArbitration{ REL::ID(1123899) };
+		inline constexpr std::array<REL::ID, 1> IMovementPlayIdleResult{ REL::ID(21100) };
+		inline constexpr std::array<REL::ID, 1> IMovementPlayerControls{ REL::ID(1377741) };
+		inline constexpr std::array<REL::ID, 1> IMovementPlayerControlsFilter{ REL::ID(98085) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryActorAvoidance{ REL::ID(753655) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryAnimDeltas{ REL::ID(1475261) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryDeltas{ REL::ID(1244933) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryDesiredDeltas{ REL::ID(1355464) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryFlight{ REL::ID(1540734) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryPathFollowing{ REL::ID(212862) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryPathFollowing__INodeVisitor{ REL::ID(917416) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryPathingState{ REL::ID(920424) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryState{ REL::ID(857405) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryStaticAvoider{ REL::ID(1311141) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryTweener{ REL::ID(1562843) };
+		inline constexpr std::array<REL::ID, 1> IMovementQueryTweenerState{ REL::ID(643979) };
+		inline constexpr std::array<REL::ID, 1> IMovementSelectIdle{ REL::ID(32232) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetCorrectionData{ REL::ID(1568187) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetGoal{ REL::ID(748016) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetPathFollowing{ REL::ID(464661) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetPlayerControls{ REL::ID(870156) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetSprinting{ REL::ID(534228) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetState{ REL::ID(566757) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetStaticAvoider{ REL::ID(433438) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetTweener{ REL::ID(153228) };
+		inline constexpr std::array<REL::ID, 1> IMovementSetWarp{ REL::ID(251349) };
+		inline constexpr std::array<REL::ID, 1> IMovementState{ REL::ID(685244) };
+		inline constexpr std::array<REL::ID, 1> IMovementTweenerAgent{ REL::ID(39275) };
+		inline constexpr std::array<REL::ID, 1> IMultiActivateUser{ REL::ID(210249) };
+		inline constexpr std::array<REL::ID, 1> INIPrefSettingCollection{ REL::ID(1304842) };
+		inline constexpr std::array<REL::ID, 1> INISettingCollection{ REL::ID(897757) };
+		inline constexpr std::array<REL::ID, 1> INavmeshSearchFilterSet{ REL::ID(1199723) };
+		inline constexpr std::array<REL::ID, 1> IOManager{ REL::ID(196152) };
+		inline constexpr std::array<REL::ID, 1> IOManagerThread{ REL::ID(760960) };
+		inline constexpr std::array<REL::ID, 1> IOSystemTask{ REL::ID(102662) };
+		inline constexpr std::array<REL::ID, 1> IOTask{ REL::ID(853996) };
+		inline constexpr std::array<REL::ID, 1> IPackageData{ REL::ID(1080925) };
+		inline constexpr std::array<REL::ID, 2> IPackageDataAIWorldLocationHandle{ REL::ID(502323), REL::ID(16503) };
+		inline constexpr std::array<REL::ID, 1> IPackageDataTypeCheck{ REL::ID(1169767) };
+		inline constexpr std::array<REL::ID, 1> IPathBuilder{ REL::ID(1106238) };
+		inline constexpr std::array<REL::ID, 1> IPathBuilderFactoryBase{ REL::ID(1232038) };
+		inline constexpr std::array<REL::ID, 1> IPathBuilderTracker{ REL::ID(1442486) };
+		inline constexpr std::array<REL::ID, 1> IPathFollowerAction{ REL::ID(305903) };
+		inline constexpr std::array<REL::ID, 1> IPathFollowerState{ REL::ID(532725) };
+		inline constexpr std::array<REL::ID, 1> IPathSmootherRayCast{ REL::ID(1259104) };
+		inline constexpr std::array<REL::ID, 1> IPathingNodeGenerator{ REL::ID(1199266) };
+		inline constexpr std::array<REL::ID, 1> IPipboyThrottledValue{ REL::ID(1026098) };
+		inline constexpr std::array<REL::ID, 1> IPipelineStageInterface{ REL::ID(1183038) };
+		inline constexpr std::array<REL::ID, 1> IPostAnimationChannelUpdateFunctor{ REL::ID(671437) };
+		inline constexpr std::array<REL::ID, 1> IProcedure{ REL::ID(1010619) };
+		inline constexpr std::array<REL::ID, 1> IProcedureTreeExecState{ REL::ID(558429) };
+		inline constexpr std::array<REL::ID, 1> IProcedureTreeItem{ REL::ID(460027) };
+		inline constexpr std::array<REL::ID, 1> IProcedureTreeVisitor{ REL::ID(650080) };
+		inline constexpr std::array<REL::ID, 1> IPromptMenuRequest{ REL::ID(1052620) };
+		inline constexpr std::array<REL::ID, 1> IRaceSubGraphDataFunctor{ REL::ID(629092) };
+		inline constexpr std::array<REL::ID, 1> IRendererResourceManager{ REL::ID(1259352) };
+		inline constexpr std::array<REL::ID, 1> ISelectIdleFilter{ REL::ID(1118358) };
+		inline constexpr std::array<REL::ID, 1> ISmoothingRayValidator{ REL::ID(148874) };
+		inline constexpr std::array<REL::ID, 1> IStateMachineCallbackSingleton{ REL::ID(1042125) };
+		inline constexpr std::array<REL::ID, 1> IStaticAvoidNodeManager{ REL::ID(368231) };
+		inline constexpr std::array<REL::ID, 1> IStringForwarder{ REL::ID(690643) };
+		inline constexpr std::array<REL::ID, 1> ISynchronizedAnimationSingleton{ REL::ID(375236) };
+		inline constexpr std::array<REL::ID, 1> ITempEffectFactory{ REL::ID(390968) };
+		inline constexpr std::array<REL::ID, 1> ITextureDB{ REL::ID(1002135) };
+		inline constexpr std::array<REL::ID, 1> ITrianglePathSplitter{ REL::ID(1445514) };
+		inline constexpr std::array<REL::ID, 1> ITweenerNodeFollowerSetup{ REL::ID(1260348) };
+		inline constexpr std::array<REL::ID, 1> IUIMessageData{ REL::ID(279203) };
+		inline constexpr std::array<REL::ID, 1> IValidateGoalFunctor{ REL::ID(159063) };
+		inline constexpr std::array<REL::ID, 1> IVisitProcedures{ REL::ID(328422) };
+		inline constexpr std::array<REL::ID, 1> IdleDialogueEnterHandler{ REL::ID(1030230) };
+		inline constexpr std::array<REL::ID, 1> IdleDialogueExitHandler{ REL::ID(106297) };
+		inline constexpr std::array<REL::ID, 1> IdleFlavorHandler{ REL::ID(1521345) };
+		inline constexpr std::array<REL::ID, 1> IiStateTaggingListenerSingleton{ REL::ID(425182) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffect{ REL::ID(1480352) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectAmbientOcclusion{ REL::ID(1582246) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectBlur{ REL::ID(160638) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectBlurCS{ REL::ID(575068) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectBokehDepthOfField{ REL::ID(795043) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectDepthOfField{ REL::ID(150071) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectDepthOfFieldSplitScreen{ REL::ID(668421) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectFullScreenBlur{ REL::ID(944662) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectFullScreenColor{ REL::ID(769111) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectGetHit{ REL::ID(1463112) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectHDR{ REL::ID(358937) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectHDRCS{ REL::ID(1358946) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectHUDGlass{ REL::ID(1518400) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectMap{ REL::ID(1266025) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectModMenu{ REL::ID(42572) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectMotionBlur{ REL::ID(1181622) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectNoise{ REL::ID(1172706) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectOption{ REL::ID(888071) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectParam{ REL::ID(231455) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectPipboyScreen{ REL::ID(972075) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectRadialBlur{ REL::ID(1369445) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectRainSplash{ REL::ID(885043) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectRefraction{ REL::ID(1386511) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectScalableAmbientObscurance{ REL::ID(383479) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectScalableAmbientObscuranceCS{ REL::ID(691168) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectSunbeams{ REL::ID(1274881) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectTemporalAA{ REL::ID(1340364) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectUpsampleDynamicResolution{ REL::ID(1317843) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectVLS{ REL::ID(1410965) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectVLSLight{ REL::ID(1504798) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectVatsTarget{ REL::ID(886442) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceEffectWaterDisplacement{ REL::ID(840779) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceModifierInstance{ REL::ID(625929) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceModifierInstanceDOF{ REL::ID(836767) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceModifierInstanceForm{ REL::ID(1223703) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceModifierInstanceRB{ REL::ID(1434236) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceModifierInstanceTemp{ REL::ID(238988) };
+		inline constexpr std::array<REL::ID, 1> ImageSpaceShaderParam{ REL::ID(842911) };
+		inline constexpr std::array<REL::ID, 1> ImmunityEffect{ REL::ID(69607) };
+		inline constexpr std::array<REL::ID, 1> IndividualClipAnimationSpeedContour{ REL::ID(55274) };
+		inline constexpr std::array<REL::ID, 11> IngredientItem{ REL::ID(749943), REL::ID(83204), REL::ID(695013), REL::ID(1086739), REL::ID(601522), REL::ID(69485), REL::ID(1119542), REL::ID(1292357), REL::ID(321577), REL::ID(494230), REL::ID(667354) };
+		inline constexpr std::array<REL::ID, 1> InitActionI{ REL::ID(339738) };
+		inline constexpr std::array<REL::ID, 1> InputEvent{ REL::ID(900194) };
+		inline constexpr std::array<REL::ID, 1> IntSeenData{ REL::ID(1403994) };
+		inline constexpr std::array<REL::ID, 1> InteractionCombatDataCollectFunctor{ REL::ID(700421) };
+		inline constexpr std::array<REL::ID, 1> InterruptCastHandler{ REL::ID(147572) };
+		inline constexpr std::array<REL::ID, 1> Inventory3DManager{ REL::ID(589854) };
+		inline constexpr std::array<REL::ID, 1> InventoryScoringFunctor{ REL::ID(1459243) };
+		inline constexpr std::array<REL::ID, 1> InventoryUpdateData{ REL::ID(803853) };
+		inline constexpr std::array<REL::ID, 1> InvisibilityEffect{ REL::ID(41799) };
+		inline constexpr std::array<REL::ID, 1> IronSightsState{ REL::ID(806631) };
+		inline constexpr std::array<REL::ID, 1> IsFavoriteFunctor{ REL::ID(406331) };
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 4> JetpackEffect{ REL::ID(452969), REL::ID(220155), REL::ID(878136), REL::ID(1490053) };
+		inline constexpr std::array<REL::ID, 1> JobListManager__ServingThread{ REL::ID(1294276) };
+		inline constexpr std::array<REL::ID, 1> Json__BuiltStyledStreamWriter{ REL::ID(279613) };
+		inline constexpr std::array<REL::ID, 1> Json__CharReader{ REL::ID(551979) };
+		inline constexpr std::array<REL::ID, 1> Json__CharReaderBuilder{ REL::ID(1210069) };
+		inline constexpr std::array<REL::ID, 1> Json__CharReader__Factory{ REL::ID(1476137) };
+		inline constexpr std::array<REL::ID, 1> Json__Exception{ REL::ID(642165) };
+		inline constexpr std::array<REL::ID, 1> Json__FastWriter{ REL::ID(753879) };
+		inline constexpr std::array<REL::ID, 1> Json__LogicError{ REL::ID(375951) };
+		inline constexpr std::array<REL::ID, 1> Json__OurCharReader{ REL::ID(10816) };
+		inline constexpr std::array<REL::ID, 1> Json__RuntimeError{ REL::ID(1299995) };
+		inline constexpr std::array<REL::ID, 1> Json__StreamWriter{ REL::ID(943812) };
+		inline constexpr std::array<REL::ID, 1> Json__StreamWriterBuilder{ REL::ID(19292) };
+		inline constexpr std::array<REL::ID, 1> Json__StreamWriter__Factory{ REL::ID(285620) };
+		inline constexpr std::array<REL::ID, 1> Json__StyledWriter{ REL::ID(1335737) };
+		inline constexpr std::array<REL::ID, 1> Json__Writer{ REL::ID(678218) };
+		inline constexpr std::array<REL::ID, 1> JumpAnimEventHandler{ REL::ID(372230) };
+		inline constexpr std::array<REL::ID, 1> JumpHandler{ REL::ID(1226874) };
+	}
+}
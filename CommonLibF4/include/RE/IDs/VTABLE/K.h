@@ -0,0 +1,14 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> KillActorHandler{ REL::ID(175266) };
+		inline constexpr std::array<REL::ID, 1> KillMoveEndHandler{ REL::ID(399633) };
+		inline constexpr std::array<REL::ID, 1> KillMoveStartHandler{ REL::ID(1323688) };
+		inline constexpr std::array<REL::ID, 1> KinectEvent{ REL::ID(1579238) };
+		inline constexpr std::array<REL::ID, 1> KnockdownHandler{ REL::ID(709889) };
+		inline constexpr std::array<REL::ID, 1> KnockdownTargetHandler{ REL::ID(1367195) };
+	}
+}
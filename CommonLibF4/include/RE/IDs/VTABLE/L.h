@@ -0,0 +1,32 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> LOCALNAMESPACE__hkNativeResource{ REL::ID(767304) };
+		inline constexpr std::array<REL::ID, 1> LargestAreaFunctor{ REL::ID(389606) };
+		inline constexpr std::array<REL::ID, 1> LeftHandSpellCastHandler{ REL::ID(1252895) };
+		inline constexpr std::array<REL::ID, 1> LeftHandSpellFireHandler{ REL::ID(860592) };
+		inline constexpr std::array<REL::ID, 3> LevelUpMenu{ REL::ID(105277), REL::ID(184957), REL::ID(796483) };
+		inline constexpr std::array<REL::ID, 1> LightEffect{ REL::ID(771405) };
+		inline constexpr std::array<REL::ID, 1> LipSynchAnimDB__LipAudioInterface{ REL::ID(720430) };
+		inline constexpr std::array<REL::ID, 1> LoadGameMagicCasterVisitor{ REL::ID(294224) };
+		inline constexpr std::array<REL::ID, 1> LoadStorageWrapper{ REL::ID(579237) };
+		inline constexpr std::array<REL::ID, 1> LoadedAreaBound{ REL::ID(1367820) };
+		inline constexpr std::array<REL::ID, 2> LoadingMenu{ REL::ID(172552), REL::ID(251895) };
+		inline constexpr std::array<REL::ID, 1> LoadingMenuData{ REL::ID(1039191) };
+		inline constexpr std::array<REL::ID, 1> LocalMapCamera{ REL::ID(67299) };
+		inline constexpr std::array<REL::ID, 1> LocalMapCamera__DefaultState{ REL::ID(412551) };
+		inline constexpr std::array<REL::ID, 1> LocalMapSnapshotCommand{ REL::ID(153675) };
+		inline constexpr std::array<REL::ID, 1> LockEffect{ REL::ID(757736) };
+		inline constexpr std::array<REL::ID, 2> LockpickingMenu{ REL::ID(1350781), REL::ID(1430299) };
+		inline constexpr std::array<REL::ID, 1> LongestDurationFunctor{ REL::ID(1313729) };
+		inline constexpr std::array<REL::ID, 1> LookHandler{ REL::ID(44789) };
+		inline constexpr std::array<REL::ID, 1> LooksInputRepeatHandler{ REL::ID(102198) };
+		inline constexpr std::array<REL::ID, 3> LooksMenu{ REL::ID(8371), REL::ID(88476), REL::ID(700392) };
+		inline constexpr std::array<REL::ID, 1> LooksMenuUtils__ChangePresetConfirmCallback{ REL::ID(636688) };
+		inline constexpr std::array<REL::ID, 1> LooksMenuUtils__ExitConfirmCallback{ REL::ID(1560894) };
+		inline constexpr std::array<REL::ID, 1> LoopingActivateHandler{ REL::ID(78804) };
+	}
+}
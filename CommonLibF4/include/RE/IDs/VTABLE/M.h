@@ -0,0 +1,151 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> MagicCaster{ REL::ID(291027) };
+		inline constexpr std::array<REL::ID, 1> MagicCaster__PostCreationCallback{ REL::ID(995728) };
+		inline constexpr std::array<REL::ID, 4> MagicItem{ REL::ID(626062), REL::ID(1541697), REL::ID(571019), REL::ID(962873) };
+		inline constexpr std::array<REL::ID, 1> MagicItemDataCollector{ REL::ID(641362) };
+		inline constexpr std::array<REL::ID, 1> MagicItemFindFunctor{ REL::ID(916280) };
+		inline constexpr std::array<REL::ID, 1> MagicItemFindKeywordFunctor{ REL::ID(211715) };
+		inline constexpr std::array<REL::ID, 1> MagicItemTraversalFunctor{ REL::ID(258227) };
+		inline constexpr std::array<REL::ID, 1> MagicItem__PreloadableVisitor{ REL::ID(1550091) };
+		inline constexpr std::array<REL::ID, 1> MagicTarget{ REL::ID(343092) };
+		inline constexpr std::array<REL::ID, 1> MagicTarget__IPostCreationModification{ REL::ID(306273) };
+		inline constexpr std::array<REL::ID, 1> Main{ REL::ID(281116) };
+		inline constexpr std::array<REL::ID, 3> MainMenu{ REL::ID(643428), REL::ID(17530), REL::ID(629690) };
+		inline constexpr std::array<REL::ID, 1> MatchEquippedAndFavoriteDataFunctor{ REL::ID(1550053) };
+		inline constexpr std::array<REL::ID, 1> MeleeThrowHandler{ REL::ID(1385468) };
+		inline constexpr std::array<REL::ID, 1> MemoryHeap{ REL::ID(1056819) };
+		inline constexpr std::array<REL::ID, 1> MemoryManagerFile{ REL::ID(847585) };
+		inline constexpr std::array<REL::ID, 1> MenuControls{ REL::ID(897854) };
+		inline constexpr std::array<REL::ID, 2> MenuCursor{ REL::ID(1296507), REL::ID(372428) };
+		inline constexpr std::array<REL::ID, 1> MenuOpenHandler{ REL::ID(730769) };
+		inline constexpr std::array<REL::ID, 2> MenuTopicManager{ REL::ID(834180), REL::ID(1492602) };
+		inline constexpr std::array<REL::ID, 1> MessageBoxData{ REL::ID(1360746) };
+		inline constexpr std::array<REL::ID, 3> MessageBoxMenu{ REL::ID(11419), REL::ID(91435), REL::ID(703386) };
+		inline constexpr std::array<REL::ID, 2> MessageBoxMenu__FXMessageBoxMenu{ REL::ID(58442), REL::ID(717090) };
+		inline constexpr std::array<REL::ID, 1> MiscStatManager__FindStatByCRC{ REL::ID(1425090) };
+		inline constexpr std::array<REL::ID, 1> MiscStatManager__IMiscStatVisitor{ REL::ID(986349) };
+		inline constexpr std::array<REL::ID, 1> MiscStatManager____RevertStatVisitor{ REL::ID(521308) };
+		inline constexpr std::array<REL::ID, 1> MiscStatManager____SaveStatVisitor{ REL::ID(82568) };
+		inline constexpr std::array<REL::ID, 8> MissileProjectile{ REL::ID(1432029), REL::ID(990194), REL::ID(66427), REL::ID(724855), REL::ID(1382415), REL::ID(458187), REL::ID(52485), REL::ID(1149354) };
+		inline constexpr std::array<REL::ID, 1> MobIterOperator{ REL::ID(1156762) };
+		inline constexpr std::array<REL::ID, 1> ModManager__AsyncModRequest{ REL::ID(740106) };
+		inline constexpr std::array<REL::ID, 1> ModManager__CategorySearchRequest{ REL::ID(34754) };
+		inline constexpr std::array<REL::ID, 1> ModManager__CloseModManager_ConfirmCallback{ REL::ID(797372) };
+		inline constexpr std::array<REL::ID, 1> ModManager__DeleteAllMods_ConfirmCallback{ REL::ID(1063077) };
+		inline constexpr std::array<REL::ID, 1> ModManager__DeleteLibraryMod_ConfirmCallback{ REL::ID(671278) };
+		inline constexpr std::array<REL::ID, 1> ModManager__DeleteMod_ConfirmCallback{ REL::ID(936959) };
+		inline constexpr std::array<REL::ID, 1> ModManager__DownloadImageRequest{ REL::ID(1351042) };
+		inline constexpr std::array<REL::ID, 1> ModManager__DownloadModRequest{ REL::ID(1178547) };
+		inline constexpr std::array<REL::ID, 1> ModManager__GetDependencyRequest{ REL::ID(912551) };
+		inline constexpr std::array<REL::ID, 1> ModManager__GetDetailsRequest{ REL::ID(473673) };
+		inline constexpr std::array<REL::ID, 1> ModManager__GetIntRequest{ REL::ID(646754) };
+		inline constexpr std::array<REL::ID, 1> ModManager__ModsChanged_ConfirmResetCallback{ REL::ID(1524241) };
+		inline constexpr std::array<REL::ID, 1> ModManager__ReportMod_CategoryCallback{ REL::ID(511991) };
+		inline constexpr std::array<REL::ID, 1> ModManager__ReportMod_ConfirmCallback{ REL::ID(1170134) };
+		inline constexpr std::array<REL::ID, 1> ModManager__SavedGFxValueRequest{ REL::ID(207929) };
+		inline constexpr std::array<REL::ID, 1> ModManager__StringStringRequest{ REL::ID(1085218) };
+		inline constexpr std::array<REL::ID, 1> ModTimeLeftFunctor{ REL::ID(1349451) };
+		inline constexpr std::array<REL::ID, 3> ModelReferenceEffect{ REL::ID(833957), REL::ID(367584), REL::ID(181369) };
+		inline constexpr std::array<REL::ID, 1> Moon{ REL::ID(48649) };
+		inline constexpr std::array<REL::ID, 1> MotionDrivenHandler{ REL::ID(792106) };
+		inline constexpr std::array<REL::ID, 1> MountDismountEndHandler{ REL::ID(1310032) };
+		inline constexpr std::array<REL::ID, 1> MountInteraction{ REL::ID(1189662) };
+		inline constexpr std::array<REL::ID, 1> MouseMoveEvent{ REL::ID(355980) };
+		inline constexpr std::array<REL::ID, 1> MovementAgent{ REL::ID(729682) };
+		inline constexpr std::array<REL::ID, 4> MovementAgentActorAvoider{ REL::ID(268058), REL::ID(393987), REL::ID(1491315), REL::ID(81481) };
+		inline constexpr std::array<REL::ID, 4> MovementAgentActorState{ REL::ID(81266), REL::ID(207511), REL::ID(1304130), REL::ID(599649) };
+		inline constexpr std::array<REL::ID, 1> MovementAgentNullTracker_IMovementHandlerAgent_MovementHandlerOutputDataSmallDelta_{ REL::ID(109497) };
+		inline constexpr std::array<REL::ID, 1> MovementAgentNullTracker_IMovementHandlerAgent_MovementHandlerUpdateDataSmallDelta_{ REL::ID(375468) };
+		inline constexpr std::array<REL::ID, 1> MovementAgentNullTracker_IMovementPlannerAgent_MovementPlannerAgentReturnDataSmallDelta_{ REL::ID(251965) };
+		inline constexpr std::array<REL::ID, 1> MovementAgentNullTracker_IMovementTweenerAgent_MovementTweenerAgentOutputData_{ REL::ID(31882) };
+		inline constexpr std::array<REL::ID, 8> MovementAgentPathFollowerFlight{ REL::ID(616621), REL::ID(742881), REL::ID(37642), REL::ID(915337), REL::ID(429752), REL::ID(602838), REL::ID(336750), REL::ID(589243) };
+		inline constexpr std::array<REL::ID, 8> MovementAgentPathFollowerStandard{ REL::ID(544728), REL::ID(670874), REL::ID(185483), REL::ID(357802), REL::ID(610340), REL::ID(1268420), REL::ID(783179), REL::ID(297430) };
+		inline constexpr std::array<REL::ID, 5> MovementAgentPathFollowerVirtual{ REL::ID(1532346), REL::ID(76164), REL::ID(1173005), REL::ID(1345531), REL::ID(15260) };
+		inline constexpr std::array<REL::ID, 1> MovementArbiter{ REL::ID(1044452) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationAverageFloat{ REL::ID(1432449) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationAverage_float_{ REL::ID(774823) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationMaxWeightParameters{ REL::ID(242578) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationMaxWeightPoint{ REL::ID(634913) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationMaxWeight_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__{ REL::ID(1166725) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationMaxWeight_NiPoint3_{ REL::ID(1559016) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationScheme_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__{ REL::ID(508552) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationScheme_MovementVector_{ REL::ID(1149305) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationScheme_NiPoint3_{ REL::ID(900722) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationScheme_float_{ REL::ID(116407) };
+		inline constexpr std::array<REL::ID, 1> MovementArbitrationVectorAdd{ REL::ID(225434) };
+		inline constexpr std::array<REL::ID, 1> MovementAvoidBoxEventAdapter{ REL::ID(1023283) };
+		inline constexpr std::array<REL::ID, 1> MovementAvoidanceManager{ REL::ID(765084) };
+		inline constexpr std::array<REL::ID, 1> MovementControllerAI{ REL::ID(1551948) };
+		inline constexpr std::array<REL::ID, 7> MovementControllerNPC{ REL::ID(1428146), REL::ID(896395), REL::ID(630620), REL::ID(98316), REL::ID(710354), REL::ID(1321193), REL::ID(1274765) };
+		inline constexpr std::array<REL::ID, 1> MovementControllerNullDataTracker{ REL::ID(1538212) };
+		inline constexpr std::array<REL::ID, 1> MovementHandler{ REL::ID(577025) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgent{ REL::ID(1579458), REL::ID(123231) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentAngleGain{ REL::ID(1197614), REL::ID(1323385) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentAnglePassThrough{ REL::ID(1249664), REL::ID(1375316) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentAnimationDriven{ REL::ID(911664), REL::ID(1037599) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentDirectControl{ REL::ID(855054), REL::ID(981008) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentDirectionPassThrough{ REL::ID(969566), REL::ID(1095845) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentGraphDrivenAnimationDriven{ REL::ID(1509668), REL::ID(53136) };
+		inline constexpr std::array<REL::ID, 5> MovementHandlerAgentPlayerControls{ REL::ID(165742), REL::ID(291522), REL::ID(1388390), REL::ID(464130), REL::ID(1561593) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentPlayerControlsActionTrigger{ REL::ID(1266394), REL::ID(1392194) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentSpeedPassThrough{ REL::ID(1529366), REL::ID(73138) };
+		inline constexpr std::array<REL::ID, 3> MovementHandlerAgentSprintActionTrigger{ REL::ID(268155), REL::ID(394081), REL::ID(1491401) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentStairsHelper{ REL::ID(1197730), REL::ID(1323477) };
+		inline constexpr std::array<REL::ID, 3> MovementHandlerAgentStandard{ REL::ID(511120), REL::ID(637419), REL::ID(152011) };
+		inline constexpr std::array<REL::ID, 3> MovementHandlerAgentStorePlannerOutput{ REL::ID(618236), REL::ID(744482), REL::ID(258863) };
+		inline constexpr std::array<REL::ID, 2> MovementHandlerAgentStrafing{ REL::ID(251251), REL::ID(377293) };
+		inline constexpr std::array<REL::ID, 1> MovementHandlerArbiter{ REL::ID(1061021) };
+		inline constexpr std::array<REL::ID, 1> MovementLargeDelta__IEnumVisitor{ REL::ID(405001) };
+		inline constexpr std::array<REL::ID, 1> MovementMessage{ REL::ID(917725) };
+		inline constexpr std::array<REL::ID, 2> MovementMessageActivateDoor{ REL::ID(1420317), REL::ID(10543) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageActorCollision{ REL::ID(1090472) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageApproachingDoor{ REL::ID(1248054) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageBlocked{ REL::ID(1472812) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageDoor{ REL::ID(1075037) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageFreezeDirection{ REL::ID(871398) };
+		inline constexpr std::array<REL::ID, 2> MovementMessageJump{ REL::ID(380970), REL::ID(554015) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageNewPath{ REL::ID(1424775) };
+		inline constexpr std::array<REL::ID, 1> MovementMessagePathCleared{ REL::ID(30736) };
+		inline constexpr std::array<REL::ID, 1> MovementMessagePathComplete{ REL::ID(1267939) };
+		inline constexpr std::array<REL::ID, 1> MovementMessagePathEvent{ REL::ID(1095116) };
+		inline constexpr std::array<REL::ID, 1> MovementMessagePathFailed{ REL::ID(1440492) };
+		inline constexpr std::array<REL::ID, 1> MovementMessagePlayIdle{ REL::ID(1458885) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageSetStaticPath{ REL::ID(1272354) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageUpdateRequestImmediate{ REL::ID(15029) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageWarpToLocation{ REL::ID(263344) };
+		inline constexpr std::array<REL::ID, 1> MovementMessageWarpToMultiple{ REL::ID(76868) };
+		inline constexpr std::array<REL::ID, 1> MovementParameters{ REL::ID(828936) };
+		inline constexpr std::array<REL::ID, 1> MovementParametersFixed{ REL::ID(190401) };
+		inline constexpr std::array<REL::ID, 2> MovementPathManagerAgent{ REL::ID(229619), REL::ID(575126) };
+		inline constexpr std::array<REL::ID, 2> MovementPathManagerAgentAvoidBox{ REL::ID(210068), REL::ID(555596) };
+		inline constexpr std::array<REL::ID, 2> MovementPathManagerAgentLoadedAreaMonitor{ REL::ID(1162311), REL::ID(1508041) };
+		inline constexpr std::array<REL::ID, 4> MovementPathManagerAgentStaticAvoider{ REL::ID(825926), REL::ID(1171363), REL::ID(1343921), REL::ID(858694) };
+		inline constexpr std::array<REL::ID, 3> MovementPathManagerArbiter{ REL::ID(1266080), REL::ID(906789), REL::ID(1079456) };
+		inline constexpr std::array<REL::ID, 1> MovementPathManagerNullTracker{ REL::ID(360858) };
+		inline constexpr std::array<REL::ID, 2> MovementPlannerAgent{ REL::ID(1110269), REL::ID(1236543) };
+		inline constexpr std::array<REL::ID, 3> MovementPlannerAgentDirectControl{ REL::ID(372006), REL::ID(498101), REL::ID(12311) };
+		inline constexpr std::array<REL::ID, 3> MovementPlannerAgentNavmeshBounds{ REL::ID(1553841), REL::ID(97529), REL::ID(1194516) };
+		inline constexpr std::array<REL::ID, 3> MovementPlannerAgentWarp{ REL::ID(423875), REL::ID(550403), REL::ID(64759) };
+		inline constexpr std::array<REL::ID, 2> MovementPlannerArbiter{ REL::ID(1296688), REL::ID(937448) };
+		inline constexpr std::array<REL::ID, 3> MovementPostUpdateArbiter{ REL::ID(274076), REL::ID(1277687), REL::ID(1011499) };
+		inline constexpr std::array<REL::ID, 1> MovementSelectIdleUtils__SelectClosestIdleToMovementSelectionData{ REL::ID(1356651) };
+		inline constexpr std::array<REL::ID, 1> MovementSelectIdleUtils__SelectClosestIdleToPath{ REL::ID(479362) };
+		inline constexpr std::array<REL::ID, 2> MovementStateFollowPath{ REL::ID(1018534), REL::ID(1363809) };
+		inline constexpr std::array<REL::ID, 1> MovementStateTransformOverride{ REL::ID(621294) };
+		inline constexpr std::array<REL::ID, 2> MovementStateTweener{ REL::ID(607522), REL::ID(952955) };
+		inline constexpr std::array<REL::ID, 2> MovementTweenerAgent{ REL::ID(578147), REL::ID(704648) };
+		inline constexpr std::array<REL::ID, 4> MovementTweenerAgentFixedDelta{ REL::ID(1521515), REL::ID(65175), REL::ID(942580), REL::ID(18114) };
+		inline constexpr std::array<REL::ID, 3> MovementTweenerAgentNodeFollower{ REL::ID(555691), REL::ID(682082), REL::ID(1559331) };
+		inline constexpr std::array<REL::ID, 4> MovementTweenerAgentTargetPosAndVel{ REL::ID(1429688), REL::ID(1556175), REL::ID(851210), REL::ID(1509700) };
+		inline constexpr std::array<REL::ID, 3> MovementTweenerArbiter{ REL::ID(1469486), REL::ID(890715), REL::ID(405186) };
+		inline constexpr std::array<REL::ID, 1> Movie{ REL::ID(1509234) };
+		inline constexpr std::array<REL::ID, 1> MoviePlayer{ REL::ID(804374) };
+		inline constexpr std::array<REL::ID, 2> MultiActivateManager{ REL::ID(476010), REL::ID(1134149) };
+		inline constexpr std::array<REL::ID, 2> MultiActivateMenu{ REL::ID(1306886), REL::ID(1386281) };
+	}
+}
@@ -0,0 +1,362 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> NEW_REFR_DATA{ REL::ID(1139812) };
+		inline constexpr std::array<REL::ID, 1> NPCAttachHandler{ REL::ID(385940) };
+		inline constexpr std::array<REL::ID, 1> NPCDetachHandler{ REL::ID(1044051) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisInstanceData{ REL::ID(390678) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisInstanceDataOwner{ REL::ID(1048912) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisInstanceGroup{ REL::ID(1550026) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisInstanceGroupPass{ REL::ID(425361) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisInstanceManager{ REL::ID(1055171) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisInstanceNode{ REL::ID(1138646) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisNode{ REL::ID(350312) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__DebrisRenderer{ REL::ID(1233412) };
+		inline constexpr std::array<REL::ID, 1> NVFlex__FlexThread{ REL::ID(421411) };
+		inline constexpr std::array<REL::ID, 3> NavMesh{ REL::ID(1054313), REL::ID(980021), REL::ID(56028) };
+		inline constexpr std::array<REL::ID, 2> NavMeshInfoMap{ REL::ID(453322), REL::ID(1084157) };
+		inline constexpr std::array<REL::ID, 1> NavMeshObstacleCoverManager{ REL::ID(535731) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchClosePoint{ REL::ID(1149127) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchFitSphere{ REL::ID(351107) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchFlee{ REL::ID(1182154) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchHide{ REL::ID(650303) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchLOS{ REL::ID(776478) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchMaxCost{ REL::ID(1168391) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchMultipleGoals{ REL::ID(416767) };
+		inline constexpr std::array<REL::ID, 1> NavMeshSearchSLPoint{ REL::ID(589969) };
+		inline constexpr std::array<REL::ID, 1> NiAVObject{ REL::ID(1031341) };
+		inline constexpr std::array<REL::ID, 1> NiAVObjectPalette{ REL::ID(1095860) };
+		inline constexpr std::array<REL::ID, 1> NiAccumulator{ REL::ID(737123) };
+		inline constexpr std::array<REL::ID, 1> NiAdditionalGeometryData{ REL::ID(1282505) };
+		inline constexpr std::array<REL::ID, 1> NiAllocator{ REL::ID(1229985) };
+		inline constexpr std::array<REL::ID, 1> NiAlphaAccumulator{ REL::ID(1256514) };
+		inline constexpr std::array<REL::ID, 1> NiAlphaProperty{ REL::ID(1195453) };
+		inline constexpr std::array<REL::ID, 1> NiAmbientLight{ REL::ID(5319) };
+		inline constexpr std::array<REL::ID, 1> NiBSPNode{ REL::ID(1000977) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineBasisData{ REL::ID(731323) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineColorInterpolator{ REL::ID(171702) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineCompColorInterpolator{ REL::ID(143893) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineCompFloatInterpolator{ REL::ID(116384) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineCompPoint3Interpolator{ REL::ID(88967) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineCompTransformInterpolator{ REL::ID(500050) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineData{ REL::ID(450901) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineFloatInterpolator{ REL::ID(472465) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineInterpolator{ REL::ID(1111874) };
+		inline constexpr std::array<REL::ID, 1> NiBSplinePoint3Interpolator{ REL::ID(444847) };
+		inline constexpr std::array<REL::ID, 1> NiBSplineTransformInterpolator{ REL::ID(856359) };
+		inline constexpr std::array<REL::ID, 1> NiBackToFrontAccumulator{ REL::ID(1507595) };
+		inline constexpr std::array<REL::ID, 1> NiBillboardNode{ REL::ID(1145603) };
+		inline constexpr std::array<REL::ID, 1> NiBinaryExtraData{ REL::ID(510446) };
+		inline constexpr std::array<REL::ID, 1> NiBinaryStream{ REL::ID(1057037) };
+		inline constexpr std::array<REL::ID, 1> NiBlendAccumTransformInterpolator{ REL::ID(10277) };
+		inline constexpr std::array<REL::ID, 1> NiBlendBoolInterpolator{ REL::ID(550780) };
+		inline constexpr std::array<REL::ID, 1> NiBlendColorInterpolator{ REL::ID(789254) };
+		inline constexpr std::array<REL::ID, 1> NiBlendFloatInterpolator{ REL::ID(466087) };
+		inline constexpr std::array<REL::ID, 1> NiBlendInterpolator{ REL::ID(1033456) };
+		inline constexpr std::array<REL::ID, 1> NiBlendPoint3Interpolator{ REL::ID(1027328) };
+		inline constexpr std::array<REL::ID, 1> NiBlendQuaternionInterpolator{ REL::ID(561379) };
+		inline constexpr std::array<REL::ID, 1> NiBlendTransformInterpolator{ REL::ID(227996) };
+		inline constexpr std::array<REL::ID, 1> NiBoolData{ REL::ID(799919) };
+		inline constexpr std::array<REL::ID, 1> NiBoolInterpController{ REL::ID(1578265) };
+		inline constexpr std::array<REL::ID, 1> NiBoolInterpolator{ REL::ID(520020) };
+		inline constexpr std::array<REL::ID, 1> NiBoolTimelineInterpolator{ REL::ID(53630) };
+		inline constexpr std::array<REL::ID, 1> NiBooleanExtraData{ REL::ID(1108148) };
+		inline constexpr std::array<REL::ID, 1> NiBoundingVolume{ REL::ID(999560) };
+		inline constexpr std::array<REL::ID, 1> NiBoxBV{ REL::ID(467572) };
+		inline constexpr std::array<REL::ID, 1> NiBoxCapsuleIntersector{ REL::ID(346845) };
+		inline constexpr std::array<REL::ID, 1> NiBoxSphereIntersector{ REL::ID(393500) };
+		inline constexpr std::array<REL::ID, 1> NiCamera{ REL::ID(1305073) };
+		inline constexpr std::array<REL::ID, 1> NiCapsuleBV{ REL::ID(1518222) };
+		inline constexpr std::array<REL::ID, 1> NiCapsuleCapsuleIntersector{ REL::ID(300241) };
+		inline constexpr std::array<REL::ID, 1> NiCapsuleSphereIntersector{ REL::ID(253830) };
+		inline constexpr std::array<REL::ID, 1> NiCapsuleTriIntersector{ REL::ID(207277) };
+		inline constexpr std::array<REL::ID, 1> NiCollisionData{ REL::ID(1545670) };
+		inline constexpr std::array<REL::ID, 1> NiCollisionObject{ REL::ID(662611) };
+		inline constexpr std::array<REL::ID, 1> NiCollisionTraversals__IFindIntersections{ REL::ID(229382) };
+		inline constexpr std::array<REL::ID, 1> NiColorData{ REL::ID(1137845) };
+		inline constexpr std::array<REL::ID, 1> NiColorExtraData{ REL::ID(96134) };
+		inline constexpr std::array<REL::ID, 1> NiColorExtraDataController{ REL::ID(828885) };
+		inline constexpr std::array<REL::ID, 1> NiColorInterpolator{ REL::ID(1218726) };
+		inline constexpr std::array<REL::ID, 1> NiControllerManager{ REL::ID(1556406) };
+		inline constexpr std::array<REL::ID, 1> NiControllerSequence{ REL::ID(1355706) };
+		inline constexpr std::array<REL::ID, 1> NiCullingProcess{ REL::ID(547317) };
+		inline constexpr std::array<REL::ID, 1> NiDefaultAVObjectPalette{ REL::ID(1254852) };
+		inline constexpr std::array<REL::ID, 1> NiDirectionalLight{ REL::ID(442823) };
+		inline constexpr std::array<REL::ID, 1> NiExtraData{ REL::ID(823617) };
+		inline constexpr std::array<REL::ID, 1> NiExtraDataController{ REL::ID(461789) };
+		inline constexpr std::array<REL::ID, 1> NiFile{ REL::ID(445348) };
+		inline constexpr std::array<REL::ID, 1> NiFloatController{ REL::ID(937424) };
+		inline constexpr std::array<REL::ID, 1> NiFloatData{ REL::ID(1417447) };
+		inline constexpr std::array<REL::ID, 1> NiFloatExtraData{ REL::ID(694269) };
+		inline constexpr std::array<REL::ID, 1> NiFloatExtraDataController{ REL::ID(705329) };
+		inline constexpr std::array<REL::ID, 1> NiFloatInterpController{ REL::ID(1495934) };
+		inline constexpr std::array<REL::ID, 1> NiFloatInterpolator{ REL::ID(807383) };
+		inline constexpr std::array<REL::ID, 1> NiFloatsExtraData{ REL::ID(1291641) };
+		inline constexpr std::array<REL::ID, 1> NiFloatsExtraDataController{ REL::ID(1067219) };
+		inline constexpr std::array<REL::ID, 1> NiFloatsExtraDataPoint3Controller{ REL::ID(162480) };
+		inline constexpr std::array<REL::ID, 1> NiFogProperty{ REL::ID(307076) };
+		inline constexpr std::array<REL::ID, 1> NiFormArray{ REL::ID(467690) };
+		inline constexpr std::array<REL::ID, 1> NiGeometry{ REL::ID(1328075) };
+		inline constexpr std::array<REL::ID, 1> NiGeometryData{ REL::ID(1104903) };
+		inline constexpr std::array<REL::ID, 1> NiHalfSpaceBV{ REL::ID(985815) };
+		inline constexpr std::array<REL::ID, 1> NiIntegerExtraData{ REL::ID(51540) };
+		inline constexpr std::array<REL::ID, 1> NiIntegersExtraData{ REL::ID(215463) };
+		inline constexpr std::array<REL::ID, 1> NiInterpController{ REL::ID(1366413) };
+		inline constexpr std::array<REL::ID, 1> NiInterpolator{ REL::ID(539970) };
+		inline constexpr std::array<REL::ID, 1> NiIntersector{ REL::ID(440035) };
+		inline constexpr std::array<REL::ID, 1> NiKeyBasedInterpolator{ REL::ID(512266) };
+		inline constexpr std::array<REL::ID, 1> NiKeyframeManager{ REL::ID(387059) };
+		inline constexpr std::array<REL::ID, 1> NiLight{ REL::ID(383291) };
+		inline constexpr std::array<REL::ID, 1> NiLightColorController{ REL::ID(13636) };
+		inline constexpr std::array<REL::ID, 1> NiLightDimmerController{ REL::ID(1569065) };
+		inline constexpr std::array<REL::ID, 1> NiLightRadiusController{ REL::ID(1102594) };
+		inline constexpr std::array<REL::ID, 1> NiLookAtController{ REL::ID(636475) };
+		inline constexpr std::array<REL::ID, 1> NiLookAtInterpolator{ REL::ID(263322) };
+		inline constexpr std::array<REL::ID, 1> NiMemStream{ REL::ID(511393) };
+		inline constexpr std::array<REL::ID, 1> NiMeshPSysData{ REL::ID(882643) };
+		inline constexpr std::array<REL::ID, 1> NiMeshParticleSystem{ REL::ID(612159) };
+		inline constexpr std::array<REL::ID, 1> NiMorphData{ REL::ID(62971) };
+		inline constexpr std::array<REL::ID, 1> NiMultiTargetTransformController{ REL::ID(371421) };
+		inline constexpr std::array<REL::ID, 1> NiNode{ REL::ID(1048271) };
+		inline constexpr std::array<REL::ID, 1> NiOBBLeaf{ REL::ID(1210991) };
+		inline constexpr std::array<REL::ID, 1> NiOBBNode{ REL::ID(1477057) };
+		inline constexpr std::array<REL::ID, 1> NiOBBRoot{ REL::ID(706726) };
+		inline constexpr std::array<REL::ID, 1> NiObject{ REL::ID(146310) };
+		inline constexpr std::array<REL::ID, 1> NiObjectNET{ REL::ID(277807) };
+		inline constexpr std::array<REL::ID, 1> NiPSysAgeDeathModifier{ REL::ID(652078) };
+		inline constexpr std::array<REL::ID, 1> NiPSysAirFieldAirFrictionCtlr{ REL::ID(841477) };
+		inline constexpr std::array<REL::ID, 1> NiPSysAirFieldInheritVelocityCtlr{ REL::ID(814061) };
+		inline constexpr std::array<REL::ID, 1> NiPSysAirFieldModifier{ REL::ID(786636) };
+		inline constexpr std::array<REL::ID, 1> NiPSysAirFieldSpreadCtlr{ REL::ID(679875) };
+		inline constexpr std::array<REL::ID, 1> NiPSysBombModifier{ REL::ID(545137) };
+		inline constexpr std::array<REL::ID, 1> NiPSysBoundUpdateModifier{ REL::ID(437622) };
+		inline constexpr std::array<REL::ID, 1> NiPSysBoxEmitter{ REL::ID(330880) };
+		inline constexpr std::array<REL::ID, 1> NiPSysCollider{ REL::ID(366229) };
+		inline constexpr std::array<REL::ID, 1> NiPSysColliderManager{ REL::ID(1540248) };
+		inline constexpr std::array<REL::ID, 1> NiPSysColorModifier{ REL::ID(1432873) };
+		inline constexpr std::array<REL::ID, 1> NiPSysCylinderEmitter{ REL::ID(77059) };
+		inline constexpr std::array<REL::ID, 1> NiPSysData{ REL::ID(619867) };
+		inline constexpr std::array<REL::ID, 1> NiPSysDragFieldModifier{ REL::ID(1325919) };
+		inline constexpr std::array<REL::ID, 1> NiPSysDragModifier{ REL::ID(1219383) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitter{ REL::ID(115179) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterCtlr{ REL::ID(242100) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterCtlrData{ REL::ID(673639) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterDeclinationCtlr{ REL::ID(1271119) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterDeclinationVarCtlr{ REL::ID(1243750) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterInitialRadiusCtlr{ REL::ID(1216325) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterLifeSpanCtlr{ REL::ID(1188599) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterPlanarAngleCtlr{ REL::ID(1161082) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterPlanarAngleVarCtlr{ REL::ID(1133470) };
+		inline constexpr std::array<REL::ID, 1> NiPSysEmitterSpeedCtlr{ REL::ID(1106002) };
+		inline constexpr std::array<REL::ID, 1> NiPSysFieldAttenuationCtlr{ REL::ID(1078484) };
+		inline constexpr std::array<REL::ID, 1> NiPSysFieldMagnitudeCtlr{ REL::ID(1050994) };
+		inline constexpr std::array<REL::ID, 1> NiPSysFieldMaxDistanceCtlr{ REL::ID(1023351) };
+		inline constexpr std::array<REL::ID, 1> NiPSysFieldModifier{ REL::ID(328041) };
+		inline constexpr std::array<REL::ID, 1> NiPSysGravityFieldModifier{ REL::ID(995770) };
+		inline constexpr std::array<REL::ID, 1> NiPSysGravityModifier{ REL::ID(653614) };
+		inline constexpr std::array<REL::ID, 1> NiPSysGravityStrengthCtlr{ REL::ID(889005) };
+		inline constexpr std::array<REL::ID, 1> NiPSysGrowFadeModifier{ REL::ID(861395) };
+		inline constexpr std::array<REL::ID, 1> NiPSysInitialRotAngleCtlr{ REL::ID(754768) };
+		inline constexpr std::array<REL::ID, 1> NiPSysInitialRotAngleVarCtlr{ REL::ID(727347) };
+		inline constexpr std::array<REL::ID, 1> NiPSysInitialRotSpeedCtlr{ REL::ID(699945) };
+		inline constexpr std::array<REL::ID, 1> NiPSysInitialRotSpeedVarCtlr{ REL::ID(672197) };
+		inline constexpr std::array<REL::ID, 1> NiPSysMeshEmitter{ REL::ID(642816) };
+		inline constexpr std::array<REL::ID, 1> NiPSysMeshUpdateModifier{ REL::ID(112194) };
+		inline constexpr std::array<REL::ID, 1> NiPSysModifier{ REL::ID(1362413) };
+		inline constexpr std::array<REL::ID, 1> NiPSysModifierActiveCtlr{ REL::ID(644651) };
+		inline constexpr std::array<REL::ID, 1> NiPSysModifierBoolCtlr{ REL::ID(1098657) };
+		inline constexpr std::array<REL::ID, 1> NiPSysModifierCtlr{ REL::ID(951494) };
+		inline constexpr std::array<REL::ID, 1> NiPSysModifierFloatCtlr{ REL::ID(1060249) };
+		inline constexpr std::array<REL::ID, 1> NiPSysPlanarCollider{ REL::ID(1055615) };
+		inline constexpr std::array<REL::ID, 1> NiPSysPositionModifier{ REL::ID(948626) };
+		inline constexpr std::array<REL::ID, 1> NiPSysRadialFieldModifier{ REL::ID(841711) };
+		inline constexpr std::array<REL::ID, 1> NiPSysResetOnLoopCtlr{ REL::ID(734988) };
+		inline constexpr std::array<REL::ID, 1> NiPSysRotationModifier{ REL::ID(361491) };
+		inline constexpr std::array<REL::ID, 1> NiPSysSpawnModifier{ REL::ID(693746) };
+		inline constexpr std::array<REL::ID, 1> NiPSysSphereEmitter{ REL::ID(1024975) };
+		inline constexpr std::array<REL::ID, 1> NiPSysSphericalCollider{ REL::ID(1090813) };
+		inline constexpr std::array<REL::ID, 1> NiPSysTurbulenceFieldModifier{ REL::ID(545372) };
+		inline constexpr std::array<REL::ID, 1> NiPSysUpdateCtlr{ REL::ID(1214721) };
+		inline constexpr std::array<REL::ID, 1> NiPSysVolumeEmitter{ REL::ID(556015) };
+		inline constexpr std::array<REL::ID, 1> NiPSysVortexFieldModifier{ REL::ID(437863) };
+		inline constexpr std::array<REL::ID, 1> NiParticleMeshes{ REL::ID(1129513) };
+		inline constexpr std::array<REL::ID, 1> NiParticleMeshesData{ REL::ID(1236780) };
+		inline constexpr std::array<REL::ID, 1> NiParticleSystem{ REL::ID(1202263) };
+		inline constexpr std::array<REL::ID, 1> NiParticles{ REL::ID(753677) };
+		inline constexpr std::array<REL::ID, 1> NiParticlesData{ REL::ID(1343439) };
+		inline constexpr std::array<REL::ID, 1> NiPathController{ REL::ID(661059) };
+		inline constexpr std::array<REL::ID, 1> NiPathInterpolator{ REL::ID(590394) };
+		inline constexpr std::array<REL::ID, 1> NiPick__Results{ REL::ID(56456) };
+		inline constexpr std::array<REL::ID, 1> NiPoint3InterpController{ REL::ID(1523334) };
+		inline constexpr std::array<REL::ID, 1> NiPoint3Interpolator{ REL::ID(992254) };
+		inline constexpr std::array<REL::ID, 1> NiPointLight{ REL::ID(496353) };
+		inline constexpr std::array<REL::ID, 1> NiPosData{ REL::ID(869714) };
+		inline constexpr std::array<REL::ID, 1> NiProperty{ REL::ID(1036256) };
+		inline constexpr std::array<REL::ID, 1> NiQuaternionInterpolator{ REL::ID(964981) };
+		inline constexpr std::array<REL::ID, 1> NiRefObject{ REL::ID(1414337) };
+		inline constexpr std::array<REL::ID, 1> NiRollController{ REL::ID(1269279) };
+		inline constexpr std::array<REL::ID, 1> NiRotData{ REL::ID(896282) };
+		inline constexpr std::array<REL::ID, 1> NiSearchPath{ REL::ID(996558) };
+		inline constexpr std::array<REL::ID, 1> NiSequence{ REL::ID(789474) };
+		inline constexpr std::array<REL::ID, 1> NiSequenceStreamHelper{ REL::ID(509472) };
+		inline constexpr std::array<REL::ID, 1> NiShadeProperty{ REL::ID(220019) };
+		inline constexpr std::array<REL::ID, 1> NiSingleInterpController{ REL::ID(1190946) };
+		inline constexpr std::array<REL::ID, 1> NiSkinData{ REL::ID(261199) };
+		inline constexpr std::array<REL::ID, 1> NiSkinInstance{ REL::ID(499606) };
+		inline constexpr std::array<REL::ID, 1> NiSkinPartition{ REL::ID(1245884) };
+		inline constexpr std::array<REL::ID, 1> NiSphereBV{ REL::ID(892842) };
+		inline constexpr std::array<REL::ID, 1> NiSphereTriIntersector{ REL::ID(160674) };
+		inline constexpr std::array<REL::ID, 1> NiSpotLight{ REL::ID(1102158) };
+		inline constexpr std::array<REL::ID, 1> NiStandardAllocator{ REL::ID(166049) };
+		inline constexpr std::array<REL::ID, 1> NiStream{ REL::ID(6775) };
+		inline constexpr std::array<REL::ID, 1> NiStringExtraData{ REL::ID(29840) };
+		inline constexpr std::array<REL::ID, 1> NiStringPalette{ REL::ID(229815) };
+		inline constexpr std::array<REL::ID, 1> NiStringsExtraData{ REL::ID(23904) };
+		inline constexpr std::array<REL::ID, 1> NiSwitchNode{ REL::ID(85275) };
+		inline constexpr std::array<REL::ID, 1> NiSwitchStringExtraData{ REL::ID(622191) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_BGSAddonNode_NiTMallocInterface_BGSAddonNode__{ REL::ID(341789) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_BGSCameraPath_NiTMallocInterface_BGSCameraPath__{ REL::ID(1252280) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_BSAnimNoteListener__BSAnimReceiverType_NiTMallocInterface_BSAnimNoteListener__BSAnimReceiverType__{ REL::ID(1126698) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_BSGraphics__TextureFilterMode_NiTMallocInterface_BSGraphics__TextureFilterMode__{ REL::ID(1547701) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_CombatGroup_NiTMallocInterface_CombatGroup__{ REL::ID(571697) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_ImageSpaceEffectParam_NiTMallocInterface_ImageSpaceEffectParam__{ REL::ID(1134381) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_ImageSpaceEffect_NiTMallocInterface_ImageSpaceEffect__{ REL::ID(320611) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_ImageSpaceEffect__EffectInput_NiTMallocInterface_ImageSpaceEffect__EffectInput__{ REL::ID(1307118) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_ImageSpaceTexture_NiTMallocInterface_ImageSpaceTexture__{ REL::ID(429490) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiAVObject_NiTMallocInterface_NiAVObject__{ REL::ID(832085) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiBoundingVolume_NiTMallocInterface_NiBoundingVolume__{ REL::ID(360628) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPick__Record_NiTScrapHeapInterface_NiPick__Record__{ REL::ID(761480) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_BSTriShape__NiTNewInterface_NiPointer_BSTriShape___{ REL::ID(469586) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_NiAVObject__NiTMallocInterface_NiPointer_NiAVObject___{ REL::ID(915971) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_NiAVObject__NiTNewInterface_NiPointer_NiAVObject___{ REL::ID(1533814) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_NiControllerSequence__NiTNewInterface_NiPointer_NiControllerSequence___{ REL::ID(459070) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_NiGeometry__NiTNewInterface_NiPointer_NiGeometry___{ REL::ID(1347152) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_NiTexture__NiTNewInterface_NiPointer_NiTexture___{ REL::ID(670364) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiPointer_NiTransformController__NiTNewInterface_NiPointer_NiTransformController___{ REL::ID(1494296) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_NiTObjectArray_NiPointer_NiAVObject___NiTMallocInterface_NiTObjectArray_NiPointer_NiAVObject____{ REL::ID(4616) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_TESObjectCELL_NiTMallocInterface_TESObjectCELL__{ REL::ID(1046650) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_bool_NiTMallocInterface_bool__{ REL::ID(9999) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_char_NiTMallocInterface_char__{ REL::ID(616596) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_int_NiTMallocInterface_int__{ REL::ID(602567) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_unsignedint_NiTMallocInterface_unsignedint__{ REL::ID(1555956) };
+		inline constexpr std::array<REL::ID, 1> NiTArray_void___NiStream_NiObject__NiTMallocInterface_void___NiStream_NiObject___{ REL::ID(1216841) };
+		inline constexpr std::array<REL::ID, 1> NiTLargeArray_BSFixedString_NiTNewInterface_BSFixedString__{ REL::ID(147266) };
+		inline constexpr std::array<REL::ID, 1> NiTLargeArray_NiPointer_NiObject__NiTNewInterface_NiPointer_NiObject___{ REL::ID(1556898) };
+		inline constexpr std::array<REL::ID, 1> NiTLargeArray_TESForm_NiTMallocInterface_TESForm__{ REL::ID(1172627) };
+		inline constexpr std::array<REL::ID, 1> NiTLargeArray_unsignedint_NiTMallocInterface_unsignedint__{ REL::ID(851896) };
+		inline constexpr std::array<REL::ID, 1> NiTLargeObjectArray_BSFixedString_{ REL::ID(586195) };
+		inline constexpr std::array<REL::ID, 1> NiTLargeObjectArray_NiPointer_NiObject__{ REL::ID(413031) };
+		inline constexpr std::array<REL::ID, 1> NiTLargePrimitiveArray_TESForm_{ REL::ID(28722) };
+		inline constexpr std::array<REL::ID, 1> NiTLargePrimitiveArray_unsignedint_{ REL::ID(1290745) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5_____BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___{ REL::ID(1379411) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___unsignedint___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___unsignedint_{ REL::ID(1327862) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_ENUM_FORM_ID_BSSimpleList_SavedFormData____ENUM_FORM_ID_BSSimpleList_SavedFormData__{ REL::ID(502593) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_TESFile_TESWorldSpace__OFFSET_DATA___TESFile_TESWorldSpace__OFFSET_DATA_{ REL::ID(1463969) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_TESForm_bool___TESForm_bool_{ REL::ID(751967) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_charconst_IDLE_ANIM_ROOT___charconst_IDLE_ANIM_ROOT_{ REL::ID(774123) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_unsignedint_TESFile___unsignedint_TESFile_{ REL::ID(1210526) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_DFALL_NiTMapItem_unsignedint_unsignedchar___unsignedint_unsignedchar_{ REL::ID(4247) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_NiTPointerAllocator_unsigned__int64__BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___WadingWaterData_{ REL::ID(906359) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_NiTPointerAllocator_unsigned__int64__NiObjectconst_unsignedint_{ REL::ID(1244257) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_NiTPointerAllocator_unsigned__int64__charconst_NiObject___void__{ REL::ID(525635) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_NiTPointerAllocator_unsigned__int64__charconst_NiPointer_NiSequence__{ REL::ID(1278371) };
+		inline constexpr std::array<REL::ID, 1> NiTMapBase_NiTPointerAllocator_unsigned__int64__charconst_unsignedshort_{ REL::ID(1109590) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___{ REL::ID(1552540) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_BSPointerHandle_TESObjectREFR_BSUntypedPointerHandle_21_5___unsignedint_{ REL::ID(1501210) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_ENUM_FORM_ID_BSSimpleList_SavedFormData__{ REL::ID(675714) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_TESFile_TESWorldSpace__OFFSET_DATA_{ REL::ID(54201) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_TESForm_bool_{ REL::ID(924361) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_charconst_IDLE_ANIM_ROOT_{ REL::ID(946546) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_unsignedint_TESFile_{ REL::ID(1382834) };
+		inline constexpr std::array<REL::ID, 1> NiTMap_unsignedint_unsignedchar_{ REL::ID(177821) };
+		inline constexpr std::array<REL::ID, 1> NiTObjectArray_NiPointer_BSTriShape__{ REL::ID(908630) };
+		inline constexpr std::array<REL::ID, 1> NiTObjectArray_NiPointer_NiAVObject__{ REL::ID(390064) };
+		inline constexpr std::array<REL::ID, 1> NiTObjectArray_NiPointer_NiControllerSequence__{ REL::ID(898167) };
+		inline constexpr std::array<REL::ID, 1> NiTObjectArray_NiPointer_NiGeometry__{ REL::ID(203992) };
+		inline constexpr std::array<REL::ID, 1> NiTObjectArray_NiPointer_NiTexture__{ REL::ID(1108844) };
+		inline constexpr std::array<REL::ID, 1> NiTObjectArray_NiPointer_NiTransformController__{ REL::ID(350317) };
+		inline constexpr std::array<REL::ID, 1> NiTPointerMap_BSPointerHandle_Actor_BSUntypedPointerHandle_21_5___WadingWaterData_{ REL::ID(1079022) };
+		inline constexpr std::array<REL::ID, 1> NiTPointerMap_NiObjectconst_unsignedint_{ REL::ID(1416645) };
+		inline constexpr std::array<REL::ID, 1> NiTPointerMap_charconst_NiObject___void__{ REL::ID(698811) };
+		inline constexpr std::array<REL::ID, 1> NiTPointerMap_charconst_NiPointer_NiSequence__{ REL::ID(1451191) };
+		inline constexpr std::array<REL::ID, 1> NiTPointerMap_charconst_unsignedshort_{ REL::ID(1282276) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_BGSAddonNode_{ REL::ID(780868) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_BGSCameraPath_{ REL::ID(108690) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_BSAnimNoteListener__BSAnimReceiverType_{ REL::ID(1565848) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_BSGraphics__TextureFilterMode_{ REL::ID(403972) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_CombatGroup_{ REL::ID(1010112) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_ImageSpaceEffectParam_{ REL::ID(1573441) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_ImageSpaceEffect_{ REL::ID(759654) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_ImageSpaceEffect__EffectInput_{ REL::ID(163828) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_ImageSpaceTexture_{ REL::ID(868252) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_NiAVObject_{ REL::ID(1270879) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_NiBoundingVolume_{ REL::ID(799703) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_NiPointer_NiAVObject__{ REL::ID(1354546) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_NiTObjectArray_NiPointer_NiAVObject___{ REL::ID(443689) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_TESObjectCELL_{ REL::ID(1485762) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_bool_{ REL::ID(449032) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_char_{ REL::ID(1055178) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_int_{ REL::ID(1041127) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_unsignedint_{ REL::ID(412110) };
+		inline constexpr std::array<REL::ID, 1> NiTPrimitiveArray_void___NiStream_NiObject__{ REL::ID(73153) };
+		inline constexpr std::array<REL::ID, 1> NiTScrapArray_NiPick__Record_{ REL::ID(1200164) };
+		inline constexpr std::array<REL::ID, 1> NiTStringMap_IDLE_ANIM_ROOT_{ REL::ID(1292091) };
+		inline constexpr std::array<REL::ID, 1> NiTStringPointerMap_NiObject___void__{ REL::ID(1043763) };
+		inline constexpr std::array<REL::ID, 1> NiTStringPointerMap_NiPointer_NiSequence__{ REL::ID(214523) };
+		inline constexpr std::array<REL::ID, 1> NiTStringPointerMap_unsignedshort_{ REL::ID(45428) };
+		inline constexpr std::array<REL::ID, 1> NiTStringTemplateMap_NiTMap_charconst_IDLE_ANIM_ROOT__IDLE_ANIM_ROOT_{ REL::ID(1119275) };
+		inline constexpr std::array<REL::ID, 1> NiTStringTemplateMap_NiTPointerMap_charconst_NiObject___void___NiObject___void__{ REL::ID(870909) };
+		inline constexpr std::array<REL::ID, 1> NiTStringTemplateMap_NiTPointerMap_charconst_NiPointer_NiSequence___NiPointer_NiSequence__{ REL::ID(41402) };
+		inline constexpr std::array<REL::ID, 1> NiTStringTemplateMap_NiTPointerMap_charconst_unsignedshort__unsignedshort_{ REL::ID(1455171) };
+		inline constexpr std::array<REL::ID, 1> NiTextKeyExtraData{ REL::ID(1532325) };
+		inline constexpr std::array<REL::ID, 1> NiTextKeyMatch{ REL::ID(171484) };
+		inline constexpr std::array<REL::ID, 1> NiTexture{ REL::ID(126510) };
+		inline constexpr std::array<REL::ID, 1> NiTimeController{ REL::ID(19047) };
+		inline constexpr std::array<REL::ID, 1> NiTransformController{ REL::ID(1354369) };
+		inline constexpr std::array<REL::ID, 1> NiTransformData{ REL::ID(1096303) };
+		inline constexpr std::array<REL::ID, 1> NiTransformInterpolator{ REL::ID(19485) };
+		inline constexpr std::array<REL::ID, 1> NiTriBasedGeom{ REL::ID(157407) };
+		inline constexpr std::array<REL::ID, 1> NiTriBasedGeomData{ REL::ID(695908) };
+		inline constexpr std::array<REL::ID, 1> NiTriShape{ REL::ID(129720) };
+		inline constexpr std::array<REL::ID, 1> NiTriShapeData{ REL::ID(76385) };
+		inline constexpr std::array<REL::ID, 1> NiTriStrips{ REL::ID(34801) };
+		inline constexpr std::array<REL::ID, 1> NiTriStripsData{ REL::ID(846762) };
+		inline constexpr std::array<REL::ID, 1> NiUVData{ REL::ID(547961) };
+		inline constexpr std::array<REL::ID, 1> NiUnionBV{ REL::ID(1238393) };
+		inline constexpr std::array<REL::ID, 1> NiVectorExtraData{ REL::ID(273622) };
+		inline constexpr std::array<REL::ID, 1> NiVisController{ REL::ID(238618) };
+		inline constexpr std::array<REL::ID, 1> NightEyeEffect{ REL::ID(87955) };
+		inline constexpr std::array<REL::ID, 1> NoInitializationPolicy_BSTSmartPointer_IHandlerFunctor_Actor_BSFixedString__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ REL::ID(791620) };
+		inline constexpr std::array<REL::ID, 2> NonActorMagicCaster{ REL::ID(338560), REL::ID(1216380) };
+		inline constexpr std::array<REL::ID, 2> NonActorMagicTarget{ REL::ID(937836), REL::ID(233260) };
+		inline constexpr std::array<REL::ID, 1> NullMovementSelectIdleResult{ REL::ID(368614) };
+		inline constexpr std::array<REL::ID, 1> NullMovementState{ REL::ID(1074818) };
+		inline constexpr std::array<REL::ID, 1> NullPathBuilderTracker{ REL::ID(957121) };
+		inline constexpr std::array<REL::ID, 1> nsBarterMenu__CancelTradeInProgressCallback{ REL::ID(1195887) };
+		inline constexpr std::array<REL::ID, 1> nsBarterMenu__ConfirmInvestmentCallback{ REL::ID(5054) };
+		inline constexpr std::array<REL::ID, 1> nsBarterMenu__ConfirmTradeCallback{ REL::ID(271783) };
+		inline constexpr std::array<REL::ID, 1> nsBarterMenu__HideMenuCallback{ REL::ID(929743) };
+		inline constexpr std::array<REL::ID, 1> nsBarterMenu__ValidFunc{ REL::ID(98880) };
+		inline constexpr std::array<REL::ID, 1> nsBarterMenu__VendorCapsTooLowCallback{ REL::ID(537874) };
+		inline constexpr std::array<REL::ID, 1> nsContainerMenu__CanPickPocketAliasChecker{ REL::ID(20334) };
+		inline constexpr std::array<REL::ID, 1> nsContainerMenu__ConfirmTakeAllTheThingsCallback{ REL::ID(944855) };
+		inline constexpr std::array<REL::ID, 1> nsContainerMenu__ValidFunc{ REL::ID(679349) };
+		inline constexpr std::array<REL::ID, 2> nsInventory3DManager__NewInventoryMenuItemLoadTask{ REL::ID(46059), REL::ID(344986) };
+		inline constexpr std::array<REL::ID, 2> nsInventory3DManager__NewInventoryMenuItemMaterialSwapMaterialLoadTask{ REL::ID(641845), REL::ID(940418) };
+		inline constexpr std::array<REL::ID, 2> nsInventory3DManager__NewInventoryMenuItemMaterialSwapTextureLoadTask{ REL::ID(1014484), REL::ID(1313391) };
+		inline constexpr std::array<REL::ID, 2> nsInventory3DManager__WorkshopMenuItemLoadTask{ REL::ID(1441887), REL::ID(158704) };
+		inline constexpr std::array<REL::ID, 1> nsLevelUpMenu__LevelUpPromptRequest{ REL::ID(1095080) };
+		inline constexpr std::array<REL::ID, 1> nsMainMenu__DLCChanged_ConfirmResetCallback{ REL::ID(1385991) };
+		inline constexpr std::array<REL::ID, 1> nsMainMenu__DeviceSelectCallback{ REL::ID(70093) };
+		inline constexpr std::array<REL::ID, 1> nsMainMenu__NoDurangoUserSignedInCallback{ REL::ID(728445) };
+		inline constexpr std::array<REL::ID, 1> nsPauseMenu__UserDisengagedCallback{ REL::ID(1252139) };
+		inline constexpr std::array<REL::ID, 1> nsPlayBinkMenu__InitDataMessage{ REL::ID(1373406) };
+		inline constexpr std::array<REL::ID, 1> nsSPECIALMenu__ConfirmResetPointsCallback{ REL::ID(448570) };
+		inline constexpr std::array<REL::ID, 1> nsStartMenu_InputMapping__RemapHandler{ REL::ID(1380413) };
+		inline constexpr std::array<REL::ID, 1> nsWS_Caravan__MessageData{ REL::ID(1502017) };
+		inline constexpr std::array<REL::ID, 1> nsWorkshopMenu__WorkshopMenuPromptRequest{ REL::ID(402265) };
+	}
+}
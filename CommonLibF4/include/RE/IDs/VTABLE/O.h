@@ -0,0 +1,15 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 2> ObjectListItem{ REL::ID(981468), REL::ID(888405) };
+		inline constexpr std::array<REL::ID, 1> ObstacleTaskData{ REL::ID(796325) };
+		inline constexpr std::array<REL::ID, 1> OpenBarterMenuMessage{ REL::ID(1395873) };
+		inline constexpr std::array<REL::ID, 1> OpenContainerMenuMessage{ REL::ID(221132) };
+		inline constexpr std::array<REL::ID, 1> OpenEffect{ REL::ID(1003476) };
+		inline constexpr std::array<REL::ID, 1> OwnedCameraEffectController{ REL::ID(960705) };
+		inline constexpr std::array<REL::ID, 1> OwnedController{ REL::ID(932320) };
+	}
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> PArrayPoint{ REL::ID(537847) };
+		inline constexpr std::array<REL::ID, 1> PackageCreator{ REL::ID(1522283) };
+		inline constexpr std::array<REL::ID, 1> PackageList__IPackageVisitor{ REL::ID(232508) };
+		inline constexpr std::array<REL::ID, 1> PackageLocation{ REL::ID(1113096) };
+		inline constexpr std::array<REL::ID, 1> PairedAttackDialogueHandler{ REL::ID(1507672) };
+		inline constexpr std::array<REL::ID, 1> PairedStopHandler{ REL::ID(7077) };
+		inline constexpr std::array<REL::ID, 1> ParalysisEffect{ REL::ID(803565) };
+		inline constexpr std::array<REL::ID, 1> PassengerInteraction{ REL::ID(960582) };
+		inline constexpr std::array<REL::ID, 1> PathFollowerStateFollowPathToParameter{ REL::ID(612178) };
+		inline constexpr std::array<REL::ID, 1> PathFollowerStateKeepLastDirection{ REL::ID(252846) };
+		inline constexpr std::array<REL::ID, 1> PathFollowerStatePlayIdle{ REL::ID(1582993) };
+		inline constexpr std::array<REL::ID, 1> PathFollowerStateShortcut{ REL::ID(804116) };
+		inline constexpr std::array<REL::ID, 1> PathFollowerStateTurnToAngle{ REL::ID(1196139) };
+		inline constexpr std::array<REL::ID, 5> PathManagerPositionPlayerAdapter{ REL::ID(1149420), REL::ID(225550), REL::ID(883474), REL::ID(1541775), REL::ID(617638) };
+		inline constexpr std::array<REL::ID, 1> PathSmootherRayCastUsePreferredTris{ REL::ID(41420) };
+		inline constexpr std::array<REL::ID, 1> PathSmootherRayCastUseTrianglePath{ REL::ID(700209) };
+		inline constexpr std::array<REL::ID, 3> Pathing{ REL::ID(236645), REL::ID(1286800), REL::ID(755077) };
+		inline constexpr std::array<REL::ID, 1> PathingCell{ REL::ID(1525499) };
+		inline constexpr std::array<REL::ID, 1> PathingCoverLocation{ REL::ID(1412693) };
+		inline constexpr std::array<REL::ID, 1> PathingDoor{ REL::ID(447258) };
+		inline constexpr std::array<REL::ID, 1> PathingLockData{ REL::ID(1549844) };
+		inline constexpr std::array<REL::ID, 1> PathingNumericIDVisitor{ REL::ID(219825) };
+		inline constexpr std::array<REL::ID, 1> PathingRequest{ REL::ID(1097317) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestClosePoint{ REL::ID(1467362) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestClosestGoal{ REL::ID(309959) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestCover{ REL::ID(1425775) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFlee{ REL::ID(1239637) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFly{ REL::ID(1052967) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFlyAction{ REL::ID(866278) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFlyHover{ REL::ID(680412) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFlyLand{ REL::ID(493308) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFlyOrbit{ REL::ID(306873) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestFlyTakeOff{ REL::ID(120403) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestHide{ REL::ID(372645) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestLOS{ REL::ID(186445) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestOptimalLocation{ REL::ID(1582087) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestRotate{ REL::ID(252003) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestSafeStraightLine{ REL::ID(65439) };
+		inline constexpr std::array<REL::ID, 1> PathingRequestStopMoving{ REL::ID(317684) };
+		inline constexpr std::array<REL::ID, 1> PathingSpace{ REL::ID(206123) };
+		inline constexpr std::array<REL::ID, 1> PathingStreamLoadGame{ REL::ID(9211) };
+		inline constexpr std::array<REL::ID, 1> PathingStreamMasterFileRead{ REL::ID(1465198) };
+		inline constexpr std::array<REL::ID, 1> PathingStreamSaveGame{ REL::ID(89293) };
+		inline constexpr std::array<REL::ID, 1> PatrolActorPackageData{ REL::ID(502071) };
+		inline constexpr std::array<REL::ID, 2> PauseMenu{ REL::ID(481406), REL::ID(1438391) };
+		inline constexpr std::array<REL::ID, 1> PeakValueModifierEffect{ REL::ID(789864) };
+		inline constexpr std::array<REL::ID, 1> PerformActivationHandler{ REL::ID(597203) };
+		inline constexpr std::array<REL::ID, 1> PerkEntryVisitor{ REL::ID(1087628) };
+		inline constexpr std::array<REL::ID, 1> PerkRankVisitor{ REL::ID(447220) };
+		inline constexpr std::array<REL::ID, 1> PickNewIdleHandler{ REL::ID(1463927) };
+		inline constexpr std::array<REL::ID, 1> PipboyArray{ REL::ID(1301251) };
+		inline constexpr std::array<REL::ID, 1> PipboyBootSequenceHandler{ REL::ID(330980) };
+		inline constexpr std::array<REL::ID, 1> PipboyCommand{ REL::ID(1456100) };
+		inline constexpr std::array<REL::ID, 1> PipboyCommandResult{ REL::ID(1576917) };
+		inline constexpr std::array<REL::ID, 3> PipboyCompanionService{ REL::ID(1537953), REL::ID(1271855), REL::ID(347532) };
+		inline constexpr std::array<REL::ID, 1> PipboyDataGroup{ REL::ID(1035234) };
+		inline constexpr std::array<REL::ID, 1> PipboyHandler{ REL::ID(1262493) };
+		inline constexpr std::array<REL::ID, 3> PipboyHolotapeMenu{ REL::ID(623840), REL::ID(1141887), REL::ID(171441) };
+		inline constexpr std::array<REL::ID, 11> PipboyInventoryData{ REL::ID(952887), REL::ID(467269), REL::ID(1125507), REL::ID(201627), REL::ID(859541), REL::ID(1517939), REL::ID(593811), REL::ID(1251896), REL::ID(327543), REL::ID(985506), REL::ID(61547) };
+		inline constexpr std::array<REL::ID, 1> PipboyInventoryMenu{ REL::ID(93985) };
+		inline constexpr std::array<REL::ID, 2> PipboyLogData{ REL::ID(990791), REL::ID(505687) };
+		inline constexpr std::array<REL::ID, 1> PipboyLogData__PopulateStatsVisitor{ REL::ID(552565) };
+		inline constexpr std::array<REL::ID, 1> PipboyLogMenu{ REL::ID(1413068) };
+		inline constexpr std::array<REL::ID, 2> PipboyManager{ REL::ID(837476), REL::ID(1495902) };
+		inline constexpr std::array<REL::ID, 11> PipboyMapData{ REL::ID(1465160), REL::ID(979483), REL::ID(55435), REL::ID(714094), REL::ID(1371519), REL::ID(447383), REL::ID(1105745), REL::ID(181843), REL::ID(839780), REL::ID(1498275), REL::ID(573904) };
+		inline constexpr std::array<REL::ID, 1> PipboyMapMenu{ REL::ID(1086897) };
+		inline constexpr std::array<REL::ID, 4> PipboyMenu{ REL::ID(5497), REL::ID(85678), REL::ID(697550), REL::ID(1355021) };
+		inline constexpr std::array<REL::ID, 1> PipboyObject{ REL::ID(173487) };
+		inline constexpr std::array<REL::ID, 2> PipboyOpeningSequenceMenu{ REL::ID(42347), REL::ID(122013) };
+		inline constexpr std::array<REL::ID, 2> PipboyPerksData{ REL::ID(112865), REL::ID(1209980) };
+		inline constexpr std::array<REL::ID, 1> PipboyPerksMenu{ REL::ID(82634) };
+		inline constexpr std::array<REL::ID, 14> PipboyPlayerInfoData{ REL::ID(463388), REL::ID(1560861), REL::ID(636654), REL::ID(1294508), REL::ID(370394), REL::ID(1028477), REL::ID(104525), REL::ID(762833), REL::ID(1420481), REL::ID(496505), REL::ID(1154684), REL::ID(230722), REL::ID(888725), REL::ID(1546962) };
+		inline constexpr std::array<REL::ID, 1> PipboyPlayerInfoMenu{ REL::ID(466048) };
+		inline constexpr std::array<REL::ID, 2> PipboyPrimitiveThrottledValue_bool_{ REL::ID(60838), REL::ID(13821) };
+		inline constexpr std::array<REL::ID, 2> PipboyPrimitiveThrottledValue_float_{ REL::ID(858861), REL::ID(812413) };
+		inline constexpr std::array<REL::ID, 2> PipboyPrimitiveThrottledValue_unsignedchar_{ REL::ID(1251213), REL::ID(1204603) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_BGSLocalizedString_{ REL::ID(1119447) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_BSFixedStringCS_{ REL::ID(1186049) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_BSFixedString_{ REL::ID(444345) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_BSStringT_char_1_DynamicMemoryManagementPol__{ REL::ID(1166197) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_bool_{ REL::ID(1139281) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_char_{ REL::ID(510367) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_float_{ REL::ID(999262) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_int_{ REL::ID(1092699) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_unsignedchar_{ REL::ID(1072833) };
+		inline constexpr std::array<REL::ID, 1> PipboyPrimitiveValue_unsignedint_{ REL::ID(1046100) };
+		inline constexpr std::array<REL::ID, 3> PipboyQuestData{ REL::ID(397899), REL::ID(1495227), REL::ID(570909) };
+		inline constexpr std::array<REL::ID, 1> PipboyQuestMenu{ REL::ID(680791) };
+		inline constexpr std::array<REL::ID, 3> PipboyRadioData{ REL::ID(60104), REL::ID(1157093), REL::ID(233046) };
+		inline constexpr std::array<REL::ID, 1> PipboyRadioMenu{ REL::ID(307277) };
+		inline constexpr std::array<REL::ID, 2> PipboySpecialData{ REL::ID(1379233), REL::ID(894172) };
+		inline constexpr std::array<REL::ID, 1> PipboySpecialMenu{ REL::ID(1316205) };
+		inline constexpr std::array<REL::ID, 7> PipboyStatsData{ REL::ID(1272514), REL::ID(787314), REL::ID(1445193), REL::ID(521132), REL::ID(1179205), REL::ID(255136), REL::ID(913215) };
+		inline constexpr std::array<REL::ID, 1> PipboyStatsMenu{ REL::ID(1475587) };
+		inline constexpr std::array<REL::ID, 8> PipboyStatusData{ REL::ID(367355), REL::ID(1464474), REL::ID(540364), REL::ID(1198487), REL::ID(274237), REL::ID(932254), REL::ID(7651), REL::ID(666556) };
+		inline constexpr std::array<REL::ID, 1> PipboySubMenu{ REL::ID(836343) };
+		inline constexpr std::array<REL::ID, 1> PipboyValue{ REL::ID(871785) };
+		inline constexpr std::array<REL::ID, 3> PipboyWorkshopData{ REL::ID(592408), REL::ID(106873), REL::ID(765149) };
+		inline constexpr std::array<REL::ID, 1> PipboyWorkshopMenu{ REL::ID(117692) };
+		inline constexpr std::array<REL::ID, 1> PitchOverrideEndHandler{ REL::ID(232467) };
+		inline constexpr std::array<REL::ID, 1> PitchOverrideStartHandler{ REL::ID(1156512) };
+		inline constexpr std::array<REL::ID, 3> PlayBinkMenu{ REL::ID(24096), REL::ID(104057), REL::ID(715926) };
+		inline constexpr std::array<REL::ID, 1> PlayerBedEnterHandler{ REL::ID(707499) };
+		inline constexpr std::array<REL::ID, 5> PlayerCamera{ REL::ID(474615), REL::ID(1571826), REL::ID(427870), REL::ID(1086167), REL::ID(162204) };
+		inline constexpr std::array<REL::ID, 1> PlayerCameraTransitionState{ REL::ID(526779) };
+		inline constexpr std::array<REL::ID, 1> PlayerChairEnterHandler{ REL::ID(314920) };
+		inline constexpr std::array<REL::ID, 24> PlayerCharacter{ REL::ID(1400465), REL::ID(226716), REL::ID(884677), REL::ID(1542933), REL::ID(618796), REL::ID(1276847), REL::ID(870759), REL::ID(385483), REL::ID(1435647), REL::ID(1342378), REL::ID(624217), REL::ID(1282138), REL::ID(357885), REL::ID(1016105), REL::ID(92071), REL::ID(750458), REL::ID(1408054), REL::ID(484126), REL::ID(1142245), REL::ID(218262), REL::ID(876165), REL::ID(1534607), REL::ID(610436), REL::ID(1488087) };
+		inline constexpr std::array<REL::ID, 1> PlayerControllerXSmoothedChannel_Actor_float_{ REL::ID(542894) };
+		inline constexpr std::array<REL::ID, 1> PlayerControllerYSmoothedChannel_Actor_float_{ REL::ID(1466918) };
+		inline constexpr std::array<REL::ID, 7> PlayerControls{ REL::ID(1410640), REL::ID(267421), REL::ID(925390), REL::ID(752), REL::ID(659755), REL::ID(1317482), REL::ID(393346) };
+		inline constexpr std::array<REL::ID, 1> PlayerFastEquipSoundHandler{ REL::ID(177573) };
+		inline constexpr std::array<REL::ID, 1> PlayerFirstSpeedSmoothedChannel_Actor_float_{ REL::ID(1074631) };
+		inline constexpr std::array<REL::ID, 1> PlayerFurnitureExitHandler{ REL::ID(1099241) };
+		inline constexpr std::array<REL::ID, 1> PlayerInputHandler{ REL::ID(673517) };
+		inline constexpr std::array<REL::ID, 1> PlayerPitchDeltaSmoothedChannel_Actor_float_{ REL::ID(808829) };
+		inline constexpr std::array<REL::ID, 2> PlayerRegionState{ REL::ID(466436), REL::ID(1124707) };
+		inline constexpr std::array<REL::ID, 1> PlayerSightedStateChangeHandler{ REL::ID(1016529) };
+		inline constexpr std::array<REL::ID, 5> PlayerSleepWaitMovementControllerAdapter{ REL::ID(1448504), REL::ID(524333), REL::ID(1182446), REL::ID(258308), REL::ID(916355) };
+		inline constexpr std::array<REL::ID, 1> PlayerSleepWaitMovementControllerAdapter__SwitchToLoadedSetControllerFunctor{ REL::ID(351415) };
+		inline constexpr std::array<REL::ID, 1> PlayerSleepWaitMovementControllerAdapter__SwitchToUnloadedSetControllerFunctor{ REL::ID(790525) };
+		inline constexpr std::array<REL::ID, 1> PlayerSneakStateChangeHandler{ REL::ID(1002716) };
+		inline constexpr std::array<REL::ID, 1> PlayerTerminalEnterHandler{ REL::ID(972864) };
+		inline constexpr std::array<REL::ID, 1> PointerArrayImplementation{ REL::ID(1089902) };
+		inline constexpr std::array<REL::ID, 3> PowerArmorGeometry{ REL::ID(198383), REL::ID(11183), REL::ID(670064) };
+		inline constexpr std::array<REL::ID, 2> PowerArmorHUDCompass{ REL::ID(1229954), REL::ID(259080) };
+		inline constexpr std::array<REL::ID, 3> PowerArmorHUDMenu{ REL::ID(1009779), REL::ID(1089392), REL::ID(118636) };
+		inline constexpr std::array<REL::ID, 1> PowerArmorHUDUtils__MainStatusHandler{ REL::ID(74449) };
+		inline constexpr std::array<REL::ID, 2> PowerArmorModMenu{ REL::ID(781497), REL::ID(754051) };
+		inline constexpr std::array<REL::ID, 3> PowerArmor__EventHandler{ REL::ID(1550050), REL::ID(626023), REL::ID(1283934) };
+		inline constexpr std::array<REL::ID, 1> Precipitation{ REL::ID(1011018) };
+		inline constexpr std::array<REL::ID, 1> PreloadResponsesInitializationPolicy_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ REL::ID(964101) };
+		inline constexpr std::array<REL::ID, 1> ProcessListMovementInterface{ REL::ID(921435) };
+		inline constexpr std::array<REL::ID, 1> ProcessLists{ REL::ID(1042219) };
+		inline constexpr std::array<REL::ID, 1> ProcessLists__GetActorsFilter{ REL::ID(763040) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjects{ REL::ID(1304711), REL::ID(380612) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjects1{ REL::ID(773052), REL::ID(1430713) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjects2{ REL::ID(506803), REL::ID(1164981) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjects3{ REL::ID(240829), REL::ID(898947) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjects4{ REL::ID(1557225), REL::ID(633124) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjectsDecals{ REL::ID(759307), REL::ID(1416984) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjectsDetached{ REL::ID(1038701), REL::ID(114596) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjectsGrass{ REL::ID(1024900), REL::ID(100933) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjectsLOD{ REL::ID(1291069), REL::ID(366850) };
+		inline constexpr std::array<REL::ID, 2> ProcessObjectsLocal{ REL::ID(399670), REL::ID(1057821) };
+		inline constexpr std::array<REL::ID, 2> ProcessWeaponStrikeMagicFunctor{ REL::ID(206322), REL::ID(864163) };
+		inline constexpr std::array<REL::ID, 8> Projectile{ REL::ID(762939), REL::ID(101579), REL::ID(759917), REL::ID(1417593), REL::ID(493545), REL::ID(1370944), REL::ID(965259), REL::ID(479875) };
+		inline constexpr std::array<REL::ID, 1> ProjectileLOSCollector{ REL::ID(871876) };
+		inline constexpr std::array<REL::ID, 3> PromptMenu{ REL::ID(567383), REL::ID(646962), REL::ID(1258343) };
+		inline constexpr std::array<REL::ID, 1> PromptMenuData{ REL::ID(334141) };
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> QuestPathingRequest{ REL::ID(839828) };
+		inline constexpr std::array<REL::ID, 2> QueuedActor{ REL::ID(1387279), REL::ID(1420111) };
+		inline constexpr std::array<REL::ID, 2> QueuedAnimationObject{ REL::ID(738062), REL::ID(1475676) };
+		inline constexpr std::array<REL::ID, 2> QueuedCharacter{ REL::ID(934934), REL::ID(967759) };
+		inline constexpr std::array<REL::ID, 1> QueuedFile{ REL::ID(308211) };
+		inline constexpr std::array<REL::ID, 1> QueuedHead{ REL::ID(271617) };
+		inline constexpr std::array<REL::ID, 2> QueuedModel{ REL::ID(937936), REL::ID(93403) };
+		inline constexpr std::array<REL::ID, 1> QueuedNamedFile{ REL::ID(215166) };
+		inline constexpr std::array<REL::ID, 2> QueuedPlayer{ REL::ID(1359714), REL::ID(1392589) };
+		inline constexpr std::array<REL::ID, 1> QueuedPromoteLargeReferencesTask{ REL::ID(130311) };
+		inline constexpr std::array<REL::ID, 1> QueuedPromoteLocationReferencesTask{ REL::ID(897837) };
+		inline constexpr std::array<REL::ID, 1> QueuedPromoteQuestTask{ REL::ID(478841) };
+		inline constexpr std::array<REL::ID, 1> QueuedPromoteReferencesTask{ REL::ID(958258) };
+		inline constexpr std::array<REL::ID, 2> QueuedReference{ REL::ID(1190288), REL::ID(1223362) };
+		inline constexpr std::array<REL::ID, 2> QueuedTree{ REL::ID(257756), REL::ID(290434) };
+		inline constexpr std::array<REL::ID, 1> QuickSaveLoadHandler{ REL::ID(371072) };
+	}
+}
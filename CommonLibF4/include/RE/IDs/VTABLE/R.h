@@ -0,0 +1,50 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__ConcreteEventCallbackFactory_TerminalRunResultsCallback_{ REL::ID(384615) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__ConcreteEventCallbackFactory___SceneActionResultsCallBack_{ REL::ID(969337) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__ConcreteEventCallbackFactory___ScenePhaseResultsCallBack_{ REL::ID(1081768) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__ConcreteEventCallbackFactory___SceneResultsCallBack_{ REL::ID(673934) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__ConcreteEventCallbackFactory___StageItemFinishedCallback_{ REL::ID(922942) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__ConcreteEventCallbackFactory___TopicResultCallBack_{ REL::ID(263579) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__IEventCallback{ REL::ID(233224) };
+		inline constexpr std::array<REL::ID, 1> REFREventCallbacks__IEventCallbackFactory{ REL::ID(1549467) };
+		inline constexpr std::array<REL::ID, 1> RagdollAndGetUpHandler{ REL::ID(652195) };
+		inline constexpr std::array<REL::ID, 1> RagdollFurnitureModifier{ REL::ID(153657) };
+		inline constexpr std::array<REL::ID, 1> RagdollStartHandler{ REL::ID(259875) };
+		inline constexpr std::array<REL::ID, 1> RallyEffect{ REL::ID(750267) };
+		inline constexpr std::array<REL::ID, 1> ReadyStateChangeHandler{ REL::ID(610875) };
+		inline constexpr std::array<REL::ID, 1> ReadyWeaponHandler{ REL::ID(549666) };
+		inline constexpr std::array<REL::ID, 1> RealArrayImplementation{ REL::ID(799686) };
+		inline constexpr std::array<REL::ID, 1> RealArrayView{ REL::ID(81020) };
+		inline constexpr std::array<REL::ID, 1> ReanimateEffect{ REL::ID(762338) };
+		inline constexpr std::array<REL::ID, 1> RecoilStopHandler{ REL::ID(202680) };
+		inline constexpr std::array<REL::ID, 1> ReevaluateGraphStateHandler{ REL::ID(737207) };
+		inline constexpr std::array<REL::ID, 1> RefAttachTechniqueInput{ REL::ID(375127) };
+		inline constexpr std::array<REL::ID, 1> RefHandleUIData{ REL::ID(866370) };
+		inline constexpr std::array<REL::ID, 1> RefMatchFunctor{ REL::ID(1396133) };
+		inline constexpr std::array<REL::ID, 1> ReferenceEffect{ REL::ID(562029) };
+		inline constexpr std::array<REL::ID, 1> ReferenceEffectController{ REL::ID(946088) };
+		inline constexpr std::array<REL::ID, 1> RefrInteraction{ REL::ID(768065) };
+		inline constexpr std::array<REL::ID, 1> RegSettingCollection{ REL::ID(747680) };
+		inline constexpr std::array<REL::ID, 1> RelaxedStateChangeHandler{ REL::ID(876602) };
+		inline constexpr std::array<REL::ID, 1> ReloadCompleteHandler{ REL::ID(1282577) };
+		inline constexpr std::array<REL::ID, 1> ReloadStateChangeHandler{ REL::ID(624685) };
+		inline constexpr std::array<REL::ID, 1> RemoveCustomMapMarkerCommand{ REL::ID(32378) };
+		inline constexpr std::array<REL::ID, 1> RemoveExtraFunctor{ REL::ID(1218504) };
+		inline constexpr std::array<REL::ID, 1> RemoveFavoriteFunctor{ REL::ID(1503701) };
+		inline constexpr std::array<REL::ID, 1> RemoveOutfitItemsFunctor{ REL::ID(142867) };
+		inline constexpr std::array<REL::ID, 1> RemoveQuestAliasFunctor{ REL::ID(471975) };
+		inline constexpr std::array<REL::ID, 1> RemoveRagdollHandler{ REL::ID(1184064) };
+		inline constexpr std::array<REL::ID, 1> Reset3DMobIterator{ REL::ID(1152890) };
+		inline constexpr std::array<REL::ID, 1> ResponseDefinitionMissPolicy_BSTSmartPointer_BSResponse_BSFixedString_Actor_BSFixedString_DoNothingUnhandledPolicy__BSTSmartPointerIntrusiveRefCount__BSFixedString_{ REL::ID(525438) };
+		inline constexpr std::array<REL::ID, 1> RevertSelectedSpellFunctor{ REL::ID(952584) };
+		inline constexpr std::array<REL::ID, 1> RightHandSpellCastHandler{ REL::ID(328645) };
+		inline constexpr std::array<REL::ID, 1> RightHandSpellFireHandler{ REL::ID(1519021) };
+		inline constexpr std::array<REL::ID, 3> RobotModMenu{ REL::ID(1057885), REL::ID(1030329), REL::ID(59652) };
+		inline constexpr std::array<REL::ID, 1> RunHandler{ REL::ID(1319787) };
+	}
+}
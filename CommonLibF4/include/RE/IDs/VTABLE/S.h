@@ -0,0 +1,414 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> SFRenderBufferManager{ REL::ID(1023105) };
+		inline constexpr std::array<REL::ID, 2> SPECIALMenu{ REL::ID(1214229), REL::ID(1293406) };
+		inline constexpr std::array<REL::ID, 1> SWFToCodeFunctionHandler{ REL::ID(1212829) };
+		inline constexpr std::array<REL::ID, 2> SafeZoneMenu{ REL::ID(1221429), REL::ID(1300567) };
+		inline constexpr std::array<REL::ID, 1> SandManKillHandler{ REL::ID(51153) };
+		inline constexpr std::array<REL::ID, 1> SaveGameMagicCasterVisitor{ REL::ID(1218844) };
+		inline constexpr std::array<REL::ID, 1> SaveLoadMagicCasterVisitor{ REL::ID(560572) };
+		inline constexpr std::array<REL::ID, 1> SaveStorageWrapper{ REL::ID(625924) };
+		inline constexpr std::array<REL::ID, 1> ScaleformFile__MemoryFile{ REL::ID(1301833) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__AcquireInterface{ REL::ID(584335) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__File{ REL::ID(1063406) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__FileOpener{ REL::ID(517724) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__FileOpenerBase{ REL::ID(1002905) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__FunctionHandler{ REL::ID(554620) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__State{ REL::ID(866068) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__Translator{ REL::ID(1304881) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__Value__ObjectInterface__ArrVisitor{ REL::ID(295260) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__ZlibSupport{ REL::ID(334259) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__GFx__ZlibSupportBase{ REL::ID(1038874) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Log{ REL::ID(1351370) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__MemoryFile{ REL::ID(1142902) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBaseStatImpl_Scaleform__RefCountImpl_2_{ REL::ID(1259270) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBaseStatImpl_Scaleform__RefCountVImpl_3_{ REL::ID(1363070) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBaseV_Scaleform__Render__Image_3_{ REL::ID(658933) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBase_Scaleform__File_2_{ REL::ID(405243) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBase_Scaleform__GFx__FunctionHandler_2_{ REL::ID(115651) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBase_Scaleform__GFx__State_2_{ REL::ID(427310) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountBase_Scaleform__Log_2_{ REL::ID(912873) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountImpl{ REL::ID(820482) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountImplCore{ REL::ID(381601) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__RefCountVImpl{ REL::ID(485872) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__D3D1x__MappedTexture{ REL::ID(965752) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__D3D1x__RenderTargetData{ REL::ID(261023) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__Image{ REL::ID(1223737) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__ImageBase{ REL::ID(173502) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__MappedTextureBase{ REL::ID(1231939) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__RenderBuffer__RenderTargetData{ REL::ID(527179) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__Render__TextureImage{ REL::ID(1036866) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__SysAlloc{ REL::ID(724362) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__SysAllocBase{ REL::ID(1428561) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__SysAllocBase_SingletonSupport_Scaleform__SysAllocMalloc_Scaleform__SysAlloc_{ REL::ID(677732) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__SysAllocMalloc{ REL::ID(631016) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__SysAllocPaged{ REL::ID(614124) };
+		inline constexpr std::array<REL::ID, 1> Scaleform__SysMemMapper{ REL::ID(959483) };
+		inline constexpr std::array<REL::ID, 1> SceneGraph{ REL::ID(960007) };
+		inline constexpr std::array<REL::ID, 2> ScopeMenu{ REL::ID(191529), REL::ID(270840) };
+		inline constexpr std::array<REL::ID, 1> ScopeMenuUtil__FadeCallback{ REL::ID(882142) };
+		inline constexpr std::array<REL::ID, 1> ScrapHeap{ REL::ID(1084382) };
+		inline constexpr std::array<REL::ID, 1> ScreenshotHandler{ REL::ID(1341710) };
+		inline constexpr std::array<REL::ID, 1> Script{ REL::ID(20936) };
+		inline constexpr std::array<REL::ID, 1> ScriptEffect{ REL::ID(227210) };
+		inline constexpr std::array<REL::ID, 1> Script__ModifyFaceGen__29__ReplaceHeadTask{ REL::ID(121130) };
+		inline constexpr std::array<REL::ID, 1> Script__ResetDialogueFlags__2__MobDialogueFlagResetter{ REL::ID(1498167) };
+		inline constexpr std::array<REL::ID, 1> ScriptedRefEffect{ REL::ID(40374) };
+		inline constexpr std::array<REL::ID, 12> ScrollItem{ REL::ID(1362474), REL::ID(696647), REL::ID(1307677), REL::ID(117544), REL::ID(1214775), REL::ID(243780), REL::ID(855215), REL::ID(1027839), REL::ID(495885), REL::ID(668979), REL::ID(841540), REL::ID(1014116) };
+		inline constexpr std::array<REL::ID, 1> SeenData{ REL::ID(526722) };
+		inline constexpr std::array<REL::ID, 1> SetCustomMapMarkerCommand{ REL::ID(1334995) };
+		inline constexpr std::array<REL::ID, 1> SetEnchantmentFunctor{ REL::ID(798785) };
+		inline constexpr std::array<REL::ID, 1> SetFavoriteFunctor{ REL::ID(1064496) };
+		inline constexpr std::array<REL::ID, 1> SetItemOriginalReferenceFunctor{ REL::ID(159719) };
+		inline constexpr std::array<REL::ID, 1> SetItemOwnershipFunctor{ REL::ID(1302935) };
+		inline constexpr std::array<REL::ID, 1> SetPlayerHasTakenStackFunctor{ REL::ID(779682) };
+		inline constexpr std::array<REL::ID, 1> SetPoisonFunctor{ REL::ID(359705) };
+		inline constexpr std::array<REL::ID, 1> SetQuickkeyCommand{ REL::ID(1055424) };
+		inline constexpr std::array<REL::ID, 1> SetTimeLeftFunctor{ REL::ID(911018) };
+		inline constexpr std::array<REL::ID, 1> Setting{ REL::ID(1303484) };
+		inline constexpr std::array<REL::ID, 1> SettingCollectionList_Setting_{ REL::ID(1429486) };
+		inline constexpr std::array<REL::ID, 1> SettingCollectionMap_Setting_{ REL::ID(1149801) };
+		inline constexpr std::array<REL::ID, 1> SettingCollection_Setting_{ REL::ID(379406) };
+		inline constexpr std::array<REL::ID, 1> SettingT_GameSettingCollection_{ REL::ID(85999) };
+		inline constexpr std::array<REL::ID, 1> SettingT_INIPrefSettingCollection_{ REL::ID(553805) };
+		inline constexpr std::array<REL::ID, 1> SettingT_INISettingCollection_{ REL::ID(744301) };
+		inline constexpr std::array<REL::ID, 1> SettingT_RegSettingCollection_{ REL::ID(1555607) };
+		inline constexpr std::array<REL::ID, 1> ShaderReferenceEffect{ REL::ID(718224) };
+		inline constexpr std::array<REL::ID, 1> ShadowSceneNode{ REL::ID(646535) };
+		inline constexpr std::array<REL::ID, 1> SightedStateChangeHandler{ REL::ID(358341) };
+		inline constexpr std::array<REL::ID, 1> SimpleAnimationGraphManagerHolder{ REL::ID(1057733) };
+		inline constexpr std::array<REL::ID, 2> SimpleAnimationGraphManagerLoadingTask{ REL::ID(871177), REL::ID(26266) };
+		inline constexpr std::array<REL::ID, 2> SitWaitMenu{ REL::ID(50004), REL::ID(129623) };
+		inline constexpr std::array<REL::ID, 1> Sky{ REL::ID(12448) };
+		inline constexpr std::array<REL::ID, 1> SkyEffectController{ REL::ID(26205) };
+		inline constexpr std::array<REL::ID, 1> SkyObject{ REL::ID(914854) };
+		inline constexpr std::array<REL::ID, 1> SkyStaticFindFunctor{ REL::ID(881945) };
+		inline constexpr std::array<REL::ID, 3> SleepWaitMenu{ REL::ID(461037), REL::ID(541080), REL::ID(1152315) };
+		inline constexpr std::array<REL::ID, 2> SlowTimeEffect{ REL::ID(1554227), REL::ID(1367262) };
+		inline constexpr std::array<REL::ID, 1> SneakHandler{ REL::ID(695055) };
+		inline constexpr std::array<REL::ID, 1> SneakStateChangeHandler{ REL::ID(344650) };
+		inline constexpr std::array<REL::ID, 1> SortInventoryCommand{ REL::ID(775972) };
+		inline constexpr std::array<REL::ID, 1> SoulTrapEffect{ REL::ID(382951) };
+		inline constexpr std::array<REL::ID, 1> SpawnHazardEffect{ REL::ID(200433) };
+		inline constexpr std::array<REL::ID, 1> SpecificItemCollector{ REL::ID(336946) };
+		inline constexpr std::array<REL::ID, 1> SpectatorPackage{ REL::ID(1099949) };
+		inline constexpr std::array<REL::ID, 1> SpeedSampledAnimationSpeedContour{ REL::ID(8202) };
+		inline constexpr std::array<REL::ID, 7> SpellItem{ REL::ID(814119), REL::ID(147529), REL::ID(759227), REL::ID(1151002), REL::ID(665952), REL::ID(1277240), REL::ID(306369) };
+		inline constexpr std::array<REL::ID, 1> SprintHandler{ REL::ID(1095200) };
+		inline constexpr std::array<REL::ID, 1> StaggerEffect{ REL::ID(182986) };
+		inline constexpr std::array<REL::ID, 1> StaggeredStopHandler{ REL::ID(581064) };
+		inline constexpr std::array<REL::ID, 1> Stars{ REL::ID(868031) };
+		inline constexpr std::array<REL::ID, 1> StartFloatingHandler{ REL::ID(1170262) };
+		inline constexpr std::array<REL::ID, 2> StartMenuBase{ REL::ID(985986), REL::ID(360794) };
+		inline constexpr std::array<REL::ID, 1> StartPCapVoiceHandler{ REL::ID(317227) };
+		inline constexpr std::array<REL::ID, 2> StaticAvoidNodeManager{ REL::ID(1465319), REL::ID(979626) };
+		inline constexpr std::array<REL::ID, 1> StimpakEffect{ REL::ID(1565062) };
+		inline constexpr std::array<REL::ID, 1> StopFloatingHandler{ REL::ID(246207) };
+		inline constexpr std::array<REL::ID, 1> StopMountCameraHandler{ REL::ID(931723) };
+		inline constexpr std::array<REL::ID, 2> StreamingInstallMenu{ REL::ID(952659), REL::ID(1031961) };
+		inline constexpr std::array<REL::ID, 1> StructArrayImplementation{ REL::ID(1086929) };
+		inline constexpr std::array<REL::ID, 1> StructArrayImplementation__Object{ REL::ID(662192) };
+		inline constexpr std::array<REL::ID, 1> SubgraphAndOffsetDBData{ REL::ID(1315575) };
+		inline constexpr std::array<REL::ID, 1> SummonCreatureEffect{ REL::ID(566659) };
+		inline constexpr std::array<REL::ID, 3> SummonPlacementEffect{ REL::ID(818850), REL::ID(352383), REL::ID(166176) };
+		inline constexpr std::array<REL::ID, 1> Sun{ REL::ID(70374) };
+		inline constexpr std::array<REL::ID, 1> SyncDeferDeathHandler{ REL::ID(443108) };
+		inline constexpr std::array<REL::ID, 1> SyncEarlyExitHandler{ REL::ID(1101546) };
+		inline constexpr std::array<REL::ID, 1> SyncQueueObj{ REL::ID(1472898) };
+		inline constexpr std::array<REL::ID, 1> SynchronizedAnimationSingleton{ REL::ID(501293) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSContainer__ForEachResult_BSFlattenedBoneTreeconst_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(543517) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1102239) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(529384) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(356381) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1336462) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(816667) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSScript__Variable_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(990400) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(551927) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_BSFixedStringconst_BSScript__TypeInfo_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(668050) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(300061) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_BSScript__Objectconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1436537) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_BSScript__Variableconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1335961) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(143576) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(378883) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_bool_bool_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(27613) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1437419) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_float_ActorValueOwnerconst_ActorValueInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(165383) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_Actor_ActorValueInfoconst_float_float_Actor_std___Nil_std___Nil_{ REL::ID(1574951) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(633318) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1153979) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(241606) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(799385) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1299454) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(111492) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1190232) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(981107) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(587285) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1348055) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1326642) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1175546) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(284193) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1362656) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(462709) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1535866) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(760049) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1002604) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1499962) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1017360) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(635979) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(414116) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(808721) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(844721) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1163530) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(897231) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1069831) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_TESObjectREFR_TESObjectREFR_float_GameScript__Internal__DistanceEventData__EventType_std___Nil_std___Nil_{ REL::ID(122778) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_bool_TESObjectREFR_TESObjectREFR_std___Nil_std___Nil_std___Nil_{ REL::ID(686673) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTSmartPointer_GameScript__Internal__HitRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1562486) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTSmartPointer_GameScript__Internal__MagicEffectApplyRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(152889) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_BSTSmartPointer_GameScript__Internal__RadiationDamageRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(325424) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(501563) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_Interface3D__Renderer_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1537104) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(127437) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1123709) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_unsignedchar_unsigned__int64_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(475863) };
+		inline constexpr std::array<REL::ID, 1> std___Func_base_void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(724786) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_bool_const__BSScrapArray_BSScript__Variable___0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(431381) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_float_const__ActorValueOwnerconst_ActorValueInfoconst__0__std__allocator_std___Func_class_float_ActorValueOwnerconst_ActorValueInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___float_ActorValueOwnerconst_ActorValueInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(337946) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__Actor_ActorValueInfoconst_float_float_Actor__0__std__allocator_std___Func_class_void_Actor_ActorValueInfoconst_float_float_Actor_std___Nil_std___Nil___void_Actor_ActorValueInfoconst_float_float_Actor_std___Nil_std___Nil_{ REL::ID(510751) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1220057) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(971804) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(456700) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1047045) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1392291) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(629980) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(528891) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(874170) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_charconst__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1565569) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_fun_void_const__BSPlatform__BNetResult_unsigned__int64_int__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(702000) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript__SingleActorArgument_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(775159) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript__SingleObjectRefrHandleArgument_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1092908) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript__SingleSimpleArgument_bool__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(35300) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript__SingleSimpleArgument_unsignedint__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(747694) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____AnimationEventArguments_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1326586) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1209443) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____KeywordStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1582409) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1409226) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1181779) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1008797) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(345377) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____LocationStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(173002) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__BoolStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(462884) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(317993) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1036376) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(836276) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(117638) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(691320) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1236896) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(863593) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(663700) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1354283) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__BoolStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(290300) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1381804) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1527410) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__FormStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(518290) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1063915) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__LocationStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(891304) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(145194) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____RefStoryEventArgConverter_GameScript__A0xd380b852__UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(490615) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_GameScript____StoryEventArguments_GameScript____UIntStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter_GameScript__A0xd380b852__EmptyStoryEventArgConverter__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1554936) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj___SetPapyrusVarFunctor_0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(258911) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj___TopicInfoEventArguments_0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1265753) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_00842126f1bbffa3508825ec58c727d1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1417365) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0130c5f5b7af476843d91c891c7d41ff__0__std__allocator_std___Func_class_bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1242847) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0334f48246e016c65176d35a1707687d__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSCreationconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(932508) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_054c0f92026acdc3af737f9060c8d16c__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1220534) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_07bd1a2a24b5297104651f958fd07edd__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(559714) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_07eb95b259b64dbe637196df0095a500__0__BSTThreadScrapSTLAllocator_void__bool_BSFixedStringconst_BSScript__TypeInfo_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(840637) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_08aeb2b67f0f6c76e11e7ebc816b65a5__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(912861) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_099db76688b3e7d9a1ba0689b7c86b3f__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(602299) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0b964dbed50845a5b080c9e8b152e95b__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(844819) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0bac696f8a7e0d598f906fcbb5de76d4__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1450928) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0bc23d5b7c7de87ef94325d843ed86e3__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(302501) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0bc91e0ed7f0805edf36c7aa85993e84__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(208515) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0f372fe2caf63a32ad7be51a11219d8b__0__std__allocator_std___Func_class_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(869435) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0fb5607cc13ade26aa5aae69ef117f05__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(359143) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_0fbe6c20cb848d3946f7eb3dad25598a__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(501721) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_10a9a02b0a42abae558918086ec73866__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(920076) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_13e98d26afef434c8bbd209b0a32bf5c__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1267984) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_14bc8f35ebd88d5bb2deba19bd34df54__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Variableconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1332947) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_1591a3a9b6a71b0468163ee32c1d0231__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1027629) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_16114c1d7b79d596669e1fd2b8827eef__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Variableconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1160483) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_184a234d8f4f5896e118ec502d1c0a8a__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(181033) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_193429bc9a476f2b0613b82566cacb70__0__BSTThreadScrapSTLAllocator_void__BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1573498) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_19d063effc045d3b08475b14b55c3c64__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1077747) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_1a447c76d8c737033622fe11b6950011__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1272383) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_1e19f6a5dec586b6dd5a59f75ceb0d67__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(554043) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_1e2e2f3207944ac8aaf62ff35af4ee45__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1047552) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_203712f3aa68aac3e863990ca400c297__0__std__allocator_std___Func_class_bool_bool_bool_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_bool_bool_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1143944) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_20bd48cc4695620b1b9bf55287c67586__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(926750) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2111e863258cf77e7ca2cbf1665b88c4__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(381003) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2836ae453004c671939bf2a4b23d7d4b__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(394528) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_299489c7fc39f925edd3aa5540d66d13__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1186152) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2d6b8ee094eebaded7bb8a988c4d0739__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(604499) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2e9353996ef31dba39c8029ef29317a4__0__std__allocator_std___Func_class_void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(524184) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2f5407eb96d0a1b6dc937f3276f48c32__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(730915) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2f5dbdab527b375862b772755a0f8758__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(754365) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_2f6d6b02ef19c948c746f8b099acb567__0__std__allocator_std___Func_class_void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSTArray_NVFlex__DebrisData_BSTAlignedHeapArrayAllocator_16___Allocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(351278) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_322960b94ee4fd4c4057c4420b7e75cf__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1226595) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_3265f8f8f18f753faed2cfea48d6fee5__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(86214) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_3786e9703307cff26b8fe5f52b4734d0__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1366317) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_37beb9fc3b1b01fd41019e7b60e98c01__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1095173) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_39ffcfa6da85b565c1035d777af94bf4__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1189238) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_3f5623e42efbb25feab69a80646642a1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(192916) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_42508bb0ea655875a10b84da51e7510d__0__BSTThreadScrapSTLAllocator_void__BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(336537) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_443487bcb1670fdeccb22dd4dfbf70cd__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1293146) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_44d85ecd6175de7e9a3f9e6d25689f33__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(429208) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_454aa4e702ce0b6f8956d050711fed66__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(567489) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_4651b87cc57a2dfcf69d0bfe8de014d9__0__BSTThreadScrapSTLAllocator_void__BSScript__Variable_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(642396) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_48efb91e7dd54e8b3938c1e8bc3eccb3__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(749958) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_4af6dde34eba7b7ab79d5897fc243ab8__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1423088) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_4c3a9600039c37368088ffe3a15909dc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1052232) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_4d6e63e22afb2d37e36510106c6a6393__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(879406) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_4ebcbf817bc4f7282d9d2977d2448ad1__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1468344) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_5016f41b4f1d50c8770fe9bb9903028b__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(233959) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_5168267b0012478f3bc13e73ddfdb0ac__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(905039) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_52f4adbee5e1ab1b20c95afc65b99ad1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1285865) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_53c4cd4f81ad9e0ce88b1946a0041bb4__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(56358) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_541a261ee3462efd6bfdb689a437a443__0__std__allocator_std___Func_class_void_Interface3D__Renderer_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_Interface3D__Renderer_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1150063) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_54a6f70cd8572b5a19dc8d526b478c14__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(908101) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_55872eda7971030057a292dfb64e1621__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(538271) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_5b7ab3e59f7cb440b252086626e4a60d__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(574784) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_5e1d78085d6cfb76254daab0334336da__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(532202) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_672a9e28d3924c6c989b92853963f20f__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(229281) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_686312c712459af8e284b8c88446107a__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(41127) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_6b0764d404d008b173edce8b25a702d1__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1017459) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_6bb2d8505908dfefd6dd0fc5fd65a187__0__std__allocator_std___Func_class_void_unsignedchar_unsigned__int64_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil___void_unsignedchar_unsigned__int64_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(648895) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_6ceeec5bb504410218d413efc75d68ec__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_GameScript__Internal__MagicEffectApplyRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1534869) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_6d02d13e57cb3dd99fefd56472403b09__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(481575) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_6d4359260f667c5c02878b9918893e31__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1490499) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_72b2a86752ade662ef1830fca3318a49__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(732683) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_74a5677d8445429941d293114f04ff81__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1120320) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_756bd23804314ebe6f44aa82db90dd5f__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(365221) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_76127435f1e52d9569cb10294889d615__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(96387) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_79fdf6b8350d099fe950940aa51b4afc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(947652) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_7afa60fa4da988fe1a0e7577cf1a647a__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_GameScript__Internal__HitRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1361707) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_7f4e4e03826a9abe37163875e4a1e5f3__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1062250) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_7f629fda89b801fdf6de6977c634dbfe__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(386769) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_8011a55efdca4ad481452747e7562a81__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(404048) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_80a2a17f893f4b761fa7dc30420eeb9f__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_TESObjectREFR_TESObjectREFR_float_GameScript__Internal__DistanceEventData__EventType_std___Nil_std___Nil_{ REL::ID(1345562) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_80b87164bd1b94025f86a68b48297b2e__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(58575) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_837b3483dbbb15d73d817d68e2c44104__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1438342) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_8698aa507c43b9faeedde86dfe883944__0__BSTThreadScrapSTLAllocator_void__void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1295305) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_88f19725b3d7fe760b64ee2fd2821de0__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(353473) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_898abd2961a84fe7b4220d0b27c32717__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_GameScript__Internal__RadiationDamageRegistrationList_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(125237) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_8e243b3fe42ff88cc62e562568eaa66a__0__std__allocator_std___Func_class_BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(5285) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_8ecb0e8b234fd35dc5ae505953507ccb__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1566080) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_929d9fe29ecc0b2964e28461ef73ac26__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(674844) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_92df1e715e43ea341101b09934dbe1ee__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1244973) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_95c1f664d5de6418541cd3f8f73d60d6__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Objectconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1013183) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_95c29fd74c394f17289570afade20edc__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(740403) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_95f5adb313c553bd8033fb5afcf6ba4d__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(214254) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_9656ec2329d67b8d2c13d09269547511__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1019937) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_99b9e662d59d0132ee41231142149a68__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridConnectionconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(329018) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_9ef11ac1dee46003826067c89d8a3943__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(231525) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a268fc89d69badc06903122c3b3c0c5c__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(922319) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a3113fde1043ec947d3abfa6f74f6964__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(156420) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a3690e0998d05cccf6e570d26a24dd84__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1518743) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a448cbea5ffdafd16e8859655e50e0dd__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(987440) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a48f425a71cf820f5ea84b6e8daacfed__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1105290) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a4dff8aef94e3969d67ebf3e1c581996__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(705284) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a7f34831f1a4f8719fb3c49ce8627133__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1445070) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a83b60c3ea7bc1c3fbb195647ef164f0__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1317312) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_a9ebd384ee3271b6300721ad3ed6fe19__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(877436) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_aa508c0490b5d03f84e8df305b079f1d__0__BSTThreadScrapSTLAllocator_void__bool_BSScript__Objectconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(26767) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ac270bf75cbdbacc5d93f5465f5a2a6f__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1250734) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ac92e720bdcfda16adb3c5b4c31a2c2a__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1053640) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ad0c2d3e69eab858a59adca35b18951f__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1458685) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ad2bacf630a3b2a6c2dc56862e4d85e3__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(874660) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b0b33eca7979a6f6d3ed98d2584a8a39__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1440557) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b16391e4ab5327cbdd6c720c787ed6c8__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(865099) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b1f3e94a04102192b8a81cc79fdbb6e3__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(625956) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b39e63306dfe21c8d851a1aba608fa50__0__BSTThreadScrapSTLAllocator_void__BSScript__Variable_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1506266) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b3fc61b57caa2aa63196986f3e8b20fc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1016365) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b71d28fc0f58e163d52c746c9185a6bc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1144816) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_b868380e375d6a4b1a942c4a999c5d04__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1472501) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ba8546611bc871ec2a1ca3d14ab7b49a__0__BSTThreadScrapSTLAllocator_void__bool_BSFixedStringconst_BSScript__TypeInfo_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(163902) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ba86ef1f92ecd3d9fd739fbaa19fede0__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1099655) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ba9be308207c335d9f716b9c88a731e2__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(777433) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_bddc1f6b336f2334d7039c97ed3d6e9e__0__std__allocator_std___Func_class_void_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1322755) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_beab74417d22838e239406c4ea06bfd4__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(30790) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c09462a993663a6ec15d796cbad3f6bb__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(843730) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c0f98d04dfd33769154d1d2c08802bf4__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(452750) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c295031e45e4f267597ff5b253b39cd7__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(815036) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c29ad068b1cc55bbae20d4bf0f356e1f__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(847190) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c385c76f111362317b339a3f01aaffac__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1085557) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c4414c9f09a420b122d91443b1d39733__0__std__allocator_std___Func_class_void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(80718) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c442c15a60c255d7a2bd9f9d1c05158d__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(726943) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c4dfd8b813eb5a6fb55e5f83560882ce__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(200150) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c72710460c20a20e886a07d860aed384__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(401753) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_c917cf2a8d406fbb5d624e085c76a3e1__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1144599) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_caa16e10f5f5a8eb09eef71dab7d9225__0__std__allocator_std___Func_class_bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_NVFlex__DebrisInstanceNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1415193) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_cb557151c02e694f8fbfcbca8873445d__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(221960) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_cc5f5a556d6959c44540ecb786b50983__0__std__allocator_std___Func_class_BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSShaderProperty__RenderPassArray_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(178854) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ce7b2ef8d4e279bcf8c6300eb2f2a029__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(475273) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_d0a2a575e716eb88f726263bec9b909f__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSCreation_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1050267) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_d254e71fa71d5b987fec9a73c37299ca__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(798721) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_d2f89bfdd29a4ce6fb98ac28cd2146fe__0__BSTThreadScrapSTLAllocator_void__void_BSScript__Variable_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(269285) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_d628282d615ee146795c281527b66ba1__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(949923) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_d63480f72a49d2082d1e27bc3155bb9a__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSExternalServerStatusInfoconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(62693) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_d82ec403d6fa397ed31c217cc4b28817__0__BSTThreadScrapSTLAllocator_void__void_ExtraDataList_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(48977) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_de53ae0526549b9b00c33bdb878e18ca__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(526387) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_de5fa4cfc080620cf719239da513c45b__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1496009) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_df3f751e4063cc55eb9b1b40f2ea0816__0__std__allocator_std___Func_class_BSContainer__ForEachResult_BSFlattenedBoneTreeconst_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_BSFlattenedBoneTreeconst_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1154718) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_e0e0472162cfbe6e8d034c0e6eba28aa__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1392771) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_e3889e3fd67be681b38effba84b8c044__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_int_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1278089) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_e6a7dd0792c8290a0b473794b0ea4e78__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1122533) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ea9bd93468855e8c3ccd3d77bfacfc33__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(735617) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_eaa26a7cf0e1aafa2e7090d8055fcbbc__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1466055) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ebb4163806b7c3891829b7867c6fae15__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(7511) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ebeec7fcb09a1d6d16a3aa7dfd103a48__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(899354) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ec6ecb629c93fc27821aca8c19ff1dfa__0__BSTThreadScrapSTLAllocator_void__void_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_bool_TESObjectREFR_TESObjectREFR_std___Nil_std___Nil_std___Nil_{ REL::ID(61037) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_eccc8916bf1950f378565b7cb531f575__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1072008) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_ed11d247ed2a6d04fca7da0c6a8f81a7__0__std__allocator_std___Func_class_bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___bool_float_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(971123) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_eea0087e1385ac4b24f4c057e5d66995__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_unsignedint_float_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(576994) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_f0b55f18912cae1fd1caa24112611e2d__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(186803) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_f3f42e8ea05bba59e9218dd3bb61c98d__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(654686) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_f84b8c60e39bd2e01c8ba533b9b1d54f__0__std__allocator_std___Func_class_BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___BSContainer__ForEachResult_PowerUtils__GridAdjacencyMapNode_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(702494) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_f95be250e8271d8ad375030edbfb2dd7__0__BSTThreadScrapSTLAllocator_void__BSContainer__ForEachResult_BSScript__Object_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1274987) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_fad6a62dfe7fdb293fc18fb1b8f8cdfb__0__BSTThreadScrapSTLAllocator_void__void_BSFixedString_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(806079) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_fb41d256e3f31cb3f14a0df8a346ce0c__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(111489) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_fc0b1edd0e44b87ee8f7b83612f47a7d__0__std__allocator_std___Func_class_void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_unsignedint_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(697345) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_fde5815b1f49c19cc09e8cd360ecf410__0__BSTThreadScrapSTLAllocator_void__bool_BSTSmartPointer_BSScript__Object_BSTSmartPointerIntrusiveRefCount_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(129845) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj__lambda_fe01bf3e01c516b8dcf06685b35eeaa0__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_unsignedint_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(13360) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_0_void__lambda_ffd3f5230f1f91b6b2078decebfc8bd4__std___Ph_1__TESObjectREFRconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__BSTThreadScrapSTLAllocator_void__bool_BSScrapArray_BSScript__Variable__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1539475) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult__void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(1521220) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator___void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSEntitlement_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(456697) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSBNetAccountManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator___void_BSPlatform__BSBNetAccountManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSBNetAccountManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSLegalDocument_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(284190) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(298817) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_BSPlatform__BNetResult_BSPlatform__BSUserContent__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_BSPlatform__BNetResult_BSPlatform__BSUserContent_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSPlatform__BSUserContent_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSPlatform__BSUserContentconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(471474) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSPlatform__BSUserContent_BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(817291) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_BSTArray_BSStringT_char_1_DynamicMemoryManagementPol__BSTArrayHeapAllocator_const_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(989669) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol___void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_BSStringT_char_1_DynamicMemoryManagementPol__std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(126238) };
+		inline constexpr std::array<REL::ID, 1> std___Func_impl_std___Callable_obj_std___Bind_1_void_std___Pmf_wrap_void_BSPlatform__BSModsManager____BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult__void_BSPlatform__BSModsManager_BSPlatform__BNetResult_unsigned__int64_charconst_BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__BSPlatform__BSModsManagerconst_std___Ph_1__std___Ph_2__std___Ph_3__BSPlatform__BNetResult_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil__0__std__allocator_std___Func_class_void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil___void_BSPlatform__BNetResult_unsigned__int64_charconst_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_std___Nil_{ REL::ID(644668) };
+		inline constexpr std::array<REL::ID, 1> std___Generic_error_category{ REL::ID(325952) };
+		inline constexpr std::array<REL::ID, 1> std___Iostream_error_category{ REL::ID(937413) };
+		inline constexpr std::array<REL::ID, 1> std___Ref_count_HINSTANCE___{ REL::ID(910705) };
+		inline constexpr std::array<REL::ID, 1> std___Ref_count_base{ REL::ID(1451156) };
+		inline constexpr std::array<REL::ID, 1> std___Ref_count_del_alloc_HINSTANCE___bnet____ModuleDeleter_bnet___impl__StdAllocator_void__{ REL::ID(1522397) };
+		inline constexpr std::array<REL::ID, 1> std___Ref_count_del_alloc_HINSTANCE___bnet___impl__MemoryDeleter_HINSTANCE____bnet___impl__StdAllocator_void__{ REL::ID(1036651) };
+		inline constexpr std::array<REL::ID, 1> std___Ref_count_del_alloc__SECURITY_FUNCTION_TABLE_Aconst_bnet___impl__MemoryDeleter__SECURITY_FUNCTION_TABLE_Aconst__bnet___impl__StdAllocator_void__{ REL::ID(551652) };
+		inline constexpr std::array<REL::ID, 1> std___Ref_count_obj_alloc_bnet__InternalUser_bnet___impl__StdAllocator_void__{ REL::ID(929824) };
+		inline constexpr std::array<REL::ID, 1> std___System_error_category{ REL::ID(465747) };
+		inline constexpr std::array<REL::ID, 1> std__bad_weak_ptr{ REL::ID(354074) };
+		inline constexpr std::array<REL::ID, 1> std__basic_filebuf_char_std__char_traits_char__{ REL::ID(111972) };
+		inline constexpr std::array<REL::ID, 1> std__basic_ofstream_char_std__char_traits_char__{ REL::ID(457186) };
+		inline constexpr std::array<REL::ID, 1> std__basic_ostringstream_char_std__char_traits_char__std__allocator_char__{ REL::ID(749215) };
+		inline constexpr std::array<REL::ID, 1> std__basic_stringbuf_char_std__char_traits_char__std__allocator_char__{ REL::ID(1296522) };
+		inline constexpr std::array<REL::ID, 1> std__basic_stringstream_char_std__char_traits_char__std__allocator_char__{ REL::ID(901473) };
+		inline constexpr std::array<REL::ID, 1> std__error_category{ REL::ID(372582) };
+	}
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> TBO_InstanceData{ REL::ID(588669) };
+		inline constexpr std::array<REL::ID, 2> TES{ REL::ID(852379), REL::ID(1510858) };
+		inline constexpr std::array<REL::ID, 1> TESAIForm{ REL::ID(831249) };
+		inline constexpr std::array<REL::ID, 1> TESActionData{ REL::ID(780200) };
+		inline constexpr std::array<REL::ID, 14> TESActorBase{ REL::ID(1530796), REL::ID(1489655), REL::ID(957323), REL::ID(1129940), REL::ID(1302704), REL::ID(1475879), REL::ID(504823), REL::ID(1555266), REL::ID(145551), REL::ID(318344), REL::ID(710949), REL::ID(225209), REL::ID(397712), REL::ID(570735) };
+		inline constexpr std::array<REL::ID, 1> TESActorBaseData{ REL::ID(1297395) };
+		inline constexpr std::array<REL::ID, 1> TESAmbushPackageData{ REL::ID(757181) };
+		inline constexpr std::array<REL::ID, 12> TESAmmo{ REL::ID(210706), REL::ID(873923), REL::ID(1485905), REL::ID(953594), REL::ID(421374), REL::ID(594532), REL::ID(767236), REL::ID(939735), REL::ID(1112525), REL::ID(1285284), REL::ID(95141), REL::ID(1192063) };
+		inline constexpr std::array<REL::ID, 1> TESAttackDamageForm{ REL::ID(644937) };
+		inline constexpr std::array<REL::ID, 1> TESAudio__DuckingMgmt__AttenInstancedIni{ REL::ID(1048159) };
+		inline constexpr std::array<REL::ID, 1> TESAudio__DuckingMgmt__InstancedIni{ REL::ID(609525) };
+		inline constexpr std::array<REL::ID, 1> TESAudio__ScriptedMusicState{ REL::ID(1382742) };
+		inline constexpr std::array<REL::ID, 1> TESBipedModelForm{ REL::ID(271816) };
+		inline constexpr std::array<REL::ID, 1> TESBoundAnimObject{ REL::ID(892773) };
+		inline constexpr std::array<REL::ID, 1> TESBoundObject{ REL::ID(229306) };
+		inline constexpr std::array<REL::ID, 1> TESCamera{ REL::ID(158336) };
+		inline constexpr std::array<REL::ID, 1> TESCameraState{ REL::ID(865051) };
+		inline constexpr std::array<REL::ID, 1> TESChildCell{ REL::ID(303914) };
+		inline constexpr std::array<REL::ID, 5> TESClass{ REL::ID(447921), REL::ID(1298094), REL::ID(327371), REL::ID(500058), REL::ID(1550525) };
+		inline constexpr std::array<REL::ID, 1> TESClimate{ REL::ID(1406737) };
+		inline constexpr std::array<REL::ID, 1> TESCombatStyle{ REL::ID(418347) };
+		inline constexpr std::array<REL::ID, 1> TESContainer{ REL::ID(869240) };
+		inline constexpr std::array<REL::ID, 1> TESCustomPackageData{ REL::ID(696903) };
+		inline constexpr std::array<REL::ID, 1> TESDataHandler__ArchiveRegistrationListener{ REL::ID(654811) };
+		inline constexpr std::array<REL::ID, 1> TESDataHandler__PSGRegistrationListener{ REL::ID(388431) };
+		inline constexpr std::array<REL::ID, 1> TESDescription{ REL::ID(1042133) };
+		inline constexpr std::array<REL::ID, 1> TESDialoguePackageData{ REL::ID(1261484) };
+		inline constexpr std::array<REL::ID, 1> TESEatPackageData{ REL::ID(1215030) };
+		inline constexpr std::array<REL::ID, 2> TESEffectShader{ REL::ID(988469), REL::ID(256527) };
+		inline constexpr std::array<REL::ID, 1> TESEnchantableForm{ REL::ID(1215240) };
+		inline constexpr std::array<REL::ID, 1> TESEscortPackageData{ REL::ID(1168155) };
+		inline constexpr std::array<REL::ID, 3> TESEyes{ REL::ID(1363581), REL::ID(631862), REL::ID(1243328) };
+		inline constexpr std::array<REL::ID, 3> TESFaction{ REL::ID(338087), REL::ID(1188184), REL::ID(217453) };
+		inline constexpr std::array<REL::ID, 11> TESFlora{ REL::ID(840512), REL::ID(1504321), REL::ID(533362), REL::ID(607), REL::ID(174185), REL::ID(1490519), REL::ID(299948), REL::ID(1396756), REL::ID(1569946), REL::ID(160354), REL::ID(332962) };
+		inline constexpr std::array<REL::ID, 1> TESFollowPackageData{ REL::ID(1121388) };
+		inline constexpr std::array<REL::ID, 1> TESForm{ REL::ID(161818) };
+		inline constexpr std::array<REL::ID, 1> TESFormUIData{ REL::ID(161944) };
+		inline constexpr std::array<REL::ID, 1> TESFullName{ REL::ID(487988) };
+		inline constexpr std::array<REL::ID, 10> TESFurniture{ REL::ID(1010026), REL::ID(91458), REL::ID(703417), REL::ID(171199), REL::ID(343573), REL::ID(77746), REL::ID(469552), REL::ID(1566968), REL::ID(157325), REL::ID(329935) };
+		inline constexpr std::array<REL::ID, 1> TESGlobal{ REL::ID(743202) };
+		inline constexpr std::array<REL::ID, 2> TESGrass{ REL::ID(46983), REL::ID(85425) };
+		inline constexpr std::array<REL::ID, 1> TESHealthForm{ REL::ID(26723) };
+		inline constexpr std::array<REL::ID, 1> TESIcon{ REL::ID(200105) };
+		inline constexpr std::array<REL::ID, 1> TESIdleForm{ REL::ID(908419) };
+		inline constexpr std::array<REL::ID, 1> TESImageSpace{ REL::ID(488075) };
+		inline constexpr std::array<REL::ID, 1> TESImageSpaceModifiableForm{ REL::ID(1250344) };
+		inline constexpr std::array<REL::ID, 1> TESImageSpaceModifier{ REL::ID(858116) };
+		inline constexpr std::array<REL::ID, 12> TESKey{ REL::ID(1215391), REL::ID(735426), REL::ID(1346395), REL::ID(814712), REL::ID(282540), REL::ID(455071), REL::ID(628326), REL::ID(800987), REL::ID(973420), REL::ID(1146259), REL::ID(1538597), REL::ID(1053077) };
+		inline constexpr std::array<REL::ID, 1> TESLandTexture{ REL::ID(1491436) };
+		inline constexpr std::array<REL::ID, 3> TESLevCharacter{ REL::ID(1305226), REL::ID(386501), REL::ID(293107) };
+		inline constexpr std::array<REL::ID, 2> TESLevItem{ REL::ID(718716), REL::ID(1381610) };
+		inline constexpr std::array<REL::ID, 2> TESLevSpell{ REL::ID(649735), REL::ID(1312928) };
+		inline constexpr std::array<REL::ID, 1> TESLeveledList{ REL::ID(704877) };
+		inline constexpr std::array<REL::ID, 1> TESLoadScreen{ REL::ID(1392417) };
+		inline constexpr std::array<REL::ID, 1> TESModel{ REL::ID(1554563) };
+		inline constexpr std::array<REL::ID, 2> TESModelDB__TESQueuedHandles{ REL::ID(1089024), REL::ID(1387749) };
+		inline constexpr std::array<REL::ID, 1> TESModelDB____TESProcessor{ REL::ID(804598) };
+		inline constexpr std::array<REL::ID, 1> TESModelRDT{ REL::ID(803898) };
+		inline constexpr std::array<REL::ID, 1> TESModelTri{ REL::ID(818006) };
+		inline constexpr std::array<REL::ID, 19> TESNPC{ REL::ID(1261646), REL::ID(1220548), REL::ID(688592), REL::ID(860979), REL::ID(1033703), REL::ID(1206734), REL::ID(235917), REL::ID(1286087), REL::ID(1458876), REL::ID(49178), REL::ID(441159), REL::ID(1538405), REL::ID(128763), REL::ID(301380), REL::ID(474214), REL::ID(1085746), REL::ID(1258620), REL::ID(1431050), REL::ID(21302) };
+		inline constexpr std::array<REL::ID, 1> TESNPC__InstanceData{ REL::ID(38352) };
+		inline constexpr std::array<REL::ID, 1> TESObject{ REL::ID(270585) };
+		inline constexpr std::array<REL::ID, 10> TESObjectACTI{ REL::ID(1449263), REL::ID(530528), REL::ID(1141864), REL::ID(610018), REL::ID(782872), REL::ID(516618), REL::ID(908817), REL::ID(423223), REL::ID(596355), REL::ID(769063) };
+		inline constexpr std::array<REL::ID, 2> TESObjectANIO{ REL::ID(927820), REL::ID(195912) };
+		inline constexpr std::array<REL::ID, 3> TESObjectARMA{ REL::ID(607008), REL::ID(924745), REL::ID(1536516) };
+		inline constexpr std::array<REL::ID, 14> TESObjectARMO{ REL::ID(99317), REL::ID(763042), REL::ID(1374104), REL::ID(403456), REL::ID(1014992), REL::ID(1187880), REL::ID(1360281), REL::ID(1533468), REL::ID(562715), REL::ID(1174103), REL::ID(1346620), REL::ID(156848), REL::ID(1253655), REL::ID(1426104) };
+		inline constexpr std::array<REL::ID, 1> TESObjectARMO__InstanceData{ REL::ID(458288) };
+		inline constexpr std::array<REL::ID, 13> TESObjectBOOK{ REL::ID(479975), REL::ID(1143463), REL::ID(173024), REL::ID(1223262), REL::ID(691347), REL::ID(863616), REL::ID(1036398), REL::ID(1209468), REL::ID(1381820), REL::ID(1554955), REL::ID(145218), REL::ID(537570), REL::ID(51903) };
+		inline constexpr std::array<REL::ID, 2> TESObjectCELL{ REL::ID(1515855), REL::ID(783541) };
+		inline constexpr std::array<REL::ID, 1> TESObjectCELL__IDecalRefFunctor{ REL::ID(857454) };
+		inline constexpr std::array<REL::ID, 12> TESObjectCONT{ REL::ID(24063), REL::ID(688257), REL::ID(860665), REL::ID(1472477), REL::ID(940172), REL::ID(1112965), REL::ID(1285751), REL::ID(1019633), REL::ID(1411599), REL::ID(926397), REL::ID(1099315), REL::ID(1272010) };
+		inline constexpr std::array<REL::ID, 8> TESObjectDOOR{ REL::ID(792171), REL::ID(1455555), REL::ID(484661), REL::ID(1535107), REL::ID(125472), REL::ID(1441619), REL::ID(251662), REL::ID(1348252) };
+		inline constexpr std::array<REL::ID, 2> TESObjectLAND{ REL::ID(962051), REL::ID(9924) };
+		inline constexpr std::array<REL::ID, 12> TESObjectLIGH{ REL::ID(314769), REL::ID(978088), REL::ID(445952), REL::ID(1496832), REL::ID(87029), REL::ID(259703), REL::ID(432180), REL::ID(605315), REL::ID(1217000), REL::ID(1389254), REL::ID(1123328), REL::ID(1515890) };
+		inline constexpr std::array<REL::ID, 12> TESObjectMISC{ REL::ID(322610), REL::ID(1424675), REL::ID(453872), REL::ID(1504752), REL::ID(972245), REL::ID(1145054), REL::ID(1317805), REL::ID(1490991), REL::ID(81169), REL::ID(253981), REL::ID(646246), REL::ID(160812) };
+		inline constexpr std::array<REL::ID, 8> TESObjectREFR{ REL::ID(179707), REL::ID(1114303), REL::ID(190525), REL::ID(848291), REL::ID(1506808), REL::ID(801912), REL::ID(395794), REL::ID(1493042) };
+		inline constexpr std::array<REL::ID, 1> TESObjectREFRDef__IAliasFunctor{ REL::ID(396591) };
+		inline constexpr std::array<REL::ID, 1> TESObjectREFRDef__ILinkedReferenceFunctor{ REL::ID(1054758) };
+		inline constexpr std::array<REL::ID, 1> TESObjectREFRDef__NativeLinkFunctor__lambda_8a3e806b19528292376bd8bea3d0ed45__{ REL::ID(250255) };
+		inline constexpr std::array<REL::ID, 1> TESObjectREFRSync__REFRSyncController{ REL::ID(457570) };
+		inline constexpr std::array<REL::ID, 1> TESObjectREFR__HandleOutfitItemsFunctor{ REL::ID(884194) };
+		inline constexpr std::array<REL::ID, 4> TESObjectSTAT{ REL::ID(1290410), REL::ID(371565), REL::ID(1421655), REL::ID(11904) };
+		inline constexpr std::array<REL::ID, 4> TESObjectTREE{ REL::ID(264666), REL::ID(928050), REL::ID(396038), REL::ID(1007467) };
+		inline constexpr std::array<REL::ID, 15> TESObjectWEAP{ REL::ID(154759), REL::ID(818148), REL::ID(1429366), REL::ID(897611), REL::ID(365474), REL::ID(976906), REL::ID(1149668), REL::ID(179251), REL::ID(790789), REL::ID(963237), REL::ID(1135963), REL::ID(1308688), REL::ID(118622), REL::ID(1215816), REL::ID(1388100) };
+		inline constexpr std::array<REL::ID, 1> TESObjectWEAP__Data{ REL::ID(513822) };
+		inline constexpr std::array<REL::ID, 1> TESObjectWEAP__InstanceData{ REL::ID(872967) };
+		inline constexpr std::array<REL::ID, 1> TESPackage{ REL::ID(353968) };
+		inline constexpr std::array<REL::ID, 1> TESPackageData{ REL::ID(803705) };
+		inline constexpr std::array<REL::ID, 1> TESPatrolPackageData{ REL::ID(1074848) };
+		inline constexpr std::array<REL::ID, 1> TESProduceForm{ REL::ID(915348) };
+		inline constexpr std::array<REL::ID, 2> TESQuest{ REL::ID(972554), REL::ID(1117851) };
+		inline constexpr std::array<REL::ID, 11> TESRace{ REL::ID(1101240), REL::ID(368829), REL::ID(980193), REL::ID(1153097), REL::ID(1325687), REL::ID(1499024), REL::ID(527995), REL::ID(919925), REL::ID(434361), REL::ID(607509), REL::ID(780377) };
+		inline constexpr std::array<REL::ID, 1> TESRaceForm{ REL::ID(117307) };
+		inline constexpr std::array<REL::ID, 1> TESReactionForm{ REL::ID(729224) };
+		inline constexpr std::array<REL::ID, 1> TESRegion{ REL::ID(1264876) };
+		inline constexpr std::array<REL::ID, 1> TESRegionData{ REL::ID(1143977) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataGrass{ REL::ID(173530) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataLandscape{ REL::ID(1223766) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataManager{ REL::ID(1569273) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataMap{ REL::ID(1036902) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataObjects{ REL::ID(505032) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataSound{ REL::ID(850500) };
+		inline constexpr std::array<REL::ID, 1> TESRegionDataWeather{ REL::ID(1462168) };
+		inline constexpr std::array<REL::ID, 1> TESRegionGrassObject{ REL::ID(225402) };
+		inline constexpr std::array<REL::ID, 1> TESRegionGrassObjectList{ REL::ID(397934) };
+		inline constexpr std::array<REL::ID, 1> TESRegionList{ REL::ID(836836) };
+		inline constexpr std::array<REL::ID, 1> TESRegionNoiseFunction{ REL::ID(1495262) };
+		inline constexpr std::array<REL::ID, 1> TESRegionObject{ REL::ID(1229002) };
+		inline constexpr std::array<REL::ID, 1> TESRegionObjectBase{ REL::ID(711157) };
+		inline constexpr std::array<REL::ID, 1> TESRegionObjectList{ REL::ID(823068) };
+		inline constexpr std::array<REL::ID, 5> TESShout{ REL::ID(441421), REL::ID(1291652), REL::ID(320838), REL::ID(932336), REL::ID(1544012) };
+		inline constexpr std::array<REL::ID, 12> TESSoulGem{ REL::ID(1269211), REL::ID(789401), REL::ID(1400501), REL::ID(868416), REL::ID(336645), REL::ID(509407), REL::ID(682571), REL::ID(854875), REL::ID(1027494), REL::ID(1200543), REL::ID(9711), REL::ID(1107129) };
+		inline constexpr std::array<REL::ID, 1> TESSound{ REL::ID(545887) };
+		inline constexpr std::array<REL::ID, 1> TESSpellList{ REL::ID(887869) };
+		inline constexpr std::array<REL::ID, 1> TESTexture{ REL::ID(1060536) };
+		inline constexpr std::array<REL::ID, 1> TESTexture1024{ REL::ID(734924) };
+		inline constexpr std::array<REL::ID, 2> TESTopic{ REL::ID(826124), REL::ID(93789) };
+		inline constexpr std::array<REL::ID, 1> TESTopicInfo{ REL::ID(1462187) };
+		inline constexpr std::array<REL::ID, 2> TESTrapListener{ REL::ID(1266510), REL::ID(561862) };
+		inline constexpr std::array<REL::ID, 1> TESUseItemPackageData{ REL::ID(1028096) };
+		inline constexpr std::array<REL::ID, 1> TESUseWeaponPackageData{ REL::ID(1201169) };
+		inline constexpr std::array<REL::ID, 1> TESValueForm{ REL::ID(262608) };
+		inline constexpr std::array<REL::ID, 1> TESWaterDisplacement{ REL::ID(1172314) };
+		inline constexpr std::array<REL::ID, 2> TESWaterForm{ REL::ID(603171), REL::ID(1453228) };
+		inline constexpr std::array<REL::ID, 1> TESWaterNormals{ REL::ID(248219) };
+		inline constexpr std::array<REL::ID, 1> TESWaterObject{ REL::ID(1438246) };
+		inline constexpr std::array<REL::ID, 1> TESWaterReflections{ REL::ID(514198) };
+		inline constexpr std::array<REL::ID, 1> TESWeather{ REL::ID(202717) };
+		inline constexpr std::array<REL::ID, 1> TESWeather__SkyStaticFunctor{ REL::ID(1170152) };
+		inline constexpr std::array<REL::ID, 1> TESWeightForm{ REL::ID(421444) };
+		inline constexpr std::array<REL::ID, 2> TESWordOfPower{ REL::ID(1288587), REL::ID(556559) };
+		inline constexpr std::array<REL::ID, 3> TESWorldSpace{ REL::ID(227184), REL::ID(1076987), REL::ID(106340) };
+		inline constexpr std::array<REL::ID, 1> TargetEntry{ REL::ID(1519640) };
+		inline constexpr std::array<REL::ID, 1> TargetValueModifierEffect{ REL::ID(763983) };
+		inline constexpr std::array<REL::ID, 1> TelekinesisEffect{ REL::ID(654020) };
+		inline constexpr std::array<REL::ID, 1> TeleportDoorSearch{ REL::ID(943603) };
+		inline constexpr std::array<REL::ID, 1> TempLoadGameBuffer{ REL::ID(1320632) };
+		inline constexpr std::array<REL::ID, 3> TerminalHolotapeMenu{ REL::ID(1048689), REL::ID(1567215), REL::ID(596385) };
+		inline constexpr std::array<REL::ID, 2> TerminalMenu{ REL::ID(458533), REL::ID(538561) };
+		inline constexpr std::array<REL::ID, 2> TerminalMenuButtons{ REL::ID(1149704), REL::ID(1229452) };
+		inline constexpr std::array<REL::ID, 1> TerminalMenuUtils__HolotapeSelectionCallback{ REL::ID(72128) };
+		inline constexpr std::array<REL::ID, 1> TerminalRunResultsCallback{ REL::ID(1575037) };
+		inline constexpr std::array<REL::ID, 1> TextureUpdateDone{ REL::ID(931763) };
+		inline constexpr std::array<REL::ID, 1> TextureUpdateStage{ REL::ID(208093) };
+		inline constexpr std::array<REL::ID, 1> TextureUpdateStart{ REL::ID(492907) };
+		inline constexpr std::array<REL::ID, 1> ThirdPersonState{ REL::ID(728085) };
+		inline constexpr std::array<REL::ID, 1> ThumbstickEvent{ REL::ID(528982) };
+		inline constexpr std::array<REL::ID, 2> TitleSequenceMenu{ REL::ID(1124758), REL::ID(1204587) };
+		inline constexpr std::array<REL::ID, 1> ToggleComponentFavoriteCommand{ REL::ID(495845) };
+		inline constexpr std::array<REL::ID, 1> TogglePOVHandler{ REL::ID(1040085) };
+		inline constexpr std::array<REL::ID, 1> ToggleQuestActiveStatusCommand{ REL::ID(10029) };
+		inline constexpr std::array<REL::ID, 1> ToggleRadioStationCommand{ REL::ID(1093703) };
+		inline constexpr std::array<REL::ID, 1> ToggleRunHandler{ REL::ID(269799) };
+		inline constexpr std::array<REL::ID, 1> TrapEntry{ REL::ID(388840) };
+		inline constexpr std::array<REL::ID, 1> TrapTargetEntry{ REL::ID(987158) };
+		inline constexpr std::array<REL::ID, 1> TrespassPackage{ REL::ID(526690) };
+		inline constexpr std::array<REL::ID, 1> TrianglePathWaterAndLedgeSplitter{ REL::ID(381431) };
+		inline constexpr std::array<REL::ID, 1> TurnUndeadEffect{ REL::ID(722872) };
+		inline constexpr std::array<REL::ID, 2> TutorialMenu{ REL::ID(1111125), REL::ID(1190655) };
+		inline constexpr std::array<REL::ID, 1> TweenMenuCameraState{ REL::ID(1014257) };
+		inline constexpr std::array<REL::ID, 1> type_info{ REL::ID(862522) };
+	}
+}
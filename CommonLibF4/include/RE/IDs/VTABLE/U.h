@@ -0,0 +1,22 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> UI{ REL::ID(329855) };
+		inline constexpr std::array<REL::ID, 2> UIBlurManager{ REL::ID(973399), REL::ID(49313) };
+		inline constexpr std::array<REL::ID, 1> UIMessage{ REL::ID(1124700) };
+		inline constexpr std::array<REL::ID, 1> UISaveLoadManager{ REL::ID(561065) };
+		inline constexpr std::array<REL::ID, 1> UncullBoneHandler{ REL::ID(1394766) };
+		inline constexpr std::array<REL::ID, 1> UncullFurnitureBoneHandler{ REL::ID(1128868) };
+		inline constexpr std::array<REL::ID, 1> UncullWeaponsHandler{ REL::ID(862878) };
+		inline constexpr std::array<REL::ID, 1> UnitTestMemoryHeap{ REL::ID(1136322) };
+		inline constexpr std::array<REL::ID, 1> UnitTestZeroOverheadHeap{ REL::ID(324580) };
+		inline constexpr std::array<REL::ID, 1> UpdateSightedHandler{ REL::ID(1493918) };
+		inline constexpr std::array<REL::ID, 1> UseItemCommand{ REL::ID(814083) };
+		inline constexpr std::array<REL::ID, 1> UseStealthBoyHandler{ REL::ID(723504) };
+		inline constexpr std::array<REL::ID, 1> UseStimpakHandler{ REL::ID(65008) };
+		inline constexpr std::array<REL::ID, 1> UseWeaponActorPackageData{ REL::ID(402859) };
+	}
+}
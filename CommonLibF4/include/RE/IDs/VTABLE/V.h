@@ -0,0 +1,37 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 4> VATS{ REL::ID(691246), REL::ID(1348820), REL::ID(424761), REL::ID(1083002) };
+		inline constexpr std::array<REL::ID, 1> VATSCameraState{ REL::ID(1425411) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__ActorLookCameraState{ REL::ID(1555732) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__BaseState{ REL::ID(379153) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__LookAtCameraState{ REL::ID(19505) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__ModifierBase{ REL::ID(1522925) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__Modifier_VATSCamera__ModFuncEulerAngleSpring_VATSCamera__ModFuncSpringData_NiPoint3__{ REL::ID(725053) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__Modifier_VATSCamera__ModFuncFOVSpring_VATSCamera__ModFuncSpringData_float__{ REL::ID(1163515) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__Modifier_VATSCamera__ModFuncLookAtEuler_NiPoint3_{ REL::ID(1116741) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__Modifier_VATSCamera__ModFuncLookAtObject_NiPointer_NiAVObject__{ REL::ID(285823) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__Modifier_VATSCamera__ModFuncLookAtRefr_VATSCamera__ModFuncLookAtRefr__Data_{ REL::ID(1429253) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__Modifier_VATSCamera__ModFuncStateCopy_VATSCamera__StateOutput_{ REL::ID(1476371) };
+		inline constexpr std::array<REL::ID, 1> VATSCamera__StationaryCameraState{ REL::ID(332581) };
+		inline constexpr std::array<REL::ID, 3> VATSMenu{ REL::ID(853256), REL::ID(932739), REL::ID(1544418) };
+		inline constexpr std::array<REL::ID, 1> VATSMenuPrivate__ASFunctionHandler{ REL::ID(924290) };
+		inline constexpr std::array<REL::ID, 5> VATSMenuPrivate__VatsMenuObj{ REL::ID(1269934), REL::ID(345650), REL::ID(1223506), REL::ID(252569), REL::ID(910708) };
+		inline constexpr std::array<REL::ID, 2> VATSMenuPrivate__VatsMenuObj__FXPartInfo{ REL::ID(219723), REL::ID(877679) };
+		inline constexpr std::array<REL::ID, 1> VATSUtils__ValidateStrangerLineOfSightGoalToOriginFunctor{ REL::ID(868799) };
+		inline constexpr std::array<REL::ID, 1> ValueModifierEffect{ REL::ID(453177) };
+		inline constexpr std::array<REL::ID, 1> VariableIntArrayImplementation{ REL::ID(1161843) };
+		inline constexpr std::array<REL::ID, 1> VecArrayImplementation{ REL::ID(944682) };
+		inline constexpr std::array<REL::ID, 1> VelocityObstacle__Utilities__BuildOpenEdgeListsVisitor{ REL::ID(1283932) };
+		inline constexpr std::array<REL::ID, 2> VertibirdMenu{ REL::ID(263278), REL::ID(342648) };
+		inline constexpr std::array<REL::ID, 2> VignetteMenu{ REL::ID(1392733), REL::ID(1472739) };
+		inline constexpr std::array<REL::ID, 1> VisitReturnData_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__BSTAlignedScrapArrayAllocator_16___Allocator_{ REL::ID(644219) };
+		inline constexpr std::array<REL::ID, 1> VisitReturnData_MovementVector_BSTAlignedScrapArrayAllocator_16___Allocator_{ REL::ID(816877) };
+		inline constexpr std::array<REL::ID, 1> VisitReturnData_NiPoint3_BSTAlignedScrapArrayAllocator_16___Allocator_{ REL::ID(989230) };
+		inline constexpr std::array<REL::ID, 1> VoiceSpellCastHandler{ REL::ID(986559) };
+		inline constexpr std::array<REL::ID, 1> VoiceSpellFireHandler{ REL::ID(594898) };
+	}
+}
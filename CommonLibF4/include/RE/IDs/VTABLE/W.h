@@ -0,0 +1,44 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> WaterPathPathingNodeGenerator{ REL::ID(228444) };
+		inline constexpr std::array<REL::ID, 1> WaterPathRayValidator{ REL::ID(321525) };
+		inline constexpr std::array<REL::ID, 2> WeaponAnimationGraphManagerHolder{ REL::ID(1123424), REL::ID(1156459) };
+		inline constexpr std::array<REL::ID, 1> WeaponAttachHandler{ REL::ID(583436) };
+		inline constexpr std::array<REL::ID, 1> WeaponBeginDrawHandler{ REL::ID(62602) };
+		inline constexpr std::array<REL::ID, 1> WeaponBeginSheatheHandler{ REL::ID(721212) };
+		inline constexpr std::array<REL::ID, 1> WeaponDetachHandler{ REL::ID(1241549) };
+		inline constexpr std::array<REL::ID, 1> WeaponDrawHandler{ REL::ID(1378656) };
+		inline constexpr std::array<REL::ID, 1> WeaponEnchantmentController{ REL::ID(254671) };
+		inline constexpr std::array<REL::ID, 1> WeaponFireHandler{ REL::ID(1548757) };
+		inline constexpr std::array<REL::ID, 1> WeaponSheatheHandler{ REL::ID(454495) };
+		inline constexpr std::array<REL::ID, 1> WeaponSwingHandler{ REL::ID(734882) };
+		inline constexpr std::array<REL::ID, 1> WeaponUtils____CollectCalculationIdentifiers{ REL::ID(983849) };
+		inline constexpr std::array<REL::ID, 1> WeightedModifierVisitor_BSTSmartPointer_IMovementParameters_BSTSmartPointerIntrusiveRefCount__{ REL::ID(1348559) };
+		inline constexpr std::array<REL::ID, 1> WeightedModifierVisitor_MovementVector_{ REL::ID(1521735) };
+		inline constexpr std::array<REL::ID, 1> WeightedModifierVisitor_NiPoint3_{ REL::ID(112008) };
+		inline constexpr std::array<REL::ID, 2> WorkbenchMenuBase{ REL::ID(740534), REL::ID(992211) };
+		inline constexpr std::array<REL::ID, 6> WorkshopMenu{ REL::ID(1162253), REL::ID(1241857), REL::ID(271056), REL::ID(929002), REL::ID(4324), REL::ID(663294) };
+		inline constexpr std::array<REL::ID, 1> WorkshopMenuGeometry{ REL::ID(1321023) };
+		inline constexpr std::array<REL::ID, 2> WorkshopMenu__FXWorkshopMenu{ REL::ID(1427987), REL::ID(504054) };
+		inline constexpr std::array<REL::ID, 2> Workshop_CaravanMenu{ REL::ID(531024), REL::ID(610505) };
+		inline constexpr std::array<REL::ID, 2> Workshop_CaravanMenu__FXWorkshopCaravanMenu{ REL::ID(797130), REL::ID(1455098) };
+		inline constexpr std::array<REL::ID, 1> Workshop__CheckBuildRadiusCollector{ REL::ID(1544457) };
+		inline constexpr std::array<REL::ID, 1> Workshop__ExtraData{ REL::ID(1043322) };
+		inline constexpr std::array<REL::ID, 1> Workshop__ForwardCastCollector{ REL::ID(425155) };
+		inline constexpr std::array<REL::ID, 1> Workshop__GroundIntersectCollector{ REL::ID(1116232) };
+		inline constexpr std::array<REL::ID, 1> Workshop__MainStatusHandler{ REL::ID(1022907) };
+		inline constexpr std::array<REL::ID, 1> Workshop__RequestRepairCallback{ REL::ID(187083) };
+		inline constexpr std::array<REL::ID, 1> Workshop__RequestScrapCallback{ REL::ID(1124584) };
+		inline constexpr std::array<REL::ID, 1> Workshop__RequestStoreCallback{ REL::ID(765675) };
+		inline constexpr std::array<REL::ID, 5> Workshop__WorkshopReferenceEventSink{ REL::ID(1448098), REL::ID(523977), REL::ID(1182086), REL::ID(257927), REL::ID(915992) };
+		inline constexpr std::array<REL::ID, 1> Workshop__hknpCheckShelterHitsCollector{ REL::ID(653355) };
+		inline constexpr std::array<REL::ID, 1> Workshop__hknpClosestConnectPointCollector{ REL::ID(1223550) };
+		inline constexpr std::array<REL::ID, 1> Workshop__hknpCountIntersectingRefsCollector{ REL::ID(1395879) };
+		inline constexpr std::array<REL::ID, 1> Workshop__hknpWorkshopCastCollector{ REL::ID(1050552) };
+		inline constexpr std::array<REL::ID, 1> Workshop__hknpWorkshopIntersectCollector{ REL::ID(1143765) };
+	}
+}
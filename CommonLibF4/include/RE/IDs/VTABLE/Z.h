@@ -0,0 +1,11 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> ZeroOverheadHeap{ REL::ID(1561675) };
+		inline constexpr std::array<REL::ID, 1> ZeroPitchHandler{ REL::ID(890547) };
+		inline constexpr std::array<REL::ID, 1> ZoneEntry{ REL::ID(814769) };
+	}
+}
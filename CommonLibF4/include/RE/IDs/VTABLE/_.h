@@ -0,0 +1,272 @@
+#pragma once
+
+namespace RE
+{
+	namespace VTABLE
+	{
+		inline constexpr std::array<REL::ID, 1> __ActorItemEquippedToMiscStatHandler{ REL::ID(584177) };
+		inline constexpr std::array<REL::ID, 1> __ActorKillToMiscStatHandler{ REL::ID(1508398) };
+		inline constexpr std::array<REL::ID, 1> __ActorTargetCheck{ REL::ID(525745) };
+		inline constexpr std::array<REL::ID, 1> __AddPackagesToListFunc{ REL::ID(83522) };
+		inline constexpr std::array<REL::ID, 1> __AliasAddPackagesToListFunc{ REL::ID(522220) };
+		inline constexpr std::array<REL::ID, 1> __AlternatesInitializer{ REL::ID(562428) };
+		inline constexpr std::array<REL::ID, 1> __AnimationFileListener{ REL::ID(674445) };
+		inline constexpr std::array<REL::ID, 2> __AnimationFileLookupSingletonHelper{ REL::ID(414420), REL::ID(1072692) };
+		inline constexpr std::array<REL::ID, 1> __ApplyAllDecalsRefFunctor{ REL::ID(1504509) };
+		inline constexpr std::array<REL::ID, 1> __ApplyChangesFunctor{ REL::ID(319870) };
+		inline constexpr std::array<REL::ID, 1> __ApplyTypedDamageFunctor{ REL::ID(1376297) };
+		inline constexpr std::array<REL::ID, 1> __ArchiveCacheEvent{ REL::ID(446128) };
+		inline constexpr std::array<REL::ID, 1> __ArchiveClearRegistrationListener{ REL::ID(522368) };
+		inline constexpr std::array<REL::ID, 1> __AttachLightHitEffectVisitor{ REL::ID(584949) };
+		inline constexpr std::array<REL::ID, 1> __AudioLoadTask{ REL::ID(1521788) };
+		inline constexpr std::array<REL::ID, 1> __AutoDoorFadeCallback{ REL::ID(415708) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterArmor_{ REL::ID(72211), REL::ID(949660), REL::ID(244959), REL::ID(1122286), REL::ID(417467) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterBoundItem_{ REL::ID(286066), REL::ID(1163755), REL::ID(458635), REL::ID(1336188), REL::ID(631892) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterChameleon_{ REL::ID(500097), REL::ID(1377453), REL::ID(673243), REL::ID(1550559), REL::ID(845703) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterCloak_{ REL::ID(1142178), REL::ID(437229), REL::ID(1314886), REL::ID(610364), REL::ID(1488017) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterDisarm_{ REL::ID(1355981), REL::ID(651701), REL::ID(1529156), REL::ID(824288), REL::ID(119428) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterInvisibility_{ REL::ID(714664), REL::ID(8921), REL::ID(886957), REL::ID(182399), REL::ID(1059634) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterLight_{ REL::ID(928179), REL::ID(223617), REL::ID(1101062), REL::ID(396149), REL::ID(1273789) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterOffensive_{ REL::ID(844084), REL::ID(139261), REL::ID(1016712), REL::ID(312015), REL::ID(1189591) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterParalyze_{ REL::ID(1012205), REL::ID(307599), REL::ID(1185191), REL::ID(480320), REL::ID(1357621) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterReanimate_{ REL::ID(1226577), REL::ID(521659), REL::ID(1398910), REL::ID(694770), REL::ID(1572148) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterRestore_{ REL::ID(415815), REL::ID(1293487), REL::ID(589027), REL::ID(1466410), REL::ID(761725) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterScript_{ REL::ID(798572), REL::ID(93618), REL::ID(970981), REL::ID(266440), REL::ID(1143810) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterStagger_{ REL::ID(1570523), REL::ID(865345), REL::ID(160916), REL::ID(1038136), REL::ID(333523) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterSummon_{ REL::ID(202183), REL::ID(1079476), REL::ID(374740), REL::ID(1252416), REL::ID(547795) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterTargetEffect_{ REL::ID(1440285), REL::ID(735976), REL::ID(30543), REL::ID(908457), REL::ID(203806) };
+		inline constexpr std::array<REL::ID, 5> __AutoRegisterCombatMagicCaster_CombatMagicCasterWard_{ REL::ID(630318), REL::ID(1507846), REL::ID(802997), REL::ID(98022), REL::ID(975374) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestFlight_CombatPathDestinationActor_{ REL::ID(462463), REL::ID(1340098), REL::ID(635767), REL::ID(1513370) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestFlight_CombatPathDestinationLocation_{ REL::ID(172587), REL::ID(1049814), REL::ID(345001), REL::ID(1222840) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestFlight_CombatPathDestinationRef_{ REL::ID(317598), REL::ID(1195160), REL::ID(490211), REL::ID(1367539) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestFlyingAttack_CombatPathDestinationNone_{ REL::ID(1043704), REL::ID(338932), REL::ID(1216782), REL::ID(511752) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestHover_CombatPathDestinationNone_{ REL::ID(898578), REL::ID(194091), REL::ID(1071236), REL::ID(366456) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestLanding_CombatPathDestinationLocation_{ REL::ID(753606), REL::ID(48390), REL::ID(925968), REL::ID(221378) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestMultiGoal_CombatPathDestinationLocations_{ REL::ID(883101), REL::ID(178585), REL::ID(1055843), REL::ID(351019) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestMultiGoal_CombatPathDestinationRefs_{ REL::ID(1028260), REL::ID(323559), REL::ID(1201294), REL::ID(496284) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestOrbit_CombatPathDestinationLocation_{ REL::ID(608159), REL::ID(1485915), REL::ID(781028), REL::ID(76112) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestRotatePath_CombatPathDestinationLocation_{ REL::ID(26671), REL::ID(904600), REL::ID(200055), REL::ID(1077284) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestStandard_CombatPathDestinationActor_{ REL::ID(738215), REL::ID(32819), REL::ID(910722), REL::ID(206032) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestStandard_CombatPathDestinationLocation_{ REL::ID(447165), REL::ID(1324736), REL::ID(620316), REL::ID(1498058) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestStandard_CombatPathDestinationRef_{ REL::ID(592892), REL::ID(1470377), REL::ID(765647), REL::ID(60602) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestStraightPath_CombatPathDestinationLocation_{ REL::ID(1464260), REL::ID(759585), REL::ID(54524), REL::ID(932053) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationLocations_{ REL::ID(1173658), REL::ID(468637), REL::ID(1346172), REL::ID(641880) };
+		inline constexpr std::array<REL::ID, 4> __AutoRegisterCombatPath_CombatPathRequestWeightedMultiGoal_CombatPathDestinationRefs_{ REL::ID(1318759), REL::ID(614252), REL::ID(1491964), REL::ID(787101) };
+		inline constexpr std::array<REL::ID, 1> __BSAutoCloseController{ REL::ID(647900) };
+		inline constexpr std::array<REL::ID, 1> __BSChildLockExtra{ REL::ID(1018656) };
+		inline constexpr std::array<REL::ID, 1> __BSDelayEffect_XAPO{ REL::ID(1380760) };
+		inline constexpr std::array<REL::ID, 1> __BSOverdrive_XAPO{ REL::ID(517224) };
+		inline constexpr std::array<REL::ID, 1> __BSRagdollDriverInterface{ REL::ID(114076) };
+		inline constexpr std::array<REL::ID, 1> __BSResourceAssetLoader{ REL::ID(85259) };
+		inline constexpr std::array<REL::ID, 1> __BSScaleformAllocatorPaged{ REL::ID(213641) };
+		inline constexpr std::array<REL::ID, 1> __BSScaleformSysMemMapper{ REL::ID(40537) };
+		inline constexpr std::array<REL::ID, 2> __BSScaleformTextureManager{ REL::ID(919111), REL::ID(733056) };
+		inline constexpr std::array<REL::ID, 1> __BSStateVariableFilter_XAPO{ REL::ID(158126) };
+		inline constexpr std::array<REL::ID, 1> __BSTempEffectScreenSpaceDecal{ REL::ID(1293021) };
+		inline constexpr std::array<REL::ID, 1> __BSTextureExtra{ REL::ID(609262) };
+		inline constexpr std::array<REL::ID, 1> __BSXAudio2Graph{ REL::ID(1145422) };
+		inline constexpr std::array<REL::ID, 1> __BShkbAnimationGraphLoadScrapper{ REL::ID(514631) };
+		inline constexpr std::array<REL::ID, 1> __BaseBotConfirmCallback{ REL::ID(1361956) };
+		inline constexpr std::array<REL::ID, 1> __BaseCallbackAdapter{ REL::ID(353086) };
+		inline constexpr std::array<REL::ID, 2> __BehaviorGraphSpecificDataLookupSingleton{ REL::ID(1382181), REL::ID(457973) };
+		inline constexpr std::array<REL::ID, 1> __BehaviorGraphSwapInstanceInitializationFunctor{ REL::ID(1176755) };
+		inline constexpr std::array<REL::ID, 1> __BehaviorGraphSwapSetupFunctor{ REL::ID(1003777) };
+		inline constexpr std::array<REL::ID, 1> __BindingInfo{ REL::ID(1368220) };
+		inline constexpr std::array<REL::ID, 1> __BookReadToMiscStatHandler{ REL::ID(1102275) };
+		inline constexpr std::array<REL::ID, 1> __CastAliasSpellVisitor{ REL::ID(217337) };
+		inline constexpr std::array<REL::ID, 1> __CategoryPrefSettingApplier{ REL::ID(324222) };
+		inline constexpr std::array<REL::ID, 1> __CellAcousticSpaceListener{ REL::ID(198367) };
+		inline constexpr std::array<REL::ID, 1> __CellDetachWatcher{ REL::ID(1131968) };
+		inline constexpr std::array<REL::ID, 1> __CharProxyBeforeWholePhysicsUpdateTask{ REL::ID(1251386) };
+		inline constexpr std::array<REL::ID, 1> __CharProxyBeforeWholePhysicsUpdateTriggerSeenTask{ REL::ID(1330550) };
+		inline constexpr std::array<REL::ID, 1> __CharRigidBodyBetweenCollideAndSolveTask{ REL::ID(332458) };
+		inline constexpr std::array<REL::ID, 1> __CheckEndReachedFunctorMapper{ REL::ID(442593) };
+		inline constexpr std::array<REL::ID, 1> __CheckItemSelectListFunc{ REL::ID(97500) };
+		inline constexpr std::array<REL::ID, 1> __CheckLineOfSightTriangleFlagFiltersAdapter{ REL::ID(1365945) };
+		inline constexpr std::array<REL::ID, 1> __CheckNavmeshPathFilter{ REL::ID(906028) };
+		inline constexpr std::array<REL::ID, 1> __CheckRefAgainstConditionsFunc{ REL::ID(824493) };
+		inline constexpr std::array<REL::ID, 1> __CheckSphereVisitor{ REL::ID(1464785) };
+		inline constexpr std::array<REL::ID, 1> __ChestLootedToMiscStatHandler{ REL::ID(836260) };
+		inline constexpr std::array<REL::ID, 1> __ClearOriginalReferenceFunctor{ REL::ID(170676) };
+		inline constexpr std::array<REL::ID, 1> __ClearPrecomputedPathFlag{ REL::ID(286085) };
+		inline constexpr std::array<REL::ID, 1> __ClipAddingFunctor{ REL::ID(697114) };
+		inline constexpr std::array<REL::ID, 1> __ClipTimeVisitor{ REL::ID(1145652) };
+		inline constexpr std::array<REL::ID, 1> __CloakEffectCallbackFunctor{ REL::ID(479030) };
+		inline constexpr std::array<REL::ID, 1> __CollectQualifyingSubgraphsFunctor{ REL::ID(261189) };
+		inline constexpr std::array<REL::ID, 1> __CompileExpressionFunctor{ REL::ID(650256) };
+		inline constexpr std::array<REL::ID, 1> __ComponentCountVerifyFunc{ REL::ID(363378) };
+		inline constexpr std::array<REL::ID, 1> __ConsoleHotkeyManager{ REL::ID(1021928) };
+		inline constexpr std::array<REL::ID, 1> __ConsoleLogPrinter{ REL::ID(65093) };
+		inline constexpr std::array<REL::ID, 1> __CriticalHitToMiscStatHandler{ REL::ID(1340505) };
+		inline constexpr std::array<REL::ID, 1> __CustomGeometryConverter{ REL::ID(515315) };
+		inline constexpr std::array<REL::ID, 2> __DDQueueCollection{ REL::ID(1334202), REL::ID(410118) };
+		inline constexpr std::array<REL::ID, 1> __DaysPassedToMiscStatHandler{ REL::ID(24028) };
+		inline constexpr std::array<REL::ID, 1> __DeathItemAdder{ REL::ID(36552) };
+		inline constexpr std::array<REL::ID, 1> __DecalApplier{ REL::ID(887264) };
+		inline constexpr std::array<REL::ID, 1> __DeepCopyStream{ REL::ID(305246) };
+		inline constexpr std::array<REL::ID, 1> __DefaultObjectFormFactory{ REL::ID(34040) };
+		inline constexpr std::array<REL::ID, 1> __DisarmedToMiscStatHandler{ REL::ID(1074664) };
+		inline constexpr std::array<REL::ID, 1> __DispelAliasSpellVisitor{ REL::ID(875249) };
+		inline constexpr std::array<REL::ID, 1> __DispelFirstOnlyFunctor{ REL::ID(609491) };
+		inline constexpr std::array<REL::ID, 1> __EditorDeadClothCacheExtraData{ REL::ID(888420) };
+		inline constexpr std::array<REL::ID, 1> __EnsureAliasCanBePickpocketedFunc{ REL::ID(799132) };
+		inline constexpr std::array<REL::ID, 1> __EventCallbackAdapter{ REL::ID(259925) };
+		inline constexpr std::array<REL::ID, 1> __EventRelayFunctor{ REL::ID(1436145) };
+		inline constexpr std::array<REL::ID, 1> __ExitCallback{ REL::ID(586146) };
+		inline constexpr std::array<REL::ID, 1> __ExitSurvivalModeCallback{ REL::ID(67260) };
+		inline constexpr std::array<REL::ID, 1> __ExitToMainMenuCallback{ REL::ID(512175) };
+		inline constexpr std::array<REL::ID, 1> __FatmanDeathsToMiscStatHandler{ REL::ID(556661) };
+		inline constexpr std::array<REL::ID, 1> __FavoriteMissingComponentsConfirmCallback{ REL::ID(437850) };
+		inline constexpr std::array<REL::ID, 1> __FilterBipedPartOnAdd{ REL::ID(172987) };
+		inline constexpr std::array<REL::ID, 1> __FindAliasWithScript{ REL::ID(721003) };
+		inline constexpr std::array<REL::ID, 1> __FindClosestOpenEdgeFunctor{ REL::ID(148426) };
+		inline constexpr std::array<REL::ID, 1> __FindFormFunc{ REL::ID(492513) };
+		inline constexpr std::array<REL::ID, 1> __FindMovementIdleEnumHelper{ REL::ID(1219496) };
+		inline constexpr std::array<REL::ID, 1> __FindObjectTypeHelper{ REL::ID(561237) };
+		inline constexpr std::array<REL::ID, 1> __FindPreferredConnectedNavmeshInfosWithinRadiusVisitor{ REL::ID(867600) };
+		inline constexpr std::array<REL::ID, 2> __ForceReloadLoadingTask{ REL::ID(1151534), REL::ID(306886) };
+		inline constexpr std::array<REL::ID, 1> __ForwardingPackfileListerer{ REL::ID(151552) };
+		inline constexpr std::array<REL::ID, 1> __FusionCoreConsumedToMiscStatHandler{ REL::ID(317978) };
+		inline constexpr std::array<REL::ID, 1> __FusionCoreEjectedToMiscStatHandler{ REL::ID(51864) };
+		inline constexpr std::array<REL::ID, 1> __GraphPhysicsStepListener{ REL::ID(355496) };
+		inline constexpr std::array<REL::ID, 1> __GraphVarTypeQuery{ REL::ID(290482) };
+		inline constexpr std::array<REL::ID, 1> __HandleEntryPointVisitor{ REL::ID(867364) };
+		inline constexpr std::array<REL::ID, 1> __HandlePlayerPerspectiveSwitchForEyeTracking{ REL::ID(1522330) };
+		inline constexpr std::array<REL::ID, 1> __HarvestToMiscStatHandler{ REL::ID(192199) };
+		inline constexpr std::array<REL::ID, 1> __HavokThreadMemorySink{ REL::ID(303200) };
+		inline constexpr std::array<REL::ID, 1> __HoursPassedToMiscStatHandler{ REL::ID(290283) };
+		inline constexpr std::array<REL::ID, 1> __InactiveGraphCheckVisitor{ REL::ID(951640) };
+		inline constexpr std::array<REL::ID, 1> __InitGameDataThread{ REL::ID(692717) };
+		inline constexpr std::array<REL::ID, 1> __InitItemPerkRankDataVisitor{ REL::ID(1058912) };
+		inline constexpr std::array<REL::ID, 1> __InitialLoadListener{ REL::ID(1458786) };
+		inline constexpr std::array<REL::ID, 1> __InspectModeRepeatHandler{ REL::ID(898595) };
+		inline constexpr std::array<REL::ID, 1> __InternedStringRefCounted{ REL::ID(391182) };
+		inline constexpr std::array<REL::ID, 1> __InventoryKillStatHandler{ REL::ID(38006) };
+		inline constexpr std::array<REL::ID, 1> __InventoryToMiscStatHandler{ REL::ID(570382) };
+		inline constexpr std::array<REL::ID, 1> __IsClosedDoorOnPath{ REL::ID(887151) };
+		inline constexpr std::array<REL::ID, 1> __IsTeleportDoorOnPath{ REL::ID(229141) };
+		inline constexpr std::array<REL::ID, 1> __ItemCraftedToMiscStatHandler{ REL::ID(1326786) };
+		inline constexpr std::array<REL::ID, 1> __ItemPlacedToMiscStatHandler{ REL::ID(795194) };
+		inline constexpr std::array<REL::ID, 1> __ItemScrappedToMiscStatHandler{ REL::ID(1060880) };
+		inline constexpr std::array<REL::ID, 1> __ItemsPickpocketedToMiscStatHandler{ REL::ID(542930) };
+		inline constexpr std::array<REL::ID, 1> __ItemsStolenToMiscStatHandler{ REL::ID(10150) };
+		inline constexpr std::array<REL::ID, 1> __Jobber{ REL::ID(625966) };
+		inline constexpr std::array<REL::ID, 1> __JunkItemFoundStatHandler{ REL::ID(304134) };
+		inline constexpr std::array<REL::ID, 1> __LatentCallback{ REL::ID(166847) };
+		inline constexpr std::array<REL::ID, 1> __LevelIncreaseToMiscStatHandler{ REL::ID(920983) };
+		inline constexpr std::array<REL::ID, 1> __LinkedRefFinder{ REL::ID(105580) };
+		inline constexpr std::array<REL::ID, 1> __LoadGameListener{ REL::ID(1066466) };
+		inline constexpr std::array<REL::ID, 1> __LoadGameMissingContentCallBack{ REL::ID(272629) };
+		inline constexpr std::array<REL::ID, 1> __LoadWatcher{ REL::ID(513456) };
+		inline constexpr std::array<REL::ID, 1> __LocationDiscoveryMiscStatHandler{ REL::ID(1579315) };
+		inline constexpr std::array<REL::ID, 1> __LogWriteThread{ REL::ID(932991) };
+		inline constexpr std::array<REL::ID, 1> __LoggingDisabler{ REL::ID(559139) };
+		inline constexpr std::array<REL::ID, 1> __LooseAudioRegistrar{ REL::ID(550584) };
+		inline constexpr std::array<REL::ID, 1> __MainCullingCamera{ REL::ID(519680) };
+		inline constexpr std::array<REL::ID, 1> __MainStatusHandler{ REL::ID(93037) };
+		inline constexpr std::array<REL::ID, 1> __MemoryManagerFileFactory{ REL::ID(581810) };
+		inline constexpr std::array<REL::ID, 1> __MenuModeHandler__MenuModeCounterListener{ REL::ID(1514722) };
+		inline constexpr std::array<REL::ID, 1> __MessageMenuCallback{ REL::ID(1028666) };
+		inline constexpr std::array<REL::ID, 1> __MineDisarmedToMiscStatHandler{ REL::ID(529052) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_AssaultCrime__Event_{ REL::ID(515163) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_BobbleheadCollected__Event_{ REL::ID(781441) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_CorpseEaten__Event_{ REL::ID(1313113) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_InvestmentMade__Event_{ REL::ID(1033350) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_LocationCleared__Event_{ REL::ID(1299388) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_LocksPicked__Event_{ REL::ID(1565730) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_MurderCrime__Event_{ REL::ID(249267) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_RicochetHit__Event_{ REL::ID(767630) };
+		inline constexpr std::array<REL::ID, 1> __MiscStatIncrementer_SandmanKill__Event_{ REL::ID(1047208) };
+		inline constexpr std::array<REL::ID, 1> __ModConfirmCallback{ REL::ID(1244219) };
+		inline constexpr std::array<REL::ID, 1> __MonitorAPO{ REL::ID(800211) };
+		inline constexpr std::array<REL::ID, 1> __MovementControllerAIAdapter{ REL::ID(655837) };
+		inline constexpr std::array<REL::ID, 1> __MovementHandlerAgentAngleControllerLoadScrapper{ REL::ID(173331) };
+		inline constexpr std::array<REL::ID, 1> __MovementHandlerAgentLargeDeltaLoadScrapper{ REL::ID(957340) };
+		inline constexpr std::array<REL::ID, 1> __MovementHandlerAgentTranslationControllerLoadScrapper{ REL::ID(159477) };
+		inline constexpr std::array<REL::ID, 1> __MovementPlannerAgentHorseControlsLoadScrapper{ REL::ID(670384) };
+		inline constexpr std::array<REL::ID, 1> __MovementPlannerAgentKeepOffsetLoadScrapper{ REL::ID(1454484) };
+		inline constexpr std::array<REL::ID, 1> __MusicEventSink{ REL::ID(1332935) };
+		inline constexpr std::array<REL::ID, 1> __MysteriousStrangerToMiscStatHandler{ REL::ID(262962) };
+		inline constexpr std::array<REL::ID, 1> __NoExitSaveQuitConfirmCallBack{ REL::ID(327806) };
+		inline constexpr std::array<REL::ID, 1> __NoExitSaveQuitToDesktopConfirmCallBack{ REL::ID(985776) };
+		inline constexpr std::array<REL::ID, 1> __NoMusic{ REL::ID(282856) };
+		inline constexpr std::array<REL::ID, 1> __NonDialogSubCategory{ REL::ID(118615) };
+		inline constexpr std::array<REL::ID, 1> __NormalDoorFadeCallback{ REL::ID(1339816) };
+		inline constexpr std::array<REL::ID, 1> __ObjectConverter{ REL::ID(735609) };
+		inline constexpr std::array<REL::ID, 1> __ObjectFactoryVisitor{ REL::ID(699528) };
+		inline constexpr std::array<REL::ID, 1> __ObjectTypeFinder{ REL::ID(1356880) };
+		inline constexpr std::array<REL::ID, 1> __ObjectiveStateToMiscStatHandler{ REL::ID(1088414) };
+		inline constexpr std::array<REL::ID, 1> __ObsoleteSaveCallback{ REL::ID(930631) };
+		inline constexpr std::array<REL::ID, 1> __OutputInfoStream{ REL::ID(723728) };
+		inline constexpr std::array<REL::ID, 1> __PADataVisitor{ REL::ID(436023) };
+		inline constexpr std::array<REL::ID, 1> __PAFinder{ REL::ID(1313685) };
+		inline constexpr std::array<REL::ID, 1> __PathManagerServer{ REL::ID(247043) };
+		inline constexpr std::array<REL::ID, 1> __PathSmootherRayCastBuildNodesForLargeZDelta{ REL::ID(540712) };
+		inline constexpr std::array<REL::ID, 1> __PeekStreamReader{ REL::ID(436279) };
+		inline constexpr std::array<REL::ID, 1> __PhysicsWorldHandler{ REL::ID(456341) };
+		inline constexpr std::array<REL::ID, 1> __PlayerAddictedToMiscStatHandler{ REL::ID(1367953) };
+		inline constexpr std::array<REL::ID, 1> __PlayerCellListener{ REL::ID(408314) };
+		inline constexpr std::array<REL::ID, 1> __PlayerIDUpdater{ REL::ID(1243462) };
+		inline constexpr std::array<REL::ID, 1> __PlayerOPMMgr__HotloadRefresher{ REL::ID(590536) };
+		inline constexpr std::array<REL::ID, 1> __PreloadCountVisitor{ REL::ID(1187762) };
+		inline constexpr std::array<REL::ID, 1> __PreloadModelsVisitor{ REL::ID(263630) };
+		inline constexpr std::array<REL::ID, 1> __PrintPapyrusObjectsOnAliasToConsole{ REL::ID(405255) };
+		inline constexpr std::array<REL::ID, 1> __ProcessQueuePolicyBase___ReferenceQueuePolicy_{ REL::ID(1413699) };
+		inline constexpr std::array<REL::ID, 1> __ProcessQueuePolicyBase___TempEffectQueuePolicy_{ REL::ID(1227583) };
+		inline constexpr std::array<REL::ID, 1> __QualifyAsCurrentPackage{ REL::ID(695311) };
+		inline constexpr std::array<REL::ID, 1> __QuestStatusToMiscStatHandler{ REL::ID(1354272) };
+		inline constexpr std::array<REL::ID, 2> __QueuedBGSStaticCollection{ REL::ID(1349173), REL::ID(66083) };
+		inline constexpr std::array<REL::ID, 2> __QueuedMagicItem{ REL::ID(716492), REL::ID(1014866) };
+		inline constexpr std::array<REL::ID, 2> __QueuedSubBehaviorHandles{ REL::ID(510212), REL::ID(809224) };
+		inline constexpr std::array<REL::ID, 1> __RagdollKeyFrameHierarchyController{ REL::ID(1000655) };
+		inline constexpr std::array<REL::ID, 1> __RandomDialogueStoryEventProcessor{ REL::ID(1256139) };
+		inline constexpr std::array<REL::ID, 1> __ReferenceHandleProcessPolicy___ReferenceQueuePolicy_{ REL::ID(270551) };
+		inline constexpr std::array<REL::ID, 1> __RemoveLeveledExtraFunctor{ REL::ID(359702) };
+		inline constexpr std::array<REL::ID, 1> __RemoveUsedCountFunc{ REL::ID(1021518) };
+		inline constexpr std::array<REL::ID, 1> __RepairFailureCallback{ REL::ID(1364940) };
+		inline constexpr std::array<REL::ID, 1> __ResetJigglerWSModifiersFunctor{ REL::ID(1111754) };
+		inline constexpr std::array<REL::ID, 1> __RobotSelectionCallback{ REL::ID(997807) };
+		inline constexpr std::array<REL::ID, 1> __SaveDataRestoreFunctor{ REL::ID(652621) };
+		inline constexpr std::array<REL::ID, 1> __SceneActionResultsCallBack{ REL::ID(577413) };
+		inline constexpr std::array<REL::ID, 1> __ScenePhaseResultsCallBack{ REL::ID(690024) };
+		inline constexpr std::array<REL::ID, 1> __SceneResultsCallBack{ REL::ID(500798) };
+		inline constexpr std::array<REL::ID, 1> __ScrapItemCallback{ REL::ID(1510330) };
+		inline constexpr std::array<REL::ID, 1> __ScriptFoundCallback{ REL::ID(1057834) };
+		inline constexpr std::array<REL::ID, 1> __SearchLinkedRefChildrenFunctor{ REL::ID(763861) };
+		inline constexpr std::array<REL::ID, 1> __ServeJailTimeCallback{ REL::ID(1237384) };
+		inline constexpr std::array<REL::ID, 1> __SkipJumpNode{ REL::ID(1153106) };
+		inline constexpr std::array<REL::ID, 1> __SortIntersectingEdgesFunctor{ REL::ID(806714) };
+		inline constexpr std::array<REL::ID, 1> __SpeechChallengeSucceededStatHandler{ REL::ID(808858) };
+		inline constexpr std::array<REL::ID, 1> __StageItemFinishedCallback{ REL::ID(750584) };
+		inline constexpr std::array<REL::ID, 1> __StandardDetectionListener{ REL::ID(1129822) };
+		inline constexpr std::array<REL::ID, 1> __StateMachineSpeedInformationInitializationFunctor{ REL::ID(347040) };
+		inline constexpr std::array<REL::ID, 1> __StopHitEffectsVisitor{ REL::ID(1579132) };
+		inline constexpr std::array<REL::ID, 1> __StopStartEquipabilityFunctor{ REL::ID(1267550) };
+		inline constexpr std::array<REL::ID, 1> __SubGraphCharacterPropertySymbolMap{ REL::ID(705551) };
+		inline constexpr std::array<REL::ID, 1> __SubGraphEventSymbolMap{ REL::ID(798552) };
+		inline constexpr std::array<REL::ID, 1> __SubGraphVariableSymbolMap{ REL::ID(751963) };
+		inline constexpr std::array<REL::ID, 1> __SynchronizedClipNameVisitor{ REL::ID(561396) };
+		inline constexpr std::array<REL::ID, 1> __TESAudioInitialLoadListener{ REL::ID(982213) };
+		inline constexpr std::array<REL::ID, 1> __TESObjectREFRFactory{ REL::ID(760681) };
+		inline constexpr std::array<REL::ID, 1> __TempEffectProcessPolicy___TempEffectQueuePolicy_{ REL::ID(84000) };
+		inline constexpr std::array<REL::ID, 1> __TerminalsHackedToMiscStatHandler{ REL::ID(276729) };
+		inline constexpr std::array<REL::ID, 1> __TopicResultCallBack{ REL::ID(90804) };
+		inline constexpr std::array<REL::ID, 1> __TrespassToMiscStatHandler{ REL::ID(822521) };
+		inline constexpr std::array<REL::ID, 1> __UpdateAllDecalsRefFunctor{ REL::ID(846016) };
+		inline constexpr std::array<REL::ID, 2> __VATSFaceEmotionManager{ REL::ID(1130189), REL::ID(206314) };
+		inline constexpr std::array<REL::ID, 1> __VMInitThread{ REL::ID(1177789) };
+		inline constexpr std::array<REL::ID, 1> __VoiceTypeFinder{ REL::ID(1314671) };
+		inline constexpr std::array<REL::ID, 1> __Win32Impl{ REL::ID(1015321) };
+		inline constexpr std::array<REL::ID, 1> __WorkshopListener{ REL::ID(800742) };
+		inline constexpr std::array<REL::ID, 1> __bhkLifoAllocator{ REL::ID(277440) };
+		inline constexpr std::array<REL::ID, 1> __hkBSFinishGraphPhysicsUpdateTask{ REL::ID(1153564) };
+		inline constexpr std::array<REL::ID, 1> __hknpBSFootIKCollector{ REL::ID(795100) };
+		inline constexpr std::array<REL::ID, 1> __hknpBSHeightFieldShape{ REL::ID(882469) };
+		inline constexpr std::array<REL::ID, 1> __hknpBSIgnorePoseBoundForActorsInFurnitureCollector{ REL::ID(165405) };
+		inline constexpr std::array<REL::ID, 1> __hknpBSQuadOrientationCollector{ REL::ID(745571) };
+		inline constexpr std::array<REL::ID, 1> __hknpRagdollPenetrationHitCollector{ REL::ID(144283) };
+		inline constexpr std::array<REL::ID, 1> __hknpScaledConvexShapeScaleAndTransformCollector{ REL::ID(381657) };
+		inline constexpr std::array<REL::ID, 1> __iStateTaggingFunctor{ REL::ID(348671) };
+		inline constexpr std::array<REL::ID, 1> _com_error{ REL::ID(652039) };
+	}
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/N.h"
 #include "RE/NetImmerse/NiFlags.h"
 #include "RE/NetImmerse/NiProperty.h"
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/N.h"
+
 namespace RE
 {
 	class __declspec(novtable) NiBinaryStream
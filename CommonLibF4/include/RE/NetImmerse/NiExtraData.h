@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/BSFixedString.h"
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/N.h"
 #include "RE/NetImmerse/NiObject.h"
 
 namespace RE
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/Atomic.h"
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/N.h"
 #include "RE/NetImmerse/NiAVObject.h"
 #include "RE/NetImmerse/NiSmartPointer.h"
 #include "RE/NetImmerse/NiTArray.h"
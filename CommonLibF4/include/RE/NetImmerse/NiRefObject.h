@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RE/Bethesda/MemoryManager.h"
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/N.h"
 
 namespace RE
 {
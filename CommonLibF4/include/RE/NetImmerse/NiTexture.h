@@ -3,6 +3,8 @@
 #include "RE/Bethesda/BSFixedString.h"
 #include "RE/Bethesda/BSGraphics.h"
 #include "RE/Bethesda/BSTSmartPointer.h"
+#include "RE/IDs/RTTI/N.h"
+#include "RE/IDs/VTABLE/N.h"
 #include "RE/NetImmerse/NiObject.h"
 
 namespace RE
@@ -113,7 +113,7 @@ namespace RE
 	inline void* RTDynamicCast(void* a_inptr, std::int32_t a_vfDelta, void* a_srcType, void* a_targetType, std::int32_t a_isReference)
 	{
 		using func_t = decltype(&RTDynamicCast);
-		REL::Relocation<func_t> func{ REL::ID(84112) };
+		static REL::Relocation<func_t> func{ REL::ID(84112) };
 		return func(a_inptr, a_vfDelta, a_srcType, a_targetType, a_isReference);
 	}
 
@@ -204,8 +204,8 @@ namespace RE
 	To fallout_cast(From* a_from)  //
 		requires(detail::cast_is_valid_v<To, From*>)
 	{
-		REL::Relocation<void*> from{ detail::remove_cvpr_t<From>::RTTI };
-		REL::Relocation<void*> to{ detail::remove_cvpr_t<To>::RTTI };
+		static REL::Relocation<void*> from{ detail::remove_cvpr_t<From>::RTTI };
+		static REL::Relocation<void*> to{ detail::remove_cvpr_t<To>::RTTI };
 		return static_cast<To>(
 			RE::RTDynamicCast(
 				const_cast<void*>(
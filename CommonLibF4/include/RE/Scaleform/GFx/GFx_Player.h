@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/S.h"
 #include "RE/Scaleform/GFx/GFx_Loader.h"
 #include "RE/Scaleform/GFx/GFx_Log.h"
 #include "RE/Scaleform/GFx/GFx_Types.h"
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/S.h"
+
 namespace RE::Scaleform
 {
 	namespace Heap
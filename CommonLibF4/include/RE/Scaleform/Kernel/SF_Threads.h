@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/IDs/RTTI/S.h"
+#include "RE/IDs/VTABLE/S.h"
 #include "RE/Scaleform/Kernel/SF_Array.h"
 #include "RE/Scaleform/Kernel/SF_Atomic.h"
 #include "RE/Scaleform/Kernel/SF_RefCount.h"
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "RE/IDs/TypeTable.h"
+
+namespace RE
+{
+	namespace TYPE_IDS
+	{
+		// the identifier RTTIDump declares a type under, e.g. "BSTEventSink<TESHitEvent>" becomes "BSTEventSink_TESHitEvent_"
+		[[nodiscard]] inline std::string sanitize_name(std::string_view a_name)
+		{
+			constexpr std::string_view anonymous{ "`anonymous namespace'" };
+
+			std::string result;
+			result.reserve(a_name.size());
+			for (std::size_t i = 0; i < a_name.size(); ++i) {
+				if (a_name.substr(i).starts_with(anonymous)) {
+					i += anonymous.size() - 1;
+					continue;
+				}
+
+				switch (const auto ch = a_name[i]; ch) {
+				case ' ':
+				case '&':
+				case '\'':
+				case '*':
+				case '-':
+				case '`':
+					break;
+				case '(':
+				case ')':
+				case ',':
+				case ':':
+				case '<':
+				case '>':
+					result += '_';
+					break;
+				default:
+					result += ch;
+					break;
+				}
+			}
+
+			return result;
+		}
+
+		// looks up a type by the identifier it's declared under
+		[[nodiscard]] constexpr const entry_t* find(std::string_view a_name) noexcept
+		{
+			const auto it = std::lower_bound(
+				TABLE.begin(),
+				TABLE.end(),
+				a_name,
+				[](const entry_t& a_lhs, std::string_view a_rhs) {
+					return a_lhs.name < a_rhs;
+				});
+			return it != TABLE.end() && it->name == a_name ? std::addressof(*it) : nullptr;
+		}
+
+		// looks up a type by its demangled name, as printed by type_info::name or UnDecorateSymbolName
+		[[nodiscard]] inline const entry_t* find_demangled(std::string_view a_name)
+		{
+			return find(sanitize_name(a_name));
+		}
+	}
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <vector>
+
+// the on-disk layouts of the address library, shared by REL::IDDatabase, AddressLibGen and the offline
+// tools. this only needs the standard library, so the tools can include it without the rest of REL
+namespace REL::AddressLibrary
+{
+	struct mapping_t
+	{
+	public:
+		// members
+		std::uint64_t id;      // 00
+		std::uint64_t offset;  // 08
+	};
+	static_assert(sizeof(mapping_t) == 0x10);
+
+	// a raw library is the entry count followed by the entries, sorted by id
+	[[nodiscard]] inline bool parse_raw(std::span<const std::byte> a_data, std::span<const mapping_t>& a_out) noexcept
+	{
+		std::uint64_t count = 0;
+		if (a_data.size() < sizeof(count)) {
+			return false;
+		}
+		std::memcpy(std::addressof(count), a_data.data(), sizeof(count));
+
+		if ((a_data.size() - sizeof(count)) / sizeof(mapping_t) < count) {
+			return false;
+		}
+		a_out = std::span{ reinterpret_cast<const mapping_t*>(a_data.data() + sizeof(count)), static_cast<std::size_t>(count) };
+		return true;
+	}
+
+	// a compact library starts with a magic instead of the entry count, and stores delta encoded entries in
+	// fixed size blocks, which are indexed by their first entry. see AddressLibGen/README.md
+	class Compact
+	{
+	public:
+		struct header_t
+		{
+		public:
+			// members
+			std::uint64_t magic;       // 00
+			std::uint64_t count;       // 08
+			std::uint32_t blockSize;   // 10
+			std::uint32_t blockCount;  // 14
+		};
+		static_assert(sizeof(header_t) == 0x18);
+
+		struct block_t
+		{
+		public:
+			// members
+			std::uint64_t id;        // 00
+			std::uint64_t offset;    // 08
+			std::uint64_t position;  // 10 - of the varints for the remaining entries, from the start of the payload
+		};
+		static_assert(sizeof(block_t) == 0x18);
+
+		static constexpr std::uint64_t MAGIC = 0x31504D4342494C41;  // "ALIBCMP1"
+
+		[[nodiscard]] static bool is_compact(std::span<const std::byte> a_data) noexcept
+		{
+			std::uint64_t magic = 0;
+			if (a_data.size() < sizeof(magic)) {
+				return false;
+			}
+			std::memcpy(std::addressof(magic), a_data.data(), sizeof(magic));
+			return magic == MAGIC;
+		}
+
+		// checks the header and block index, but leaves the payload to decode_block
+		[[nodiscard]] bool parse(std::span<const std::byte> a_data) noexcept
+		{
+			if (a_data.size() < sizeof(_header)) {
+				return false;
+			}
+			std::memcpy(std::addressof(_header), a_data.data(), sizeof(_header));
+
+			const auto indexSize = std::size_t{ _header.blockCount } * sizeof(block_t);
+			if (_header.magic != MAGIC ||
+				_header.blockSize == 0 ||
+				a_data.size() - sizeof(_header) < indexSize ||
+				(_header.count + _header.blockSize - 1) / _header.blockSize != _header.blockCount) {
+				return false;
+			}
+
+			_blocks = std::span{ reinterpret_cast<const block_t*>(a_data.data() + sizeof(_header)), _header.blockCount };
+			_payload = a_data.subspan(sizeof(_header) + indexSize);
+
+			// every entry past the first of its block takes at least two bytes, which bounds what a
+			// damaged count can make decode allocate
+			return (_header.count - _header.blockCount) / 2 <= _payload.size();
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept { return static_cast<std::size_t>(_header.count); }
+		[[nodiscard]] std::size_t block_count() const noexcept { return _blocks.size(); }
+
+		// unpacks the a_idx-th block into its slots of a_out, which holds size() entries. blocks don't share
+		// state, so different blocks may be unpacked concurrently
+		[[nodiscard]] bool decode_block(std::size_t a_idx, std::span<mapping_t> a_out) const noexcept
+		{
+			const auto& block = _blocks[a_idx];
+			const auto first = a_idx * _header.blockSize;
+			const auto count = std::min<std::size_t>(_header.blockSize, a_out.size() - first);
+			const auto end = a_idx + 1 < _blocks.size() ? _blocks[a_idx + 1].position : _payload.size();
+			if (block.position > end || end > _payload.size()) {
+				return false;
+			}
+
+			auto it = reinterpret_cast<const std::uint8_t*>(_payload.data()) + block.position;
+			const auto last = reinterpret_cast<const std::uint8_t*>(_payload.data()) + end;
+			mapping_t elem{ block.id, block.offset };
+			a_out[first] = elem;
+			for (std::size_t i = 1; i < count; ++i) {
+				std::uint64_t id = 0;
+				std::uint64_t offset = 0;
+				if (!read_varint(it, last, id) || !read_varint(it, last, offset)) {
+					return false;
+				}
+				elem.id += id;
+				elem.offset += (offset >> 1) ^ (~(offset & 1) + 1);  // zigzag
+				a_out[first + i] = elem;
+			}
+
+			return true;
+		}
+
+		// unpacks every block in turn
+		[[nodiscard]] bool decode(std::vector<mapping_t>& a_out) const
+		{
+			a_out.resize(size());
+			for (std::size_t i = 0; i < block_count(); ++i) {
+				if (!decode_block(i, a_out)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+	private:
+		[[nodiscard]] static bool read_varint(const std::uint8_t*& a_it, const std::uint8_t* a_last, std::uint64_t& a_out) noexcept
+		{
+			if (a_it < a_last && *a_it < 0x80) {  // most deltas fit in a single byte
+				a_out = *a_it++;
+				return true;
+			}
+
+			std::uint64_t result = 0;
+			for (std::uint32_t shift = 0; a_it < a_last && shift < 64; shift += 7) {
+				const auto byte = *a_it++;
+				result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0) {
+					a_out = result;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		header_t _header{};
+		std::span<const block_t> _blocks;
+		std::span<const std::byte> _payload;
+	};
+
+	// reads either format, unpacking a compact library into a_storage
+	[[nodiscard]] inline bool parse(std::span<const std::byte> a_data, std::vector<mapping_t>& a_storage, std::span<const mapping_t>& a_out)
+	{
+		if (!Compact::is_compact(a_data)) {
+			return parse_raw(a_data, a_out);
+		}
+
+		Compact compact;
+		if (!compact.parse(a_data) || !compact.decode(a_storage)) {
+			return false;
+		}
+		a_out = a_storage;
+		return true;
+	}
+
+	// the offset sorted index AddressLibGen writes next to each library, which names the library it was
+	// written for so a stale one can be told apart
+	class OffsetIndex
+	{
+	public:
+		struct header_t
+		{
+		public:
+			// members
+			std::uint64_t magic;     // 00
+			std::uint64_t count;     // 08
+			std::uint64_t checksum;  // 10 - of the library's entries, in id order
+		};
+		static_assert(sizeof(header_t) == 0x18);
+
+		static constexpr std::uint64_t MAGIC = 0x3153464F42494C41;  // "ALIBOFS1"
+
+		// fnv-1a over whole words, which is plenty to tell libraries apart
+		[[nodiscard]] static std::uint64_t checksum(std::span<const mapping_t> a_id2offset) noexcept
+		{
+			std::uint64_t result = 0xCBF29CE484222325;
+			for (const auto& elem : a_id2offset) {
+				result = (result ^ elem.id) * 0x100000001B3;
+				result = (result ^ elem.offset) * 0x100000001B3;
+			}
+			return result;
+		}
+
+		// the entries, if a_data is an index written for a_id2offset
+		[[nodiscard]] static bool parse(std::span<const std::byte> a_data, std::span<const mapping_t> a_id2offset, std::span<const mapping_t>& a_out) noexcept
+		{
+			header_t header;
+			if (a_data.size() < sizeof(header)) {
+				return false;
+			}
+			std::memcpy(std::addressof(header), a_data.data(), sizeof(header));
+
+			if (header.magic != MAGIC ||
+				header.count != a_id2offset.size() ||
+				a_data.size() != sizeof(header) + a_id2offset.size_bytes() ||
+				header.checksum != checksum(a_id2offset)) {
+				return false;
+			}
+
+			a_out = std::span{ reinterpret_cast<const mapping_t*>(a_data.data() + sizeof(header)), a_id2offset.size() };
+			return true;
+		}
+	};
+}
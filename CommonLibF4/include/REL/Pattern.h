@@ -0,0 +1,278 @@
+#pragma once
+
+#include "REL/Relocation.h"
+
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#	include <immintrin.h>
+#endif
+
+namespace REL
+{
+	// a masked byte signature, written as hex bytes with ?? (or ?) for wildcards, e.g. "48 8B ?? ?? E8"
+	class Pattern
+	{
+	public:
+		explicit Pattern(std::string_view a_signature)
+		{
+			const auto hex = [](char a_ch) -> int {
+				if ('0' <= a_ch && a_ch <= '9') {
+					return a_ch - '0';
+				} else if ('A' <= a_ch && a_ch <= 'F') {
+					return a_ch - 'A' + 0xA;
+				} else if ('a' <= a_ch && a_ch <= 'f') {
+					return a_ch - 'a' + 0xA;
+				} else {
+					return -1;
+				}
+			};
+
+			std::size_t i = 0;
+			while (i < a_signature.size()) {
+				if (a_signature[i] == ' ') {
+					++i;
+				} else if (a_signature[i] == '?') {
+					i += a_signature.substr(i).starts_with("??"sv) ? 2 : 1;
+					_bytes.push_back(0);
+					_mask.push_back(false);
+				} else if (i + 1 < a_signature.size() && hex(a_signature[i]) >= 0 && hex(a_signature[i + 1]) >= 0) {
+					_bytes.push_back(static_cast<std::uint8_t>(hex(a_signature[i]) << 4 | hex(a_signature[i + 1])));
+					_mask.push_back(true);
+					i += 2;
+				} else {
+					stl::report_and_fail(fmt::format("malformed pattern: {}", a_signature));
+				}
+			}
+
+			if (std::find(_mask.begin(), _mask.end(), true) == _mask.end()) {
+				stl::report_and_fail(fmt::format("pattern has no concrete bytes: {}", a_signature));
+			}
+
+			// filter on the first pair of concrete bytes, or the first concrete byte if there is no pair
+			_anchor = static_cast<std::size_t>(std::find(_mask.begin(), _mask.end(), true) - _mask.begin());
+			for (std::size_t j = 0; j + 1 < _mask.size(); ++j) {
+				if (_mask[j] && _mask[j + 1]) {
+					_anchor = j;
+					_pair = true;
+					break;
+				}
+			}
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept { return _bytes.size(); }
+
+		[[nodiscard]] bool match(const std::byte* a_address) const noexcept
+		{
+			const auto bytes = reinterpret_cast<const std::uint8_t*>(a_address);
+			for (std::size_t i = 0; i < _bytes.size(); ++i) {
+				if (_mask[i] && bytes[i] != _bytes[i]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// returns the first match, or nullptr
+		[[nodiscard]] const std::byte* search(std::span<const std::byte> a_haystack) const noexcept
+		{
+			if (a_haystack.size() < size()) {
+				return nullptr;
+			}
+
+			std::size_t pos = 0;
+#if defined(__AVX2__)
+			if (const auto result = scan_avx2(a_haystack, pos); result) {
+				return result;
+			}
+#endif
+			if (const auto result = scan_sse2(a_haystack, pos); result) {
+				return result;
+			}
+			return search_scalar(a_haystack, pos);
+		}
+
+		[[nodiscard]] std::uintptr_t search(Segment a_segment) const noexcept
+		{
+			const auto result = search({ a_segment.pointer<const std::byte>(), a_segment.size() });
+			return reinterpret_cast<std::uintptr_t>(result);
+		}
+
+		// the reference implementation, which the vectorized scan must agree with
+		[[nodiscard]] const std::byte* search_scalar(std::span<const std::byte> a_haystack, std::size_t a_first = 0) const noexcept
+		{
+			if (a_haystack.size() < size()) {
+				return nullptr;
+			}
+
+			for (auto pos = a_first; pos <= a_haystack.size() - size(); ++pos) {
+				if (match(a_haystack.data() + pos)) {
+					return a_haystack.data() + pos;
+				}
+			}
+			return nullptr;
+		}
+
+	private:
+		friend class PatternSet;
+
+		// each scan compares the anchor bytes of a whole block of starts at once, and only verifies
+		// the full mask where they agree. a_pos is left at the first start the block loop didn't cover
+#if defined(__AVX2__)
+		[[nodiscard]] const std::byte* scan_avx2(std::span<const std::byte> a_haystack, std::size_t& a_pos) const noexcept
+		{
+			constexpr std::size_t width = 32;
+			const auto data = reinterpret_cast<const std::uint8_t*>(a_haystack.data());
+			const auto last = a_haystack.size() - size();
+			const auto first = _mm256_set1_epi8(static_cast<char>(_bytes[_anchor]));
+			const auto second = _mm256_set1_epi8(static_cast<char>(_pair ? _bytes[_anchor + 1] : 0));
+			for (; a_pos + width - 1 <= last; a_pos += width) {
+				const auto ptr = data + a_pos + _anchor;
+				auto eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)), first);
+				if (_pair) {
+					eq = _mm256_and_si256(eq, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 1)), second));
+				}
+				if (const auto result = verify(a_haystack, a_pos, static_cast<std::uint32_t>(_mm256_movemask_epi8(eq))); result) {
+					return result;
+				}
+			}
+			return nullptr;
+		}
+#endif
+
+		[[nodiscard]] const std::byte* scan_sse2(std::span<const std::byte> a_haystack, std::size_t& a_pos) const noexcept
+		{
+			constexpr std::size_t width = 16;
+			const auto data = reinterpret_cast<const std::uint8_t*>(a_haystack.data());
+			const auto last = a_haystack.size() - size();
+			const auto first = _mm_set1_epi8(static_cast<char>(_bytes[_anchor]));
+			const auto second = _mm_set1_epi8(static_cast<char>(_pair ? _bytes[_anchor + 1] : 0));
+			for (; a_pos + width - 1 <= last; a_pos += width) {
+				const auto ptr = data + a_pos + _anchor;
+				auto eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)), first);
+				if (_pair) {
+					eq = _mm_and_si128(eq, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 1)), second));
+				}
+				if (const auto result = verify(a_haystack, a_pos, static_cast<std::uint32_t>(_mm_movemask_epi8(eq))); result) {
+					return result;
+				}
+			}
+			return nullptr;
+		}
+
+		[[nodiscard]] const std::byte* verify(std::span<const std::byte> a_haystack, std::size_t a_pos, std::uint32_t a_candidates) const noexcept
+		{
+			for (; a_candidates != 0; a_candidates &= a_candidates - 1) {
+				const auto candidate = a_haystack.data() + a_pos + std::countr_zero(a_candidates);
+				if (match(candidate)) {
+					return candidate;
+				}
+			}
+			return nullptr;
+		}
+
+		std::vector<std::uint8_t> _bytes;
+		std::vector<bool> _mask;
+		std::size_t _anchor{ 0 };
+		bool _pair{ false };
+	};
+
+	// finds the first match of many patterns in a single pass, instead of one pass per pattern
+	class PatternSet
+	{
+	public:
+		explicit PatternSet(std::span<const Pattern> a_patterns) :
+			_patterns(a_patterns.begin(), a_patterns.end()),
+			_windows(_patterns.size(), NO_WINDOW)
+		{
+			// patterns are bucketed by a hash of their first four consecutive concrete bytes. a pair
+			// isn't selective enough here: code is dominated by a few opcodes, so a set of common pairs
+			// hits at a good fraction of all positions, while a bitset of occupied quad buckets rejects
+			// nearly everything with a single lookup
+			_offsets.assign(BUCKETS + 1, 0);
+			for (std::size_t i = 0; i < _patterns.size(); ++i) {
+				const auto& mask = _patterns[i]._mask;
+				for (std::size_t j = 0; j + WINDOW <= mask.size(); ++j) {
+					if (std::all_of(mask.begin() + j, mask.begin() + j + WINDOW, std::identity{})) {
+						_windows[i] = j;
+						++_offsets[hash(_patterns[i]._bytes.data() + j) + 1];
+						break;
+					}
+				}
+			}
+			std::inclusive_scan(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+			_buckets.resize(_offsets.back());
+			auto fill = _offsets;
+			for (std::uint32_t i = 0; i < _patterns.size(); ++i) {
+				if (_windows[i] != NO_WINDOW) {
+					const auto key = hash(_patterns[i]._bytes.data() + _windows[i]);
+					_buckets[fill[key]++] = i;
+					_filter.set(key);
+				}
+			}
+		}
+
+		// the first match of each pattern, in the order they were given, or nullptr
+		[[nodiscard]] std::vector<const std::byte*> search(std::span<const std::byte> a_haystack) const
+		{
+			std::vector<const std::byte*> results(_patterns.size(), nullptr);
+			std::size_t remaining = _buckets.size();
+			const auto data = reinterpret_cast<const std::uint8_t*>(a_haystack.data());
+			for (std::size_t pos = 0; remaining > 0 && pos + WINDOW <= a_haystack.size(); ++pos) {
+				const auto key = hash(data + pos);
+				if (!_filter.test(key)) {
+					continue;
+				}
+
+				for (auto it = _offsets[key]; it < _offsets[key + 1]; ++it) {
+					const auto idx = _buckets[it];
+					const auto& pattern = _patterns[idx];
+					if (results[idx] == nullptr && pos >= _windows[idx]) {
+						const auto start = pos - _windows[idx];
+						if (start + pattern.size() <= a_haystack.size() && pattern.match(a_haystack.data() + start)) {
+							results[idx] = a_haystack.data() + start;
+							--remaining;
+						}
+					}
+				}
+			}
+
+			// too many wildcards to bucket, so they get a pass of their own
+			for (std::size_t i = 0; i < _patterns.size(); ++i) {
+				if (_windows[i] == NO_WINDOW) {
+					results[i] = _patterns[i].search(a_haystack);
+				}
+			}
+
+			return results;
+		}
+
+		[[nodiscard]] std::vector<std::uintptr_t> search(Segment a_segment) const
+		{
+			const auto matches = search({ a_segment.pointer<const std::byte>(), a_segment.size() });
+			std::vector<std::uintptr_t> results(matches.size());
+			std::transform(matches.begin(), matches.end(), results.begin(), [](const std::byte* a_match) {
+				return reinterpret_cast<std::uintptr_t>(a_match);
+			});
+			return results;
+		}
+
+	private:
+		static constexpr std::size_t WINDOW = 4;
+		static constexpr std::size_t BUCKETS = 1u << 16;
+		static constexpr auto NO_WINDOW = static_cast<std::size_t>(-1);
+
+		[[nodiscard]] static std::uint32_t hash(const std::uint8_t* a_bytes) noexcept
+		{
+			std::uint32_t word;
+			std::memcpy(std::addressof(word), a_bytes, sizeof(word));
+			return (word * 0x9E3779B1u) >> 16;
+		}
+
+		std::vector<Pattern> _patterns;
+		std::vector<std::size_t> _windows;  // where each pattern's bucketed bytes start
+		std::bitset<BUCKETS> _filter;
+		std::vector<std::uint32_t> _offsets;  // bucket i is _buckets[_offsets[i], _offsets[i + 1])
+		std::vector<std::uint32_t> _buckets;
+	};
+}
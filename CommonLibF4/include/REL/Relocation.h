@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+
+#include "REL/AddressLibrary.h"
+
 #define REL_MAKE_MEMBER_FUNCTION_POD_TYPE_HELPER_IMPL(a_nopropQual, a_propQual, ...)              \
 	template <                                                                                    \
 		class R,                                                                                  \
@@ -403,9 +406,23 @@ namespace REL
 			return static_cast<T*>(pointer());
 		}
 
+		// makes get() map this image from disk instead of using the running process,
+		// must be called before the first call to get()
+		static void use_image(std::string_view a_path) { image_path() = a_path; }
+
+		// maps an image from disk, laid out the way the loader would, without running it
+		explicit Module(std::string_view a_path) { load_image(a_path); }
+
+		~Module() noexcept = default;
+
 	private:
 		Module()
 		{
+			if (const auto& path = image_path(); !path.empty()) {
+				load_image(path);
+				return;
+			}
+
 			const auto getFilename = [&]() {
 				return WinAPI::GetEnvironmentVariable(
 					ENVIRONMENT.data(),
@@ -423,8 +440,6 @@ namespace REL
 			load();
 		}
 
-		~Module() noexcept = default;
-
 		void load()
 		{
 			auto handle = WinAPI::GetModuleHandle(_filename.c_str());
@@ -440,6 +455,191 @@ namespace REL
 
 		void load_segments();
 
+		// the parts of the PE headers the image loader needs, laid out as in winnt.h
+		struct image_file_header_t
+		{
+			std::uint16_t machine;
+			std::uint16_t numberOfSections;
+			std::uint32_t timeDateStamp;
+			std::uint32_t pointerToSymbolTable;
+			std::uint32_t numberOfSymbols;
+			std::uint16_t sizeOfOptionalHeader;
+			std::uint16_t characteristics;
+		};
+		static_assert(sizeof(image_file_header_t) == 0x14);
+
+		struct image_section_header_t
+		{
+			char name[8];
+			std::uint32_t virtualSize;
+			std::uint32_t virtualAddress;
+			std::uint32_t sizeOfRawData;
+			std::uint32_t pointerToRawData;
+			std::uint32_t pointerToRelocations;
+			std::uint32_t pointerToLinenumbers;
+			std::uint16_t numberOfRelocations;
+			std::uint16_t numberOfLinenumbers;
+			std::uint32_t characteristics;
+		};
+		static_assert(sizeof(image_section_header_t) == 0x28);
+
+		static constexpr std::uint16_t DOS_SIGNATURE = 0x5A4D;     // MZ
+		static constexpr std::uint32_t NT_SIGNATURE = 0x00004550;  // PE\0\0
+		static constexpr std::uint16_t PE32_PLUS_MAGIC = 0x20B;
+		static constexpr std::uint32_t FIXED_FILE_INFO_SIGNATURE = 0xFEEF04BD;
+		static constexpr std::uint16_t RELOC_ABSOLUTE = 0;
+		static constexpr std::uint16_t RELOC_DIR64 = 10;
+
+		[[nodiscard]] static std::string& image_path()
+		{
+			static std::string path;
+			return path;
+		}
+
+		void load_image(std::string_view a_path)
+		{
+			mmio::mapped_file_source file;
+			if (!file.open(a_path)) {
+				stl::report_and_fail(fmt::format("failed to open: {}", a_path));
+			}
+
+			const auto fail = [&]() {
+				stl::report_and_fail(fmt::format("malformed image: {}", a_path));
+			};
+
+			// the file is untrusted, so every read is bounds checked and unaligned
+			const std::span bytes{ file.data(), file.size() };
+			const auto read = [&]<class T>(std::size_t a_offset, T& a_out) {
+				if (a_offset > bytes.size() || bytes.size() - a_offset < sizeof(T)) {
+					fail();
+				}
+				std::memcpy(std::addressof(a_out), bytes.data() + a_offset, sizeof(T));
+			};
+
+			std::uint16_t dosMagic = 0;
+			std::uint32_t ntOffset = 0;
+			read(0x0, dosMagic);
+			read(0x3C, ntOffset);  // e_lfanew
+			std::uint32_t ntMagic = 0;
+			read(ntOffset, ntMagic);
+			if (dosMagic != DOS_SIGNATURE || ntMagic != NT_SIGNATURE) {
+				fail();
+			}
+
+			image_file_header_t fileHeader;
+			read(ntOffset + 0x4, fileHeader);
+			const auto optOffset = ntOffset + 0x4 + sizeof(fileHeader);
+			std::uint16_t optMagic = 0;
+			std::uint32_t sizeOfImage = 0;
+			std::uint32_t sizeOfHeaders = 0;
+			std::uint64_t imageBase = 0;
+			std::uint32_t rsrcAddress = 0;
+			std::uint32_t rsrcSize = 0;
+			std::uint32_t relocAddress = 0;
+			std::uint32_t relocSize = 0;
+			read(optOffset, optMagic);
+			read(optOffset + 0x18, imageBase);
+			read(optOffset + 0x38, sizeOfImage);
+			read(optOffset + 0x3C, sizeOfHeaders);
+			read(optOffset + 0x70 + 2 * 0x8, rsrcAddress);  // IMAGE_DIRECTORY_ENTRY_RESOURCE
+			read(optOffset + 0x70 + 2 * 0x8 + 0x4, rsrcSize);
+			read(optOffset + 0x70 + 5 * 0x8, relocAddress);  // IMAGE_DIRECTORY_ENTRY_BASERELOC
+			read(optOffset + 0x70 + 5 * 0x8 + 0x4, relocSize);
+			if (optMagic != PE32_PLUS_MAGIC || sizeOfHeaders > sizeOfImage || sizeOfHeaders > bytes.size()) {
+				fail();
+			}
+
+			_image.assign(sizeOfImage, std::byte{ 0 });
+			std::memcpy(_image.data(), bytes.data(), sizeOfHeaders);
+			_base = reinterpret_cast<std::uintptr_t>(_image.data());
+
+			// copy each section's raw data to its rva, the remainder of its virtual size stays zeroed
+			const auto sectionOffset = optOffset + fileHeader.sizeOfOptionalHeader;
+			for (std::size_t i = 0; i < fileHeader.numberOfSections; ++i) {
+				image_section_header_t section;
+				read(sectionOffset + i * sizeof(section), section);
+				const auto rawSize = std::min(section.sizeOfRawData, section.virtualSize);
+				if (section.virtualAddress > sizeOfImage ||
+					sizeOfImage - section.virtualAddress < section.virtualSize ||
+					section.pointerToRawData > bytes.size() ||
+					bytes.size() - section.pointerToRawData < rawSize) {
+					fail();
+				}
+				std::memcpy(_image.data() + section.virtualAddress, bytes.data() + section.pointerToRawData, rawSize);
+
+				const std::string_view name{ section.name, std::find(section.name, std::end(section.name), '\0') };
+				const auto it = std::find(SEGMENTS.begin(), SEGMENTS.end(), name);
+				if (it != SEGMENTS.end()) {
+					const auto idx = static_cast<std::size_t>(std::distance(SEGMENTS.begin(), it));
+					_segments[idx] = Segment{ _base, _base + section.virtualAddress, section.virtualSize };
+				}
+			}
+
+			// absolute pointers were written for the preferred base, so rebase them onto the copy
+			if (relocAddress > sizeOfImage || sizeOfImage - relocAddress < relocSize) {
+				fail();
+			}
+			const auto delta = _base - imageBase;
+			for (std::size_t block = relocAddress; block + 0x8 <= relocAddress + relocSize;) {
+				std::uint32_t page = 0;
+				std::uint32_t blockSize = 0;
+				std::memcpy(std::addressof(page), _image.data() + block, sizeof(page));
+				std::memcpy(std::addressof(blockSize), _image.data() + block + 0x4, sizeof(blockSize));
+				if (blockSize < 0x8 || relocAddress + relocSize - block < blockSize) {
+					fail();
+				}
+
+				for (std::size_t entry = block + 0x8; entry + 0x2 <= block + blockSize; entry += 0x2) {
+					std::uint16_t reloc = 0;
+					std::memcpy(std::addressof(reloc), _image.data() + entry, sizeof(reloc));
+					const auto type = reloc >> 12;
+					const auto target = std::size_t{ page } + (reloc & 0xFFF);
+					if (type == RELOC_DIR64) {
+						if (target + sizeof(std::uint64_t) > sizeOfImage) {
+							fail();
+						}
+						std::uint64_t value = 0;
+						std::memcpy(std::addressof(value), _image.data() + target, sizeof(value));
+						value += delta;
+						std::memcpy(_image.data() + target, std::addressof(value), sizeof(value));
+					} else if (type != RELOC_ABSOLUTE) {
+						fail();
+					}
+				}
+
+				block += blockSize;
+			}
+
+			// the product version lives in the VS_FIXEDFILEINFO of the version resource
+			if (rsrcAddress > sizeOfImage || sizeOfImage - rsrcAddress < rsrcSize) {
+				fail();
+			}
+			const auto rsrc = std::span{ _image }.subspan(rsrcAddress, rsrcSize);
+			bool found = false;
+			for (std::size_t i = 0; !found && i + 0x18 <= rsrc.size(); i += 4) {
+				std::uint32_t signature = 0;
+				std::memcpy(std::addressof(signature), rsrc.data() + i, sizeof(signature));
+				if (signature == FIXED_FILE_INFO_SIGNATURE) {
+					std::uint32_t ms = 0;
+					std::uint32_t ls = 0;
+					std::memcpy(std::addressof(ms), rsrc.data() + i + 0x10, sizeof(ms));  // dwProductVersionMS
+					std::memcpy(std::addressof(ls), rsrc.data() + i + 0x14, sizeof(ls));  // dwProductVersionLS
+					_version = Version(
+						static_cast<std::uint16_t>(ms >> 16),
+						static_cast<std::uint16_t>(ms & 0xFFFF),
+						static_cast<std::uint16_t>(ls >> 16),
+						static_cast<std::uint16_t>(ls & 0xFFFF));
+					found = true;
+				}
+			}
+			if (!found) {
+				stl::report_and_fail("failed to obtain file version"sv);
+			}
+
+			const std::filesystem::path path{ a_path };
+			_filename = path.filename().wstring();
+		}
+
 		void load_version()
 		{
 			const auto version = get_file_version(_filename);
@@ -465,6 +665,7 @@ namespace REL
 		static inline std::uintptr_t _natvis{ 0 };
 
 		std::wstring _filename;
+		std::vector<std::byte> _image;
 		std::array<Segment, Segment::total> _segments;
 		Version _version;
 		std::uintptr_t _base{ 0 };
@@ -473,11 +674,7 @@ namespace REL
 	class IDDatabase
 	{
 	private:
-		struct mapping_t
-		{
-			std::uint64_t id;
-			std::uint64_t offset;
-		};
+		using mapping_t = AddressLibrary::mapping_t;
 
 	public:
 		IDDatabase(const IDDatabase&) = delete;
@@ -490,68 +687,160 @@ namespace REL
 		{
 		public:
 			using value_type = mapping_t;
-			using container_type = std::vector<value_type>;
+			using container_type = std::span<const value_type>;
 			using size_type = typename container_type::size_type;
-			using const_iterator = typename container_type::const_iterator;
-			using const_reverse_iterator = typename container_type::const_reverse_iterator;
+			using const_iterator = typename container_type::iterator;
+			using const_reverse_iterator = typename container_type::reverse_iterator;
+
+			struct symbol_t
+			{
+				std::uint64_t id;
+				std::uint64_t displacement;
+			};
 
 			template <class ExecutionPolicy>
 			explicit Offset2ID(ExecutionPolicy&& a_policy)  // NOLINT(bugprone-forwarding-reference-overload)
 				requires(std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>)
+				:
+				Offset2ID(IDDatabase::get(), std::forward<ExecutionPolicy>(a_policy))
+			{}
+
+			template <class ExecutionPolicy = std::execution::sequenced_policy>
+			explicit Offset2ID(const IDDatabase& a_database, ExecutionPolicy&& a_policy = {})
+				requires(std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>)
 			{
-				const auto id2offset = IDDatabase::get().get_id2offset();
-				_offset2id.reserve(id2offset.size());
-				_offset2id.insert(_offset2id.begin(), id2offset.begin(), id2offset.end());
-				std::sort(
-					a_policy,
-					_offset2id.begin(),
-					_offset2id.end(),
-					[](auto&& a_lhs, auto&& a_rhs) {
-						return a_lhs.offset < a_rhs.offset;
-					});
+				const auto id2offset = a_database.get_id2offset();
+				if (!load_index(a_database.reverse_path(), id2offset)) {
+					// no index was shipped with the library, so build one
+					_storage.reserve(id2offset.size());
+					_storage.insert(_storage.begin(), id2offset.begin(), id2offset.end());
+					std::sort(
+						a_policy,
+						_storage.begin(),
+						_storage.end(),
+						[](auto&& a_lhs, auto&& a_rhs) {
+							return a_lhs.offset < a_rhs.offset;
+						});
+					_offset2id = _storage;
+				}
+				build_radix();
 			}
 
 			Offset2ID() :
 				Offset2ID(std::execution::sequenced_policy{})
 			{}
 
+			Offset2ID(const Offset2ID&) = delete;
+			Offset2ID(Offset2ID&&) = delete;
+
+			~Offset2ID() = default;
+
+			Offset2ID& operator=(const Offset2ID&) = delete;
+			Offset2ID& operator=(Offset2ID&&) = delete;
+
+			// the id at exactly the given offset
 			[[nodiscard]] std::uint64_t operator()(std::size_t a_offset) const
 			{
-				if (_offset2id.empty()) {
-					stl::report_and_fail("data is empty"sv);
+				const auto symbol = nearest(a_offset);
+				if (symbol.displacement != 0) {
+					stl::report_and_fail(fmt::format("offset not found: {:X}", a_offset));
 				}
+				return symbol.id;
+			}
 
-				const mapping_t elem{ 0, a_offset };
-				const auto it = std::lower_bound(
-					_offset2id.begin(),
-					_offset2id.end(),
-					elem,
-					[](auto&& a_lhs, auto&& a_rhs) {
-						return a_lhs.offset < a_rhs.offset;
-					});
-				if (it == _offset2id.end()) {
-					stl::report_and_fail("offset not found"sv);
+			// the nearest entry at or before the given offset, for addresses inside a function
+			[[nodiscard]] symbol_t nearest(std::size_t a_offset) const
+			{
+				if (_offset2id.empty()) {
+					stl::report_and_fail("data is empty"sv);
+				} else if (a_offset < _offset2id.front().offset) {
+					stl::report_and_fail(fmt::format("offset not found: {:X}", a_offset));
 				}
 
-				return it->id;
+				// the entry owning the bucket's first offsets lives in the previous bucket
+				const auto bucket = std::min<std::size_t>((a_offset - _offset2id.front().offset) >> _shift, RADIX_SIZE - 1);
+				const auto first = _radix[bucket];
+				const auto it = std::upper_bound(
+					_offset2id.begin() + (first > 0 ? first - 1 : 0),
+					_offset2id.begin() + _radix[bucket + 1],
+					a_offset,
+					[](std::uint64_t a_lhs, const value_type& a_rhs) {
+						return a_lhs < a_rhs.offset;
+					}) - 1;
+				return { it->id, a_offset - it->offset };
 			}
 
 			[[nodiscard]] const_iterator begin() const noexcept { return _offset2id.begin(); }
-			[[nodiscard]] const_iterator cbegin() const noexcept { return _offset2id.cbegin(); }
+			[[nodiscard]] const_iterator cbegin() const noexcept { return _offset2id.begin(); }
 
 			[[nodiscard]] const_iterator end() const noexcept { return _offset2id.end(); }
-			[[nodiscard]] const_iterator cend() const noexcept { return _offset2id.cend(); }
+			[[nodiscard]] const_iterator cend() const noexcept { return _offset2id.end(); }
 
 			[[nodiscard]] const_reverse_iterator rbegin() const noexcept { return _offset2id.rbegin(); }
-			[[nodiscard]] const_reverse_iterator crbegin() const noexcept { return _offset2id.crbegin(); }
+			[[nodiscard]] const_reverse_iterator crbegin() const noexcept { return _offset2id.rbegin(); }
 
 			[[nodiscard]] const_reverse_iterator rend() const noexcept { return _offset2id.rend(); }
-			[[nodiscard]] const_reverse_iterator crend() const noexcept { return _offset2id.crend(); }
+			[[nodiscard]] const_reverse_iterator crend() const noexcept { return _offset2id.rend(); }
 
 			[[nodiscard]] size_type size() const noexcept { return _offset2id.size(); }
 
+			// whether the table was mapped from the index written by AddressLibGen
+			[[nodiscard]] bool mapped() const noexcept { return _mmap.is_open(); }
+
 		private:
+			static constexpr std::size_t RADIX_BITS = 16;
+			static constexpr std::size_t RADIX_SIZE = std::size_t{ 1 } << RADIX_BITS;
+
+			[[nodiscard]] bool load_index(std::string_view a_path, std::span<const value_type> a_id2offset)
+			{
+				if (!_mmap.open(a_path)) {
+					return false;
+				}
+
+				// an index written for some other library is ignored rather than trusted
+				if (!AddressLibrary::OffsetIndex::parse({ _mmap.data(), _mmap.size() }, a_id2offset, _offset2id)) {
+					_mmap.close();
+					return false;
+				}
+
+				return true;
+			}
+
+			// buckets the top bits of each offset, so a lookup only searches the entries sharing its bucket
+			void build_radix()
+			{
+				if (_offset2id.empty()) {
+					return;
+				}
+
+				const auto first = _offset2id.front().offset;
+				const auto range = _offset2id.back().offset - first;
+				_shift = static_cast<std::uint32_t>(std::max<std::ptrdiff_t>(std::bit_width(range) - static_cast<std::ptrdiff_t>(RADIX_BITS), 0));
+
+				_radix.resize(RADIX_SIZE + 1);
+				std::size_t idx = 0;
+				for (std::size_t bucket = 0; bucket < RADIX_SIZE; ++bucket) {
+					_radix[bucket] = static_cast<std::uint32_t>(idx);
+					while (idx < _offset2id.size() && ((_offset2id[idx].offset - first) >> _shift) <= bucket) {
+						++idx;
+					}
+				}
+				_radix[RADIX_SIZE] = static_cast<std::uint32_t>(_offset2id.size());
+			}
+
+			mmio::mapped_file_source _mmap;
+			std::vector<value_type> _storage;
 			container_type _offset2id;
+			std::vector<std::uint32_t> _radix;
+			std::uint32_t _shift{ 0 };
+		};
+
+		enum class Lookup : std::uint32_t
+		{
+			automatic,
+			binary_search,  // searches the mapped table directly, no extra memory
+			dense,          // one flat offset per id in [min id, max id]
+			eytzinger       // breadth-first ordered copy, for ranges too sparse to index densely
 		};
 
 		[[nodiscard]] static IDDatabase& get()
@@ -566,19 +855,183 @@ namespace REL
 				stl::report_and_fail("data is empty"sv);
 			}
 
-			const mapping_t elem{ a_id, 0 };
-			const auto it = std::lower_bound(
-				_id2offset.begin(),
-				_id2offset.end(),
-				elem,
-				[](auto&& a_lhs, auto&& a_rhs) {
-					return a_lhs.id < a_rhs.id;
-				});
-			if (it == _id2offset.end()) {
-				stl::report_and_fail("id not found"sv);
+			std::uint64_t result = 0;
+			bool found = false;
+			switch (_lookup) {
+			case Lookup::dense:
+				if (a_id - _denseBase < _dense.size()) {
+					result = _dense[static_cast<std::size_t>(a_id - _denseBase)];
+					found = result != DENSE_EMPTY;
+				}
+				break;
+			case Lookup::eytzinger:
+				{
+					std::size_t k = 1;
+					const auto last = _eytzinger.size() - 1;
+					while (k < _eytzinger.size()) {
+						// start pulling in the descendants 4 levels down
+						_mm_prefetch(reinterpret_cast<const char*>(_eytzinger.data() + std::min(16 * k, last)), _MM_HINT_T0);
+						k = 2 * k + static_cast<std::size_t>(_eytzinger[k].id < a_id);
+					}
+					k >>= std::countr_one(k) + 1;
+					if (k != 0 && _eytzinger[k].id == a_id) {
+						result = _eytzinger[k].offset;
+						found = true;
+					}
+				}
+				break;
+			default:
+				{
+					const mapping_t elem{ a_id, 0 };
+					const auto it = std::lower_bound(
+						_id2offset.begin(),
+						_id2offset.end(),
+						elem,
+						[](auto&& a_lhs, auto&& a_rhs) {
+							return a_lhs.id < a_rhs.id;
+						});
+					if (it != _id2offset.end() && it->id == a_id) {
+						result = it->offset;
+						found = true;
+					}
+				}
+				break;
+			}
+
+			if (!found) {
+				stl::report_and_fail(fmt::format("id not found: {}", a_id));
+			}
+
+			return static_cast<std::size_t>(result);
+		}
+
+		// resolves many ids in one forward pass over the table, instead of one search each,
+		// then reports every missing id at once
+		void id2offset(std::span<const std::uint64_t> a_ids, std::span<std::uint64_t> a_offsets) const
+		{
+			if (a_ids.size() != a_offsets.size()) {
+				stl::report_and_fail("id and offset counts differ"sv);
+			} else if (a_ids.empty()) {
+				return;
+			} else if (_id2offset.empty()) {
+				stl::report_and_fail("data is empty"sv);
+			}
+
+			std::vector<std::uint64_t> missing;
+			if (_lookup == Lookup::dense) {
+				for (std::size_t i = 0; i < a_ids.size(); ++i) {
+					const auto idx = a_ids[i] - _denseBase;
+					a_offsets[i] = idx < _dense.size() ? _dense[static_cast<std::size_t>(idx)] : DENSE_EMPTY;
+					if (a_offsets[i] == DENSE_EMPTY) {
+						missing.push_back(a_ids[i]);
+					}
+				}
+			} else {
+				std::vector<std::uint32_t> order(a_ids.size());
+				std::iota(order.begin(), order.end(), std::uint32_t{ 0 });
+				if (!std::is_sorted(a_ids.begin(), a_ids.end())) {
+					std::sort(order.begin(), order.end(), [&](std::uint32_t a_lhs, std::uint32_t a_rhs) {
+						return a_ids[a_lhs] < a_ids[a_rhs];
+					});
+				}
+
+				auto it = _id2offset.begin();
+				for (const auto idx : order) {
+					const auto id = a_ids[idx];
+
+					// gallop ahead, since the ids are usually sparse relative to the table
+					std::ptrdiff_t step = 1;
+					auto last = it;
+					while (last != _id2offset.end() && last->id < id) {
+						it = last;
+						last = step < _id2offset.end() - last ? last + step : _id2offset.end();
+						step *= 2;
+					}
+					it = std::lower_bound(it, last, id, [](const mapping_t& a_lhs, std::uint64_t a_rhs) {
+						return a_lhs.id < a_rhs;
+					});
+
+					if (it != _id2offset.end() && it->id == id) {
+						a_offsets[idx] = it->offset;
+					} else {
+						missing.push_back(id);
+					}
+				}
+			}
+
+			if (!missing.empty()) {
+				std::sort(missing.begin(), missing.end());
+				missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+				std::string ids;
+				for (const auto id : missing) {
+					ids += ids.empty() ? ""sv : ", "sv;
+					ids += std::to_string(id);
+				}
+				stl::report_and_fail(fmt::format("{} ids not found: {}", missing.size(), ids));
+			}
+		}
+
+		[[nodiscard]] Lookup lookup() const noexcept { return _lookup; }
+
+		// rebuilds the lookup tables, must not race with id2offset
+		void set_lookup(Lookup a_lookup)
+		{
+			_dense.clear();
+			_dense.shrink_to_fit();
+			_denseBase = 0;
+			_eytzinger.clear();
+			_eytzinger.shrink_to_fit();
+
+			if (_id2offset.empty()) {
+				_lookup = Lookup::binary_search;
+				return;
+			}
+
+			if (a_lookup == Lookup::automatic) {
+				// only go dense if the table is at most twice the size of the mapping itself
+				const auto range = _id2offset.back().id - _id2offset.front().id + 1;
+				const bool small = range * sizeof(std::uint32_t) <= _id2offset.size_bytes() * 2;
+				a_lookup = small && dense_compatible() ? Lookup::dense : Lookup::eytzinger;
+			} else if (a_lookup == Lookup::dense && !dense_compatible()) {
+				a_lookup = Lookup::eytzinger;
+			}
+
+			switch (a_lookup) {
+			case Lookup::dense:
+				_denseBase = _id2offset.front().id;
+				_dense.resize(static_cast<std::size_t>(_id2offset.back().id - _denseBase + 1), DENSE_EMPTY);
+				for (const auto& elem : _id2offset) {
+					_dense[static_cast<std::size_t>(elem.id - _denseBase)] = static_cast<std::uint32_t>(elem.offset);
+				}
+				break;
+			case Lookup::eytzinger:
+				{
+					_eytzinger.resize(_id2offset.size() + 1);  // 1-indexed
+					auto it = _id2offset.begin();
+					const auto fill = [&](auto&& a_self, std::size_t a_idx) -> void {
+						if (a_idx < _eytzinger.size()) {
+							a_self(a_self, 2 * a_idx);
+							_eytzinger[a_idx] = *it++;
+							a_self(a_self, 2 * a_idx + 1);
+						}
+					};
+					fill(fill, 1);
+				}
+				break;
+			default:
+				a_lookup = Lookup::binary_search;
+				break;
 			}
 
-			return static_cast<std::size_t>(it->offset);
+			_lookup = a_lookup;
+		}
+
+		// bytes held by the address library mapping and the active lookup tables
+		[[nodiscard]] std::size_t memory_usage() const noexcept
+		{
+			return _id2offset.size_bytes() +
+			       _dense.capacity() * sizeof(decltype(_dense)::value_type) +
+			       _eytzinger.capacity() * sizeof(decltype(_eytzinger)::value_type);
 		}
 
 	protected:
@@ -586,27 +1039,96 @@ namespace REL
 
 		[[nodiscard]] std::span<const mapping_t> get_id2offset() const noexcept { return _id2offset; }
 
-	private:
-		IDDatabase() { load(); }
+	public:
+		// loads an arbitrary address library, for tools that work on more than the running version
+		explicit IDDatabase(std::string_view a_path) { load(a_path); }
+
 		~IDDatabase() = default;
 
-		void load()
+		// AddressLibGen writes the offset sorted index next to the library
+		[[nodiscard]] std::string reverse_path() const
 		{
-			const auto version = Module::get().version();
-			const auto path = fmt::format(
+			std::string result = _path;
+			if (result.ends_with(".bin"sv)) {
+				result.erase(result.size() - 4);
+			}
+			result += ".offsets.bin"sv;
+			return result;
+		}
+
+	private:
+		IDDatabase() :
+			IDDatabase(fmt::format(
 				"Data/F4SE/Plugins/version-{}.bin",
-				version.string());
-			if (!_mmap.open(path)) {
-				stl::report_and_fail(fmt::format("failed to open: {}", path));
+				Module::get().version().string()))
+		{}
+
+		void load(std::string_view a_path)
+		{
+			_path = a_path;
+			if (!_mmap.open(a_path)) {
+				stl::report_and_fail(fmt::format("failed to open: {}", a_path));
 			}
-			_id2offset = std::span{
-				reinterpret_cast<const mapping_t*>(_mmap.data() + sizeof(std::uint64_t)),
-				*reinterpret_cast<const std::uint64_t*>(_mmap.data())
-			};
+
+			const std::span data{ _mmap.data(), _mmap.size() };
+			const bool good = AddressLibrary::Compact::is_compact(data) ?
+			                      load_compact(data) :
+			                      AddressLibrary::parse_raw(data, _id2offset);
+			if (!good) {
+				stl::report_and_fail(fmt::format("malformed address library: {}", a_path));
+			}
+
+			set_lookup(Lookup::automatic);
 		}
 
+		[[nodiscard]] bool load_compact(std::span<const std::byte> a_data)
+		{
+			AddressLibrary::Compact compact;
+			if (!compact.parse(a_data)) {
+				return false;
+			}
+
+			// the whole library is unpacked up front rather than a block per lookup, since the dense and
+			// eytzinger tables, batch resolution and Offset2ID all want every entry anyway. every block
+			// stands on its own, so they can be unpacked in parallel
+			_decoded.resize(compact.size());
+			std::vector<std::size_t> blocks(compact.block_count());
+			std::iota(blocks.begin(), blocks.end(), std::size_t{ 0 });
+			std::atomic_bool good{ true };
+			std::for_each(
+				std::execution::par,
+				blocks.begin(),
+				blocks.end(),
+				[&](std::size_t a_idx) noexcept {
+					if (!compact.decode_block(a_idx, _decoded)) {
+						good = false;
+					}
+				});
+
+			_id2offset = _decoded;
+			return good;
+		}
+
+		[[nodiscard]] bool dense_compatible() const noexcept
+		{
+			return std::all_of(
+				_id2offset.begin(),
+				_id2offset.end(),
+				[](auto&& a_elem) noexcept {
+					return a_elem.offset < DENSE_EMPTY;
+				});
+		}
+
+		static constexpr auto DENSE_EMPTY = std::numeric_limits<std::uint32_t>::max();
+
+		std::string _path;
 		mmio::mapped_file_source _mmap;
+		std::vector<mapping_t> _decoded;
 		std::span<const mapping_t> _id2offset;
+		Lookup _lookup{ Lookup::binary_search };
+		std::vector<std::uint32_t> _dense;
+		std::uint64_t _denseBase{ 0 };
+		std::vector<mapping_t> _eytzinger;
 	};
 
 	class Offset
@@ -658,6 +1180,32 @@ namespace REL
 		std::uint64_t _id{ static_cast<std::uint64_t>(-1) };
 	};
 
+	// resolves a table of ids, e.g. those declared in RTTI_IDs.h, in a single pass
+	inline void resolve(std::span<const ID> a_ids, std::span<std::uintptr_t> a_addresses)
+	{
+		if (a_ids.size() != a_addresses.size()) {
+			stl::report_and_fail("id and address counts differ"sv);
+		}
+
+		std::vector<std::uint64_t> ids(a_ids.size());
+		std::vector<std::uint64_t> offsets(a_ids.size());
+		std::transform(a_ids.begin(), a_ids.end(), ids.begin(), [](const ID& a_id) { return a_id.id(); });
+		IDDatabase::get().id2offset(ids, offsets);
+
+		const auto base = Module::get().base();
+		std::transform(offsets.begin(), offsets.end(), a_addresses.begin(), [&](std::uint64_t a_offset) {
+			return base + static_cast<std::uintptr_t>(a_offset);
+		});
+	}
+
+	template <std::size_t N>
+	[[nodiscard]] std::array<std::uintptr_t, N> resolve(const std::array<ID, N>& a_ids)
+	{
+		std::array<std::uintptr_t, N> result;
+		resolve(a_ids, result);
+		return result;
+	}
+
 	template <class T>
 	class Relocation
 	{
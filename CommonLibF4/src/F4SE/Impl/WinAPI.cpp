@@ -44,11 +44,15 @@
 
 #include <Windows.h>
 
+#include <Psapi.h>
+
+#undef EnumProcessModules
 #undef GetEnvironmentVariable
 #undef GetFileVersionInfo
 #undef GetFileVersionInfoSize
 #undef GetModuleFileName
 #undef GetModuleHandle
+#undef GetModuleInformation
 #undef MessageBox
 #undef OutputDebugString
 #undef VerQueryValue
@@ -57,6 +61,20 @@ extern "C" IMAGE_DOS_HEADER __ImageBase;  // NOLINT(bugprone-reserved-identifier
 
 namespace F4SE::WinAPI
 {
+	bool(EnumProcessModules)(
+		void* a_process,
+		void** a_modules,
+		std::uint32_t a_size,
+		std::uint32_t* a_needed) noexcept
+	{
+		return static_cast<bool>(
+			::K32EnumProcessModules(
+				static_cast<::HANDLE>(a_process),
+				reinterpret_cast<::HMODULE*>(a_modules),
+				static_cast<::DWORD>(a_size),
+				reinterpret_cast<::LPDWORD>(a_needed)));
+	}
+
 	void*(GetCurrentModule)() noexcept
 	{
 		return static_cast<void*>(
@@ -190,6 +208,20 @@ namespace F4SE::WinAPI
 				static_cast<::LPCWSTR>(a_moduleName)));
 	}
 
+	bool(GetModuleInformation)(
+		void* a_process,
+		void* a_module,
+		MODULEINFO* a_info,
+		std::uint32_t a_size) noexcept
+	{
+		return static_cast<bool>(
+			::K32GetModuleInformation(
+				static_cast<::HANDLE>(a_process),
+				static_cast<::HMODULE>(a_module),
+				reinterpret_cast<::LPMODULEINFO>(a_info),
+				static_cast<::DWORD>(a_size)));
+	}
+
 	void*(GetProcAddress)(void* a_module,
 		const char* a_procName) noexcept
 	{
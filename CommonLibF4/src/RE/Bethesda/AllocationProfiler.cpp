@@ -0,0 +1,198 @@
+#include "RE/Bethesda/AllocationProfiler.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace RE
+{
+	namespace
+	{
+		struct ProfilerState
+		{
+		public:
+			void drain()
+			{
+				detail::drain_rings(rings, file);
+				file.flush();
+			}
+
+			// members
+			std::mutex lock;
+			std::vector<std::unique_ptr<detail::SampleRing>> rings;
+			std::ofstream file;
+			std::jthread flusher;
+		};
+
+		struct Module
+		{
+		public:
+			// members
+			AllocationProfiler::ModuleHeader header;
+			std::string name;
+		};
+
+		// every module in the process, so the report can name the image each call site lies in
+		[[nodiscard]] std::vector<Module> get_loaded_modules()
+		{
+			const auto process = WinAPI::GetCurrentProcess();
+			std::vector<void*> handles;
+			std::uint32_t needed = 0x100 * sizeof(void*);
+			do {
+				handles.resize(needed / sizeof(void*));
+				if (!WinAPI::EnumProcessModules(process, handles.data(), static_cast<std::uint32_t>(handles.size() * sizeof(void*)), std::addressof(needed))) {
+					return {};
+				}
+			} while (needed > handles.size() * sizeof(void*));
+			handles.resize(needed / sizeof(void*));
+
+			std::vector<Module> result;
+			std::vector<wchar_t> path(WinAPI::GetMaxPath());
+			for (const auto handle : handles) {
+				WinAPI::MODULEINFO info;
+				if (!WinAPI::GetModuleInformation(process, handle, std::addressof(info), sizeof(info))) {
+					continue;
+				}
+
+				const auto length = WinAPI::GetModuleFileName(handle, path.data(), static_cast<std::uint32_t>(path.size()));
+				const auto name = std::filesystem::path(std::wstring_view{ path.data(), length }).filename().u8string();
+				auto& module = result.emplace_back();
+				module.name.assign(reinterpret_cast<const char*>(name.data()), name.size());
+				module.header.base = reinterpret_cast<std::uint64_t>(info.lpBaseOfDll);
+				module.header.size = info.SizeOfImage;
+				module.header.nameLength = static_cast<std::uint32_t>(module.name.size());
+				module.header.pad14 = 0;
+			}
+			return result;
+		}
+
+		[[nodiscard]] ProfilerState& get_state()
+		{
+			static ProfilerState singleton;
+			return singleton;
+		}
+
+		// kept trivial, so allocations made while the thread tears down can still check them
+		thread_local detail::SampleRing* threadRing{ nullptr };
+		thread_local bool threadExiting{ false };
+		thread_local bool threadPushing{ false };
+
+		struct RingRetirer
+		{
+		public:
+			~RingRetirer()
+			{
+				threadExiting = true;
+				if (const auto ring = std::exchange(threadRing, nullptr)) {
+					ring->retired.store(true, std::memory_order_release);
+				}
+			}
+		};
+
+		thread_local RingRetirer ringRetirer;
+	}
+
+	bool AllocationProfiler::Start(const std::filesystem::path& a_path, std::uint32_t a_sampleRate)
+	{
+		auto& state = get_state();
+		const std::scoped_lock l{ state.lock };
+		if (IsRunning()) {
+			return false;
+		}
+
+		state.file.open(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!state.file) {
+			return false;
+		}
+
+		const auto& module = REL::Module::get();
+		const auto text = module.segment(REL::Segment::text);
+		FileHeader header;
+		header.ticksPerSecond = std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num;
+		header.imageBase = module.base();
+		header.textBegin = text.address();
+		header.textEnd = text.address() + text.size();
+		header.sampleRate = std::max<std::uint32_t>(a_sampleRate, 1);
+
+		const auto modules = get_loaded_modules();
+		header.moduleCount = static_cast<std::uint32_t>(modules.size());
+		state.file.write(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+		for (const auto& elem : modules) {
+			state.file.write(reinterpret_cast<const char*>(std::addressof(elem.header)), sizeof(elem.header));
+			state.file.write(elem.name.data(), static_cast<std::streamsize>(elem.name.size()));
+		}
+
+		_sampleRate.store(header.sampleRate, std::memory_order_relaxed);
+		_running.store(true, std::memory_order_release);
+
+		state.flusher = std::jthread([](std::stop_token a_stop) {
+			std::mutex mutex;
+			std::condition_variable_any wake;
+			while (!a_stop.stop_requested()) {
+				{
+					std::unique_lock sleep{ mutex };
+					wake.wait_for(sleep, a_stop, std::chrono::milliseconds(50), [] { return false; });
+				}
+
+				auto& state = get_state();
+				const std::scoped_lock l{ state.lock };
+				state.drain();
+			}
+		});
+		return true;
+	}
+
+	void AllocationProfiler::Stop()
+	{
+		auto& state = get_state();
+		std::jthread flusher;
+		{
+			const std::scoped_lock l{ state.lock };
+			if (!IsRunning()) {
+				return;
+			}
+			_running.store(false, std::memory_order_release);
+			flusher = std::move(state.flusher);
+		}
+
+		flusher.request_stop();
+		flusher.join();
+
+		const std::scoped_lock l{ state.lock };
+		state.drain();
+		state.file.close();
+	}
+
+	void AllocationProfiler::Push(Kind a_kind, std::size_t a_size, std::size_t a_alignment, const void* a_returnAddress) noexcept
+	{
+		// making the ring allocates, which must not come back around to here
+		if (threadExiting || threadPushing) {
+			return;
+		}
+
+		threadPushing = true;
+		const stl::scope_exit done{ [&]() noexcept { threadPushing = false; } };
+
+		if (!threadRing) {
+			try {
+				auto ring = std::make_unique<detail::SampleRing>(WinAPI::GetCurrentThreadID());
+				static_cast<void>(std::addressof(ringRetirer));
+
+				auto& state = get_state();
+				const std::scoped_lock l{ state.lock };
+				threadRing = ring.get();
+				state.rings.push_back(std::move(ring));
+			} catch (...) {
+				return;
+			}
+		}
+
+		threadRing->push({ static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()),
+			reinterpret_cast<std::uint64_t>(a_returnAddress),
+			static_cast<std::uint32_t>(std::min<std::size_t>(a_size, std::numeric_limits<std::uint32_t>::max())),
+			static_cast<std::uint16_t>(std::min<std::size_t>(a_alignment, std::numeric_limits<std::uint16_t>::max())),
+			a_kind,
+			0 });
+	}
+}
@@ -4,6 +4,68 @@
 	return iddb;
 }
 
+// indexes every rtti reference in .rdata in one pass, so each type descriptor can be resolved
+// with lookups instead of rescanning the segment
+class RDataIndex
+{
+public:
+	using col_t = const RE::RTTI::CompleteObjectLocator*;
+
+	[[nodiscard]] static const RDataIndex& get()
+	{
+		static RDataIndex singleton;
+		return singleton;
+	}
+
+	[[nodiscard]] std::span<const col_t> complete_object_locators(const RE::RTTI::TypeDescriptor* a_typeDesc) const
+	{
+		const auto rva = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(a_typeDesc) - REL::Module::get().base());
+		const auto it = _cols.find(rva);
+		return it != _cols.end() ? std::span<const col_t>{ it->second } : std::span<const col_t>{};
+	}
+
+	// the slots holding a pointer to the given col, which sit just before a vtable
+	[[nodiscard]] std::span<const std::uintptr_t* const> references(col_t a_col) const
+	{
+		const auto it = _references.find(reinterpret_cast<std::uintptr_t>(a_col));
+		return it != _references.end() ? std::span<const std::uintptr_t* const>{ it->second } : std::span<const std::uintptr_t* const>{};
+	}
+
+private:
+	RDataIndex()
+	{
+		const auto& mod = REL::Module::get();
+		const auto data = mod.segment(REL::Segment::data);
+		const auto rdata = mod.segment(REL::Segment::rdata);
+		const auto in_data = [&](std::uint32_t a_rva) { return data.offset() <= a_rva && a_rva < data.offset() + data.size(); };
+		const auto in_rdata = [&](std::uint32_t a_rva) { return rdata.offset() <= a_rva && a_rva < rdata.offset() + rdata.size(); };
+
+		const auto base = rdata.pointer<const std::byte>();
+		const auto dwords = std::span{ reinterpret_cast<const std::uint32_t*>(base), rdata.size() / sizeof(std::uint32_t) };
+		for (std::size_t i = 0; i + 1 < dwords.size(); ++i) {
+			// both base class desc and col can point to the type desc so we check
+			// the next int to see if it can be an rva to decide which type it is
+			if (in_data(dwords[i]) && in_rdata(dwords[i + 1])) {
+				const auto ptr = reinterpret_cast<const std::byte*>(dwords.data() + i);
+				const auto col = reinterpret_cast<col_t>(ptr - offsetof(RE::RTTI::CompleteObjectLocator, typeDescriptor));
+				_cols[dwords[i]].push_back(col);
+				_references.emplace(reinterpret_cast<std::uintptr_t>(col), std::vector<const std::uintptr_t*>{});
+			}
+		}
+
+		// only pointers to a candidate col are kept
+		const auto qwords = std::span{ reinterpret_cast<const std::uintptr_t*>(base), rdata.size() / sizeof(std::uintptr_t) };
+		for (const auto& qword : qwords) {
+			if (const auto it = _references.find(qword); it != _references.end()) {
+				it->second.push_back(std::addressof(qword));
+			}
+		}
+	}
+
+	robin_hood::unordered_flat_map<std::uint32_t, std::vector<col_t>> _cols;
+	robin_hood::unordered_flat_map<std::uintptr_t, std::vector<const std::uintptr_t*>> _references;
+};
+
 class VTable
 {
 public:
@@ -21,8 +83,26 @@ public:
 
 	VTable(const RE::RTTI::TypeDescriptor* a_typeDescriptor)
 	{
-		auto cols = complete_object_locators(a_typeDescriptor);
-		_vtables = virtual_tables({ cols.data(), cols.size() });
+		assert(a_typeDescriptor != nullptr);
+
+		const auto& index = RDataIndex::get();
+		const auto cols = index.complete_object_locators(a_typeDescriptor);
+		for (const auto col : cols) {
+			for (const auto ref : index.references(col)) {
+				_vtables.emplace_back(reinterpret_cast<std::uintptr_t>(ref + 1));
+			}
+		}
+
+		if (_vtables.size() != cols.size()) {
+			throw std::runtime_error("failed to find virtual tables"s);
+		}
+
+		std::sort(
+			_vtables.begin(),
+			_vtables.end(),
+			[](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.address() < a_rhs.address();
+			});
 	}
 
 	[[nodiscard]] reference operator[](std::size_t a_idx) noexcept { return _vtables[a_idx]; }
@@ -54,73 +134,6 @@ private:
 		}
 	}
 
-	[[nodiscard]] static std::vector<const RE::RTTI::CompleteObjectLocator*> complete_object_locators(const RE::RTTI::TypeDescriptor* a_typeDesc)
-	{
-		assert(a_typeDesc != nullptr);
-
-		const auto& mod = REL::Module::get();
-		const auto typeDesc = reinterpret_cast<std::uintptr_t>(a_typeDesc);
-		const auto rva = static_cast<std::uint32_t>(typeDesc - mod.base());
-
-		const auto segment = mod.segment(REL::Segment::rdata);
-		const auto base = segment.pointer<const std::byte>();
-		const auto start = reinterpret_cast<const std::uint32_t*>(base);
-		const auto end = reinterpret_cast<const std::uint32_t*>(base + segment.size());
-
-		std::vector<const RE::RTTI::CompleteObjectLocator*> results;
-
-		for (auto iter = start; iter < end; ++iter) {
-			if (*iter == rva) {
-				// both base class desc and col can point to the type desc so we check
-				// the next int to see if it can be an rva to decide which type it is
-				if ((iter[1] < segment.offset()) || (segment.offset() + segment.size() <= iter[1])) {
-					continue;
-				}
-
-				const auto ptr = reinterpret_cast<const std::byte*>(iter);
-				const auto col = reinterpret_cast<const RE::RTTI::CompleteObjectLocator*>(ptr - offsetof(RE::RTTI::CompleteObjectLocator, typeDescriptor));
-				results.push_back(col);
-			}
-		}
-
-		return results;
-	}
-
-	[[nodiscard]] static container_type virtual_tables(std::span<const RE::RTTI::CompleteObjectLocator*> a_cols)
-	{
-		assert(std::all_of(a_cols.begin(), a_cols.end(), [](auto&& a_elem) noexcept { return a_elem != nullptr; }));
-
-		const auto segment = REL::Module::get().segment(REL::Segment::rdata);
-		const auto base = segment.pointer<const std::byte>();
-		const auto start = reinterpret_cast<const std::uintptr_t*>(base);
-		const auto end = reinterpret_cast<const std::uintptr_t*>(base + segment.size());
-
-		container_type results;
-
-		for (auto iter = start; iter < end; ++iter) {
-			if (std::find_if(
-					a_cols.begin(),
-					a_cols.end(),
-					[&](const RE::RTTI::CompleteObjectLocator* a_col) noexcept {
-						return *iter == reinterpret_cast<std::uintptr_t>(a_col);
-					}) != a_cols.end()) {
-				results.emplace_back(reinterpret_cast<std::uintptr_t>(iter + 1));
-			}
-		}
-
-		if (results.size() != a_cols.size()) {
-			throw std::runtime_error("failed to find virtual tables"s);
-		} else {
-			std::sort(
-				results.begin(),
-				results.end(),
-				[](auto&& a_lhs, auto&& a_rhs) {
-					return a_lhs.address() < a_rhs.address();
-				});
-			return results;
-		}
-	}
-
 	container_type _vtables;
 };
 
@@ -200,12 +213,31 @@ void dump_rtti()
 	const auto beg = data.pointer<const std::uintptr_t>();
 	const auto end = reinterpret_cast<const std::uintptr_t*>(data.address() + data.size());
 	const auto& iddb = get_iddb();
+
+	// UnDecorateSymbolName is not thread safe, so names are decoded up front
+	std::vector<std::pair<const RE::RTTI::TypeDescriptor*, std::string>> typeDescriptors;
 	for (auto iter = beg; iter < end; ++iter) {
 		if (*iter == typeInfo[0].address()) {
 			const auto typeDescriptor = reinterpret_cast<const RE::RTTI::TypeDescriptor*>(iter);
 			try {
-				auto name = decode_name(typeDescriptor);
-				const auto rid = iddb(reinterpret_cast<std::uintptr_t>(iter) - baseAddr);
+				typeDescriptors.emplace_back(typeDescriptor, decode_name(typeDescriptor));
+			} catch (const std::exception&) {
+				logger::error("failed to decode type descriptor at {:X}", reinterpret_cast<std::uintptr_t>(iter) - baseAddr);
+			}
+		}
+	}
+
+	(void)RDataIndex::get();  // build it once, before the workers need it
+	std::vector<std::optional<std::tuple<std::string, std::uint64_t, std::vector<std::uint64_t>>>> resolved(typeDescriptors.size());
+	std::transform(
+		std::execution::par,
+		typeDescriptors.begin(),
+		typeDescriptors.end(),
+		resolved.begin(),
+		[&](const auto& a_elem) -> typename decltype(resolved)::value_type {
+			const auto& [typeDescriptor, name] = a_elem;
+			try {
+				const auto rid = iddb(reinterpret_cast<std::uintptr_t>(typeDescriptor) - baseAddr);
 
 				VTable vtable{ typeDescriptor };
 				std::vector<std::uint64_t> vids(vtable.size());
@@ -213,13 +245,19 @@ void dump_rtti()
 					vtable.begin(),
 					vtable.end(),
 					vids.begin(),
-					[&](auto&& a_elem) { return iddb(a_elem.offset()); });
+					[&](auto&& a_vtable) { return iddb(a_vtable.offset()); });
 
-				results.emplace_back(sanitize_name(std::move(name)), rid, std::move(vids));
+				return std::make_tuple(sanitize_name(name), rid, std::move(vids));
 			} catch (const std::exception&) {
-				logger::error("{}", decode_name(typeDescriptor));
-				continue;
+				return std::nullopt;
 			}
+		});
+
+	for (std::size_t i = 0; i < resolved.size(); ++i) {
+		if (resolved[i]) {
+			results.push_back(std::move(*resolved[i]));
+		} else {
+			logger::error("{}", typeDescriptors[i].second);
 		}
 	}
 
@@ -246,14 +284,22 @@ void dump_rtti()
 			}),
 		results.end());
 
+	// each class header only includes the shard its name falls in, so shards are keyed on something
+	// that doesn't move when types are added, and folded to upper case for case insensitive filesystems
+	const auto shard = [](std::string_view a_name) {
+		const auto ch = static_cast<unsigned char>(a_name.front());
+		return std::isalpha(ch) ? static_cast<char>(std::toupper(ch)) : '_';
+	};
+
 	std::ofstream file;
-	const auto openf = [&](std::string_view a_name) {
-		file.open(a_name.data() + "_IDs.h"s);
+	const auto openf = [&](const std::filesystem::path& a_path, std::string_view a_namespace) {
+		std::filesystem::create_directories(a_path.parent_path());
+		file.open(a_path);
 		file << "#pragma once\n"sv
 			 << "\n"sv
 			 << "namespace RE\n"sv
 			 << "{\n"sv
-			 << "\tnamespace "sv << a_name << "\n"sv
+			 << "\tnamespace "sv << a_namespace << "\n"sv
 			 << "\t{\n"sv;
 	};
 	const auto closef = [&]() {
@@ -262,32 +308,93 @@ void dump_rtti()
 		file.close();
 	};
 
-	openf("RTTI"sv);
-	for (const auto& [name, rid, vids] : results) {
-		(void)vids;
-		file << "\t\tinline constexpr REL::ID "sv << name << "{ "sv << rid << " };\n"sv;
+	std::map<char, std::vector<typename decltype(results)::value_type>> shards;
+	for (const auto& result : results) {
+		shards[shard(std::get<0>(result))].push_back(result);
 	}
-	closef();
 
-	openf("VTABLE"sv);
+	const auto printUmbrella = [&](std::string_view a_name) {
+		file.open(fmt::format("{}_IDs.h", a_name));
+		file << "#pragma once\n"sv
+			 << "\n"sv;
+		for (const auto& [key, elems] : shards) {
+			if (a_name != "VTABLE"sv ||
+				std::any_of(elems.begin(), elems.end(), [](auto&& a_elem) { return !std::get<2>(a_elem).empty(); })) {
+				file << "#include \"RE/IDs/"sv << a_name << "/"sv << key << ".h\"\n"sv;
+			}
+		}
+		file.close();
+	};
+
+	for (const auto& [key, elems] : shards) {
+		openf(fmt::format("IDs/RTTI/{}.h", key), "RTTI"sv);
+		for (const auto& [name, rid, vids] : elems) {
+			(void)vids;
+			file << "\t\tinline constexpr REL::ID "sv << name << "{ "sv << rid << " };\n"sv;
+		}
+		closef();
+	}
+	printUmbrella("RTTI"sv);
+
 	const auto printVID = [&](std::uint64_t a_vid) { file << "REL::ID("sv << a_vid << ")"sv; };
+	for (const auto& [key, elems] : shards) {
+		if (std::all_of(elems.begin(), elems.end(), [](auto&& a_elem) { return std::get<2>(a_elem).empty(); })) {
+			continue;
+		}
+
+		openf(fmt::format("IDs/VTABLE/{}.h", key), "VTABLE"sv);
+		for (const auto& [name, rid, vids] : elems) {
+			(void)rid;
+			const std::span svids{ vids.data(), vids.size() };
+			if (!svids.empty()) {
+				file << "\t\tinline constexpr std::array<REL::ID, "sv
+					 << vids.size()
+					 << "> "sv
+					 << name
+					 << "{ "sv;
+				printVID(svids.front());
+				for (const auto vid : svids.subspan(1)) {
+					file << ", "sv;
+					printVID(vid);
+				}
+				file << " };\n"sv;
+			}
+		}
+		closef();
+	}
+	printUmbrella("VTABLE"sv);
+
+	// the name table for lookups by string, see RE/TypeIDs.h
+	file.open("IDs/TypeTable.h");
+	file << "#pragma once\n"sv
+		 << "\n"sv
+		 << "#include \"RE/RTTI_IDs.h\"\n"sv
+		 << "#include \"RE/VTABLE_IDs.h\"\n"sv
+		 << "\n"sv
+		 << "namespace RE\n"sv
+		 << "{\n"sv
+		 << "\tnamespace TYPE_IDS\n"sv
+		 << "\t{\n"sv
+		 << "\t\tstruct entry_t\n"sv
+		 << "\t\t{\n"sv
+		 << "\t\t\tstd::string_view name;\n"sv
+		 << "\t\t\tREL::ID rtti;\n"sv
+		 << "\t\t\tstd::span<const REL::ID> vtable;\n"sv
+		 << "\t\t};\n"sv
+		 << "\n"sv
+		 << "\t\t// sorted by name\n"sv
+		 << "\t\tinline constexpr std::array<entry_t, "sv << results.size() << "> TABLE{ {\n"sv;
 	for (const auto& [name, rid, vids] : results) {
 		(void)rid;
-		const std::span svids{ vids.data(), vids.size() };
-		if (!svids.empty()) {
-			file << "\t\tinline constexpr std::array<REL::ID, "sv
-				 << vids.size()
-				 << "> "sv
-				 << name
-				 << "{ "sv;
-			printVID(svids.front());
-			for (const auto vid : svids.subspan(1)) {
-				file << ", "sv;
-				printVID(vid);
-			}
-			file << " };\n"sv;
+		file << "\t\t\t{ std::string_view{ \""sv << name << "\" }, RTTI::"sv << name << ", "sv;
+		if (!vids.empty()) {
+			file << "VTABLE::"sv << name;
+		} else {
+			file << "{}"sv;
 		}
+		file << " },\n"sv;
 	}
+	file << "\t\t} };\n"sv;
 	closef();
 }
 
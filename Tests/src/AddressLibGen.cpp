@@ -0,0 +1,166 @@
+#include "Mappings.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	using library_t = std::map<std::uint64_t, std::uint64_t>;  // offset to id
+
+	inline constexpr std::array VERSIONS{
+		Version({ 1, 10, 130, 0 }),
+		Version({ 1, 10, 138, 0 }),
+		Version({ 1, 10, 162, 0 }),
+		Version({ 1, 10, 163, 0 }),
+	};
+
+	// functions appear in some version and may drop out in a later one, and their offsets shuffle
+	// between versions, as they do across real patches. the last version is left out unless asked for
+	[[nodiscard]] links_t make_links(bool a_withLatest)
+	{
+		constexpr std::size_t FUNCTIONS = 3000;
+		std::mt19937 rng(7);
+		std::vector<std::array<std::uint64_t, VERSIONS.size()>> offsets(FUNCTIONS);
+		std::vector<std::pair<std::size_t, std::size_t>> lifetimes(FUNCTIONS);
+		for (std::size_t v = 0; v < VERSIONS.size(); ++v) {
+			std::vector<std::uint64_t> slots(FUNCTIONS);
+			std::iota(slots.begin(), slots.end(), std::uint64_t{ 0 });
+			std::shuffle(slots.begin(), slots.end(), rng);
+			for (std::size_t f = 0; f < FUNCTIONS; ++f) {
+				offsets[f][v] = 0x1000 + slots[f] * 0x10;
+			}
+		}
+		for (auto& [first, last] : lifetimes) {
+			first = rng() % VERSIONS.size();
+			last = first + rng() % (VERSIONS.size() - first);
+		}
+
+		links_t links;
+		const auto count = a_withLatest ? VERSIONS.size() : VERSIONS.size() - 1;
+		for (std::size_t v = 0; v + 1 < count; ++v) {
+			auto& link = links.emplace_back();
+			link.lversion = VERSIONS[v];
+			link.rversion = VERSIONS[v + 1];
+			for (std::size_t f = 0; f < FUNCTIONS; ++f) {
+				if (lifetimes[f].first <= v && v + 1 <= lifetimes[f].second) {
+					link.offsets.emplace_back(offsets[f][v], offsets[f][v + 1]);
+				}
+			}
+		}
+		return links;
+	}
+
+	[[nodiscard]] std::map<Version, library_t> generate(const links_t& a_links, const seed_map& a_seeds, Assignment& a_assignment)
+	{
+		auto [map, sets] = link_mappings(a_links);
+		a_assignment = assign_ids(map, sets, a_seeds);
+
+		std::map<Version, library_t> result;
+		for (const auto& [ver, offsetMap] : map) {
+			auto& library = result[ver];
+			for (const auto& [offset, id] : offsetMap) {
+				library.emplace(offset, id);
+			}
+		}
+		return result;
+	}
+
+	[[nodiscard]] seed_map make_seeds(const std::map<Version, library_t>& a_libraries)
+	{
+		seed_map result;
+		for (const auto& [ver, library] : a_libraries) {
+			auto& seed = result[ver];
+			for (const auto& [offset, id] : library) {
+				seed.push_back({ id, offset });
+			}
+			std::sort(seed.begin(), seed.end(), [](auto&& a_lhs, auto&& a_rhs) { return a_lhs.id < a_rhs.id; });
+		}
+		return result;
+	}
+
+	// an id names the same function in every version it appears in, and only that one
+	void check_consistent(const links_t& a_links, const std::map<Version, library_t>& a_libraries)
+	{
+		for (const auto& [lver, rver, offsets] : a_links) {
+			const auto& llibrary = a_libraries.at(lver);
+			const auto& rlibrary = a_libraries.at(rver);
+			for (const auto& [loffset, roffset] : offsets) {
+				REQUIRE(llibrary.at(loffset) == rlibrary.at(roffset));
+			}
+		}
+
+		for (const auto& [ver, library] : a_libraries) {
+			std::set<std::uint64_t> ids;
+			for (const auto& [offset, id] : library) {
+				REQUIRE(ids.insert(id).second);
+			}
+		}
+	}
+}
+
+TEST_CASE("test address library id assignment")
+{
+	Assignment assignment;
+	const auto links = make_links(false);
+	const auto fresh = generate(links, {}, assignment);
+	REQUIRE(assignment.seeded == 0);
+	check_consistent(links, fresh);
+
+	// a library numbered some other way, standing in for one made by an older version of the tool
+	auto known = fresh;
+	for (auto& [ver, library] : known) {
+		for (auto& [offset, id] : library) {
+			id = 100000 - id * 3;
+		}
+	}
+
+	// regenerating from the same mappings changes nothing
+	const auto regenerated = generate(links, make_seeds(known), assignment);
+	REQUIRE(regenerated == known);
+	REQUIRE(assignment.fresh == 0);
+	REQUIRE(assignment.conflicts == 0);
+
+	// a new version keeps every published id, and numbers what it adds past the highest of them
+	const auto latest = make_links(true);
+	const auto extended = generate(latest, make_seeds(known), assignment);
+	check_consistent(latest, extended);
+	REQUIRE(assignment.fresh > 0);
+	REQUIRE(assignment.conflicts == 0);
+	REQUIRE(extended.size() == VERSIONS.size());
+	std::set<std::uint64_t> knownIDs;
+	for (const auto& [ver, library] : known) {
+		for (const auto& [offset, id] : library) {
+			knownIDs.insert(id);
+		}
+	}
+	for (const auto& [ver, library] : extended) {
+		const auto it = known.find(ver);
+		for (const auto& [offset, id] : library) {
+			INFO(ver.string() << " " << offset);
+			if (it != known.end() && it->second.contains(offset)) {
+				REQUIRE(id == it->second.at(offset));
+			} else if (!knownIDs.contains(id)) {  // the latest version carries over ids for what it shares
+				REQUIRE(id > 100000);
+			}
+		}
+	}
+
+	// when the seed gave two functions one id, the first keeps it and the clash is reported
+	auto clash = known;
+	auto& first = clash.begin()->second;
+	const auto collide = first.begin()->second;
+	std::next(first.begin())->second = collide;
+	const auto clashed = generate(links, make_seeds(clash), assignment);
+	REQUIRE(assignment.conflicts > 0);
+	const auto& library = clashed.at(clash.begin()->first);
+	REQUIRE(std::ranges::count(library, collide, [](const auto& a_elem) { return a_elem.second; }) == 1);
+}
+
+TEST_CASE("benchmark address library id assignment")
+{
+	const auto links = make_links(true);
+	BENCHMARK("link and assign")
+	{
+		auto [map, sets] = link_mappings(links);
+		return assign_ids(map, sets).fresh;
+	};
+}
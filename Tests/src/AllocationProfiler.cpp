@@ -0,0 +1,329 @@
+#include "RE/Bethesda/AllocationProfiler.h"
+
+#include "Profile.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	using Kind = RE::AllocationProfiler::Kind;
+	using Sample = RE::AllocationProfiler::Sample;
+	using SampleRing = RE::detail::SampleRing;
+
+	constexpr std::uint32_t CAPACITY = SampleRing::CAPACITY;
+
+	// the report reads what the profiler writes
+	static_assert(sizeof(RE::AllocationProfiler::FileHeader) == sizeof(profile::FileHeader));
+	static_assert(sizeof(RE::AllocationProfiler::ModuleHeader) == sizeof(profile::ModuleHeader));
+	static_assert(sizeof(RE::AllocationProfiler::BatchHeader) == sizeof(profile::BatchHeader));
+	static_assert(sizeof(Sample) == sizeof(profile::Sample));
+	static_assert(offsetof(Sample, kind) == offsetof(profile::Sample, kind));
+	static_assert(RE::AllocationProfiler::MAGIC == profile::MAGIC);
+	static_assert(static_cast<std::size_t>(Kind::kAlignedFree) + 1 == profile::KINDS.size());
+
+	[[nodiscard]] Sample make_sample(std::uint64_t a_timestamp, std::uint64_t a_address = 0x1000, std::uint32_t a_size = 0x10, Kind a_kind = Kind::kMalloc, std::uint16_t a_alignment = 0)
+	{
+		return { a_timestamp, a_address, a_size, a_alignment, a_kind, 0 };
+	}
+
+	struct batch_t
+	{
+		std::vector<Sample> samples;
+		std::size_t spans{ 0 };
+		std::uint32_t dropped{ 0 };
+	};
+
+	// what one drain handed over, or nothing if it never called back
+	[[nodiscard]] std::optional<batch_t> drain(SampleRing& a_ring)
+	{
+		std::optional<batch_t> result;
+		a_ring.drain([&](std::span<const Sample> a_first, std::span<const Sample> a_second, std::uint32_t a_dropped) {
+			REQUIRE(!result);
+			auto& batch = result.emplace();
+			batch.samples.assign(a_first.begin(), a_first.end());
+			batch.samples.insert(batch.samples.end(), a_second.begin(), a_second.end());
+			batch.spans = a_second.empty() ? 1 : 2;
+			batch.dropped = a_dropped;
+		});
+		return result;
+	}
+
+	void check_sequence(const batch_t& a_batch, std::uint64_t a_first, std::size_t a_count)
+	{
+		REQUIRE(a_batch.samples.size() == a_count);
+		for (std::size_t i = 0; i < a_count; ++i) {
+			REQUIRE(a_batch.samples[i].timestamp == a_first + i);
+		}
+	}
+
+	// the header and module table, as Start writes them
+	[[nodiscard]] std::string make_header(std::initializer_list<Module> a_modules = {})
+	{
+		RE::AllocationProfiler::FileHeader header;
+		header.ticksPerSecond = 1000;
+		header.imageBase = 0x140000000;
+		header.textBegin = 0x140001000;
+		header.textEnd = 0x142000000;
+		header.sampleRate = 4;
+		header.moduleCount = static_cast<std::uint32_t>(a_modules.size());
+		std::string result{ reinterpret_cast<const char*>(std::addressof(header)), sizeof(header) };
+
+		for (const auto& module : a_modules) {
+			const RE::AllocationProfiler::ModuleHeader entry{ module.base, module.size, static_cast<std::uint32_t>(module.name.size()), 0 };
+			result.append(reinterpret_cast<const char*>(std::addressof(entry)), sizeof(entry));
+			result += module.name;
+		}
+		return result;
+	}
+
+	void write_batch(std::string& a_out, std::uint32_t a_threadID, std::span<const Sample> a_samples, std::uint32_t a_dropped = 0)
+	{
+		const RE::AllocationProfiler::BatchHeader header{ a_threadID, static_cast<std::uint32_t>(a_samples.size()), a_dropped, 0 };
+		a_out.append(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+		a_out.append(reinterpret_cast<const char*>(a_samples.data()), a_samples.size_bytes());
+	}
+
+	[[nodiscard]] Profile aggregate(std::string_view a_data)
+	{
+		return ::aggregate(std::as_bytes(std::span{ a_data }));
+	}
+}
+
+TEST_CASE("test allocation profiler ring")
+{
+	const auto ring = std::make_unique<SampleRing>(7);
+	REQUIRE(!drain(*ring));
+
+	std::uint64_t next = 0;
+	const auto push = [&](std::size_t a_count) {
+		for (std::size_t i = 0; i < a_count; ++i) {
+			ring->push(make_sample(next++));
+		}
+	};
+
+	// what was pushed comes back in order, in one span while it doesn't reach the end of the storage
+	push(3000);
+	auto batch = drain(*ring);
+	REQUIRE(batch);
+	REQUIRE(batch->spans == 1);
+	REQUIRE(batch->dropped == 0);
+	check_sequence(*batch, 0, 3000);
+	REQUIRE(!drain(*ring));
+
+	// and in two once it wraps around
+	push(3000);
+	batch = drain(*ring);
+	REQUIRE(batch);
+	REQUIRE(batch->spans == 2);
+	check_sequence(*batch, 3000, 3000);
+
+	// a full ring keeps what it has and counts the rest, until it's drained
+	push(CAPACITY + 10);
+	batch = drain(*ring);
+	REQUIRE(batch);
+	REQUIRE(batch->dropped == 10);
+	check_sequence(*batch, 6000, CAPACITY);
+
+	next = 0;
+	push(1);
+	batch = drain(*ring);
+	REQUIRE(batch);
+	REQUIRE(batch->dropped == 0);
+	check_sequence(*batch, 0, 1);
+}
+
+TEST_CASE("test allocation profiler ring concurrency")
+{
+	const auto ring = std::make_unique<SampleRing>(7);
+	constexpr std::uint64_t COUNT = 200000;
+	std::atomic_bool done{ false };
+	std::thread producer([&]() {
+		for (std::uint64_t i = 0; i < COUNT; ++i) {
+			ring->push(make_sample(i));
+		}
+		done.store(true, std::memory_order_release);
+	});
+
+	// samples may be dropped, but those that arrive do so once and in order
+	std::uint64_t received = 0;
+	std::uint64_t dropped = 0;
+	std::uint64_t last = 0;
+	bool ordered = true;
+	const auto consume = [&]() {
+		ring->drain([&](std::span<const Sample> a_first, std::span<const Sample> a_second, std::uint32_t a_dropped) {
+			for (const auto span : { a_first, a_second }) {
+				for (const auto& sample : span) {
+					ordered = ordered && (received == 0 || sample.timestamp > last);
+					last = sample.timestamp;
+					++received;
+				}
+			}
+			dropped += a_dropped;
+		});
+	};
+	while (!done.load(std::memory_order_acquire)) {
+		consume();
+	}
+	producer.join();
+	consume();
+
+	REQUIRE(ordered);
+	REQUIRE(received + dropped == COUNT);
+	REQUIRE(received > 0);
+}
+
+TEST_CASE("test allocation profiler ring retirement")
+{
+	std::vector<std::unique_ptr<SampleRing>> rings;
+	for (std::uint32_t id = 1; id <= 3; ++id) {
+		rings.push_back(std::make_unique<SampleRing>(id));
+	}
+	rings[0]->push(make_sample(1, 0x140001000));
+	rings[1]->push(make_sample(2, 0x140002000));
+
+	// a retired ring is drained a last time, then forgotten, whether it had anything left or not
+	rings[1]->retired = true;
+	rings[2]->retired = true;
+	std::ostringstream out;
+	out << make_header();
+	RE::detail::drain_rings(rings, out);
+	REQUIRE(rings.size() == 1);
+	REQUIRE(rings[0]->threadID == 1);
+
+	// rings with nothing to say write nothing
+	const auto size = out.str().size();
+	REQUIRE(size == sizeof(RE::AllocationProfiler::FileHeader) + 2 * (sizeof(RE::AllocationProfiler::BatchHeader) + sizeof(Sample)));
+	RE::detail::drain_rings(rings, out);
+	REQUIRE(out.str().size() == size);
+
+	// and what was written reads back
+	for (std::uint32_t i = 0; i < CAPACITY + 3; ++i) {
+		rings[0]->push(make_sample(10 + i, 0x140001000));
+	}
+	rings[0]->retired = true;
+	RE::detail::drain_rings(rings, out);
+	REQUIRE(rings.empty());
+
+	const auto profile = aggregate(out.str());
+	REQUIRE(profile.samples == CAPACITY + 2);
+	REQUIRE(profile.dropped == 3);
+	REQUIRE(profile.threads == 2);
+	REQUIRE(profile.sites.size() == 2);
+	REQUIRE(profile.sites[0].address == 0x140001000);
+	REQUIRE(profile.sites[0].total() == CAPACITY + 1);
+	REQUIRE(profile.sites[1].address == 0x140002000);
+	REQUIRE(profile.sites[1].total() == 1);
+}
+
+TEST_CASE("test allocation report")
+{
+	auto data = make_header();
+	const std::array first{
+		make_sample(50, 0x140001000, 0x20, Kind::kMalloc),
+		make_sample(51, 0x140002000, 0x100, Kind::kAlignedAlloc, 0x40),
+		make_sample(52, 0x140001000, 0x08, Kind::kCalloc),
+		make_sample(53, 0x140001000, 0, Kind::kFree),
+	};
+	const std::array second{
+		make_sample(40, 0x7FF000000000, 0x400, Kind::kRealloc),
+		make_sample(60, 0x140002000, 0x80, Kind::kAlignedRealloc, 0x80),
+		make_sample(61, 0x140002000, 0, Kind::kAlignedFree),
+	};
+	write_batch(data, 1, first, 2);
+	write_batch(data, 2, second);
+	write_batch(data, 1, {}, 5);
+
+	const auto profile = aggregate(data);
+	REQUIRE(profile.header.sampleRate == 4);
+	REQUIRE(profile.header.imageBase == 0x140000000);
+	REQUIRE(profile.samples == 7);
+	REQUIRE(profile.dropped == 7);
+	REQUIRE(profile.threads == 2);
+	REQUIRE(profile.firstTick == 40);
+	REQUIRE(profile.lastTick == 61);
+
+	// one site per call site, in the order they were first seen, and frees add to neither bytes nor sizes
+	REQUIRE(profile.sites.size() == 3);
+	const auto& a = profile.sites[0];
+	REQUIRE(a.address == 0x140001000);
+	REQUIRE(a.samples == std::array<std::uint64_t, 7>{ 1, 1, 0, 0, 0, 1, 0 });
+	REQUIRE(a.bytes == 0x28);
+	REQUIRE(a.minSize == 0x08);
+	REQUIRE(a.maxSize == 0x20);
+	REQUIRE(a.maxAlignment == 0);
+
+	const auto& b = profile.sites[1];
+	REQUIRE(b.address == 0x140002000);
+	REQUIRE(b.total() == 3);
+	REQUIRE(b.bytes == 0x180);
+	REQUIRE(b.minSize == 0x80);
+	REQUIRE(b.maxSize == 0x100);
+	REQUIRE(b.maxAlignment == 0x80);
+
+	const auto& c = profile.sites[2];
+	REQUIRE(c.address == 0x7FF000000000);
+	REQUIRE(c.samples[static_cast<std::size_t>(Kind::kRealloc)] == 1);
+
+	// a header alone is an empty profile
+	const auto empty = aggregate(make_header());
+	REQUIRE(empty.samples == 0);
+	REQUIRE(empty.sites.empty());
+	REQUIRE(empty.threads == 0);
+	REQUIRE(empty.modules.empty());
+}
+
+TEST_CASE("test allocation report modules")
+{
+	auto data = make_header({
+		{ 0x7FF800000000, 0x40000, "MyPlugin.dll" },
+		{ 0x140000000, 0x4000000, "Fallout4.exe" },
+		{ 0x7FF700000000, 0x10000, "" },
+	});
+	write_batch(data, 1, std::array{ make_sample(1, 0x7FF800001234) });
+
+	// read back in base order, however they were listed
+	const auto profile = aggregate(data);
+	REQUIRE(profile.modules.size() == 3);
+	REQUIRE(profile.modules[0].name == "Fallout4.exe");
+	REQUIRE(profile.modules[1].name.empty());
+	REQUIRE(profile.modules[2].name == "MyPlugin.dll");
+	REQUIRE(profile.samples == 1);
+
+	// an address belongs to the module whose image holds it, if any
+	REQUIRE(profile.module_at(0x7FF800001234) == std::addressof(profile.modules[2]));
+	REQUIRE(profile.module_at(0x7FF800000000) == std::addressof(profile.modules[2]));
+	REQUIRE(profile.module_at(0x7FF800040000) == nullptr);
+	REQUIRE(profile.module_at(0x7FF70000FFFF) == std::addressof(profile.modules[1]));
+	REQUIRE(profile.module_at(0x143FFFFFF) == std::addressof(profile.modules[0]));
+	REQUIRE(profile.module_at(0x13FFFFFFF) == nullptr);
+	REQUIRE(profile.module_at(0x7FF7FFFFFFFF) == nullptr);
+
+	// the table is checked before any batch, entry and name alike
+	const auto table = make_header({ { 0x7FF800000000, 0x40000, "MyPlugin.dll" } });
+	REQUIRE_NOTHROW(aggregate(table));
+	REQUIRE_THROWS_WITH(aggregate(std::string_view{ table }.substr(0, sizeof(RE::AllocationProfiler::FileHeader) + 8)), "truncated module table");
+	REQUIRE_THROWS_WITH(aggregate(std::string_view{ table }.substr(0, table.size() - 1)), "truncated module table");
+}
+
+TEST_CASE("test allocation report malformed")
+{
+	const auto header = make_header();
+	REQUIRE_THROWS_WITH(aggregate(""sv), "truncated header");
+	REQUIRE_THROWS_WITH(aggregate(std::string_view{ header }.substr(0, header.size() - 1)), "truncated header");
+
+	auto data = header;
+	data[0] = 'X';
+	REQUIRE_THROWS_WITH(aggregate(data), "not an allocation profile");
+
+	// a batch header cut short, and one claiming more samples than follow it
+	const std::array samples{ make_sample(1), make_sample(2) };
+	data = header;
+	write_batch(data, 1, samples);
+	REQUIRE_NOTHROW(aggregate(data));
+	REQUIRE_THROWS_WITH(aggregate(std::string_view{ data }.substr(0, header.size() + 8)), "truncated batch");
+	REQUIRE_THROWS_WITH(aggregate(std::string_view{ data }.substr(0, data.size() - 1)), "truncated batch");
+
+	data = header;
+	write_batch(data, 1, std::array{ make_sample(1, 0x1000, 0x10, static_cast<Kind>(7)) });
+	REQUIRE_THROWS_WITH(aggregate(data), "unknown allocation kind");
+}
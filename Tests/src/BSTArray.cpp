@@ -0,0 +1,362 @@
+#include "MemoryManager.h"
+
+#include "RE/Bethesda/BSTArray.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	// counts how the array grows, and optionally offers reallocate like the heap allocators do
+	template <bool REALLOCATE>
+	class counting_allocator
+	{
+	public:
+		using size_type = std::uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+
+		counting_allocator() noexcept = default;
+		counting_allocator(const counting_allocator&) = delete;
+
+		counting_allocator(counting_allocator&& a_rhs) noexcept :
+			_data{ std::exchange(a_rhs._data, nullptr) },
+			_capacity{ std::exchange(a_rhs._capacity, 0) }
+		{}
+
+		~counting_allocator() noexcept = default;
+
+		counting_allocator& operator=(const counting_allocator&) = delete;
+
+		counting_allocator& operator=(counting_allocator&& a_rhs) noexcept
+		{
+			if (this != std::addressof(a_rhs)) {
+				_data = std::exchange(a_rhs._data, nullptr);
+				_capacity = std::exchange(a_rhs._capacity, 0);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] void* allocate(std::uint32_t a_bytes)
+		{
+			++allocations;
+			return std::malloc(a_bytes);
+		}
+
+		[[nodiscard]] void* reallocate(void* a_ptr, std::uint32_t a_bytes)  //
+			requires(REALLOCATE)
+		{
+			++reallocations;
+			return std::realloc(a_ptr, a_bytes);
+		}
+
+		void deallocate(void* a_ptr) { std::free(a_ptr); }
+
+		[[nodiscard]] void* data() noexcept { return _data; }
+		[[nodiscard]] const void* data() const noexcept { return _data; }
+		void set_data(void* a_data) noexcept { _data = a_data; }
+
+		[[nodiscard]] size_type capacity() const noexcept { return _capacity; }
+		void set_capacity(size_type a_capacity, size_type) noexcept { _capacity = a_capacity; }
+
+		static void reset() noexcept
+		{
+			allocations = 0;
+			reallocations = 0;
+		}
+
+		static inline std::size_t allocations = 0;
+		static inline std::size_t reallocations = 0;
+
+	private:
+		void* _data{ nullptr };
+		size_type _capacity{ 0 };
+	};
+
+	// remembers where it was built, so anything that moves it by copying bytes is caught
+	struct tracked
+	{
+	public:
+		tracked(int a_value = 0) noexcept :
+			value(a_value)
+		{}
+
+		tracked(const tracked& a_rhs) noexcept :
+			value(a_rhs.value)
+		{}
+
+		tracked(tracked&& a_rhs) noexcept :
+			value(a_rhs.value)
+		{
+			++moves;
+		}
+
+		~tracked() noexcept { CHECK(self == this); }
+
+		tracked& operator=(const tracked& a_rhs) noexcept
+		{
+			value = a_rhs.value;
+			return *this;
+		}
+
+		tracked& operator=(tracked&& a_rhs) noexcept
+		{
+			value = a_rhs.value;
+			++moves;
+			return *this;
+		}
+
+		[[nodiscard]] friend bool operator==(const tracked& a_lhs, int a_rhs) noexcept { return a_lhs.value == a_rhs; }
+
+		static inline std::size_t moves = 0;
+
+		// members
+		const tracked* self{ this };
+		int value;
+	};
+
+	// owns nothing that points back at itself, so it's declared safe to relocate despite its move constructor
+	struct handle
+	{
+	public:
+		handle(int a_value = 0) noexcept :
+			value(a_value)
+		{}
+
+		handle(const handle&) noexcept = default;
+
+		handle(handle&& a_rhs) noexcept :
+			value(a_rhs.value)
+		{
+			++moves;
+		}
+
+		handle& operator=(const handle&) noexcept = default;
+		handle& operator=(handle&&) noexcept = default;
+
+		[[nodiscard]] friend bool operator==(const handle& a_lhs, int a_rhs) noexcept { return a_lhs.value == a_rhs; }
+
+		static inline std::size_t moves = 0;
+
+		// members
+		int value;
+	};
+
+	template <class T, class U>
+	void check(const RE::BSTArray<T, U>& a_array, const std::vector<int>& a_expected)
+	{
+		REQUIRE(a_array.size() == a_expected.size());
+		REQUIRE(a_array.capacity() >= a_array.size());
+		for (std::size_t i = 0; i < a_expected.size(); ++i) {
+			const auto& elem = a_array[static_cast<std::uint32_t>(i)];
+			if constexpr (std::is_integral_v<T>) {
+				REQUIRE(elem == static_cast<T>(a_expected[i]));
+			} else {
+				REQUIRE(elem == a_expected[i]);
+			}
+		}
+	}
+
+	// grows one element at a time, and in bulk from every kind of range
+	template <class T, class U>
+	void evaluate_growth()
+	{
+		RE::BSTArray<T, U> arr;
+		std::vector<int> expected;
+		for (int i = 0; i < 1000; ++i) {
+			arr.push_back(T(i));
+			expected.push_back(i);
+		}
+		check(arr, expected);
+
+		const std::vector<T> contiguous{ T(1), T(2), T(3), T(4), T(5) };
+		arr.append_range(contiguous);
+		expected.insert(expected.end(), { 1, 2, 3, 4, 5 });
+		check(arr, expected);
+
+		const std::list<int> forward{ 6, 7, 8 };
+		arr.append_range(forward);
+		expected.insert(expected.end(), { 6, 7, 8 });
+		check(arr, expected);
+
+		std::istringstream stream("9 10 11 12");
+		arr.append_range(std::ranges::istream_view<int>(stream));
+		expected.insert(expected.end(), { 9, 10, 11, 12 });
+		check(arr, expected);
+
+		arr.shrink_to_fit();
+		REQUIRE(arr.capacity() == arr.size());
+		check(arr, expected);
+
+		// into a full array, at the front, in the middle and at the back
+		const std::vector<int> values{ -1, -2, -3 };
+		for (const auto pos : { std::size_t{ 0 }, expected.size() / 2, expected.size() }) {
+			arr.insert_range(arr.begin() + pos, values);
+			expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(pos), values.begin(), values.end());
+			check(arr, expected);
+		}
+
+		// the iterator pair insert used to shift only as many elements as it inserted
+		const std::list<int> more{ -4, -5, -6, -7 };
+		const auto it = arr.insert(arr.begin() + 10, more.begin(), more.end());
+		REQUIRE(it == arr.begin() + 10);
+		expected.insert(expected.begin() + 10, more.begin(), more.end());
+		check(arr, expected);
+
+		arr.insert_range(arr.end(), std::vector<int>{});
+		check(arr, expected);
+	}
+
+	template <class T, class U>
+	void evaluate_aliasing()
+	{
+		// each of these reads an element of an array that's full, so the element moves before it's copied
+		RE::BSTArray<T, U> arr;
+		std::vector<int> expected;
+		for (int i = 0; i < 100; ++i) {
+			arr.shrink_to_fit();
+			REQUIRE(arr.size() == arr.capacity());
+			if (i % 2 == 0) {
+				arr.emplace_back(arr.empty() ? T(-1) : arr[0]);
+				expected.push_back(expected.empty() ? -1 : expected[0]);
+			} else {
+				const auto pos = static_cast<std::uint32_t>(arr.size() / 2);
+				arr.emplace(arr.begin() + pos, arr[arr.size() - 1]);
+				expected.insert(expected.begin() + pos, expected.back());
+			}
+			check(arr, expected);
+		}
+
+		// and inserting in the middle of a full array that has to grow
+		arr.shrink_to_fit();
+		arr.insert(arr.begin() + 7, T(1234));
+		expected.insert(expected.begin() + 7, 1234);
+		check(arr, expected);
+	}
+}
+
+namespace RE::detail
+{
+	template <>
+	struct is_trivially_relocatable<handle> :
+		std::true_type
+	{};
+}
+
+TEST_CASE("test array growth")
+{
+	evaluate_growth<std::uint32_t, RE::BSTArrayHeapAllocator>();
+	evaluate_growth<std::uint32_t, RE::BSTAlignedHeapArrayAllocator<0x20>::Allocator>();
+	evaluate_growth<std::uint32_t, RE::BSTSmallArrayHeapAllocator<sizeof(std::uint32_t) * 8>>();
+	evaluate_growth<std::uint32_t, RE::BSScrapArrayAllocator>();
+	evaluate_growth<tracked, RE::BSTArrayHeapAllocator>();
+	evaluate_growth<handle, RE::BSTArrayHeapAllocator>();
+
+	// trivially relocatable elements grow through the heap's realloc when the allocator offers it
+	using realloc_t = counting_allocator<true>;
+	realloc_t::reset();
+	{
+		RE::BSTArray<std::uint32_t, realloc_t> arr;
+		for (std::uint32_t i = 0; i < 1000; ++i) {
+			arr.push_back(i);
+		}
+		REQUIRE(realloc_t::allocations == 1);
+		REQUIRE(realloc_t::reallocations > 0);
+		for (std::uint32_t i = 0; i < 1000; ++i) {
+			REQUIRE(arr[i] == i);
+		}
+	}
+
+	// and are copied into a new block when it doesn't
+	using copy_t = counting_allocator<false>;
+	copy_t::reset();
+	{
+		RE::BSTArray<std::uint32_t, copy_t> arr;
+		for (std::uint32_t i = 0; i < 1000; ++i) {
+			arr.push_back(i);
+		}
+		REQUIRE(copy_t::allocations > 1);
+		REQUIRE(copy_t::reallocations == 0);
+		for (std::uint32_t i = 0; i < 1000; ++i) {
+			REQUIRE(arr[i] == i);
+		}
+	}
+
+	// anything else is moved element by element, through the allocator's allocate
+	{
+		RE::BSTArray<tracked, realloc_t> arr;
+		for (int i = 0; i < 1000; ++i) {
+			arr.emplace_back(i);
+		}
+		realloc_t::reset();
+		tracked::moves = 0;
+		arr.reserve(5000);
+		REQUIRE(realloc_t::allocations == 1);
+		REQUIRE(realloc_t::reallocations == 0);
+		REQUIRE(tracked::moves == 1000);
+		for (int i = 0; i < 1000; ++i) {
+			REQUIRE(arr[i].self == std::addressof(arr[i]));
+			REQUIRE(arr[i] == i);
+		}
+	}
+
+	// unless the type says it can be relocated
+	{
+		RE::BSTArray<handle, realloc_t> arr;
+		for (int i = 0; i < 1000; ++i) {
+			arr.emplace_back(i);
+		}
+		realloc_t::reset();
+		handle::moves = 0;
+		arr.reserve(5000);
+		REQUIRE(realloc_t::allocations == 0);
+		REQUIRE(realloc_t::reallocations == 1);
+		REQUIRE(handle::moves == 0);
+		for (int i = 0; i < 1000; ++i) {
+			REQUIRE(arr[i] == i);
+		}
+	}
+}
+
+TEST_CASE("test array resize")
+{
+	RE::BSTArray<std::uint32_t> arr;
+	arr.resize_for_overwrite(100);
+	REQUIRE(arr.size() == 100);
+	std::ranges::fill(arr, 0xDEADBEEF);
+
+	// resize value-initializes what it adds, even over storage that held something
+	arr.resize(10);
+	REQUIRE(arr.capacity() >= 100);
+	arr.resize(100);
+	REQUIRE(std::all_of(arr.begin() + 10, arr.end(), [](auto a_elem) { return a_elem == 0; }));
+
+	arr.resize(150, 7);
+	REQUIRE(arr.size() == 150);
+	REQUIRE(std::all_of(arr.begin() + 100, arr.end(), [](auto a_elem) { return a_elem == 7; }));
+
+	// resize_for_overwrite only differs in leaving trivial elements alone
+	RE::BSTArray<std::string> strings;
+	strings.resize_for_overwrite(20);
+	REQUIRE(std::ranges::all_of(strings, [](const auto& a_elem) { return a_elem.empty(); }));
+
+	arr.resize_for_overwrite(50);
+	REQUIRE(arr.size() == 50);
+	arr.resize(0);
+	REQUIRE(arr.empty());
+}
+
+TEST_CASE("test array aliasing")
+{
+	evaluate_aliasing<std::uint32_t, RE::BSTArrayHeapAllocator>();
+	evaluate_aliasing<std::uint32_t, counting_allocator<false>>();
+	evaluate_aliasing<std::uint32_t, RE::BSTSmallArrayHeapAllocator<sizeof(std::uint32_t) * 4>>();
+	evaluate_aliasing<tracked, RE::BSTArrayHeapAllocator>();
+	evaluate_aliasing<handle, RE::BSTArrayHeapAllocator>();
+
+	RE::BSTArray<std::string> strings{ "a long enough string to live on the heap" };
+	for (int i = 0; i < 10; ++i) {
+		strings.shrink_to_fit();
+		strings.emplace_back(strings[0]);
+	}
+	REQUIRE(std::ranges::all_of(strings, [&](const auto& a_elem) { return a_elem == strings[0]; }));
+}
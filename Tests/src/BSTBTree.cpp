@@ -0,0 +1,497 @@
+#include "MemoryManager.h"
+
+namespace RE
+{
+	template <class T1, class T2>
+	using BSTTuple = std::pair<T1, T2>;
+}
+
+#include "RE/Bethesda/BSTBTree.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	using tree_t = RE::BSTBTree<int, int>;
+	using map_t = std::map<int, int>;
+
+	static_assert(std::forward_iterator<tree_t::iterator>);
+	static_assert(std::forward_iterator<tree_t::const_iterator>);
+
+	// the keys 0, 2, 4, ... inserted in a shuffled order, so the odd keys fall between entries
+	void fill(tree_t& a_tree, map_t& a_map, int a_count)
+	{
+		std::vector<int> keys(static_cast<std::size_t>(a_count));
+		std::ranges::generate(keys, [i = 0]() mutable { return 2 * i++; });
+		std::ranges::shuffle(keys, std::mt19937(static_cast<std::uint32_t>(a_count)));
+		for (const auto key : keys) {
+			a_tree.emplace(key, -key);
+			a_map.emplace(key, -key);
+		}
+	}
+
+	template <class It, class MapIt>
+	void require_same(It a_it, It a_end, MapIt a_mapIt, MapIt a_mapEnd)
+	{
+		REQUIRE((a_it == a_end) == (a_mapIt == a_mapEnd));
+		if (a_mapIt != a_mapEnd) {
+			REQUIRE((*a_it).first == a_mapIt->first);
+			REQUIRE((*a_it).second == a_mapIt->second);
+		}
+	}
+
+	template <class Tree, class Map, class K>
+	void check_bounds(Tree& a_tree, Map& a_map, const K& a_key)
+	{
+		require_same(a_tree.find(a_key), a_tree.end(), a_map.find(a_key), a_map.end());
+		require_same(a_tree.lower_bound(a_key), a_tree.end(), a_map.lower_bound(a_key), a_map.end());
+		require_same(a_tree.upper_bound(a_key), a_tree.end(), a_map.upper_bound(a_key), a_map.end());
+
+		const auto [first, last] = a_tree.equal_range(a_key);
+		const auto [mapFirst, mapLast] = a_map.equal_range(a_key);
+		require_same(first, a_tree.end(), mapFirst, a_map.end());
+		require_same(last, a_tree.end(), mapLast, a_map.end());
+		REQUIRE(std::distance(first, last) == std::distance(mapFirst, mapLast));
+	}
+
+	constexpr std::array SIZES{ 1, 2, 3, 4, 5, 10, 24, 25, 124, 125, 1000 };
+
+	// the tree keeps its nodes to itself, so they're read through its layout, which the engine fixes
+	template <class Tree>
+	struct layout_t
+	{
+	public:
+		// members
+		std::uint64_t pad;                           // 00
+		std::uint32_t activeEntry;                   // 08
+		std::uint32_t allocatedSize;                 // 0C
+		const typename Tree::node_type* root;        // 10
+		const typename Tree::node_type* availNodes;  // 18
+	};
+
+	template <class Tree>
+	[[nodiscard]] layout_t<Tree> inspect(const Tree& a_tree)
+	{
+		static_assert(sizeof(Tree) == sizeof(layout_t<Tree>));
+		layout_t<Tree> result;
+		std::memcpy(std::addressof(result), std::addressof(a_tree), sizeof(result));
+		return result;
+	}
+
+	template <class Tree>
+	struct shape_t
+	{
+	public:
+		using node_type = typename Tree::node_type;
+
+		std::size_t entries{ 0 };
+		std::set<const node_type*> nodes;
+		std::set<const node_type*> pool;
+	};
+
+	// checks every node's fill, order and links, that the leaves sit level, and that the live and pooled
+	// nodes together account for every node drawn from the heap
+	template <class Tree>
+	shape_t<Tree> check_invariants(const Tree& a_tree)
+	{
+		using node_type = typename Tree::node_type;
+		using key_type = typename Tree::key_type;
+
+		const auto layout = inspect(a_tree);
+		shape_t<Tree> shape;
+		std::optional<std::size_t> leafDepth;
+		const auto walk = [&](auto&& a_self, const node_type* a_node, std::size_t a_depth, const key_type* a_lo, const key_type* a_hi) -> void {
+			REQUIRE(shape.nodes.insert(a_node).second);
+			REQUIRE(a_node->usedEntries >= (a_depth == 0 ? 1u : 2u));
+			REQUIRE(a_node->usedEntries <= 4);
+			shape.entries += a_node->usedEntries;
+
+			for (std::uint32_t i = 0; i < a_node->usedEntries; ++i) {
+				const auto& key = a_node->entries[i].first;
+				REQUIRE((!a_lo || *a_lo < key));
+				REQUIRE((!a_hi || key < *a_hi));
+				if (i > 0) {
+					REQUIRE(a_node->entries[i - 1].first < key);
+				}
+			}
+
+			const bool leaf = a_node->nodes[0] == nullptr;
+			for (std::uint32_t i = 0; i <= a_node->usedEntries; ++i) {
+				if (leaf) {
+					REQUIRE(a_node->nodes[i] == nullptr);
+				} else {
+					REQUIRE(a_node->nodes[i] != nullptr);
+					a_self(
+						a_self,
+						a_node->nodes[i],
+						a_depth + 1,
+						i > 0 ? std::addressof(a_node->entries[i - 1].first) : a_lo,
+						i < a_node->usedEntries ? std::addressof(a_node->entries[i].first) : a_hi);
+				}
+			}
+			for (auto i = a_node->usedEntries + 1; i < std::size(a_node->nodes); ++i) {
+				REQUIRE(a_node->nodes[i] == nullptr);
+			}
+
+			if (leaf) {
+				REQUIRE(leafDepth.value_or(a_depth) == a_depth);
+				leafDepth = a_depth;
+			}
+		};
+
+		if (layout.root) {
+			walk(walk, layout.root, 0, nullptr, nullptr);
+		}
+		for (auto node = layout.availNodes; node; node = node->nodes[0]) {
+			REQUIRE(node->usedEntries == 0);
+			REQUIRE(!shape.nodes.contains(node));
+			REQUIRE(shape.pool.insert(node).second);
+		}
+
+		REQUIRE(shape.nodes.size() + shape.pool.size() == layout.allocatedSize);
+		REQUIRE(a_tree.empty() == (shape.entries == 0));
+		REQUIRE(static_cast<std::size_t>(std::distance(a_tree.begin(), a_tree.end())) == shape.entries);
+		return shape;
+	}
+
+	template <class Tree, class Map>
+	void check_contents(const Tree& a_tree, const Map& a_map)
+	{
+		REQUIRE(check_invariants(a_tree).entries == a_map.size());
+		REQUIRE(std::ranges::equal(a_tree, a_map));
+	}
+
+	// random inserts, erases and lookups, checked against std::map after every step. the first half
+	// leans towards inserting and the second towards erasing, so the tree grows and shrinks through
+	// every height
+	template <class Tree, class F>
+	void evaluate_against_map(F a_makeKey, int a_steps, int a_range)
+	{
+		using key_type = typename Tree::key_type;
+
+		Tree tree;
+		std::map<key_type, int, std::less<>> map;
+		std::mt19937 rng(a_steps);
+		std::uniform_int_distribution<int> keys(0, a_range);
+		for (int step = 0; step < a_steps; ++step) {
+			const auto key = a_makeKey(keys(rng));
+			const auto growing = step < a_steps / 2;
+			switch (const auto op = rng() % 10; op) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				if (growing || op == 0) {
+					const auto [it, inserted] =
+						op % 2 == 0 ?
+							tree.emplace(key, step) :
+							tree.insert(typename Tree::value_type(key, step));
+					REQUIRE(inserted == map.emplace(key, step).second);
+					REQUIRE((*it).first == key);
+					REQUIRE((*it).second == map.at(key));
+					break;
+				}
+				[[fallthrough]];
+			case 4:
+			case 5:
+				REQUIRE(tree.erase(key) == map.erase(key));
+				break;
+			case 6:
+				if (const auto mapIt = map.lower_bound(key); mapIt != map.end()) {
+					const auto it = tree.find(mapIt->first);
+					REQUIRE(it != tree.end());
+					const auto next = tree.erase(it);
+					const auto mapNext = map.erase(mapIt);
+					require_same(next, tree.end(), mapNext, map.end());
+				}
+				break;
+			case 7:
+			case 8:
+				check_bounds(tree, map, key);
+				break;
+			default:
+				if (rng() % 50 == 0) {
+					// copies hold the same entries in nodes of their own
+					const Tree copy = tree;
+					check_contents(copy, map);
+					tree = copy;
+				} else if (rng() % 200 == 0) {
+					tree.clear();
+					map.clear();
+				}
+				break;
+			}
+
+			check_contents(tree, map);
+		}
+	}
+}
+
+TEST_CASE("test btree iteration")
+{
+	{
+		tree_t tree;
+		const auto& ctree = tree;
+		REQUIRE(tree.empty());
+		REQUIRE(tree.begin() == tree.end());
+		REQUIRE(ctree.begin() == ctree.end());
+		REQUIRE(tree.cbegin() == tree.cend());
+	}
+
+	for (const auto size : SIZES) {
+		tree_t tree;
+		map_t map;
+		fill(tree, map, size);
+		REQUIRE(!tree.empty());
+
+		// entries come out in key order, whichever order they went in
+		auto it = tree.begin();
+		for (const auto& [key, value] : map) {
+			REQUIRE(it != tree.end());
+			REQUIRE((*it).first == key);
+			REQUIRE((*it).second == value);
+			const auto prev = it++;
+			REQUIRE(prev != it);
+		}
+		REQUIRE(it == tree.end());
+
+		const auto& ctree = tree;
+		REQUIRE(std::distance(ctree.begin(), ctree.end()) == std::ssize(map));
+		REQUIRE(std::ranges::equal(ctree, map));
+		REQUIRE(std::ranges::is_sorted(tree, std::less<>(), [](const auto& a_elem) { return a_elem.first; }));
+
+		// values are writable through the iterators
+		for (auto& elem : tree) {
+			elem.second = elem.first * 3;
+		}
+		for (const auto& [key, value] : ctree) {
+			REQUIRE(value == key * 3);
+		}
+	}
+}
+
+TEST_CASE("test btree bounds")
+{
+	for (const auto size : SIZES) {
+		tree_t tree;
+		map_t map;
+		fill(tree, map, size);
+
+		const auto& ctree = tree;
+		const auto& cmap = map;
+		for (int key = -2; key <= 2 * size + 1; ++key) {
+			check_bounds(tree, map, key);
+			check_bounds(ctree, cmap, key);
+		}
+	}
+
+	// std::less<> lets strings be probed with anything they compare against
+	RE::BSTBTree<std::string, int> tree;
+	std::map<std::string, int, std::less<>> map;
+	for (int i = 0; i < 200; ++i) {
+		const auto key = fmt::format("{:04}", i * 2);
+		tree.emplace(key, i);
+		map.emplace(key, i);
+	}
+	for (int i = -1; i < 402; ++i) {
+		const auto key = fmt::format("{:04}", i);
+		check_bounds(tree, map, std::string_view(key));
+		check_bounds(tree, map, key.c_str());
+		check_bounds(tree, map, key);
+	}
+}
+
+TEST_CASE("test btree iterator equality")
+{
+	tree_t tree;
+	map_t map;
+	fill(tree, map, 500);
+	const auto& ctree = tree;
+
+	// every route to an entry lands on an equal iterator
+	auto it = tree.begin();
+	for (const auto& [key, value] : map) {
+		const tree_t::const_iterator cit = it;
+		REQUIRE(it == tree.find(key));
+		REQUIRE(it == tree.lower_bound(key));
+		REQUIRE(it == tree.equal_range(key).first);
+		REQUIRE(cit == ctree.find(key));
+		REQUIRE(cit == it);
+		REQUIRE(it == cit);
+		REQUIRE(std::next(it) == tree.upper_bound(key));
+		REQUIRE(std::next(it) == tree.equal_range(key).second);
+		REQUIRE(it != std::next(it));
+		++it;
+	}
+
+	// and every way past the last one is the end
+	REQUIRE(it == tree.end());
+	REQUIRE(it == tree_t::iterator());
+	REQUIRE(ctree.end() == tree.end());
+	REQUIRE(tree.find(1) == tree.end());
+	REQUIRE(tree.upper_bound(998) == tree.end());
+	REQUIRE(tree.lower_bound(999) == ctree.cend());
+
+	// the same key in a copy is a different entry
+	const auto copy = tree;
+	REQUIRE(copy.begin() != ctree.begin());
+	REQUIRE(std::ranges::equal(copy, tree));
+}
+
+TEST_CASE("test btree insert and erase")
+{
+	evaluate_against_map<tree_t>([](int a_key) { return a_key; }, 20000, 600);
+	evaluate_against_map<tree_t>([](int a_key) { return a_key; }, 5000, 40);
+	evaluate_against_map<RE::BSTBTree<std::string, int>>([](int a_key) { return fmt::format("{:05}", a_key); }, 5000, 400);
+}
+
+TEST_CASE("test btree rebalancing")
+{
+	// at the right edge, the left edge, and between existing entries, which splits nodes at every position
+	std::vector<int> ascending(1000);
+	std::iota(ascending.begin(), ascending.end(), 0);
+	std::vector<int> descending(ascending.rbegin(), ascending.rend());
+	std::vector<int> interleaved;
+	for (int i = 0; i < 1000; i += 2) {
+		interleaved.push_back(i);
+	}
+	for (int i = 999; i > 0; i -= 2) {
+		interleaved.push_back(i);
+	}
+
+	for (const auto& order : { ascending, descending, interleaved }) {
+		tree_t tree;
+		map_t map;
+		for (const auto key : order) {
+			REQUIRE(tree.emplace(key, key).second);
+			map.emplace(key, key);
+			check_contents(tree, map);
+		}
+
+		// erasing from the front borrows from and merges with right siblings, from the back with left
+		// ones, and from the root swaps in the predecessor from a leaf first
+		for (const auto& erase : { ascending, descending, interleaved }) {
+			auto copy = tree;
+			auto expected = map;
+			for (std::size_t i = 0; i < erase.size() / 2; ++i) {
+				REQUIRE(copy.erase(erase[i]) == 1);
+				expected.erase(erase[i]);
+				check_contents(copy, expected);
+			}
+			while (!copy.empty()) {
+				const auto key = inspect(copy).root->entries[0].first;
+				REQUIRE(copy.erase(key) == 1);
+				expected.erase(key);
+				check_contents(copy, expected);
+			}
+		}
+	}
+}
+
+TEST_CASE("test btree node pool")
+{
+	std::vector<int> keys(1000);
+	std::iota(keys.begin(), keys.end(), 0);
+	std::ranges::shuffle(keys, std::mt19937(1));
+
+	tree_t tree;
+	for (const auto key : keys) {
+		tree.emplace(key, key);
+	}
+	const auto allocated = inspect(tree).allocatedSize;
+	REQUIRE(check_invariants(tree).pool.empty());
+
+	// erasing everything hands each node back to the pool
+	for (const auto key : keys) {
+		REQUIRE(tree.erase(key) == 1);
+	}
+	auto shape = check_invariants(tree);
+	REQUIRE(tree.empty());
+	REQUIRE(inspect(tree).root == nullptr);
+	REQUIRE(shape.pool.size() == allocated);
+
+	// and refilling the tree draws from the pool before the heap
+	const auto pooled = shape.pool;
+	for (const auto key : keys) {
+		tree.emplace(key, key);
+	}
+	shape = check_invariants(tree);
+	REQUIRE(inspect(tree).allocatedSize == allocated);
+	REQUIRE(std::ranges::includes(pooled, shape.nodes));
+
+	// clear keeps the nodes too, and assign_sorted builds from them
+	tree.clear();
+	REQUIRE(check_invariants(tree).pool.size() == allocated);
+	std::vector<std::pair<int, int>> sorted;
+	for (int i = 0; i < 1000; ++i) {
+		sorted.emplace_back(i, i);
+	}
+	tree.assign_sorted(sorted);
+	shape = check_invariants(tree);
+	REQUIRE(inspect(tree).allocatedSize == allocated);
+	REQUIRE(std::ranges::includes(pooled, shape.nodes));
+
+	// moves and swaps take the pool along with the entries
+	tree_t moved = std::move(tree);
+	REQUIRE(inspect(tree).allocatedSize == 0);
+	REQUIRE(check_invariants(tree).nodes.empty());
+	REQUIRE(check_invariants(moved).nodes == shape.nodes);
+	tree.swap(moved);
+	REQUIRE(check_invariants(tree).pool == shape.pool);
+	REQUIRE(inspect(moved).allocatedSize == 0);
+
+	// only shrink_to_fit gives the pool back to the heap
+	tree.shrink_to_fit();
+	REQUIRE(check_invariants(tree).pool.empty());
+	REQUIRE(inspect(tree).allocatedSize == shape.nodes.size());
+	tree.clear();
+	tree.shrink_to_fit();
+	REQUIRE(inspect(tree).allocatedSize == 0);
+	REQUIRE(inspect(tree).availNodes == nullptr);
+}
+
+TEST_CASE("test btree assign_sorted")
+{
+	std::vector<int> counts(130);
+	std::iota(counts.begin(), counts.end(), 0);
+	counts.insert(counts.end(), { 623, 624, 625, 1000, 3124, 3125, 3126 });
+
+	tree_t tree;
+	for (const auto count : counts) {
+		// into a tree that already holds something, which is thrown away
+		tree.emplace(-1, -1);
+
+		std::vector<std::pair<int, int>> sorted;
+		map_t map;
+		for (int i = 0; i < count; ++i) {
+			sorted.emplace_back(i * 2, i);
+			map.emplace(i * 2, i);
+		}
+		tree.assign_sorted(sorted);
+		check_contents(tree, map);
+
+		// what it builds is an ordinary tree, which takes further inserts and erases
+		std::mt19937 rng(static_cast<std::uint32_t>(count));
+		for (int i = 0; i < 100; ++i) {
+			const auto key = static_cast<int>(rng() % static_cast<std::uint32_t>(2 * count + 2));
+			if (i % 2 == 0) {
+				REQUIRE(tree.emplace(key, i).second == map.emplace(key, i).second);
+			} else {
+				REQUIRE(tree.erase(key) == map.erase(key));
+			}
+			check_contents(tree, map);
+		}
+	}
+
+	// any forward range will do
+	RE::BSTBTree<std::string, int> strings;
+	std::list<std::pair<std::string, int>> list;
+	for (int i = 0; i < 300; ++i) {
+		list.emplace_back(fmt::format("{:04}", i), i);
+	}
+	strings.assign_sorted(list);
+	REQUIRE(check_invariants(strings).entries == list.size());
+	REQUIRE(std::ranges::equal(strings, list, [](const auto& a_lhs, const auto& a_rhs) {
+		return a_lhs.first == a_rhs.first && a_lhs.second == a_rhs.second;
+	}));
+}
@@ -1,106 +1,7 @@
-namespace stl
-{
-	[[noreturn]] void report_and_fail(std::string_view a_msg)
-	{
-		throw std::runtime_error(std::string(a_msg));
-	}
-
-	template <class EF>                                    //
-	requires(std::invocable<std::remove_reference_t<EF>>)  //
-		class scope_exit
-	{
-	public:
-		// 1)
-		template <class Fn>
-		explicit scope_exit(Fn&& a_fn)  //
-			noexcept(std::is_nothrow_constructible_v<EF, Fn> ||
-					 std::is_nothrow_constructible_v<EF, Fn&>)  //
-			requires(!std::is_same_v<std::remove_cvref_t<Fn>, scope_exit> &&
-					 std::is_constructible_v<EF, Fn>)
-		{
-			static_assert(std::invocable<Fn>);
-
-			if constexpr (!std::is_lvalue_reference_v<Fn> &&
-						  std::is_nothrow_constructible_v<EF, Fn>) {
-				_fn.emplace(std::forward<Fn>(a_fn));
-			} else {
-				_fn.emplace(a_fn);
-			}
-		}
-
-		// 2)
-		scope_exit(scope_exit&& a_rhs)  //
-			noexcept(std::is_nothrow_move_constructible_v<EF> ||
-					 std::is_nothrow_copy_constructible_v<EF>)  //
-			requires(std::is_nothrow_move_constructible_v<EF> ||
-					 std::is_copy_constructible_v<EF>)
-		{
-			static_assert(!(std::is_nothrow_move_constructible_v<EF> && !std::is_move_constructible_v<EF>));
-			static_assert(!(!std::is_nothrow_move_constructible_v<EF> && !std::is_copy_constructible_v<EF>));
-
-			if (a_rhs.active()) {
-				if constexpr (std::is_nothrow_move_constructible_v<EF>) {
-					_fn.emplace(std::forward<EF>(*a_rhs._fn));
-				} else {
-					_fn.emplace(a_rhs._fn);
-				}
-				a_rhs.release();
-			}
-		}
-
-		// 3)
-		scope_exit(const scope_exit&) = delete;
-
-		~scope_exit() noexcept
-		{
-			if (_fn.has_value()) {
-				(*_fn)();
-			}
-		}
-
-		void release() noexcept { _fn.reset(); }
-
-	private:
-		[[nodiscard]] bool active() const noexcept { return _fn.has_value(); }
-
-		std::optional<std::remove_reference_t<EF>> _fn;
-	};
-
-	template <class EF>
-	scope_exit(EF) -> scope_exit<EF>;
-}
+#include "MemoryManager.h"
 
 namespace RE
 {
-	void* malloc(std::size_t a_bytes) { return new std::byte[a_bytes]; }
-	void free(void* a_ptr) { delete[] static_cast<std::byte*>(a_ptr); }
-
-	class ScrapHeap
-	{
-	public:
-		void* Allocate(std::size_t a_bytes, [[maybe_unused]] std::size_t a_alignment)
-		{
-			return malloc(a_bytes);
-		}
-
-		void Deallocate(void* a_ptr) { free(a_ptr); }
-	};
-
-	class MemoryManager
-	{
-	public:
-		[[nodiscard]] static MemoryManager& GetSingleton()
-		{
-			static MemoryManager singleton;
-			return singleton;
-		}
-
-		[[nodiscard]] ScrapHeap* GetThreadScrapHeap() { return &_scrap; }
-
-	private:
-		ScrapHeap _scrap;
-	};
-
 	template <class T>
 	using BSCRC32 = std::hash<T>;
 
@@ -108,6 +9,8 @@ namespace RE
 	using BSTTuple = std::pair<T1, T2>;
 }
 
+#define F4SE_BSTSCATTERTABLE_STATS
+#include "RE/Bethesda/BSTFlatHashMap.h"
 #include "RE/Bethesda/BSTHashMap.h"
 
 #include <catch2/catch_all.hpp>
@@ -121,6 +24,56 @@ struct bad_hasher
 	}
 };
 
+struct transparent_hasher
+{
+	using is_transparent = void;
+
+	[[nodiscard]] std::size_t operator()(std::string_view a_key) const noexcept { return std::hash<std::string_view>()(a_key); }
+};
+
+struct transparent_bad_hasher
+{
+	using is_transparent = void;
+
+	[[nodiscard]] std::size_t operator()(std::string_view) const noexcept { return 0; }
+};
+
+// hands back the same block on every growth, which sends reserve down the in-place rehash
+template <std::size_t S, std::size_t A>
+struct inplace_allocator
+{
+public:
+	using size_type = std::uint32_t;
+	using propagate_on_container_move_assignment = std::false_type;
+
+	static constexpr std::size_t CAPACITY = 1u << 12;
+
+	inplace_allocator() = default;
+	inplace_allocator(const inplace_allocator&) = delete;
+	inplace_allocator(inplace_allocator&&) = delete;
+	~inplace_allocator() = default;
+	inplace_allocator& operator=(const inplace_allocator&) = delete;
+	inplace_allocator& operator=(inplace_allocator&&) = delete;
+
+	[[nodiscard]] static constexpr size_type min_size() noexcept { return 1u << 3; }
+
+	[[nodiscard]] void* allocate_bytes(std::size_t a_bytes) { return a_bytes <= CAPACITY * S ? _buffer.get() : nullptr; }
+
+	void deallocate_bytes([[maybe_unused]] void* a_ptr) { assert(a_ptr == _buffer.get()); }
+
+	[[nodiscard]] void* get_entries() const noexcept { return _entries; }
+	void set_entries(void* a_entries) noexcept { _entries = static_cast<std::byte*>(a_entries); }
+
+private:
+	struct deleter
+	{
+		void operator()(std::byte* a_ptr) const noexcept { ::operator delete[](a_ptr, std::align_val_t{ A }); }
+	};
+
+	std::unique_ptr<std::byte[], deleter> _buffer{ static_cast<std::byte*>(::operator new[](CAPACITY * S, std::align_val_t{ A })) };
+	std::byte* _entries{ nullptr };
+};
+
 using key_type = std::string;
 using mapped_type = int;
 
@@ -297,8 +250,513 @@ TEST_CASE("test static hash map")
 	evaluate<RE::BSTStaticHashMap<key_type, mapped_type, 1u << 5, bad_hasher>>(get2, make2, false);
 }
 
+TEST_CASE("test in-place rehash")
+{
+	using inplace_map_t = RE::BSTScatterTable<std::hash<key_type>, std::equal_to<key_type>, RE::BSTScatterTableTraits<key_type, mapped_type>, inplace_allocator>;
+	using inplace_bad_map_t = RE::BSTScatterTable<bad_hasher, std::equal_to<key_type>, RE::BSTScatterTableTraits<key_type, mapped_type>, inplace_allocator>;
+	evaluate<inplace_map_t>(get2, make2, false);
+	evaluate<inplace_bad_map_t>(get2, make2, false);
+
+	// grow through every doubling, and make sure nothing is lost or duplicated along the way
+	const auto check = [](auto& a_map) {
+		constexpr mapped_type count = 3000;
+		for (mapped_type i = 0; i < count; ++i) {
+			REQUIRE(a_map.emplace(std::to_string(i), i).second);
+			if (std::has_single_bit(static_cast<std::uint32_t>(i))) {
+				for (mapped_type j = 0; j <= i; ++j) {
+					const auto it = a_map.find(std::to_string(j));
+					REQUIRE(it != a_map.end());
+					REQUIRE(it->second == j);
+				}
+			}
+		}
+		REQUIRE(a_map.size() == count);
+		REQUIRE(std::distance(a_map.begin(), a_map.end()) == count);
+	};
+
+	inplace_map_t map;
+	check(map);
+
+	RE::BSTScatterTable<bad_hasher, std::equal_to<key_type>, RE::BSTScatterTableTraits<key_type, mapped_type>, inplace_allocator> bad;
+	check(bad);
+}
+
+TEST_CASE("test bulk insert and batched find")
+{
+	const auto check = []<class T>(std::type_identity<T>, const auto& a_make) {
+		using value_type = typename T::value_type;
+
+		// duplicates both within the batch and against what's already there
+		std::vector<value_type> values;
+		for (mapped_type i = 0; i < 500; ++i) {
+			values.push_back(a_make(std::to_string(i % 300), i));
+		}
+
+		T expected;
+		T bulk;
+		for (mapped_type i = 0; i < 50; ++i) {
+			expected.insert(a_make(std::to_string(i * 7), -i));
+			bulk.insert(a_make(std::to_string(i * 7), -i));
+		}
+		expected.insert(values.begin(), values.end());
+		bulk.insert_bulk(values);
+		bulk.insert_bulk(std::vector<value_type>{});
+
+		REQUIRE(bulk.size() == expected.size());
+		REQUIRE(std::distance(bulk.begin(), bulk.end()) == std::ssize(expected));
+		for (const auto& value : expected) {
+			REQUIRE(std::ranges::count(bulk, value) == 1);
+		}
+
+		std::vector<key_type> keys;
+		for (mapped_type i = 0; i < 400; ++i) {
+			keys.push_back(std::to_string(i));
+		}
+
+		std::vector<typename T::iterator> results(keys.size());
+		bulk.find_batch(keys, results);
+		std::vector<typename T::const_iterator> cresults(keys.size());
+		std::as_const(bulk).find_batch(keys, cresults);
+		for (std::size_t i = 0; i < keys.size(); ++i) {
+			REQUIRE(results[i] == bulk.find(keys[i]));
+			REQUIRE(cresults[i] == results[i]);
+			REQUIRE((results[i] != bulk.end()) == (i < 300 || (i % 7 == 0 && i < 350)));
+		}
+
+		T empty;
+		empty.find_batch(keys, results);
+		REQUIRE(std::ranges::all_of(results, [&](const auto& a_it) { return a_it == empty.end(); }));
+	};
+
+	check(std::type_identity<RE::BSTHashMap<key_type, mapped_type>>{}, make2);
+	check(std::type_identity<RE::BSTHashMap<key_type, mapped_type, bad_hasher>>{}, make2);
+	check(std::type_identity<RE::BSTSet<key_type>>{}, make1);
+	check(std::type_identity<RE::BSTSet<key_type, bad_hasher>>{}, make1);
+}
+
+TEST_CASE("test scatter table stats")
+{
+	constexpr std::uint32_t count = 100;
+
+	{
+		RE::BSTSet<std::uint32_t, bad_hasher> set;
+		REQUIRE(set.stats().size == 0);
+		REQUIRE(set.stats().chainLengths.empty());
+
+		auto& counters = decltype(set)::counters();
+		counters.reset();
+		for (std::uint32_t i = 0; i < count; ++i) {
+			set.insert(i);
+		}
+
+		// everything lands in one chain
+		const auto stats = set.stats();
+		REQUIRE(stats.capacity == 128);
+		REQUIRE(stats.size == count);
+		REQUIRE(stats.loadFactor == static_cast<float>(count) / 128.0F);
+		REQUIRE(stats.chainLengths.size() == count + 1);
+		REQUIRE(stats.chainLengths[count] == 1);
+		REQUIRE(std::reduce(stats.chainLengths.begin(), stats.chainLengths.end()) == 1);
+		REQUIRE(stats.maxProbe == count);
+		REQUIRE(stats.averageProbe == (count + 1) / 2.0);
+		REQUIRE(stats.freeScan == 1);  // _good is left on the slot it last handed out
+
+		REQUIRE(counters.finds == count);
+		REQUIRE(counters.evictions == 0);
+		REQUIRE(counters.rehashes > 0);
+		REQUIRE(counters.placements >= count);
+
+		const auto finds = counters.finds.load();
+		const auto probes = counters.probes.load();
+		REQUIRE(set.contains(1));  // collisions are linked in behind the head, so the first one ends up last
+		REQUIRE(counters.finds == finds + 1);
+		REQUIRE(counters.probes == probes + count);
+
+		set.erase(0);
+		REQUIRE(counters.erases == 1);
+		REQUIRE(set.stats().maxProbe == count - 1);
+	}
+
+	{
+		RE::BSTSet<std::uint32_t> set;
+		for (std::uint32_t i = 0; i < count; ++i) {
+			set.insert(i * 7919);
+		}
+
+		const auto stats = set.stats();
+		std::uint32_t entries = 0;
+		for (std::uint32_t i = 0; i < stats.chainLengths.size(); ++i) {
+			entries += i * stats.chainLengths[i];
+		}
+		REQUIRE(entries == stats.size);
+		REQUIRE(stats.maxProbe + 1 == stats.chainLengths.size());
+		REQUIRE(stats.averageProbe >= 1.0);
+		REQUIRE(stats.averageProbe <= stats.maxProbe);
+	}
+}
+
+TEST_CASE("test erase_if and partition")
+{
+	const auto check = [](auto& a_map) {
+		std::set<std::uint32_t> expected;
+		for (std::uint32_t i = 0; i < 1000; ++i) {
+			a_map.insert(i * 13);
+			expected.insert(i * 13);
+		}
+
+		// the partitions cover every value exactly once, however the table is cut up
+		for (const std::uint32_t parts : { 1u, 3u, 8u, 4096u }) {
+			std::vector<std::uint32_t> seen;
+			for (const auto& part : std::as_const(a_map).partition(parts)) {
+				seen.insert(seen.end(), part.begin(), part.end());
+			}
+			std::ranges::sort(seen);
+			REQUIRE(std::ranges::equal(seen, expected));
+		}
+
+		const auto parts = a_map.partition(8);
+		std::atomic<std::uint64_t> sum{ 0 };
+		std::for_each(std::execution::par, parts.begin(), parts.end(), [&](const auto& a_part) {
+			sum += std::reduce(a_part.begin(), a_part.end(), std::uint64_t{ 0 });
+		});
+		REQUIRE(sum == std::reduce(expected.begin(), expected.end(), std::uint64_t{ 0 }));
+
+		for (const std::uint32_t mod : { 3u, 2u, 1u }) {
+			const auto pred = [&](std::uint32_t a_value) { return a_value % mod == 0; };
+			const auto erased = std::erase_if(expected, pred);
+			REQUIRE(a_map.erase_if(pred) == erased);
+			REQUIRE(a_map.size() == expected.size());
+			REQUIRE(std::distance(a_map.begin(), a_map.end()) == std::ssize(expected));
+			for (const auto value : expected) {
+				REQUIRE(a_map.contains(value));
+			}
+		}
+		REQUIRE(a_map.empty());
+		REQUIRE(a_map.erase_if([](std::uint32_t) { return true; }) == 0);
+		REQUIRE(a_map.partition(4).size() == 4);
+	};
+
+	RE::BSTSet<std::uint32_t> set;
+	check(set);
+	RE::BSTSet<std::uint32_t, bad_hasher> bad;
+	check(bad);
+
+	// evicted entries and chains in every shape, checked against a reference
+	RE::BSTHashMap<key_type, mapped_type> map;
+	std::map<key_type, mapped_type> expected;
+	for (mapped_type i = 0; i < 2000; ++i) {
+		map.emplace(std::to_string(i), i);
+		expected.emplace(std::to_string(i), i);
+	}
+	const auto pred = [&](const auto& a_value) { return std::hash<key_type>()(a_value.first) % 5 < 2; };
+	REQUIRE(map.erase_if(pred) == std::erase_if(expected, pred));
+	REQUIRE(std::ranges::all_of(expected, [&](const auto& a_value) { return map.find(a_value.first)->second == a_value.second; }));
+	REQUIRE(map.size() == expected.size());
+}
+
 TEST_CASE("test scrap hash map")
 {
 	evaluate<RE::BSTScrapHashMap<key_type, mapped_type>>(get2, make2, false);
 	evaluate<RE::BSTScrapHashMap<key_type, mapped_type, bad_hasher>>(get2, make2, false);
 }
+
+template <class T, class K>
+concept can_find = requires(const T& a_map, const K& a_key) { a_map.find(a_key); };
+
+template <class T>
+void evaluate_transparent()
+{
+	T t;
+	for (char c = 'a'; c <= 'z'; ++c) {
+		t.emplace(key_type(1, c), static_cast<mapped_type>(c - 'a'));
+	}
+
+	const auto& ct = t;
+	for (char c = 'a'; c <= 'z'; ++c) {
+		const char buf[] = { c, '\0' };
+		const std::string_view view{ buf, 1 };
+		const auto it = t.find(view);
+		REQUIRE(it != t.end());
+		REQUIRE(it->first == view);
+		REQUIRE(it == t.find(key_type(view)));
+		REQUIRE(ct.find(view) == it);
+		REQUIRE(t.contains(view));
+		REQUIRE(t.count(view) == 1);
+		REQUIRE(t.contains(buf));
+	}
+
+	REQUIRE(t.find("aa"sv) == t.end());
+	REQUIRE(!t.contains("A"sv));
+	REQUIRE(t.count(""sv) == 0);
+}
+
+TEST_CASE("test flat hash map")
+{
+	evaluate<RE::BSTFlatHashMap<key_type, mapped_type>>(get2, make2, true);
+	evaluate<RE::BSTFlatHashMap<key_type, mapped_type, bad_hasher>>(get2, make2, true);
+	evaluate<RE::BSTFlatSet<key_type>>(get1, make1, true);
+	evaluate<RE::BSTFlatSet<key_type, bad_hasher>>(get1, make1, true);
+	evaluate<RE::BSTFlatScrapHashMap<key_type, mapped_type>>(get2, make2, false);
+	evaluate<RE::BSTFlatScatterTable<std::hash<key_type>, std::equal_to<key_type>, RE::BSTScatterTableTraits<key_type, mapped_type>, inplace_allocator>>(get2, make2, false);
+
+	// churn through enough inserts and erases to fill the table with tombstones, and check
+	// every step against a reference
+	const auto check = [](auto& a_map) {
+		std::unordered_map<std::uint32_t, std::uint32_t> expected;
+		std::mt19937 rng(5);
+		std::uniform_int_distribution<std::uint32_t> keys(0, 2000);
+		for (std::uint32_t i = 0; i < 50000; ++i) {
+			const auto key = keys(rng);
+			if (rng() % 3 == 0) {
+				REQUIRE(a_map.erase(key) == expected.erase(key));
+			} else {
+				const auto [it, inserted] = a_map.emplace(key, i);
+				REQUIRE(inserted == expected.emplace(key, i).second);
+				REQUIRE(it->second == expected.at(key));
+			}
+		}
+
+		REQUIRE(a_map.size() == expected.size());
+		REQUIRE(std::distance(a_map.begin(), a_map.end()) == std::ssize(expected));
+		for (const auto& [key, value] : a_map) {
+			REQUIRE(expected.at(key) == value);
+		}
+	};
+
+	RE::BSTFlatHashMap<std::uint32_t, std::uint32_t> map;
+	check(map);
+	RE::BSTFlatHashMap<std::uint32_t, std::uint32_t, bad_hasher> bad;
+	check(bad);
+
+	// erasing while iterating hands back the next element
+	for (auto it = map.begin(); it != map.end();) {
+		it = it->first % 2 == 0 ? map.erase(it) : std::next(it);
+	}
+	REQUIRE(std::ranges::none_of(map, [](const auto& a_value) { return a_value.first % 2 == 0; }));
+}
+
+TEST_CASE("test transparent lookup")
+{
+	evaluate_transparent<RE::BSTHashMap<key_type, mapped_type, transparent_hasher, std::equal_to<>>>();
+	evaluate_transparent<RE::BSTHashMap<key_type, mapped_type, transparent_bad_hasher, std::equal_to<>>>();
+	evaluate_transparent<RE::BSTStaticHashMap<key_type, mapped_type, 1u << 5, transparent_hasher, std::equal_to<>>>();
+	evaluate_transparent<RE::BSTFlatHashMap<key_type, mapped_type, transparent_hasher, std::equal_to<>>>();
+
+	// the default comparator is transparent, so a transparent hasher is all it takes
+	evaluate_transparent<RE::BSTHashMap<key_type, mapped_type, transparent_hasher>>();
+	evaluate_transparent<RE::BSTFlatHashMap<key_type, mapped_type, transparent_hasher>>();
+	evaluate_transparent<RE::BSTScrapHashMap<key_type, mapped_type, transparent_hasher>>();
+
+	// both halves have to opt in, or lookups keep converting to key_type
+	using opaque_t = RE::BSTHashMap<key_type, mapped_type, transparent_hasher, std::equal_to<key_type>>;
+	static_assert(!can_find<opaque_t, std::string_view>);
+	static_assert(can_find<opaque_t, const char*>);
+	static_assert(!can_find<RE::BSTHashMap<key_type, mapped_type>, std::string_view>);
+}
+
+TEST_CASE("benchmark hash map growth")
+{
+	constexpr std::uint32_t count = 1u << 16;
+	std::vector<std::uint64_t> keys(count);
+	std::mt19937_64 rng(1);
+	std::generate(keys.begin(), keys.end(), rng);
+
+	BENCHMARK("grow by insertion")
+	{
+		RE::BSTHashMap<std::uint64_t, std::uint64_t> map;
+		for (const auto key : keys) {
+			map.emplace(key, key);
+		}
+		return map.size();
+	};
+
+	BENCHMARK("grow in place")
+	{
+		RE::BSTScatterTable<std::hash<std::uint64_t>, std::equal_to<std::uint64_t>, RE::BSTScatterTableTraits<std::uint64_t, std::uint64_t>, inplace_allocator> map;
+		for (const auto key : std::span{ keys }.first(inplace_allocator<1, 1>::CAPACITY)) {
+			map.emplace(key, key);
+		}
+		return map.size();
+	};
+}
+
+TEST_CASE("benchmark bulk hash map")
+{
+	// batching only pays off once the table outgrows the cache, so raise count in a release build to see it
+	constexpr std::uint32_t count = 1u << 16;
+	std::vector<RE::BSTTuple<const std::uint64_t, std::uint64_t>> values;
+	values.reserve(count);
+	std::mt19937_64 rng(1);
+	for (std::uint32_t i = 0; i < count; ++i) {
+		const auto key = rng();
+		values.emplace_back(key, key);
+	}
+
+	std::vector<std::uint64_t> keys(count);
+	std::ranges::transform(values, keys.begin(), [](const auto& a_value) { return a_value.first; });
+	std::shuffle(keys.begin(), keys.end(), rng);
+
+	BENCHMARK("build by insert")
+	{
+		RE::BSTHashMap<std::uint64_t, std::uint64_t> map;
+		map.insert(values.begin(), values.end());
+		return map.size();
+	};
+
+	BENCHMARK("build by insert_bulk")
+	{
+		RE::BSTHashMap<std::uint64_t, std::uint64_t> map;
+		map.insert_bulk(values);
+		return map.size();
+	};
+
+	RE::BSTHashMap<std::uint64_t, std::uint64_t> map;
+	map.insert_bulk(values);
+	std::vector<RE::BSTHashMap<std::uint64_t, std::uint64_t>::const_iterator> results(count);
+	const auto& cmap = map;
+
+	BENCHMARK("find")
+	{
+		for (std::uint32_t i = 0; i < count; ++i) {
+			results[i] = cmap.find(keys[i]);
+		}
+		return results.back() != cmap.end();
+	};
+
+	BENCHMARK("find_batch")
+	{
+		cmap.find_batch(keys, results);
+		return results.back() != cmap.end();
+	};
+}
+
+TEST_CASE("benchmark flat hash map")
+{
+	constexpr std::uint32_t count = 1u << 16;
+	std::vector<std::uint64_t> keys(count * 2);
+	std::mt19937_64 rng(6);
+	std::generate(keys.begin(), keys.end(), rng);
+	const auto present = std::span{ keys }.first(count);
+	const auto absent = std::span{ keys }.last(count);
+
+	const auto run = [&]<class T>(std::string_view a_name, std::type_identity<T>) {
+		BENCHMARK(fmt::format("{} insert", a_name))
+		{
+			T map;
+			for (const auto key : present) {
+				map.emplace(key, key);
+			}
+			return map.size();
+		};
+
+		T map;
+		for (const auto key : present) {
+			map.emplace(key, key);
+		}
+
+		BENCHMARK(fmt::format("{} find hit", a_name))
+		{
+			std::uint64_t sum = 0;
+			for (const auto key : present) {
+				sum += map.find(key)->second;
+			}
+			return sum;
+		};
+
+		BENCHMARK(fmt::format("{} find miss", a_name))
+		{
+			std::size_t found = 0;
+			for (const auto key : absent) {
+				found += map.contains(key) ? 1 : 0;
+			}
+			return found;
+		};
+
+		BENCHMARK_ADVANCED(fmt::format("{} erase", a_name))
+		(Catch::Benchmark::Chronometer a_meter)
+		{
+			std::vector<T> maps(static_cast<std::size_t>(a_meter.runs()), map);
+			a_meter.measure([&](int a_run) {
+				auto& victim = maps[static_cast<std::size_t>(a_run)];
+				for (const auto key : present) {
+					victim.erase(key);
+				}
+				return victim.size();
+			});
+		};
+	};
+
+	run("BSTHashMap", std::type_identity<RE::BSTHashMap<std::uint64_t, std::uint64_t>>{});
+	run("BSTFlatHashMap", std::type_identity<RE::BSTFlatHashMap<std::uint64_t, std::uint64_t>>{});
+}
+
+TEST_CASE("benchmark scatter table scans")
+{
+	constexpr std::uint32_t count = 1u << 16;
+	RE::BSTSet<std::uint64_t> dense;
+	std::mt19937_64 rng(8);
+	for (std::uint32_t i = 0; i < count; ++i) {
+		dense.insert(rng());
+	}
+
+	// a table left mostly empty by erasures, where skipping empty slots dominates
+	auto sparse = dense;
+	sparse.erase_if([](std::uint64_t a_value) { return a_value % 16 != 0; });
+
+	BENCHMARK("iterate dense")
+	{
+		return std::reduce(dense.begin(), dense.end(), std::uint64_t{ 0 });
+	};
+
+	BENCHMARK("iterate sparse")
+	{
+		return std::reduce(sparse.begin(), sparse.end(), std::uint64_t{ 0 });
+	};
+
+	// stands in for whatever a real scan does with each value
+	const auto visit = [](std::uint64_t a_value) {
+		for (std::size_t i = 0; i < 64; ++i) {
+			a_value = a_value * 0x9E3779B97F4A7C15ull + 1;
+		}
+		return a_value;
+	};
+
+	BENCHMARK("visit serially")
+	{
+		return std::transform_reduce(dense.begin(), dense.end(), std::uint64_t{ 0 }, std::plus<>(), visit);
+	};
+
+	BENCHMARK("visit by partition")
+	{
+		const auto parts = dense.partition(std::max(std::thread::hardware_concurrency(), 1u));
+		std::atomic<std::uint64_t> sum{ 0 };
+		std::for_each(std::execution::par, parts.begin(), parts.end(), [&](const auto& a_part) {
+			sum += std::transform_reduce(a_part.begin(), a_part.end(), std::uint64_t{ 0 }, std::plus<>(), visit);
+		});
+		return sum.load();
+	};
+
+	BENCHMARK_ADVANCED("erase half one at a time")
+	(Catch::Benchmark::Chronometer a_meter)
+	{
+		std::vector<RE::BSTSet<std::uint64_t>> sets(static_cast<std::size_t>(a_meter.runs()), dense);
+		a_meter.measure([&](int a_run) {
+			auto& set = sets[static_cast<std::size_t>(a_run)];
+			std::vector<std::uint64_t> victims;
+			std::ranges::copy_if(set, std::back_inserter(victims), [](std::uint64_t a_value) { return a_value % 2 == 0; });
+			for (const auto victim : victims) {
+				set.erase(victim);
+			}
+			return set.size();
+		});
+	};
+
+	BENCHMARK_ADVANCED("erase half by erase_if")
+	(Catch::Benchmark::Chronometer a_meter)
+	{
+		std::vector<RE::BSTSet<std::uint64_t>> sets(static_cast<std::size_t>(a_meter.runs()), dense);
+		a_meter.measure([&](int a_run) {
+			return sets[static_cast<std::size_t>(a_run)].erase_if([](std::uint64_t a_value) { return a_value % 2 == 0; });
+		});
+	};
+}
@@ -0,0 +1,128 @@
+#include "RE/Bethesda/CRC.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace RE
+{
+	template struct BSCRC32<std::int8_t>;
+	template struct BSCRC32<std::uint8_t>;
+	template struct BSCRC32<std::int16_t>;
+	template struct BSCRC32<std::uint16_t>;
+	template struct BSCRC32<std::int32_t>;
+	template struct BSCRC32<std::uint32_t>;
+	template struct BSCRC32<std::int64_t>;
+	template struct BSCRC32<std::uint64_t>;
+}
+
+namespace
+{
+	[[nodiscard]] std::vector<std::uint8_t> make_bytes(std::size_t a_size, std::uint32_t a_seed)
+	{
+		std::vector<std::uint8_t> bytes(a_size);
+		std::mt19937 rng(a_seed);
+		std::uniform_int_distribution<std::uint32_t> dist(0, 0xFF);
+		std::generate(bytes.begin(), bytes.end(), [&]() { return static_cast<std::uint8_t>(dist(rng)); });
+		return bytes;
+	}
+
+	template <class T>
+	[[nodiscard]] std::uint32_t reference(const T& a_value)
+	{
+		return RE::detail::UpdateCRC32Table(0, { reinterpret_cast<const std::uint8_t*>(std::addressof(a_value)), sizeof(T) });
+	}
+}
+
+TEST_CASE("test crc32")
+{
+	// zero seed and no final xor, so this isn't the usual 0xCBF43926
+	constexpr std::array<std::uint8_t, 9> check{ '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	static_assert(RE::detail::GenerateCRC32(check) == 0x2DFD2D88);
+	static_assert(RE::detail::GenerateCRC32({}) == 0);
+
+	const auto bytes = make_bytes(4096 + 64, 1);
+	const auto compare = [&](std::size_t a_offset, std::size_t a_size, std::uint32_t a_seed) {
+		const std::span data{ bytes.data() + a_offset, a_size };
+		const auto expected = RE::detail::UpdateCRC32Table(a_seed, data);
+		REQUIRE(RE::detail::UpdateCRC32Slice8(a_seed, data) == expected);
+		REQUIRE(RE::detail::UpdateCRC32Runtime(a_seed, data) == expected);
+		if (a_size >= 64 && RE::detail::HasPCLMUL()) {
+			REQUIRE(RE::detail::UpdateCRC32PCLMUL(a_seed, data) == expected);
+		}
+	};
+
+	// every length across the fold boundaries, at every misalignment
+	for (std::size_t size = 0; size <= 300; ++size) {
+		for (std::size_t offset = 0; offset < 16; ++offset) {
+			compare(offset, size, 0);
+		}
+	}
+	compare(3, 4096, 0);
+	compare(0, 4096 + 64, 0xDEADBEEF);
+
+	// the fixed-width paths must hash exactly the bytes of the key
+	std::mt19937_64 rng(2);
+	for (std::size_t i = 0; i < 1000; ++i) {
+		const auto value = rng();
+		REQUIRE(RE::BSCRC32<std::uint64_t>()(value) == reference(value));
+		REQUIRE(RE::BSCRC32<std::int64_t>()(static_cast<std::int64_t>(value)) == reference(static_cast<std::int64_t>(value)));
+		REQUIRE(RE::BSCRC32<std::uint32_t>()(static_cast<std::uint32_t>(value)) == reference(static_cast<std::uint32_t>(value)));
+		REQUIRE(RE::BSCRC32<std::int32_t>()(static_cast<std::int32_t>(value)) == reference(static_cast<std::int32_t>(value)));
+		REQUIRE(RE::BSCRC32<std::uint16_t>()(static_cast<std::uint16_t>(value)) == reference(static_cast<std::uint16_t>(value)));
+		REQUIRE(RE::BSCRC32<float>()(static_cast<float>(value)) == reference(static_cast<float>(value)));
+		REQUIRE(RE::BSCRC32<double>()(static_cast<double>(value)) == reference(static_cast<double>(value)));
+
+		const auto ptr = reinterpret_cast<const void*>(value);
+		REQUIRE(RE::BSCRC32<const void*>()(ptr) == reference(ptr));
+	}
+
+	const auto str = "the quick brown fox jumps over the lazy dog, then does it again for good measure"sv;
+	REQUIRE(RE::BSCRC32<std::string_view>()(str) == RE::detail::UpdateCRC32Table(0, { reinterpret_cast<const std::uint8_t*>(str.data()), str.size() }));
+	REQUIRE(RE::BSCRC32<std::string>()(std::string(str)) == RE::BSCRC32<std::string_view>()(str));
+}
+
+TEST_CASE("benchmark crc32")
+{
+	for (const std::size_t size : { 16u, 256u, 4096u, 65536u }) {
+		const auto bytes = make_bytes(size, 3);
+		const std::span data{ bytes };
+
+		BENCHMARK(fmt::format("table {}", size))
+		{
+			return RE::detail::UpdateCRC32Table(0, data);
+		};
+
+		BENCHMARK(fmt::format("slice8 {}", size))
+		{
+			return RE::detail::UpdateCRC32Slice8(0, data);
+		};
+
+		if (size >= 64 && RE::detail::HasPCLMUL()) {
+			BENCHMARK(fmt::format("pclmul {}", size))
+			{
+				return RE::detail::UpdateCRC32PCLMUL(0, data);
+			};
+		}
+	}
+
+	std::vector<std::uint64_t> keys(4096);
+	std::mt19937_64 rng(4);
+	std::generate(keys.begin(), keys.end(), rng);
+
+	BENCHMARK("u64 keys by table")
+	{
+		std::uint32_t sum = 0;
+		for (const auto key : keys) {
+			sum += reference(key);
+		}
+		return sum;
+	};
+
+	BENCHMARK("u64 keys by fixed width")
+	{
+		std::uint32_t sum = 0;
+		for (const auto key : keys) {
+			sum += RE::BSCRC32<std::uint64_t>()(key);
+		}
+		return sum;
+	};
+}
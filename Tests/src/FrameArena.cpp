@@ -0,0 +1,241 @@
+#include "MemoryManager.h"
+
+namespace RE
+{
+	template <class T>
+	using BSCRC32 = std::hash<T>;
+
+	template <class T1, class T2>
+	using BSTTuple = std::pair<T1, T2>;
+}
+
+#include "RE/Bethesda/BSTArray.h"
+#include "RE/Bethesda/BSTHashMap.h"
+#include "RE/Bethesda/FrameArena.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	constexpr std::size_t CHUNK_SIZE = RE::FrameArena::CHUNK_SIZE;
+
+	[[nodiscard]] bool is_aligned(const void* a_ptr, std::size_t a_alignment)
+	{
+		return reinterpret_cast<std::uintptr_t>(a_ptr) % a_alignment == 0;
+	}
+
+	[[nodiscard]] std::byte* allocate(RE::FrameArena& a_arena, std::size_t a_bytes, std::size_t a_alignment = 0x10)
+	{
+		const auto mem = static_cast<std::byte*>(a_arena.allocate(a_bytes, a_alignment));
+		REQUIRE(mem != nullptr);
+		REQUIRE(is_aligned(mem, a_alignment));
+		std::memset(mem, 0xCD, a_bytes);  // the whole request must be usable
+		return mem;
+	}
+
+	// the same requests each frame, which must land on the same addresses once the chunks exist
+	[[nodiscard]] std::vector<std::byte*> run_frame(RE::FrameArena& a_arena)
+	{
+		std::vector<std::byte*> result;
+		for (const auto bytes : { 0x10, 0x100, 0x3000, 0x9000, 0x9000, 0x40, 0x6000 }) {
+			result.push_back(allocate(a_arena, static_cast<std::size_t>(bytes)));
+		}
+		return result;
+	}
+}
+
+TEST_CASE("test frame arena rewind")
+{
+	RE::FrameArena arena;
+	REQUIRE(arena.reserved() == 0);
+
+	const auto first = run_frame(arena);
+	const auto reserved = arena.reserved();
+	REQUIRE(reserved == 2 * CHUNK_SIZE);
+	REQUIRE(std::ranges::adjacent_find(first) == first.end());
+
+	// the next frame starts over in the first chunk, and runs into the second as before
+	const auto frame = RE::FrameArena::CurrentFrame();
+	RE::FrameArena::NextFrame();
+	REQUIRE(RE::FrameArena::CurrentFrame() == frame + 1);
+	REQUIRE(run_frame(arena) == first);
+	REQUIRE(arena.reserved() == reserved);
+
+	// without a new frame the arena keeps going
+	const auto more = run_frame(arena);
+	REQUIRE(std::ranges::find_first_of(more, first) == more.end());
+	REQUIRE(arena.reserved() > reserved);
+
+	// reset rewinds one arena by hand, and release hands every chunk back
+	arena.reset();
+	REQUIRE(run_frame(arena) == first);
+	arena.release();
+	REQUIRE(arena.reserved() == 0);
+	(void)run_frame(arena);
+	REQUIRE(arena.reserved() == reserved);
+}
+
+TEST_CASE("test frame arena reallocate")
+{
+	RE::FrameArena arena;
+	REQUIRE(arena.reallocate(nullptr, 0, 0x20, 0x10) != nullptr);
+
+	// the most recent allocation grows and shrinks where it lies
+	const auto mem = allocate(arena, 0x100);
+	std::iota(reinterpret_cast<std::uint8_t*>(mem), reinterpret_cast<std::uint8_t*>(mem) + 0x100, std::uint8_t{ 0 });
+	REQUIRE(arena.reallocate(mem, 0x100, 0x1000, 0x10) == mem);
+	REQUIRE(arena.reallocate(mem, 0x1000, 0x80, 0x10) == mem);
+	REQUIRE(allocate(arena, 0x10) == mem + 0x80);
+
+	// anything else is copied
+	const auto moved = static_cast<std::byte*>(arena.reallocate(mem, 0x80, 0x200, 0x10));
+	REQUIRE(moved != mem);
+	for (std::size_t i = 0; i < 0x80; ++i) {
+		REQUIRE(static_cast<std::uint8_t>(moved[i]) == i);
+	}
+
+	// as is the most recent one, once its chunk runs out
+	const auto grown = static_cast<std::byte*>(arena.reallocate(moved, 0x200, 2 * CHUNK_SIZE, 0x10));
+	REQUIRE(grown != moved);
+	for (std::size_t i = 0; i < 0x80; ++i) {
+		REQUIRE(static_cast<std::uint8_t>(grown[i]) == i);
+	}
+	std::memset(grown, 0, 2 * CHUNK_SIZE);
+}
+
+TEST_CASE("test frame arena chunks")
+{
+	RE::FrameArena arena;
+
+	// a request bigger than a chunk gets a chunk of its own, linked in after the current one
+	const auto small = allocate(arena, 0x100);
+	const auto large = allocate(arena, 3 * CHUNK_SIZE);
+	REQUIRE(arena.reserved() == CHUNK_SIZE + 3 * CHUNK_SIZE + 0xF);
+	const auto aligned = allocate(arena, 0x100, 0x1000);
+	REQUIRE(arena.reserved() > 4 * CHUNK_SIZE);
+
+	// which later frames reuse
+	RE::FrameArena::NextFrame();
+	auto reserved = arena.reserved();
+	REQUIRE(allocate(arena, 0x100) == small);
+	REQUIRE(allocate(arena, 3 * CHUNK_SIZE) == large);
+	REQUIRE(allocate(arena, 0x100, 0x1000) == aligned);
+	REQUIRE(arena.reserved() == reserved);
+
+	// a chunk too small for the next request is passed over for a new one in front of it, and the
+	// one after that is still reused
+	RE::FrameArena::NextFrame();
+	REQUIRE(allocate(arena, 0x100) == small);
+	(void)allocate(arena, 4 * CHUNK_SIZE);
+	REQUIRE(arena.reserved() > reserved);
+	reserved = arena.reserved();
+	REQUIRE(allocate(arena, 3 * CHUNK_SIZE) == large);
+	REQUIRE(arena.reserved() == reserved);
+
+	// a request that doesn't fit what's left of a chunk moves on, wasting the rest
+	RE::FrameArena::NextFrame();
+	const auto head = allocate(arena, CHUNK_SIZE - 0x100);
+	REQUIRE(head == small);
+	REQUIRE(allocate(arena, 0x200) != head + CHUNK_SIZE - 0x100);
+}
+
+TEST_CASE("test frame arena deallocate")
+{
+	RE::FrameArena arena;
+
+	// only the most recent allocation gives its bytes back
+	const auto first = allocate(arena, 0x40);
+	const auto second = allocate(arena, 0x40);
+	REQUIRE(second == first + 0x40);
+	arena.deallocate(second);
+	REQUIRE(allocate(arena, 0x40) == second);
+
+	const auto third = allocate(arena, 0x40);
+	arena.deallocate(first);
+	REQUIRE(allocate(arena, 0x40) == third + 0x40);
+
+	// and only once
+	const auto fourth = allocate(arena, 0x40);
+	arena.deallocate(fourth);
+	arena.deallocate(fourth);
+	arena.deallocate(third);
+	REQUIRE(allocate(arena, 0x40) == fourth);
+	arena.deallocate(nullptr);
+}
+
+TEST_CASE("test frame arena containers")
+{
+	auto& arena = RE::FrameArena::GetThreadArena();
+	RE::FrameArena::NextFrame();
+
+	const auto frame = [&]() {
+		// an array growing alone stays the most recent allocation, so it grows in place
+		RE::FrameArenaArray<std::uint32_t> arr;
+		arr.push_back(0);
+		const auto data = arr.data();
+		for (std::uint32_t i = 1; i < 0x1000; ++i) {
+			arr.push_back(i);
+		}
+		REQUIRE(arr.data() == data);
+
+		// and when another allocation lands behind it, it's copied
+		RE::FrameArenaArray<std::uint32_t> other;
+		other.push_back(0);
+		for (std::uint32_t i = 0x1000; i < 0x10000; ++i) {
+			arr.push_back(i);
+		}
+		REQUIRE(arr.data() != data);
+		for (std::uint32_t i = 0; i < 0x10000; ++i) {
+			REQUIRE(arr[i] == i);
+		}
+
+		RE::FrameArenaArray<std::string> strings;
+		for (int i = 0; i < 1000; ++i) {
+			strings.emplace_back(fmt::format("{:064}", i));
+		}
+		for (int i = 0; i < 1000; ++i) {
+			REQUIRE(strings[i] == fmt::format("{:064}", i));
+		}
+
+		RE::FrameArenaHashMap<std::uint32_t, std::uint32_t> map;
+		for (std::uint32_t i = 0; i < 10000; ++i) {
+			REQUIRE(map.emplace(i, i * 3).second);
+		}
+		for (std::uint32_t i = 0; i < 10000; i += 2) {
+			REQUIRE(map.erase(i) == 1);
+		}
+		for (std::uint32_t i = 0; i < 10000; ++i) {
+			const auto it = map.find(i);
+			REQUIRE((it != map.end()) == (i % 2 == 1));
+			REQUIRE((it == map.end() || it->second == i * 3));
+		}
+
+		RE::FrameArenaSet<std::string> set;
+		for (int i = 0; i < 100; ++i) {
+			set.emplace(std::to_string(i));
+		}
+		REQUIRE(set.size() == 100);
+		REQUIRE(set.contains("42"));
+	};
+
+	// a frame's worth of containers, and the same again on the chunks the first left behind
+	frame();
+	const auto reserved = arena.reserved();
+	REQUIRE(reserved > 0);
+	RE::FrameArena::NextFrame();
+	frame();
+	REQUIRE(arena.reserved() == reserved);
+
+	// each thread has an arena of its own
+	const RE::FrameArena* elsewhere = nullptr;
+	std::size_t reservedElsewhere = 0;
+	std::thread([&]() {
+		elsewhere = std::addressof(RE::FrameArena::GetThreadArena());
+		RE::FrameArenaArray<int> arr;
+		arr.resize(100);
+		reservedElsewhere = elsewhere->reserved();
+	}).join();
+	REQUIRE(elsewhere != std::addressof(arena));
+	REQUIRE(reservedElsewhere == CHUNK_SIZE);
+	REQUIRE(arena.reserved() == reserved);
+}
@@ -0,0 +1,641 @@
+#include "MemoryManager.h"
+
+#ifdef _WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <Windows.h>
+#else
+#	include <sys/mman.h>
+#endif
+
+namespace
+{
+	[[nodiscard]] std::byte* reserve_pages(std::size_t a_bytes)
+	{
+#ifdef _WIN32
+		return static_cast<std::byte*>(::VirtualAlloc(nullptr, a_bytes, MEM_RESERVE, PAGE_NOACCESS));
+#else
+		const auto mem = ::mmap(nullptr, a_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		return mem != MAP_FAILED ? static_cast<std::byte*>(mem) : nullptr;
+#endif
+	}
+
+	[[nodiscard]] bool commit_pages(std::byte* a_mem, std::size_t a_bytes)
+	{
+#ifdef _WIN32
+		return ::VirtualAlloc(a_mem, a_bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+		return ::mprotect(a_mem, a_bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+	}
+
+	void decommit_pages(std::byte* a_mem, std::size_t a_bytes)
+	{
+#ifdef _WIN32
+		::VirtualFree(a_mem, a_bytes, MEM_DECOMMIT);
+#else
+		::madvise(a_mem, a_bytes, MADV_DONTNEED);
+		::mprotect(a_mem, a_bytes, PROT_NONE);
+#endif
+	}
+
+	void release_pages(std::byte* a_mem, [[maybe_unused]] std::size_t a_bytes)
+	{
+#ifdef _WIN32
+		::VirtualFree(a_mem, 0, MEM_RELEASE);
+#else
+		::munmap(a_mem, a_bytes);
+#endif
+	}
+
+	[[nodiscard]] constexpr std::size_t align_up(std::size_t a_value, std::size_t a_alignment) noexcept
+	{
+		return (a_value + a_alignment - 1) & ~(a_alignment - 1);
+	}
+
+	using Block = RE::ScrapHeap::Block;
+	using FreeBlock = RE::ScrapHeap::FreeBlock;
+	using FreeTreeNode = RE::ScrapHeap::FreeTreeNode;
+
+	[[nodiscard]] std::size_t size_of(const Block* a_block) noexcept { return a_block->sizeFlags & ~RE::ScrapHeap::FLAGS_MASK; }
+	[[nodiscard]] bool is_free(const Block* a_block) noexcept { return (a_block->sizeFlags & RE::ScrapHeap::FREE_FLAG) != 0; }
+	[[nodiscard]] std::byte* payload_of(Block* a_block) noexcept { return reinterpret_cast<std::byte*>(a_block + 1); }
+	[[nodiscard]] Block* next_of(Block* a_block) noexcept { return reinterpret_cast<Block*>(payload_of(a_block) + size_of(a_block)); }
+
+	[[nodiscard]] Block* header_of(const void* a_mem) noexcept
+	{
+		const auto header = const_cast<Block*>(static_cast<const Block*>(a_mem) - 1);
+		return (header->sizeFlags & RE::ScrapHeap::PADDING_FLAG) != 0 ? header->prev : header;
+	}
+
+	[[nodiscard]] std::size_t small_index(std::size_t a_size) noexcept { return a_size / RE::ScrapHeap::GRANULARITY - 1; }
+
+	[[nodiscard]] FreeTreeNode* parent_of(const FreeTreeNode* a_node) noexcept
+	{
+		return reinterpret_cast<FreeTreeNode*>(a_node->parentAndBlack & ~std::size_t{ 1 });
+	}
+
+	[[nodiscard]] bool is_black(const FreeTreeNode* a_node) noexcept { return !a_node || (a_node->parentAndBlack & 1) != 0; }
+
+	void set_parent(FreeTreeNode* a_node, FreeTreeNode* a_parent) noexcept
+	{
+		a_node->parentAndBlack = reinterpret_cast<std::size_t>(a_parent) | (a_node->parentAndBlack & 1);
+	}
+
+	void set_black(FreeTreeNode* a_node, bool a_black) noexcept
+	{
+		a_node->parentAndBlack = (a_node->parentAndBlack & ~std::size_t{ 1 }) | (a_black ? 1 : 0);
+	}
+}
+
+namespace RE
+{
+	ScrapHeap::ScrapHeap(std::size_t a_reserveSize)
+	{
+		reserveSize = align_up(a_reserveSize, minCommit);
+		baseAddress = reserve_pages(reserveSize);
+		if (!baseAddress) {
+			stl::report_and_fail("failed to reserve scrap heap"sv);
+		}
+		endAddress = baseAddress + reserveSize;
+		commitEnd = baseAddress;
+	}
+
+	ScrapHeap::~ScrapHeap() { release_pages(baseAddress, reserveSize); }
+
+	std::size_t ScrapHeap::Size(const void* a_mem) const
+	{
+		const auto block = header_of(a_mem);
+		return size_of(block) - static_cast<std::size_t>(static_cast<const std::byte*>(a_mem) - payload_of(block));
+	}
+
+	void* ScrapHeap::Allocate(std::size_t a_size, std::size_t a_alignment)
+	{
+		const auto alignment = std::max(a_alignment, GRANULARITY);
+		assert(std::has_single_bit(alignment));
+
+		// an over-aligned request takes enough slack to find an aligned spot with a header in front
+		const auto size = align_up(std::max<std::size_t>(a_size, 1), GRANULARITY) + (alignment - GRANULARITY);
+		auto block = TakeFree(size);
+		if (!block) {
+			block = TakeTop(size);
+			if (!block) {
+				return nullptr;
+			}
+		}
+
+		totalAllocated += size_of(block);
+		++totalAllocatedBlocks;
+
+		const auto mem = payload_of(block);
+		const auto aligned = reinterpret_cast<std::byte*>(align_up(reinterpret_cast<std::size_t>(mem), alignment));
+		if (aligned != mem) {
+			const auto padding = reinterpret_cast<Block*>(aligned) - 1;
+			padding->sizeFlags = PADDING_FLAG | static_cast<std::size_t>(aligned - mem);
+			padding->prev = block;
+		}
+		return aligned;
+	}
+
+	void ScrapHeap::Deallocate(void* a_mem)
+	{
+		if (!a_mem) {
+			return;
+		}
+
+		auto block = header_of(a_mem);
+		assert(ContainsBlockImpl(block) && !is_free(block));
+		totalAllocated -= size_of(block);
+		--totalAllocatedBlocks;
+
+		// free blocks never touch, so at most one neighbour on either side needs merging
+		if (block != lastBlock) {
+			const auto next = next_of(block);
+			if (is_free(next)) {
+				RemoveFree(next);
+				block->sizeFlags += sizeof(Block) + size_of(next);
+				next_of(block)->prev = block;
+			}
+		}
+
+		if (const auto prev = block->prev; prev && is_free(prev)) {
+			RemoveFree(prev);
+			prev->sizeFlags = size_of(prev) + sizeof(Block) + size_of(block);
+			if (block == lastBlock) {
+				lastBlock = prev;
+			} else {
+				next_of(prev)->prev = prev;
+			}
+			block = prev;
+		}
+
+		if (block == lastBlock) {
+			lastBlock = block->prev;
+			ReleaseTop();
+		} else {
+			InsertFree(block);
+		}
+	}
+
+	auto ScrapHeap::TakeFree(std::size_t a_size)
+		-> Block*
+	{
+		FreeBlock* block = nullptr;
+		if (a_size <= SMALL_BLOCK_MAX) {
+			for (auto i = small_index(a_size); i < std::size(smallBlocks); ++i) {
+				if (smallBlocks[i]) {
+					block = smallBlocks[i];
+					break;
+				}
+			}
+		}
+
+		if (!block) {
+			// best fit, taking a same-size follower before the node itself spares the tree a rebalance
+			FreeTreeNode* fit = nullptr;
+			for (auto node = freeList; node;) {
+				if (size_of(node) < a_size) {
+					node = node->rightNode;
+				} else {
+					fit = node;
+					node = node->leftNode;
+				}
+			}
+
+			if (fit) {
+				block = fit->right ? fit->right : fit;
+			}
+		}
+
+		if (block) {
+			RemoveFree(block);
+			Split(block, a_size);
+		}
+		return block;
+	}
+
+	auto ScrapHeap::TakeTop(std::size_t a_size)
+		-> Block*
+	{
+		const auto top = lastBlock ? reinterpret_cast<std::byte*>(next_of(lastBlock)) : baseAddress;
+		if (static_cast<std::size_t>(endAddress - top) < sizeof(Block) + a_size) {
+			return nullptr;
+		}
+
+		const auto end = top + sizeof(Block) + a_size;
+		if (end > commitEnd) {
+			const auto grow = std::min(
+				align_up(static_cast<std::size_t>(end - commitEnd), minCommit),
+				static_cast<std::size_t>(endAddress - commitEnd));
+			if (!commit_pages(commitEnd, grow)) {
+				return nullptr;
+			}
+			commitEnd += grow;
+		}
+
+		const auto block = reinterpret_cast<Block*>(top);
+		block->sizeFlags = a_size;
+		block->prev = lastBlock;
+		lastBlock = block;
+		return block;
+	}
+
+	void ScrapHeap::Split(Block* a_block, std::size_t a_size)
+	{
+		const auto size = size_of(a_block);
+		if (size - a_size >= sizeof(FreeBlock)) {
+			const auto rest = reinterpret_cast<Block*>(payload_of(a_block) + a_size);
+			rest->sizeFlags = size - a_size - sizeof(Block);
+			rest->prev = a_block;
+			next_of(rest)->prev = rest;
+			InsertFree(rest);
+			a_block->sizeFlags = a_size;
+		}
+	}
+
+	// hands back committed pages well past the top, keeping one commit's worth for the next request
+	void ScrapHeap::ReleaseTop()
+	{
+		if (keepPagesRequest > 0) {
+			return;
+		}
+
+		const auto top = lastBlock ? reinterpret_cast<std::byte*>(next_of(lastBlock)) : baseAddress;
+		const auto keep = baseAddress + align_up(static_cast<std::size_t>(top - baseAddress), minCommit) + minCommit;
+		if (keep < commitEnd && static_cast<std::size_t>(commitEnd - top) > minCommit * 2) {
+			decommit_pages(keep, static_cast<std::size_t>(commitEnd - keep));
+			commitEnd = keep;
+		}
+	}
+
+	void ScrapHeap::InsertFree(Block* a_block)
+	{
+		const auto size = size_of(a_block);
+		const auto block = static_cast<FreeBlock*>(a_block);
+		block->sizeFlags = size | FREE_FLAG;
+		block->left = nullptr;
+		++totalFreeBlocks;
+
+		if (size <= SMALL_BLOCK_MAX) {
+			auto& head = smallBlocks[small_index(size)];
+			block->right = head;
+			if (head) {
+				head->left = block;
+			}
+			head = block;
+			++freeSmallBlocks;
+			return;
+		}
+
+		const auto node = static_cast<FreeTreeNode*>(block);
+		auto parent = freeList;
+		while (parent && size_of(parent) != size) {
+			parent = size < size_of(parent) ? parent->leftNode : parent->rightNode;
+		}
+
+		if (parent) {
+			node->root = nullptr;
+			node->left = parent;
+			node->right = parent->right;
+			if (parent->right) {
+				parent->right->left = node;
+			}
+			parent->right = node;
+		} else {
+			node->right = nullptr;
+			InsertNode(node);
+		}
+	}
+
+	void ScrapHeap::RemoveFree(Block* a_block)
+	{
+		const auto size = size_of(a_block);
+		const auto block = static_cast<FreeBlock*>(a_block);
+		block->sizeFlags = size;
+		--totalFreeBlocks;
+
+		if (size <= SMALL_BLOCK_MAX) {
+			if (block->left) {
+				block->left->right = block->right;
+			} else {
+				smallBlocks[small_index(size)] = block->right;
+			}
+			if (block->right) {
+				block->right->left = block->left;
+			}
+			--freeSmallBlocks;
+			return;
+		}
+
+		const auto node = static_cast<FreeTreeNode*>(block);
+		if (!node->root) {
+			node->left->right = node->right;
+			if (node->right) {
+				node->right->left = node->left;
+			}
+		} else if (const auto follower = static_cast<FreeTreeNode*>(node->right)) {
+			// the next block of the same size takes the node's place in the tree
+			follower->root = node->root;
+			follower->left = nullptr;
+			follower->leftNode = node->leftNode;
+			follower->rightNode = node->rightNode;
+			follower->parentAndBlack = node->parentAndBlack;
+			if (follower->leftNode) {
+				set_parent(follower->leftNode, follower);
+			}
+			if (follower->rightNode) {
+				set_parent(follower->rightNode, follower);
+			}
+			ReplaceChild(parent_of(node), node, follower);
+		} else {
+			EraseNode(node);
+		}
+	}
+
+	void ScrapHeap::InsertNode(FreeTreeNode* a_node)
+	{
+		const auto size = size_of(a_node);
+		FreeTreeNode* parent = nullptr;
+		for (auto iter = freeList; iter;) {
+			parent = iter;
+			iter = size < size_of(iter) ? iter->leftNode : iter->rightNode;
+		}
+
+		a_node->root = std::addressof(freeList);
+		a_node->leftNode = nullptr;
+		a_node->rightNode = nullptr;
+		a_node->parentAndBlack = reinterpret_cast<std::size_t>(parent);
+		if (!parent) {
+			freeList = a_node;
+		} else if (size < size_of(parent)) {
+			parent->leftNode = a_node;
+		} else {
+			parent->rightNode = a_node;
+		}
+
+		auto node = a_node;
+		while (node != freeList && !is_black(parent_of(node))) {
+			auto parent = parent_of(node);
+			const auto grandparent = parent_of(parent);
+			if (parent == grandparent->leftNode) {
+				const auto uncle = grandparent->rightNode;
+				if (!is_black(uncle)) {
+					set_black(parent, true);
+					set_black(uncle, true);
+					set_black(grandparent, false);
+					node = grandparent;
+				} else {
+					if (node == parent->rightNode) {
+						node = parent;
+						RotateLeft(node);
+						parent = parent_of(node);
+					}
+					set_black(parent, true);
+					set_black(grandparent, false);
+					RotateRight(grandparent);
+				}
+			} else {
+				const auto uncle = grandparent->leftNode;
+				if (!is_black(uncle)) {
+					set_black(parent, true);
+					set_black(uncle, true);
+					set_black(grandparent, false);
+					node = grandparent;
+				} else {
+					if (node == parent->leftNode) {
+						node = parent;
+						RotateRight(node);
+						parent = parent_of(node);
+					}
+					set_black(parent, true);
+					set_black(grandparent, false);
+					RotateLeft(grandparent);
+				}
+			}
+		}
+		set_black(freeList, true);
+	}
+
+	void ScrapHeap::EraseNode(FreeTreeNode* a_node)
+	{
+		FreeTreeNode* child = nullptr;
+		FreeTreeNode* parent = nullptr;
+		bool black = is_black(a_node);
+
+		if (!a_node->leftNode || !a_node->rightNode) {
+			child = a_node->leftNode ? a_node->leftNode : a_node->rightNode;
+			parent = parent_of(a_node);
+			if (child) {
+				set_parent(child, parent);
+			}
+			ReplaceChild(parent, a_node, child);
+		} else {
+			// splice out the successor, then move it into the node's place, colour and all
+			auto successor = a_node->rightNode;
+			while (successor->leftNode) {
+				successor = successor->leftNode;
+			}
+
+			black = is_black(successor);
+			child = successor->rightNode;
+			if (successor == a_node->rightNode) {
+				parent = successor;
+			} else {
+				parent = parent_of(successor);
+				if (child) {
+					set_parent(child, parent);
+				}
+				parent->leftNode = child;
+				successor->rightNode = a_node->rightNode;
+				set_parent(successor->rightNode, successor);
+			}
+
+			successor->leftNode = a_node->leftNode;
+			set_parent(successor->leftNode, successor);
+			ReplaceChild(parent_of(a_node), a_node, successor);
+			successor->parentAndBlack = a_node->parentAndBlack;
+		}
+
+		if (!black) {
+			return;
+		}
+
+		while (child != freeList && is_black(child)) {
+			if (child == parent->leftNode) {
+				auto sibling = parent->rightNode;
+				if (!is_black(sibling)) {
+					set_black(sibling, true);
+					set_black(parent, false);
+					RotateLeft(parent);
+					sibling = parent->rightNode;
+				}
+
+				if (is_black(sibling->leftNode) && is_black(sibling->rightNode)) {
+					set_black(sibling, false);
+					child = parent;
+					parent = parent_of(parent);
+				} else {
+					if (is_black(sibling->rightNode)) {
+						set_black(sibling->leftNode, true);
+						set_black(sibling, false);
+						RotateRight(sibling);
+						sibling = parent->rightNode;
+					}
+					set_black(sibling, is_black(parent));
+					set_black(parent, true);
+					set_black(sibling->rightNode, true);
+					RotateLeft(parent);
+					child = freeList;
+				}
+			} else {
+				auto sibling = parent->leftNode;
+				if (!is_black(sibling)) {
+					set_black(sibling, true);
+					set_black(parent, false);
+					RotateRight(parent);
+					sibling = parent->leftNode;
+				}
+
+				if (is_black(sibling->leftNode) && is_black(sibling->rightNode)) {
+					set_black(sibling, false);
+					child = parent;
+					parent = parent_of(parent);
+				} else {
+					if (is_black(sibling->leftNode)) {
+						set_black(sibling->rightNode, true);
+						set_black(sibling, false);
+						RotateLeft(sibling);
+						sibling = parent->leftNode;
+					}
+					set_black(sibling, is_black(parent));
+					set_black(parent, true);
+					set_black(sibling->leftNode, true);
+					RotateRight(parent);
+					child = freeList;
+				}
+			}
+		}
+
+		if (child) {
+			set_black(child, true);
+		}
+	}
+
+	void ScrapHeap::ReplaceChild(FreeTreeNode* a_parent, FreeTreeNode* a_old, FreeTreeNode* a_new)
+	{
+		if (!a_parent) {
+			freeList = a_new;
+		} else if (a_parent->leftNode == a_old) {
+			a_parent->leftNode = a_new;
+		} else {
+			a_parent->rightNode = a_new;
+		}
+	}
+
+	void ScrapHeap::RotateLeft(FreeTreeNode* a_node)
+	{
+		const auto pivot = a_node->rightNode;
+		a_node->rightNode = pivot->leftNode;
+		if (pivot->leftNode) {
+			set_parent(pivot->leftNode, a_node);
+		}
+		set_parent(pivot, parent_of(a_node));
+		ReplaceChild(parent_of(a_node), a_node, pivot);
+		pivot->leftNode = a_node;
+		set_parent(a_node, pivot);
+	}
+
+	void ScrapHeap::RotateRight(FreeTreeNode* a_node)
+	{
+		const auto pivot = a_node->leftNode;
+		a_node->leftNode = pivot->rightNode;
+		if (pivot->rightNode) {
+			set_parent(pivot->rightNode, a_node);
+		}
+		set_parent(pivot, parent_of(a_node));
+		ReplaceChild(parent_of(a_node), a_node, pivot);
+		pivot->rightNode = a_node;
+		set_parent(a_node, pivot);
+	}
+
+	MemoryManager::~MemoryManager()
+	{
+		while (threadScrapHeap) {
+			delete std::exchange(threadScrapHeap, threadScrapHeap->next);
+		}
+	}
+
+	MemoryManager& MemoryManager::GetSingleton()
+	{
+		static MemoryManager singleton;
+		return singleton;
+	}
+
+	// alignment-required blocks keep the block malloc returned, and their size, in the 16 bytes in front
+	void* MemoryManager::Allocate(std::size_t a_size, std::uint32_t a_alignment, bool a_alignmentRequired)
+	{
+		if (!a_alignmentRequired) {
+			return std::malloc(std::max<std::size_t>(a_size, 1));
+		}
+
+		const auto alignment = std::max<std::size_t>(a_alignment, 0x10);
+		const auto base = static_cast<std::byte*>(std::malloc(a_size + alignment + 0x10));
+		if (!base) {
+			return nullptr;
+		}
+
+		const auto mem = reinterpret_cast<std::byte*>(align_up(reinterpret_cast<std::size_t>(base) + 0x10, alignment));
+		const auto header = reinterpret_cast<std::size_t*>(mem) - 2;
+		header[0] = reinterpret_cast<std::size_t>(base);
+		header[1] = a_size;
+		return mem;
+	}
+
+	void MemoryManager::Deallocate(void* a_mem, bool a_alignmentRequired)
+	{
+		if (a_mem && a_alignmentRequired) {
+			std::free(reinterpret_cast<void*>(static_cast<std::size_t*>(a_mem)[-2]));
+		} else {
+			std::free(a_mem);
+		}
+	}
+
+	// the engine walks threadScrapHeap for the calling thread on every call. the walk is the same here,
+	// with new threads pushed on the front under a lock
+	ScrapHeap* MemoryManager::GetThreadScrapHeap()
+	{
+		const auto id = std::this_thread::get_id();
+		const auto find = [&]() -> ScrapHeap* {
+			for (auto iter = std::atomic_ref(threadScrapHeap).load(std::memory_order_acquire); iter; iter = iter->next) {
+				if (iter->owningThread == id) {
+					return std::addressof(iter->heap);
+				}
+			}
+			return nullptr;
+		};
+
+		if (const auto heap = find()) {
+			return heap;
+		}
+
+		const std::scoped_lock l{ _lock };
+		const auto entry = new ThreadScrapHeap();
+		entry->next = threadScrapHeap;
+		std::atomic_ref(threadScrapHeap).store(entry, std::memory_order_release);
+		return std::addressof(entry->heap);
+	}
+
+	void* MemoryManager::Reallocate(void* a_oldMem, std::size_t a_newSize, std::uint32_t a_alignment, bool a_alignmentRequired)
+	{
+		if (!a_alignmentRequired) {
+			return std::realloc(a_oldMem, std::max<std::size_t>(a_newSize, 1));
+		}
+
+		const auto mem = Allocate(a_newSize, a_alignment, true);
+		if (mem && a_oldMem) {
+			std::memcpy(mem, a_oldMem, std::min(static_cast<std::size_t*>(a_oldMem)[-1], a_newSize));
+			Deallocate(a_oldMem, true);
+		}
+		return mem;
+	}
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+// host stand-ins for RE/Bethesda/MemoryManager.h, which the library headers skip under F4SE_TEST_SUITE.
+// the scrap heap follows the engine's layout and bookkeeping so container benchmarks see the same
+// allocation pattern costs they would in game; the general heap is the C runtime's
+
+namespace RE
+{
+	class ScrapHeap
+	{
+	public:
+		static constexpr std::size_t FREE_FLAG = std::size_t{ 1 } << 63;
+		static constexpr std::size_t PADDING_FLAG = std::size_t{ 1 } << 62;
+		static constexpr std::size_t FLAGS_MASK = FREE_FLAG | PADDING_FLAG;
+
+		static constexpr std::size_t GRANULARITY = 0x10;
+		static constexpr std::size_t SMALL_BLOCK_MAX = GRANULARITY * 6;
+
+		// every block starts with one of these, sizeFlags holding the payload size. the header in front
+		// of an over-aligned allocation may instead be a stand-in flagged as padding, whose prev points
+		// back at the real block
+		struct Block
+		{
+		public:
+			// members
+			std::size_t sizeFlags;  // 00
+			Block* prev;            // 08
+		};
+		static_assert(sizeof(Block) == 0x10);
+
+		// free blocks up to SMALL_BLOCK_MAX sit in smallBlocks by size, the rest in freeList. left and
+		// right link blocks of the same size
+		struct FreeBlock :
+			public Block  // 00
+		{
+		public:
+			// members
+			FreeBlock* left;   // 10
+			FreeBlock* right;  // 18
+		};
+		static_assert(sizeof(FreeBlock) == 0x20);
+
+		// freeList is a red-black tree with one node per size. root is null for the blocks that hang off
+		// a node's list instead of sitting in the tree themselves
+		struct FreeTreeNode :
+			public FreeBlock  // 00
+		{
+		public:
+			// members
+			FreeTreeNode** root;         // 20
+			FreeTreeNode* leftNode;      // 28
+			FreeTreeNode* rightNode;     // 30
+			std::size_t parentAndBlack;  // 38
+		};
+		static_assert(sizeof(FreeTreeNode) == 0x40);
+
+		explicit ScrapHeap(std::size_t a_reserveSize = std::size_t{ 1 } << 26);
+		ScrapHeap(const ScrapHeap&) = delete;
+		ScrapHeap(ScrapHeap&&) = delete;
+
+		virtual ~ScrapHeap();
+
+		ScrapHeap& operator=(const ScrapHeap&) = delete;
+		ScrapHeap& operator=(ScrapHeap&&) = delete;
+
+		[[nodiscard]] std::size_t Size(const void* a_mem) const;
+		[[nodiscard]] bool ContainsBlockImpl(const void* a_block) const { return baseAddress <= a_block && a_block < endAddress; }
+
+		[[nodiscard]] void* Allocate(std::size_t a_size, std::size_t a_alignment);
+		void Deallocate(void* a_mem);
+
+		// members
+		FreeBlock* smallBlocks[6]{ nullptr };     // 08
+		FreeTreeNode* freeList{ nullptr };        // 38
+		Block* lastBlock{ nullptr };              // 40
+		std::byte* baseAddress{ nullptr };        // 48
+		std::byte* endAddress{ nullptr };         // 50
+		std::byte* commitEnd{ nullptr };          // 58
+		std::size_t reserveSize;                  // 60
+		std::size_t minCommit{ 1u << 17 };        // 68
+		std::size_t totalAllocated{ 0 };          // 70
+		std::uint32_t keepPagesRequest{ 0 };      // 78
+		std::uint32_t totalFreeBlocks{ 0 };       // 7C
+		std::uint32_t freeSmallBlocks{ 0 };       // 80
+		std::uint32_t totalAllocatedBlocks{ 0 };  // 84
+		std::uint32_t pmpBarrier{ 0 };            // 88
+
+	private:
+		[[nodiscard]] Block* TakeFree(std::size_t a_size);
+		[[nodiscard]] Block* TakeTop(std::size_t a_size);
+		void Split(Block* a_block, std::size_t a_size);
+		void ReleaseTop();
+
+		void InsertFree(Block* a_block);
+		void RemoveFree(Block* a_block);
+
+		void InsertNode(FreeTreeNode* a_node);
+		void EraseNode(FreeTreeNode* a_node);
+		void ReplaceChild(FreeTreeNode* a_parent, FreeTreeNode* a_old, FreeTreeNode* a_new);
+		void RotateLeft(FreeTreeNode* a_node);
+		void RotateRight(FreeTreeNode* a_node);
+	};
+	static_assert(sizeof(ScrapHeap) == 0x90);
+
+	class MemoryManager
+	{
+	public:
+		struct ThreadScrapHeap
+		{
+		public:
+			// members
+			ScrapHeap heap;                                               // 00
+			ThreadScrapHeap* next{ nullptr };                             // 90
+			std::thread::id owningThread{ std::this_thread::get_id() };  // 98
+		};
+
+		MemoryManager() = default;
+		MemoryManager(const MemoryManager&) = delete;
+		MemoryManager(MemoryManager&&) = delete;
+
+		~MemoryManager();
+
+		MemoryManager& operator=(const MemoryManager&) = delete;
+		MemoryManager& operator=(MemoryManager&&) = delete;
+
+		[[nodiscard]] static MemoryManager& GetSingleton();
+
+		[[nodiscard]] void* Allocate(std::size_t a_size, std::uint32_t a_alignment, bool a_alignmentRequired);
+		void Deallocate(void* a_mem, bool a_alignmentRequired);
+		[[nodiscard]] ScrapHeap* GetThreadScrapHeap();
+		[[nodiscard]] void* Reallocate(void* a_oldMem, std::size_t a_newSize, std::uint32_t a_alignment, bool a_alignmentRequired);
+
+		// members
+		ThreadScrapHeap* threadScrapHeap{ nullptr };
+
+	private:
+		std::mutex _lock;
+	};
+
+	[[nodiscard]] inline void* malloc(std::size_t a_size)
+	{
+		auto& mem = MemoryManager::GetSingleton();
+		return mem.Allocate(a_size, 0, false);
+	}
+
+	template <class T>
+	[[nodiscard]] T* malloc()
+	{
+		return static_cast<T*>(malloc(sizeof(T)));
+	}
+
+	[[nodiscard]] inline void* aligned_alloc(std::size_t a_alignment, std::size_t a_size)
+	{
+		auto& mem = MemoryManager::GetSingleton();
+		return mem.Allocate(a_size, static_cast<std::uint32_t>(a_alignment), true);
+	}
+
+	template <class T>
+	[[nodiscard]] T* aligned_alloc()
+	{
+		return static_cast<T*>(aligned_alloc(alignof(T), sizeof(T)));
+	}
+
+	[[nodiscard]] inline void* calloc(std::size_t a_num, std::size_t a_size)
+	{
+		const auto ret = malloc(a_num * a_size);
+		if (ret) {
+			std::memset(ret, 0, a_num * a_size);
+		}
+		return ret;
+	}
+
+	template <class T>
+	[[nodiscard]] T* calloc(std::size_t a_num)
+	{
+		return static_cast<T*>(calloc(a_num, sizeof(T)));
+	}
+
+	[[nodiscard]] inline void* realloc(void* a_ptr, std::size_t a_newSize)
+	{
+		auto& mem = MemoryManager::GetSingleton();
+		return mem.Reallocate(a_ptr, a_newSize, 0, false);
+	}
+
+	[[nodiscard]] inline void* aligned_realloc(void* a_ptr, std::size_t a_alignment, std::size_t a_newSize)
+	{
+		auto& mem = MemoryManager::GetSingleton();
+		return mem.Reallocate(a_ptr, a_newSize, static_cast<std::uint32_t>(a_alignment), true);
+	}
+
+	inline void free(void* a_ptr)
+	{
+		auto& mem = MemoryManager::GetSingleton();
+		return mem.Deallocate(a_ptr, false);
+	}
+
+	inline void aligned_free(void* a_ptr)
+	{
+		auto& mem = MemoryManager::GetSingleton();
+		return mem.Deallocate(a_ptr, true);
+	}
+}
+
+#define F4_HEAP_REDEFINE_HELPER(...)                                                                          \
+	[[nodiscard]] void* operator new(std::size_t a_count, std::align_val_t a_alignment)                       \
+	{                                                                                                         \
+		const auto mem = RE::aligned_alloc(static_cast<std::size_t>(a_alignment), a_count);                   \
+		if (mem) {                                                                                            \
+			return mem;                                                                                       \
+		} else {                                                                                              \
+			stl::report_and_fail("out of memory"sv);                                                          \
+		}                                                                                                     \
+	}                                                                                                         \
+                                                                                                              \
+	[[nodiscard]] void* operator new[](std::size_t a_count, std::align_val_t a_alignment)                     \
+	{                                                                                                         \
+		const auto mem = RE::aligned_alloc(static_cast<std::size_t>(a_alignment), a_count);                   \
+		if (mem) {                                                                                            \
+			return mem;                                                                                       \
+		} else {                                                                                              \
+			stl::report_and_fail("out of memory"sv);                                                          \
+		}                                                                                                     \
+	}                                                                                                         \
+                                                                                                              \
+	[[nodiscard]] void* operator new(std::size_t, void* a_ptr) noexcept { return a_ptr; }                     \
+	[[nodiscard]] void* operator new[](std::size_t, void* a_ptr) noexcept { return a_ptr; }                   \
+	[[nodiscard]] void* operator new(std::size_t, std::align_val_t, void* a_ptr) noexcept { return a_ptr; }   \
+	[[nodiscard]] void* operator new[](std::size_t, std::align_val_t, void* a_ptr) noexcept { return a_ptr; } \
+                                                                                                              \
+	void operator delete(void*, void*) noexcept { return; }                                                   \
+	void operator delete[](void*, void*) noexcept { return; }                                                 \
+                                                                                                              \
+	void operator delete(void* a_ptr, std::align_val_t) { RE::aligned_free(a_ptr); }                          \
+	void operator delete[](void* a_ptr, std::align_val_t) { RE::aligned_free(a_ptr); }                        \
+	void operator delete(void* a_ptr, std::size_t, std::align_val_t) { RE::aligned_free(a_ptr); }             \
+	void operator delete[](void* a_ptr, std::size_t, std::align_val_t) { RE::aligned_free(a_ptr); }
+
+#define F4_HEAP_REDEFINE_NEW(...)                                         \
+	[[nodiscard]] void* operator new(std::size_t a_count)                 \
+	{                                                                     \
+		const auto mem = RE::malloc(a_count);                             \
+		if (mem) {                                                        \
+			return mem;                                                   \
+		} else {                                                          \
+			stl::report_and_fail("out of memory"sv);                      \
+		}                                                                 \
+	}                                                                     \
+                                                                          \
+	[[nodiscard]] void* operator new[](std::size_t a_count)               \
+	{                                                                     \
+		const auto mem = RE::malloc(a_count);                             \
+		if (mem) {                                                        \
+			return mem;                                                   \
+		} else {                                                          \
+			stl::report_and_fail("out of memory"sv);                      \
+		}                                                                 \
+	}                                                                     \
+                                                                          \
+	void operator delete(void* a_ptr) { RE::free(a_ptr); }                \
+	void operator delete[](void* a_ptr) { RE::free(a_ptr); }              \
+	void operator delete(void* a_ptr, std::size_t) { RE::free(a_ptr); }   \
+	void operator delete[](void* a_ptr, std::size_t) { RE::free(a_ptr); } \
+                                                                          \
+	F4_HEAP_REDEFINE_HELPER(__VA_ARGS__)
+
+#define F4_HEAP_REDEFINE_ALIGNED_NEW(...)                                         \
+	[[nodiscard]] void* operator new(std::size_t a_count)                         \
+	{                                                                             \
+		const auto mem = RE::aligned_alloc(alignof(__VA_ARGS__), a_count);        \
+		if (mem) {                                                                \
+			return mem;                                                           \
+		} else {                                                                  \
+			stl::report_and_fail("out of memory"sv);                              \
+		}                                                                         \
+	}                                                                             \
+                                                                                  \
+	[[nodiscard]] void* operator new[](std::size_t a_count)                       \
+	{                                                                             \
+		const auto mem = RE::aligned_alloc(alignof(__VA_ARGS__), a_count);        \
+		if (mem) {                                                                \
+			return mem;                                                           \
+		} else {                                                                  \
+			stl::report_and_fail("out of memory"sv);                              \
+		}                                                                         \
+	}                                                                             \
+                                                                                  \
+	void operator delete(void* a_ptr) { RE::aligned_free(a_ptr); }                \
+	void operator delete[](void* a_ptr) { RE::aligned_free(a_ptr); }              \
+	void operator delete(void* a_ptr, std::size_t) { RE::aligned_free(a_ptr); }   \
+	void operator delete[](void* a_ptr, std::size_t) { RE::aligned_free(a_ptr); } \
+                                                                                  \
+	F4_HEAP_REDEFINE_HELPER(__VA_ARGS__)
@@ -0,0 +1,757 @@
+// the host has no game module, so pretend one is loaded at a fake base with a fixed
+// version, and let the address library be read from the working directory
+namespace WinAPI
+{
+	inline constexpr auto(PAGE_EXECUTE_READWRITE){ static_cast<std::uint32_t>(0x40) };
+
+	inline constexpr auto TEST_RUNTIME_VERSION{ L"1.10.163.0"sv };
+
+	std::uint32_t(GetEnvironmentVariable)(const wchar_t*, wchar_t*, std::uint32_t) noexcept { return 0; }
+
+	std::uint32_t(GetFileVersionInfoSize)(const wchar_t*, std::uint32_t*) noexcept { return 1; }
+
+	bool(GetFileVersionInfo)(const wchar_t*, std::uint32_t, std::uint32_t, void*) noexcept { return true; }
+
+	void*(GetModuleHandle)(const wchar_t*) noexcept
+	{
+		alignas(0x1000) static std::byte image[0x1000];
+		return image;
+	}
+
+	bool(VerQueryValue)(const void*, const wchar_t*, void** a_buffer, std::uint32_t* a_len) noexcept
+	{
+		*a_buffer = const_cast<wchar_t*>(TEST_RUNTIME_VERSION.data());
+		*a_len = static_cast<std::uint32_t>(TEST_RUNTIME_VERSION.length());
+		return true;
+	}
+
+	bool(VirtualProtect)(void*, std::size_t, std::uint32_t, std::uint32_t*) noexcept { return true; }
+}
+
+namespace REL
+{
+	namespace stl = ::stl;
+	namespace WinAPI = ::WinAPI;
+}
+
+#include "REL/Pattern.h"
+#include "REL/Relocation.h"
+
+#include "RE/TypeIDs.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace REL
+{
+	void Module::load_segments() {}
+}
+
+namespace
+{
+	inline constexpr std::uint64_t ID_LIMIT = 1u << 21;
+
+	// real address libraries are near-dense, so leave a few holes
+	[[nodiscard]] constexpr bool has_id(std::uint64_t a_id) noexcept { return a_id < ID_LIMIT && a_id % 64 != 63; }
+
+	[[nodiscard]] constexpr std::uint64_t make_offset(std::uint64_t a_id) noexcept { return 0x1000 + a_id * 0x10; }
+
+	using mappings_t = std::vector<std::pair<std::uint64_t, std::uint64_t>>;
+
+	// fixtures go to a directory of this process's own under the system temp directory, which is
+	// removed on exit, so a run leaves nothing behind and concurrent runs don't share files
+	[[nodiscard]] const std::filesystem::path& scratch_directory()
+	{
+		static const struct scratch_t
+		{
+		public:
+			scratch_t() :
+				path(std::filesystem::temp_directory_path() /
+					 fmt::format("CommonLibF4.Tests.{:08X}", std::random_device{}())),
+				previous(std::filesystem::current_path())
+			{
+				std::filesystem::create_directories(path);
+			}
+
+			~scratch_t()
+			{
+				std::error_code ec;
+				std::filesystem::current_path(previous, ec);
+				std::filesystem::remove_all(path, ec);
+			}
+
+			// members
+			std::filesystem::path path;
+			std::filesystem::path previous;
+		} scratch;
+		return scratch.path;
+	}
+
+	[[nodiscard]] const mappings_t& make_mappings()
+	{
+		static const auto mappings = []() {
+			mappings_t result;
+			for (std::uint64_t id = 0; id < ID_LIMIT; ++id) {
+				if (has_id(id)) {
+					result.emplace_back(id, make_offset(id));
+				}
+			}
+			return result;
+		}();
+		return mappings;
+	}
+
+	// the raw format, in whatever order the mappings are given
+	void write_raw(const std::filesystem::path& a_path, std::span<const std::pair<std::uint64_t, std::uint64_t>> a_mappings)
+	{
+		std::filesystem::create_directories(a_path.parent_path());
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		REQUIRE(file.is_open());
+		const auto binary_write = [&](std::uint64_t a_data) {
+			file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+		};
+
+		binary_write(a_mappings.size());
+		for (const auto& [id, offset] : a_mappings) {
+			binary_write(id);
+			binary_write(offset);
+		}
+	}
+
+	// writes a synthetic address library for TEST_RUNTIME_VERSION. IDDatabase looks for it relative to
+	// the working directory, so that is moved into the scratch directory first
+	void make_database()
+	{
+		static const bool once = []() {
+			std::filesystem::current_path(scratch_directory());
+			const auto version = REL::Module::get().version();
+			write_raw(fmt::format("Data/F4SE/Plugins/version-{}.bin", version.string()), make_mappings());
+			return true;
+		}();
+		(void)once;
+	}
+
+	// mirrors the offset index in AddressLibGen, for a library holding a_mappings
+	void write_index(const std::filesystem::path& a_path, mappings_t a_mappings)
+	{
+		std::vector<REL::AddressLibrary::mapping_t> library;
+		for (const auto& [id, offset] : a_mappings) {
+			library.push_back({ id, offset });
+		}
+		const auto checksum = REL::AddressLibrary::OffsetIndex::checksum(library);
+		std::sort(a_mappings.begin(), a_mappings.end(), [](auto&& a_lhs, auto&& a_rhs) { return a_lhs.second < a_rhs.second; });
+
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		REQUIRE(file.is_open());
+		const auto binary_write = [&](std::uint64_t a_data) {
+			file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+		};
+
+		binary_write(REL::AddressLibrary::OffsetIndex::MAGIC);
+		binary_write(a_mappings.size());
+		binary_write(checksum);
+		for (const auto& [id, offset] : a_mappings) {
+			binary_write(id);
+			binary_write(offset);
+		}
+	}
+
+	// mirrors the encoder in AddressLibGen
+	void write_compact(const std::filesystem::path& a_path, std::span<const std::pair<std::uint64_t, std::uint64_t>> a_mappings, std::uint32_t a_blockSize)
+	{
+		const auto write_varint = [](std::vector<std::uint8_t>& a_dst, std::uint64_t a_value) {
+			while (a_value >= 0x80) {
+				a_dst.push_back(static_cast<std::uint8_t>(a_value | 0x80));
+				a_value >>= 7;
+			}
+			a_dst.push_back(static_cast<std::uint8_t>(a_value));
+		};
+
+		std::vector<std::uint64_t> index;
+		std::vector<std::uint8_t> payload;
+		for (std::size_t i = 0; i < a_mappings.size(); ++i) {
+			const auto& [id, offset] = a_mappings[i];
+			if (i % a_blockSize == 0) {
+				index.insert(index.end(), { id, offset, payload.size() });
+			} else {
+				const auto delta = static_cast<std::int64_t>(offset - a_mappings[i - 1].second);
+				write_varint(payload, id - a_mappings[i - 1].first);
+				write_varint(payload, (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63));
+			}
+		}
+
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		REQUIRE(file.is_open());
+		const auto binary_write = [&](auto a_data) {
+			file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+		};
+
+		binary_write(REL::AddressLibrary::Compact::MAGIC);
+		binary_write(static_cast<std::uint64_t>(a_mappings.size()));
+		binary_write(a_blockSize);
+		binary_write(static_cast<std::uint32_t>(index.size() / 3));
+		file.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(std::uint64_t)));
+		file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+	}
+
+	inline constexpr std::uint32_t IMAGE_TEXT_RVA = 0x1000;
+	inline constexpr std::uint32_t IMAGE_RDATA_RVA = 0x2000;
+	inline constexpr std::uint32_t IMAGE_RSRC_RVA = 0x4000;
+	inline constexpr std::uint32_t IMAGE_RELOC_RVA = 0x4100;
+	inline constexpr std::uint64_t IMAGE_BASE = 0x140000000;
+
+	// a minimal x64 PE, with sections whose file offsets differ from their rvas
+	[[nodiscard]] std::vector<std::byte> make_image()
+	{
+		std::vector<std::byte> image(0x1000);
+		const auto write = [&](std::size_t a_offset, auto a_value) {
+			std::memcpy(image.data() + a_offset, std::addressof(a_value), sizeof(a_value));
+		};
+
+		write(0x0, std::uint16_t{ 0x5A4D });
+		write(0x3C, std::uint32_t{ 0x80 });
+		write(0x80, std::uint32_t{ 0x4550 });
+		write(0x84, std::uint16_t{ 0x8664 });  // machine
+		write(0x86, std::uint16_t{ 4 });       // number of sections
+		write(0x94, std::uint16_t{ 0xF0 });    // size of optional header
+		write(0x98, std::uint16_t{ 0x20B });
+		write(0x98 + 0x38, std::uint32_t{ 0x5000 });  // size of image
+		write(0x98 + 0x3C, std::uint32_t{ 0x400 });   // size of headers
+		write(0x98 + 0x18, IMAGE_BASE);
+		write(0x98 + 0x80, IMAGE_RSRC_RVA);
+		write(0x98 + 0x84, std::uint32_t{ 0x100 });
+		write(0x98 + 0x98, IMAGE_RELOC_RVA);
+		write(0x98 + 0x9C, std::uint32_t{ 0xC });
+
+		const auto section = [&](std::size_t a_idx, std::string_view a_name, std::uint32_t a_rva, std::uint32_t a_virtualSize, std::uint32_t a_rawOffset, std::uint32_t a_rawSize) {
+			const auto offset = 0x98 + 0xF0 + a_idx * 0x28;
+			std::memcpy(image.data() + offset, a_name.data(), a_name.size());
+			write(offset + 0x08, a_virtualSize);
+			write(offset + 0x0C, a_rva);
+			write(offset + 0x10, a_rawSize);
+			write(offset + 0x14, a_rawOffset);
+			if (image.size() < a_rawOffset + a_rawSize) {
+				image.resize(a_rawOffset + a_rawSize);
+			}
+		};
+
+		section(0, ".text"sv, IMAGE_TEXT_RVA, 0x800, 0x400, 0x800);
+		section(1, ".rdata"sv, IMAGE_RDATA_RVA, 0x1200, 0xC00, 0x200);  // the tail is uninitialized
+		section(2, ".rsrc"sv, IMAGE_RSRC_RVA, 0x100, 0xE00, 0x100);
+		section(3, ".reloc"sv, IMAGE_RELOC_RVA, 0xC, 0xF00, 0x100);
+
+		for (std::size_t i = 0; i < 0x800; ++i) {
+			image[0x400 + i] = static_cast<std::byte>(i * 7);
+		}
+		write(0xC00, 0xDEADBEEF);
+		write(0xC08, IMAGE_BASE + IMAGE_TEXT_RVA);  // an absolute pointer, rebased by the reloc block below
+
+		write(0xF00, IMAGE_RDATA_RVA);
+		write(0xF04, std::uint32_t{ 0xC });
+		write(0xF08, std::uint16_t{ (10 << 12) | 0x8 });  // IMAGE_REL_BASED_DIR64
+		write(0xF0A, std::uint16_t{ 0 });                 // padding
+
+		write(0xE00 + 0x28, std::uint32_t{ 0xFEEF04BD });
+		write(0xE00 + 0x28 + 0x10, std::uint32_t{ (1u << 16) | 10 });   // product version ms
+		write(0xE00 + 0x28 + 0x14, std::uint32_t{ (163u << 16) | 0 });  // product version ls
+
+		return image;
+	}
+
+	void write_file(const std::filesystem::path& a_path, std::span<const std::byte> a_data)
+	{
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		REQUIRE(file.is_open());
+		file.write(reinterpret_cast<const char*>(a_data.data()), static_cast<std::streamsize>(a_data.size()));
+	}
+
+	// every id referenced by the RTTI and VTABLE shards, in declaration order
+	[[nodiscard]] const std::vector<std::uint64_t>& replay_ids()
+	{
+		static const auto ids = []() {
+			std::vector<std::filesystem::path> shards;
+			for (const auto dirname : { "RTTI"sv, "VTABLE"sv }) {
+				const auto first = shards.size();
+				for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::path(COMMONLIBF4_INCLUDE_DIR) / "RE" / "IDs" / dirname)) {
+					shards.push_back(entry.path());
+				}
+				std::sort(shards.begin() + first, shards.end());
+			}
+
+			std::vector<std::uint64_t> result;
+			const std::regex regex(R"regex((?:REL::ID\(|\{ )(\d+))regex");
+			for (const auto& shard : shards) {
+				std::ifstream file(shard);
+				REQUIRE(file.is_open());
+				const std::string text{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+				for (std::sregex_iterator it(text.begin(), text.end(), regex), last; it != last; ++it) {
+					result.push_back(std::stoull((*it)[1].str()));
+				}
+			}
+			std::erase_if(result, [](std::uint64_t a_id) { return !has_id(a_id); });
+			return result;
+		}();
+		return ids;
+	}
+
+	// code-like bytes: a handful of opcodes are far more common than the rest, which is what makes
+	// a single-byte filter weak and a byte pair filter worthwhile
+	[[nodiscard]] std::vector<std::byte> make_text(std::size_t a_size, std::uint32_t a_seed)
+	{
+		constexpr std::array<std::uint8_t, 8> common{ 0x48, 0x8B, 0x89, 0xE8, 0x00, 0xCC, 0x0F, 0xFF };
+		std::mt19937 rng(a_seed);
+		std::vector<std::byte> result(a_size);
+		for (auto& byte : result) {
+			const auto roll = rng();
+			byte = static_cast<std::byte>(roll % 2 == 0 ? common[(roll >> 1) % common.size()] : (roll >> 8) & 0xFF);
+		}
+		return result;
+	}
+
+	// a signature lifted from the haystack at a_offset, with wildcards where an operand would go
+	[[nodiscard]] std::string make_signature(std::span<const std::byte> a_text, std::size_t a_offset, std::size_t a_length)
+	{
+		std::string result;
+		for (std::size_t i = 0; i < a_length; ++i) {
+			if (!result.empty()) {
+				result += ' ';
+			}
+			if (3 <= i && i < 7) {
+				result += "??"sv;
+			} else {
+				result += fmt::format("{:02X}", std::to_integer<std::uint8_t>(a_text[a_offset + i]));
+			}
+		}
+		return result;
+	}
+
+	inline constexpr std::array LOOKUPS{
+		std::make_pair(REL::IDDatabase::Lookup::binary_search, "binary search"sv),
+		std::make_pair(REL::IDDatabase::Lookup::dense, "dense"sv),
+		std::make_pair(REL::IDDatabase::Lookup::eytzinger, "eytzinger"sv),
+	};
+}
+
+TEST_CASE("test id lookup")
+{
+	make_database();
+
+	auto& iddb = REL::IDDatabase::get();
+	REQUIRE(iddb.lookup() == REL::IDDatabase::Lookup::dense);
+
+	const auto base = REL::Module::get().base();
+	for (const auto& [lookup, name] : LOOKUPS) {
+		INFO(name);
+		iddb.set_lookup(lookup);
+		REQUIRE(iddb.lookup() == lookup);
+		for (std::uint64_t id = 0; id < ID_LIMIT + 64; id += 61) {
+			if (has_id(id)) {
+				REQUIRE(REL::ID(id).offset() == make_offset(id));
+				REQUIRE(REL::Relocation<std::uintptr_t>(REL::ID(id)).address() == base + make_offset(id));
+			} else {
+				REQUIRE_THROWS(REL::ID(id).offset());
+			}
+		}
+	}
+
+	iddb.set_lookup(REL::IDDatabase::Lookup::automatic);
+}
+
+TEST_CASE("test offline image")
+{
+	const auto bytes = make_image();
+	write_file("Fallout4.test.exe", bytes);
+
+	const REL::Module image("Fallout4.test.exe"sv);
+	REQUIRE(image.version() == REL::Version(1, 10, 163, 0));
+	REQUIRE(image.filename() == L"Fallout4.test.exe"sv);
+
+	const auto text = image.segment(REL::Segment::text);
+	REQUIRE(text.offset() == IMAGE_TEXT_RVA);
+	REQUIRE(text.size() == 0x800);
+	REQUIRE(std::memcmp(text.pointer(), bytes.data() + 0x400, text.size()) == 0);
+
+	const auto rdata = image.segment(REL::Segment::rdata);
+	REQUIRE(rdata.offset() == IMAGE_RDATA_RVA);
+	REQUIRE(rdata.size() == 0x1200);
+	REQUIRE(*rdata.pointer<std::uint32_t>() == 0xDEADBEEF);
+	REQUIRE(*reinterpret_cast<const std::uintptr_t*>(rdata.address() + 0x8) == text.address());
+	REQUIRE(*reinterpret_cast<const std::uint32_t*>(image.base() + IMAGE_RDATA_RVA + 0x1000) == 0);
+
+	REQUIRE(image.segment(REL::Segment::data).size() == 0);
+
+	// damaged files are rejected, rather than read out of bounds
+	for (const std::size_t size : { 0x2u, 0x90u, 0x300u, 0xC10u, 0xF08u }) {
+		INFO(size);
+		write_file("Fallout4.test.exe", std::span{ bytes }.first(size));
+		REQUIRE_THROWS(REL::Module("Fallout4.test.exe"sv));
+	}
+
+	auto corrupt = bytes;
+	corrupt[0x80] = std::byte{ 'N' };
+	write_file("Fallout4.test.exe", corrupt);
+	REQUIRE_THROWS(REL::Module("Fallout4.test.exe"sv));
+
+	corrupt = bytes;
+	corrupt[0xF04] = std::byte{ 0xFF };  // reloc block overruns its directory
+	write_file("Fallout4.test.exe", corrupt);
+	REQUIRE_THROWS(REL::Module("Fallout4.test.exe"sv));
+
+	std::filesystem::remove("Fallout4.test.exe");
+}
+
+TEST_CASE("test batch id lookup")
+{
+	make_database();
+
+	auto& iddb = REL::IDDatabase::get();
+	const auto& ids = replay_ids();
+	std::vector<std::uint64_t> offsets(ids.size());
+	for (const auto& [lookup, name] : LOOKUPS) {
+		INFO(name);
+		iddb.set_lookup(lookup);
+
+		std::fill(offsets.begin(), offsets.end(), 0);
+		iddb.id2offset(ids, offsets);
+		for (std::size_t i = 0; i < ids.size(); ++i) {
+			REQUIRE(offsets[i] == make_offset(ids[i]));
+		}
+
+		// every missing id is named in a single report
+		const std::array missing{ std::uint64_t{ 5 }, std::uint64_t{ 127 }, std::uint64_t{ 63 }, std::uint64_t{ 127 }, ID_LIMIT + 1 };
+		std::array<std::uint64_t, missing.size()> result{};
+		try {
+			iddb.id2offset(missing, result);
+			FAIL("missing ids were not reported");
+		} catch (const std::runtime_error& e) {
+			REQUIRE(e.what() == fmt::format("3 ids not found: 63, 127, {}", ID_LIMIT + 1));
+		}
+		REQUIRE(result[0] == make_offset(5));
+	}
+	iddb.set_lookup(REL::IDDatabase::Lookup::automatic);
+
+	constexpr std::array table{ REL::ID(ID_LIMIT / 2), REL::ID(0), REL::ID(1) };
+	const auto addresses = REL::resolve(table);
+	for (std::size_t i = 0; i < table.size(); ++i) {
+		REQUIRE(addresses[i] == table[i].address());
+	}
+}
+
+TEST_CASE("test compact address library")
+{
+	make_database();  // for the module version
+
+	auto mappings = make_mappings();
+	// offsets are not monotonic in real libraries
+	std::swap(mappings[100].second, mappings[5000].second);
+	mappings.back().second = 0xFFFFFFFFFF;
+
+	for (const std::uint32_t blockSize : { 1u, 7u, 256u }) {
+		INFO(blockSize);
+		const auto path = scratch_directory() / fmt::format("compact-{}.bin", blockSize);
+		write_compact(path, mappings, blockSize);
+		const stl::scope_exit cleanup([&]() { std::filesystem::remove(path); });
+
+		REL::IDDatabase compact(path.string());
+		REQUIRE(compact.memory_usage() >= mappings.size() * 0x10);
+		for (const auto& [id, offset] : mappings) {
+			if (id % 97 == 0 || offset != make_offset(id)) {
+				REQUIRE(compact.id2offset(id) == offset);
+			}
+		}
+		REQUIRE_THROWS(compact.id2offset(63));
+		REQUIRE_THROWS(compact.id2offset(ID_LIMIT));
+	}
+
+	const auto truncated = scratch_directory() / "compact-truncated.bin";
+	write_compact(truncated, mappings, 256);
+	const stl::scope_exit cleanup([&]() { std::filesystem::remove(truncated); });
+	std::filesystem::resize_file(truncated, std::filesystem::file_size(truncated) - 1);
+	REQUIRE_THROWS(REL::IDDatabase(truncated.string()));
+}
+
+TEST_CASE("test offset lookup")
+{
+	make_database();  // for the module version
+
+	// offsets are not monotonic in ids, so the reverse index is a permutation of the library
+	auto mappings = make_mappings();
+	std::swap(mappings[100].second, mappings[5000].second);
+	const auto path = scratch_directory() / "reverse.bin";
+	const auto index = scratch_directory() / "reverse.offsets.bin";
+	write_raw(path, mappings);
+	const stl::scope_exit cleanup([&]() {
+		std::filesystem::remove(path);
+		std::filesystem::remove(index);
+	});
+
+	const REL::IDDatabase iddb(path.string());
+	const REL::IDDatabase::Offset2ID sorted(iddb);
+	REQUIRE(!sorted.mapped());
+
+	write_index(index, mappings);
+	const REL::IDDatabase::Offset2ID mapped(iddb);
+	REQUIRE(mapped.mapped());
+
+	const auto library = mappings;
+	std::sort(mappings.begin(), mappings.end(), [](auto&& a_lhs, auto&& a_rhs) { return a_lhs.second < a_rhs.second; });
+
+	for (const auto* offset2id : { &sorted, &mapped }) {
+		INFO(offset2id->mapped());
+		REQUIRE(offset2id->size() == mappings.size());
+		REQUIRE(std::equal(offset2id->begin(), offset2id->end(), mappings.begin(), mappings.end(), [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.id == a_rhs.first && a_lhs.offset == a_rhs.second;
+		}));
+
+		for (std::size_t i = 0; i < mappings.size(); i += 31) {
+			const auto& [id, offset] = mappings[i];
+			REQUIRE((*offset2id)(offset) == id);
+
+			// addresses inside a function resolve to its start, but only when asked for
+			const auto symbol = offset2id->nearest(offset + 0xF);
+			REQUIRE(symbol.id == id);
+			REQUIRE(symbol.displacement == 0xF);
+			REQUIRE_THROWS((*offset2id)(offset + 0xF));
+		}
+
+		REQUIRE(offset2id->nearest(std::numeric_limits<std::uint64_t>::max()).id == mappings.back().first);
+		REQUIRE_THROWS((*offset2id)(mappings.front().second - 1));
+	}
+
+	// an index that doesn't match its library is not trusted, even with the same entry count
+	write_index(index, mappings_t(library.begin(), library.end() - 1));
+	REQUIRE(!REL::IDDatabase::Offset2ID(iddb).mapped());
+
+	auto stale = library;
+	std::swap(stale[200].second, stale[300].second);
+	write_index(index, stale);
+	REQUIRE(!REL::IDDatabase::Offset2ID(iddb).mapped());
+
+	write_raw(index, mappings);  // no header
+	REQUIRE(!REL::IDDatabase::Offset2ID(iddb).mapped());
+}
+
+TEST_CASE("test type id lookup")
+{
+	const auto& table = RE::TYPE_IDS::TABLE;
+	REQUIRE(std::is_sorted(table.begin(), table.end(), [](auto&& a_lhs, auto&& a_rhs) { return a_lhs.name < a_rhs.name; }));
+
+	static_assert(RE::TYPE_IDS::find("Actor"sv)->rtti.id() == RE::RTTI::Actor.id());
+	const auto actor = RE::TYPE_IDS::find("Actor"sv);
+	REQUIRE(actor != nullptr);
+	REQUIRE(actor->vtable.size() == RE::VTABLE::Actor.size());
+	REQUIRE(actor->vtable.front().id() == RE::VTABLE::Actor.front().id());
+	REQUIRE(RE::TYPE_IDS::find("AStarSearchBase"sv)->vtable.empty());
+	REQUIRE(RE::TYPE_IDS::find("NotAType"sv) == nullptr);
+	REQUIRE(RE::TYPE_IDS::find(""sv) == nullptr);
+
+	const auto sink = RE::TYPE_IDS::find_demangled("BSTEventSink<TESHitEvent>"sv);
+	REQUIRE(sink != nullptr);
+	REQUIRE(sink->rtti.id() == RE::RTTI::BSTEventSink_TESHitEvent_.id());
+
+	const auto creator = RE::TYPE_IDS::find_demangled("AutoRegisterMovementAgentCreator<`anonymous namespace'::MovementHandlerAgentAngleControllerLoadScrapper>"sv);
+	REQUIRE(creator != nullptr);
+	REQUIRE(creator->name == "AutoRegisterMovementAgentCreator___MovementHandlerAgentAngleControllerLoadScrapper_"sv);
+
+	for (const auto& entry : table) {
+		REQUIRE(RE::TYPE_IDS::find(entry.name) == std::addressof(entry));
+	}
+}
+
+TEST_CASE("test pattern scan")
+{
+	const REL::Pattern call("48 8B ?? ?? E8");
+	REQUIRE(call.size() == 5);
+	REQUIRE(REL::Pattern("48 8b ? ? e8").size() == 5);
+	REQUIRE_THROWS(REL::Pattern("48 8G"));
+	REQUIRE_THROWS(REL::Pattern("48 8"));
+	REQUIRE_THROWS(REL::Pattern("?? ??"));
+
+	const auto text = make_text(1u << 16, 1);
+	std::vector<REL::Pattern> patterns;
+	std::mt19937 rng(2);
+	for (std::size_t i = 0; i < 256; ++i) {
+		patterns.emplace_back(make_signature(text, rng() % (text.size() - 16), 4 + rng() % 12));
+	}
+	patterns.emplace_back("?? ?? 48 ?? 8B ?? E8");  // no concrete pair
+	patterns.emplace_back("?? CC ??");
+	patterns.emplace_back("DE AD BE EF DE AD BE EF");  // absent
+
+	// every offset and tail length, so the vector blocks and the scalar tail are both exercised
+	for (const auto& pattern : patterns) {
+		for (const auto skip : { 0u, 1u, 15u, 31u }) {
+			const auto haystack = std::span{ text }.subspan(skip);
+			REQUIRE(pattern.search(haystack) == pattern.search_scalar(haystack));
+		}
+	}
+
+	const auto tail = std::span{ text }.last(patterns.front().size() + 3);
+	REQUIRE(patterns.front().search(tail) == patterns.front().search_scalar(tail));
+	REQUIRE(patterns.front().search(tail.first(patterns.front().size() - 1)) == nullptr);
+
+	const REL::PatternSet set(patterns);
+	const auto results = set.search(text);
+	REQUIRE(results.size() == patterns.size());
+	for (std::size_t i = 0; i < patterns.size(); ++i) {
+		REQUIRE(results[i] == patterns[i].search_scalar(text));
+	}
+	REQUIRE(results.back() == nullptr);
+
+	const REL::Segment segment(0, reinterpret_cast<std::uintptr_t>(text.data()), text.size());
+	REQUIRE(patterns.front().search(segment) == reinterpret_cast<std::uintptr_t>(patterns.front().search_scalar(text)));
+	REQUIRE(set.search(segment).back() == 0);
+}
+
+TEST_CASE("benchmark id lookup")
+{
+	make_database();
+
+	auto& iddb = REL::IDDatabase::get();
+	const auto& ids = replay_ids();
+	REQUIRE(!ids.empty());
+
+	for (const auto& [lookup, name] : LOOKUPS) {
+		iddb.set_lookup(lookup);
+		fmt::print("{}: {} KiB\n", name, iddb.memory_usage() / 1024);
+
+		BENCHMARK(std::string(name))
+		{
+			std::size_t sum = 0;
+			for (const auto id : ids) {
+				sum += iddb.id2offset(id);
+			}
+			return sum;
+		};
+	}
+
+	iddb.set_lookup(REL::IDDatabase::Lookup::automatic);
+}
+
+TEST_CASE("benchmark batch id lookup")
+{
+	make_database();
+
+	auto& iddb = REL::IDDatabase::get();
+	const auto& ids = replay_ids();
+	std::vector<std::uint64_t> offsets(ids.size());
+	for (const auto& [lookup, name] : LOOKUPS) {
+		iddb.set_lookup(lookup);
+		BENCHMARK(fmt::format("{} batch", name))
+		{
+			iddb.id2offset(ids, offsets);
+			return offsets.back();
+		};
+	}
+
+	iddb.set_lookup(REL::IDDatabase::Lookup::automatic);
+}
+
+TEST_CASE("benchmark relocation caching")
+{
+	make_database();
+
+	constexpr std::uint64_t id = ID_LIMIT / 3;
+	static_assert(has_id(id));
+	BENCHMARK("uncached relocation")
+	{
+		REL::Relocation<std::uintptr_t> func{ REL::ID(id) };
+		return func.address();
+	};
+
+	BENCHMARK("cached relocation")
+	{
+		static REL::Relocation<std::uintptr_t> func{ REL::ID(id) };
+		return func.address();
+	};
+}
+
+TEST_CASE("benchmark offset lookup")
+{
+	make_database();
+
+	const auto& iddb = REL::IDDatabase::get();
+	const auto path = iddb.reverse_path();
+	std::filesystem::remove(path);
+	BENCHMARK("sorted construction")
+	{
+		return REL::IDDatabase::Offset2ID(iddb).size();
+	};
+
+	write_index(path, make_mappings());
+	BENCHMARK("mapped construction")
+	{
+		return REL::IDDatabase::Offset2ID(iddb).size();
+	};
+
+	const REL::IDDatabase::Offset2ID offset2id(iddb);
+	std::vector<std::uint64_t> offsets;
+	for (const auto id : replay_ids()) {
+		offsets.push_back(make_offset(id) + 4);
+	}
+
+	BENCHMARK("binary search")
+	{
+		const auto comp = [](std::uint64_t a_lhs, auto&& a_rhs) { return a_lhs < a_rhs.offset; };
+		std::size_t sum = 0;
+		for (const auto offset : offsets) {
+			const auto it = std::upper_bound(offset2id.begin(), offset2id.end(), offset, comp);
+			sum += std::prev(it)->id;
+		}
+		return sum;
+	};
+
+	BENCHMARK("radix")
+	{
+		std::size_t sum = 0;
+		for (const auto offset : offsets) {
+			sum += offset2id.nearest(offset).id;
+		}
+		return sum;
+	};
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("benchmark pattern scan")
+{
+	// a .text sized haystack, and signatures spread through it as they would be in a real plugin
+	const auto text = make_text(32u << 20, 3);
+	std::vector<REL::Pattern> patterns;
+	for (std::size_t i = 0; i < 256; ++i) {
+		patterns.emplace_back(make_signature(text, (text.size() / 256) * i + 0x123, 16));
+	}
+
+	// the searcher can't do wildcards, so it only looks for the bytes before the first one
+	std::vector<std::span<const std::byte>> needles;
+	for (const auto& pattern : patterns) {
+		needles.push_back(std::span{ text }.subspan(pattern.search_scalar(text) - text.data(), 3));
+	}
+
+	BENCHMARK("boyer moore horspool")
+	{
+		std::size_t sum = 0;
+		for (const auto& needle : needles) {
+			const std::boyer_moore_horspool_searcher searcher(needle.begin(), needle.end());
+			sum += static_cast<std::size_t>(searcher(text.begin(), text.end()).first - text.begin());
+		}
+		return sum;
+	};
+
+	BENCHMARK("vectorized")
+	{
+		std::size_t sum = 0;
+		for (const auto& pattern : patterns) {
+			sum += reinterpret_cast<std::uintptr_t>(pattern.search(text));
+		}
+		return sum;
+	};
+
+	const REL::PatternSet set(patterns);
+	BENCHMARK("batched")
+	{
+		std::size_t sum = 0;
+		for (const auto result : set.search(text)) {
+			sum += reinterpret_cast<std::uintptr_t>(result);
+		}
+		return sum;
+	};
+}
@@ -0,0 +1,348 @@
+#include "MemoryManager.h"
+
+namespace RE
+{
+	template <class T>
+	using BSCRC32 = std::hash<T>;
+
+	template <class T1, class T2>
+	using BSTTuple = std::pair<T1, T2>;
+}
+
+#include "RE/Bethesda/BSTArray.h"
+#include "RE/Bethesda/BSTHashMap.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	using Block = RE::ScrapHeap::Block;
+	using FreeBlock = RE::ScrapHeap::FreeBlock;
+	using FreeTreeNode = RE::ScrapHeap::FreeTreeNode;
+
+	[[nodiscard]] std::size_t size_of(const Block* a_block) { return a_block->sizeFlags & ~RE::ScrapHeap::FLAGS_MASK; }
+	[[nodiscard]] bool is_free(const Block* a_block) { return (a_block->sizeFlags & RE::ScrapHeap::FREE_FLAG) != 0; }
+
+	[[nodiscard]] const Block* next_of(const Block* a_block)
+	{
+		return reinterpret_cast<const Block*>(reinterpret_cast<const std::byte*>(a_block + 1) + size_of(a_block));
+	}
+
+	[[nodiscard]] const FreeTreeNode* parent_of(const FreeTreeNode* a_node)
+	{
+		return reinterpret_cast<const FreeTreeNode*>(a_node->parentAndBlack & ~std::size_t{ 1 });
+	}
+
+	[[nodiscard]] bool is_black(const FreeTreeNode* a_node) { return !a_node || (a_node->parentAndBlack & 1) != 0; }
+
+	// walks the tree below a_node, checking order, links and colours, and returns its black height
+	std::size_t check_tree(const RE::ScrapHeap& a_heap, const FreeTreeNode* a_node, std::size_t a_min, std::size_t a_max, std::size_t& a_count)
+	{
+		if (!a_node) {
+			return 1;
+		}
+
+		const auto size = size_of(a_node);
+		REQUIRE(is_free(a_node));
+		REQUIRE(size > RE::ScrapHeap::SMALL_BLOCK_MAX);
+		REQUIRE(a_min < size);
+		REQUIRE(size < a_max);
+		REQUIRE(a_node->root == std::addressof(a_heap.freeList));
+		REQUIRE(a_node->left == nullptr);
+		if (!is_black(a_node)) {
+			REQUIRE(is_black(a_node->leftNode));
+			REQUIRE(is_black(a_node->rightNode));
+		}
+
+		++a_count;
+		for (auto iter = a_node->right; iter; iter = iter->right) {
+			REQUIRE(is_free(iter));
+			REQUIRE(size_of(iter) == size);
+			REQUIRE(static_cast<const FreeTreeNode*>(iter)->root == nullptr);
+			REQUIRE(iter->left->right == iter);
+			++a_count;
+		}
+
+		for (const auto child : { a_node->leftNode, a_node->rightNode }) {
+			if (child) {
+				REQUIRE(parent_of(child) == a_node);
+			}
+		}
+
+		const auto left = check_tree(a_heap, a_node->leftNode, a_min, size, a_count);
+		const auto right = check_tree(a_heap, a_node->rightNode, size, a_max, a_count);
+		REQUIRE(left == right);
+		return left + (is_black(a_node) ? 1 : 0);
+	}
+
+	void check_heap(const RE::ScrapHeap& a_heap)
+	{
+		std::size_t allocated = 0;
+		std::size_t allocatedBlocks = 0;
+		std::size_t freeBlocks = 0;
+
+		// the blocks tile the heap from its base, with no two free ones side by side
+		const auto top = a_heap.lastBlock ? next_of(a_heap.lastBlock) : reinterpret_cast<const Block*>(a_heap.baseAddress);
+		const Block* prev = nullptr;
+		for (auto block = reinterpret_cast<const Block*>(a_heap.baseAddress); block != top; block = next_of(block)) {
+			REQUIRE(block < top);
+			REQUIRE(block->prev == prev);
+			if (is_free(block)) {
+				REQUIRE(!(prev && is_free(prev)));
+				++freeBlocks;
+			} else {
+				allocated += size_of(block);
+				++allocatedBlocks;
+			}
+			prev = block;
+		}
+		REQUIRE(prev == a_heap.lastBlock);
+		REQUIRE(!(prev && is_free(prev)));
+		REQUIRE(reinterpret_cast<const std::byte*>(top) <= a_heap.commitEnd);
+		REQUIRE(a_heap.commitEnd <= a_heap.endAddress);
+		REQUIRE(allocated == a_heap.totalAllocated);
+		REQUIRE(allocatedBlocks == a_heap.totalAllocatedBlocks);
+		REQUIRE(freeBlocks == a_heap.totalFreeBlocks);
+
+		std::size_t small = 0;
+		for (std::size_t i = 0; i < std::size(a_heap.smallBlocks); ++i) {
+			const FreeBlock* last = nullptr;
+			for (auto iter = a_heap.smallBlocks[i]; iter; iter = iter->right) {
+				REQUIRE(is_free(iter));
+				REQUIRE(size_of(iter) == (i + 1) * RE::ScrapHeap::GRANULARITY);
+				REQUIRE(iter->left == last);
+				last = iter;
+				++small;
+			}
+		}
+		REQUIRE(small == a_heap.freeSmallBlocks);
+
+		std::size_t large = 0;
+		if (a_heap.freeList) {
+			REQUIRE(parent_of(a_heap.freeList) == nullptr);
+			REQUIRE(is_black(a_heap.freeList));
+		}
+		check_tree(a_heap, a_heap.freeList, 0, std::numeric_limits<std::size_t>::max(), large);
+		REQUIRE(small + large == freeBlocks);
+	}
+
+	struct allocation
+	{
+		std::byte* mem;
+		std::size_t size;
+		std::byte fill;
+	};
+}
+
+TEST_CASE("test scrap heap")
+{
+	RE::ScrapHeap heap{ 1u << 24 };
+	check_heap(heap);
+
+	std::vector<allocation> live;
+	std::mt19937 rng(6);
+	const auto random_size = [&]() -> std::size_t {
+		switch (rng() % 8) {
+		case 0:
+			return rng() % 0x2000 + 1;
+		case 1:
+		case 2:
+			return rng() % 0x400 + 1;
+		default:
+			return rng() % RE::ScrapHeap::SMALL_BLOCK_MAX + 1;
+		}
+	};
+
+	const auto release = [&](std::size_t a_index) {
+		const auto [mem, size, fill] = live[a_index];
+		REQUIRE(std::all_of(mem, mem + size, [&](std::byte a_byte) { return a_byte == fill; }));
+		heap.Deallocate(mem);
+		live[a_index] = live.back();
+		live.pop_back();
+	};
+
+	// interleaved lifetimes of every size class, so blocks split, merge and cycle through both the
+	// small lists and the tree
+	for (std::size_t i = 0; i < 40000; ++i) {
+		if (live.empty() || rng() % 5 < 3) {
+			const auto size = random_size();
+			const std::size_t alignment = std::size_t{ 1 } << (rng() % 9);
+			const auto mem = static_cast<std::byte*>(heap.Allocate(size, alignment));
+			REQUIRE(mem != nullptr);
+			REQUIRE(heap.ContainsBlockImpl(mem));
+			REQUIRE(reinterpret_cast<std::uintptr_t>(mem) % std::max<std::size_t>(alignment, 0x10) == 0);
+			REQUIRE(heap.Size(mem) >= size);
+
+			const auto fill = static_cast<std::byte>(i);
+			std::fill_n(mem, size, fill);
+			live.push_back({ mem, size, fill });
+		} else {
+			release(rng() % live.size());
+		}
+
+		if (i % 1000 == 0) {
+			check_heap(heap);
+		}
+	}
+
+	check_heap(heap);
+	while (!live.empty()) {
+		release(rng() % live.size());
+	}
+
+	// everything merges back into the top, which gives back all but a commit's worth of its pages
+	check_heap(heap);
+	REQUIRE(heap.lastBlock == nullptr);
+	REQUIRE(heap.freeList == nullptr);
+	REQUIRE(heap.totalFreeBlocks == 0);
+	REQUIRE(static_cast<std::size_t>(heap.commitEnd - heap.baseAddress) <= heap.minCommit * 2);
+
+	// a freed block is the first pick for the next request of its size
+	const auto a = heap.Allocate(0x40, 0x8);
+	const auto b = heap.Allocate(0x40, 0x8);
+	heap.Deallocate(a);
+	REQUIRE(heap.Allocate(0x40, 0x8) == a);
+	const auto c = heap.Allocate(0x200, 0x8);
+	const auto d = heap.Allocate(0x40, 0x8);
+	heap.Deallocate(c);
+	REQUIRE(heap.Allocate(0x100, 0x8) == c);
+	heap.Deallocate(a);
+	heap.Deallocate(b);
+	heap.Deallocate(c);
+	heap.Deallocate(d);
+	check_heap(heap);
+
+	// past the reservation there is nothing left to commit
+	RE::ScrapHeap tiny{ 1u << 17 };
+	REQUIRE(tiny.Allocate(1u << 18, 0x8) == nullptr);
+	const auto whole = tiny.Allocate((1u << 17) - sizeof(Block), 0x8);
+	REQUIRE(whole != nullptr);
+	REQUIRE(tiny.Allocate(1, 0x8) == nullptr);
+	tiny.Deallocate(whole);
+	check_heap(tiny);
+}
+
+TEST_CASE("test thread scrap heap")
+{
+	auto& mm = RE::MemoryManager::GetSingleton();
+	const auto heap = mm.GetThreadScrapHeap();
+	REQUIRE(heap != nullptr);
+	REQUIRE(mm.GetThreadScrapHeap() == heap);
+
+	// assertions stay on this thread, the workers only report back
+	struct result
+	{
+		RE::ScrapHeap* heap{ nullptr };
+		bool stable{ false };
+		bool contained{ false };
+	};
+
+	std::array<result, 4> others{};
+	std::vector<std::thread> threads;
+	for (auto& other : others) {
+		threads.emplace_back([&]() {
+			other.heap = mm.GetThreadScrapHeap();
+			other.stable = mm.GetThreadScrapHeap() == other.heap;
+
+			RE::BSScrapArray<std::uint32_t> arr;
+			for (std::uint32_t i = 0; i < 1000; ++i) {
+				arr.push_back(i);
+			}
+			other.contained = other.heap->ContainsBlockImpl(arr.data());
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	for (std::size_t i = 0; i < others.size(); ++i) {
+		REQUIRE(others[i].stable);
+		REQUIRE(others[i].contained);
+		REQUIRE(others[i].heap != heap);
+		for (std::size_t j = i + 1; j < others.size(); ++j) {
+			REQUIRE(others[i].heap != others[j].heap);
+		}
+	}
+
+	RE::BSTScrapHashMap<std::uint32_t, std::uint32_t> map;
+	for (std::uint32_t i = 0; i < 1000; ++i) {
+		map.emplace(i, i);
+	}
+	REQUIRE(map.size() == 1000);
+	check_heap(*heap);
+}
+
+TEST_CASE("benchmark scrap heap")
+{
+	auto& mm = RE::MemoryManager::GetSingleton();
+	const auto heap = mm.GetThreadScrapHeap();
+
+	std::vector<std::size_t> sizes(4096);
+	std::mt19937 rng(7);
+	std::generate(sizes.begin(), sizes.end(), [&]() { return rng() % 0x200 + 1; });
+	std::vector<void*> blocks(sizes.size());
+
+	BENCHMARK("scrap heap alloc/free")
+	{
+		for (std::size_t i = 0; i < sizes.size(); ++i) {
+			blocks[i] = heap->Allocate(sizes[i], 0x8);
+		}
+		for (std::size_t i = 0; i < sizes.size(); i += 2) {
+			heap->Deallocate(blocks[i]);
+		}
+		for (std::size_t i = 1; i < sizes.size(); i += 2) {
+			heap->Deallocate(blocks[i]);
+		}
+		return blocks.front();
+	};
+
+	BENCHMARK("malloc alloc/free")
+	{
+		for (std::size_t i = 0; i < sizes.size(); ++i) {
+			blocks[i] = RE::malloc(sizes[i]);
+		}
+		for (std::size_t i = 0; i < sizes.size(); i += 2) {
+			RE::free(blocks[i]);
+		}
+		for (std::size_t i = 1; i < sizes.size(); i += 2) {
+			RE::free(blocks[i]);
+		}
+		return blocks.front();
+	};
+
+	BENCHMARK("BSScrapArray push_back")
+	{
+		RE::BSScrapArray<std::uint32_t> arr;
+		for (std::uint32_t i = 0; i < 4096; ++i) {
+			arr.push_back(i);
+		}
+		return arr.size();
+	};
+
+	BENCHMARK("BSTArray push_back")
+	{
+		RE::BSTArray<std::uint32_t> arr;
+		for (std::uint32_t i = 0; i < 4096; ++i) {
+			arr.push_back(i);
+		}
+		return arr.size();
+	};
+
+	BENCHMARK("BSTScrapHashMap insert")
+	{
+		RE::BSTScrapHashMap<std::uint32_t, std::uint32_t> map;
+		for (std::uint32_t i = 0; i < 1024; ++i) {
+			map.emplace(i, i);
+		}
+		return map.size();
+	};
+
+	BENCHMARK("BSTHashMap insert")
+	{
+		RE::BSTHashMap<std::uint32_t, std::uint32_t> map;
+		for (std::uint32_t i = 0; i < 1024; ++i) {
+			map.emplace(i, i);
+		}
+		return map.size();
+	};
+}
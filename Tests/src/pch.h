@@ -93,8 +93,124 @@
 #include <vector>
 #include <version>
 
+#include <xmmintrin.h>
+
 #pragma warning(push)
 #include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+#include <fmt/format.h>
+#include <mmio/mmio.hpp>
 #pragma warning(pop)
 
 using namespace std::literals;
+
+namespace stl
+{
+	template <class CharT>
+	using basic_zstring = std::basic_string_view<CharT>;
+
+	using zstring = basic_zstring<char>;
+	using zwstring = basic_zstring<wchar_t>;
+
+	[[noreturn]] inline void report_and_fail(std::string_view a_msg)
+	{
+		throw std::runtime_error(std::string(a_msg));
+	}
+
+	template <class EF>                                    //
+	requires(std::invocable<std::remove_reference_t<EF>>)  //
+		class scope_exit
+	{
+	public:
+		// 1)
+		template <class Fn>
+		explicit scope_exit(Fn&& a_fn)  //
+			noexcept(std::is_nothrow_constructible_v<EF, Fn> ||
+					 std::is_nothrow_constructible_v<EF, Fn&>)  //
+			requires(!std::is_same_v<std::remove_cvref_t<Fn>, scope_exit> &&
+					 std::is_constructible_v<EF, Fn>)
+		{
+			static_assert(std::invocable<Fn>);
+
+			if constexpr (!std::is_lvalue_reference_v<Fn> &&
+						  std::is_nothrow_constructible_v<EF, Fn>) {
+				_fn.emplace(std::forward<Fn>(a_fn));
+			} else {
+				_fn.emplace(a_fn);
+			}
+		}
+
+		// 2)
+		scope_exit(scope_exit&& a_rhs)  //
+			noexcept(std::is_nothrow_move_constructible_v<EF> ||
+					 std::is_nothrow_copy_constructible_v<EF>)  //
+			requires(std::is_nothrow_move_constructible_v<EF> ||
+					 std::is_copy_constructible_v<EF>)
+		{
+			static_assert(!(std::is_nothrow_move_constructible_v<EF> && !std::is_move_constructible_v<EF>));
+			static_assert(!(!std::is_nothrow_move_constructible_v<EF> && !std::is_copy_constructible_v<EF>));
+
+			if (a_rhs.active()) {
+				if constexpr (std::is_nothrow_move_constructible_v<EF>) {
+					_fn.emplace(std::forward<EF>(*a_rhs._fn));
+				} else {
+					_fn.emplace(a_rhs._fn);
+				}
+				a_rhs.release();
+			}
+		}
+
+		// 3)
+		scope_exit(const scope_exit&) = delete;
+
+		~scope_exit() noexcept
+		{
+			if (_fn.has_value()) {
+				(*_fn)();
+			}
+		}
+
+		void release() noexcept { _fn.reset(); }
+
+	private:
+		[[nodiscard]] bool active() const noexcept { return _fn.has_value(); }
+
+		std::optional<std::remove_reference_t<EF>> _fn;
+	};
+
+	template <class EF>
+	scope_exit(EF) -> scope_exit<EF>;
+
+	template <class C, class K>
+	concept transparent_comparator =
+		requires(
+			const K& a_transparent,
+			const typename C::key_type& a_key,
+			typename C::key_compare& a_compare)
+	{
+		typename C::key_compare::is_transparent;
+		// clang-format off
+		{ a_compare(a_transparent, a_key) } -> std::convertible_to<bool>;
+		{ a_compare(a_key, a_transparent) } -> std::convertible_to<bool>;
+		// clang-format on
+	};
+
+	template <class To, class From>
+	[[nodiscard]] To unrestricted_cast(From a_from)
+	{
+		if constexpr (std::is_same_v<
+						  std::remove_cv_t<From>,
+						  std::remove_cv_t<To>>) {
+			return To{ a_from };
+		} else if constexpr (std::is_pointer_v<From> && std::is_pointer_v<To>) {
+			return static_cast<To>(
+				const_cast<void*>(
+					static_cast<const volatile void*>(a_from)));
+		} else if constexpr ((std::is_pointer_v<From> && std::is_integral_v<To>) ||
+							 (std::is_integral_v<From> && std::is_pointer_v<To>)) {
+			return reinterpret_cast<To>(a_from);
+		} else {
+			return std::bit_cast<To>(a_from);
+		}
+	}
+}